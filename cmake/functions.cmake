@@ -325,3 +325,17 @@ function(is_ibv_flush_supported var)
 		NATIVE_FLUSH_SUPPORTED)
 	set(var ${NATIVE_FLUSH_SUPPORTED} PARENT_SCOPE)
 endfunction()
+
+# check if the USDT probes are supported (<sys/sdt.h> from systemtap)
+function(is_usdt_supported var)
+	check_c_source_compiles("
+		#include <sys/sdt.h>
+		/* check if DTRACE_PROBE2() is defined */
+		int main() {
+			int a = 0;
+			DTRACE_PROBE2(rpma, check, a, &a);
+			return a;
+		}"
+		USDT_SUPPORTED)
+	set(var ${USDT_SUPPORTED} PARENT_SCOPE)
+endfunction()
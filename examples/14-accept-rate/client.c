@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * client.c -- a client of the accept rate example
+ *
+ * The client connects the given number of connections to the server at once
+ * and waits for the server to close them.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <librpma.h>
+
+#ifdef TEST_MOCK_MAIN
+#define main client_main
+#endif
+
+#define DEFAULT_NUM_CONNS	8
+
+int
+main(int argc, char *argv[])
+{
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <addr> <port> [<num-conns>]\n", argv[0]);
+		exit(-1);
+	}
+
+	/* parameters */
+	char *addr = argv[1];
+	char *port = argv[2];
+	int num_conns = (argc > 3) ? atoi(argv[3]) : DEFAULT_NUM_CONNS;
+	if (num_conns < 1) {
+		fprintf(stderr, "invalid number of connections\n");
+		exit(-1);
+	}
+
+	/* resources */
+	struct ibv_context *ibv_ctx = NULL;
+	struct rpma_peer *peer = NULL;
+	struct rpma_conn_target *targets = NULL;
+	enum rpma_conn_event conn_event = RPMA_CONN_UNDEFINED;
+	int ret = 0;
+
+	targets = calloc((size_t)num_conns, sizeof(*targets));
+	if (targets == NULL)
+		return -1;
+
+	for (int i = 0; i < num_conns; i++) {
+		targets[i].addr = addr;
+		targets[i].port = port;
+	}
+
+	/* obtain an IBV context for a remote IP address */
+	ret = rpma_utils_get_ibv_context(addr, RPMA_UTIL_IBV_CONTEXT_REMOTE, &ibv_ctx);
+	if (ret)
+		goto err_free;
+
+	/* create a new peer object */
+	ret = rpma_peer_new(ibv_ctx, &peer);
+	if (ret)
+		goto err_free;
+
+	/* connect all the connections at once */
+	ret = rpma_conn_connect_all(peer, targets, num_conns, num_conns);
+	if (ret)
+		goto err_peer_delete;
+
+	for (int i = 0; i < num_conns; i++) {
+		if (targets[i].result) {
+			fprintf(stderr, "connection #%i failed: %s\n", i,
+				rpma_err_2str(targets[i].result));
+			ret = targets[i].result;
+		}
+	}
+	if (ret)
+		goto err_conns_delete;
+
+	/* wait for the connections to being closed by the server */
+	for (int i = 0; i < num_conns; i++) {
+		ret = rpma_conn_next_event(targets[i].conn, &conn_event);
+		if (!ret && conn_event != RPMA_CONN_CLOSED) {
+			fprintf(stderr, "rpma_conn_next_event returned an unexpected event: %s\n",
+				rpma_utils_conn_event_2str(conn_event));
+			ret = -1;
+		}
+		if (ret)
+			goto err_conns_delete;
+
+		ret = rpma_conn_disconnect(targets[i].conn);
+		if (ret)
+			goto err_conns_delete;
+
+		ret = rpma_conn_delete(&targets[i].conn);
+		if (ret)
+			goto err_conns_delete;
+	}
+
+	printf("Connected and closed %i connections\n", num_conns);
+
+	/* delete the peer object */
+	ret = rpma_peer_delete(&peer);
+	if (ret)
+		goto err_free;
+
+	free(targets);
+
+	return 0;
+
+err_conns_delete:
+	for (int i = 0; i < num_conns; i++) {
+		if (targets[i].conn == NULL)
+			continue;
+		(void) rpma_conn_disconnect(targets[i].conn);
+		(void) rpma_conn_delete(&targets[i].conn);
+	}
+err_peer_delete:
+	(void) rpma_peer_delete(&peer);
+err_free:
+	free(targets);
+
+	return ret;
+}
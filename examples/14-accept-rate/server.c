@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * server.c -- a server of the accept rate example
+ *
+ * The server listens with the given backlog, accepts the given number of connections
+ * obtaining the waiting connection requests in batches and prints the number
+ * of connections accepted per second.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <librpma.h>
+
+#ifdef TEST_MOCK_MAIN
+#define main server_main
+#endif
+
+#define DEFAULT_BACKLOG		128
+#define DEFAULT_NUM_CONNS	8
+#define MAX_BATCH		32
+
+/*
+ * time_diff_s -- the time elapsed between start and end in seconds
+ */
+static double
+time_diff_s(struct timespec *start, struct timespec *end)
+{
+	return (double)(end->tv_sec - start->tv_sec) +
+		(double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/*
+ * accept_batch -- accept the obtained connection requests and wait for the connections
+ * to being established
+ */
+static int
+accept_batch(struct rpma_conn_req **reqs, int num_reqs, struct rpma_conn **conns)
+{
+	enum rpma_conn_event conn_event = RPMA_CONN_UNDEFINED;
+	int ret = 0;
+
+	/* accept all the requests first so the clients can proceed in parallel */
+	for (int i = 0; i < num_reqs; i++) {
+		ret = rpma_conn_req_connect(&reqs[i], NULL, &conns[i]);
+		if (ret) {
+			/* the rest of the requests has to be deleted */
+			for (int j = i + 1; j < num_reqs; j++)
+				(void) rpma_conn_req_delete(&reqs[j]);
+			return ret;
+		}
+	}
+
+	for (int i = 0; i < num_reqs; i++) {
+		ret = rpma_conn_next_event(conns[i], &conn_event);
+		if (ret)
+			return ret;
+
+		if (conn_event != RPMA_CONN_ESTABLISHED) {
+			fprintf(stderr, "rpma_conn_next_event returned an unexpected event: %s\n",
+				rpma_utils_conn_event_2str(conn_event));
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <addr> <port> [<backlog>] [<num-conns>]\n", argv[0]);
+		return -1;
+	}
+
+	/* parameters */
+	char *addr = argv[1];
+	char *port = argv[2];
+	int backlog = (argc > 3) ? atoi(argv[3]) : DEFAULT_BACKLOG;
+	int num_conns = (argc > 4) ? atoi(argv[4]) : DEFAULT_NUM_CONNS;
+	if (backlog < 0 || num_conns < 1) {
+		fprintf(stderr, "invalid backlog or number of connections\n");
+		return -1;
+	}
+
+	/* resources */
+	struct ibv_context *ibv_ctx = NULL;
+	struct rpma_peer *peer = NULL;
+	struct rpma_ep *ep = NULL;
+	struct rpma_conn_req *reqs[MAX_BATCH];
+	struct rpma_conn **conns = NULL;
+	enum rpma_conn_event conn_event = RPMA_CONN_UNDEFINED;
+	struct timespec start, end;
+	int num_accepted = 0;
+	int num_batches = 0;
+	int ret = 0;
+
+	conns = calloc((size_t)num_conns, sizeof(*conns));
+	if (conns == NULL)
+		return -1;
+
+	/* obtain an IBV context for a local IP address */
+	ret = rpma_utils_get_ibv_context(addr, RPMA_UTIL_IBV_CONTEXT_LOCAL, &ibv_ctx);
+	if (ret)
+		goto err_free;
+
+	/* create a new peer object */
+	ret = rpma_peer_new(ibv_ctx, &peer);
+	if (ret)
+		goto err_free;
+
+	/* create a new endpoint object with the given backlog */
+	ret = rpma_ep_listen_with_backlog(peer, addr, port, backlog, &ep);
+	if (ret)
+		goto err_peer_delete;
+
+	while (num_accepted < num_conns) {
+		int max_reqs = num_conns - num_accepted;
+		if (max_reqs > MAX_BATCH)
+			max_reqs = MAX_BATCH;
+
+		/* obtain all the waiting connection requests (at least one) */
+		int num_reqs = 0;
+		ret = rpma_ep_next_conn_reqs(ep, NULL, reqs, max_reqs, &num_reqs);
+		if (ret)
+			goto err_conns_delete;
+
+		/* the time is measured from the first connection request obtained */
+		if (num_accepted == 0)
+			clock_gettime(CLOCK_MONOTONIC, &start);
+
+		ret = accept_batch(reqs, num_reqs, &conns[num_accepted]);
+		num_accepted += num_reqs;
+		num_batches++;
+		if (ret)
+			goto err_conns_delete;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double elapsed = time_diff_s(&start, &end);
+	printf("Accepted %i connections in %i batch(es) within %.6f s (%.0f connections/s)\n",
+		num_accepted, num_batches, elapsed,
+		elapsed > 0.0 ? (double)num_accepted / elapsed : 0.0);
+
+	/* disconnect all the connections */
+	for (int i = 0; i < num_conns; i++) {
+		ret = rpma_conn_disconnect(conns[i]);
+		if (ret)
+			goto err_conns_delete;
+	}
+
+	/* wait for the connections to being closed and delete them */
+	for (int i = 0; i < num_conns; i++) {
+		ret = rpma_conn_next_event(conns[i], &conn_event);
+		if (!ret && conn_event != RPMA_CONN_CLOSED) {
+			fprintf(stderr, "rpma_conn_next_event returned an unexpected event: %s\n",
+				rpma_utils_conn_event_2str(conn_event));
+			ret = -1;
+		}
+		if (ret)
+			goto err_conns_delete;
+
+		ret = rpma_conn_delete(&conns[i]);
+		if (ret)
+			goto err_conns_delete;
+	}
+
+	/* shutdown the endpoint */
+	ret = rpma_ep_shutdown(&ep);
+	if (ret)
+		goto err_peer_delete;
+
+	/* delete the peer object */
+	ret = rpma_peer_delete(&peer);
+	if (ret)
+		goto err_free;
+
+	free(conns);
+
+	return 0;
+
+err_conns_delete:
+	for (int i = 0; i < num_conns; i++) {
+		if (conns[i] == NULL)
+			continue;
+		(void) rpma_conn_disconnect(conns[i]);
+		(void) rpma_conn_delete(&conns[i]);
+	}
+	(void) rpma_ep_shutdown(&ep);
+err_peer_delete:
+	(void) rpma_peer_delete(&peer);
+err_free:
+	free(conns);
+
+	return ret;
+}
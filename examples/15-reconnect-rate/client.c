@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * client.c -- a client of the reconnect rate example
+ *
+ * The client connects to the server, disconnects and deletes the connection
+ * the given number of times and prints the number of the connect+disconnect cycles
+ * performed per second. The resources of the deleted connections are recycled
+ * if the resource pool size is not 0.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <librpma.h>
+
+#ifdef TEST_MOCK_MAIN
+#define main client_main
+#endif
+
+#define DEFAULT_NUM_CYCLES	100
+#define DEFAULT_RES_POOL_SIZE	1
+
+/*
+ * time_diff_s -- the time elapsed between start and end in seconds
+ */
+static double
+time_diff_s(struct timespec *start, struct timespec *end)
+{
+	return (double)(end->tv_sec - start->tv_sec) +
+		(double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/*
+ * expect_event -- wait for the next connection event and check if it is the expected one
+ */
+static int
+expect_event(struct rpma_conn *conn, enum rpma_conn_event expected)
+{
+	enum rpma_conn_event conn_event = RPMA_CONN_UNDEFINED;
+
+	int ret = rpma_conn_next_event(conn, &conn_event);
+	if (!ret && conn_event != expected) {
+		fprintf(stderr, "rpma_conn_next_event returned an unexpected event: %s\n",
+			rpma_utils_conn_event_2str(conn_event));
+		ret = -1;
+	}
+
+	return ret;
+}
+
+/*
+ * connect_and_close -- establish a connection, close it and delete it
+ */
+static int
+connect_and_close(struct rpma_peer *peer, const char *addr, const char *port)
+{
+	struct rpma_conn_req *req = NULL;
+	struct rpma_conn *conn = NULL;
+
+	int ret = rpma_conn_req_new(peer, addr, port, NULL, &req);
+	if (ret)
+		return ret;
+
+	ret = rpma_conn_req_connect(&req, NULL, &conn);
+	if (ret)
+		return ret;
+
+	ret = expect_event(conn, RPMA_CONN_ESTABLISHED);
+	if (ret)
+		goto err_conn_delete;
+
+	ret = rpma_conn_disconnect(conn);
+	if (ret)
+		goto err_conn_delete;
+
+	ret = expect_event(conn, RPMA_CONN_CLOSED);
+	if (ret)
+		goto err_conn_delete;
+
+	return rpma_conn_delete(&conn);
+
+err_conn_delete:
+	(void) rpma_conn_disconnect(conn);
+	(void) rpma_conn_delete(&conn);
+
+	return ret;
+}
+
+int
+main(int argc, char *argv[])
+{
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <addr> <port> [<num-cycles>] [<res-pool-size>]\n",
+			argv[0]);
+		exit(-1);
+	}
+
+	/* parameters */
+	char *addr = argv[1];
+	char *port = argv[2];
+	int num_cycles = (argc > 3) ? atoi(argv[3]) : DEFAULT_NUM_CYCLES;
+	int res_pool_size = (argc > 4) ? atoi(argv[4]) : DEFAULT_RES_POOL_SIZE;
+	if (num_cycles < 1 || res_pool_size < 0) {
+		fprintf(stderr, "invalid number of cycles or resource pool size\n");
+		exit(-1);
+	}
+
+	/* resources */
+	struct ibv_context *ibv_ctx = NULL;
+	struct rpma_peer *peer = NULL;
+	struct timespec start, end;
+	int ret = 0;
+
+	/* obtain an IBV context for a remote IP address */
+	ret = rpma_utils_get_ibv_context(addr, RPMA_UTIL_IBV_CONTEXT_REMOTE, &ibv_ctx);
+	if (ret)
+		return ret;
+
+	/* create a new peer object */
+	ret = rpma_peer_new(ibv_ctx, &peer);
+	if (ret)
+		return ret;
+
+	/* recycle the resources of the deleted connections */
+	ret = rpma_peer_set_res_pool_size(peer, res_pool_size);
+	if (ret)
+		goto err_peer_delete;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (int i = 0; i < num_cycles; i++) {
+		ret = connect_and_close(peer, addr, port);
+		if (ret) {
+			fprintf(stderr, "cycle #%i failed: %s\n", i, rpma_err_2str(ret));
+			goto err_peer_delete;
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double elapsed = time_diff_s(&start, &end);
+	printf("Performed %i connect+disconnect cycles (resource pool size: %i) within %.6f s "
+		"(%.0f cycles/s)\n", num_cycles, res_pool_size, elapsed,
+		elapsed > 0.0 ? (double)num_cycles / elapsed : 0.0);
+
+	/* delete the peer object along with the recycled resources */
+	return rpma_peer_delete(&peer);
+
+err_peer_delete:
+	(void) rpma_peer_delete(&peer);
+
+	return ret;
+}
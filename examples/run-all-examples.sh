@@ -270,6 +270,16 @@ function run_example() {
 		TIMEOUT=6s
 		start_server $VLD_SCMD $DIR/server $IP_ADDRESS $PORT 3
 		;;
+	14-accept-rate)
+		# timeout value for both the server and the client
+		TIMEOUT=6s
+		start_server $VLD_SCMD $DIR/server $IP_ADDRESS $PORT 128 8
+		;;
+	15-reconnect-rate)
+		# timeout value for both the server and the client
+		TIMEOUT=6s
+		start_server $VLD_SCMD $DIR/server $IP_ADDRESS $PORT 8 1
+		;;
 	*)
 		# timeout value for both the server and the client
 		TIMEOUT=3s
@@ -322,6 +332,12 @@ function run_example() {
 			[ $RV -eq 0 ] && RV=$TMP_RV
 		done
 		;;
+	14-accept-rate)
+		start_client $VLD_CCMD $DIR/client $IP_ADDRESS $PORT 8
+		;;
+	15-reconnect-rate)
+		start_client $VLD_CCMD $DIR/client $IP_ADDRESS $PORT 8 1
+		;;
 	*)
 		if [ "$PMEM_PATH" != "" ]; then
 			start_client $VLD_CCMD $DIR/client $IP_ADDRESS $PORT $PMEM_PATH $PMEM_CLIENT_OFFSET
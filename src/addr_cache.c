@@ -0,0 +1,414 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * addr_cache.c -- librpma cache of resolved addresses and devices implementations
+ *
+ * The cache is process-wide and keeps up to RPMA_ADDR_CACHE_SIZE entries. An entry maps
+ * (addr, port, side) either to the resolved address (struct rdma_addrinfo) or to the device
+ * (struct ibv_context) the address belongs to. Every entry expires after the TTL set using
+ * rpma_addr_cache_set_ttl(). The TTL is 0 by default which disables the cache.
+ *
+ * The resolved address is reference-counted so the info objects using it stay valid when
+ * the entry is replaced or dropped. The entries table is protected by a spinlock held only
+ * for the table lookup or update; memory is allocated and released outside of it.
+ * A spinlock is enough because the critical sections are a bounded scan of the fixed-size
+ * table which never blocks nor calls into the provider.
+ */
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "addr_cache.h"
+#include "debug.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+#define RPMA_ADDR_CACHE_SIZE 64
+
+#define NSEC_IN_MSEC ((uint64_t)1000000)
+#define NSEC_IN_SEC ((uint64_t)1000000000)
+
+struct rpma_addr_cache_ref {
+	_Atomic int refs; /* the number of holders (including the cache) */
+	struct rdma_addrinfo *rai; /* the resolved address */
+};
+
+enum rpma_addr_cache_kind {
+	RPMA_ADDR_CACHE_ADDRINFO, /* the entry keeps the resolved address */
+	RPMA_ADDR_CACHE_IBV_CONTEXT /* the entry keeps the device */
+};
+
+struct rpma_addr_cache_entry {
+	enum rpma_addr_cache_kind kind;
+	enum rpma_info_side side;
+	uint64_t expires_ns; /* CLOCK_MONOTONIC time the entry expires at */
+	union {
+		struct rpma_addr_cache_ref *ref;
+		struct ibv_context *ibv_ctx;
+	};
+	const char *port; /* points into key or NULL */
+	char key[]; /* addr ('\0') port ('\0') */
+};
+
+static atomic_flag Lock = ATOMIC_FLAG_INIT;
+static _Atomic int Ttl_ms = 0;
+static struct rpma_addr_cache_entry *Entries[RPMA_ADDR_CACHE_SIZE];
+
+/*
+ * addr_cache_lock -- acquire the entries table
+ */
+static inline void
+addr_cache_lock(void)
+{
+	while (atomic_flag_test_and_set_explicit(&Lock, memory_order_acquire))
+		;
+}
+
+/*
+ * addr_cache_unlock -- release the entries table
+ */
+static inline void
+addr_cache_unlock(void)
+{
+	atomic_flag_clear_explicit(&Lock, memory_order_release);
+}
+
+/*
+ * addr_cache_now -- get the current CLOCK_MONOTONIC time in nanoseconds
+ */
+static uint64_t
+addr_cache_now(void)
+{
+	struct timespec ts;
+	(void) clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * NSEC_IN_SEC + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * addr_cache_entry_new -- allocate an entry of the given key expiring after ttl_ms
+ */
+static struct rpma_addr_cache_entry *
+addr_cache_entry_new(enum rpma_addr_cache_kind kind, const char *addr, const char *port,
+		enum rpma_info_side side, int ttl_ms)
+{
+	size_t addr_len = strlen(addr) + 1;
+	size_t port_len = (port == NULL) ? 0 : strlen(port) + 1;
+
+	struct rpma_addr_cache_entry *entry = malloc(sizeof(*entry) + addr_len + port_len);
+	if (entry == NULL)
+		return NULL;
+
+	entry->kind = kind;
+	entry->side = side;
+	entry->expires_ns = addr_cache_now() + (uint64_t)ttl_ms * NSEC_IN_MSEC;
+	memcpy(entry->key, addr, addr_len);
+	if (port == NULL) {
+		entry->port = NULL;
+	} else {
+		memcpy(entry->key + addr_len, port, port_len);
+		entry->port = entry->key + addr_len;
+	}
+
+	return entry;
+}
+
+/*
+ * addr_cache_entry_delete -- release the entry and its resolved address if not used anymore
+ */
+static void
+addr_cache_entry_delete(struct rpma_addr_cache_entry *entry)
+{
+	if (entry->kind == RPMA_ADDR_CACHE_ADDRINFO)
+		rpma_addr_cache_release(&entry->ref);
+
+	free(entry);
+}
+
+/*
+ * addr_cache_entry_match -- check if the entry is of the given kind and key
+ */
+static bool
+addr_cache_entry_match(const struct rpma_addr_cache_entry *entry,
+		enum rpma_addr_cache_kind kind, const char *addr, const char *port,
+		enum rpma_info_side side)
+{
+	if (entry->kind != kind || entry->side != side || strcmp(entry->key, addr) != 0)
+		return false;
+
+	if (entry->port == NULL || port == NULL)
+		return (entry->port == port);
+
+	return (strcmp(entry->port, port) == 0);
+}
+
+/*
+ * addr_cache_find -- find a valid entry of the given kind and key
+ *
+ * ASSUMPTIONS
+ * - the entries table is acquired
+ */
+static struct rpma_addr_cache_entry *
+addr_cache_find(enum rpma_addr_cache_kind kind, const char *addr, const char *port,
+		enum rpma_info_side side, uint64_t now)
+{
+	for (int i = 0; i < RPMA_ADDR_CACHE_SIZE; i++) {
+		struct rpma_addr_cache_entry *entry = Entries[i];
+		if (entry && entry->expires_ns > now &&
+				addr_cache_entry_match(entry, kind, addr, port, side))
+			return entry;
+	}
+
+	return NULL;
+}
+
+/*
+ * addr_cache_store -- store the entry in the slot of the same key, the first free slot
+ * or the slot of the entry expiring first and return the entry it replaced
+ */
+static struct rpma_addr_cache_entry *
+addr_cache_store(struct rpma_addr_cache_entry *entry, const char *addr, const char *port)
+{
+	int slot = -1;
+	int free_slot = -1;
+	int oldest = 0;
+
+	addr_cache_lock();
+
+	for (int i = 0; i < RPMA_ADDR_CACHE_SIZE; i++) {
+		struct rpma_addr_cache_entry *old = Entries[i];
+		if (old == NULL) {
+			if (free_slot == -1)
+				free_slot = i;
+			continue;
+		}
+
+		if (addr_cache_entry_match(old, entry->kind, addr, port, entry->side)) {
+			slot = i;
+			break;
+		}
+
+		if (Entries[oldest] == NULL || old->expires_ns < Entries[oldest]->expires_ns)
+			oldest = i;
+	}
+
+	if (slot == -1)
+		slot = (free_slot != -1) ? free_slot : oldest;
+
+	struct rpma_addr_cache_entry *replaced = Entries[slot];
+	Entries[slot] = entry;
+
+	addr_cache_unlock();
+
+	return replaced;
+}
+
+/*
+ * addr_cache_drop -- drop the entries matching ibv_ctx (see rpma_addr_cache_invalidate())
+ */
+static void
+addr_cache_drop(const struct ibv_context *ibv_ctx)
+{
+	struct rpma_addr_cache_entry *dropped[RPMA_ADDR_CACHE_SIZE];
+	int n = 0;
+
+	addr_cache_lock();
+
+	for (int i = 0; i < RPMA_ADDR_CACHE_SIZE; i++) {
+		struct rpma_addr_cache_entry *entry = Entries[i];
+		if (entry == NULL)
+			continue;
+
+		if (ibv_ctx != NULL && entry->kind == RPMA_ADDR_CACHE_IBV_CONTEXT &&
+				entry->ibv_ctx != ibv_ctx)
+			continue;
+
+		dropped[n++] = entry;
+		Entries[i] = NULL;
+	}
+
+	addr_cache_unlock();
+
+	for (int i = 0; i < n; i++)
+		addr_cache_entry_delete(dropped[i]);
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_addr_cache_set_ttl -- set the time (in milliseconds) the cached entries stay valid
+ */
+void
+rpma_addr_cache_set_ttl(int ttl_ms)
+{
+	RPMA_DEBUG_TRACE;
+
+	atomic_store(&Ttl_ms, ttl_ms);
+	if (ttl_ms == 0)
+		addr_cache_drop(NULL);
+}
+
+/*
+ * rpma_addr_cache_lookup_addrinfo -- look up the address resolved for the given addr, port
+ * and side
+ */
+struct rdma_addrinfo *
+rpma_addr_cache_lookup_addrinfo(const char *addr, const char *port, enum rpma_info_side side,
+		struct rpma_addr_cache_ref **ref_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (atomic_load(&Ttl_ms) == 0)
+		return NULL;
+
+	uint64_t now = addr_cache_now();
+	struct rdma_addrinfo *rai = NULL;
+
+	addr_cache_lock();
+
+	struct rpma_addr_cache_entry *entry =
+		addr_cache_find(RPMA_ADDR_CACHE_ADDRINFO, addr, port, side, now);
+	if (entry) {
+		atomic_fetch_add(&entry->ref->refs, 1);
+		*ref_ptr = entry->ref;
+		rai = entry->ref->rai;
+	}
+
+	addr_cache_unlock();
+
+	return rai;
+}
+
+/*
+ * rpma_addr_cache_insert_addrinfo -- cache the address resolved for the given addr, port
+ * and side
+ */
+bool
+rpma_addr_cache_insert_addrinfo(const char *addr, const char *port, enum rpma_info_side side,
+		struct rdma_addrinfo *rai, struct rpma_addr_cache_ref **ref_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	int ttl_ms = atomic_load(&Ttl_ms);
+	if (ttl_ms == 0)
+		return false;
+
+	struct rpma_addr_cache_ref *ref = malloc(sizeof(*ref));
+	if (ref == NULL)
+		return false;
+
+	struct rpma_addr_cache_entry *entry = addr_cache_entry_new(RPMA_ADDR_CACHE_ADDRINFO,
+			addr, port, side, ttl_ms);
+	if (entry == NULL) {
+		free(ref);
+		return false;
+	}
+
+	/* one reference is held by the cache and the other one by the caller */
+	atomic_init(&ref->refs, 2);
+	ref->rai = rai;
+	entry->ref = ref;
+
+	struct rpma_addr_cache_entry *replaced = addr_cache_store(entry, addr, port);
+	if (replaced)
+		addr_cache_entry_delete(replaced);
+
+	*ref_ptr = ref;
+
+	return true;
+}
+
+/*
+ * rpma_addr_cache_release -- release the reference to the resolved address
+ */
+void
+rpma_addr_cache_release(struct rpma_addr_cache_ref **ref_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	struct rpma_addr_cache_ref *ref = *ref_ptr;
+	*ref_ptr = NULL;
+
+	if (atomic_fetch_sub(&ref->refs, 1) > 1)
+		return;
+
+	rdma_freeaddrinfo(ref->rai);
+	free(ref);
+}
+
+/*
+ * rpma_addr_cache_lookup_ibv_context -- look up the device of the given addr and side
+ */
+bool
+rpma_addr_cache_lookup_ibv_context(const char *addr, enum rpma_info_side side,
+		struct ibv_context **ibv_ctx_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (atomic_load(&Ttl_ms) == 0)
+		return false;
+
+	uint64_t now = addr_cache_now();
+
+	addr_cache_lock();
+
+	struct rpma_addr_cache_entry *entry =
+		addr_cache_find(RPMA_ADDR_CACHE_IBV_CONTEXT, addr, NULL, side, now);
+	if (entry)
+		*ibv_ctx_ptr = entry->ibv_ctx;
+
+	addr_cache_unlock();
+
+	return (entry != NULL);
+}
+
+/*
+ * rpma_addr_cache_insert_ibv_context -- cache the device of the given addr and side
+ */
+void
+rpma_addr_cache_insert_ibv_context(const char *addr, enum rpma_info_side side,
+		struct ibv_context *ibv_ctx)
+{
+	RPMA_DEBUG_TRACE;
+
+	int ttl_ms = atomic_load(&Ttl_ms);
+	if (ttl_ms == 0)
+		return;
+
+	struct rpma_addr_cache_entry *entry = addr_cache_entry_new(RPMA_ADDR_CACHE_IBV_CONTEXT,
+			addr, NULL, side, ttl_ms);
+	if (entry == NULL)
+		return;
+
+	entry->ibv_ctx = ibv_ctx;
+
+	struct rpma_addr_cache_entry *replaced = addr_cache_store(entry, addr, NULL);
+	if (replaced)
+		addr_cache_entry_delete(replaced);
+}
+
+/*
+ * rpma_addr_cache_invalidate -- drop the cached devices equal to ibv_ctx together with
+ * all the resolved addresses or all the cached entries if ibv_ctx == NULL
+ */
+void
+rpma_addr_cache_invalidate(const struct ibv_context *ibv_ctx)
+{
+	RPMA_DEBUG_TRACE;
+
+	addr_cache_drop(ibv_ctx);
+}
+
+/*
+ * rpma_addr_cache_fini -- drop all the cached entries when the library is unloaded
+ */
+void
+rpma_addr_cache_fini(void)
+{
+	addr_cache_drop(NULL);
+}
@@ -0,0 +1,118 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * addr_cache.h -- librpma cache of resolved addresses and devices internal definitions
+ */
+
+#ifndef LIBRPMA_ADDR_CACHE_H
+#define LIBRPMA_ADDR_CACHE_H
+
+#include <stdbool.h>
+#include <infiniband/verbs.h>
+#include <rdma/rdma_cma.h>
+
+#include "info.h"
+
+/* a reference to a resolved address kept in the cache */
+struct rpma_addr_cache_ref;
+
+/*
+ * rpma_addr_cache_set_ttl -- set the time (in milliseconds) the cached entries stay valid;
+ * 0 disables the cache and drops all the cached entries
+ *
+ * ASSUMPTIONS
+ * - ttl_ms >= 0
+ *
+ * ERRORS
+ * rpma_addr_cache_set_ttl() cannot fail.
+ */
+void rpma_addr_cache_set_ttl(int ttl_ms);
+
+/*
+ * rpma_addr_cache_lookup_addrinfo -- look up the address resolved for the given addr, port
+ * and side. On a hit the returned address stays valid until rpma_addr_cache_release()
+ * is called for *ref_ptr even if the entry expires in the meantime.
+ *
+ * ASSUMPTIONS
+ * - addr != NULL && ref_ptr != NULL
+ *
+ * ERRORS
+ * rpma_addr_cache_lookup_addrinfo() cannot fail. It returns NULL if no valid entry is cached.
+ */
+struct rdma_addrinfo *rpma_addr_cache_lookup_addrinfo(const char *addr, const char *port,
+		enum rpma_info_side side, struct rpma_addr_cache_ref **ref_ptr);
+
+/*
+ * rpma_addr_cache_insert_addrinfo -- cache the address resolved for the given addr, port
+ * and side. On success the cache takes over rai and the caller gets a reference to it
+ * which has to be released using rpma_addr_cache_release().
+ *
+ * ASSUMPTIONS
+ * - addr != NULL && rai != NULL && ref_ptr != NULL
+ *
+ * ERRORS
+ * rpma_addr_cache_insert_addrinfo() cannot fail. It returns false if the address
+ * was not cached (the cache is disabled or out of memory) and rai is still owned
+ * by the caller then.
+ */
+bool rpma_addr_cache_insert_addrinfo(const char *addr, const char *port,
+		enum rpma_info_side side, struct rdma_addrinfo *rai,
+		struct rpma_addr_cache_ref **ref_ptr);
+
+/*
+ * rpma_addr_cache_release -- release the reference to the resolved address
+ *
+ * ASSUMPTIONS
+ * - ref_ptr != NULL && *ref_ptr != NULL
+ *
+ * ERRORS
+ * rpma_addr_cache_release() cannot fail.
+ */
+void rpma_addr_cache_release(struct rpma_addr_cache_ref **ref_ptr);
+
+/*
+ * rpma_addr_cache_lookup_ibv_context -- look up the device of the given addr and side
+ *
+ * ASSUMPTIONS
+ * - addr != NULL && ibv_ctx_ptr != NULL
+ *
+ * ERRORS
+ * rpma_addr_cache_lookup_ibv_context() cannot fail. It returns false if no valid entry
+ * is cached.
+ */
+bool rpma_addr_cache_lookup_ibv_context(const char *addr, enum rpma_info_side side,
+		struct ibv_context **ibv_ctx_ptr);
+
+/*
+ * rpma_addr_cache_insert_ibv_context -- cache the device of the given addr and side
+ *
+ * ASSUMPTIONS
+ * - addr != NULL && ibv_ctx != NULL
+ *
+ * ERRORS
+ * rpma_addr_cache_insert_ibv_context() cannot fail. Nothing is cached if the cache
+ * is disabled or out of memory.
+ */
+void rpma_addr_cache_insert_ibv_context(const char *addr, enum rpma_info_side side,
+		struct ibv_context *ibv_ctx);
+
+/*
+ * rpma_addr_cache_invalidate -- drop the cached devices equal to ibv_ctx together with
+ * all the resolved addresses (they may lead to the removed device) or all the cached entries
+ * if ibv_ctx == NULL
+ *
+ * ERRORS
+ * rpma_addr_cache_invalidate() cannot fail.
+ */
+void rpma_addr_cache_invalidate(const struct ibv_context *ibv_ctx);
+
+/*
+ * rpma_addr_cache_fini -- drop all the cached entries when the library is unloaded
+ *
+ * ERRORS
+ * rpma_addr_cache_fini() cannot fail.
+ */
+void rpma_addr_cache_fini(void);
+
+#endif /* LIBRPMA_ADDR_CACHE_H */
@@ -6,24 +6,33 @@
  * conn.c -- librpma connection-related implementations
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <stdlib.h>
 
+#include "addr_cache.h"
 #include "common.h"
 #include "conn.h"
+#include "conn_evch.h"
+#include "conn_table.h"
 #include "debug.h"
 #include "flush.h"
+#include "instr.h"
 #include "log_internal.h"
 #include "mr.h"
+#include "peer.h"
 #include "private_data.h"
+#include "usdt.h"
 
 #ifdef TEST_MOCK_ALLOC
 #include "cmocka_alloc.h"
 #endif
 
 struct rpma_conn {
+	struct rpma_peer *peer; /* the peer the connection resources come from */
 	struct rdma_cm_id *id; /* a CM ID of the connection */
 	struct rdma_event_channel *evch; /* event channel of the CM ID */
+	bool shared_evch; /* the event channel is shared with other connections */
 	struct rpma_cq *cq; /* main CQ */
 	struct rpma_cq *rcq; /* receive CQ */
 	struct ibv_comp_channel *channel; /* shared completion channel */
@@ -32,20 +41,119 @@ struct rpma_conn {
 	struct rpma_flush *flush; /* flushing object */
 
 	bool direct_write_to_pmem; /* direct write to pmem is supported */
+
+	void *context; /* the user context of the connection */
+
+	struct rpma_instr instr; /* the statistics, the latency measuring and the tracing */
+};
+
+/* how an operation is accounted in the instrumentation of the connection */
+struct conn_instr_op {
+	enum rpma_latency_op latency; /* RPMA_LATENCY_OP_NUM - the latency is not measured */
+	enum rpma_stats_counter ops;
+	enum rpma_stats_counter bytes; /* RPMA_STATS_NUM - the bytes are not counted */
+	enum rpma_stats_counter full;
+};
+
+static const struct conn_instr_op Conn_instr_ops[] = {
+	[RPMA_TRACE_READ] = {RPMA_LATENCY_READ, RPMA_STATS_READS, RPMA_STATS_READ_BYTES,
+		RPMA_STATS_SQ_FULL},
+	[RPMA_TRACE_WRITE] = {RPMA_LATENCY_WRITE, RPMA_STATS_WRITES, RPMA_STATS_WRITE_BYTES,
+		RPMA_STATS_SQ_FULL},
+	[RPMA_TRACE_ATOMIC_WRITE] = {RPMA_LATENCY_ATOMIC_WRITE, RPMA_STATS_ATOMIC_WRITES,
+		RPMA_STATS_NUM, RPMA_STATS_SQ_FULL},
+	[RPMA_TRACE_FLUSH] = {RPMA_LATENCY_FLUSH, RPMA_STATS_FLUSHES, RPMA_STATS_NUM,
+		RPMA_STATS_SQ_FULL},
+	[RPMA_TRACE_SEND] = {RPMA_LATENCY_SEND, RPMA_STATS_SENDS, RPMA_STATS_SEND_BYTES,
+		RPMA_STATS_SQ_FULL},
+	[RPMA_TRACE_RECV] = {RPMA_LATENCY_OP_NUM, RPMA_STATS_RECVS, RPMA_STATS_RECV_BYTES,
+		RPMA_STATS_RQ_FULL},
+};
+
+/* the instrumentation of an operation being posted */
+struct conn_instr_post {
+	struct rpma_latency_entry *measured; /* NULL - the latency is not measured */
+	uint64_t trace_ns; /* 0 - the operation is not traced */
 };
 
+/*
+ * conn_instr_post_begin -- start measuring and tracing the operation being posted
+ */
+static void
+conn_instr_post_begin(struct rpma_conn *conn, struct conn_instr_post *post,
+		enum rpma_trace_op op, int flags, const void *op_context)
+{
+	enum rpma_latency_op latency = Conn_instr_ops[op].latency;
+
+	post->measured = (latency == RPMA_LATENCY_OP_NUM) ? NULL :
+		rpma_latency_post_begin(&conn->instr.latency, flags, latency, op_context);
+	post->trace_ns = rpma_trace_post_begin();
+}
+
+/*
+ * conn_instr_post_end -- count, measure and trace the operation posted (or not)
+ * on the connection
+ */
+static void
+conn_instr_post_end(struct rpma_conn *conn, const struct conn_instr_post *post,
+		enum rpma_trace_op op, int flags, const void *op_context, size_t len, int ret)
+{
+	const struct conn_instr_op *iop = &Conn_instr_ops[op];
+	struct rpma_stats *stats = &conn->instr.stats;
+
+	/* rpma_mr_*() leave the error of ibv_post_*() in errno */
+	int post_errno = errno;
+
+	if (post->trace_ns)
+		rpma_trace_post_end(&conn->instr.trace, conn->id->qp, op, op_context, len, flags,
+				ret, post->trace_ns);
+	if (post->measured)
+		rpma_latency_post_end(post->measured, ret);
+
+	if (ret == 0) {
+		RPMA_STATS_ADD(stats, iop->ops, 1);
+		if (iop->bytes != RPMA_STATS_NUM)
+			RPMA_STATS_ADD(stats, iop->bytes, len);
+	} else if (ret == RPMA_E_PROVIDER) {
+		RPMA_STATS_ADD(stats, RPMA_STATS_POST_ERRORS, 1);
+		if (post_errno == ENOMEM)
+			RPMA_STATS_ADD(stats, iop->full, 1);
+	}
+}
+
+/*
+ * conn_send -- initiate the send operation
+ */
+static int
+conn_send(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset, size_t len,
+		int flags, enum ibv_wr_opcode operation, uint32_t imm, bool fence,
+		const void *op_context)
+{
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_SEND, flags, op_context);
+	int ret = rpma_mr_send(conn->id->qp,
+			src, offset, len,
+			flags, operation,
+			imm, fence, op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_SEND, flags, op_context, len, ret);
+
+	return ret;
+}
+
 /* internal librpma API */
 
 /*
- * rpma_conn_new -- migrate an obtained CM ID into newly created event channel.
- * If succeeded wrap provided entities into a newly created connection object.
+ * rpma_conn_new -- migrate an obtained CM ID into the shared event channel if it is provided
+ * or into a newly created one otherwise. If succeeded wrap provided entities into a newly
+ * created connection object.
  *
  * Note: rdma_migrate_id(3) will block if the previous event channel of the CM
  * ID has any outstanding (unacknowledged) events.
  */
 int
 rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq *cq,
-		struct rpma_cq *rcq, struct ibv_comp_channel *channel, struct rpma_conn **conn_ptr)
+		struct rpma_cq *rcq, struct ibv_comp_channel *channel,
+		struct rpma_conn_evch *conn_evch, struct rpma_conn **conn_ptr)
 {
 	RPMA_DEBUG_TRACE;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
@@ -55,12 +163,29 @@ rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq *cq,
 
 	int ret = 0;
 
-	struct rdma_event_channel *evch = rdma_create_event_channel();
-	if (!evch) {
-		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_create_event_channel()");
-		return RPMA_E_PROVIDER;
+	/*
+	 * The connection object has to exist before the CM ID is migrated so the events
+	 * obtained from the shared event channel can always be matched with the connection.
+	 */
+	struct rpma_conn *conn = malloc(sizeof(*conn));
+	if (!conn)
+		return RPMA_E_NOMEM;
+
+	struct rdma_event_channel *evch;
+	if (conn_evch) {
+		evch = rpma_conn_evch_get_cm_evch(conn_evch);
+	} else {
+		evch = rdma_create_event_channel();
+		if (!evch) {
+			RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_create_event_channel()");
+			ret = RPMA_E_PROVIDER;
+			goto err_free_conn;
+		}
 	}
 
+	/* the connection can be found by its CM ID from now on */
+	id->context = conn;
+
 	RPMA_FAULT_INJECTION_GOTO(RPMA_E_PROVIDER, err_destroy_evch);
 	if (rdma_migrate_id(id, evch)) {
 		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_migrate_id()");
@@ -69,18 +194,17 @@ rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq *cq,
 	}
 
 	struct rpma_flush *flush;
-	ret = rpma_flush_new(peer, id->qp, &flush);
-	if (ret)
-		goto err_migrate_id_NULL;
-
-	struct rpma_conn *conn = malloc(sizeof(*conn));
-	if (!conn) {
-		ret = RPMA_E_NOMEM;
-		goto err_flush_delete;
+	struct rpma_res_pool *pool = rpma_peer_get_res_pool(peer);
+	if (pool == NULL || !rpma_res_pool_take_flush(pool, &flush)) {
+		ret = rpma_flush_new(peer, id->qp, &flush);
+		if (ret)
+			goto err_migrate_id_NULL;
 	}
 
+	conn->peer = peer;
 	conn->id = id;
 	conn->evch = evch;
+	conn->shared_evch = (conn_evch != NULL);
 	conn->cq = cq;
 	conn->rcq = rcq;
 	conn->channel = channel;
@@ -88,19 +212,105 @@ rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq *cq,
 	conn->data.len = 0;
 	conn->flush = flush;
 	conn->direct_write_to_pmem = false;
+	conn->context = NULL;
+	rpma_instr_init(&conn->instr, id->qp);
+
+	/* the connection can be found by its QP number from now on */
+	ret = rpma_conn_table_insert(id, conn);
+	if (ret)
+		goto err_flush_delete;
+
+	rpma_cq_set_instr(cq, &conn->instr);
+	if (rcq)
+		rpma_cq_set_instr(rcq, &conn->instr);
+	rpma_peer_attach_stats(peer, &conn->instr.stats);
 
 	*conn_ptr = conn;
 
 	return 0;
 
 err_flush_delete:
+	rpma_instr_fini(&conn->instr);
 	(void) rpma_flush_delete(&flush);
 
 err_migrate_id_NULL:
 	(void) rdma_migrate_id(id, NULL);
 
 err_destroy_evch:
-	rdma_destroy_event_channel(evch);
+	id->context = NULL;
+	if (!conn_evch)
+		rdma_destroy_event_channel(evch);
+
+err_free_conn:
+	free(conn);
+
+	return ret;
+}
+
+/*
+ * rpma_conn_handle_cm_event -- convert the CM event obtained for the connection into
+ * the connection event and acknowledge it
+ */
+int
+rpma_conn_handle_cm_event(struct rpma_conn *conn, struct rdma_cm_event *edata,
+		enum rpma_conn_event *event)
+{
+	RPMA_DEBUG_TRACE;
+
+	int ret;
+
+	if (edata->event == RDMA_CM_EVENT_ESTABLISHED && conn->data.ptr == NULL) {
+		ret = rpma_private_data_store(edata, &conn->data);
+		if (ret) {
+			(void) rdma_ack_cm_event(edata);
+			return ret;
+		}
+	}
+
+	enum rdma_cm_event_type cm_event = edata->event;
+	if (rdma_ack_cm_event(edata)) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_ack_cm_event()");
+		ret = RPMA_E_PROVIDER;
+		goto err_private_data_discard;
+	}
+	RPMA_FAULT_INJECTION_GOTO(RPMA_E_UNKNOWN, err_private_data_discard);
+
+	switch (cm_event) {
+		case RDMA_CM_EVENT_ESTABLISHED:
+			*event = RPMA_CONN_ESTABLISHED;
+			break;
+		case RDMA_CM_EVENT_CONNECT_ERROR:
+			*event = RPMA_CONN_LOST;
+			break;
+		case RDMA_CM_EVENT_DEVICE_REMOVAL:
+			/* the cached addresses may lead to the removed device */
+			rpma_addr_cache_invalidate(conn->id->verbs);
+			*event = RPMA_CONN_LOST;
+			break;
+		case RDMA_CM_EVENT_DISCONNECTED:
+		case RDMA_CM_EVENT_TIMEWAIT_EXIT:
+			*event = RPMA_CONN_CLOSED;
+			break;
+		case RDMA_CM_EVENT_REJECTED:
+			*event = RPMA_CONN_REJECTED;
+			break;
+		case RDMA_CM_EVENT_UNREACHABLE:
+			*event = RPMA_CONN_UNREACHABLE;
+			break;
+		default:
+			RPMA_LOG_WARNING("%s: %s",
+					rpma_utils_conn_event_2str(*event),
+					rdma_event_str(cm_event));
+			return RPMA_E_UNKNOWN;
+	}
+
+	RPMA_LOG_NOTICE("%s", rpma_utils_conn_event_2str(*event));
+	rpma_trace_conn_event(&conn->instr.trace, conn->id->qp, *event);
+
+	return 0;
+
+err_private_data_discard:
+	rpma_private_data_delete(&conn->data);
 
 	return ret;
 }
@@ -120,6 +330,43 @@ rpma_conn_transfer_private_data(struct rpma_conn *conn, struct rpma_conn_private
 	pdata->len = 0;
 }
 
+/*
+ * rpma_conn_send_with_imm_internal -- initiate the send operation with immediate data,
+ * optionally fenced
+ */
+int
+rpma_conn_send_with_imm_internal(struct rpma_conn *conn, const struct rpma_mr_local *src,
+		size_t offset, size_t len, int flags, uint32_t imm, bool fence,
+		const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+
+	return conn_send(conn, src, offset, len, flags, IBV_WR_SEND_WITH_IMM, imm, fence,
+			op_context);
+}
+
+/*
+ * rpma_conn_get_rq_size -- get the maximum number of receives outstanding on the connection
+ */
+int
+rpma_conn_get_rq_size(const struct rpma_conn *conn, uint32_t *rq_size)
+{
+	RPMA_DEBUG_TRACE;
+
+	struct ibv_qp_attr attr;
+	struct ibv_qp_init_attr init_attr;
+
+	int ret = ibv_query_qp(conn->id->qp, &attr, IBV_QP_CAP, &init_attr);
+	if (ret) {
+		RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_query_qp()");
+		return RPMA_E_PROVIDER;
+	}
+
+	*rq_size = attr.cap.max_recv_wr;
+
+	return 0;
+}
+
 /* public librpma API */
 
 /*
@@ -153,11 +400,13 @@ rpma_conn_next_event(struct rpma_conn *conn, enum rpma_conn_event *event)
 		errno = ENODATA;
 	});
 
-	int ret;
-
 	if (conn == NULL || event == NULL)
 		return RPMA_E_INVAL;
 
+	/* the events of the shared event channel are obtained via rpma_conn_evch_next_event() */
+	if (conn->shared_evch)
+		return RPMA_E_INVAL;
+
 	struct rdma_cm_event *edata = NULL;
 	if (rdma_get_cm_event(conn->evch, &edata)) {
 		if (errno == ENODATA)
@@ -167,53 +416,8 @@ rpma_conn_next_event(struct rpma_conn *conn, enum rpma_conn_event *event)
 		return RPMA_E_PROVIDER;
 	}
 
-	if (edata->event == RDMA_CM_EVENT_ESTABLISHED && conn->data.ptr == NULL) {
-		ret = rpma_private_data_store(edata, &conn->data);
-		if (ret) {
-			(void) rdma_ack_cm_event(edata);
-			return ret;
-		}
-	}
-
-	enum rdma_cm_event_type cm_event = edata->event;
-	if (rdma_ack_cm_event(edata)) {
-		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_ack_cm_event()");
-		ret = RPMA_E_PROVIDER;
-		goto err_private_data_discard;
-	}
-	RPMA_FAULT_INJECTION_GOTO(RPMA_E_UNKNOWN, err_private_data_discard);
-
-	switch (cm_event) {
-		case RDMA_CM_EVENT_ESTABLISHED:
-			*event = RPMA_CONN_ESTABLISHED;
-			break;
-		case RDMA_CM_EVENT_CONNECT_ERROR:
-		case RDMA_CM_EVENT_DEVICE_REMOVAL:
-			*event = RPMA_CONN_LOST;
-			break;
-		case RDMA_CM_EVENT_DISCONNECTED:
-		case RDMA_CM_EVENT_TIMEWAIT_EXIT:
-			*event = RPMA_CONN_CLOSED;
-			break;
-		case RDMA_CM_EVENT_REJECTED:
-			*event = RPMA_CONN_REJECTED;
-			break;
-		case RDMA_CM_EVENT_UNREACHABLE:
-			*event = RPMA_CONN_UNREACHABLE;
-			break;
-		default:
-			RPMA_LOG_WARNING("%s: %s",
-					rpma_utils_conn_event_2str(*event),
-					rdma_event_str(cm_event));
-			return RPMA_E_UNKNOWN;
-	}
-
-	RPMA_LOG_NOTICE("%s", rpma_utils_conn_event_2str(*event));
-
-	return 0;
-
-err_private_data_discard:
-	rpma_private_data_delete(&conn->data);
+	int ret = rpma_conn_handle_cm_event(conn, edata, event);
+	RPMA_USDT3(conn_event, conn->id->qp->qp_num, ret ? RPMA_CONN_UNDEFINED : *event, ret);
 
 	return ret;
 }
@@ -357,12 +561,30 @@ rpma_conn_delete(struct rpma_conn **conn_ptr)
 
 	int ret = 0;
 
-	ret = rpma_flush_delete(&conn->flush);
-	if (ret)
-		goto err_destroy_qp;
+	rpma_conn_table_remove(conn->id, conn);
+
+	rpma_peer_detach_stats(conn->peer, &conn->instr.stats);
+	rpma_cq_set_instr(conn->cq, NULL);
+	if (conn->rcq)
+		rpma_cq_set_instr(conn->rcq, NULL);
+	rpma_instr_fini(&conn->instr);
+
+	struct rpma_res_pool *pool = rpma_peer_get_res_pool(conn->peer);
+	if (pool == NULL || !rpma_res_pool_put_flush(pool, conn->flush)) {
+		ret = rpma_flush_delete(&conn->flush);
+		if (ret)
+			goto err_destroy_qp;
+	}
 
 	rdma_destroy_qp(conn->id);
 
+	/* the CQs can be recycled only after the QP using them is gone */
+	if (pool && rpma_res_pool_put_cqs(pool, conn->cq, conn->rcq, conn->channel)) {
+		conn->cq = NULL;
+		conn->rcq = NULL;
+		conn->channel = NULL;
+	}
+
 	ret = rpma_cq_delete(&conn->rcq);
 	if (ret)
 		goto err_rpma_cq_delete;
@@ -388,7 +610,8 @@ rpma_conn_delete(struct rpma_conn **conn_ptr)
 		RPMA_FAULT_INJECTION_GOTO(RPMA_E_PROVIDER, err_destroy_event_channel);
 	}
 
-	rdma_destroy_event_channel(conn->evch);
+	if (!conn->shared_evch)
+		rdma_destroy_event_channel(conn->evch);
 	rpma_private_data_delete(&conn->data);
 
 	free(conn);
@@ -407,7 +630,8 @@ err_destroy_comp_channel:
 	if (conn->channel)
 		(void) ibv_destroy_comp_channel(conn->channel);
 err_destroy_event_channel:
-	rdma_destroy_event_channel(conn->evch);
+	if (!conn->shared_evch)
+		rdma_destroy_event_channel(conn->evch);
 	rpma_private_data_delete(&conn->data);
 
 	free(conn);
@@ -434,10 +658,15 @@ rpma_read(struct rpma_conn *conn,
 	    len != 0)))
 		return RPMA_E_INVAL;
 
-	return rpma_mr_read(conn->id->qp,
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_READ, flags, op_context);
+	int ret = rpma_mr_read(conn->id->qp,
 			dst, dst_offset,
 			src, src_offset,
 			len, flags, op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_READ, flags, op_context, len, ret);
+
+	return ret;
 }
 
 /*
@@ -458,12 +687,17 @@ rpma_write(struct rpma_conn *conn,
 	    len != 0)))
 		return RPMA_E_INVAL;
 
-	return rpma_mr_write(conn->id->qp,
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_WRITE, flags, op_context);
+	int ret = rpma_mr_write(conn->id->qp,
 			dst, dst_offset,
 			src, src_offset,
 			len, flags,
 			IBV_WR_RDMA_WRITE, 0,
 			op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_WRITE, flags, op_context, len, ret);
+
+	return ret;
 }
 
 /*
@@ -484,12 +718,17 @@ rpma_write_with_imm(struct rpma_conn *conn,
 	    len != 0)))
 		return RPMA_E_INVAL;
 
-	return rpma_mr_write(conn->id->qp,
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_WRITE, flags, op_context);
+	int ret = rpma_mr_write(conn->id->qp,
 			dst, dst_offset,
 			src, src_offset,
 			len, flags,
 			IBV_WR_RDMA_WRITE_WITH_IMM, imm,
 			op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_WRITE, flags, op_context, len, ret);
+
+	return ret;
 }
 
 /*
@@ -510,9 +749,14 @@ rpma_atomic_write(struct rpma_conn *conn,
 	if (dst_offset % RPMA_ATOMIC_WRITE_ALIGNMENT != 0)
 		return RPMA_E_INVAL;
 
-	return rpma_mr_atomic_write(conn->id->qp,
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_ATOMIC_WRITE, flags, op_context);
+	int ret = rpma_mr_atomic_write(conn->id->qp,
 			dst, dst_offset, src,
 			flags, op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_ATOMIC_WRITE, flags, op_context, 8, ret);
+
+	return ret;
 }
 
 /*
@@ -560,8 +804,13 @@ rpma_flush(struct rpma_conn *conn,
 	}
 
 	rpma_flush_func flush = conn->flush->func;
-	return flush(conn->id->qp, conn->flush, dst, dst_offset,
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_FLUSH, flags, op_context);
+	int ret = flush(conn->id->qp, conn->flush, dst, dst_offset,
 			len, type, flags, op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_FLUSH, flags, op_context, len, ret);
+
+	return ret;
 }
 
 /*
@@ -579,10 +828,7 @@ rpma_send(struct rpma_conn *conn,
 	    (src == NULL && (offset != 0 || len != 0)))
 		return RPMA_E_INVAL;
 
-	return rpma_mr_send(conn->id->qp,
-			src, offset, len,
-			flags, IBV_WR_SEND,
-			0, op_context);
+	return conn_send(conn, src, offset, len, flags, IBV_WR_SEND, 0, false, op_context);
 }
 
 /*
@@ -600,10 +846,8 @@ rpma_send_with_imm(struct rpma_conn *conn,
 	    (src == NULL && (offset != 0 || len != 0)))
 		return RPMA_E_INVAL;
 
-	return rpma_mr_send(conn->id->qp,
-			src, offset, len,
-			flags, IBV_WR_SEND_WITH_IMM,
-			imm, op_context);
+	return conn_send(conn, src, offset, len, flags, IBV_WR_SEND_WITH_IMM, imm, false,
+			op_context);
 }
 
 /*
@@ -620,9 +864,14 @@ rpma_recv(struct rpma_conn *conn,
 	if (conn == NULL || (dst == NULL && (offset != 0 || len != 0)))
 		return RPMA_E_INVAL;
 
-	return rpma_mr_recv(conn->id->qp,
+	struct conn_instr_post post;
+	conn_instr_post_begin(conn, &post, RPMA_TRACE_RECV, 0, op_context);
+	int ret = rpma_mr_recv(conn->id->qp,
 			dst, offset, len,
 			op_context);
+	conn_instr_post_end(conn, &post, RPMA_TRACE_RECV, 0, op_context, len, ret);
+
+	return ret;
 }
 
 /*
@@ -642,6 +891,57 @@ rpma_conn_get_qp_num(const struct rpma_conn *conn, uint32_t *qp_num)
 	return 0;
 }
 
+/*
+ * rpma_conn_get_stats -- get the operation statistics of the connection
+ */
+int
+rpma_conn_get_stats(const struct rpma_conn *conn, struct rpma_conn_stats *stats)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (conn == NULL || stats == NULL)
+		return RPMA_E_INVAL;
+
+	rpma_stats_get(&conn->instr.stats, stats);
+
+	return 0;
+}
+
+/*
+ * rpma_conn_set_context -- set the user context of the connection
+ */
+int
+rpma_conn_set_context(struct rpma_conn *conn, void *context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (conn == NULL)
+		return RPMA_E_INVAL;
+
+	conn->context = context;
+
+	return 0;
+}
+
+/*
+ * rpma_conn_get_context -- get the user context of the connection
+ */
+int
+rpma_conn_get_context(const struct rpma_conn *conn, void **context_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (conn == NULL || context_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	*context_ptr = conn->context;
+
+	return 0;
+}
+
 /*
  * rpma_conn_get_cq -- get the connection's main CQ
  */
@@ -15,6 +15,9 @@
 #include <rdma/rdma_cma.h>
 
 /*
+ * rpma_conn_new -- create a new connection object. The CM ID is migrated into the shared
+ * CM event channel (conn_evch) if it is provided or into a newly created one otherwise.
+ *
  * ERRORS
  * rpma_conn_new() can fail with the following errors:
  *
@@ -24,7 +27,24 @@
  */
 int rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq *cq,
 		struct rpma_cq *rcq, struct ibv_comp_channel *channel,
-		struct rpma_conn **conn_ptr);
+		struct rpma_conn_evch *conn_evch, struct rpma_conn **conn_ptr);
+
+/*
+ * rpma_conn_handle_cm_event -- convert the CM event obtained for the connection into
+ * the connection event and acknowledge it
+ *
+ * ASSUMPTIONS
+ * - conn != NULL && edata != NULL && event != NULL
+ *
+ * ERRORS
+ * rpma_conn_handle_cm_event() can fail with the following errors:
+ *
+ * - RPMA_E_UNKNOWN - unexpected event
+ * - RPMA_E_PROVIDER - rdma_ack_cm_event() failed
+ * - RPMA_E_NOMEM - out of memory
+ */
+int rpma_conn_handle_cm_event(struct rpma_conn *conn, struct rdma_cm_event *edata,
+		enum rpma_conn_event *event);
 
 /*
  * rpma_conn_transfer_private_data -- transfer the private data to the connection (a take over).
@@ -34,4 +54,35 @@ int rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq
  */
 void rpma_conn_transfer_private_data(struct rpma_conn *conn, struct rpma_conn_private_data *pdata);
 
+/*
+ * rpma_conn_send_with_imm_internal -- initiate the send operation with immediate data like
+ * rpma_send_with_imm(3) does. If fence is true the send is executed only after all preceding
+ * RDMA reads of the connection are completed.
+ *
+ * ASSUMPTIONS
+ * - conn != NULL && flags != 0 && (src != NULL || (offset == 0 && len == 0))
+ *
+ * ERRORS
+ * rpma_conn_send_with_imm_internal() can fail with the following error:
+ *
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ */
+int rpma_conn_send_with_imm_internal(struct rpma_conn *conn, const struct rpma_mr_local *src,
+		size_t offset, size_t len, int flags, uint32_t imm, bool fence,
+		const void *op_context);
+
+/*
+ * rpma_conn_get_rq_size -- get the maximum number of receives which can be outstanding
+ * on the connection at the same time
+ *
+ * ASSUMPTIONS
+ * - conn != NULL && rq_size != NULL
+ *
+ * ERRORS
+ * rpma_conn_get_rq_size() can fail with the following error:
+ *
+ * - RPMA_E_PROVIDER - ibv_query_qp(3) failed
+ */
+int rpma_conn_get_rq_size(const struct rpma_conn *conn, uint32_t *rq_size);
+
 #endif /* LIBRPMA_CONN_H */
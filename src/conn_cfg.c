@@ -49,6 +49,7 @@ struct rpma_conn_cfg {
 	_Atomic uint32_t rq_size;	/* RQ size */
 	_Atomic bool shared_comp_channel; /* completion channel shared by CQ and RCQ */
 	_Atomic uintptr_t srq;		/* shared RQ object of (struct rpma_srq *) type */
+	_Atomic uintptr_t evch;		/* shared CM event channel (struct rpma_conn_evch *) */
 #else
 	int timeout_ms;		/* connection establishment timeout */
 	uint32_t cq_size;	/* main CQ size */
@@ -57,6 +58,7 @@ struct rpma_conn_cfg {
 	uint32_t rq_size;	/* RQ size */
 	bool shared_comp_channel; /* completion channel shared by CQ and RCQ */
 	uintptr_t srq;		/* shared RQ object of (struct rpma_srq *) type */
+	uintptr_t evch;		/* shared CM event channel (struct rpma_conn_evch *) */
 #endif /* ATOMIC_OPERATIONS_SUPPORTED */
 };
 
@@ -67,7 +69,8 @@ static struct rpma_conn_cfg Conn_cfg_default  = {
 	.sq_size = RPMA_DEFAULT_Q_SIZE,
 	.rq_size = RPMA_DEFAULT_Q_SIZE,
 	.shared_comp_channel = RPMA_DEFAULT_SHARED_COMPL_CHANNEL,
-	.srq = 0
+	.srq = 0,
+	.evch = 0
 };
 
 /* internal librpma API */
@@ -146,6 +149,8 @@ rpma_conn_cfg_new(struct rpma_conn_cfg **cfg_ptr)
 		atomic_load_explicit(&Conn_cfg_default.shared_comp_channel, __ATOMIC_SEQ_CST));
 	atomic_init(&(*cfg_ptr)->srq,
 		atomic_load_explicit(&Conn_cfg_default.srq, __ATOMIC_SEQ_CST));
+	atomic_init(&(*cfg_ptr)->evch,
+		atomic_load_explicit(&Conn_cfg_default.evch, __ATOMIC_SEQ_CST));
 #else
 	memcpy(*cfg_ptr, &Conn_cfg_default, sizeof(struct rpma_conn_cfg));
 #endif /* ATOMIC_OPERATIONS_SUPPORTED */
@@ -488,3 +493,47 @@ rpma_conn_cfg_get_srq(const struct rpma_conn_cfg *cfg, struct rpma_srq **srq_ptr
 	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
 	return 0;
 }
+
+/*
+ * rpma_conn_cfg_set_evch -- set a shared CM event channel for the connection
+ */
+int
+rpma_conn_cfg_set_evch(struct rpma_conn_cfg *cfg, struct rpma_conn_evch *evch)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (cfg == NULL || evch == NULL)
+		return RPMA_E_INVAL;
+
+#ifdef ATOMIC_OPERATIONS_SUPPORTED
+	atomic_store_explicit(&cfg->evch, (uintptr_t)evch, __ATOMIC_SEQ_CST);
+#else
+	cfg->evch = (uintptr_t)evch;
+#endif /* ATOMIC_OPERATIONS_SUPPORTED */
+
+	return 0;
+}
+
+/*
+ * rpma_conn_cfg_get_evch -- get the shared CM event channel from the connection
+ * configuration
+ */
+int
+rpma_conn_cfg_get_evch(const struct rpma_conn_cfg *cfg, struct rpma_conn_evch **evch_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (cfg == NULL || evch_ptr == NULL)
+		return RPMA_E_INVAL;
+
+#ifdef ATOMIC_OPERATIONS_SUPPORTED
+	*evch_ptr = (struct rpma_conn_evch *)atomic_load_explicit(
+			(_Atomic uintptr_t *)&cfg->evch, __ATOMIC_SEQ_CST);
+#else
+	*evch_ptr = (struct rpma_conn_evch *)cfg->evch;
+#endif
+
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+	return 0;
+}
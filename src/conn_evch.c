@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch.c -- librpma shared-CM-event-channel-related implementations
+ */
+
+#include <stdlib.h>
+
+#include "conn.h"
+#include "conn_evch.h"
+#include "debug.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+struct rpma_conn_evch {
+	struct rdma_event_channel *evch; /* CM event channel shared by the connections */
+};
+
+/* internal librpma API */
+
+/*
+ * rpma_conn_evch_get_cm_evch -- get the CM event channel from the rpma_conn_evch object
+ *
+ * ASSUMPTIONS
+ * - evch != NULL
+ */
+struct rdma_event_channel *
+rpma_conn_evch_get_cm_evch(const struct rpma_conn_evch *evch)
+{
+	return evch->evch;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_conn_evch_new -- create a new CM event channel to be shared by many connections
+ */
+int
+rpma_conn_evch_new(struct rpma_conn_evch **evch_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	if (evch_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_conn_evch *evch = malloc(sizeof(*evch));
+	if (evch == NULL)
+		return RPMA_E_NOMEM;
+
+	evch->evch = rdma_create_event_channel();
+	if (evch->evch == NULL) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_create_event_channel()");
+		free(evch);
+		return RPMA_E_PROVIDER;
+	}
+
+	*evch_ptr = evch;
+
+	return 0;
+}
+
+/*
+ * rpma_conn_evch_delete -- delete the shared CM event channel
+ */
+int
+rpma_conn_evch_delete(struct rpma_conn_evch **evch_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (evch_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_conn_evch *evch = *evch_ptr;
+	if (evch == NULL)
+		return 0;
+
+	rdma_destroy_event_channel(evch->evch);
+	free(evch);
+	*evch_ptr = NULL;
+
+	return 0;
+}
+
+/*
+ * rpma_conn_evch_get_fd -- get a file descriptor of the shared CM event channel
+ */
+int
+rpma_conn_evch_get_fd(const struct rpma_conn_evch *evch, int *fd)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (evch == NULL || fd == NULL)
+		return RPMA_E_INVAL;
+
+	*fd = evch->evch->fd;
+
+	return 0;
+}
+
+/*
+ * rpma_conn_evch_next_event -- obtain the next event from the shared CM event channel
+ * and the connection it concerns
+ */
+int
+rpma_conn_evch_next_event(struct rpma_conn_evch *evch, struct rpma_conn **conn_ptr,
+		enum rpma_conn_event *event)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	RPMA_FAULT_INJECTION(RPMA_E_NO_EVENT,
+	{
+		errno = ENODATA;
+	});
+
+	if (evch == NULL || conn_ptr == NULL || event == NULL)
+		return RPMA_E_INVAL;
+
+	struct rdma_cm_event *edata = NULL;
+	if (rdma_get_cm_event(evch->evch, &edata)) {
+		if (errno == ENODATA)
+			return RPMA_E_NO_EVENT;
+
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_get_cm_event()");
+		return RPMA_E_PROVIDER;
+	}
+
+	/* the connection is stored in the CM ID's context by rpma_conn_new() */
+	struct rpma_conn *conn = edata->id->context;
+	if (conn == NULL) {
+		RPMA_LOG_ERROR("%s: the event does not belong to any connection",
+				rdma_event_str(edata->event));
+		(void) rdma_ack_cm_event(edata);
+		return RPMA_E_UNKNOWN;
+	}
+
+	*conn_ptr = conn;
+
+	return rpma_conn_handle_cm_event(conn, edata, event);
+}
@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch.h -- librpma shared-CM-event-channel-related internal definitions
+ */
+
+#ifndef LIBRPMA_CONN_EVCH_H
+#define LIBRPMA_CONN_EVCH_H
+
+#include <rdma/rdma_cma.h>
+
+#include "librpma.h"
+
+/*
+ * ERRORS
+ * rpma_conn_evch_get_cm_evch() cannot fail.
+ */
+struct rdma_event_channel *rpma_conn_evch_get_cm_evch(const struct rpma_conn_evch *evch);
+
+#endif /* LIBRPMA_CONN_EVCH_H */
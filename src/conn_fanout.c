@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_fanout.c -- librpma parallel connecting to many targets implementation
+ *
+ * Up to max_inflight targets are being connected at the same time. Each of them is either
+ * an outgoing connection request established asynchronously (see rpma_conn_req_new_async()) or
+ * a connection waiting for the RPMA_CONN_ESTABLISHED event. The file descriptors of all of them
+ * are polled together and every one which is ready is advanced by one step. A finished target
+ * frees its slot for the next one.
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+struct conn_fanout_slot {
+	struct rpma_conn_target *target;
+	struct rpma_conn_req *req; /* the target is being resolved if not NULL */
+	struct rpma_conn *conn; /* the target is being connected if not NULL */
+};
+
+/*
+ * conn_fanout_start -- start connecting the target
+ */
+static int
+conn_fanout_start(struct rpma_peer *peer, struct rpma_conn_target *target,
+		struct conn_fanout_slot *slot, int *fd)
+{
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(peer, target->addr, target->port, target->cfg, &req);
+	if (ret)
+		return ret;
+
+	ret = rpma_conn_req_get_fd(req, fd);
+	if (ret) {
+		(void) rpma_conn_req_delete(&req);
+		return ret;
+	}
+
+	slot->target = target;
+	slot->req = req;
+	slot->conn = NULL;
+
+	return 0;
+}
+
+/*
+ * conn_fanout_finish -- store the result of the target and release its resources on failure
+ */
+static void
+conn_fanout_finish(struct conn_fanout_slot *slot, int result)
+{
+	if (slot->req)
+		(void) rpma_conn_req_delete(&slot->req);
+
+	if (result && slot->conn)
+		(void) rpma_conn_delete(&slot->conn);
+
+	slot->target->conn = slot->conn;
+	slot->target->result = result;
+	slot->conn = NULL;
+}
+
+/*
+ * conn_fanout_close -- disconnect and delete the established connection of the target
+ * and store the result of the target
+ */
+static void
+conn_fanout_close(struct rpma_conn_target *target, int result)
+{
+	enum rpma_conn_event event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_disconnect(target->conn);
+	if (!ret)
+		ret = rpma_conn_next_event(target->conn, &event);
+	if (!ret && event != RPMA_CONN_CLOSED)
+		RPMA_LOG_WARNING("unexpected event when closing the connection: %s",
+			rpma_utils_conn_event_2str(event));
+	(void) rpma_conn_delete(&target->conn);
+
+	target->result = result;
+}
+
+/*
+ * conn_fanout_progress -- handle the next event of the target;
+ * returns true if the target is finished
+ */
+static bool
+conn_fanout_progress(struct conn_fanout_slot *slot, int *fd)
+{
+	int ret;
+
+	if (slot->req) {
+		enum rpma_conn_req_state state;
+		ret = rpma_conn_req_step(slot->req, &state);
+		if (ret == RPMA_E_NO_EVENT)
+			return false;
+		if (ret)
+			goto err_finish;
+		if (state != RPMA_CONN_REQ_READY)
+			return false;
+
+		/* the request is consumed regardless of the result */
+		ret = rpma_conn_req_connect(&slot->req, slot->target->pdata, &slot->conn);
+		if (ret)
+			goto err_finish;
+
+		ret = rpma_conn_get_event_fd(slot->conn, fd);
+		if (ret)
+			goto err_finish;
+
+		return false;
+	}
+
+	enum rpma_conn_event event;
+	ret = rpma_conn_next_event(slot->conn, &event);
+	if (ret == RPMA_E_NO_EVENT)
+		return false;
+	if (ret)
+		goto err_finish;
+
+	if (event != RPMA_CONN_ESTABLISHED) {
+		RPMA_LOG_ERROR("connecting %s:%s failed: %s", slot->target->addr,
+			slot->target->port, rpma_utils_conn_event_2str(event));
+		ret = RPMA_E_PROVIDER;
+		goto err_finish;
+	}
+
+	conn_fanout_finish(slot, 0);
+
+	return true;
+
+err_finish:
+	conn_fanout_finish(slot, ret);
+
+	return true;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_conn_connect_all -- connect all the targets with at most max_inflight of them
+ * being connected at the same time
+ */
+int
+rpma_conn_connect_all(struct rpma_peer *peer, struct rpma_conn_target *targets, int num_targets,
+		int max_inflight)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || targets == NULL || num_targets < 1 || max_inflight < 1)
+		return RPMA_E_INVAL;
+
+	if (max_inflight > num_targets)
+		max_inflight = num_targets;
+
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	struct conn_fanout_slot *slots = malloc((size_t)max_inflight * sizeof(*slots));
+	if (slots == NULL)
+		return RPMA_E_NOMEM;
+
+	struct pollfd *fds = malloc((size_t)max_inflight * sizeof(*fds));
+	if (fds == NULL) {
+		free(slots);
+		return RPMA_E_NOMEM;
+	}
+
+	for (int i = 0; i < num_targets; i++) {
+		targets[i].conn = NULL;
+		targets[i].result = 0;
+	}
+
+	int ret = 0;
+	int next = 0;
+	int inflight = 0;
+
+	while (next < num_targets || inflight > 0) {
+		/* fill up the free slots */
+		while (inflight < max_inflight && next < num_targets) {
+			struct rpma_conn_target *target = &targets[next++];
+			int result = conn_fanout_start(peer, target, &slots[inflight],
+					&fds[inflight].fd);
+			if (result) {
+				target->result = result;
+				continue;
+			}
+
+			fds[inflight].events = POLLIN;
+			inflight++;
+		}
+
+		if (inflight == 0)
+			break;
+
+		if (poll(fds, (nfds_t)inflight, -1) < 0) {
+			if (errno == EINTR)
+				continue;
+
+			RPMA_LOG_ERROR_WITH_ERRNO(errno, "poll()");
+			ret = RPMA_E_PROVIDER;
+			break;
+		}
+
+		/* a finished target is replaced with the last one so the slots go backwards */
+		for (int i = inflight - 1; i >= 0; i--) {
+			if (fds[i].revents == 0)
+				continue;
+
+			if (!conn_fanout_progress(&slots[i], &fds[i].fd))
+				continue;
+
+			inflight--;
+			slots[i] = slots[inflight];
+			fds[i] = fds[inflight];
+		}
+	}
+
+	/* abandon all the targets being connected when the polling failed */
+	for (int i = 0; i < inflight; i++)
+		conn_fanout_finish(&slots[i], ret);
+	for (; next < num_targets; next++)
+		targets[next].result = ret;
+
+	/* no connection is left established when the polling failed */
+	for (int i = 0; ret && i < num_targets; i++) {
+		if (targets[i].conn)
+			conn_fanout_close(&targets[i], ret);
+	}
+
+	free(fds);
+	free(slots);
+
+	return ret;
+}
@@ -19,6 +19,7 @@
 #include "mr.h"
 #include "peer.h"
 #include "private_data.h"
+#include "usdt.h"
 
 #ifdef TEST_MOCK_ALLOC
 #include "cmocka_alloc.h"
@@ -35,12 +36,23 @@ struct rpma_conn_req {
 	struct rpma_cq *rcq;
 	/* shared completion channel */
 	struct ibv_comp_channel *channel;
+	/* CM event channel shared with other connections (optional) */
+	struct rpma_conn_evch *conn_evch;
 
 	/* private data of the CM ID (incoming only) */
 	struct rpma_conn_private_data data;
 
 	/* a parent RPMA peer of this request - needed for derivative objects */
 	struct rpma_peer *peer;
+
+	/* the event channel of the asynchronous establishment (outgoing only) */
+	struct rdma_event_channel *evch;
+	/* the current step of the establishment */
+	enum rpma_conn_req_state state;
+	/* the configuration the QP and CQs are created with later (asynchronous or deferred) */
+	const struct rpma_conn_cfg *cfg;
+	/* the timeout of resolving the route */
+	int timeout_ms;
 };
 
 #ifdef DEBUG
@@ -65,18 +77,101 @@ rpma_snprintf_gid(uint8_t *raw, char *gid, size_t size)
 
 	return 0;
 }
+
+/*
+ * rpma_conn_req_log_gid -- log the source and destination GID addresses of the CM ID
+ */
+static void
+rpma_conn_req_log_gid(struct rdma_cm_id *id)
+{
+/*
+ * Maximum length of GID address in the following format:
+ * 0000:0000:0000:0000:0000:ffff:c0a8:6604
+ */
+#define GID_STR_LEN 40
+	/* log GID addresses if log level >= RPMA_LOG_LEVEL_NOTICE */
+	enum rpma_log_level level;
+	int ret = rpma_log_get_threshold(RPMA_LOG_THRESHOLD, &level);
+	if (ret == 0 && level >= RPMA_LOG_LEVEL_NOTICE) {
+		struct ibv_sa_path_rec *path_rec = id->route.path_rec;
+		char gid[GID_STR_LEN];
+		if (path_rec && !rpma_snprintf_gid(path_rec->sgid.raw, gid, GID_STR_LEN)) {
+			RPMA_LOG_NOTICE("src GID = %s", gid);
+		} else {
+			RPMA_LOG_NOTICE("src GID is not available");
+		}
+
+		if (path_rec && !rpma_snprintf_gid(path_rec->dgid.raw, gid, GID_STR_LEN)) {
+			RPMA_LOG_NOTICE("dst GID = %s", gid);
+		} else {
+			RPMA_LOG_NOTICE("dst GID is not available");
+		}
+	}
+#undef GID_STR_LEN
+}
 #endif /* DEBUG */
 
 /*
- * rpma_conn_req_new_from_id -- allocate a new conn_req object from CM ID and equip the latter
- * with QP and CQ
+ * rpma_conn_req_new_cqs -- create the main CQ, the receive CQ (if rcqe > 0)
+ * and the completion channel shared by them (if shared is true)
+ */
+static int
+rpma_conn_req_new_cqs(struct rdma_cm_id *id, int cqe, int rcqe, bool shared,
+		struct rpma_cq **cq_ptr, struct rpma_cq **rcq_ptr,
+		struct ibv_comp_channel **channel_ptr)
+{
+	struct ibv_comp_channel *channel = NULL;
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	int ret;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	if (shared) {
+		/* create a completion channel */
+		channel = ibv_create_comp_channel(id->verbs);
+		if (channel == NULL) {
+			RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_create_comp_channel()");
+			return RPMA_E_PROVIDER;
+		}
+	}
+
+	ret = rpma_cq_new(id->verbs, cqe, channel, &cq);
+	if (ret)
+		goto err_comp_channel_destroy;
+
+	if (rcqe) {
+		ret = rpma_cq_new(id->verbs, rcqe, channel, &rcq);
+		if (ret)
+			goto err_rpma_cq_delete;
+	}
+
+	*cq_ptr = cq;
+	*rcq_ptr = rcq;
+	*channel_ptr = channel;
+
+	return 0;
+
+err_rpma_cq_delete:
+	(void) rpma_cq_delete(&cq);
+
+err_comp_channel_destroy:
+	if (channel)
+		(void) ibv_destroy_comp_channel(channel);
+
+	return ret;
+}
+
+/*
+ * rpma_conn_req_setup_id -- equip the CM ID with QP and CQ
  *
  * ASSUMPTIONS
- * - peer != NULL && id != NULL && cfg != NULL && req_ptr != NULL
+ * - peer != NULL && id != NULL && cfg != NULL && cq_ptr != NULL && rcq_ptr != NULL &&
+ *   channel_ptr != NULL && conn_evch_ptr != NULL
  */
 static int
-rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
-		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr)
+rpma_conn_req_setup_id(struct rpma_peer *peer, struct rdma_cm_id *id,
+		const struct rpma_conn_cfg *cfg, struct rpma_cq **cq_ptr, struct rpma_cq **rcq_ptr,
+		struct ibv_comp_channel **channel_ptr, struct rpma_conn_evch **conn_evch_ptr)
 {
 	RPMA_DEBUG_TRACE;
 	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
@@ -86,6 +181,7 @@ rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
 	int cqe, rcqe;
 	bool shared = false;
 	struct rpma_srq *srq = NULL;
+	struct rpma_conn_evch *conn_evch = NULL;
 	struct rpma_cq *cq = NULL;
 	struct rpma_cq *rcq = NULL;
 	struct rpma_cq *srq_rcq = NULL;
@@ -93,10 +189,15 @@ rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
 	rpma_conn_cfg_get_cqe(cfg, &cqe);
 	/* read the receive CQ size from the configuration */
 	rpma_conn_cfg_get_rcqe(cfg, &rcqe);
+	/* the CQ sizes cannot exceed the limit of the device */
+	cqe = rpma_peer_clamp_cqe(peer, cqe);
+	rcqe = rpma_peer_clamp_cqe(peer, rcqe);
 	/* get if the completion channel should be shared by CQ and RCQ */
 	(void) rpma_conn_cfg_get_compl_channel(cfg, &shared);
 	/* get the shared RQ object from the connection */
 	(void) rpma_conn_cfg_get_srq(cfg, &srq);
+	/* get the CM event channel shared with other connections */
+	(void) rpma_conn_cfg_get_evch(cfg, &conn_evch);
 	if (srq)
 		(void) rpma_srq_get_rcq(srq, &srq_rcq);
 
@@ -106,25 +207,17 @@ rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
 		return RPMA_E_INVAL;
 	}
 
-	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
-	struct ibv_comp_channel *channel = NULL;
-	if (shared) {
-		/* create a completion channel */
-		channel = ibv_create_comp_channel(id->verbs);
-		if (channel == NULL) {
-			RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_create_comp_channel()");
-			return RPMA_E_PROVIDER;
-		}
-	}
+	/* the receive CQ of the shared RQ replaces the receive CQ of the connection */
+	if (srq_rcq)
+		rcqe = 0;
 
-	ret = rpma_cq_new(id->verbs, cqe, channel, &cq);
-	if (ret)
-		goto err_comp_channel_destroy;
-
-	if (!srq_rcq && rcqe) {
-		ret = rpma_cq_new(id->verbs, rcqe, channel, &rcq);
+	struct ibv_comp_channel *channel = NULL;
+	struct rpma_res_pool *pool = rpma_peer_get_res_pool(peer);
+	if (pool == NULL ||
+			!rpma_res_pool_take_cqs(pool, cqe, rcqe, shared, &cq, &rcq, &channel)) {
+		ret = rpma_conn_req_new_cqs(id, cqe, rcqe, shared, &cq, &rcq, &channel);
 		if (ret)
-			goto err_rpma_cq_delete;
+			return ret;
 	}
 
 	/* setup a QP */
@@ -132,6 +225,43 @@ rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
 	if (ret)
 		goto err_rpma_rcq_delete;
 
+	*cq_ptr = cq;
+	*rcq_ptr = rcq;
+	*channel_ptr = channel;
+	*conn_evch_ptr = conn_evch;
+
+	return 0;
+
+err_rpma_rcq_delete:
+	(void) rpma_cq_delete(&rcq);
+	(void) rpma_cq_delete(&cq);
+	if (channel)
+		(void) ibv_destroy_comp_channel(channel);
+
+	return ret;
+}
+
+/*
+ * rpma_conn_req_new_from_id -- allocate a new conn_req object from CM ID and equip the latter
+ * with QP and CQ
+ *
+ * ASSUMPTIONS
+ * - peer != NULL && id != NULL && cfg != NULL && req_ptr != NULL
+ */
+static int
+rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
+		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	struct ibv_comp_channel *channel = NULL;
+	struct rpma_conn_evch *conn_evch = NULL;
+	int ret = rpma_conn_req_setup_id(peer, id, cfg, &cq, &rcq, &channel, &conn_evch);
+	if (ret)
+		return ret;
+
 	*req_ptr = (struct rpma_conn_req *)malloc(sizeof(struct rpma_conn_req));
 	if (*req_ptr == NULL) {
 		ret = RPMA_E_NOMEM;
@@ -139,59 +269,61 @@ rpma_conn_req_new_from_id(struct rpma_peer *peer, struct rdma_cm_id *id,
 	}
 
 #ifdef DEBUG
-/*
- * Maximum length of GID address in the following format:
- * 0000:0000:0000:0000:0000:ffff:c0a8:6604
- */
-#define GID_STR_LEN 40
-	/* log GID addresses if log level >= RPMA_LOG_LEVEL_NOTICE */
-	enum rpma_log_level level;
-	ret = rpma_log_get_threshold(RPMA_LOG_THRESHOLD, &level);
-	if (ret == 0 && level >= RPMA_LOG_LEVEL_NOTICE) {
-		struct ibv_sa_path_rec *path_rec = id->route.path_rec;
-		char gid[GID_STR_LEN];
-		if (path_rec && !rpma_snprintf_gid(path_rec->sgid.raw, gid, GID_STR_LEN)) {
-			RPMA_LOG_NOTICE("src GID = %s", gid);
-		} else {
-			RPMA_LOG_NOTICE("src GID is not available");
-		}
-
-		if (path_rec && !rpma_snprintf_gid(path_rec->dgid.raw, gid, GID_STR_LEN)) {
-			RPMA_LOG_NOTICE("dst GID = %s", gid);
-		} else {
-			RPMA_LOG_NOTICE("dst GID is not available");
-		}
-	}
-#undef GID_STR_LEN
-#endif /* DEBUG */
+	rpma_conn_req_log_gid(id);
+#endif
 
 	(*req_ptr)->is_passive = 0;
 	(*req_ptr)->id = id;
 	(*req_ptr)->cq = cq;
 	(*req_ptr)->rcq = rcq;
 	(*req_ptr)->channel = channel;
+	(*req_ptr)->conn_evch = conn_evch;
 	(*req_ptr)->data.ptr = NULL;
 	(*req_ptr)->data.len = 0;
 	(*req_ptr)->peer = peer;
+	(*req_ptr)->evch = NULL;
+	(*req_ptr)->state = RPMA_CONN_REQ_READY;
+	(*req_ptr)->cfg = NULL;
+	(*req_ptr)->timeout_ms = 0;
 
 	return 0;
 
 err_destroy_qp:
 	rdma_destroy_qp(id);
-
-err_rpma_rcq_delete:
 	(void) rpma_cq_delete(&rcq);
-
-err_rpma_cq_delete:
 	(void) rpma_cq_delete(&cq);
-
-err_comp_channel_destroy:
 	if (channel)
 		(void) ibv_destroy_comp_channel(channel);
 
 	return ret;
 }
 
+/*
+ * rpma_conn_req_setup_deferred -- equip the CM ID of the pending incoming connection request
+ * with QP and CQ
+ *
+ * ASSUMPTIONS
+ * - req != NULL && req->state == RPMA_CONN_REQ_SETUP_PENDING
+ */
+static int
+rpma_conn_req_setup_deferred(struct rpma_conn_req *req)
+{
+	RPMA_DEBUG_TRACE;
+
+	int ret = rpma_conn_req_setup_id(req->peer, req->id, req->cfg, &req->cq, &req->rcq,
+			&req->channel, &req->conn_evch);
+	if (ret)
+		return ret;
+
+#ifdef DEBUG
+	rpma_conn_req_log_gid(req->id);
+#endif
+	req->state = RPMA_CONN_REQ_READY;
+	req->cfg = NULL;
+
+	return 0;
+}
+
 /*
  * rpma_conn_new_accept -- call rdma_accept()+rdma_ack_cm_event(). If succeeds
  * request re-packing the connection request to a connection object. Otherwise,
@@ -217,7 +349,8 @@ rpma_conn_new_accept(struct rpma_conn_req *req,
 	}
 
 	struct rpma_conn *conn = NULL;
-	ret = rpma_conn_new(req->peer, req->id, req->cq, req->rcq, req->channel, &conn);
+	ret = rpma_conn_new(req->peer, req->id, req->cq, req->rcq, req->channel,
+			req->conn_evch, &conn);
 	if (ret)
 		goto err_conn_disconnect;
 
@@ -259,7 +392,8 @@ rpma_conn_new_connect(struct rpma_conn_req *req, struct rdma_conn_param *conn_pa
 	RPMA_FAULT_INJECTION_GOTO(RPMA_E_PROVIDER, err_conn_new);
 
 	struct rpma_conn *conn = NULL;
-	ret = rpma_conn_new(req->peer, req->id, req->cq, req->rcq, req->channel, &conn);
+	ret = rpma_conn_new(req->peer, req->id, req->cq, req->rcq, req->channel,
+			req->conn_evch, &conn);
 	if (ret)
 		goto err_conn_new;
 
@@ -368,6 +502,53 @@ err_conn_req_delete:
 	return ret;
 }
 
+/*
+ * rpma_conn_req_new_deferred_from_cm_event -- allocate a new conn_req object from the CM event
+ * without equipping its CM ID with QP and CQ. They are created by rpma_conn_req_setup.
+ *
+ * ASSUMPTIONS
+ * cfg != NULL
+ */
+int
+rpma_conn_req_new_deferred_from_cm_event(struct rpma_peer *peer, struct rdma_cm_event *event,
+		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || event == NULL || event->event != RDMA_CM_EVENT_CONNECT_REQUEST ||
+	    req_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_conn_req *req = malloc(sizeof(*req));
+	if (req == NULL)
+		return RPMA_E_NOMEM;
+
+	req->data.ptr = NULL;
+	req->data.len = 0;
+	int ret = rpma_private_data_store(event, &req->data);
+	if (ret) {
+		free(req);
+		return ret;
+	}
+
+	req->is_passive = 1;
+	req->id = event->id;
+	req->cq = NULL;
+	req->rcq = NULL;
+	req->channel = NULL;
+	req->conn_evch = NULL;
+	req->peer = peer;
+	req->evch = NULL;
+	req->state = RPMA_CONN_REQ_SETUP_PENDING;
+	req->cfg = cfg;
+	req->timeout_ms = 0;
+
+	*req_ptr = req;
+
+	return 0;
+}
+
 /* public librpma API */
 
 /*
@@ -438,6 +619,214 @@ err_info_delete:
 	return ret;
 }
 
+/*
+ * rpma_conn_req_new_async -- create a new outgoing connection request object established
+ * asynchronously. It creates the CM ID on its own event channel and only starts resolving
+ * the address. The next steps are driven by rpma_conn_req_step.
+ */
+int
+rpma_conn_req_new_async(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || addr == NULL || port == NULL || req_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	if (cfg == NULL)
+		cfg = rpma_conn_cfg_default();
+
+	int timeout_ms = 0;
+	(void) rpma_conn_cfg_get_timeout(cfg, &timeout_ms);
+
+	struct rpma_info *info;
+	int ret = rpma_info_new(addr, port, RPMA_INFO_ACTIVE, &info);
+	if (ret)
+		return ret;
+
+	RPMA_FAULT_INJECTION_GOTO(RPMA_E_PROVIDER, err_info_delete);
+	struct rdma_event_channel *evch = rdma_create_event_channel();
+	if (evch == NULL) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_create_event_channel()");
+		ret = RPMA_E_PROVIDER;
+		goto err_info_delete;
+	}
+
+	struct rdma_cm_id *id;
+	if (rdma_create_id(evch, &id, NULL, RDMA_PS_TCP)) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_create_id()");
+		ret = RPMA_E_PROVIDER;
+		goto err_destroy_evch;
+	}
+
+	struct rpma_conn_req *req = malloc(sizeof(*req));
+	if (req == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_destroy_id;
+	}
+
+	/* the result of resolving the address is reported via the event channel */
+	ret = rpma_info_resolve_addr(info, id, timeout_ms);
+	if (ret)
+		goto err_free_req;
+
+	(void) rpma_info_delete(&info);
+
+	req->is_passive = 0;
+	req->id = id;
+	req->cq = NULL;
+	req->rcq = NULL;
+	req->channel = NULL;
+	req->conn_evch = NULL;
+	req->data.ptr = NULL;
+	req->data.len = 0;
+	req->peer = peer;
+	req->evch = evch;
+	req->state = RPMA_CONN_REQ_ADDR_RESOLVING;
+	req->cfg = cfg;
+	req->timeout_ms = timeout_ms;
+
+	*req_ptr = req;
+
+	RPMA_LOG_NOTICE("Resolving the address of %s:%s", addr, port);
+
+	return 0;
+
+err_free_req:
+	free(req);
+
+err_destroy_id:
+	(void) rdma_destroy_id(id);
+
+err_destroy_evch:
+	rdma_destroy_event_channel(evch);
+
+err_info_delete:
+	(void) rpma_info_delete(&info);
+
+	return ret;
+}
+
+/*
+ * rpma_conn_req_get_fd -- get a file descriptor of the event channel of the connection request
+ * established asynchronously
+ */
+int
+rpma_conn_req_get_fd(const struct rpma_conn_req *req, int *fd)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (req == NULL || fd == NULL || req->evch == NULL)
+		return RPMA_E_INVAL;
+
+	*fd = req->evch->fd;
+
+	return 0;
+}
+
+/*
+ * rpma_conn_req_step -- handle the next event of the connection request established
+ * asynchronously and advance its establishment
+ */
+int
+rpma_conn_req_step(struct rpma_conn_req *req, enum rpma_conn_req_state *state)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	RPMA_FAULT_INJECTION(RPMA_E_NO_EVENT,
+	{
+		errno = ENODATA;
+	});
+
+	if (req == NULL || state == NULL)
+		return RPMA_E_INVAL;
+
+	/* there is nothing more to do for an already ready request */
+	if (req->state == RPMA_CONN_REQ_READY) {
+		*state = req->state;
+		return 0;
+	}
+
+	/* a pending incoming request has no event channel to be stepped with */
+	if (req->evch == NULL)
+		return RPMA_E_INVAL;
+
+	struct rdma_cm_event *event = NULL;
+	if (rdma_get_cm_event(req->evch, &event)) {
+		if (errno == ENODATA)
+			return RPMA_E_NO_EVENT;
+
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_get_cm_event()");
+		return RPMA_E_PROVIDER;
+	}
+
+	enum rdma_cm_event_type cm_event = event->event;
+	int status = event->status;
+	if (rdma_ack_cm_event(event)) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_ack_cm_event()");
+		return RPMA_E_PROVIDER;
+	}
+
+	if (req->state == RPMA_CONN_REQ_ADDR_RESOLVING &&
+			cm_event == RDMA_CM_EVENT_ADDR_RESOLVED) {
+		RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+		if (rdma_resolve_route(req->id, req->timeout_ms)) {
+			RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_resolve_route(timeout_ms=%i)",
+				req->timeout_ms);
+			return RPMA_E_PROVIDER;
+		}
+
+		req->state = RPMA_CONN_REQ_ROUTE_RESOLVING;
+	} else if (req->state == RPMA_CONN_REQ_ROUTE_RESOLVING &&
+			cm_event == RDMA_CM_EVENT_ROUTE_RESOLVED) {
+		int ret = rpma_conn_req_setup_id(req->peer, req->id, req->cfg, &req->cq,
+				&req->rcq, &req->channel, &req->conn_evch);
+		if (ret)
+			return ret;
+
+#ifdef DEBUG
+		rpma_conn_req_log_gid(req->id);
+#endif
+		req->state = RPMA_CONN_REQ_READY;
+		req->cfg = NULL;
+	} else if (cm_event == RDMA_CM_EVENT_ADDR_ERROR ||
+			cm_event == RDMA_CM_EVENT_ROUTE_ERROR) {
+		RPMA_LOG_ERROR("%s (status %i)", rdma_event_str(cm_event), status);
+		return RPMA_E_PROVIDER;
+	} else {
+		RPMA_LOG_ERROR("Unexpected event received: %s", rdma_event_str(cm_event));
+		return RPMA_E_UNKNOWN;
+	}
+
+	*state = req->state;
+
+	return 0;
+}
+
+/*
+ * rpma_conn_req_setup -- create QP and CQ of the incoming connection request obtained with
+ * the deferred setup enabled
+ */
+int
+rpma_conn_req_setup(struct rpma_conn_req *req)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (req == NULL)
+		return RPMA_E_INVAL;
+
+	if (req->state == RPMA_CONN_REQ_READY)
+		return 0;
+
+	if (req->state != RPMA_CONN_REQ_SETUP_PENDING)
+		return RPMA_E_INVAL;
+
+	return rpma_conn_req_setup_deferred(req);
+}
+
 /*
  * rpma_conn_req_connect -- prepare connection parameters and request connecting
  * a connection request (either active or passive). When done release (delete)
@@ -457,11 +846,24 @@ rpma_conn_req_connect(struct rpma_conn_req **req_ptr, const struct rpma_conn_pri
 		(void) rpma_conn_req_delete(req_ptr);
 	});
 
-	if (conn_ptr == NULL || (pdata != NULL && (pdata->ptr == NULL || pdata->len == 0))) {
+	if (conn_ptr == NULL || (pdata != NULL && (pdata->ptr == NULL || pdata->len == 0)) ||
+			((*req_ptr)->state != RPMA_CONN_REQ_READY &&
+			(*req_ptr)->state != RPMA_CONN_REQ_SETUP_PENDING)) {
 		(void) rpma_conn_req_delete(req_ptr);
 		return RPMA_E_INVAL;
 	}
 
+	int ret = 0;
+
+	/* the deferred setup is done by the thread connecting the request */
+	if ((*req_ptr)->state == RPMA_CONN_REQ_SETUP_PENDING) {
+		ret = rpma_conn_req_setup_deferred(*req_ptr);
+		if (ret) {
+			(void) rpma_conn_req_delete(req_ptr);
+			return ret;
+		}
+	}
+
 	struct rdma_conn_param conn_param = {0};
 	conn_param.private_data = pdata ? pdata->ptr : NULL;
 	conn_param.private_data_len = pdata ? pdata->len : 0;
@@ -471,11 +873,16 @@ rpma_conn_req_connect(struct rpma_conn_req **req_ptr, const struct rpma_conn_pri
 	conn_param.retry_count = 7; /* max 3-bit value */
 	conn_param.rnr_retry_count = 7; /* max 3-bit value */
 
-	int ret = 0;
+	RPMA_USDT2(conn_req_connect, (*req_ptr)->id->qp->qp_num, (*req_ptr)->is_passive);
 	if ((*req_ptr)->is_passive)
 		ret = rpma_conn_new_accept(*req_ptr, &conn_param, conn_ptr);
 	else
 		ret = rpma_conn_new_connect(*req_ptr, &conn_param, conn_ptr);
+	RPMA_USDT1(conn_req_connect_done, ret);
+
+	/* the CM ID has been either migrated to the connection or destroyed */
+	if ((*req_ptr)->evch)
+		rdma_destroy_event_channel((*req_ptr)->evch);
 
 	free(*req_ptr);
 	*req_ptr = NULL;
@@ -500,7 +907,9 @@ rpma_conn_req_delete(struct rpma_conn_req **req_ptr)
 	if (req == NULL)
 		return 0;
 
-	rdma_destroy_qp(req->id);
+	/* QP is created when the route is resolved */
+	if (req->state == RPMA_CONN_REQ_READY)
+		rdma_destroy_qp(req->id);
 
 	int ret = rpma_cq_delete(&req->rcq);
 
@@ -525,6 +934,9 @@ rpma_conn_req_delete(struct rpma_conn_req **req_ptr)
 		}
 	}
 
+	if (req->evch)
+		rdma_destroy_event_channel(req->evch);
+
 	rpma_private_data_delete(&req->data);
 
 	free(req);
@@ -544,7 +956,7 @@ rpma_conn_req_recv(struct rpma_conn_req *req, struct rpma_mr_local *dst, size_t
 	RPMA_DEBUG_TRACE;
 	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
 
-	if (req == NULL || dst == NULL)
+	if (req == NULL || dst == NULL || req->state != RPMA_CONN_REQ_READY)
 		return RPMA_E_INVAL;
 
 	return rpma_mr_recv(req->id->qp, dst, offset, len, op_context);
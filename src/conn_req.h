@@ -24,4 +24,16 @@
 int rpma_conn_req_new_from_cm_event(struct rpma_peer *peer, struct rdma_cm_event *event,
 		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
 
+/*
+ * ERRORS
+ * rpma_conn_req_new_deferred_from_cm_event() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer, event or req_ptr is NULL
+ * - RPMA_E_INVAL - event is not RDMA_CM_EVENT_CONNECT_REQUEST
+ * - RPMA_E_NOMEM - out of memory
+ */
+int rpma_conn_req_new_deferred_from_cm_event(struct rpma_peer *peer,
+		struct rdma_cm_event *event, const struct rpma_conn_cfg *cfg,
+		struct rpma_conn_req **req_ptr);
+
 #endif /* LIBRPMA_CONN_REQ_H */
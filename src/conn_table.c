@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_table.c -- librpma QP number to connection table implementations
+ *
+ * QP numbers are unique only within a device, so there is a separate table for every device.
+ * The tables of the devices make a list which only grows. A QP number has 24 bits: its upper
+ * half indexes the directory of the table and its lower half indexes a leaf of the directory,
+ * so a lookup takes a few atomic loads and no locks. The leaves are allocated on demand and,
+ * as well as the tables, they are freed only when the library is unloaded since a lookup may run
+ * concurrently at any time.
+ */
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "conn_table.h"
+#include "debug.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+#define RPMA_CONN_TABLE_QP_NUM_BITS	24
+#define RPMA_CONN_TABLE_LEAF_BITS	12
+#define RPMA_CONN_TABLE_LEAF_SIZE	((uint32_t)1 << RPMA_CONN_TABLE_LEAF_BITS)
+#define RPMA_CONN_TABLE_DIR_SIZE \
+	((uint32_t)1 << (RPMA_CONN_TABLE_QP_NUM_BITS - RPMA_CONN_TABLE_LEAF_BITS))
+
+typedef _Atomic(struct rpma_conn *) rpma_conn_slot;
+
+struct rpma_conn_table {
+	const struct ibv_context *ctx; /* the device of the QPs */
+	struct rpma_conn_table *next; /* the table of another device */
+	_Atomic(rpma_conn_slot *) dir[RPMA_CONN_TABLE_DIR_SIZE]; /* the leaves */
+};
+
+/* the list of the tables of all devices */
+static _Atomic(struct rpma_conn_table *) Conn_tables;
+
+/*
+ * conn_table_find -- find the table of the device
+ */
+static struct rpma_conn_table *
+conn_table_find(const struct ibv_context *ctx)
+{
+	struct rpma_conn_table *table = atomic_load_explicit(&Conn_tables, memory_order_acquire);
+	while (table && table->ctx != ctx)
+		table = table->next;
+
+	return table;
+}
+
+/*
+ * conn_table_get -- find the table of the device or add a new one
+ */
+static struct rpma_conn_table *
+conn_table_get(const struct ibv_context *ctx)
+{
+	struct rpma_conn_table *table = conn_table_find(ctx);
+	if (table)
+		return table;
+
+	struct rpma_conn_table *new_table = malloc(sizeof(*new_table));
+	if (new_table == NULL)
+		return NULL;
+
+	memset(new_table, 0, sizeof(*new_table));
+	new_table->ctx = ctx;
+
+	struct rpma_conn_table *head = atomic_load_explicit(&Conn_tables, memory_order_acquire);
+	do {
+		/* the table could have been added in the meantime */
+		for (table = head; table && table->ctx != ctx; table = table->next)
+			;
+		if (table) {
+			free(new_table);
+			return table;
+		}
+
+		new_table->next = head;
+	} while (!atomic_compare_exchange_weak_explicit(&Conn_tables, &head, new_table,
+			memory_order_acq_rel, memory_order_acquire));
+
+	return new_table;
+}
+
+/*
+ * conn_table_leaf_get -- get the leaf of the directory entry or add a new one
+ */
+static rpma_conn_slot *
+conn_table_leaf_get(struct rpma_conn_table *table, uint32_t i)
+{
+	rpma_conn_slot *leaf = atomic_load_explicit(&table->dir[i], memory_order_acquire);
+	if (leaf)
+		return leaf;
+
+	rpma_conn_slot *new_leaf = malloc(RPMA_CONN_TABLE_LEAF_SIZE * sizeof(*new_leaf));
+	if (new_leaf == NULL)
+		return NULL;
+
+	for (uint32_t j = 0; j < RPMA_CONN_TABLE_LEAF_SIZE; j++)
+		atomic_init(&new_leaf[j], NULL);
+
+	if (atomic_compare_exchange_strong_explicit(&table->dir[i], &leaf, new_leaf,
+			memory_order_acq_rel, memory_order_acquire))
+		return new_leaf;
+
+	/* another thread has added the leaf in the meantime */
+	free(new_leaf);
+
+	return leaf;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_conn_table_insert -- register the connection under the QP number of the CM ID
+ */
+int
+rpma_conn_table_insert(const struct rdma_cm_id *id, struct rpma_conn *conn)
+{
+	RPMA_DEBUG_TRACE;
+
+	uint32_t qp_num = id->qp->qp_num;
+	if (qp_num >> RPMA_CONN_TABLE_QP_NUM_BITS) {
+		RPMA_LOG_ERROR("QP number out of range: 0x%" PRIx32, qp_num);
+		return RPMA_E_INVAL;
+	}
+
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	struct rpma_conn_table *table = conn_table_get(id->verbs);
+	if (table == NULL)
+		return RPMA_E_NOMEM;
+
+	rpma_conn_slot *leaf = conn_table_leaf_get(table, qp_num >> RPMA_CONN_TABLE_LEAF_BITS);
+	if (leaf == NULL)
+		return RPMA_E_NOMEM;
+
+	atomic_store_explicit(&leaf[qp_num & (RPMA_CONN_TABLE_LEAF_SIZE - 1)], conn,
+		memory_order_release);
+
+	return 0;
+}
+
+/*
+ * rpma_conn_table_remove -- unregister the connection if it is still registered under
+ * the QP number of the CM ID
+ */
+void
+rpma_conn_table_remove(const struct rdma_cm_id *id, struct rpma_conn *conn)
+{
+	RPMA_DEBUG_TRACE;
+
+	uint32_t qp_num = id->qp->qp_num;
+	if (qp_num >> RPMA_CONN_TABLE_QP_NUM_BITS)
+		return;
+
+	struct rpma_conn_table *table = conn_table_find(id->verbs);
+	if (table == NULL)
+		return;
+
+	rpma_conn_slot *leaf = atomic_load_explicit(
+		&table->dir[qp_num >> RPMA_CONN_TABLE_LEAF_BITS], memory_order_acquire);
+	if (leaf == NULL)
+		return;
+
+	/* the QP number may have been reused by another connection already */
+	(void) atomic_compare_exchange_strong_explicit(
+		&leaf[qp_num & (RPMA_CONN_TABLE_LEAF_SIZE - 1)], &conn, NULL,
+		memory_order_release, memory_order_relaxed);
+}
+
+/*
+ * rpma_conn_table_lookup -- find the connection of the QP number on the device
+ */
+struct rpma_conn *
+rpma_conn_table_lookup(const struct ibv_context *ctx, uint32_t qp_num)
+{
+	if (qp_num >> RPMA_CONN_TABLE_QP_NUM_BITS)
+		return NULL;
+
+	struct rpma_conn_table *table = conn_table_find(ctx);
+	if (table == NULL)
+		return NULL;
+
+	rpma_conn_slot *leaf = atomic_load_explicit(
+		&table->dir[qp_num >> RPMA_CONN_TABLE_LEAF_BITS], memory_order_acquire);
+	if (leaf == NULL)
+		return NULL;
+
+	return atomic_load_explicit(&leaf[qp_num & (RPMA_CONN_TABLE_LEAF_SIZE - 1)],
+		memory_order_acquire);
+}
+
+/*
+ * rpma_conn_table_fini -- free the tables of all devices
+ */
+void
+rpma_conn_table_fini(void)
+{
+	struct rpma_conn_table *table = atomic_exchange_explicit(&Conn_tables, NULL,
+			memory_order_acq_rel);
+
+	while (table) {
+		struct rpma_conn_table *next = table->next;
+
+		for (uint32_t i = 0; i < RPMA_CONN_TABLE_DIR_SIZE; i++)
+			free(atomic_load_explicit(&table->dir[i], memory_order_relaxed));
+		free(table);
+
+		table = next;
+	}
+}
@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_table.h -- librpma QP number to connection table internal definitions
+ */
+
+#ifndef LIBRPMA_CONN_TABLE_H
+#define LIBRPMA_CONN_TABLE_H
+
+#include <infiniband/verbs.h>
+#include <rdma/rdma_cma.h>
+
+#include "librpma.h"
+
+/*
+ * rpma_conn_table_insert -- register the connection under the QP number of the CM ID
+ *
+ * ASSUMPTIONS
+ * - id != NULL && id->verbs != NULL && id->qp != NULL && conn != NULL
+ *
+ * ERRORS
+ * rpma_conn_table_insert() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - the QP number is out of the range of the table
+ * - RPMA_E_NOMEM - out of memory
+ */
+int rpma_conn_table_insert(const struct rdma_cm_id *id, struct rpma_conn *conn);
+
+/*
+ * rpma_conn_table_remove -- unregister the connection if it is still registered under
+ * the QP number of the CM ID
+ *
+ * ASSUMPTIONS
+ * - id != NULL && id->verbs != NULL && id->qp != NULL
+ *
+ * ERRORS
+ * rpma_conn_table_remove() cannot fail.
+ */
+void rpma_conn_table_remove(const struct rdma_cm_id *id, struct rpma_conn *conn);
+
+/*
+ * rpma_conn_table_lookup -- find the connection of the QP number on the device
+ *
+ * ASSUMPTIONS
+ * - ctx != NULL
+ *
+ * ERRORS
+ * rpma_conn_table_lookup() cannot fail. It returns NULL if no connection is registered.
+ */
+struct rpma_conn *rpma_conn_table_lookup(const struct ibv_context *ctx, uint32_t qp_num);
+
+/*
+ * rpma_conn_table_fini -- free the tables of all devices
+ *
+ * ASSUMPTIONS
+ * - no other thread uses the tables anymore
+ *
+ * ERRORS
+ * rpma_conn_table_fini() cannot fail.
+ */
+void rpma_conn_table_fini(void);
+
+#endif /* LIBRPMA_CONN_TABLE_H */
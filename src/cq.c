@@ -12,18 +12,27 @@
 #include <arpa/inet.h>
 
 #include "common.h"
+#include "conn_table.h"
 #include "cq.h"
 #include "debug.h"
+#include "hook.h"
 #include "log_internal.h"
+#include "metrics.h"
+#include "usdt.h"
 
 #ifdef TEST_MOCK_ALLOC
 #include "cmocka_alloc.h"
 #endif
 
+/* the number of completions polled at once when the CQ is drained */
+#define RPMA_CQ_DRAIN_BATCH 16
+
 struct rpma_cq {
 	struct ibv_comp_channel *channel; /* completion channel */
 	bool shared_comp_channel; /* completion channel is shared */
 	struct ibv_cq *cq; /* completion queue */
+	/* the instrumentation of the connection using the CQ (optional) */
+	struct rpma_instr *instr;
 };
 
 /* internal librpma API */
@@ -95,6 +104,8 @@ rpma_cq_new(struct ibv_context *ibv_ctx, int cqe, struct ibv_comp_channel *share
 	(*cq_ptr)->channel = channel;
 	(*cq_ptr)->shared_comp_channel = (shared_channel != NULL);
 	(*cq_ptr)->cq = cq;
+	(*cq_ptr)->instr = NULL;
+	RPMA_METRICS_ADD(RPMA_METRICS_CQS, 1);
 
 	return 0;
 
@@ -143,11 +154,54 @@ rpma_cq_delete(struct rpma_cq **cq_ptr)
 
 	free(cq);
 	*cq_ptr = NULL;
+	RPMA_METRICS_SUB(RPMA_METRICS_CQS, 1);
 
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	return ret;
 }
 
+/*
+ * rpma_cq_reset -- drain the completions left in the CQ and request the next completion event
+ * so the CQ can be reused by another connection
+ */
+int
+rpma_cq_reset(struct rpma_cq *cq)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	/* the completions of the previous connection are of no use anymore */
+	struct ibv_wc wc[RPMA_CQ_DRAIN_BATCH];
+	int result;
+	while ((result = ibv_poll_cq(cq->cq, RPMA_CQ_DRAIN_BATCH, wc)) > 0)
+		;
+
+	if (result < 0) {
+		/* ibv_poll_cq() may return only -1; no errno provided */
+		RPMA_LOG_ERROR("ibv_poll_cq() failed (no details available)");
+		return RPMA_E_PROVIDER;
+	}
+
+	/* the previous connection might have left the CQ not armed */
+	errno = ibv_req_notify_cq(cq->cq, 0 /* all completions */);
+	if (errno) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_req_notify_cq()");
+		return RPMA_E_PROVIDER;
+	}
+
+	return 0;
+}
+
+/*
+ * rpma_cq_set_instr -- set the instrumentation of the connection whose completions
+ * are obtained from the CQ
+ */
+void
+rpma_cq_set_instr(struct rpma_cq *cq, struct rpma_instr *instr)
+{
+	cq->instr = instr;
+}
+
 /* public librpma API */
 
 /*
@@ -187,8 +241,10 @@ rpma_cq_wait(struct rpma_cq *cq)
 	struct ibv_cq *ev_cq;	/* unused */
 	void *ev_ctx;		/* unused */
 	RPMA_FAULT_INJECTION(RPMA_E_NO_COMPLETION, {});
+	RPMA_USDT1(cq_wait, cq->cq);
 	if (ibv_get_cq_event(cq->channel, &ev_cq, &ev_ctx))
 		return RPMA_E_NO_COMPLETION;
+	RPMA_USDT1(cq_wait_done, cq->cq);
 
 	/*
 	 * ACK the collected CQ event.
@@ -202,7 +258,7 @@ rpma_cq_wait(struct rpma_cq *cq)
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	errno = ibv_req_notify_cq(cq->cq, 0 /* all completions */);
 	if (errno) {
-		RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_req_notify_cq()");
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(errno, "ibv_req_notify_cq()");
 		return RPMA_E_PROVIDER;
 	}
 
@@ -235,14 +291,22 @@ rpma_cq_get_wc(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc, int *num_
 		return RPMA_E_NO_COMPLETION;
 	} else if (result < 0) {
 		/* ibv_poll_cq() may return only -1; no errno provided */
-		RPMA_LOG_ERROR("ibv_poll_cq() failed (no details available)");
+		RPMA_LOG_ERROR_RATELIMITED("ibv_poll_cq() failed (no details available)");
+		RPMA_METRICS_ADD(RPMA_METRICS_CQ_POLL_ERRORS, 1);
 		return RPMA_E_PROVIDER;
 	} else if (result > num_entries) {
-		RPMA_LOG_ERROR(
+		RPMA_LOG_ERROR_RATELIMITED(
 			"ibv_poll_cq() returned %d where <= %d is expected", result, num_entries);
 		return RPMA_E_UNKNOWN;
 	}
 
+	if (cq->instr)
+		rpma_instr_complete(cq->instr, wc, result);
+
+	RPMA_HOOK_COMPLETION(wc, result);
+
+	RPMA_USDT3(completion, cq->cq, wc, result);
+
 	if (num_entries_got)
 		*num_entries_got = result;
 
@@ -251,3 +315,31 @@ rpma_cq_get_wc(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc, int *num_
 
 	return 0;
 }
+
+/*
+ * rpma_cq_get_wc_conn -- receive one or more completions from the CQ along with their connections
+ */
+int
+rpma_cq_get_wc_conn(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc,
+		struct rpma_conn **conns, int *num_entries_got)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (conns == NULL)
+		return RPMA_E_INVAL;
+
+	int num = 1;
+	int ret = rpma_cq_get_wc(cq, num_entries, wc, num_entries > 1 ? &num : NULL);
+	if (ret)
+		return ret;
+
+	/* all QPs completing into the CQ belong to the device of the CQ */
+	for (int i = 0; i < num; i++)
+		conns[i] = rpma_conn_table_lookup(cq->cq->context, wc[i].qp_num);
+
+	if (num_entries_got)
+		*num_entries_got = num;
+
+	return 0;
+}
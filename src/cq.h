@@ -13,6 +13,7 @@
 #include <rdma/rdma_cma.h>
 
 #include "librpma.h"
+#include "instr.h"
 
 /*
  * ERRORS
@@ -40,4 +41,31 @@ int rpma_cq_new(struct ibv_context *ibv_ctx, int cqe, struct ibv_comp_channel *s
  */
 int rpma_cq_delete(struct rpma_cq **cq_ptr);
 
+/*
+ * rpma_cq_reset -- drain the completions left in the CQ and request the next completion event
+ * so the CQ can be reused by another connection
+ *
+ * ASSUMPTIONS
+ * - cq != NULL
+ * - no QP completing into the CQ exists anymore
+ *
+ * ERRORS
+ * rpma_cq_reset() can fail with the following error:
+ *
+ * - RPMA_E_PROVIDER - ibv_poll_cq(3) or ibv_req_notify_cq(3) failed with a provider error
+ */
+int rpma_cq_reset(struct rpma_cq *cq);
+
+/*
+ * rpma_cq_set_instr -- set the instrumentation of the connection whose completions
+ * are obtained from the CQ (NULL - the completions are not accounted)
+ *
+ * ASSUMPTIONS
+ * - cq != NULL
+ *
+ * ERRORS
+ * rpma_cq_set_instr() cannot fail.
+ */
+void rpma_cq_set_instr(struct rpma_cq *cq, struct rpma_instr *instr);
+
 #endif /* LIBRPMA_CQ_H */
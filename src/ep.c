@@ -6,6 +6,7 @@
  */
 
 #include <errno.h>
+#include <poll.h>
 #include <stdlib.h>
 
 #include "conn_cfg.h"
@@ -22,28 +23,25 @@ struct rpma_ep {
 	struct rdma_cm_id *id;
 	/* event channel of the CM ID */
 	struct rdma_event_channel *evch;
+	/* QPs and CQs of the connection requests are created by rpma_conn_req_setup() */
+	bool deferred;
 };
 
 #ifdef TEST_MOCK_ALLOC
 #include "cmocka_alloc.h"
 #endif
 
-/* public librpma API */
-
 /*
- * rpma_ep_listen -- create a new event channel and a new CM ID attached to the event channel.
- * Bind the CM ID to the provided addr:port pair. If everything succeeds a new endpoint is created
- * encapsulating the event channel and the CM ID.
+ * ep_listen -- create a new event channel and a new CM ID attached to the event channel.
+ * Bind the CM ID to the provided addr:port pair and listen with the given backlog.
+ *
+ * ASSUMPTIONS
+ * - peer != NULL && addr != NULL && port != NULL && ep_ptr != NULL && backlog >= 0
  */
-int
-rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port, struct rpma_ep **ep_ptr)
+static int
+ep_listen(struct rpma_peer *peer, const char *addr, const char *port, int backlog,
+		struct rpma_ep **ep_ptr)
 {
-	RPMA_DEBUG_TRACE;
-	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
-
-	if (peer == NULL || addr == NULL || port == NULL || ep_ptr == NULL)
-		return RPMA_E_INVAL;
-
 	struct rdma_event_channel *evch = NULL;
 	struct rdma_cm_id *id = NULL;
 	struct rpma_info *info = NULL;
@@ -74,7 +72,7 @@ rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port, struc
 
 	RPMA_FAULT_INJECTION_GOTO(RPMA_E_PROVIDER, err_info_delete);
 
-	if (rdma_listen(id, 0 /* backlog */)) {
+	if (rdma_listen(id, backlog)) {
 		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_listen()");
 		ret = RPMA_E_PROVIDER;
 		goto err_info_delete;
@@ -90,6 +88,7 @@ rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port, struc
 	ep->peer = peer;
 	ep->evch = evch;
 	ep->id = id;
+	ep->deferred = false;
 	*ep_ptr = ep;
 
 	/* an error at this step should not affect the final result */
@@ -108,6 +107,118 @@ err_destroy_event_channel:
 	return ret;
 }
 
+/*
+ * ep_get_conn_req -- get the next event in the hope it will be an RDMA_CM_EVENT_CONNECT_REQUEST.
+ * If so it orders the creation of a connection request object based on the obtained request
+ * (without QP and CQ if the deferred setup is enabled).
+ *
+ * ASSUMPTIONS
+ * - ep != NULL && cfg != NULL && req_ptr != NULL
+ */
+static int
+ep_get_conn_req(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
+		struct rpma_conn_req **req_ptr)
+{
+	int ret = 0;
+	struct rdma_cm_event *event = NULL;
+
+	/* get an event */
+	if (rdma_get_cm_event(ep->evch, &event)) {
+		if (errno == ENODATA)
+			return RPMA_E_NO_EVENT;
+
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_get_cm_event()");
+		return RPMA_E_PROVIDER;
+	}
+
+	/* we expect only one type of events here */
+	RPMA_FAULT_INJECTION_GOTO(RPMA_E_INVAL, err_ack);
+	if (event->event != RDMA_CM_EVENT_CONNECT_REQUEST) {
+		RPMA_LOG_ERROR("Unexpected event received: %s", rdma_event_str(event->event));
+		ret = RPMA_E_INVAL;
+		goto err_ack;
+	}
+
+	if (ep->deferred)
+		ret = rpma_conn_req_new_deferred_from_cm_event(ep->peer, event, cfg, req_ptr);
+	else
+		ret = rpma_conn_req_new_from_cm_event(ep->peer, event, cfg, req_ptr);
+	if (ret)
+		goto err_ack;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER,
+	{
+		(void) rpma_conn_req_delete(req_ptr);
+		goto err_ack;
+	});
+
+	/* ACK the connection request event */
+	if (rdma_ack_cm_event(event)) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_ack_cm_event()");
+		(void) rpma_conn_req_delete(req_ptr);
+		return RPMA_E_PROVIDER;
+	}
+
+	return 0;
+
+err_ack:
+	(void) rdma_ack_cm_event(event);
+	return ret;
+}
+
+/*
+ * ep_has_event -- check if the next event is waiting without blocking
+ */
+static bool
+ep_has_event(const struct rpma_ep *ep)
+{
+	struct pollfd pfd = {ep->evch->fd, POLLIN, 0};
+
+	int ret = poll(&pfd, 1, 0 /* do not wait */);
+	if (ret < 0) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "poll()");
+		return false;
+	}
+
+	return ret > 0;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_ep_listen -- create a new event channel and a new CM ID attached to the event channel.
+ * Bind the CM ID to the provided addr:port pair. If everything succeeds a new endpoint is created
+ * encapsulating the event channel and the CM ID.
+ */
+int
+rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port, struct rpma_ep **ep_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	if (peer == NULL || addr == NULL || port == NULL || ep_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	return ep_listen(peer, addr, port, 0 /* backlog */, ep_ptr);
+}
+
+/*
+ * rpma_ep_listen_with_backlog -- rpma_ep_listen() with the given backlog of pending
+ * connection requests
+ */
+int
+rpma_ep_listen_with_backlog(struct rpma_peer *peer, const char *addr, const char *port,
+		int backlog, struct rpma_ep **ep_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	if (peer == NULL || addr == NULL || port == NULL || ep_ptr == NULL || backlog < 0)
+		return RPMA_E_INVAL;
+
+	return ep_listen(peer, addr, port, backlog, ep_ptr);
+}
+
 /*
  * rpma_ep_shutdown -- destroy the encapsulated CM ID and event channel.
  * When done delete the endpoint.
@@ -179,47 +290,65 @@ rpma_ep_next_conn_req(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
 	if (cfg == NULL)
 		cfg = rpma_conn_cfg_default();
 
-	int ret = 0;
-	struct rdma_cm_event *event = NULL;
+	return ep_get_conn_req(ep, cfg, req_ptr);
+}
 
-	/* get an event */
-	if (rdma_get_cm_event(ep->evch, &event)) {
-		if (errno == ENODATA)
-			return RPMA_E_NO_EVENT;
+/*
+ * rpma_ep_next_conn_reqs -- get up to max_reqs connection requests which are waiting
+ * for the endpoint. Only the first one may be waited for.
+ */
+int
+rpma_ep_next_conn_reqs(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
+		struct rpma_conn_req **reqs, int max_reqs, int *num_reqs)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	RPMA_FAULT_INJECTION(RPMA_E_NO_EVENT,
+	{
+		errno = ENODATA;
+	});
 
-		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_get_cm_event()");
-		return RPMA_E_PROVIDER;
-	}
+	if (ep == NULL || reqs == NULL || max_reqs < 1 || num_reqs == NULL)
+		return RPMA_E_INVAL;
 
-	/* we expect only one type of events here */
-	RPMA_FAULT_INJECTION_GOTO(RPMA_E_INVAL, err_ack);
-	if (event->event != RDMA_CM_EVENT_CONNECT_REQUEST) {
-		RPMA_LOG_ERROR("Unexpected event received: %s", rdma_event_str(event->event));
-		ret = RPMA_E_INVAL;
-		goto err_ack;
-	}
+	if (cfg == NULL)
+		cfg = rpma_conn_cfg_default();
 
-	ret = rpma_conn_req_new_from_cm_event(ep->peer, event, cfg, req_ptr);
+	/* the first request is obtained as by rpma_ep_next_conn_req() */
+	int ret = ep_get_conn_req(ep, cfg, &reqs[0]);
 	if (ret)
-		goto err_ack;
-
-	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER,
-	{
-		(void) rpma_conn_req_delete(req_ptr);
-		goto err_ack;
-	});
-
-	/* ACK the connection request event */
-	if (rdma_ack_cm_event(event)) {
-		RPMA_LOG_ERROR_WITH_ERRNO(errno, "rdma_ack_cm_event()");
-		(void) rpma_conn_req_delete(req_ptr);
-		return RPMA_E_PROVIDER;
+		return ret;
+
+	int num = 1;
+	while (num < max_reqs && ep_has_event(ep)) {
+		/*
+		 * The requests obtained so far are returned anyway. A failed one is dropped
+		 * the same way as by rpma_ep_next_conn_req().
+		 */
+		if (ep_get_conn_req(ep, cfg, &reqs[num]))
+			break;
+
+		num++;
 	}
 
+	*num_reqs = num;
+
 	return 0;
+}
 
-err_ack:
-	(void) rdma_ack_cm_event(event);
-	return ret;
+/*
+ * rpma_ep_set_deferred_setup -- enable or disable the deferred setup of the connection requests
+ */
+int
+rpma_ep_set_deferred_setup(struct rpma_ep *ep, bool deferred)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
 
+	if (ep == NULL)
+		return RPMA_E_INVAL;
+
+	ep->deferred = deferred;
+
+	return 0;
 }
@@ -146,7 +146,7 @@ rpma_flush_apm_execute(struct ibv_qp *qp, struct rpma_flush *flush, struct rpma_
 	struct rpma_flush_internal *flush_internal = (struct rpma_flush_internal *)flush;
 	struct flush_apm *flush_apm = (struct flush_apm *)flush_internal->context;
 
-	return rpma_mr_read(qp, flush_apm->raw_mr, 0, dst, dst_offset, RAW_SIZE, flags,
+	return rpma_mr_flush_apm(qp, flush_apm->raw_mr, RAW_SIZE, dst, dst_offset, len, flags,
 			op_context);
 }
 
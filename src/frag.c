@@ -0,0 +1,390 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * frag.c -- librpma fragmented messaging implementations
+ *
+ * A message is split into fragments of a fixed size sent straight from the source memory region
+ * using sends with immediate data. The immediate data carries the sequence number of
+ * the fragment and a flag marking the last fragment of the message. Up to the pipeline depth
+ * fragments are in flight and every completed fragment lets the next one go. If a fragment
+ * cannot be posted after some of the message has been sent, a zero-length fragment flagged as
+ * an abort is sent instead of the rest of the message, so the receiving side drops what it has
+ * reassembled so far rather than prepending it to the next message.
+ *
+ * The receiving side keeps the pipeline depth receives posted into its own pool of
+ * fragment-sized buffers. Since the receives of a reliable connection are consumed in the order
+ * they were posted, the buffer of a completed receive is known without any lookup. Every
+ * fragment is copied into the destination at the current reassembly offset and its buffer is
+ * posted again right away. The fragments cannot be received straight into the destination
+ * because the receives have to be posted before the destination of the next message is known.
+ */
+
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "conn.h"
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* the immediate data: the sequence number of the fragment, the last fragment and abort flags */
+#define RPMA_FRAG_IMM_LAST	((uint32_t)1 << 31)
+#define RPMA_FRAG_IMM_ABORT	((uint32_t)1 << 30)
+#define RPMA_FRAG_IMM_SEQ_MASK	(RPMA_FRAG_IMM_ABORT - 1)
+
+struct rpma_frag {
+	struct rpma_conn *conn; /* the connection the fragments are sent over */
+	size_t frag_size; /* the maximum size of a fragment */
+	uint32_t depth; /* the maximum number of fragments in flight */
+
+	/* the receiving side */
+	char *rx; /* the pool of depth receive buffers */
+	struct rpma_mr_local *rx_mr; /* a registration of rx */
+	uint32_t rx_next; /* the buffer of the next completed receive */
+	uint32_t rx_seq; /* the sequence number of the next fragment */
+	size_t rx_len; /* the number of bytes of the message reassembled so far */
+	bool rx_discard; /* the rest of the message does not fit into the destination */
+
+	/* the sending side */
+	const struct rpma_mr_local *tx_src; /* the source of the message being sent */
+	size_t tx_offset; /* the offset of the message in tx_src */
+	size_t tx_len; /* the length of the message */
+	const void *tx_op_context; /* the op_context of the message */
+	uint32_t tx_frags; /* the number of fragments of the message */
+	uint32_t tx_posted; /* the number of fragments posted so far */
+	uint32_t tx_inflight; /* the number of fragments posted but not completed yet */
+	uint32_t tx_seq; /* the sequence number of the next fragment */
+	int tx_error; /* the error which has stopped sending the message (0 - none) */
+	bool tx_aborted; /* the abort fragment of the message has been posted */
+	bool tx_busy; /* a message is being sent */
+};
+
+/*
+ * frag_post_next -- post the next fragment of the message being sent
+ */
+static int
+frag_post_next(struct rpma_frag *frag)
+{
+	size_t offset = (size_t)frag->tx_posted * frag->frag_size;
+	size_t len = frag->tx_len - offset;
+	if (len > frag->frag_size)
+		len = frag->frag_size;
+
+	uint32_t imm = frag->tx_seq & RPMA_FRAG_IMM_SEQ_MASK;
+	if (frag->tx_posted + 1 == frag->tx_frags)
+		imm |= RPMA_FRAG_IMM_LAST;
+
+	/* an empty message is sent as a single zero-length fragment */
+	const struct rpma_mr_local *src = len ? frag->tx_src : NULL;
+	offset = len ? frag->tx_offset + offset : 0;
+
+	int ret = rpma_send_with_imm(frag->conn, src, offset, len, RPMA_F_COMPLETION_ALWAYS, imm,
+			frag);
+	if (ret)
+		return ret;
+
+	frag->tx_seq++;
+	frag->tx_posted++;
+	frag->tx_inflight++;
+
+	return 0;
+}
+
+/*
+ * frag_abort -- stop sending the message and try to tell the receiving side it is aborted
+ * (the abort fragment is tried again on the following completions if it cannot be posted now)
+ */
+static void
+frag_abort(struct rpma_frag *frag, int error)
+{
+	if (frag->tx_error == 0)
+		frag->tx_error = error;
+
+	if (frag->tx_aborted)
+		return;
+
+	uint32_t imm = (frag->tx_seq & RPMA_FRAG_IMM_SEQ_MASK) | RPMA_FRAG_IMM_ABORT;
+	if (rpma_send_with_imm(frag->conn, NULL, 0, 0, RPMA_F_COMPLETION_ALWAYS, imm, frag))
+		return;
+
+	frag->tx_seq++;
+	frag->tx_inflight++;
+	frag->tx_aborted = true;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_frag_new -- create a new fragmented messaging object for the connection
+ */
+int
+rpma_frag_new(struct rpma_peer *peer, struct rpma_conn *conn, size_t frag_size, uint32_t depth,
+		struct rpma_frag **frag_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || conn == NULL || frag_ptr == NULL || frag_size == 0 ||
+			frag_size > UINT32_MAX || depth == 0 || frag_size > SIZE_MAX / depth)
+		return RPMA_E_INVAL;
+
+	/* all receives are posted at once so the receive queue has to hold them */
+	uint32_t rq_size;
+	int ret = rpma_conn_get_rq_size(conn, &rq_size);
+	if (ret)
+		return ret;
+
+	if (depth > rq_size) {
+		RPMA_LOG_ERROR("depth exceeds the receive queue size: %" PRIu32 " > %" PRIu32,
+			depth, rq_size);
+		return RPMA_E_INVAL;
+	}
+
+	struct rpma_frag *frag = malloc(sizeof(*frag));
+	if (frag == NULL)
+		return RPMA_E_NOMEM;
+
+	char *rx = malloc(frag_size * depth);
+	if (rx == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_frag;
+	}
+
+	struct rpma_mr_local *rx_mr = NULL;
+	ret = rpma_mr_reg(peer, rx, frag_size * depth, RPMA_MR_USAGE_RECV, &rx_mr);
+	if (ret)
+		goto err_free_rx;
+
+	uint32_t posted;
+	for (posted = 0; posted < depth; posted++) {
+		ret = rpma_recv(conn, rx_mr, posted * frag_size, frag_size, frag);
+		if (ret)
+			goto err_flush_recv;
+	}
+
+	memset(frag, 0, sizeof(*frag));
+	frag->conn = conn;
+	frag->frag_size = frag_size;
+	frag->depth = depth;
+	frag->rx = rx;
+	frag->rx_mr = rx_mr;
+
+	*frag_ptr = frag;
+
+	return 0;
+
+err_flush_recv:
+	/*
+	 * The receives already posted cannot be withdrawn. Disconnecting moves the QP into
+	 * the error state, so they are flushed and nothing is written into rx after it is freed.
+	 */
+	if (posted > 0)
+		(void) rpma_conn_disconnect(conn);
+
+	(void) rpma_mr_dereg(&rx_mr);
+
+err_free_rx:
+	free(rx);
+
+err_free_frag:
+	free(frag);
+
+	return ret;
+}
+
+/*
+ * rpma_frag_delete -- delete the fragmented messaging object
+ */
+int
+rpma_frag_delete(struct rpma_frag **frag_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (frag_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_frag *frag = *frag_ptr;
+	if (frag == NULL)
+		return 0;
+
+	int ret = rpma_mr_dereg(&frag->rx_mr);
+
+	free(frag->rx);
+	free(frag);
+	*frag_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_frag_send -- start sending the message in fragments
+ */
+int
+rpma_frag_send(struct rpma_frag *frag, const struct rpma_mr_local *src, size_t offset,
+		size_t len, const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (frag == NULL || (src == NULL && (offset != 0 || len != 0)))
+		return RPMA_E_INVAL;
+
+	size_t frags = len ? (len - 1) / frag->frag_size + 1 : 1;
+	if (frags > UINT32_MAX)
+		return RPMA_E_INVAL;
+
+	if (frag->tx_busy)
+		return RPMA_E_AGAIN;
+
+	frag->tx_src = src;
+	frag->tx_offset = offset;
+	frag->tx_len = len;
+	frag->tx_op_context = op_context;
+	frag->tx_frags = (uint32_t)frags;
+	frag->tx_posted = 0;
+	frag->tx_inflight = 0;
+	frag->tx_error = 0;
+	frag->tx_aborted = false;
+
+	while (frag->tx_posted < frag->tx_frags && frag->tx_inflight < frag->depth) {
+		int ret = frag_post_next(frag);
+		if (ret == 0)
+			continue;
+
+		/* nothing has been sent so the message can be sent again */
+		if (frag->tx_posted == 0)
+			return ret;
+
+		/* the failure is reported by rpma_frag_send_progress() with the last completion */
+		frag_abort(frag, ret);
+		break;
+	}
+
+	frag->tx_busy = true;
+
+	return 0;
+}
+
+/*
+ * rpma_frag_send_progress -- handle the completion of a fragment and post the next one
+ */
+int
+rpma_frag_send_progress(struct rpma_frag *frag, const struct ibv_wc *wc, bool *done,
+		const void **op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (frag == NULL || wc == NULL || done == NULL || op_context == NULL)
+		return RPMA_E_INVAL;
+
+	if (wc->opcode != IBV_WC_SEND || wc->wr_id != (uint64_t)frag || !frag->tx_busy ||
+			frag->tx_inflight == 0)
+		return RPMA_E_INVAL;
+
+	frag->tx_inflight--;
+
+	if (frag->tx_error) {
+		/* retry the abort fragment if it could not be posted before */
+		frag_abort(frag, frag->tx_error);
+	} else if (frag->tx_posted < frag->tx_frags) {
+		int ret = frag_post_next(frag);
+		if (ret)
+			frag_abort(frag, ret);
+	}
+
+	/* the message (possibly aborted) is finished when none of its fragments is in flight */
+	*done = (frag->tx_inflight == 0);
+	*op_context = NULL;
+	if (*done == false)
+		return 0;
+
+	*op_context = frag->tx_op_context;
+	frag->tx_busy = false;
+
+	return frag->tx_error;
+}
+
+/*
+ * rpma_frag_recv -- reassemble the received fragment into the destination
+ */
+int
+rpma_frag_recv(struct rpma_frag *frag, const struct ibv_wc *wc, void *dst, size_t dst_size,
+		bool *done, size_t *len)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (frag == NULL || wc == NULL || (dst == NULL && dst_size != 0) || done == NULL ||
+			len == NULL)
+		return RPMA_E_INVAL;
+
+	if (wc->opcode != IBV_WC_RECV || !(wc->wc_flags & IBV_WC_WITH_IMM) ||
+			wc->wr_id != (uint64_t)frag || wc->byte_len > frag->frag_size)
+		return RPMA_E_INVAL;
+
+	uint32_t imm = ntohl(wc->imm_data);
+	uint32_t seq = imm & RPMA_FRAG_IMM_SEQ_MASK;
+	bool in_seq = (seq == (frag->rx_seq & RPMA_FRAG_IMM_SEQ_MASK));
+	bool aborted = (imm & RPMA_FRAG_IMM_ABORT) != 0;
+	bool last = (imm & RPMA_FRAG_IMM_LAST) != 0;
+
+	size_t offset = (size_t)frag->rx_next * frag->frag_size;
+	bool fits = in_seq && !aborted && !frag->rx_discard &&
+			frag->rx_len + wc->byte_len <= dst_size;
+
+	if (fits)
+		memcpy((char *)dst + frag->rx_len, frag->rx + offset, wc->byte_len);
+
+	/*
+	 * The buffer is reused right after its contents is copied out. The receive is consumed
+	 * whatever happens next, so the next completion always lands in the next buffer.
+	 */
+	int ret = rpma_recv(frag->conn, frag->rx_mr, offset, frag->frag_size, frag);
+	frag->rx_next = (frag->rx_next + 1) % frag->depth;
+	*done = false;
+
+	if (!in_seq) {
+		/* resynchronize with the sender and drop the rest of the message */
+		RPMA_LOG_ERROR("unexpected fragment: %" PRIu32 " (expected %" PRIu32 ")",
+			seq, frag->rx_seq & RPMA_FRAG_IMM_SEQ_MASK);
+		frag->rx_seq = seq + 1;
+		frag->rx_len = 0;
+		frag->rx_discard = !last && !aborted;
+		return ret ? ret : RPMA_E_INVAL;
+	}
+
+	frag->rx_seq++;
+
+	if (aborted || !fits) {
+		/* report the failed message once and drop the rest of it */
+		bool reported = frag->rx_discard;
+		frag->rx_discard = !last && !aborted;
+		frag->rx_len = 0;
+		if (ret || reported)
+			return ret;
+
+		if (aborted)
+			RPMA_LOG_ERROR("the message has been aborted by the sender");
+		else
+			RPMA_LOG_ERROR("the message does not fit into the destination: %zu",
+				dst_size);
+		return RPMA_E_INVAL;
+	}
+
+	frag->rx_len += wc->byte_len;
+	*done = last;
+	*len = frag->rx_len;
+	if (last)
+		frag->rx_len = 0;
+
+	return ret;
+}
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * hook.c -- librpma user hooks on posting and obtaining the completions
+ *
+ * The hooks set by rpma_hook_set() are kept in an immutable structure, so a thread calling
+ * them always sees the post hook, the completion hook and their argument set together.
+ * The replaced structures are not freed until the library is unloaded because another
+ * thread may be still calling their hooks. The sampling counters are thread-local,
+ * so the threads posting and polling do not share any cache line when sampling.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "debug.h"
+#include "hook.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+struct hook {
+	rpma_hook_post_function *post;
+	rpma_hook_completion_function *completion;
+	void *arg;
+	uint32_t sampling_rate;
+	struct hook *retired_next; /* the list of the replaced hooks */
+};
+
+atomic_bool Rpma_hook_enabled;
+
+static struct {
+	atomic_flag lock; /* protects retired */
+	_Atomic(struct hook *) current;
+	struct hook *retired;
+} Hook = {ATOMIC_FLAG_INIT, NULL, NULL};
+
+/* the operations (completions) left to the next sampled one in this thread */
+static __thread uint32_t Hook_post_countdown;
+static __thread uint32_t Hook_completion_countdown;
+
+/*
+ * hook_lock -- acquire the list of the replaced hooks
+ */
+static void
+hook_lock(void)
+{
+	while (atomic_flag_test_and_set_explicit(&Hook.lock, memory_order_acquire))
+		;
+}
+
+/*
+ * hook_unlock -- release the list of the replaced hooks
+ */
+static void
+hook_unlock(void)
+{
+	atomic_flag_clear_explicit(&Hook.lock, memory_order_release);
+}
+
+/*
+ * hook_sample -- count the operation down and check if it is the sampled one
+ * (every sampling_rate-th one)
+ */
+static bool
+hook_sample(uint32_t *countdown, uint32_t sampling_rate)
+{
+	/* the sampling rate may have been lowered in the meantime */
+	if (*countdown == 0 || *countdown > sampling_rate)
+		*countdown = sampling_rate;
+
+	return --(*countdown) == 0;
+}
+
+/*
+ * hook_replace -- replace the current hooks and retire the old ones
+ */
+static void
+hook_replace(struct hook *hook)
+{
+	atomic_store_explicit(&Rpma_hook_enabled, false, memory_order_relaxed);
+
+	hook_lock();
+	struct hook *old = atomic_exchange_explicit(&Hook.current, hook, memory_order_acq_rel);
+	if (old) {
+		old->retired_next = Hook.retired;
+		Hook.retired = old;
+	}
+	hook_unlock();
+
+	if (hook)
+		atomic_store_explicit(&Rpma_hook_enabled, true, memory_order_relaxed);
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_hook_post -- call the post hook if the operation posted successfully is sampled
+ */
+void
+rpma_hook_post(enum rpma_hook_op op, uint32_t qp_num, size_t len, const void *op_context)
+{
+	struct hook *hook = atomic_load_explicit(&Hook.current, memory_order_acquire);
+	if (hook == NULL || hook->post == NULL)
+		return;
+
+	if (hook_sample(&Hook_post_countdown, hook->sampling_rate))
+		hook->post(op, qp_num, len, op_context, hook->arg);
+}
+
+/*
+ * rpma_hook_completion -- call the completion hook for the sampled completions
+ */
+void
+rpma_hook_completion(const struct ibv_wc *wc, int num)
+{
+	struct hook *hook = atomic_load_explicit(&Hook.current, memory_order_acquire);
+	if (hook == NULL || hook->completion == NULL)
+		return;
+
+	for (int i = 0; i < num; i++) {
+		if (hook_sample(&Hook_completion_countdown, hook->sampling_rate))
+			hook->completion(&wc[i], hook->arg);
+	}
+}
+
+/*
+ * rpma_hook_fini -- unset the hooks and free all of them
+ */
+void
+rpma_hook_fini(void)
+{
+	hook_replace(NULL);
+
+	hook_lock();
+	while (Hook.retired) {
+		struct hook *next = Hook.retired->retired_next;
+		free(Hook.retired);
+		Hook.retired = next;
+	}
+	hook_unlock();
+}
+
+/* public librpma API */
+
+/*
+ * rpma_hook_set -- set (or unset) the hooks called on posting and obtaining the completions
+ */
+int
+rpma_hook_set(rpma_hook_post_function *post_hook,
+		rpma_hook_completion_function *completion_hook, void *arg,
+		uint32_t sampling_rate)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	if (post_hook == NULL && completion_hook == NULL) {
+		hook_replace(NULL);
+		return 0;
+	}
+
+	if (sampling_rate == 0)
+		return RPMA_E_INVAL;
+
+	struct hook *hook = malloc(sizeof(*hook));
+	if (hook == NULL)
+		return RPMA_E_NOMEM;
+
+	hook->post = post_hook;
+	hook->completion = completion_hook;
+	hook->arg = arg;
+	hook->sampling_rate = sampling_rate;
+	hook->retired_next = NULL;
+
+	hook_replace(hook);
+
+	return 0;
+}
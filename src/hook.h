@@ -0,0 +1,50 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * hook.h -- librpma user hooks internal definitions
+ */
+
+#ifndef LIBRPMA_HOOK_H
+#define LIBRPMA_HOOK_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "librpma.h"
+
+/* true if any hook is set (checked before calling into hook.c on the data path) */
+extern atomic_bool Rpma_hook_enabled;
+
+#define RPMA_HOOK_POST(op, qp_num, len, op_context) \
+	do { \
+		if (atomic_load_explicit(&Rpma_hook_enabled, memory_order_relaxed)) \
+			rpma_hook_post(op, qp_num, len, op_context); \
+	} while (0)
+
+#define RPMA_HOOK_COMPLETION(wc, num) \
+	do { \
+		if (atomic_load_explicit(&Rpma_hook_enabled, memory_order_relaxed)) \
+			rpma_hook_completion(wc, num); \
+	} while (0)
+
+/*
+ * rpma_hook_post -- call the post hook if the operation posted successfully is sampled
+ */
+void rpma_hook_post(enum rpma_hook_op op, uint32_t qp_num, size_t len, const void *op_context);
+
+/*
+ * rpma_hook_completion -- call the completion hook for the sampled completions
+ *
+ * ASSUMPTIONS
+ * - wc != NULL || num == 0
+ */
+void rpma_hook_completion(const struct ibv_wc *wc, int num);
+
+/*
+ * rpma_hook_fini -- unset the hooks and free all of them
+ */
+void rpma_hook_fini(void);
+
+#endif /* LIBRPMA_HOOK_H */
@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * imm_demux.c -- librpma immediate data demultiplexing implementations
+ *
+ * The registered ranges of the immediate data values are kept in an array sorted by their lower
+ * bounds, so the handler of a completion is found with a binary search.
+ */
+
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* the initial capacity of the ranges array */
+#define RPMA_IMM_DEMUX_CAPACITY_INIT 8
+
+/* the maximum number of completions collected at once */
+#define RPMA_IMM_DEMUX_BATCH 32
+
+struct rpma_imm_range {
+	uint32_t imm_min;
+	uint32_t imm_max;
+	rpma_imm_handler *handler;
+	void *arg;
+};
+
+struct rpma_imm_demux {
+	struct rpma_imm_range *ranges; /* sorted by imm_min, not overlapping */
+	size_t nranges;
+	size_t capacity;
+
+	rpma_imm_handler *default_handler; /* for all other completions */
+	void *default_arg;
+};
+
+/*
+ * imm_demux_find -- find the index of the first range with imm_min greater than imm
+ */
+static size_t
+imm_demux_find(const struct rpma_imm_demux *demux, uint32_t imm)
+{
+	size_t lo = 0;
+	size_t hi = demux->nranges;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (demux->ranges[mid].imm_min <= imm)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+/*
+ * imm_demux_lookup -- find the range the immediate data belongs to
+ */
+static const struct rpma_imm_range *
+imm_demux_lookup(const struct rpma_imm_demux *demux, uint32_t imm)
+{
+	size_t i = imm_demux_find(demux, imm);
+	if (i == 0 || demux->ranges[i - 1].imm_max < imm)
+		return NULL;
+
+	return &demux->ranges[i - 1];
+}
+
+/*
+ * imm_demux_handle -- invoke the handler of the completion
+ */
+static int
+imm_demux_handle(const struct rpma_imm_demux *demux, const struct ibv_wc *wc)
+{
+	rpma_imm_handler *handler = demux->default_handler;
+	void *arg = demux->default_arg;
+	uint32_t imm = 0;
+
+	/* the immediate data is valid only for successful completions */
+	if (wc->status == IBV_WC_SUCCESS && (wc->wc_flags & IBV_WC_WITH_IMM)) {
+		imm = ntohl(wc->imm_data);
+		const struct rpma_imm_range *range = imm_demux_lookup(demux, imm);
+		if (range) {
+			handler = range->handler;
+			arg = range->arg;
+		}
+	}
+
+	if (handler == NULL) {
+		RPMA_LOG_DEBUG("no handler of the completion (wr_id 0x%" PRIx64 ", imm 0x%" PRIx32
+			")", wc->wr_id, imm);
+		return 0;
+	}
+
+	return handler(wc, imm, arg);
+}
+
+/* public librpma API */
+
+/*
+ * rpma_imm_demux_new -- create a new immediate data demultiplexer
+ */
+int
+rpma_imm_demux_new(struct rpma_imm_demux **demux_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (demux_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	struct rpma_imm_demux *demux = malloc(sizeof(*demux));
+	if (demux == NULL)
+		return RPMA_E_NOMEM;
+
+	struct rpma_imm_range *ranges = malloc(RPMA_IMM_DEMUX_CAPACITY_INIT * sizeof(*ranges));
+	if (ranges == NULL) {
+		free(demux);
+		return RPMA_E_NOMEM;
+	}
+
+	memset(demux, 0, sizeof(*demux));
+	demux->ranges = ranges;
+	demux->capacity = RPMA_IMM_DEMUX_CAPACITY_INIT;
+
+	*demux_ptr = demux;
+
+	return 0;
+}
+
+/*
+ * rpma_imm_demux_delete -- delete the immediate data demultiplexer
+ */
+int
+rpma_imm_demux_delete(struct rpma_imm_demux **demux_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (demux_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_imm_demux *demux = *demux_ptr;
+	if (demux == NULL)
+		return 0;
+
+	free(demux->ranges);
+	free(demux);
+	*demux_ptr = NULL;
+
+	return 0;
+}
+
+/*
+ * rpma_imm_demux_register -- register the handler of the range of the immediate data values
+ */
+int
+rpma_imm_demux_register(struct rpma_imm_demux *demux, uint32_t imm_min, uint32_t imm_max,
+		rpma_imm_handler *handler, void *arg)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (demux == NULL || handler == NULL || imm_min > imm_max)
+		return RPMA_E_INVAL;
+
+	/* the new range has to end before the next range and start after the previous one */
+	size_t i = imm_demux_find(demux, imm_min);
+	if ((i > 0 && demux->ranges[i - 1].imm_max >= imm_min) ||
+			(i < demux->nranges && demux->ranges[i].imm_min <= imm_max)) {
+		RPMA_LOG_ERROR("the range 0x%" PRIx32 "-0x%" PRIx32
+			" overlaps a registered one", imm_min, imm_max);
+		return RPMA_E_INVAL;
+	}
+
+	if (demux->nranges == demux->capacity) {
+		size_t capacity = 2 * demux->capacity;
+		struct rpma_imm_range *ranges = malloc(capacity * sizeof(*ranges));
+		if (ranges == NULL)
+			return RPMA_E_NOMEM;
+
+		memcpy(ranges, demux->ranges, demux->nranges * sizeof(*ranges));
+		free(demux->ranges);
+		demux->ranges = ranges;
+		demux->capacity = capacity;
+	}
+
+	memmove(&demux->ranges[i + 1], &demux->ranges[i],
+		(demux->nranges - i) * sizeof(*demux->ranges));
+	demux->ranges[i].imm_min = imm_min;
+	demux->ranges[i].imm_max = imm_max;
+	demux->ranges[i].handler = handler;
+	demux->ranges[i].arg = arg;
+	demux->nranges++;
+
+	return 0;
+}
+
+/*
+ * rpma_imm_demux_unregister -- unregister the handler of the range starting at imm_min
+ */
+int
+rpma_imm_demux_unregister(struct rpma_imm_demux *demux, uint32_t imm_min)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (demux == NULL)
+		return RPMA_E_INVAL;
+
+	size_t i = imm_demux_find(demux, imm_min);
+	if (i == 0 || demux->ranges[i - 1].imm_min != imm_min)
+		return RPMA_E_INVAL;
+
+	memmove(&demux->ranges[i - 1], &demux->ranges[i],
+		(demux->nranges - i) * sizeof(*demux->ranges));
+	demux->nranges--;
+
+	return 0;
+}
+
+/*
+ * rpma_imm_demux_set_default -- set the handler of all other completions
+ */
+int
+rpma_imm_demux_set_default(struct rpma_imm_demux *demux, rpma_imm_handler *handler, void *arg)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (demux == NULL)
+		return RPMA_E_INVAL;
+
+	demux->default_handler = handler;
+	demux->default_arg = arg;
+
+	return 0;
+}
+
+/*
+ * rpma_imm_demux_dispatch -- collect the completions from the CQ and invoke their handlers
+ */
+int
+rpma_imm_demux_dispatch(struct rpma_imm_demux *demux, struct rpma_cq *cq, int max_entries,
+		int *num_dispatched)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (demux == NULL || cq == NULL || max_entries < 1)
+		return RPMA_E_INVAL;
+
+	struct ibv_wc wc[RPMA_IMM_DEMUX_BATCH];
+	int dispatched = 0;
+	int ret = 0;
+
+	while (dispatched < max_entries) {
+		int num = max_entries - dispatched;
+		if (num > RPMA_IMM_DEMUX_BATCH)
+			num = RPMA_IMM_DEMUX_BATCH;
+
+		int num_got = 0;
+		ret = rpma_cq_get_wc(cq, num, wc, &num_got);
+		if (ret == RPMA_E_NO_COMPLETION && dispatched > 0) {
+			ret = 0;
+			break;
+		}
+		if (ret)
+			break;
+
+		/* all collected completions are dispatched even if a handler fails */
+		for (int i = 0; i < num_got; i++) {
+			int hret = imm_demux_handle(demux, &wc[i]);
+			if (hret && ret == 0)
+				ret = hret;
+		}
+		dispatched += num_got;
+
+		if (ret || num_got < num)
+			break;
+	}
+
+	if (num_dispatched)
+		*num_dispatched = dispatched;
+
+	return ret;
+}
@@ -192,7 +192,9 @@ extern "C" {
  * - rpma_conn_get_rcq() gets the connection's receive CQ,
  * - rpma_cq_wait() waits for an incoming completion from the specified CQ (main or receive CQ) -
  *   if it succeeds the completion can be collected using rpma_cq_get_wc(),
- * - rpma_cq_get_wc() receives the next available completion of an already posted operation.
+ * - rpma_cq_get_wc() receives the next available completion of an already posted operation,
+ * - rpma_cq_get_wc_conn() receives completions along with the connections they belong to, which is
+ *   useful for a CQ shared by many connections.
  *
  * PEER
  *
@@ -310,6 +312,27 @@ extern "C" {
  * There is an example of the usage of the logging functions:
  * https://github.com/pmem/rpma/tree/main/examples/log
  *
+ * If the library is built with <sys/sdt.h> available (e.g. the systemtap-sdt-dev package is
+ * installed), it contains the USDT (User Statically-Defined Tracing) probes of the "rpma" provider
+ * which can be traced with e.g. bpftrace(8), perf(1) or stap(1) without rebuilding the library.
+ * A probe costs a single nop instruction when no tracer is attached to it. The probes are:
+ *
+ * - read, write, atomic_write, send, recv, flush (qp_num, length, op_context, ret) - an operation
+ *   has been posted (ret is the value returned by ibv_post_send(3)/ibv_post_recv(3));
+ *   rpma_flush(3) fires only the flush probe with the length of the flushed range also when
+ *   the appliance persistency method posts it as an RDMA read,
+ * - srq_recv (srq, length, op_context, ret) - a receive has been posted to the shared RQ,
+ * - completion (cq, wc, num) - rpma_cq_get_wc(3) has obtained num completions stored
+ *   in the wc array of struct ibv_wc (the probe fires once per call, not once per completion),
+ * - cq_wait (cq), cq_wait_done (cq) - rpma_cq_wait(3) starts and stops waiting for a completion,
+ * - conn_event (qp_num, event, ret) - rpma_conn_next_event(3) has obtained a connection event,
+ * - conn_req_connect (qp_num, is_passive), conn_req_connect_done (ret) - rpma_conn_req_connect(3)
+ *   starts and finishes establishing the connection.
+ *
+ * For example, the sizes of the posted writes can be traced with:
+ *
+ *	bpftrace -e 'usdt:/usr/lib/librpma.so:rpma:write { @len = hist(arg1); }'
+ *
  * EXAMPLES
  *
  * See https://github.com/pmem/rpma/tree/main/examples for examples of using the librpma API.
@@ -394,6 +417,72 @@ enum rpma_util_ibv_context_type {
 int rpma_utils_get_ibv_context(const char *addr, enum rpma_util_ibv_context_type type,
 		struct ibv_context **ibv_ctx_ptr);
 
+/** 3
+ * rpma_utils_addr_cache_set_ttl - set the lifetime of the cached addresses and devices
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	int rpma_utils_addr_cache_set_ttl(int ttl_ms);
+ *
+ * DESCRIPTION
+ * rpma_utils_addr_cache_set_ttl() sets the time (in milliseconds) the process-wide address cache
+ * keeps the results of the address translations (rdma_getaddrinfo(3)) done when the connection
+ * requests are created and the endpoints start listening and the RDMA device contexts obtained
+ * using rpma_utils_get_ibv_context(3). Until an entry expires the translation of the same address,
+ * port and side (or the lookup of the same device) is not repeated which makes establishing
+ * many connections to the same address cheaper. The translated addresses are shared by
+ * the objects using them and they are released when the last of them is deleted.
+ * The ttl_ms value of 0 disables the cache and drops all the cached entries. The cache is
+ * disabled by default.
+ *
+ * All the cached entries are dropped when the RDMA_CM_EVENT_DEVICE_REMOVAL event is
+ * received by any connection (see rpma_conn_next_event(3)). The cached entries can be also
+ * dropped explicitly using rpma_utils_addr_cache_invalidate(3).
+ *
+ * RETURN VALUE
+ * The rpma_utils_addr_cache_set_ttl() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_utils_addr_cache_set_ttl() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - ttl_ms < 0
+ *
+ * SEE ALSO
+ * rpma_utils_addr_cache_invalidate(3), rpma_utils_get_ibv_context(3), librpma(7)
+ * and https://pmem.io/rpma/
+ */
+int rpma_utils_addr_cache_set_ttl(int ttl_ms);
+
+/** 3
+ * rpma_utils_addr_cache_invalidate - drop the cached addresses and devices
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct ibv_context;
+ *	int rpma_utils_addr_cache_invalidate(struct ibv_context *ibv_ctx);
+ *
+ * DESCRIPTION
+ * rpma_utils_addr_cache_invalidate() drops from the process-wide address cache
+ * (see rpma_utils_addr_cache_set_ttl(3)) all the cached entries of the RDMA device context
+ * ibv_ctx together with all the cached address translations (as they may lead to the device)
+ * e.g. when the device is being removed. If ibv_ctx is NULL all the cached entries are dropped.
+ * The address translations still used by the existing objects are released when the last
+ * of them is deleted.
+ *
+ * RETURN VALUE
+ * The rpma_utils_addr_cache_invalidate() function returns 0. It cannot fail.
+ *
+ * SEE ALSO
+ * rpma_utils_addr_cache_set_ttl(3), rpma_utils_get_ibv_context(3), librpma(7)
+ * and https://pmem.io/rpma/
+ */
+int rpma_utils_addr_cache_invalidate(struct ibv_context *ibv_ctx);
+
 /** 3
  * rpma_utils_ibv_context_is_odp_capable - is On-Demand Paging supported
  *
@@ -658,7 +747,8 @@ struct rpma_peer;
  *	int rpma_peer_new(struct ibv_context *ibv_ctx, struct rpma_peer **peer_ptr);
  *
  * DESCRIPTION
- * rpma_peer_new() creates a new peer object.
+ * rpma_peer_new() creates a new peer object. The capabilities of the RDMA device are queried
+ * once when the peer is created and they are available via rpma_peer_get_caps(3).
  *
  * RETURN VALUE
  * The rpma_peer_new() function returns 0 on success or a negative error code on failure.
@@ -668,6 +758,7 @@ struct rpma_peer;
  * rpma_peer_new() can fail with the following errors:
  *
  * - RPMA_E_INVAL - ibv_ctx or peer_ptr is NULL
+ * - RPMA_E_PROVIDER - querying the device capabilities (ibv_query_device_ex()) failed
  * - RPMA_E_NOMEM - creating a verbs protection domain failed with ENOMEM.
  * - RPMA_E_PROVIDER - creating a verbs protection domain failed with error other than ENOMEM.
  * - RPMA_E_UNKNOWN - creating a verbs protection domain failed without error value.
@@ -710,6 +801,121 @@ int rpma_peer_new(struct ibv_context *ibv_ctx, struct rpma_peer **peer_ptr);
  */
 int rpma_peer_delete(struct rpma_peer **peer_ptr);
 
+/** 3
+ * rpma_peer_set_res_pool_size - set the size of the pool of recycled connection resources
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	int rpma_peer_set_res_pool_size(struct rpma_peer *peer, int size);
+ *
+ * DESCRIPTION
+ * rpma_peer_set_res_pool_size() makes the peer keep the resources of up to size deleted
+ * connections so the next connections can reuse them instead of creating them from scratch.
+ * It shortens the time of a reconnect considerably. The kept resources are:
+ *
+ * - the completion queues (CQ and RCQ) together with their completion channel,
+ *   which are drained and rearmed before they are kept and
+ * - the flushing object including its registered memory region (used when the native
+ *   flush is not supported).
+ *
+ * The CQs are reused only by a connection requiring the same kind of a completion channel
+ * (shared or not), the same presence of a receive CQ and not bigger sizes of CQs.
+ * The QPs are not recycled since a QP is bound to the CM ID of its connection.
+ *
+ * The size of 0 (the default) disables the recycling. Setting a new size deletes all
+ * the resources kept so far.
+ *
+ * The size can be set only when the peer has no connections (before the first one is created
+ * or after all of them have been deleted), since a connection returns its resources
+ * to the pool when it is deleted. It must not be called concurrently with creating
+ * the connection requests (see rpma_conn_req_new(3) and rpma_ep_next_conn_req(3)) of the peer.
+ *
+ * RETURN VALUE
+ * The rpma_peer_set_res_pool_size() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_peer_set_res_pool_size() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer is NULL or size < 0
+ * - RPMA_E_INVAL - the peer has live connections
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - deleting one of the resources kept so far failed
+ *
+ * SEE ALSO
+ * rpma_conn_delete(3), rpma_conn_req_new(3), rpma_peer_new(3), librpma(7)
+ * and https://pmem.io/rpma/
+ */
+int rpma_peer_set_res_pool_size(struct rpma_peer *peer, int size);
+
+struct rpma_peer_caps {
+	uint32_t max_qp_wr;
+	uint32_t max_sge;
+	int max_cqe;
+	uint32_t max_srq_wr;
+	int is_atomic_supported;
+	int is_native_atomic_write_supported;
+	int is_native_flush_supported;
+	int is_odp_supported;
+};
+
+/** 3
+ * rpma_peer_get_caps - get the capabilities of the peer's RDMA device
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_peer_caps {
+ *		uint32_t max_qp_wr;
+ *		uint32_t max_sge;
+ *		int max_cqe;
+ *		uint32_t max_srq_wr;
+ *		int is_atomic_supported;
+ *		int is_native_atomic_write_supported;
+ *		int is_native_flush_supported;
+ *		int is_odp_supported;
+ *	};
+ *	int rpma_peer_get_caps(const struct rpma_peer *peer, struct rpma_peer_caps *caps);
+ *
+ * DESCRIPTION
+ * rpma_peer_get_caps() obtains the snapshot of the RDMA device capabilities taken once
+ * by rpma_peer_new(3):
+ * - max_qp_wr - the maximum number of outstanding work requests on any send or receive queue
+ * - max_sge - the maximum number of scatter/gather elements in any work request
+ * - max_cqe - the maximum number of entries of any completion queue
+ * - max_srq_wr - the maximum number of outstanding work requests on any shared receive queue
+ * - is_atomic_supported - non-zero if the atomic operations are supported
+ * - is_native_atomic_write_supported - non-zero if the native atomic write is supported
+ * - is_native_flush_supported - non-zero if the native flush is supported
+ * - is_odp_supported - non-zero if On-Demand Paging is supported
+ *
+ * The sizes of the queues and the completion queues requested by the connection
+ * configurations (see rpma_conn_cfg_set_sq_size(3), rpma_conn_cfg_set_rq_size(3),
+ * rpma_conn_cfg_set_cq_size(3) and rpma_conn_cfg_set_rcq_size(3)) and the shared RQ
+ * configurations (see rpma_srq_cfg_set_rq_size(3) and rpma_srq_cfg_set_rcq_size(3)) are
+ * clamped to the above limits so creating the connections does not fail when the limits
+ * of the device are exceeded.
+ * A limit equal 0 is not reported by the device and it is not applied.
+ *
+ * RETURN VALUE
+ * The rpma_peer_get_caps() function returns 0 on success or a negative error code on failure.
+ * rpma_peer_get_caps() does not set *caps value on failure.
+ *
+ * ERRORS
+ * rpma_peer_get_caps() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - peer or caps is NULL
+ *
+ * SEE ALSO
+ * rpma_peer_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_peer_get_caps(const struct rpma_peer *peer, struct rpma_peer_caps *caps);
+
 /* memory-related structures */
 
 struct rpma_mr_local;
@@ -1541,6 +1747,72 @@ int rpma_conn_cfg_set_srq(struct rpma_conn_cfg *cfg, struct rpma_srq *srq);
  */
 int rpma_conn_cfg_get_srq(const struct rpma_conn_cfg *cfg, struct rpma_srq **srq_ptr);
 
+/* shared CM event channel */
+
+struct rpma_conn_evch;
+
+/** 3
+ * rpma_conn_cfg_set_evch - set a shared CM event channel for the connection
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_evch;
+ *	int rpma_conn_cfg_set_evch(struct rpma_conn_cfg *cfg, struct rpma_conn_evch *evch);
+ *
+ * DESCRIPTION
+ * rpma_conn_cfg_set_evch() sets a CM event channel shared by many connections. The connection
+ * created with this configuration does not create its own CM event channel. Its events have
+ * to be obtained using rpma_conn_evch_next_event(3) instead of rpma_conn_next_event(3).
+ * If this function is not called, the evch has the default value (NULL) set by
+ * rpma_conn_cfg_new(3) and every connection creates its own CM event channel.
+ *
+ * RETURN VALUE
+ * The rpma_conn_cfg_set_evch() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_conn_cfg_set_evch() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg or evch is NULL
+ *
+ * SEE ALSO
+ * rpma_conn_cfg_new(3), rpma_conn_cfg_get_evch(3), rpma_conn_evch_new(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_conn_cfg_set_evch(struct rpma_conn_cfg *cfg, struct rpma_conn_evch *evch);
+
+/** 3
+ * rpma_conn_cfg_get_evch - get the shared CM event channel from the connection configuration
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_evch;
+ *	int rpma_conn_cfg_get_evch(const struct rpma_conn_cfg *cfg,
+ *			struct rpma_conn_evch **evch_ptr);
+ *
+ * DESCRIPTION
+ * rpma_conn_cfg_get_evch() gets the shared CM event channel from the connection configuration.
+ *
+ * RETURN VALUE
+ * The rpma_conn_cfg_get_evch() function returns 0 on success or a negative error code
+ * on failure. rpma_conn_cfg_get_evch() does not set *evch_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_conn_cfg_get_evch() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg or evch_ptr is NULL
+ *
+ * SEE ALSO
+ * rpma_conn_cfg_new(3), rpma_conn_cfg_set_evch(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_conn_cfg_get_evch(const struct rpma_conn_cfg *cfg, struct rpma_conn_evch **evch_ptr);
+
 /* connection */
 
 struct rpma_conn;
@@ -1557,6 +1829,8 @@ struct rpma_conn;
  *
  * DESCRIPTION
  * rpma_conn_get_event_fd() gets an event file descriptor of the connection.
+ * If the connection shares its CM event channel (see rpma_conn_cfg_set_evch(3)),
+ * it is the file descriptor of the shared CM event channel.
  *
  * RETURN VALUE
  * The rpma_conn_get_event_fd() function returns 0 on success or a negative error code on failure.
@@ -1617,7 +1891,8 @@ enum rpma_conn_event {
  * ERRORS
  * rpma_conn_next_event() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn or event is NULL
+ * - RPMA_E_INVAL - conn or event is NULL or the connection shares its CM event channel
+ *   (see rpma_conn_cfg_set_evch(3))
  * - RPMA_E_UNKNOWN - unexpected event
  * - RPMA_E_PROVIDER - rdma_get_cm_event() or rdma_ack_cm_event() failed
  * - RPMA_E_NOMEM - out of memory
@@ -1758,1212 +2033,3920 @@ int rpma_conn_apply_remote_peer_cfg(struct rpma_conn *conn, const struct rpma_pe
  */
 int rpma_conn_get_qp_num(const struct rpma_conn *conn, uint32_t *qp_num);
 
-struct rpma_cq;
+struct rpma_conn_stats {
+	uint64_t reads;
+	uint64_t writes;
+	uint64_t atomic_writes;
+	uint64_t flushes;
+	uint64_t sends;
+	uint64_t recvs;
+	uint64_t read_bytes;
+	uint64_t write_bytes;
+	uint64_t send_bytes;
+	uint64_t recv_bytes;
+	uint64_t post_errors;
+	uint64_t sq_full;
+	uint64_t rq_full;
+	uint64_t completions;
+	uint64_t completion_errors;
+};
 
 /** 3
- * rpma_conn_get_cq - get the connection's main CQ
+ * rpma_conn_get_stats - get the operation statistics of the connection
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
  *	struct rpma_conn;
- *	struct rpma_cq;
- *	int rpma_conn_get_cq(const struct rpma_conn *conn, struct rpma_cq **cq_ptr);
+ *	struct rpma_conn_stats {
+ *		uint64_t reads;
+ *		uint64_t writes;
+ *		uint64_t atomic_writes;
+ *		uint64_t flushes;
+ *		uint64_t sends;
+ *		uint64_t recvs;
+ *		uint64_t read_bytes;
+ *		uint64_t write_bytes;
+ *		uint64_t send_bytes;
+ *		uint64_t recv_bytes;
+ *		uint64_t post_errors;
+ *		uint64_t sq_full;
+ *		uint64_t rq_full;
+ *		uint64_t completions;
+ *		uint64_t completion_errors;
+ *	};
+ *	int rpma_conn_get_stats(const struct rpma_conn *conn, struct rpma_conn_stats *stats);
  *
  * DESCRIPTION
- * rpma_conn_get_cq() gets the main CQ from the connection. When the receive CQ is not present
- * the main CQ allows handling all completions within the connection. When the receive CQ
- * is present the main CQ allows handling all completions except rpma_recv(3) completions within
- * the connection. Please see rpma_conn_get_rcq(3) for details about the receive CQ.
+ * rpma_conn_get_stats() takes a snapshot of the counters of the operations posted
+ * on the connection since it has been established:
+ * - reads, writes, atomic_writes, flushes, sends, recvs - the numbers of the operations
+ *   posted successfully (the writes and the sends include the ones with immediate data)
+ * - read_bytes, write_bytes, send_bytes, recv_bytes - the numbers of bytes requested
+ *   by the above operations (for recvs - the sizes of the posted receive buffers)
+ * - post_errors - the number of the operations which failed to be posted
+ * - sq_full, rq_full - how many of the failed operations hit a full send or receive queue
+ * - completions - the number of the completions obtained from the CQ and the receive CQ
+ *   of the connection by rpma_cq_get_wc(3) (or rpma_cq_get_wc_conn(3))
+ * - completion_errors - how many of the above completions have reported an error
+ *
+ * The counters are updated by all the threads using the connection and they can be read
+ * at any time without stopping them.
  *
  * RETURN VALUE
- * The rpma_conn_get_cq() function returns 0 on success or a negative error code on failure.
- * rpma_conn_get_cq() does not set *cq_ptr value on failure.
+ * The rpma_conn_get_stats() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_get_stats() does not set *stats value on failure.
  *
  * ERRORS
- * rpma_conn_get_cq() can fail with the following error:
+ * rpma_conn_get_stats() can fail with the following error:
  *
- * - RPMA_E_INVAL - conn or cq_ptr is NULL
+ * - RPMA_E_INVAL - conn or stats is NULL
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_conn_get_rcq(3), rpma_cq_wait(3), rpma_cq_get_wc(3),
- * rpma_cq_get_fd(3), rpma_recv(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_peer_get_stats(3), rpma_read(3), rpma_write(3), rpma_flush(3), rpma_send(3),
+ * rpma_recv(3), rpma_cq_get_wc(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_get_cq(const struct rpma_conn *conn, struct rpma_cq **cq_ptr);
+int rpma_conn_get_stats(const struct rpma_conn *conn, struct rpma_conn_stats *stats);
 
 /** 3
- * rpma_conn_get_rcq -- get the connection's receive CQ
+ * rpma_peer_get_stats - get the operation statistics of all the connections of the peer
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_cq;
- *	int rpma_conn_get_rcq(const struct rpma_conn *conn, struct rpma_cq **rcq_ptr);
+ *	struct rpma_peer;
+ *	struct rpma_conn_stats;
+ *	int rpma_peer_get_stats(struct rpma_peer *peer, struct rpma_conn_stats *stats);
  *
  * DESCRIPTION
- * rpma_conn_get_rcq() gets the receive CQ from the connection. The receive CQ allows handling all
- * rpma_recv(3) completions within the connection. It allows separating rpma_recv(3) completions
- * processing path from all other completions. The receive CQ is created only if the receive CQ
- * size in the provided connection configuration is greater than 0. When the receive CQ does not
- * exist for the given connection the *rcq_ptr == NULL.
+ * rpma_peer_get_stats() takes a snapshot of the sums of the counters (see
+ * rpma_conn_get_stats(3)) of all the connections created from the peer including
+ * the already deleted ones.
  *
  * RETURN VALUE
- * The rpma_conn_get_rcq() function returns 0 on success or a negative error code on failure.
- * rpma_conn_get_rcq() does not set *rcq_ptr value on failure.
+ * The rpma_peer_get_stats() function returns 0 on success or a negative error code on failure.
+ * rpma_peer_get_stats() does not set *stats value on failure.
  *
  * ERRORS
- * rpma_conn_get_rcq() can fail with the following error:
+ * rpma_peer_get_stats() can fail with the following error:
  *
- * - RPMA_E_INVAL - conn or rcq_ptr is NULL
+ * - RPMA_E_INVAL - peer or stats is NULL
  *
  * SEE ALSO
- * rpma_conn_cfg_set_rcq_size(3), rpma_conn_req_connect(3), rpma_conn_get_cq(3), rpma_cq_wait(3),
- * rpma_cq_get_wc(3), rpma_cq_get_fd(3), rpma_recv(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_get_stats(3), rpma_peer_new(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_get_rcq(const struct rpma_conn *conn, struct rpma_cq **rcq_ptr);
+int rpma_peer_get_stats(struct rpma_peer *peer, struct rpma_conn_stats *stats);
+
+enum rpma_latency_op {
+	RPMA_LATENCY_READ,
+	RPMA_LATENCY_WRITE,
+	RPMA_LATENCY_ATOMIC_WRITE,
+	RPMA_LATENCY_FLUSH,
+	RPMA_LATENCY_SEND,
+	RPMA_LATENCY_OP_NUM
+};
+
+struct rpma_latency_stats {
+	uint64_t count;
+	uint64_t min_ns;
+	uint64_t mean_ns;
+	uint64_t p50_ns;
+	uint64_t p99_ns;
+	uint64_t p999_ns;
+	uint64_t max_ns;
+};
 
 /** 3
- * rpma_conn_disconnect - tear the connection down
+ * rpma_latency_enable - start measuring the latency of the operations
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	int rpma_conn_disconnect(struct rpma_conn *conn);
+ *	int rpma_latency_enable(void);
  *
  * DESCRIPTION
- * rpma_conn_disconnect() tears the connection down.
+ * rpma_latency_enable() makes the library measure the time from posting an operation
+ * to obtaining its completion by rpma_cq_get_wc(3) (or rpma_cq_get_wc_conn(3)) for all
+ * the operations posted with RPMA_F_COMPLETION_ALWAYS from now on by rpma_read(3),
+ * rpma_write(3), rpma_write_with_imm(3), rpma_atomic_write(3), rpma_flush(3), rpma_send(3)
+ * and rpma_send_with_imm(3). The latencies are recorded into a histogram per operation type
+ * read by rpma_latency_get_stats(3).
+ *
+ * The completion is matched with the operation by the op_context of the operation,
+ * so an operation posted before the measuring has been enabled is not measured unless
+ * its op_context is the same as the one of the operation measured next.
+ *
+ * The queue of the operations being measured of every connection is allocated
+ * by rpma_latency_enable() (or when the connection is established while the measuring is
+ * enabled) up to the depth of the send queue of the connection. The operations posted while
+ * the queue is full are not measured.
+ *
+ * The measuring stops on a connection which has obtained a completion with an error
+ * (the QP of the connection is in the error state then) and it is resumed
+ * by the next rpma_latency_enable() call.
  *
- * - It may initiate disconnecting the connection. In this case, the end of disconnecting is
- *   signalled by the RPMA_CONN_CLOSED event via rpma_conn_next_event() or
- * - It may be called after receiving the RPMA_CONN_CLOSED event. In this case, the disconnection
- *   is done when rpma_conn_disconnect() returns with success.
+ * NOTE
+ * Measuring takes a spinlock of the connection for a moment and two clock_gettime(3) calls
+ * per operation. The spinlock is not held across posting the operation.
+ * When it is disabled the cost is one relaxed atomic load per operation.
  *
  * RETURN VALUE
- * The rpma_conn_disconnect() function returns 0 on success or a negative error code on failure.
+ * The rpma_latency_enable() function returns 0 on success or a negative error code
+ * on failure.
  *
  * ERRORS
- * rpma_conn_disconnect() can fail with the following errors:
+ * rpma_latency_enable() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn is NULL
- * - RPMA_E_PROVIDER - rdma_disconnect() failed
+ * - RPMA_E_PROVIDER - ibv_query_qp(3) failed
+ * - RPMA_E_NOMEM - out of memory
  *
  * SEE ALSO
- * rpma_conn_delete(3), rpma_conn_next_event(3), rpma_conn_req_connect(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_latency_disable(3), rpma_latency_get_stats(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_disconnect(struct rpma_conn *conn);
+int rpma_latency_enable(void);
 
 /** 3
- * rpma_conn_delete - delete already closed connection
+ * rpma_latency_disable - stop measuring the latency of the operations
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	int rpma_conn_delete(struct rpma_conn **conn_ptr);
+ *	int rpma_latency_disable(void);
  *
  * DESCRIPTION
- * rpma_conn_delete() deletes already closed connection.
+ * rpma_latency_disable() makes the library stop measuring the latency of the operations
+ * posted from now on. The operations already measured are recorded when they complete.
+ * The histograms are kept.
  *
  * RETURN VALUE
- * The rpma_conn_delete() function returns 0 on success or a negative error code on failure.
- * rpma_conn_delete() sets *conn_ptr value to NULL on success and on failure.
- *
- * ERRORS
- * rpma_conn_delete() can fail with the following errors:
- * - RPMA_E_INVAL - conn_ptr is NULL or munmap() failed
- * - RPMA_E_PROVIDER - ibv_destroy_cq() or rdma_destroy_id() failed
+ * The rpma_latency_disable() function returns 0.
  *
  * SEE ALSO
- * rpma_conn_disconnect(3), rpma_conn_req_connect(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_latency_enable(3), rpma_latency_get_stats(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_delete(struct rpma_conn **conn_ptr);
-
-/* incoming / outgoing connection request */
-
-struct rpma_conn_req;
+int rpma_latency_disable(void);
 
 /** 3
- * rpma_conn_req_new - create a new outgoing connection request object
+ * rpma_latency_get_stats - get a snapshot of the latency histogram of the operation type
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_peer;
- *	struct rpma_conn_cfg;
- *	struct rpma_conn_req;
- *	int rpma_conn_req_new(struct rpma_peer *peer, const char *addr, const char *port,
- *			const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
+ *	enum rpma_latency_op {
+ *		RPMA_LATENCY_READ,
+ *		RPMA_LATENCY_WRITE,
+ *		RPMA_LATENCY_ATOMIC_WRITE,
+ *		RPMA_LATENCY_FLUSH,
+ *		RPMA_LATENCY_SEND,
+ *		RPMA_LATENCY_OP_NUM
+ *	};
+ *
+ *	struct rpma_latency_stats {
+ *		uint64_t count;
+ *		uint64_t min_ns;
+ *		uint64_t mean_ns;
+ *		uint64_t p50_ns;
+ *		uint64_t p99_ns;
+ *		uint64_t p999_ns;
+ *		uint64_t max_ns;
+ *	};
+ *
+ *	int rpma_latency_get_stats(enum rpma_latency_op op, bool reset,
+ *			struct rpma_latency_stats *stats);
  *
  * DESCRIPTION
- * rpma_conn_req_new() creates a new outgoing connection request object using reliable,
- * connection-oriented and message-based (RDMA_PS_TCP) QP communication.
+ * rpma_latency_get_stats() takes a snapshot of the histogram of the latencies (in nanoseconds)
+ * of the operations of the given type measured since the histogram has been reset last time
+ * (see rpma_latency_enable(3)):
+ * - count - the number of the operations
+ * - min_ns, mean_ns, max_ns - the minimum, the mean and the maximum latency
+ * - p50_ns, p99_ns, p999_ns - the latency not exceeded by 50%, 99% and 99.9%
+ *   of the operations
+ *
+ * The histogram is log-linear: the percentiles are exact up to 31 nanoseconds and above it
+ * they are rounded up by less than 6.25%. The writes and the sends include the ones
+ * with immediate data.
+ *
+ * If reset is true, the histogram is reset at the same time, so every operation measured
+ * in the meantime is counted either in this snapshot or in the next one. All the fields
+ * are 0 if no operation has been measured.
  *
  * RETURN VALUE
- * The rpma_conn_req_new() function returns 0 on success or a negative error code on failure.
- * rpma_conn_req_new() does not set *req_ptr value on failure. If cfg is NULL, then the default
- * values are used
- * - see rpma_conn_cfg_new(3) for more details.
+ * The rpma_latency_get_stats() function returns 0 on success or a negative error code
+ * on failure. rpma_latency_get_stats() does not set *stats value on failure.
  *
  * ERRORS
- * rpma_conn_req_new() can fail with the following errors:
+ * rpma_latency_get_stats() can fail with the following error:
  *
- * - RPMA_E_INVAL - peer, addr, port or req_ptr is NULL
- * - RPMA_E_NOMEM - out of memory
- * - RPMA_E_PROVIDER - rdma_create_id(3), rdma_resolve_addr(3), rdma_resolve_route(3) or
- *   ibv_create_cq(3) failed
+ * - RPMA_E_INVAL - op is not a valid operation type or stats is NULL
  *
  * SEE ALSO
- * rpma_conn_cfg_new(3), rpma_conn_req_connect(3), rpma_conn_req_delete(3), rpma_conn_req_recv(3),
- * rpma_ep_next_conn_req(3), rpma_peer_new(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_latency_enable(3), rpma_conn_get_stats(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_req_new(struct rpma_peer *peer, const char *addr, const char *port,
-		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
+int rpma_latency_get_stats(enum rpma_latency_op op, bool reset,
+		struct rpma_latency_stats *stats);
 
 /** 3
- * rpma_conn_req_delete - delete the connection requests
+ * rpma_trace_enable - start recording the timelines of the operations
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn_req;
- *	int rpma_conn_req_delete(struct rpma_conn_req **req_ptr);
+ *	int rpma_trace_enable(size_t max_events);
  *
  * DESCRIPTION
- * rpma_conn_req_delete() deletes the connection requests both incoming and outgoing.
+ * rpma_trace_enable() makes the library record the following events of every connection
+ * into its own in-memory ring of max_events events overwritten in circles (the oldest events
+ * first):
+ * - the posts of the operations by rpma_read(3), rpma_write(3), rpma_write_with_imm(3),
+ *   rpma_atomic_write(3), rpma_flush(3), rpma_send(3), rpma_send_with_imm(3) and rpma_recv(3)
+ *   (from entering the provider to ringing the doorbell),
+ * - the completions obtained by rpma_cq_get_wc(3) (or rpma_cq_get_wc_conn(3)),
+ * - the connection events obtained by rpma_conn_next_event(3) (or rpma_conn_evch_next_event(3)).
+ *
+ * Along with every post and completion the depths of the send and the receive queue of the QP
+ * are recorded: the numbers of the operations posted with RPMA_F_COMPLETION_ALWAYS and
+ * of the receives whose successful completions have not been obtained yet. Only
+ * the operations posted while recording are counted. The opcode of an error completion is
+ * undefined, so the error completions are counted separately and they do not change
+ * the queue depths.
+ *
+ * The events recorded so far (including the ones of the deleted connections) are dropped.
+ * The events of a connection deleted while recording are kept until rpma_trace_enable()
+ * is called again. The recorded events are written to a file by rpma_trace_dump(3).
+ *
+ * NOTE
+ * Recording serializes posting and obtaining the completions of a single connection and it
+ * takes two clock_gettime(3) calls per operation. The connections do not contend with each
+ * other. When it is disabled the cost is one relaxed atomic load per operation and per call
+ * of rpma_cq_get_wc(3).
  *
  * RETURN VALUE
- * The rpma_conn_req_delete() function returns 0 on success or a negative error code on failure.
- * rpma_conn_req_delete() sets *req_ptr value to NULL on success and on failure.
+ * The rpma_trace_enable() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_conn_req_delete() can fail with the following errors:
+ * rpma_trace_enable() can fail with the following errors:
  *
- * - RPMA_E_INVAL - req_ptr is NULL
- * - RPMA_E_PROVIDER
- *	- rdma_destroy_qp(3) or ibv_destroy_cq(3) failed
- *	- rdma_reject(3) or rdma_ack_cm_event(3) failed (passive side only)
- *	- rdma_destroy_id(3) failed (active side only)
+ * - RPMA_E_INVAL - max_events is 0 or too big
+ * - RPMA_E_NOMEM - out of memory
  *
  * SEE ALSO
- * rpma_conn_req_new(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_trace_disable(3), rpma_trace_dump(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_req_delete(struct rpma_conn_req **req_ptr);
+int rpma_trace_enable(size_t max_events);
 
 /** 3
- * rpma_conn_req_connect - initiate processing the connection request
+ * rpma_trace_disable - stop recording the timelines of the operations
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn_req;
- *	struct rpma_conn_private_data;
- *	struct rpma_conn;
- *	int rpma_conn_req_connect(struct rpma_conn_req **req_ptr,
- *			const struct rpma_conn_private_data *pdata, struct rpma_conn **conn_ptr);
+ *	int rpma_trace_disable(void);
  *
  * DESCRIPTION
- * rpma_conn_req_connect() initiates processing the connection requests both incoming and outgoing.
- * The end of processing is signalled by the RPMA_CONN_ESTABLISHED event via
- * rpma_conn_next_event().
+ * rpma_trace_disable() makes the library stop recording the events. The events recorded
+ * so far are kept until tracing is enabled again, so they can be written to a file
+ * by rpma_trace_dump(3).
  *
  * RETURN VALUE
- * The rpma_conn_req_connect() function returns 0 on success or a negative error code on failure.
- * On success, the newly created connection object is stored in *conn_ptr whereas *req_ptr is
- * consumed and set to NULL. On failure, rpma_conn_req_connect() does not set *conn_ptr whereas
- * *req_ptr is consumed and set to NULL.
- *
- * ERRORS
- * rpma_conn_req_connect() can fail with the following errors:
- *
- * - RPMA_E_INVAL - req_ptr, *req_ptr or conn_ptr is NULL
- * - RPMA_E_INVAL - pdata is not NULL whereas pdata->len == 0
- * - RPMA_E_NOMEM - out of memory
- * - RPMA_E_PROVIDER - initiating a connection request failed (active side only)
- * - RPMA_E_PROVIDER - accepting the connection request failed (passive side only)
- * - RPMA_E_PROVIDER - freeing a communication event failed (passive side only)
+ * The rpma_trace_disable() function returns 0.
  *
  * SEE ALSO
- * rpma_conn_apply_remote_peer_cfg(3), rpma_conn_delete(3), rpma_conn_disconnect(3),
- * rpma_conn_get_cq(3), rpma_conn_get_event_fd(3), rpma_conn_get_private_data(3),
- * rpma_conn_get_rcq(3), rpma_conn_next_event(3), rpma_conn_req_new(3), rpma_ep_next_conn_req(3),
- * rpma_flush(3), rpma_read(3), rpma_recv(3), rpma_send(3), rpma_write(3), rpma_atomic_write(3),
- * librpma(7) and https://pmem.io/rpma/
+ * rpma_trace_enable(3), rpma_trace_dump(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_req_connect(struct rpma_conn_req **req_ptr,
-		const struct rpma_conn_private_data *pdata, struct rpma_conn **conn_ptr);
+int rpma_trace_disable(void);
 
 /** 3
- * rpma_conn_get_compl_fd - get a file descriptor of the shared completion channel of the connection
+ * rpma_trace_dump - write the recorded timelines of the operations to a file
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	int fd;
- *	int rpma_conn_get_compl_fd(const struct rpma_conn *conn, int *fd);
+ *	int rpma_trace_dump(const char *path);
  *
  * DESCRIPTION
- * rpma_conn_get_compl_fd() gets a file descriptor of the shared completion channel from
- * the connection.
+ * rpma_trace_dump() creates (or truncates) the file and writes the events of all
+ * the connections recorded since rpma_trace_enable(3) has been called last time (the events
+ * of every connection in the order they have been recorded) in the Chrome trace event format
+ * (JSON) which can be opened e.g. by https://ui.perfetto.dev or chrome://tracing. Every QP has its
+ * own track (named "QP <qp_num>") where:
+ * - a post is a slice named after the operation with the op_context, the length,
+ *   the completion flag and the value returned by the post as its arguments,
+ * - a completion and a connection event are instant events; the arguments of a completion
+ *   are the wr_id, the opcode, the byte_len and the status of its struct ibv_wc (the opcode
+ *   and the byte_len only if the status is IBV_WC_SUCCESS),
+ * - the queue depths are the counter named "QP <qp_num> depth" with the "sq" and "rq" series
+ *   and the "err" series of the number of the error completions.
+ *
+ * The timestamps are the CLOCK_MONOTONIC ones. The events can be dumped while they are
+ * being recorded.
  *
  * RETURN VALUE
- * The rpma_conn_get_compl_fd() function returns 0 on success or a negative error code on failure.
- * rpma_conn_get_compl_fd() does not set *fd value on failure.
+ * The rpma_trace_dump() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_conn_get_compl_fd() can fail with the following errors:
+ * rpma_trace_dump() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn or fd is NULL
- * - RPMA_E_NOT_SHARED_CHNL - the completion event channel is not shared
+ * - RPMA_E_INVAL - path is NULL
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_UNKNOWN - creating or writing the file failed
  *
  * SEE ALSO
- * librpma(7), rpma_conn_req_connect(3) and https://pmem.io/rpma/
+ * rpma_trace_enable(3), rpma_trace_disable(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_get_compl_fd(const struct rpma_conn *conn, int *fd);
+int rpma_trace_dump(const char *path);
 
 /** 3
- * rpma_conn_wait - wait for a completion event on the shared completion channel from CQ or RCQ
+ * rpma_metrics_format - render the counters of the library in the OpenMetrics text format
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_cq
- *	int rpma_conn_wait(struct rpma_conn *conn, int flags, struct rpma_cq **cq, bool *is_rcq)
+ *	int rpma_metrics_format(char *buf, size_t *len);
  *
  * DESCRIPTION
- * rpma_conn_wait() waits for a completion event on the shared completion channel from CQ or RCQ,
- * acks it and returns a CQ that caused the event in the cq argument and a boolean value saying if
- * it is RCQ or not in the is_rcq argument (if is_rcq is not NULL). If rpma_conn_wait() succeeds,
- * then all available completions should be collected from the returned cq using rpma_cq_get_wc(3).
+ * rpma_metrics_format() renders the current values of the counters of the library
+ * in the OpenMetrics (Prometheus) text exposition format into the buffer of *len bytes,
+ * terminates the text with a null byte and stores its length (without the null byte) in *len.
+ * The text can be served as is by an HTTP endpoint scraped by Prometheus.
+ *
+ * The following metric families are labelled with the name of the device and the handle
+ * of the protection domain of the peer (device="<name>",pd="<handle>"):
+ * - rpma_peers - the number of the live peers (without labels),
+ * - rpma_connections - the number of the live connections of the peer,
+ * - rpma_operations_total{op}, rpma_operation_bytes_total{op}, rpma_post_errors_total,
+ *   rpma_queue_full_total{queue}, rpma_completions_total and rpma_completion_errors_total -
+ *   the sums of the statistics of all the connections of the peer (including the ones
+ *   already deleted) as described in rpma_conn_get_stats(3).
+ *
+ * The following metric families are process-wide:
+ * - rpma_cqs - the number of the live completion queues,
+ * - rpma_cq_poll_errors_total - the number of the failed polls of the completion queues
+ *   (e.g. because of a completion queue overrun),
+ * - rpma_rnr_retry_exceeded_total - the number of the completions with the IBV_WC_RNR_RETRY_EXC_ERR
+ *   status,
+ * - rpma_srqs - the number of the live shared receive queues,
+ * - rpma_mrs and rpma_mr_registered_bytes - the number and the total size of the live local
+ *   memory registrations,
+ * - rpma_mr_registrations_total - the number of the local memory registrations.
+ *
+ * The required size of the buffer (including the terminating null byte) can be obtained
+ * by calling rpma_metrics_format() with buf equal NULL and *len equal 0. Since the values
+ * change in the meantime, the buffer should be a bit bigger than that.
  *
  * RETURN VALUE
- * The rpma_conn_wait() function returns 0 on success or a negative error code on failure.
+ * The rpma_metrics_format() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_conn_wait() can fail with the following errors:
+ * rpma_metrics_format() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn or cq are NULL
- * - RPMA_E_NOT_SHARED_CHNL - the completion event channel is not shared
- * - RPMA_E_NO_COMPLETION - ibv_get_cq_event(3) failed
- * - RPMA_E_UNKNOWN - ibv_get_cq_event(3) returned unknown CQ
- * - RPMA_E_PROVIDER - ibv_req_notify_cq(3) failed
+ * - RPMA_E_INVAL - len is NULL or buf is NULL and *len is not 0
+ * - RPMA_E_NOMEM - the buffer is too small; the required size of the buffer is stored in *len
  *
  * SEE ALSO
- * rpma_conn_req_new(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_get_stats(3), rpma_peer_get_stats(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_wait(struct rpma_conn *conn, int flags, struct rpma_cq **cq, bool *is_rcq);
+int rpma_metrics_format(char *buf, size_t *len);
+
+/* user hooks */
+
+enum rpma_hook_op {
+	RPMA_HOOK_READ,
+	RPMA_HOOK_WRITE,
+	RPMA_HOOK_ATOMIC_WRITE,
+	RPMA_HOOK_FLUSH,
+	RPMA_HOOK_SEND,
+	RPMA_HOOK_RECV
+};
+
+/*
+ * the type used for defining the hooks called on posting the operations
+ */
+typedef void rpma_hook_post_function(
+	/* the operation */
+	enum rpma_hook_op op,
+	/* the number of the QP the operation has been posted to (0 for a shared RQ) */
+	uint32_t qp_num,
+	/* the length of the operation */
+	size_t len,
+	/* the op_context of the operation */
+	const void *op_context,
+	/* the argument provided at the registration */
+	void *arg);
+
+/*
+ * the type used for defining the hooks called on obtaining the completions
+ */
+typedef void rpma_hook_completion_function(
+	/* the completion */
+	const struct ibv_wc *wc,
+	/* the argument provided at the registration */
+	void *arg);
 
 /** 3
- * rpma_conn_req_recv - initiate the receive operation
+ * rpma_hook_set - set the hooks called on posting the operations and obtaining the completions
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn_req;
- *	struct rpma_mr_local;
- *	int rpma_conn_req_recv(struct rpma_conn_req *req, struct rpma_mr_local *dst, size_t offset,
- *			size_t len, const void *op_context);
+ *	enum rpma_hook_op {
+ *		RPMA_HOOK_READ,
+ *		RPMA_HOOK_WRITE,
+ *		RPMA_HOOK_ATOMIC_WRITE,
+ *		RPMA_HOOK_FLUSH,
+ *		RPMA_HOOK_SEND,
+ *		RPMA_HOOK_RECV
+ *	};
+ *
+ *	typedef void rpma_hook_post_function(enum rpma_hook_op op, uint32_t qp_num,
+ *			size_t len, const void *op_context, void *arg);
+ *	typedef void rpma_hook_completion_function(const struct ibv_wc *wc, void *arg);
+ *
+ *	int rpma_hook_set(rpma_hook_post_function *post_hook,
+ *			rpma_hook_completion_function *completion_hook, void *arg,
+ *			uint32_t sampling_rate);
  *
  * DESCRIPTION
- * rpma_conn_req_recv() initiates the receive operation. It prepares a buffer for a message sent
- * from other side of the connection. Please see rpma_send(3). This is a variant of rpma_recv(3)
- * which may be used before the connection is established. op_context is returned in the wr_id
- * field of the completion (struct ibv_wc).
+ * rpma_hook_set() sets the hooks called with the arg argument by the threads posting
+ * the operations and obtaining the completions, e.g. to feed a sampling profiler:
+ * - post_hook - called after a work request has been posted successfully with the operation,
+ *   the number of the QP, the length and the op_context of the work request. rpma_flush(3)
+ *   is reported as RPMA_HOOK_FLUSH with the length of the flushed range regardless of
+ *   the persistency method and the receives posted to a shared RQ are reported with qp_num
+ *   equal 0,
+ * - completion_hook - called for a completion obtained by rpma_cq_get_wc(3)
+ *   (or rpma_cq_get_wc_conn(3)); the opcode, the byte_len, the qp_num and the wr_id
+ *   (the op_context) of the operation are the fields of the struct ibv_wc.
+ *
+ * Either of the hooks can be NULL. Only every sampling_rate-th post and completion of every
+ * thread calls the hook (every one if sampling_rate is 1). rpma_hook_set() called with both
+ * the hooks equal NULL unsets the hooks.
+ *
+ * The hooks replace the previous ones. The previous hooks may still be called by the threads
+ * which have started posting or polling before rpma_hook_set() has returned.
+ *
+ * NOTE
+ * The hooks are called in the hot path, so they have to be quick and thread-safe and they must
+ * not call the librpma API. When no hooks are set, the cost is one relaxed atomic load
+ * per operation and per call of rpma_cq_get_wc(3).
  *
  * RETURN VALUE
- * The rpma_conn_req_recv() function returns 0 on success or a negative error code on failure.
+ * The rpma_hook_set() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_conn_req_recv() can fail with the following errors:
+ * rpma_hook_set() can fail with the following errors:
  *
- * - RPMA_E_INVAL - req or src or op_context is NULL
- * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ * - RPMA_E_INVAL - sampling_rate is 0 and any of the hooks is not NULL
+ * - RPMA_E_NOMEM - out of memory
  *
  * SEE ALSO
- * rpma_conn_req_new(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_cq_get_wc(3), rpma_read(3), rpma_write(3), rpma_flush(3), rpma_send(3), rpma_recv(3),
+ * librpma(7) and https://pmem.io/rpma/
  */
-int rpma_conn_req_recv(struct rpma_conn_req *req, struct rpma_mr_local *dst, size_t offset,
-		size_t len, const void *op_context);
-
-/* server-side setup */
-
-struct rpma_ep;
+int rpma_hook_set(rpma_hook_post_function *post_hook,
+		rpma_hook_completion_function *completion_hook, void *arg,
+		uint32_t sampling_rate);
 
 /** 3
- * rpma_ep_listen - create a listening endpoint
+ * rpma_conn_set_context - set the user context of the connection
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_peer;
- *	struct rpma_ep;
- *	int rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port,
- *			struct rpma_ep **ep_ptr);
+ *	struct rpma_conn;
+ *	int rpma_conn_set_context(struct rpma_conn *conn, void *context);
  *
  * DESCRIPTION
- * rpma_ep_listen() creates an endpoint and initiates listening for incoming connections using
- * reliable, connection-oriented and message-based (RDMA_PS_TCP) QP communication.
+ * rpma_conn_set_context() stores an opaque user context in the connection. The library does not
+ * use the context in any way. It can be obtained back by rpma_conn_get_context(3), e.g. for
+ * a connection returned by rpma_cq_get_wc_conn(3) along with its completion. The context of a new
+ * connection is NULL.
  *
  * RETURN VALUE
- * The rpma_ep_listen() function returns 0 on success or a negative error code on failure.
- * rpma_ep_listen() does not set *ep_ptr value on failure.
+ * The rpma_conn_set_context() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_ep_listen() can fail with the following errors:
+ * rpma_conn_set_context() can fail with the following error:
  *
- * - RPMA_E_INVAL - peer, addr, port or ep_ptr is NULL
- * - RPMA_E_PROVIDER - rdma_create_event_channel(3), rdma_create_id(3),
- *   rdma_getaddrinfo(3), rdma_listen(3) failed
- * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_INVAL - conn is NULL
  *
  * SEE ALSO
- * rpma_ep_get_fd(3), rpma_ep_next_conn_req(3), rpma_ep_shutdown(3), rpma_peer_new(3), librpma(7)
- * and https://pmem.io/rpma/
+ * rpma_conn_get_context(3), rpma_cq_get_wc_conn(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port,
-		struct rpma_ep **ep_ptr);
+int rpma_conn_set_context(struct rpma_conn *conn, void *context);
 
 /** 3
- * rpma_ep_shutdown - stop listening and delete the endpoint
+ * rpma_conn_get_context - get the user context of the connection
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_ep;
- *	int rpma_ep_shutdown(struct rpma_ep **ep_ptr);
+ *	struct rpma_conn;
+ *	int rpma_conn_get_context(const struct rpma_conn *conn, void **context_ptr);
  *
  * DESCRIPTION
- * rpma_ep_shutdown() stops listening for incoming connections and deletes the endpoint.
- * The connections established using the endpoint will still exist after deleting the endpoint.
+ * rpma_conn_get_context() obtains the user context stored in the connection
+ * by rpma_conn_set_context(3).
  *
  * RETURN VALUE
- * The rpma_ep_shutdown() function returns 0 on success or a negative error code on failure.
- * rpma_ep_shutdown() does not set *ep_ptr value to NULL on failure.
+ * The rpma_conn_get_context() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_get_context() does not set *context_ptr value on failure.
  *
  * ERRORS
- * rpma_ep_shutdown() can fail with the following errors:
+ * rpma_conn_get_context() can fail with the following error:
  *
- * - RPMA_E_INVAL - ep_ptr is NULL
- * - RPMA_E_PROVIDER - rdma_destroy_id(3) failed
+ * - RPMA_E_INVAL - conn or context_ptr is NULL
  *
  * SEE ALSO
- * rpma_ep_listen(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_set_context(3), rpma_cq_get_wc_conn(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_ep_shutdown(struct rpma_ep **ep_ptr);
+int rpma_conn_get_context(const struct rpma_conn *conn, void **context_ptr);
+
+struct rpma_cq;
 
 /** 3
- * rpma_ep_get_fd - get a file descriptor of the endpoint
+ * rpma_conn_get_cq - get the connection's main CQ
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_ep;
- *	int rpma_ep_get_fd(const struct rpma_ep *ep, int *fd);
+ *	struct rpma_conn;
+ *	struct rpma_cq;
+ *	int rpma_conn_get_cq(const struct rpma_conn *conn, struct rpma_cq **cq_ptr);
  *
  * DESCRIPTION
- * rpma_ep_get_fd() gets the file descriptor of the endpoint.
+ * rpma_conn_get_cq() gets the main CQ from the connection. When the receive CQ is not present
+ * the main CQ allows handling all completions within the connection. When the receive CQ
+ * is present the main CQ allows handling all completions except rpma_recv(3) completions within
+ * the connection. Please see rpma_conn_get_rcq(3) for details about the receive CQ.
  *
  * RETURN VALUE
- * The rpma_ep_get_fd() function returns 0 on success or a negative error code on failure.
- * rpma_ep_get_fd() does not set *fd value on failure.
+ * The rpma_conn_get_cq() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_get_cq() does not set *cq_ptr value on failure.
  *
  * ERRORS
- * rpma_ep_get_fd() can fail with the following error:
+ * rpma_conn_get_cq() can fail with the following error:
  *
- * - RPMA_E_INVAL - ep or fd is NULL
+ * - RPMA_E_INVAL - conn or cq_ptr is NULL
  *
  * SEE ALSO
- * rpma_ep_listen(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_req_connect(3), rpma_conn_get_rcq(3), rpma_cq_wait(3), rpma_cq_get_wc(3),
+ * rpma_cq_get_fd(3), rpma_recv(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_ep_get_fd(const struct rpma_ep *ep, int *fd);
+int rpma_conn_get_cq(const struct rpma_conn *conn, struct rpma_cq **cq_ptr);
 
 /** 3
- * rpma_ep_next_conn_req - obtain an incoming connection request
+ * rpma_conn_get_rcq -- get the connection's receive CQ
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_ep;
- *	struct rpma_conn_cfg;
- *	struct rpma_conn_req;
- *	int rpma_ep_next_conn_req(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
- *			struct rpma_conn_req **req_ptr);
+ *	struct rpma_conn;
+ *	struct rpma_cq;
+ *	int rpma_conn_get_rcq(const struct rpma_conn *conn, struct rpma_cq **rcq_ptr);
  *
  * DESCRIPTION
- * rpma_ep_next_conn_req() obtains the next connection request from the endpoint.
+ * rpma_conn_get_rcq() gets the receive CQ from the connection. The receive CQ allows handling all
+ * rpma_recv(3) completions within the connection. It allows separating rpma_recv(3) completions
+ * processing path from all other completions. The receive CQ is created only if the receive CQ
+ * size in the provided connection configuration is greater than 0. When the receive CQ does not
+ * exist for the given connection the *rcq_ptr == NULL.
  *
  * RETURN VALUE
- * The rpma_ep_next_conn_req() function returns 0 on success or a negative error code on failure.
- * rpma_ep_next_conn_req() does not set *req_ptr value on failure.
+ * The rpma_conn_get_rcq() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_get_rcq() does not set *rcq_ptr value on failure.
  *
  * ERRORS
- * rpma_ep_next_conn_req() can fail with the following errors:
+ * rpma_conn_get_rcq() can fail with the following error:
  *
- * - RPMA_E_INVAL - ep or req_ptr is NULL
- * - RPMA_E_INVAL - obtained an event different than a connection request
- * - RPMA_E_PROVIDER - rdma_get_cm_event(3) failed
- * - RPMA_E_NOMEM - out of memory
- * - RPMA_E_NO_EVENT - no next connection request available
+ * - RPMA_E_INVAL - conn or rcq_ptr is NULL
  *
  * SEE ALSO
- * rpma_conn_cfg_new(3), rpma_conn_req_delete(3), rpma_conn_req_connect(3), rpma_ep_listen(3),
- * librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_cfg_set_rcq_size(3), rpma_conn_req_connect(3), rpma_conn_get_cq(3), rpma_cq_wait(3),
+ * rpma_cq_get_wc(3), rpma_cq_get_fd(3), rpma_recv(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_ep_next_conn_req(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
-		struct rpma_conn_req **req_ptr);
+int rpma_conn_get_rcq(const struct rpma_conn *conn, struct rpma_cq **rcq_ptr);
 
 /** 3
- * rpma_conn_req_get_private_data - get a pointer to the request's private data
+ * rpma_conn_disconnect - tear the connection down
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn_req;
- *	struct rpma_conn_private_data;
- *	int rpma_conn_req_get_private_data(const struct rpma_conn_req *req,
- *			struct rpma_conn_private_data *pdata);
+ *	struct rpma_conn;
+ *	int rpma_conn_disconnect(struct rpma_conn *conn);
  *
  * DESCRIPTION
- * rpma_conn_req_get_private_data() obtains the pointer to the connection's private data given by
- * the other side of the connection before the connection is established.
+ * rpma_conn_disconnect() tears the connection down.
  *
- * SECURITY WARNING
- * See rpma_conn_get_private_data(3).
+ * - It may initiate disconnecting the connection. In this case, the end of disconnecting is
+ *   signalled by the RPMA_CONN_CLOSED event via rpma_conn_next_event() or
+ * - It may be called after receiving the RPMA_CONN_CLOSED event. In this case, the disconnection
+ *   is done when rpma_conn_disconnect() returns with success.
  *
  * RETURN VALUE
- * The rpma_conn_req_get_private_data() function returns 0 on success or a negative error code on
- * failure. rpma_conn_req_get_private_data() does not set *pdata value on failure.
+ * The rpma_conn_disconnect() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_conn_req_get_private_data() can fail with the following error:
+ * rpma_conn_disconnect() can fail with the following errors:
  *
- * - RPMA_E_INVAL - req or pdata is NULL
+ * - RPMA_E_INVAL - conn is NULL
+ * - RPMA_E_PROVIDER - rdma_disconnect() failed
  *
  * SEE ALSO
- * rpma_conn_get_private_data(3), rpma_ep_next_conn_req(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_delete(3), rpma_conn_next_event(3), rpma_conn_req_connect(3), librpma(7) and
+ * https://pmem.io/rpma/
  */
-int rpma_conn_req_get_private_data(const struct rpma_conn_req *req,
-		struct rpma_conn_private_data *pdata);
-
-/* shared RQ configuration */
-
-struct rpma_srq_cfg;
+int rpma_conn_disconnect(struct rpma_conn *conn);
 
 /** 3
- * rpma_srq_cfg_new - create a new shared RQ configuration object
+ * rpma_conn_delete - delete already closed connection
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq_cfg;
- *	int rpma_srq_cfg_new(struct rpma_srq_cfg **cfg_ptr);
+ *	struct rpma_conn;
+ *	int rpma_conn_delete(struct rpma_conn **conn_ptr);
  *
  * DESCRIPTION
- * rpma_srq_cfg_new() creates a new shared RQ configuration object and fills it with the default
- * values:
- *
- *	.rcq_size = 100
- *	.rq_size = 100
- *
- * Note that rpma_srq_new(3) with the default rcq_size creates its own receive CQ.
+ * rpma_conn_delete() deletes already closed connection.
  *
  * RETURN VALUE
- * The rpma_srq_cfg_new() function returns 0 on success or a negative error code on failure.
- * rpma_srq_cfg_new() does not set *cfg_ptr value on failure.
+ * The rpma_conn_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_delete() sets *conn_ptr value to NULL on success and on failure.
  *
  * ERRORS
- * rpma_srq_cfg_new() can fail with the following error:
- *
- * - RPMA_E_INVAL - cfg_ptr is NULL
- * - RPMA_E_NOMEM - out of memory
+ * rpma_conn_delete() can fail with the following errors:
+ * - RPMA_E_INVAL - conn_ptr is NULL or munmap() failed
+ * - RPMA_E_PROVIDER - ibv_destroy_cq() or rdma_destroy_id() failed
  *
  * SEE ALSO
- * rpma_srq_cfg_delete(3), rpma_srq_cfg_get_rcq_size(3), rpma_srq_cfg_get_rq_size(3),
- * rpma_srq_cfg_set_rcq_size(3), rpma_srq_cfg_set_rq_size(3), rpma_srq_new(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_conn_disconnect(3), rpma_conn_req_connect(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_cfg_new(struct rpma_srq_cfg **cfg_ptr);
+int rpma_conn_delete(struct rpma_conn **conn_ptr);
 
 /** 3
- * rpma_srq_cfg_delete - delete the shared RQ configuration object
+ * rpma_conn_evch_new - create a CM event channel shared by many connections
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq_cfg;
- *	int rpma_srq_cfg_delete(struct rpma_srq_cfg **cfg_ptr);
+ *	struct rpma_conn_evch;
+ *	int rpma_conn_evch_new(struct rpma_conn_evch **evch_ptr);
  *
  * DESCRIPTION
- * rpma_srq_cfg_delete() deletes the shared RQ configuration object.
+ * rpma_conn_evch_new() creates a new CM event channel which can be shared by many connections
+ * using rpma_conn_cfg_set_evch(3). All the events of these connections are delivered via
+ * the single file descriptor obtained using rpma_conn_evch_get_fd(3) and they are collected
+ * using rpma_conn_evch_next_event(3) which also returns the connection the event concerns.
+ * It saves one file descriptor and a few system calls per connection which matters when
+ * a server handles thousands of clients.
  *
  * RETURN VALUE
- * The rpma_srq_cfg_delete() function returns 0 on success or a negative error code on failure.
- * rpma_srq_cfg_delete() sets *cfg_ptr value to NULL on success and on failure.
+ * The rpma_conn_evch_new() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_evch_new() does not set *evch_ptr value on failure.
  *
  * ERRORS
- * rpma_srq_cfg_delete() can fail with the following error:
+ * rpma_conn_evch_new() can fail with the following errors:
  *
- * - RPMA_E_INVAL - cfg_ptr is NULL
+ * - RPMA_E_INVAL - evch_ptr is NULL
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - rdma_create_event_channel(3) failed
  *
  * SEE ALSO
- * rpma_srq_cfg_new(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_cfg_set_evch(3), rpma_conn_evch_delete(3), rpma_conn_evch_get_fd(3),
+ * rpma_conn_evch_next_event(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_cfg_delete(struct rpma_srq_cfg **cfg_ptr);
+int rpma_conn_evch_new(struct rpma_conn_evch **evch_ptr);
 
 /** 3
- * rpma_srq_cfg_set_rq_size - set RQ size of the shared RQ
+ * rpma_conn_evch_delete - delete the shared CM event channel
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq_cfg;
- *	int rpma_srq_cfg_set_rq_size(struct rpma_srq_cfg *cfg, uint32_t rq_size);
+ *	struct rpma_conn_evch;
+ *	int rpma_conn_evch_delete(struct rpma_conn_evch **evch_ptr);
  *
  * DESCRIPTION
- * rpma_srq_cfg_set_rq_size() sets the RQ size of the shared RQ. If this function is not called,
- * the rq_size has the default value (100) set by rpma_srq_cfg_new(3).
+ * rpma_conn_evch_delete() deletes the shared CM event channel. All the connections using it
+ * have to be deleted beforehand.
  *
  * RETURN VALUE
- * The rpma_srq_cfg_set_rq_size() function returns 0 on success or a negative error code on
- * failure.
+ * The rpma_conn_evch_delete() function returns 0 on success or a negative error code
+ * on failure. rpma_conn_evch_delete() sets *evch_ptr value to NULL on success.
  *
  * ERRORS
- * rpma_srq_cfg_set_rq_size() can fail with the following error:
+ * rpma_conn_evch_delete() can fail with the following error:
  *
- * - RPMA_E_INVAL - cfg is NULL
+ * - RPMA_E_INVAL - evch_ptr is NULL
  *
  * SEE ALSO
- * rpma_srq_cfg_new(3), rpma_srq_cfg_get_rq_size(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_evch_new(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_cfg_set_rq_size(struct rpma_srq_cfg *cfg, uint32_t rq_size);
+int rpma_conn_evch_delete(struct rpma_conn_evch **evch_ptr);
 
 /** 3
- * rpma_srq_cfg_get_rq_size - get RQ size of the shared RQ
+ * rpma_conn_evch_get_fd - get a file descriptor of the shared CM event channel
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq_cfg;
- *	int rpma_srq_cfg_get_rq_size(const struct rpma_srq_cfg *cfg, uint32_t *rq_size);
+ *	struct rpma_conn_evch;
+ *	int rpma_conn_evch_get_fd(const struct rpma_conn_evch *evch, int *fd);
  *
  * DESCRIPTION
- * rpma_srq_cfg_get_rq_size() gets the RQ size of the shared RQ.
+ * rpma_conn_evch_get_fd() gets a file descriptor of the shared CM event channel. The file
+ * descriptor becomes readable when an event of any of the connections sharing the channel
+ * is waiting. rpma_conn_get_event_fd(3) returns the same file descriptor for each of these
+ * connections.
  *
  * RETURN VALUE
- * The rpma_srq_cfg_get_rq_size() function returns 0 on success or a negative error code on
- * failure. rpma_srq_cfg_get_rq_size() does not set *rq_size value on failure.
+ * The rpma_conn_evch_get_fd() function returns 0 on success or a negative error code
+ * on failure. rpma_conn_evch_get_fd() does not set *fd value on failure.
  *
  * ERRORS
- * rpma_srq_cfg_get_rq_size() can fail with the following error:
+ * rpma_conn_evch_get_fd() can fail with the following error:
  *
- * - RPMA_E_INVAL - cfg or rq_size is NULL
+ * - RPMA_E_INVAL - evch or fd is NULL
  *
  * SEE ALSO
- * rpma_srq_cfg_new(3), rpma_srq_cfg_set_rq_size(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_evch_new(3), rpma_conn_evch_next_event(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_cfg_get_rq_size(const struct rpma_srq_cfg *cfg, uint32_t *rq_size);
+int rpma_conn_evch_get_fd(const struct rpma_conn_evch *evch, int *fd);
 
 /** 3
- * rpma_srq_cfg_set_rcq_size - set receive CQ size of the shared RQ
+ * rpma_conn_evch_next_event - obtain the next event from the shared CM event channel
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq_cfg;
- *	int rpma_srq_cfg_set_rcq_size(struct rpma_srq_cfg *cfg, uint32_t rcq_size);
+ *	struct rpma_conn;
+ *	struct rpma_conn_evch;
+ *	enum rpma_conn_event {
+ *		RPMA_CONN_UNDEFINED = -1,
+ *		RPMA_CONN_ESTABLISHED,
+ *		RPMA_CONN_CLOSED,
+ *		RPMA_CONN_LOST,
+ *		RPMA_CONN_REJECTED,
+ *		RPMA_CONN_UNREACHABLE
+ *	};
  *
- * DESCRIPTION
- * rpma_srq_cfg_set_rcq_size() sets the receive CQ size of the shared RQ. If this function is not
- * called, the rcq_size has the default value (100) set by rpma_srq_cfg_new(3).
+ *	int rpma_conn_evch_next_event(struct rpma_conn_evch *evch,
+ *			struct rpma_conn **conn_ptr, enum rpma_conn_event *event);
  *
- * Note that rpma_srq_new(3) does not create its own receive CQ if the size of the receive CQ
- * equals 0.
+ * DESCRIPTION
+ * rpma_conn_evch_next_event() obtains the next event of any of the connections sharing the CM
+ * event channel and returns the connection the event concerns. The events are the same as
+ * the ones returned by rpma_conn_next_event(3) which cannot be used for the connections
+ * sharing the CM event channel.
  *
  * RETURN VALUE
- * The rpma_srq_cfg_set_rcq_size() function returns 0 on success or a negative error code on
- * failure.
+ * The rpma_conn_evch_next_event() function returns 0 on success or a negative error code
+ * on failure. *conn_ptr is set whenever the obtained event concerns a connection even if
+ * the event itself cannot be handled.
  *
  * ERRORS
- * rpma_srq_cfg_set_rcq_size() can fail with the following error:
+ * rpma_conn_evch_next_event() can fail with the following errors:
  *
- * - RPMA_E_INVAL - cfg is NULL
+ * - RPMA_E_INVAL - evch, conn_ptr or event is NULL
+ * - RPMA_E_NO_EVENT - no next event is available (a non-blocking file descriptor only)
+ * - RPMA_E_UNKNOWN - unexpected event or the event does not concern any connection
+ * - RPMA_E_PROVIDER - rdma_get_cm_event() or rdma_ack_cm_event() failed
+ * - RPMA_E_NOMEM - out of memory
  *
  * SEE ALSO
- * rpma_srq_cfg_get_rcq_size(3), rpma_srq_cfg_new(3), rpma_srq_new(3), librpma(7) and
+ * rpma_conn_cfg_set_evch(3), rpma_conn_evch_new(3), rpma_conn_evch_get_fd(3), librpma(7) and
  * https://pmem.io/rpma/
  */
-int rpma_srq_cfg_set_rcq_size(struct rpma_srq_cfg *cfg, uint32_t rcq_size);
+int rpma_conn_evch_next_event(struct rpma_conn_evch *evch, struct rpma_conn **conn_ptr,
+		enum rpma_conn_event *event);
+
+/* incoming / outgoing connection request */
+
+struct rpma_conn_req;
 
 /** 3
- * rpma_srq_cfg_get_rcq_size - get receive CQ size of the shared RQ
+ * rpma_conn_req_new - create a new outgoing connection request object
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq_cfg;
- *	int rpma_srq_cfg_get_rcq_size(const struct rpma_srq_cfg *cfg, uint32_t *rcq_size);
+ *	struct rpma_peer;
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_req;
+ *	int rpma_conn_req_new(struct rpma_peer *peer, const char *addr, const char *port,
+ *			const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
  *
  * DESCRIPTION
- * rpma_srq_cfg_get_rcq_size() gets the receive CQ size of the shared RQ.
+ * rpma_conn_req_new() creates a new outgoing connection request object using reliable,
+ * connection-oriented and message-based (RDMA_PS_TCP) QP communication.
  *
  * RETURN VALUE
- * The rpma_srq_cfg_get_rcq_size() function returns 0 on success or a negative error code on
- * failure. rpma_srq_cfg_get_rcq_size() does not set *rcq_size value on failure.
+ * The rpma_conn_req_new() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_req_new() does not set *req_ptr value on failure. If cfg is NULL, then the default
+ * values are used
+ * - see rpma_conn_cfg_new(3) for more details.
  *
  * ERRORS
- * rpma_srq_cfg_get_rcq_size() can fail with the following error:
+ * rpma_conn_req_new() can fail with the following errors:
  *
- * - RPMA_E_INVAL - cfg or rcq_size is NULL
+ * - RPMA_E_INVAL - peer, addr, port or req_ptr is NULL
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - rdma_create_id(3), rdma_resolve_addr(3), rdma_resolve_route(3) or
+ *   ibv_create_cq(3) failed
  *
  * SEE ALSO
- * rpma_srq_cfg_new(3), rpma_srq_cfg_set_rcq_size(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_cfg_new(3), rpma_conn_req_connect(3), rpma_conn_req_delete(3), rpma_conn_req_recv(3),
+ * rpma_ep_next_conn_req(3), rpma_peer_new(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_cfg_get_rcq_size(const struct rpma_srq_cfg *cfg, uint32_t *rcq_size);
+int rpma_conn_req_new(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
 
-/* shared RQ */
+/* the states of a connection request before it is connected */
+enum rpma_conn_req_state {
+	RPMA_CONN_REQ_ADDR_RESOLVING,	/* resolving the address */
+	RPMA_CONN_REQ_ROUTE_RESOLVING,	/* resolving the route */
+	RPMA_CONN_REQ_READY,		/* QP and CQs are ready, it can be connected */
+	RPMA_CONN_REQ_SETUP_PENDING	/* an incoming request waits for its QP and CQs */
+};
 
 /** 3
- * rpma_srq_new - create a new shared RQ object
+ * rpma_conn_req_new_async - create a new outgoing connection request object asynchronously
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
  *	struct rpma_peer;
- *	struct rpma_srq_cfg;
- *	struct rpma_srq;
- *	int rpma_srq_new(struct rpma_peer *peer, const struct rpma_srq_cfg *cfg,
- *			struct rpma_srq **srq_ptr);
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_req;
+ *	int rpma_conn_req_new_async(struct rpma_peer *peer, const char *addr, const char *port,
+ *			const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
+ *
+ *	enum rpma_conn_req_state {
+ *		RPMA_CONN_REQ_ADDR_RESOLVING,
+ *		RPMA_CONN_REQ_ROUTE_RESOLVING,
+ *		RPMA_CONN_REQ_READY,
+ *		RPMA_CONN_REQ_SETUP_PENDING
+ *	};
  *
  * DESCRIPTION
- * rpma_srq_new() creates a new shared RQ object including a new shared RQ and a new shared receive
- * CQ. It does not create the shared receive CQ if the size of the receive CQ in cfg equals 0.
+ * rpma_conn_req_new_async() creates a new outgoing connection request object like
+ * rpma_conn_req_new(3) does but it does not wait for resolving the address and the route.
+ * The connection request gets its own event channel and it is returned right after resolving
+ * the address has been started, in the RPMA_CONN_REQ_ADDR_RESOLVING state. Every subsequent event
+ * of the event channel has to be handled by rpma_conn_req_step(3) which advances the request
+ * through the following states:
+ *
+ * - RPMA_CONN_REQ_ADDR_RESOLVING - the address is being resolved,
+ * - RPMA_CONN_REQ_ROUTE_RESOLVING - the route is being resolved,
+ * - RPMA_CONN_REQ_READY - the QP and the CQs are created and the request can be connected
+ *   with rpma_conn_req_connect(3).
+ *
+ * The file descriptor of the event channel can be obtained with rpma_conn_req_get_fd(3), so many
+ * connection requests can be established concurrently from a single event loop. The connection
+ * returned by rpma_conn_req_connect(3) reports the RPMA_CONN_ESTABLISHED event via its own event
+ * channel (see rpma_conn_get_event_fd(3)) so connecting does not block either.
+ *
+ * The cfg object is used when the route is resolved, so it has to remain valid until
+ * the request gets the RPMA_CONN_REQ_READY state. If cfg is NULL, then the default values are
+ * used - see rpma_conn_cfg_new(3) for more details.
  *
  * RETURN VALUE
- * The rpma_srq_new() function returns 0 on success or a negative error code on failure.
- * rpma_srq_new() does not set *srq_ptr value on failure. If cfg is NULL, then the default values
- * are used
- * - see rpma_srq_cfg_new(3) for more details.
+ * The rpma_conn_req_new_async() function returns 0 on success or a negative error code
+ * on failure. rpma_conn_req_new_async() does not set *req_ptr value on failure.
  *
  * ERRORS
- * rpma_srq_new() can fail with the following errors:
+ * rpma_conn_req_new_async() can fail with the following errors:
  *
- * - RPMA_E_INVAL - peer or srq_ptr is NULL
+ * - RPMA_E_INVAL - peer, addr, port or req_ptr is NULL
  * - RPMA_E_NOMEM - out of memory
- * - RPMA_E_PROVIDER - ibv_create_srq(3), ibv_create_comp_channel(3), ibv_create_cq(3) or
- *   ibv_req_notify_cq(3) failed
+ * - RPMA_E_PROVIDER - rdma_create_event_channel(3), rdma_create_id(3) or rdma_resolve_addr(3)
+ *   failed
  *
  * SEE ALSO
- * rpma_srq_delete(3), rpma_srq_get_rcq(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_cfg_new(3), rpma_conn_req_connect(3), rpma_conn_req_delete(3),
+ * rpma_conn_req_get_fd(3), rpma_conn_req_new(3), rpma_conn_req_step(3), rpma_peer_new(3),
+ * librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_new(struct rpma_peer *peer, struct rpma_srq_cfg *cfg, struct rpma_srq **srq_ptr);
+int rpma_conn_req_new_async(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr);
 
 /** 3
- * rpma_srq_delete - delete the shared RQ object
+ * rpma_conn_req_get_fd - get a file descriptor of the event channel of the connection request
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq;
- *	int rpma_conn_req_delete(struct rpma_srq **srq_ptr);
+ *	struct rpma_conn_req;
+ *	int rpma_conn_req_get_fd(const struct rpma_conn_req *req, int *fd);
  *
  * DESCRIPTION
- * rpma_srq_delete() deletes the shared RQ object.
+ * rpma_conn_req_get_fd() gets a file descriptor of the event channel of the connection request
+ * created by rpma_conn_req_new_async(3). The file descriptor becomes readable when there is
+ * an event to be handled by rpma_conn_req_step(3). It can be made non-blocking using fcntl(2).
  *
  * RETURN VALUE
- * The rpma_srq_delete() function returns 0 on success or a negative error code on failure.
- * rpma_srq_delete() sets *srq_ptr value to NULL on success and on failure.
+ * The rpma_conn_req_get_fd() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_req_get_fd() does not set *fd value on failure.
  *
  * ERRORS
- * rpma_srq_delete() can fail with the following errors:
+ * rpma_conn_req_get_fd() can fail with the following error:
  *
- * - RPMA_E_INVAL - srq_ptr is NULL
- * - RPMA_E_PROVIDER - ibv_destroy_cq(3), ibv_destroy_comp_channel(3), or ibv_destroy_srq(3) failed
+ * - RPMA_E_INVAL - req or fd is NULL or req has not been created by rpma_conn_req_new_async(3)
  *
  * SEE ALSO
- * rpma_srq_new(3), rpma_srq_get_rcq(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_req_new_async(3), rpma_conn_req_step(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_delete(struct rpma_srq **srq_ptr);
+int rpma_conn_req_get_fd(const struct rpma_conn_req *req, int *fd);
 
 /** 3
- * rpma_srq_recv - initiate the receive operation in shared RQ
+ * rpma_conn_req_step - advance the asynchronous establishment of the connection request
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq;
- *	struct rpma_mr_local;
- *	int rpma_srq_recv(struct rpma_srq *srq, struct rpma_mr_local *dst, size_t offset,
- *			size_t len, const void *op_context);
+ *	struct rpma_conn_req;
+ *	enum rpma_conn_req_state;
+ *	int rpma_conn_req_step(struct rpma_conn_req *req, enum rpma_conn_req_state *state);
  *
  * DESCRIPTION
- * If multiple local connections use a shared RQ, rpma_srq_recv() initiates the receive operation
- * which prepares a buffer for a message sent from other side of these connections. Please see
- * rpma_send(3).
- *
- * All buffers prepared via rpma_srq_recv(3) form an unordered set. When a message arrives it is
- * placed in one of the buffers awaiting and a completion for the receive operation is generated.
- *
- * A buffer for an incoming message has to be prepared beforehand.
- *
- * The order of buffers in the set does not affect the order of completions of the receive
- * operations got via rpma_cq_get_wc(3).
- *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
- *
- * NOTE
- * In the RDMA standard, receive requests form an ordered queue.
- * The librpma library does NOT inherit this guarantee.
+ * rpma_conn_req_step() obtains the next event of the event channel of the connection request
+ * created by rpma_conn_req_new_async(3) and performs the next step of the establishment:
+ * resolving the route after the address is resolved and creating the QP and the CQs after
+ * the route is resolved. The resulting state of the request is returned in *state. When it is
+ * RPMA_CONN_REQ_READY the request can be connected with rpma_conn_req_connect(3). For a ready
+ * request (including all requests not created by rpma_conn_req_new_async(3) but the ones waiting
+ * for rpma_conn_req_setup(3)) rpma_conn_req_step() returns RPMA_CONN_REQ_READY right away.
+ *
+ * rpma_conn_req_step() blocks until an event is available unless the file descriptor of the event
+ * channel is made non-blocking (see rpma_conn_req_get_fd(3)). When the establishment fails
+ * the request cannot be used anymore and it has to be deleted with rpma_conn_req_delete(3).
  *
  * RETURN VALUE
- * The rpma_srq_recv() function returns 0 on success or a negative error code on failure.
+ * The rpma_conn_req_step() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_req_step() does not set *state value on failure.
  *
  * ERRORS
- * rpma_srq_recv() can fail with the following errors:
+ * rpma_conn_req_step() can fail with the following errors:
  *
- * - RPMA_E_INVAL - srq == NULL
- * - RPMA_E_INVAL - dst == NULL && (offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_srq_recv(3) failed
+ * - RPMA_E_INVAL - req or state is NULL
+ * - RPMA_E_INVAL - req is in the RPMA_CONN_REQ_SETUP_PENDING state
+ * - RPMA_E_NO_EVENT - no next event is available (a non-blocking file descriptor only)
+ * - RPMA_E_PROVIDER - rdma_get_cm_event(3), rdma_ack_cm_event(3), rdma_resolve_route(3) or
+ *   ibv_create_cq(3) failed or resolving the address or the route failed
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_UNKNOWN - an unexpected event has been obtained
  *
  * SEE ALSO
- * rpma_mr_reg(3), rpma_srq_new(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_req_connect(3), rpma_conn_req_delete(3), rpma_conn_req_get_fd(3),
+ * rpma_conn_req_new_async(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_recv(struct rpma_srq *srq, struct rpma_mr_local *dst, size_t offset, size_t len,
-	const void *op_context);
+int rpma_conn_req_step(struct rpma_conn_req *req, enum rpma_conn_req_state *state);
 
 /** 3
- * rpma_srq_get_rcq -- get the receive CQ from the shared RQ object
+ * rpma_conn_req_setup - create the QP and the CQs of an incoming connection request
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_srq;
- *	struct rpma_cq;
- *	int rpma_srq_get_rcq(const struct rpma_srq *srq, struct rpma_cq **rcq_ptr);
+ *	struct rpma_conn_req;
+ *	int rpma_conn_req_setup(struct rpma_conn_req *req);
  *
  * DESCRIPTION
- * rpma_srq_get_rcq() gets the receive CQ from the shared RQ object. The receive CQ created by
- * rpma_srq_new(3) allows handling all rpma_srq_recv(3) completions within the shared RQ.
- * rpma_srq_cfg_set_rcq_size(3) can change the receive CQ size.
+ * rpma_conn_req_setup() creates the QP and the CQs of the incoming connection request obtained
+ * from an endpoint with the deferred setup enabled (see rpma_ep_set_deferred_setup(3)). Such
+ * a request is in the RPMA_CONN_REQ_SETUP_PENDING state and rpma_conn_req_setup() moves it to
+ * the RPMA_CONN_REQ_READY state. It does nothing for a request which is already ready.
+ *
+ * The QP and the CQs are created by the calling thread, so the listening thread can hand
+ * the requests off to worker threads which set them up concurrently, each one using its own
+ * (e.g. NUMA-local) resources. rpma_conn_req_connect(3) sets up a pending request on its own,
+ * so rpma_conn_req_setup() has to be called explicitly only when the request is used before
+ * connecting it (e.g. by rpma_conn_req_recv(3)).
+ *
+ * If rpma_conn_req_setup() fails the request remains pending and it can be either set up again
+ * or deleted with rpma_conn_req_delete(3).
  *
  * RETURN VALUE
- * The rpma_srq_get_rcq() function returns 0 on success or a negative error code on failure.
- * rpma_srq_get_rcq() does not set *rcq_ptr value on failure.
+ * The rpma_conn_req_setup() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_srq_get_rcq() can fail with the following error:
+ * rpma_conn_req_setup() can fail with the following errors:
  *
- * - RPMA_E_INVAL - srq or rcq_ptr is NULL
+ * - RPMA_E_INVAL - req is NULL
+ * - RPMA_E_INVAL - req is neither pending nor ready
+ * - RPMA_E_PROVIDER - ibv_create_comp_channel(3), ibv_create_cq(3) or rdma_create_qp(3) failed
+ * - RPMA_E_NOMEM - out of memory
  *
  * SEE ALSO
- * rpma_cq_wait(3), rpma_cq_get_wc(3), rpma_cq_get_fd(3), rpma_srq_cfg_set_rcq_size(3),
- * rpma_srq_new(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_conn_req_connect(3), rpma_conn_req_delete(3), rpma_conn_req_recv(3),
+ * rpma_ep_next_conn_req(3), rpma_ep_set_deferred_setup(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_srq_get_rcq(const struct rpma_srq *srq, struct rpma_cq **rcq_ptr);
-
-/* remote memory access functions */
-
-/* generate operation completion on error */
-#define RPMA_F_COMPLETION_ON_ERROR	(1 << 0)
-/* generate operation completion regardless of its result */
-#define RPMA_F_COMPLETION_ALWAYS	(1 << 1 | RPMA_F_COMPLETION_ON_ERROR)
+int rpma_conn_req_setup(struct rpma_conn_req *req);
 
 /** 3
- * rpma_read - initiate the read operation
+ * rpma_conn_req_delete - delete the connection requests
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_local;
- *	struct rpma_mr_remote;
- *	int rpma_read(struct rpma_conn *conn,
- *			struct rpma_mr_local *dst, size_t dst_offset,
- *			const struct rpma_mr_remote *src, size_t src_offset,
- *			size_t len, int flags, const void *op_context);
+ *	struct rpma_conn_req;
+ *	int rpma_conn_req_delete(struct rpma_conn_req **req_ptr);
  *
  * DESCRIPTION
- * rpma_read() initiates transferring data from the remote memory to the local memory. To read a 0
- * bytes message, set src and dst to NULL and src_offset, dst_offset and len to 0.
- *
- * The attribute flags set the completion notification indicator:
- * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
- * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
- *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * rpma_conn_req_delete() deletes the connection requests both incoming and outgoing.
  *
  * RETURN VALUE
- * The rpma_read() function returns 0 on success or a negative error code on failure.
+ * The rpma_conn_req_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_req_delete() sets *req_ptr value to NULL on success and on failure.
  *
  * ERRORS
- * rpma_read() can fail with the following errors:
+ * rpma_conn_req_delete() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn == NULL || flags == 0
- * - RPMA_E_INVAL - dst == NULL && (src != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
- * - RPMA_E_INVAL - src == NULL && (dst != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_INVAL - req_ptr is NULL
+ * - RPMA_E_PROVIDER
+ *	- rdma_destroy_qp(3) or ibv_destroy_cq(3) failed
+ *	- rdma_reject(3) or rdma_ack_cm_event(3) failed (passive side only)
+ *	- rdma_destroy_id(3) failed (active side only)
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_conn_req_new(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_read(struct rpma_conn *conn,
-		struct rpma_mr_local *dst, size_t dst_offset,
-		const struct rpma_mr_remote *src, size_t src_offset,
-		size_t len, int flags, const void *op_context);
+int rpma_conn_req_delete(struct rpma_conn_req **req_ptr);
 
 /** 3
- * rpma_write - initiate the write operation
+ * rpma_conn_req_connect - initiate processing the connection request
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
+ *	struct rpma_conn_req;
+ *	struct rpma_conn_private_data;
  *	struct rpma_conn;
- *	struct rpma_mr_local;
- *	struct rpma_mr_remote;
- *	int rpma_write(struct rpma_conn *conn,
- *			struct rpma_mr_remote *dst, size_t dst_offset,
- *			const struct rpma_mr_local *src, size_t src_offset,
- *			size_t len, int flags, const void *op_context);
+ *	int rpma_conn_req_connect(struct rpma_conn_req **req_ptr,
+ *			const struct rpma_conn_private_data *pdata, struct rpma_conn **conn_ptr);
  *
  * DESCRIPTION
- * rpma_write() initiates transferring data from the local memory to the remote memory. To write
- * a 0 bytes message, set src and dst to NULL and src_offset, dst_offset and len to 0.
- *
- * The attribute flags set the completion notification indicator:
- * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
- * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
- *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * rpma_conn_req_connect() initiates processing the connection requests both incoming and outgoing.
+ * The end of processing is signalled by the RPMA_CONN_ESTABLISHED event via
+ * rpma_conn_next_event(). An incoming connection request waiting for its QP and CQs
+ * (see rpma_ep_set_deferred_setup(3)) is set up as by rpma_conn_req_setup(3) first.
  *
  * RETURN VALUE
- * The rpma_write() function returns 0 on success or a negative error code on failure.
+ * The rpma_conn_req_connect() function returns 0 on success or a negative error code on failure.
+ * On success, the newly created connection object is stored in *conn_ptr whereas *req_ptr is
+ * consumed and set to NULL. On failure, rpma_conn_req_connect() does not set *conn_ptr whereas
+ * *req_ptr is consumed and set to NULL.
  *
  * ERRORS
- * rpma_write() can fail with the following errors:
+ * rpma_conn_req_connect() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn == NULL || flags == 0
- * - RPMA_E_INVAL - dst == NULL && (src != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
- * - RPMA_E_INVAL - src == NULL && (dst != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_INVAL - req_ptr, *req_ptr or conn_ptr is NULL
+ * - RPMA_E_INVAL - pdata is not NULL whereas pdata->len == 0
+ * - RPMA_E_INVAL - *req_ptr has been created by rpma_conn_req_new_async(3) and it is not
+ *   ready yet (see rpma_conn_req_step(3))
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - setting up the QP and the CQs failed (deferred setup only)
+ * - RPMA_E_PROVIDER - initiating a connection request failed (active side only)
+ * - RPMA_E_PROVIDER - accepting the connection request failed (passive side only)
+ * - RPMA_E_PROVIDER - freeing a communication event failed (passive side only)
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_conn_apply_remote_peer_cfg(3), rpma_conn_delete(3), rpma_conn_disconnect(3),
+ * rpma_conn_get_cq(3), rpma_conn_get_event_fd(3), rpma_conn_get_private_data(3),
+ * rpma_conn_get_rcq(3), rpma_conn_next_event(3), rpma_conn_req_new(3), rpma_ep_next_conn_req(3),
+ * rpma_flush(3), rpma_read(3), rpma_recv(3), rpma_send(3), rpma_write(3), rpma_atomic_write(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_conn_req_connect(struct rpma_conn_req **req_ptr,
+		const struct rpma_conn_private_data *pdata, struct rpma_conn **conn_ptr);
+
+/*
+ * the target of rpma_conn_connect_all()
+ */
+struct rpma_conn_target {
+	/* the input */
+	const char *addr; /* the address of the server */
+	const char *port; /* the port of the server */
+	const struct rpma_conn_cfg *cfg; /* the connection configuration (can be NULL) */
+	const struct rpma_conn_private_data *pdata; /* the private data (can be NULL) */
+
+	/* the output */
+	struct rpma_conn *conn; /* the established connection */
+	int result; /* 0 or a negative error code */
+};
+
+/** 3
+ * rpma_conn_connect_all - connect many targets in parallel
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_conn_target {
+ *		const char *addr;
+ *		const char *port;
+ *		const struct rpma_conn_cfg *cfg;
+ *		const struct rpma_conn_private_data *pdata;
+ *		struct rpma_conn *conn;
+ *		int result;
+ *	};
+ *	int rpma_conn_connect_all(struct rpma_peer *peer, struct rpma_conn_target *targets,
+ *			int num_targets, int max_inflight);
+ *
+ * DESCRIPTION
+ * rpma_conn_connect_all() establishes the connections to all num_targets targets. Up to
+ * max_inflight of them are being established at the same time so the total time is bounded by
+ * the slowest of the targets rather than by the sum over all of them. Each of the targets is
+ * connected as by rpma_conn_req_new_async(3), rpma_conn_req_step(3), rpma_conn_req_connect(3)
+ * and rpma_conn_next_event(3) using the addr, port, cfg and pdata of the target. Hence the cfg
+ * of a target cannot set a shared CM event channel (see rpma_conn_cfg_set_evch(3)).
+ *
+ * The result of every target is stored in its result field. When it is 0 the established
+ * connection is stored in its conn field and it has to be deleted with rpma_conn_delete(3)
+ * as any other connection. Otherwise the conn field is NULL. rpma_conn_connect_all() returns
+ * when all the targets are either connected or failed.
+ *
+ * RETURN VALUE
+ * The rpma_conn_connect_all() function returns 0 on success or a negative error code on failure.
+ * Success means all the targets have been processed and their results are available. On failure
+ * no connection is left established - the connections of the targets which have already been
+ * connected are disconnected and deleted - and the result of every target is set to the error
+ * code unless the target had failed earlier.
+ *
+ * ERRORS
+ * rpma_conn_connect_all() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer or targets is NULL, num_targets < 1 or max_inflight < 1
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - poll(2) failed
+ *
+ * The result of a target can be any error of rpma_conn_req_new_async(3), rpma_conn_req_step(3),
+ * rpma_conn_req_connect(3) or rpma_conn_next_event(3). It is RPMA_E_PROVIDER when
+ * the connection has not been established e.g. it has been rejected.
+ *
+ * SEE ALSO
+ * rpma_conn_delete(3), rpma_conn_next_event(3), rpma_conn_req_connect(3),
+ * rpma_conn_req_new_async(3), rpma_conn_req_step(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_conn_connect_all(struct rpma_peer *peer, struct rpma_conn_target *targets,
+		int num_targets, int max_inflight);
+
+/** 3
+ * rpma_conn_get_compl_fd - get a file descriptor of the shared completion channel of the connection
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	int fd;
+ *	int rpma_conn_get_compl_fd(const struct rpma_conn *conn, int *fd);
+ *
+ * DESCRIPTION
+ * rpma_conn_get_compl_fd() gets a file descriptor of the shared completion channel from
+ * the connection.
+ *
+ * RETURN VALUE
+ * The rpma_conn_get_compl_fd() function returns 0 on success or a negative error code on failure.
+ * rpma_conn_get_compl_fd() does not set *fd value on failure.
+ *
+ * ERRORS
+ * rpma_conn_get_compl_fd() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn or fd is NULL
+ * - RPMA_E_NOT_SHARED_CHNL - the completion event channel is not shared
+ *
+ * SEE ALSO
+ * librpma(7), rpma_conn_req_connect(3) and https://pmem.io/rpma/
+ */
+int rpma_conn_get_compl_fd(const struct rpma_conn *conn, int *fd);
+
+/** 3
+ * rpma_conn_wait - wait for a completion event on the shared completion channel from CQ or RCQ
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_cq
+ *	int rpma_conn_wait(struct rpma_conn *conn, int flags, struct rpma_cq **cq, bool *is_rcq)
+ *
+ * DESCRIPTION
+ * rpma_conn_wait() waits for a completion event on the shared completion channel from CQ or RCQ,
+ * acks it and returns a CQ that caused the event in the cq argument and a boolean value saying if
+ * it is RCQ or not in the is_rcq argument (if is_rcq is not NULL). If rpma_conn_wait() succeeds,
+ * then all available completions should be collected from the returned cq using rpma_cq_get_wc(3).
+ *
+ * RETURN VALUE
+ * The rpma_conn_wait() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_conn_wait() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn or cq are NULL
+ * - RPMA_E_NOT_SHARED_CHNL - the completion event channel is not shared
+ * - RPMA_E_NO_COMPLETION - ibv_get_cq_event(3) failed
+ * - RPMA_E_UNKNOWN - ibv_get_cq_event(3) returned unknown CQ
+ * - RPMA_E_PROVIDER - ibv_req_notify_cq(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_conn_wait(struct rpma_conn *conn, int flags, struct rpma_cq **cq, bool *is_rcq);
+
+/** 3
+ * rpma_conn_req_recv - initiate the receive operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn_req;
+ *	struct rpma_mr_local;
+ *	int rpma_conn_req_recv(struct rpma_conn_req *req, struct rpma_mr_local *dst, size_t offset,
+ *			size_t len, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_conn_req_recv() initiates the receive operation. It prepares a buffer for a message sent
+ * from other side of the connection. Please see rpma_send(3). This is a variant of rpma_recv(3)
+ * which may be used before the connection is established. op_context is returned in the wr_id
+ * field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_conn_req_recv() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_conn_req_recv() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - req or src or op_context is NULL
+ * - RPMA_E_INVAL - req is not ready yet (see rpma_conn_req_step(3) and rpma_conn_req_setup(3))
+ * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_new(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_conn_req_recv(struct rpma_conn_req *req, struct rpma_mr_local *dst, size_t offset,
+		size_t len, const void *op_context);
+
+/* server-side setup */
+
+struct rpma_ep;
+
+/** 3
+ * rpma_ep_listen - create a listening endpoint
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_ep;
+ *	int rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port,
+ *			struct rpma_ep **ep_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ep_listen() creates an endpoint and initiates listening for incoming connections using
+ * reliable, connection-oriented and message-based (RDMA_PS_TCP) QP communication.
+ *
+ * RETURN VALUE
+ * The rpma_ep_listen() function returns 0 on success or a negative error code on failure.
+ * rpma_ep_listen() does not set *ep_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_ep_listen() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer, addr, port or ep_ptr is NULL
+ * - RPMA_E_PROVIDER - rdma_create_event_channel(3), rdma_create_id(3),
+ *   rdma_getaddrinfo(3), rdma_listen(3) failed
+ * - RPMA_E_NOMEM - out of memory
+ *
+ * SEE ALSO
+ * rpma_ep_get_fd(3), rpma_ep_next_conn_req(3), rpma_ep_shutdown(3), rpma_peer_new(3), librpma(7)
+ * and https://pmem.io/rpma/
+ */
+int rpma_ep_listen(struct rpma_peer *peer, const char *addr, const char *port,
+		struct rpma_ep **ep_ptr);
+
+/** 3
+ * rpma_ep_listen_with_backlog - create a listening endpoint with the given backlog
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_ep;
+ *	int rpma_ep_listen_with_backlog(struct rpma_peer *peer, const char *addr,
+ *			const char *port, int backlog, struct rpma_ep **ep_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ep_listen_with_backlog() works as rpma_ep_listen(3) but it also sets the maximum number
+ * of the incoming connection requests which can wait for the endpoint (see rdma_listen(3)).
+ * The requests exceeding the backlog are rejected by the RDMA CM. When many clients connect at
+ * the same time (e.g. after the server restarts) the backlog should be big enough to hold all
+ * the requests coming in between subsequent calls to rpma_ep_next_conn_reqs(3). 0 means
+ * the default backlog of the provider as used by rpma_ep_listen(3).
+ *
+ * RETURN VALUE
+ * The rpma_ep_listen_with_backlog() function returns 0 on success or a negative error code on
+ * failure. rpma_ep_listen_with_backlog() does not set *ep_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_ep_listen_with_backlog() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer, addr, port or ep_ptr is NULL or backlog < 0
+ * - RPMA_E_PROVIDER - rdma_create_event_channel(3), rdma_create_id(3),
+ *   rdma_getaddrinfo(3), rdma_listen(3) failed
+ * - RPMA_E_NOMEM - out of memory
+ *
+ * SEE ALSO
+ * rpma_ep_listen(3), rpma_ep_next_conn_reqs(3), rpma_ep_shutdown(3), librpma(7)
+ * and https://pmem.io/rpma/
+ */
+int rpma_ep_listen_with_backlog(struct rpma_peer *peer, const char *addr, const char *port,
+		int backlog, struct rpma_ep **ep_ptr);
+
+/** 3
+ * rpma_ep_shutdown - stop listening and delete the endpoint
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ep;
+ *	int rpma_ep_shutdown(struct rpma_ep **ep_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ep_shutdown() stops listening for incoming connections and deletes the endpoint.
+ * The connections established using the endpoint will still exist after deleting the endpoint.
+ *
+ * RETURN VALUE
+ * The rpma_ep_shutdown() function returns 0 on success or a negative error code on failure.
+ * rpma_ep_shutdown() does not set *ep_ptr value to NULL on failure.
+ *
+ * ERRORS
+ * rpma_ep_shutdown() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ep_ptr is NULL
+ * - RPMA_E_PROVIDER - rdma_destroy_id(3) failed
+ *
+ * SEE ALSO
+ * rpma_ep_listen(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ep_shutdown(struct rpma_ep **ep_ptr);
+
+/** 3
+ * rpma_ep_get_fd - get a file descriptor of the endpoint
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ep;
+ *	int rpma_ep_get_fd(const struct rpma_ep *ep, int *fd);
+ *
+ * DESCRIPTION
+ * rpma_ep_get_fd() gets the file descriptor of the endpoint.
+ *
+ * RETURN VALUE
+ * The rpma_ep_get_fd() function returns 0 on success or a negative error code on failure.
+ * rpma_ep_get_fd() does not set *fd value on failure.
+ *
+ * ERRORS
+ * rpma_ep_get_fd() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - ep or fd is NULL
+ *
+ * SEE ALSO
+ * rpma_ep_listen(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ep_get_fd(const struct rpma_ep *ep, int *fd);
+
+/** 3
+ * rpma_ep_next_conn_req - obtain an incoming connection request
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ep;
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_req;
+ *	int rpma_ep_next_conn_req(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
+ *			struct rpma_conn_req **req_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ep_next_conn_req() obtains the next connection request from the endpoint.
+ *
+ * RETURN VALUE
+ * The rpma_ep_next_conn_req() function returns 0 on success or a negative error code on failure.
+ * rpma_ep_next_conn_req() does not set *req_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_ep_next_conn_req() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ep or req_ptr is NULL
+ * - RPMA_E_INVAL - obtained an event different than a connection request
+ * - RPMA_E_PROVIDER - rdma_get_cm_event(3) failed
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_NO_EVENT - no next connection request available
+ *
+ * SEE ALSO
+ * rpma_conn_cfg_new(3), rpma_conn_req_delete(3), rpma_conn_req_connect(3), rpma_ep_listen(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ep_next_conn_req(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
+		struct rpma_conn_req **req_ptr);
+
+/** 3
+ * rpma_ep_next_conn_reqs - obtain all the waiting incoming connection requests
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ep;
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_req;
+ *	int rpma_ep_next_conn_reqs(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
+ *			struct rpma_conn_req **reqs, int max_reqs, int *num_reqs);
+ *
+ * DESCRIPTION
+ * rpma_ep_next_conn_reqs() obtains up to max_reqs connection requests from the endpoint in one
+ * call and stores them in reqs. The first request is obtained as by rpma_ep_next_conn_req(3)
+ * i.e. the call blocks until it is available unless the file descriptor of the endpoint is
+ * non-blocking (see rpma_ep_get_fd(3)). The next ones are obtained only if they are already
+ * waiting so the call never blocks on them. All the requests are created using the same cfg.
+ * Each of the obtained requests has to be either connected with rpma_conn_req_connect(3) or
+ * deleted with rpma_conn_req_delete(3).
+ *
+ * If creating any but the first request fails the failed request is dropped as it would be by
+ * rpma_ep_next_conn_req(3) and the requests obtained so far are returned.
+ *
+ * RETURN VALUE
+ * The rpma_ep_next_conn_reqs() function returns 0 on success or a negative error code on
+ * failure. On success, the number of the obtained requests (at least 1) is stored
+ * in *num_reqs. rpma_ep_next_conn_reqs() does not set *num_reqs value on failure.
+ *
+ * ERRORS
+ * rpma_ep_next_conn_reqs() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ep, reqs or num_reqs is NULL or max_reqs < 1
+ * - RPMA_E_INVAL - obtained an event different than a connection request
+ * - RPMA_E_PROVIDER - rdma_get_cm_event(3) failed
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_NO_EVENT - no next connection request available
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_conn_req_delete(3), rpma_ep_listen_with_backlog(3),
+ * rpma_ep_next_conn_req(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ep_next_conn_reqs(struct rpma_ep *ep, const struct rpma_conn_cfg *cfg,
+		struct rpma_conn_req **reqs, int max_reqs, int *num_reqs);
+
+/** 3
+ * rpma_ep_set_deferred_setup - defer creating QPs and CQs of incoming connection requests
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ep;
+ *	int rpma_ep_set_deferred_setup(struct rpma_ep *ep, bool deferred);
+ *
+ * DESCRIPTION
+ * rpma_ep_set_deferred_setup() enables or disables the deferred setup of the connection
+ * requests obtained from the endpoint. By default creating the QP and the CQs of a connection
+ * request is the part of rpma_ep_next_conn_req(3) and rpma_ep_next_conn_reqs(3) so all of them
+ * are created by the thread using the endpoint. With the deferred setup enabled these functions
+ * only obtain the connection request events and return requests in
+ * the RPMA_CONN_REQ_SETUP_PENDING state whose QP and CQs are created later by
+ * rpma_conn_req_setup(3) or rpma_conn_req_connect(3).
+ *
+ * It allows the listening thread to dispatch the requests (e.g. round-robin or by a hash of their
+ * private data - see rpma_conn_req_get_private_data(3)) to worker threads which set them up
+ * and connect them concurrently. A pending request may be used by a thread different than
+ * the one which has obtained it but only by one thread at the same time. The cfg passed to
+ * rpma_ep_next_conn_req(3) or rpma_ep_next_conn_reqs(3) has to remain valid until the request
+ * is set up.
+ *
+ * RETURN VALUE
+ * The rpma_ep_set_deferred_setup() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_ep_set_deferred_setup() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - ep is NULL
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_conn_req_setup(3), rpma_ep_listen(3),
+ * rpma_ep_next_conn_req(3), rpma_ep_next_conn_reqs(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ep_set_deferred_setup(struct rpma_ep *ep, bool deferred);
+
+/** 3
+ * rpma_conn_req_get_private_data - get a pointer to the request's private data
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn_req;
+ *	struct rpma_conn_private_data;
+ *	int rpma_conn_req_get_private_data(const struct rpma_conn_req *req,
+ *			struct rpma_conn_private_data *pdata);
+ *
+ * DESCRIPTION
+ * rpma_conn_req_get_private_data() obtains the pointer to the connection's private data given by
+ * the other side of the connection before the connection is established.
+ *
+ * SECURITY WARNING
+ * See rpma_conn_get_private_data(3).
+ *
+ * RETURN VALUE
+ * The rpma_conn_req_get_private_data() function returns 0 on success or a negative error code on
+ * failure. rpma_conn_req_get_private_data() does not set *pdata value on failure.
+ *
+ * ERRORS
+ * rpma_conn_req_get_private_data() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - req or pdata is NULL
+ *
+ * SEE ALSO
+ * rpma_conn_get_private_data(3), rpma_ep_next_conn_req(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_conn_req_get_private_data(const struct rpma_conn_req *req,
+		struct rpma_conn_private_data *pdata);
+
+/* shared RQ configuration */
+
+struct rpma_srq_cfg;
+
+/** 3
+ * rpma_srq_cfg_new - create a new shared RQ configuration object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq_cfg;
+ *	int rpma_srq_cfg_new(struct rpma_srq_cfg **cfg_ptr);
+ *
+ * DESCRIPTION
+ * rpma_srq_cfg_new() creates a new shared RQ configuration object and fills it with the default
+ * values:
+ *
+ *	.rcq_size = 100
+ *	.rq_size = 100
+ *
+ * Note that rpma_srq_new(3) with the default rcq_size creates its own receive CQ.
+ *
+ * RETURN VALUE
+ * The rpma_srq_cfg_new() function returns 0 on success or a negative error code on failure.
+ * rpma_srq_cfg_new() does not set *cfg_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_srq_cfg_new() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg_ptr is NULL
+ * - RPMA_E_NOMEM - out of memory
+ *
+ * SEE ALSO
+ * rpma_srq_cfg_delete(3), rpma_srq_cfg_get_rcq_size(3), rpma_srq_cfg_get_rq_size(3),
+ * rpma_srq_cfg_set_rcq_size(3), rpma_srq_cfg_set_rq_size(3), rpma_srq_new(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_srq_cfg_new(struct rpma_srq_cfg **cfg_ptr);
+
+/** 3
+ * rpma_srq_cfg_delete - delete the shared RQ configuration object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq_cfg;
+ *	int rpma_srq_cfg_delete(struct rpma_srq_cfg **cfg_ptr);
+ *
+ * DESCRIPTION
+ * rpma_srq_cfg_delete() deletes the shared RQ configuration object.
+ *
+ * RETURN VALUE
+ * The rpma_srq_cfg_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_srq_cfg_delete() sets *cfg_ptr value to NULL on success and on failure.
+ *
+ * ERRORS
+ * rpma_srq_cfg_delete() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg_ptr is NULL
+ *
+ * SEE ALSO
+ * rpma_srq_cfg_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_cfg_delete(struct rpma_srq_cfg **cfg_ptr);
+
+/** 3
+ * rpma_srq_cfg_set_rq_size - set RQ size of the shared RQ
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq_cfg;
+ *	int rpma_srq_cfg_set_rq_size(struct rpma_srq_cfg *cfg, uint32_t rq_size);
+ *
+ * DESCRIPTION
+ * rpma_srq_cfg_set_rq_size() sets the RQ size of the shared RQ. If this function is not called,
+ * the rq_size has the default value (100) set by rpma_srq_cfg_new(3).
+ *
+ * RETURN VALUE
+ * The rpma_srq_cfg_set_rq_size() function returns 0 on success or a negative error code on
+ * failure.
+ *
+ * ERRORS
+ * rpma_srq_cfg_set_rq_size() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg is NULL
+ *
+ * SEE ALSO
+ * rpma_srq_cfg_new(3), rpma_srq_cfg_get_rq_size(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_cfg_set_rq_size(struct rpma_srq_cfg *cfg, uint32_t rq_size);
+
+/** 3
+ * rpma_srq_cfg_get_rq_size - get RQ size of the shared RQ
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq_cfg;
+ *	int rpma_srq_cfg_get_rq_size(const struct rpma_srq_cfg *cfg, uint32_t *rq_size);
+ *
+ * DESCRIPTION
+ * rpma_srq_cfg_get_rq_size() gets the RQ size of the shared RQ.
+ *
+ * RETURN VALUE
+ * The rpma_srq_cfg_get_rq_size() function returns 0 on success or a negative error code on
+ * failure. rpma_srq_cfg_get_rq_size() does not set *rq_size value on failure.
+ *
+ * ERRORS
+ * rpma_srq_cfg_get_rq_size() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg or rq_size is NULL
+ *
+ * SEE ALSO
+ * rpma_srq_cfg_new(3), rpma_srq_cfg_set_rq_size(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_cfg_get_rq_size(const struct rpma_srq_cfg *cfg, uint32_t *rq_size);
+
+/** 3
+ * rpma_srq_cfg_set_rcq_size - set receive CQ size of the shared RQ
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq_cfg;
+ *	int rpma_srq_cfg_set_rcq_size(struct rpma_srq_cfg *cfg, uint32_t rcq_size);
+ *
+ * DESCRIPTION
+ * rpma_srq_cfg_set_rcq_size() sets the receive CQ size of the shared RQ. If this function is not
+ * called, the rcq_size has the default value (100) set by rpma_srq_cfg_new(3).
+ *
+ * Note that rpma_srq_new(3) does not create its own receive CQ if the size of the receive CQ
+ * equals 0.
+ *
+ * RETURN VALUE
+ * The rpma_srq_cfg_set_rcq_size() function returns 0 on success or a negative error code on
+ * failure.
+ *
+ * ERRORS
+ * rpma_srq_cfg_set_rcq_size() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg is NULL
+ *
+ * SEE ALSO
+ * rpma_srq_cfg_get_rcq_size(3), rpma_srq_cfg_new(3), rpma_srq_new(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_srq_cfg_set_rcq_size(struct rpma_srq_cfg *cfg, uint32_t rcq_size);
+
+/** 3
+ * rpma_srq_cfg_get_rcq_size - get receive CQ size of the shared RQ
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq_cfg;
+ *	int rpma_srq_cfg_get_rcq_size(const struct rpma_srq_cfg *cfg, uint32_t *rcq_size);
+ *
+ * DESCRIPTION
+ * rpma_srq_cfg_get_rcq_size() gets the receive CQ size of the shared RQ.
+ *
+ * RETURN VALUE
+ * The rpma_srq_cfg_get_rcq_size() function returns 0 on success or a negative error code on
+ * failure. rpma_srq_cfg_get_rcq_size() does not set *rcq_size value on failure.
+ *
+ * ERRORS
+ * rpma_srq_cfg_get_rcq_size() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - cfg or rcq_size is NULL
+ *
+ * SEE ALSO
+ * rpma_srq_cfg_new(3), rpma_srq_cfg_set_rcq_size(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_cfg_get_rcq_size(const struct rpma_srq_cfg *cfg, uint32_t *rcq_size);
+
+/* shared RQ */
+
+/** 3
+ * rpma_srq_new - create a new shared RQ object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_srq_cfg;
+ *	struct rpma_srq;
+ *	int rpma_srq_new(struct rpma_peer *peer, const struct rpma_srq_cfg *cfg,
+ *			struct rpma_srq **srq_ptr);
+ *
+ * DESCRIPTION
+ * rpma_srq_new() creates a new shared RQ object including a new shared RQ and a new shared receive
+ * CQ. It does not create the shared receive CQ if the size of the receive CQ in cfg equals 0.
+ *
+ * RETURN VALUE
+ * The rpma_srq_new() function returns 0 on success or a negative error code on failure.
+ * rpma_srq_new() does not set *srq_ptr value on failure. If cfg is NULL, then the default values
+ * are used
+ * - see rpma_srq_cfg_new(3) for more details.
+ *
+ * ERRORS
+ * rpma_srq_new() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer or srq_ptr is NULL
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - ibv_create_srq(3), ibv_create_comp_channel(3), ibv_create_cq(3) or
+ *   ibv_req_notify_cq(3) failed
+ *
+ * SEE ALSO
+ * rpma_srq_delete(3), rpma_srq_get_rcq(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_new(struct rpma_peer *peer, struct rpma_srq_cfg *cfg, struct rpma_srq **srq_ptr);
+
+/** 3
+ * rpma_srq_delete - delete the shared RQ object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq;
+ *	int rpma_conn_req_delete(struct rpma_srq **srq_ptr);
+ *
+ * DESCRIPTION
+ * rpma_srq_delete() deletes the shared RQ object.
+ *
+ * RETURN VALUE
+ * The rpma_srq_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_srq_delete() sets *srq_ptr value to NULL on success and on failure.
+ *
+ * ERRORS
+ * rpma_srq_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - srq_ptr is NULL
+ * - RPMA_E_PROVIDER - ibv_destroy_cq(3), ibv_destroy_comp_channel(3), or ibv_destroy_srq(3) failed
+ *
+ * SEE ALSO
+ * rpma_srq_new(3), rpma_srq_get_rcq(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_delete(struct rpma_srq **srq_ptr);
+
+/** 3
+ * rpma_srq_recv - initiate the receive operation in shared RQ
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq;
+ *	struct rpma_mr_local;
+ *	int rpma_srq_recv(struct rpma_srq *srq, struct rpma_mr_local *dst, size_t offset,
+ *			size_t len, const void *op_context);
+ *
+ * DESCRIPTION
+ * If multiple local connections use a shared RQ, rpma_srq_recv() initiates the receive operation
+ * which prepares a buffer for a message sent from other side of these connections. Please see
+ * rpma_send(3).
+ *
+ * All buffers prepared via rpma_srq_recv(3) form an unordered set. When a message arrives it is
+ * placed in one of the buffers awaiting and a completion for the receive operation is generated.
+ *
+ * A buffer for an incoming message has to be prepared beforehand.
+ *
+ * The order of buffers in the set does not affect the order of completions of the receive
+ * operations got via rpma_cq_get_wc(3).
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * NOTE
+ * In the RDMA standard, receive requests form an ordered queue.
+ * The librpma library does NOT inherit this guarantee.
+ *
+ * RETURN VALUE
+ * The rpma_srq_recv() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_srq_recv() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - srq == NULL
+ * - RPMA_E_INVAL - dst == NULL && (offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_srq_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_mr_reg(3), rpma_srq_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_recv(struct rpma_srq *srq, struct rpma_mr_local *dst, size_t offset, size_t len,
+	const void *op_context);
+
+/** 3
+ * rpma_srq_get_rcq -- get the receive CQ from the shared RQ object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_srq;
+ *	struct rpma_cq;
+ *	int rpma_srq_get_rcq(const struct rpma_srq *srq, struct rpma_cq **rcq_ptr);
+ *
+ * DESCRIPTION
+ * rpma_srq_get_rcq() gets the receive CQ from the shared RQ object. The receive CQ created by
+ * rpma_srq_new(3) allows handling all rpma_srq_recv(3) completions within the shared RQ.
+ * rpma_srq_cfg_set_rcq_size(3) can change the receive CQ size.
+ *
+ * RETURN VALUE
+ * The rpma_srq_get_rcq() function returns 0 on success or a negative error code on failure.
+ * rpma_srq_get_rcq() does not set *rcq_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_srq_get_rcq() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - srq or rcq_ptr is NULL
+ *
+ * SEE ALSO
+ * rpma_cq_wait(3), rpma_cq_get_wc(3), rpma_cq_get_fd(3), rpma_srq_cfg_set_rcq_size(3),
+ * rpma_srq_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_srq_get_rcq(const struct rpma_srq *srq, struct rpma_cq **rcq_ptr);
+
+/* remote memory access functions */
+
+/* generate operation completion on error */
+#define RPMA_F_COMPLETION_ON_ERROR	(1 << 0)
+/* generate operation completion regardless of its result */
+#define RPMA_F_COMPLETION_ALWAYS	(1 << 1 | RPMA_F_COMPLETION_ON_ERROR)
+
+/** 3
+ * rpma_read - initiate the read operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_local;
+ *	struct rpma_mr_remote;
+ *	int rpma_read(struct rpma_conn *conn,
+ *			struct rpma_mr_local *dst, size_t dst_offset,
+ *			const struct rpma_mr_remote *src, size_t src_offset,
+ *			size_t len, int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_read() initiates transferring data from the remote memory to the local memory. To read a 0
+ * bytes message, set src and dst to NULL and src_offset, dst_offset and len to 0.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_read() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_read() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn == NULL || flags == 0
+ * - RPMA_E_INVAL - dst == NULL && (src != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
+ * - RPMA_E_INVAL - src == NULL && (dst != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_read(struct rpma_conn *conn,
+		struct rpma_mr_local *dst, size_t dst_offset,
+		const struct rpma_mr_remote *src, size_t src_offset,
+		size_t len, int flags, const void *op_context);
+
+/** 3
+ * rpma_write - initiate the write operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_local;
+ *	struct rpma_mr_remote;
+ *	int rpma_write(struct rpma_conn *conn,
+ *			struct rpma_mr_remote *dst, size_t dst_offset,
+ *			const struct rpma_mr_local *src, size_t src_offset,
+ *			size_t len, int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_write() initiates transferring data from the local memory to the remote memory. To write
+ * a 0 bytes message, set src and dst to NULL and src_offset, dst_offset and len to 0.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_write() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_write() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn == NULL || flags == 0
+ * - RPMA_E_INVAL - dst == NULL && (src != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
+ * - RPMA_E_INVAL - src == NULL && (dst != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_write(struct rpma_conn *conn,
+		struct rpma_mr_remote *dst, size_t dst_offset,
+		const struct rpma_mr_local *src, size_t src_offset,
+		size_t len, int flags, const void *op_context);
+
+/** 3
+ * rpma_write_with_imm - initiate the write operation with immediate data
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_local;
+ *	struct rpma_mr_remote;
+ *	int rpma_write_with_imm(struct rpma_conn *conn,
+ *			struct rpma_mr_remote *dst, size_t dst_offset,
+ *			const struct rpma_mr_local *src, size_t src_offset,
+ *			size_t len, int flags, uint32_t imm,
+ *			const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_write_with_imm() initiates the write operation with immediate data (transferring data from
+ * the local memory to the remote memory. To write a 0 bytes message, set src and dst to NULL and
+ * src_offset, dst_offset and len to 0.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_write_with_imm() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_write_with_imm() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn == NULL || flags == 0
+ * - RPMA_E_INVAL - dst == NULL && (src != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
+ * - RPMA_E_INVAL - src == NULL && (dst != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_write_with_imm(struct rpma_conn *conn,
+		struct rpma_mr_remote *dst, size_t dst_offset,
+		const struct rpma_mr_local *src, size_t src_offset,
+		size_t len, int flags, uint32_t imm, const void *op_context);
+
+#define RPMA_ATOMIC_WRITE_ALIGNMENT 8
+
+/** 3
+ * rpma_atomic_write -- initiate the atomic 8 bytes write operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_remote;
+ *	int rpma_atomic_write(struct rpma_conn *conn,
+ *			struct rpma_mr_remote *dst, size_t dst_offset,
+ *			const char src[8], int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_atomic_write() initiates the atomic 8 bytes write operation (transferring data from
+ * the local memory to the remote memory). The atomic write operation allows transferring exactly 8
+ * bytes of data and storing them atomically in the remote memory.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_atomic_write() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_atomic_write() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn, dst or src is NULL
+ * - RPMA_E_INVAL - dst_offset is not aligned to 8 bytes
+ * - RPMA_E_INVAL - flags are not set (flags == 0)
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_atomic_write(struct rpma_conn *conn,
+	struct rpma_mr_remote *dst, size_t dst_offset,
+	const char src[8], int flags, const void *op_context);
+
+/*
+ * possible types of rpma_flush() operation
+ */
+enum rpma_flush_type {
+	/* flush data down to the persistent domain */
+	RPMA_FLUSH_TYPE_PERSISTENT,
+	/* flush data deep enough to make it visible on the remote node */
+	RPMA_FLUSH_TYPE_VISIBILITY,
+};
+
+/** 3
+ * rpma_flush - initiate the flush operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_remote;
+ *	enum rpma_flush_type {
+ *		RPMA_FLUSH_TYPE_PERSISTENT,
+ *		RPMA_FLUSH_TYPE_VISIBILITY,
+ *	};
+ *
+ *	int rpma_flush(struct rpma_conn *conn,
+ *			struct rpma_mr_remote *dst, size_t dst_offset,
+ *			size_t len, enum rpma_flush_type type, int flags,
+ *			const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_flush() initiates the flush operation (finalizing a transfer of data to the remote memory).
+ * Possible types of rpma_flush() operation:
+ * - RPMA_FLUSH_TYPE_PERSISTENT - flush data down to the persistent domain
+ * - RPMA_FLUSH_TYPE_VISIBILITY - flush data deep enough to make it visible on the remote node
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_flush() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_flush() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn or dst is NULL
+ * - RPMA_E_INVAL - unknown type value
+ * - RPMA_E_INVAL - flags are not set
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_NOSUPP - type is RPMA_FLUSH_TYPE_PERSISTENT and the direct write to pmem is not
+ *   supported
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_flush(struct rpma_conn *conn,
+		struct rpma_mr_remote *dst, size_t dst_offset, size_t len,
+		enum rpma_flush_type type, int flags, const void *op_context);
+
+/** 3
+ * rpma_send - initiate the send operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_local;
+ *	int rpma_send(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset,
+ *			size_t len, int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_send() initiates the send operation which transfers a message from the local memory to
+ * other side of the connection. To send a 0 byte message, set src to NULL and both offset and len
+ * to 0.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_send() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_send() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn == NULL || flags == 0
+ * - RPMA_E_INVAL - src == NULL && (offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_send(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset, size_t len,
+		int flags, const void *op_context);
+
+/** 3
+ * rpma_send_with_imm - initiate the send operation with immediate data
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_local;
+ *	int rpma_send_with_imm(struct rpma_conn *conn, const struct rpma_mr_local *src,
+ *			size_t offset, size_t len, int flags, uint32_t imm,
+ *			const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_send_with_imm() initiates the send operation with immediate data which transfers a message
+ * from the local memory to other side of the connection. To send a 0 byte message, set src to NULL
+ * and both offset and len to 0.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_send_with_imm() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_send_with_imm() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn == NULL || flags == 0
+ * - RPMA_E_INVAL - src == NULL && (offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_send_with_imm(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset,
+	size_t len, int flags, uint32_t imm, const void *op_context);
+
+/** 3
+ * rpma_recv - initiate the receive operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_conn;
+ *	struct rpma_mr_local;
+ *	int rpma_recv(struct rpma_conn *conn, struct rpma_mr_local *dst, size_t offset, size_t len,
+ *			const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_recv() initiates the receive operation which prepares a buffer for a message sent from
+ * other side of the connection. Please see rpma_send(3).
+ *
+ * All buffers prepared via rpma_recv(3) form an unordered set. When a message arrives it is placed
+ * in one of the buffers awaitaning and a completion for the receive operation is generated.
+ *
+ * A buffer for an incoming message have to be prepared beforehand.
+ *
+ * The order of buffers in the set does not affect the order of completions of receive operations
+ * get via rpma_cq_get_wc(3).
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * NOTE
+ * In the RDMA standard, receive requests form an ordered queue.
+ * The RPMA does NOT inherit this guarantee.
+ *
+ * RETURN VALUE
+ * The rpma_recv() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_recv() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - conn == NULL
+ * - RPMA_E_INVAL - dst == NULL && (offset != 0 || len != 0)
+ * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_recv(struct rpma_conn *conn, struct rpma_mr_local *dst, size_t offset, size_t len,
+		const void *op_context);
+
+/* ring-buffer messaging */
+
+struct rpma_ring;
+
+/** 3
+ * rpma_ring_new - create a new ring-buffer messaging object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_ring;
+ *	int rpma_ring_new(struct rpma_peer *peer, size_t size, struct rpma_ring **ring_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ring_new() allocates and registers a receive ring of the given size. The peer writes
+ * messages directly into the receive ring using RDMA writes with immediate data, so no receive
+ * buffer has to be prepared per message. The size has to be a power of two between 64 and 2^31.
+ *
+ * The ring descriptor (see rpma_ring_get_descriptor(3)) has to be delivered to the other side of
+ * the connection, e.g. as the connection's private data, and then both sides attach their rings
+ * to the connection using rpma_ring_attach(3).
+ *
+ * RETURN VALUE
+ * The rpma_ring_new() function returns 0 on success or a negative error code on failure.
+ * rpma_ring_new() does not set *ring_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_ring_new() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer or ring_ptr is NULL or size is not a power of two between 64 and 2^31
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - memory registration failed
+ *
+ * SEE ALSO
+ * rpma_peer_new(3), rpma_ring_attach(3), rpma_ring_delete(3), rpma_ring_get_descriptor(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ring_new(struct rpma_peer *peer, size_t size, struct rpma_ring **ring_ptr);
+
+/** 3
+ * rpma_ring_delete - delete the ring-buffer messaging object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	int rpma_ring_delete(struct rpma_ring **ring_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ring_delete() deregisters and frees the ring-buffer messaging object. It has to be called
+ * after the connection the ring is attached to is disconnected.
+ *
+ * RETURN VALUE
+ * The rpma_ring_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_ring_delete() does not set *ring_ptr value to NULL on failure.
+ *
+ * ERRORS
+ * rpma_ring_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ring_ptr is NULL
+ * - RPMA_E_PROVIDER - memory deregistration failed
+ *
+ * SEE ALSO
+ * rpma_ring_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ring_delete(struct rpma_ring **ring_ptr);
+
+/** 3
+ * rpma_ring_get_descriptor_size - get the size of the ring descriptor
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	int rpma_ring_get_descriptor_size(const struct rpma_ring *ring, size_t *desc_size);
+ *
+ * DESCRIPTION
+ * rpma_ring_get_descriptor_size() gets the size of the ring descriptor.
+ *
+ * RETURN VALUE
+ * The rpma_ring_get_descriptor_size() function returns 0 on success or a negative error code on
+ * failure. rpma_ring_get_descriptor_size() does not set *desc_size value on failure.
+ *
+ * ERRORS
+ * rpma_ring_get_descriptor_size() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - ring or desc_size is NULL
+ *
+ * SEE ALSO
+ * rpma_ring_new(3), rpma_ring_get_descriptor(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ring_get_descriptor_size(const struct rpma_ring *ring, size_t *desc_size);
+
+/** 3
+ * rpma_ring_get_descriptor - get the descriptor of the ring
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	int rpma_ring_get_descriptor(const struct rpma_ring *ring, void *desc);
+ *
+ * DESCRIPTION
+ * rpma_ring_get_descriptor() writes a network-transferable description of the receive ring into
+ * desc. The buffer has to be at least rpma_ring_get_descriptor_size(3) bytes long. The other side
+ * of the connection uses the descriptor in rpma_ring_attach(3).
+ *
+ * RETURN VALUE
+ * The rpma_ring_get_descriptor() function returns 0 on success or a negative error code on
+ * failure.
+ *
+ * ERRORS
+ * rpma_ring_get_descriptor() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - ring or desc is NULL
+ *
+ * SEE ALSO
+ * rpma_ring_new(3), rpma_ring_get_descriptor_size(3), rpma_ring_attach(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_ring_get_descriptor(const struct rpma_ring *ring, void *desc);
+
+/** 3
+ * rpma_ring_attach - attach the ring to the connection and the remote ring
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	struct rpma_conn;
+ *	int rpma_ring_attach(struct rpma_ring *ring, struct rpma_conn *conn, const void *desc,
+ *			size_t desc_size, uint32_t recv_num);
+ *
+ * DESCRIPTION
+ * rpma_ring_attach() attaches the ring to the connection and to the remote ring described by desc
+ * (obtained from the other side of the connection via rpma_ring_get_descriptor(3)). It registers
+ * a local staging buffer of the size of the remote ring and prepares recv_num zero-length receives
+ * (see rpma_recv(3)) consumed by the incoming notifications. recv_num must not exceed the RQ
+ * size of the connection (see rpma_conn_cfg_set_rq_size(3)) and it is checked before any receive
+ * is posted.
+ *
+ * The ring can be attached only once.
+ *
+ * RETURN VALUE
+ * The rpma_ring_attach() function returns 0 on success or a negative error code on failure.
+ * If posting the receives fails after some of them have been posted, rpma_ring_attach()
+ * disconnects the connection (see rpma_conn_disconnect(3)), so the posted receives are flushed.
+ * Their completions (with the IBV_WC_WR_FLUSH_ERR status and the wr_id equal to the ring
+ * pointer) have to be ignored and the connection has to be deleted.
+ *
+ * ERRORS
+ * rpma_ring_attach() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ring, conn or desc is NULL
+ * - RPMA_E_INVAL - the ring is already attached
+ * - RPMA_E_INVAL - desc does not describe a valid ring
+ * - RPMA_E_INVAL - recv_num is greater than the RQ size of the connection
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - ibv_query_qp(3), memory registration or ibv_post_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_ring_new(3), rpma_ring_get_descriptor(3), rpma_ring_send(3), rpma_ring_recv(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ring_attach(struct rpma_ring *ring, struct rpma_conn *conn, const void *desc,
+		size_t desc_size, uint32_t recv_num);
+
+/** 3
+ * rpma_ring_send - send a message via the remote ring
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	int rpma_ring_send(struct rpma_ring *ring, const void *msg, size_t len, int flags,
+ *			const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_ring_send() copies the message into the local staging buffer and writes it contiguously
+ * into the remote ring using rpma_write_with_imm(3). The immediate data carries the new head
+ * index of the remote ring and it notifies the other side about the message. The message cannot
+ * be longer than a quarter of the remote ring.
+ *
+ * The space of the remote ring is returned by the other side via periodic RDMA writes, see
+ * rpma_ring_release(3). If there is no space for the message in the remote ring, the function
+ * fails with RPMA_E_AGAIN and it should be retried later.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ *
+ * RETURN VALUE
+ * The rpma_ring_send() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_ring_send() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ring is NULL or it is not attached, flags == 0
+ * - RPMA_E_INVAL - msg == NULL && len != 0
+ * - RPMA_E_INVAL - len is greater than a quarter of the remote ring
+ * - RPMA_E_AGAIN - no space in the remote ring
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_ring_attach(3), rpma_ring_recv(3), rpma_write_with_imm(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_ring_send(struct rpma_ring *ring, const void *msg, size_t len, int flags,
+		const void *op_context);
+
+/** 3
+ * rpma_ring_recv - get a message notified by the completion
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	struct ibv_wc;
+ *	int rpma_ring_recv(struct rpma_ring *ring, const struct ibv_wc *wc, const void **msg_ptr,
+ *			size_t *len_ptr);
+ *
+ * DESCRIPTION
+ * rpma_ring_recv() decodes the message notified by the IBV_WC_RECV_RDMA_WITH_IMM completion
+ * collected via rpma_cq_get_wc(3). The wr_id of such completion is equal to the ring pointer.
+ * The completions have to be passed in the order they were collected. The message is not copied,
+ * *msg_ptr points into the receive ring and it stays valid until rpma_ring_release(3) is called.
+ * The receive consumed by the notification is replaced with a new one.
+ *
+ * RETURN VALUE
+ * The rpma_ring_recv() function returns 0 on success or a negative error code on failure.
+ * rpma_ring_recv() does not set *msg_ptr and *len_ptr values on failure.
+ *
+ * ERRORS
+ * rpma_ring_recv() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ring, wc, msg_ptr or len_ptr is NULL or the ring is not attached
+ * - RPMA_E_INVAL - wc is not a completion of a write with immediate data
+ * - RPMA_E_INVAL - the immediate data is not a valid head of the ring
+ * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_cq_get_wc(3), rpma_ring_attach(3), rpma_ring_release(3), rpma_ring_send(3), librpma(7)
+ * and https://pmem.io/rpma/
+ */
+int rpma_ring_recv(struct rpma_ring *ring, const struct ibv_wc *wc, const void **msg_ptr,
+		size_t *len_ptr);
+
+/** 3
+ * rpma_ring_release - release the received messages
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_ring;
+ *	int rpma_ring_release(struct rpma_ring *ring);
+ *
+ * DESCRIPTION
+ * rpma_ring_release() releases all messages got so far via rpma_ring_recv(3). When the released
+ * space reaches a quarter of the ring, it is returned to the other side of the connection using
+ * an RDMA write generating a completion only on error (with the wr_id equal to 0). Note that
+ * as for any other operation posted without RPMA_F_COMPLETION_ALWAYS the application has to
+ * generate signaled completions on the connection from time to time to keep the send queue
+ * from overflowing.
+ *
+ * RETURN VALUE
+ * The rpma_ring_release() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_ring_release() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ring is NULL or it is not attached
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_ring_recv(3), rpma_ring_send(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_ring_release(struct rpma_ring *ring);
+
+/* rendezvous messaging */
+
+struct rpma_rndv;
+
+/* the minimum size of a receive buffer for rendezvous messages other than eager ones */
+#define RPMA_RNDV_RTS_SIZE 64
+
+enum rpma_rndv_msg_type {
+	RPMA_RNDV_EAGER,	/* the payload is in the receive buffer */
+	RPMA_RNDV_RTS,		/* the payload has to be pulled with rpma_rndv_pull(3) */
+	RPMA_RNDV_FIN		/* the message sent by rpma_rndv_send(3) has been pulled */
+};
+
+/** 3
+ * rpma_rndv_new - create a new rendezvous messaging object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_conn;
+ *	struct rpma_rndv;
+ *	int rpma_rndv_new(struct rpma_peer *peer, struct rpma_conn *conn,
+ *			struct rpma_rndv **rndv_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rndv_new() creates a rendezvous messaging object for the connection. Messages not longer
+ * than the threshold (see rpma_rndv_set_threshold(3)) are sent eagerly using
+ * rpma_send_with_imm(3). A longer message is only announced to the other side with a small
+ * request-to-send (RTS) message and the receiver pulls it directly from the sender's memory
+ * region with an RDMA read (see rpma_rndv_pull(3)), so no receive buffer of the size of
+ * the largest message is required.
+ *
+ * Both sides of the connection have to use rendezvous messaging objects. The receive buffers
+ * posted with rpma_recv(3) have to be at least RPMA_RNDV_RTS_SIZE bytes long and long enough
+ * for the eager messages.
+ *
+ * RETURN VALUE
+ * The rpma_rndv_new() function returns 0 on success or a negative error code on failure.
+ * rpma_rndv_new() does not set *rndv_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_rndv_new() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer, conn or rndv_ptr is NULL
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - memory registration failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_rndv_delete(3), rpma_rndv_send(3), rpma_rndv_recv(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rndv_new(struct rpma_peer *peer, struct rpma_conn *conn, struct rpma_rndv **rndv_ptr);
+
+/** 3
+ * rpma_rndv_delete - delete the rendezvous messaging object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rndv;
+ *	int rpma_rndv_delete(struct rpma_rndv **rndv_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rndv_delete() deregisters and frees the rendezvous messaging object. It has to be called
+ * after the connection is disconnected.
+ *
+ * RETURN VALUE
+ * The rpma_rndv_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_rndv_delete() sets *rndv_ptr value to NULL on success and on failure.
+ *
+ * ERRORS
+ * rpma_rndv_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rndv_ptr is NULL
+ * - RPMA_E_PROVIDER - memory deregistration failed
+ *
+ * SEE ALSO
+ * rpma_rndv_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rndv_delete(struct rpma_rndv **rndv_ptr);
+
+/** 3
+ * rpma_rndv_set_threshold - set the maximum length of an eager message
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rndv;
+ *	int rpma_rndv_set_threshold(struct rpma_rndv *rndv, size_t threshold);
+ *
+ * DESCRIPTION
+ * rpma_rndv_set_threshold() sets the maximum length of a message sent eagerly by
+ * rpma_rndv_send(3). The threshold can be changed at any time and it affects only the messages
+ * sent afterwards. The threshold should not exceed the size of the receive buffers of the other
+ * side of the connection. The default threshold is 4096 bytes.
+ *
+ * RETURN VALUE
+ * The rpma_rndv_set_threshold() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_rndv_set_threshold() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - rndv is NULL
+ *
+ * SEE ALSO
+ * rpma_rndv_get_threshold(3), rpma_rndv_new(3), rpma_rndv_send(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_rndv_set_threshold(struct rpma_rndv *rndv, size_t threshold);
+
+/** 3
+ * rpma_rndv_get_threshold - get the maximum length of an eager message
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rndv;
+ *	int rpma_rndv_get_threshold(const struct rpma_rndv *rndv, size_t *threshold);
+ *
+ * DESCRIPTION
+ * rpma_rndv_get_threshold() gets the maximum length of a message sent eagerly by
+ * rpma_rndv_send(3).
+ *
+ * RETURN VALUE
+ * The rpma_rndv_get_threshold() function returns 0 on success or a negative error code
+ * on failure. rpma_rndv_get_threshold() does not set *threshold value on failure.
+ *
+ * ERRORS
+ * rpma_rndv_get_threshold() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - rndv or threshold is NULL
+ *
+ * SEE ALSO
+ * rpma_rndv_new(3), rpma_rndv_set_threshold(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rndv_get_threshold(const struct rpma_rndv *rndv, size_t *threshold);
+
+/** 3
+ * rpma_rndv_send - send a message eagerly or via the rendezvous
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rndv;
+ *	struct rpma_mr_local;
+ *	int rpma_rndv_send(struct rpma_rndv *rndv, const struct rpma_mr_local *src,
+ *			size_t offset, size_t len, int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_rndv_send() sends the len bytes of the src memory region starting at offset.
+ * If len does not exceed the threshold (see rpma_rndv_set_threshold(3)), the message is sent
+ * eagerly using rpma_send_with_imm(3) and the flags and op_context are used as there.
+ *
+ * Otherwise only the RTS message describing the source memory region is sent and the other side
+ * pulls the payload using rpma_rndv_pull(3). The src memory region has to be registered with
+ * the RPMA_MR_USAGE_READ_SRC usage and it must not be modified until the FIN message is
+ * received and decoded by rpma_rndv_recv(3), which returns op_context of the send. In this
+ * case flags are ignored and a completion of the send is generated only on error (with
+ * the wr_id equal to 0). At most 64 messages can be pulled at the same time.
+ *
+ * RETURN VALUE
+ * The rpma_rndv_send() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_rndv_send() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rndv is NULL, flags == 0
+ * - RPMA_E_INVAL - src == NULL && (offset != 0 || len != 0)
+ * - RPMA_E_AGAIN - too many messages are waiting to be pulled
+ * - RPMA_E_NOSUPP - the descriptor of src does not fit into the RTS message
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_mr_reg(3), rpma_rndv_new(3), rpma_rndv_pull(3), rpma_rndv_recv(3),
+ * rpma_send_with_imm(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rndv_send(struct rpma_rndv *rndv, const struct rpma_mr_local *src, size_t offset,
+		size_t len, int flags, const void *op_context);
+
+/** 3
+ * rpma_rndv_recv - decode a received rendezvous message
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rndv;
+ *	struct ibv_wc;
+ *	enum rpma_rndv_msg_type {
+ *		RPMA_RNDV_EAGER,
+ *		RPMA_RNDV_RTS,
+ *		RPMA_RNDV_FIN
+ *	};
+ *
+ *	int rpma_rndv_recv(struct rpma_rndv *rndv, const struct ibv_wc *wc, const void *buf,
+ *			enum rpma_rndv_msg_type *type, size_t *len, const void **op_context);
+ *
+ * DESCRIPTION
+ * rpma_rndv_recv() decodes the message received into buf as notified by the IBV_WC_RECV
+ * completion wc collected via rpma_cq_get_wc(3). The type of the message is one of:
+ *
+ * - RPMA_RNDV_EAGER - the payload of *len bytes is in buf
+ *
+ * - RPMA_RNDV_RTS - the payload of *len bytes has to be pulled using rpma_rndv_pull(3)
+ * before buf is reused
+ *
+ * - RPMA_RNDV_FIN - the message of *len bytes sent by rpma_rndv_send(3) with *op_context
+ * has been pulled by the other side and its source memory region can be reused
+ *
+ * *op_context is set to NULL for the message types other than RPMA_RNDV_FIN.
+ * The receive buffer is not needed after rpma_rndv_recv() returns for the RPMA_RNDV_FIN
+ * message type.
+ *
+ * RETURN VALUE
+ * The rpma_rndv_recv() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_rndv_recv() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rndv, wc, type, len or op_context is NULL
+ * - RPMA_E_INVAL - wc is not a completion of a receive with immediate data
+ * - RPMA_E_INVAL - the message is not a valid rendezvous message
+ *
+ * SEE ALSO
+ * rpma_cq_get_wc(3), rpma_recv(3), rpma_rndv_pull(3), rpma_rndv_send(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_rndv_recv(struct rpma_rndv *rndv, const struct ibv_wc *wc, const void *buf,
+		enum rpma_rndv_msg_type *type, size_t *len, const void **op_context);
+
+/** 3
+ * rpma_rndv_pull - pull the announced message
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rndv;
+ *	struct rpma_mr_local;
+ *	int rpma_rndv_pull(struct rpma_rndv *rndv, const void *buf, struct rpma_mr_local *dst,
+ *			size_t dst_offset, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_rndv_pull() reads the payload announced by the RTS message received into buf
+ * (see rpma_rndv_recv(3)) into the dst memory region starting at dst_offset using rpma_read(3).
+ * The completion of the read (with the wr_id equal to op_context) is always generated.
+ * Then the FIN message is posted with a fence, so it is sent to the other side only after
+ * the read is completed. The FIN message generates a completion only on error (with the wr_id
+ * equal to 0). buf can be reused after rpma_rndv_pull() returns.
+ *
+ * RETURN VALUE
+ * The rpma_rndv_pull() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_rndv_pull() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rndv, buf or dst is NULL
+ * - RPMA_E_INVAL - buf does not contain a valid RTS message
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_read(3), rpma_rndv_recv(3), rpma_rndv_send(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rndv_pull(struct rpma_rndv *rndv, const void *buf, struct rpma_mr_local *dst,
+		size_t dst_offset, const void *op_context);
+
+/* fragmented messaging */
+
+struct rpma_frag;
+
+/** 3
+ * rpma_frag_new - create a new fragmented messaging object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_conn;
+ *	struct rpma_frag;
+ *	int rpma_frag_new(struct rpma_peer *peer, struct rpma_conn *conn, size_t frag_size,
+ *			uint32_t depth, struct rpma_frag **frag_ptr);
+ *
+ * DESCRIPTION
+ * rpma_frag_new() creates an object sending and receiving messages longer than a single receive
+ * buffer over the connection. A message is split into fragments of up to frag_size bytes sent
+ * with rpma_send_with_imm(3) and up to depth fragments are in flight at the same time.
+ *
+ * rpma_frag_new() registers a pool of depth receive buffers of frag_size bytes and posts
+ * the receives for all of them (see rpma_recv(3)) with the op_context equal to the frag
+ * pointer. Both sides of the connection have to use the same frag_size and depth, and the send
+ * and receive queues of the connection have to be at least depth long (see
+ * rpma_conn_cfg_set_sq_size(3) and rpma_conn_cfg_set_rq_size(3)). The length of the receive
+ * queue is checked before any receive is posted. Other receives must not be posted on
+ * the connection.
+ *
+ * RETURN VALUE
+ * The rpma_frag_new() function returns 0 on success or a negative error code on failure.
+ * rpma_frag_new() does not set *frag_ptr value on failure. If posting the receives fails after
+ * some of them have been posted, rpma_frag_new() disconnects the connection (see
+ * rpma_conn_disconnect(3)), so the posted receives are flushed before their buffers are freed.
+ * Their completions (with the IBV_WC_WR_FLUSH_ERR status and the wr_id equal to the freed frag
+ * pointer) have to be ignored and the connection has to be deleted.
+ *
+ * ERRORS
+ * rpma_frag_new() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer, conn or frag_ptr is NULL
+ * - RPMA_E_INVAL - frag_size or depth is 0 or frag_size is greater than UINT32_MAX
+ * - RPMA_E_INVAL - depth is greater than the length of the receive queue of the connection
+ * - RPMA_E_NOMEM - out of memory
+ * - RPMA_E_PROVIDER - ibv_query_qp(3), memory registration or ibv_post_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_conn_req_connect(3), rpma_frag_delete(3), rpma_frag_recv(3), rpma_frag_send(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_frag_new(struct rpma_peer *peer, struct rpma_conn *conn, size_t frag_size,
+		uint32_t depth, struct rpma_frag **frag_ptr);
+
+/** 3
+ * rpma_frag_delete - delete the fragmented messaging object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_frag;
+ *	int rpma_frag_delete(struct rpma_frag **frag_ptr);
+ *
+ * DESCRIPTION
+ * rpma_frag_delete() deregisters and frees the fragmented messaging object. It has to be called
+ * after the connection is disconnected.
+ *
+ * RETURN VALUE
+ * The rpma_frag_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_frag_delete() sets *frag_ptr value to NULL on success and on failure.
+ *
+ * ERRORS
+ * rpma_frag_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - frag_ptr is NULL
+ * - RPMA_E_PROVIDER - memory deregistration failed
+ *
+ * SEE ALSO
+ * rpma_frag_new(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_write(struct rpma_conn *conn,
-		struct rpma_mr_remote *dst, size_t dst_offset,
-		const struct rpma_mr_local *src, size_t src_offset,
-		size_t len, int flags, const void *op_context);
+int rpma_frag_delete(struct rpma_frag **frag_ptr);
+
+/** 3
+ * rpma_frag_send - start sending a message in fragments
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_frag;
+ *	struct rpma_mr_local;
+ *	int rpma_frag_send(struct rpma_frag *frag, const struct rpma_mr_local *src,
+ *			size_t offset, size_t len, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_frag_send() starts sending the len bytes of the src memory region starting at offset.
+ * The fragments are sent straight from src (registered with the RPMA_MR_USAGE_SEND usage),
+ * so the memory must not be modified until the whole message is sent. The first depth
+ * fragments are posted right away and the following ones are posted by
+ * rpma_frag_send_progress(3) as the previous fragments complete. Only one message can be sent
+ * at a time.
+ *
+ * If posting a fragment fails after some fragments of the message have been posted,
+ * the message is aborted: the rest of it is not sent and the receiving side is notified that
+ * the message is aborted (see rpma_frag_recv(3)). In this case rpma_frag_send() still returns 0
+ * and the failure is reported by rpma_frag_send_progress(3) along with the completion of
+ * the last fragment in flight.
+ *
+ * RETURN VALUE
+ * The rpma_frag_send() function returns 0 on success or a negative error code on failure.
+ * If rpma_frag_send() fails, nothing of the message has been sent.
+ *
+ * ERRORS
+ * rpma_frag_send() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - frag is NULL
+ * - RPMA_E_INVAL - src == NULL && (offset != 0 || len != 0)
+ * - RPMA_E_INVAL - the message consists of more than UINT32_MAX fragments
+ * - RPMA_E_AGAIN - the previous message is still being sent
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_frag_new(3), rpma_frag_recv(3), rpma_frag_send_progress(3), rpma_mr_reg(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_frag_send(struct rpma_frag *frag, const struct rpma_mr_local *src, size_t offset,
+		size_t len, const void *op_context);
+
+/** 3
+ * rpma_frag_send_progress - handle a completion of a sent fragment
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_frag;
+ *	struct ibv_wc;
+ *	int rpma_frag_send_progress(struct rpma_frag *frag, const struct ibv_wc *wc, bool *done,
+ *			const void **op_context);
+ *
+ * DESCRIPTION
+ * rpma_frag_send_progress() handles the successful IBV_WC_SEND completion of a fragment
+ * collected via rpma_cq_get_wc(3). The wr_id of such completion is equal to the frag pointer.
+ * If there are fragments of the message not posted yet, the next one is posted. When all
+ * fragments of the message are completed *done is set to true and *op_context is set to
+ * the op_context passed to rpma_frag_send(3), otherwise *done is set to false and *op_context
+ * is set to NULL.
+ *
+ * If posting the next fragment fails, the message is aborted (see rpma_frag_send(3)) but it is
+ * still being sent until all its fragments in flight are completed, so another message cannot
+ * be sent in the meantime.
+ *
+ * RETURN VALUE
+ * The rpma_frag_send_progress() function returns 0 on success or a negative error code on
+ * failure. When the last fragment in flight of an aborted message is completed, the function
+ * sets *done and *op_context as described above and returns the error which has aborted
+ * the message.
+ *
+ * ERRORS
+ * rpma_frag_send_progress() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - frag, wc, done or op_context is NULL
+ * - RPMA_E_INVAL - wc is not a completion of a fragment being sent
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed and the message is aborted
+ *
+ * SEE ALSO
+ * rpma_cq_get_wc(3), rpma_frag_send(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_frag_send_progress(struct rpma_frag *frag, const struct ibv_wc *wc, bool *done,
+		const void **op_context);
+
+/** 3
+ * rpma_frag_recv - reassemble a received fragment
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_frag;
+ *	struct ibv_wc;
+ *	int rpma_frag_recv(struct rpma_frag *frag, const struct ibv_wc *wc, void *dst,
+ *			size_t dst_size, bool *done, size_t *len);
+ *
+ * DESCRIPTION
+ * rpma_frag_recv() handles the IBV_WC_RECV completion of a fragment collected via
+ * rpma_cq_get_wc(3). The wr_id of such completion is equal to the frag pointer.
+ * The completions have to be passed in the order they were collected and the same dst has to
+ * be passed for all fragments of a message. The fragment is copied into dst right after
+ * the previous fragments of the message and its receive buffer is posted again. The fragments
+ * are received into the registered pool of rpma_frag_new(3) rather than straight into dst
+ * because the receives are posted before the destination of the next message is known. *len is set
+ * to the number of bytes of the message reassembled so far and *done is set to true when
+ * the last fragment of the message is received.
+ *
+ * If the message does not fit into dst_size bytes or the sender aborts it (see
+ * rpma_frag_send(3)), the function fails once with RPMA_E_INVAL and the rest of the message
+ * is dropped. If the fragment is out of sequence, the function fails with RPMA_E_INVAL,
+ * the message reassembled so far is dropped and the reassembly resumes with the next message.
+ * The receive buffer of the fragment is posted again and the fragment is consumed in all
+ * these cases, so the next completion can be passed right away.
+ *
+ * RETURN VALUE
+ * The rpma_frag_recv() function returns 0 on success or a negative error code on failure.
+ * If posting the receive buffer again fails, the fragment is still handled as described above
+ * (including *done and *len) and the function returns RPMA_E_PROVIDER.
+ *
+ * ERRORS
+ * rpma_frag_recv() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - frag, wc, done or len is NULL or dst is NULL and dst_size != 0
+ * - RPMA_E_INVAL - wc is not a completion of a receive of a fragment
+ * - RPMA_E_INVAL - the fragment is out of sequence
+ * - RPMA_E_INVAL - the message does not fit into dst
+ * - RPMA_E_INVAL - the message has been aborted by the sender
+ * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ *
+ * SEE ALSO
+ * rpma_cq_get_wc(3), rpma_frag_new(3), rpma_frag_send(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_frag_recv(struct rpma_frag *frag, const struct ibv_wc *wc, void *dst, size_t dst_size,
+		bool *done, size_t *len);
+
+/* striped connection */
+
+struct rpma_stripe;
+
+/** 3
+ * rpma_stripe_connect - establish a striped connection
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_peer;
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_private_data;
+ *	struct rpma_stripe;
+ *	int rpma_stripe_connect(struct rpma_peer *peer, const char *addr, const char *port,
+ *			const struct rpma_conn_cfg *cfg,
+ *			const struct rpma_conn_private_data *pdata, int num_conns,
+ *			size_t chunk_size, struct rpma_stripe **stripe_ptr);
+ *
+ * DESCRIPTION
+ * rpma_stripe_connect() establishes num_conns connections to the same server as
+ * rpma_conn_connect_all(3) does, all of them using the same cfg and pdata, and groups them
+ * under a single striped connection. The reads and writes initiated via rpma_stripe_read(3)
+ * and rpma_stripe_write(3) are split into chunks of up to chunk_size bytes posted round-robin
+ * over the connections, so a single logical operation is processed by many QPs at the same
+ * time. The server accepts the num_conns connection requests as any other ones. Since all
+ * the connections of each side use the same peer, the same local and remote memory regions
+ * can be used over all of them.
+ *
+ * The number of chunks in flight on every connection is bounded by its send queue size
+ * (see rpma_conn_cfg_set_sq_size(3) and rpma_peer_get_caps(3)). The main CQs of
+ * the connections are used only by the striped connection and the completions are collected
+ * via rpma_stripe_get_wc(3). The cfg cannot set a shared CM event channel
+ * (see rpma_conn_cfg_set_evch(3)).
+ *
+ * RETURN VALUE
+ * The rpma_stripe_connect() function returns 0 on success or a negative error code on failure.
+ * rpma_stripe_connect() does not set *stripe_ptr value on failure. If establishing any of
+ * the connections fails, all the other ones are disconnected and deleted.
+ *
+ * ERRORS
+ * rpma_stripe_connect() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - peer, addr, port or stripe_ptr is NULL
+ * - RPMA_E_INVAL - num_conns < 1, chunk_size is 0 or greater than UINT32_MAX
+ * - RPMA_E_INVAL - the send queues of all the connections can hold UINT32_MAX chunks or more
+ * - RPMA_E_NOMEM - out of memory
+ * - any error returned by rpma_conn_connect_all(3) or stored in a result of its target
+ *
+ * SEE ALSO
+ * rpma_conn_connect_all(3), rpma_peer_new(3), rpma_stripe_delete(3), rpma_stripe_get_conn(3),
+ * rpma_stripe_get_wc(3), rpma_stripe_read(3), rpma_stripe_write(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_stripe_connect(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, const struct rpma_conn_private_data *pdata,
+		int num_conns, size_t chunk_size, struct rpma_stripe **stripe_ptr);
+
+/** 3
+ * rpma_stripe_delete - disconnect and delete a striped connection
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_stripe;
+ *	int rpma_stripe_delete(struct rpma_stripe **stripe_ptr);
+ *
+ * DESCRIPTION
+ * rpma_stripe_delete() disconnects all the connections of the striped connection, waits for
+ * the RPMA_CONN_CLOSED event of each of them (see rpma_conn_next_event(3)), deletes them and
+ * frees the striped connection. The chunks still in flight are not reported.
+ *
+ * RETURN VALUE
+ * The rpma_stripe_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_stripe_delete() sets *stripe_ptr value to NULL on success and on failure. All
+ * the connections are deleted even if any of them fails and the first error is returned.
+ *
+ * ERRORS
+ * rpma_stripe_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - stripe_ptr is NULL
+ * - any error returned by rpma_conn_disconnect(3), rpma_conn_next_event(3) or
+ *   rpma_conn_delete(3)
+ *
+ * SEE ALSO
+ * rpma_stripe_connect(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_stripe_delete(struct rpma_stripe **stripe_ptr);
+
+/** 3
+ * rpma_stripe_get_conn - get a connection of a striped connection
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_stripe;
+ *	struct rpma_conn;
+ *	int rpma_stripe_get_conn(const struct rpma_stripe *stripe, int index,
+ *			struct rpma_conn **conn_ptr);
+ *
+ * DESCRIPTION
+ * rpma_stripe_get_conn() gets the index-th connection of the striped connection, e.g. to obtain
+ * the private data of the server (see rpma_conn_get_private_data(3)) or to apply
+ * the configuration of the remote peer. The connection is owned by the striped connection and
+ * it must not be deleted nor used to post any operations directly (e.g. via rpma_read(3) or
+ * rpma_recv(3)). Such operations would take the send queue slots the striped connection
+ * accounts for and their completions would be collected by rpma_stripe_get_wc(3).
+ *
+ * RETURN VALUE
+ * The rpma_stripe_get_conn() function returns 0 on success or a negative error code on failure.
+ * rpma_stripe_get_conn() does not set *conn_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_stripe_get_conn() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - stripe or conn_ptr is NULL or index is out of range
+ *
+ * SEE ALSO
+ * rpma_stripe_connect(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_stripe_get_conn(const struct rpma_stripe *stripe, int index,
+		struct rpma_conn **conn_ptr);
+
+/** 3
+ * rpma_stripe_read - initiate a striped read operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_stripe;
+ *	struct rpma_mr_local;
+ *	struct rpma_mr_remote;
+ *	int rpma_stripe_read(struct rpma_stripe *stripe, struct rpma_mr_local *dst,
+ *			size_t dst_offset, const struct rpma_mr_remote *src, size_t src_offset,
+ *			size_t len, int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_stripe_read() initiates transferring len bytes from the remote memory to the local
+ * memory as rpma_read(3) does. The operation is split into chunks read over all
+ * the connections of the striped connection and it completes when all of its chunks do.
+ * The operation is posted only if all of its chunks fit into the send queues at once.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion of the whole operation
+ * (see rpma_stripe_get_wc(3)).
+ *
+ * RETURN VALUE
+ * The rpma_stripe_read() function returns 0 on success or a negative error code on failure.
+ * If posting a chunk fails, the chunks already posted are collected by rpma_stripe_get_wc(3)
+ * but the operation is not reported.
+ *
+ * ERRORS
+ * rpma_stripe_read() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - stripe, dst or src is NULL or len or flags is 0
+ * - RPMA_E_INVAL - the operation consists of more chunks than all the send queues can hold
+ * - RPMA_E_AGAIN - there is no room in the send queues for all the chunks of the operation
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_read(3), rpma_stripe_connect(3), rpma_stripe_get_wc(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_stripe_read(struct rpma_stripe *stripe, struct rpma_mr_local *dst, size_t dst_offset,
+		const struct rpma_mr_remote *src, size_t src_offset, size_t len, int flags,
+		const void *op_context);
+
+/** 3
+ * rpma_stripe_write - initiate a striped write operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_stripe;
+ *	struct rpma_mr_local;
+ *	struct rpma_mr_remote;
+ *	int rpma_stripe_write(struct rpma_stripe *stripe, struct rpma_mr_remote *dst,
+ *			size_t dst_offset, const struct rpma_mr_local *src, size_t src_offset,
+ *			size_t len, int flags, const void *op_context);
+ *
+ * DESCRIPTION
+ * rpma_stripe_write() initiates transferring len bytes from the local memory to the remote
+ * memory as rpma_write(3) does. The operation is split into chunks written over all
+ * the connections of the striped connection and it completes when all of its chunks do.
+ * Since the chunks are written over different QPs, their order in the remote memory is not
+ * defined until the whole operation completes. The operation is posted only if all of its
+ * chunks fit into the send queues at once.
+ *
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ *
+ * op_context is returned in the wr_id field of the completion of the whole operation
+ * (see rpma_stripe_get_wc(3)).
+ *
+ * RETURN VALUE
+ * The rpma_stripe_write() function returns 0 on success or a negative error code on failure.
+ * If posting a chunk fails, the chunks already posted are collected by rpma_stripe_get_wc(3)
+ * but the operation is not reported.
+ *
+ * ERRORS
+ * rpma_stripe_write() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - stripe, dst or src is NULL or len or flags is 0
+ * - RPMA_E_INVAL - the operation consists of more chunks than all the send queues can hold
+ * - RPMA_E_AGAIN - there is no room in the send queues for all the chunks of the operation
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_write(3), rpma_stripe_connect(3), rpma_stripe_get_wc(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_stripe_write(struct rpma_stripe *stripe, struct rpma_mr_remote *dst, size_t dst_offset,
+		const struct rpma_mr_local *src, size_t src_offset, size_t len, int flags,
+		const void *op_context);
+
+/** 3
+ * rpma_stripe_get_wc - receive a completion of a striped operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_stripe;
+ *	struct ibv_wc;
+ *	int rpma_stripe_get_wc(struct rpma_stripe *stripe, struct ibv_wc *wc);
+ *
+ * DESCRIPTION
+ * rpma_stripe_get_wc() polls the main CQs of the connections of the striped connection in turn
+ * and collects the completions of the chunks until a whole operation completes. The completion
+ * of the operation is reported if it was initiated with RPMA_F_COMPLETION_ALWAYS or if any of
+ * its chunks failed. Then the wr_id field of wc is set to the op_context of the operation,
+ * the status field to the status of the first failed chunk or IBV_WC_SUCCESS, the opcode
+ * field to IBV_WC_RDMA_READ or IBV_WC_RDMA_WRITE and the byte_len field to the length of
+ * the operation (saturated at UINT32_MAX). The other fields describe the last completed chunk.
+ * A completion of an operation posted directly on one of the connections
+ * (see rpma_stripe_get_conn(3)), which is not supported, is returned unchanged.
+ *
+ * rpma_stripe_get_wc() does not wait for the completions. It can be used along with
+ * the file descriptors of the CQs (see rpma_conn_get_cq(3) and rpma_cq_get_fd(3)).
+ *
+ * RETURN VALUE
+ * The rpma_stripe_get_wc() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_stripe_get_wc() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - stripe or wc is NULL
+ * - RPMA_E_NO_COMPLETION - no operation has completed
+ * - RPMA_E_PROVIDER - ibv_poll_cq(3) failed with a provider error
+ *
+ * SEE ALSO
+ * rpma_cq_get_wc(3), rpma_stripe_connect(3), rpma_stripe_read(3), rpma_stripe_write(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_stripe_get_wc(struct rpma_stripe *stripe, struct ibv_wc *wc);
+
+/* multi-rail */
+
+struct rpma_rail_peer;
+struct rpma_rail_mr;
+struct rpma_rail_mr_remote;
+struct rpma_rail_conn;
+
+/** 3
+ * rpma_rail_peer_new - create a multi-rail peer object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct ibv_context;
+ *	struct rpma_rail_peer;
+ *	int rpma_rail_peer_new(struct ibv_context **ibv_ctxs, int num_rails,
+ *			struct rpma_rail_peer **rpeer_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rail_peer_new() creates a new multi-rail peer object consisting of num_rails peers,
+ * one per RDMA device (a rail) of the ibv_ctxs array (see rpma_peer_new(3)). The memory
+ * registered via rpma_rail_mr_reg(3) is registered with every rail and the operations
+ * initiated via a multi-rail connection (see rpma_rail_conn_connect(3)) are spread over
+ * all the rails.
+ *
+ * RETURN VALUE
+ * The rpma_rail_peer_new() function returns 0 on success or a negative error code on failure.
+ * rpma_rail_peer_new() does not set *rpeer_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_rail_peer_new() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ibv_ctxs or rpeer_ptr is NULL
+ * - RPMA_E_INVAL - num_rails is not in the range from 1 to 255
+ * - RPMA_E_NOMEM - out of memory
+ * - any error rpma_peer_new(3) can fail with
+ *
+ * SEE ALSO
+ * rpma_peer_new(3), rpma_rail_conn_connect(3), rpma_rail_mr_reg(3), rpma_rail_peer_delete(3),
+ * rpma_rail_peer_get_peer(3), rpma_utils_get_ibv_context(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_rail_peer_new(struct ibv_context **ibv_ctxs, int num_rails,
+		struct rpma_rail_peer **rpeer_ptr);
+
+/** 3
+ * rpma_rail_peer_delete - delete a multi-rail peer object
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_peer;
+ *	int rpma_rail_peer_delete(struct rpma_rail_peer **rpeer_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rail_peer_delete() deletes the peers of all the rails and the multi-rail peer object.
+ *
+ * RETURN VALUE
+ * The rpma_rail_peer_delete() function returns 0 on success or a negative error code on
+ * failure. rpma_rail_peer_delete() sets *rpeer_ptr value to NULL on success and on failure.
+ * All the peers are deleted even if deleting any of them fails.
+ *
+ * ERRORS
+ * rpma_rail_peer_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rpeer_ptr is NULL
+ * - any error rpma_peer_delete(3) can fail with
+ *
+ * SEE ALSO
+ * rpma_rail_peer_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rail_peer_delete(struct rpma_rail_peer **rpeer_ptr);
+
+/** 3
+ * rpma_rail_peer_get_peer - get the peer of a rail
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_peer;
+ *	struct rpma_peer;
+ *	int rpma_rail_peer_get_peer(const struct rpma_rail_peer *rpeer, int rail,
+ *			struct rpma_peer **peer_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rail_peer_get_peer() gets the peer of the rail of the given index. It can be used e.g.
+ * to start listening for the incoming connections on every rail (see rpma_ep_listen(3)).
+ * The peer is owned by the multi-rail peer and it cannot be deleted via rpma_peer_delete(3).
+ *
+ * RETURN VALUE
+ * The rpma_rail_peer_get_peer() function returns 0 on success or a negative error code on
+ * failure. rpma_rail_peer_get_peer() does not set *peer_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_rail_peer_get_peer() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - rpeer or peer_ptr is NULL or rail is out of range
+ *
+ * SEE ALSO
+ * rpma_ep_listen(3), rpma_rail_peer_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rail_peer_get_peer(const struct rpma_rail_peer *rpeer, int rail,
+		struct rpma_peer **peer_ptr);
 
 /** 3
- * rpma_write_with_imm - initiate the write operation with immediate data
+ * rpma_rail_mr_reg - register a memory region with every rail
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_local;
- *	struct rpma_mr_remote;
- *	int rpma_write_with_imm(struct rpma_conn *conn,
- *			struct rpma_mr_remote *dst, size_t dst_offset,
- *			const struct rpma_mr_local *src, size_t src_offset,
- *			size_t len, int flags, uint32_t imm,
- *			const void *op_context);
+ *	struct rpma_rail_peer;
+ *	struct rpma_rail_mr;
+ *	int rpma_rail_mr_reg(struct rpma_rail_peer *rpeer, void *ptr, size_t size, int usage,
+ *			struct rpma_rail_mr **mr_ptr);
  *
  * DESCRIPTION
- * rpma_write_with_imm() initiates the write operation with immediate data (transferring data from
- * the local memory to the remote memory. To write a 0 bytes message, set src and dst to NULL and
- * src_offset, dst_offset and len to 0.
+ * rpma_rail_mr_reg() registers the memory region with the peers of all the rails as
+ * rpma_mr_reg(3) does. The usage has the same meaning as for rpma_mr_reg(3).
  *
- * The attribute flags set the completion notification indicator:
- * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
- * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ * RETURN VALUE
+ * The rpma_rail_mr_reg() function returns 0 on success or a negative error code on failure.
+ * rpma_rail_mr_reg() does not set *mr_ptr value on failure. If registering the memory region
+ * with any of the rails fails, the memory region is deregistered from the other rails.
  *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * ERRORS
+ * rpma_rail_mr_reg() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rpeer, ptr or mr_ptr is NULL or size or usage is 0
+ * - RPMA_E_NOMEM - out of memory
+ * - any error rpma_mr_reg(3) can fail with
+ *
+ * SEE ALSO
+ * rpma_mr_reg(3), rpma_rail_mr_dereg(3), rpma_rail_mr_get_descriptor(3),
+ * rpma_rail_peer_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rail_mr_reg(struct rpma_rail_peer *rpeer, void *ptr, size_t size, int usage,
+		struct rpma_rail_mr **mr_ptr);
+
+/** 3
+ * rpma_rail_mr_dereg - deregister a memory region from every rail
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_mr;
+ *	int rpma_rail_mr_dereg(struct rpma_rail_mr **mr_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rail_mr_dereg() deregisters the memory region from all the rails and deletes
+ * the multi-rail memory region object.
  *
  * RETURN VALUE
- * The rpma_write_with_imm() function returns 0 on success or a negative error code on failure.
+ * The rpma_rail_mr_dereg() function returns 0 on success or a negative error code on failure.
+ * rpma_rail_mr_dereg() sets *mr_ptr value to NULL on success and on failure.
  *
  * ERRORS
- * rpma_write_with_imm() can fail with the following errors:
+ * rpma_rail_mr_dereg() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn == NULL || flags == 0
- * - RPMA_E_INVAL - dst == NULL && (src != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
- * - RPMA_E_INVAL - src == NULL && (dst != NULL || src_offset != 0 || dst_offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_INVAL - mr_ptr is NULL
+ * - any error rpma_mr_dereg(3) can fail with
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_rail_mr_reg(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_write_with_imm(struct rpma_conn *conn,
-		struct rpma_mr_remote *dst, size_t dst_offset,
-		const struct rpma_mr_local *src, size_t src_offset,
-		size_t len, int flags, uint32_t imm, const void *op_context);
-
-#define RPMA_ATOMIC_WRITE_ALIGNMENT 8
+int rpma_rail_mr_dereg(struct rpma_rail_mr **mr_ptr);
 
 /** 3
- * rpma_atomic_write -- initiate the atomic 8 bytes write operation
+ * rpma_rail_mr_get_descriptor_size - get the size of a multi-rail memory region descriptor
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_remote;
- *	int rpma_atomic_write(struct rpma_conn *conn,
- *			struct rpma_mr_remote *dst, size_t dst_offset,
- *			const char src[8], int flags, const void *op_context);
+ *	struct rpma_rail_mr;
+ *	int rpma_rail_mr_get_descriptor_size(const struct rpma_rail_mr *mr,
+ *			size_t *desc_size);
  *
  * DESCRIPTION
- * rpma_atomic_write() initiates the atomic 8 bytes write operation (transferring data from
- * the local memory to the remote memory). The atomic write operation allows transferring exactly 8
- * bytes of data and storing them atomically in the remote memory.
+ * rpma_rail_mr_get_descriptor_size() gets the size of the descriptor of the multi-rail memory
+ * region, which consists of the descriptors of the memory regions of all the rails.
  *
- * The attribute flags set the completion notification indicator:
- * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
- * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ * RETURN VALUE
+ * The rpma_rail_mr_get_descriptor_size() function returns 0 on success or a negative error
+ * code on failure. rpma_rail_mr_get_descriptor_size() does not set *desc_size value on failure.
  *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * ERRORS
+ * rpma_rail_mr_get_descriptor_size() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - mr or desc_size is NULL
+ *
+ * SEE ALSO
+ * rpma_rail_mr_get_descriptor(3), rpma_rail_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rail_mr_get_descriptor_size(const struct rpma_rail_mr *mr, size_t *desc_size);
+
+/** 3
+ * rpma_rail_mr_get_descriptor - get a descriptor of a multi-rail memory region
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_mr;
+ *	int rpma_rail_mr_get_descriptor(const struct rpma_rail_mr *mr, void *desc);
+ *
+ * DESCRIPTION
+ * rpma_rail_mr_get_descriptor() writes a network-transferable description of the multi-rail
+ * memory region to the desc buffer. The buffer has to be at least
+ * rpma_rail_mr_get_descriptor_size(3) bytes long. The descriptor starts with the number of
+ * rails followed by the size and the descriptor (see rpma_mr_get_descriptor(3)) of the memory
+ * region of every rail. The peer can create the remote memory regions of all the rails from it
+ * via rpma_rail_mr_remote_from_descriptor(3).
  *
  * RETURN VALUE
- * The rpma_atomic_write() function returns 0 on success or a negative error code on failure.
+ * The rpma_rail_mr_get_descriptor() function returns 0 on success or a negative error code on
+ * failure.
  *
  * ERRORS
- * rpma_atomic_write() can fail with the following errors:
+ * rpma_rail_mr_get_descriptor() can fail with the following error:
  *
- * - RPMA_E_INVAL - conn, dst or src is NULL
- * - RPMA_E_INVAL - dst_offset is not aligned to 8 bytes
- * - RPMA_E_INVAL - flags are not set (flags == 0)
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_INVAL - mr or desc is NULL
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_mr_get_descriptor(3), rpma_rail_mr_get_descriptor_size(3),
+ * rpma_rail_mr_remote_from_descriptor(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_atomic_write(struct rpma_conn *conn,
-	struct rpma_mr_remote *dst, size_t dst_offset,
-	const char src[8], int flags, const void *op_context);
+int rpma_rail_mr_get_descriptor(const struct rpma_rail_mr *mr, void *desc);
 
-/*
- * possible types of rpma_flush() operation
+/** 3
+ * rpma_rail_mr_remote_from_descriptor - create remote memory regions of all the rails from
+ * a descriptor
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_mr_remote;
+ *	int rpma_rail_mr_remote_from_descriptor(const void *desc, size_t desc_size,
+ *			struct rpma_rail_mr_remote **mr_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rail_mr_remote_from_descriptor() creates the remote memory regions of all the rails
+ * (see rpma_mr_remote_from_descriptor(3)) from the descriptor provided by the peer via
+ * rpma_rail_mr_get_descriptor(3).
+ *
+ * RETURN VALUE
+ * The rpma_rail_mr_remote_from_descriptor() function returns 0 on success or a negative error
+ * code on failure. rpma_rail_mr_remote_from_descriptor() does not set *mr_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_rail_mr_remote_from_descriptor() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - desc or mr_ptr is NULL
+ * - RPMA_E_INVAL - the descriptor is truncated or describes no rail
+ * - RPMA_E_NOMEM - out of memory
+ * - any error rpma_mr_remote_from_descriptor(3) can fail with
+ *
+ * SEE ALSO
+ * rpma_mr_remote_from_descriptor(3), rpma_rail_mr_get_descriptor(3),
+ * rpma_rail_mr_remote_delete(3), librpma(7) and https://pmem.io/rpma/
  */
-enum rpma_flush_type {
-	/* flush data down to the persistent domain */
-	RPMA_FLUSH_TYPE_PERSISTENT,
-	/* flush data deep enough to make it visible on the remote node */
-	RPMA_FLUSH_TYPE_VISIBILITY,
-};
+int rpma_rail_mr_remote_from_descriptor(const void *desc, size_t desc_size,
+		struct rpma_rail_mr_remote **mr_ptr);
 
 /** 3
- * rpma_flush - initiate the flush operation
+ * rpma_rail_mr_remote_delete - delete remote memory regions of all the rails
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_remote;
- *	enum rpma_flush_type {
- *		RPMA_FLUSH_TYPE_PERSISTENT,
- *		RPMA_FLUSH_TYPE_VISIBILITY,
- *	};
- *
- *	int rpma_flush(struct rpma_conn *conn,
- *			struct rpma_mr_remote *dst, size_t dst_offset,
- *			size_t len, enum rpma_flush_type type, int flags,
- *			const void *op_context);
+ *	struct rpma_rail_mr_remote;
+ *	int rpma_rail_mr_remote_delete(struct rpma_rail_mr_remote **mr_ptr);
  *
  * DESCRIPTION
- * rpma_flush() initiates the flush operation (finalizing a transfer of data to the remote memory).
- * Possible types of rpma_flush() operation:
- * - RPMA_FLUSH_TYPE_PERSISTENT - flush data down to the persistent domain
- * - RPMA_FLUSH_TYPE_VISIBILITY - flush data deep enough to make it visible on the remote node
+ * rpma_rail_mr_remote_delete() deletes the remote memory regions of all the rails and
+ * the multi-rail remote memory region object.
  *
- * The attribute flags set the completion notification indicator:
- * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
- * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ * RETURN VALUE
+ * The rpma_rail_mr_remote_delete() function returns 0 on success or a negative error code on
+ * failure. rpma_rail_mr_remote_delete() sets *mr_ptr value to NULL on success and on failure.
  *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * ERRORS
+ * rpma_rail_mr_remote_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - mr_ptr is NULL
+ * - any error rpma_mr_remote_delete(3) can fail with
+ *
+ * SEE ALSO
+ * rpma_rail_mr_remote_from_descriptor(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rail_mr_remote_delete(struct rpma_rail_mr_remote **mr_ptr);
+
+/** 3
+ * rpma_rail_conn_connect - establish a multi-rail connection
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_peer;
+ *	struct rpma_conn_cfg;
+ *	struct rpma_conn_private_data;
+ *	struct rpma_rail_conn;
+ *	int rpma_rail_conn_connect(struct rpma_rail_peer *rpeer, const char *const *addrs,
+ *			const char *port, const struct rpma_conn_cfg *cfg,
+ *			const struct rpma_conn_private_data *pdata, int conns_per_rail,
+ *			size_t chunk_size, struct rpma_rail_conn **rconn_ptr);
+ *
+ * DESCRIPTION
+ * rpma_rail_conn_connect() establishes a striped connection (see rpma_stripe_connect(3)) of
+ * conns_per_rail connections over every rail of the multi-rail peer. The rail of index i
+ * connects to the server address addrs[i] and the same port, cfg and pdata are used by all
+ * the connections.
+ *
+ * The reads and writes initiated via rpma_rail_read(3) and rpma_rail_write(3) are split into
+ * parts of whole chunks of chunk_size bytes, one part per rail which has not failed, so all
+ * the rails transfer the data at the same time. A rail fails when any of its parts completes
+ * with an error or fails to be posted. A failed rail is not used by the following operations
+ * (see rpma_rail_conn_is_failed(3)).
  *
  * RETURN VALUE
- * The rpma_flush() function returns 0 on success or a negative error code on failure.
+ * The rpma_rail_conn_connect() function returns 0 on success or a negative error code on
+ * failure. rpma_rail_conn_connect() does not set *rconn_ptr value on failure. If connecting
+ * any of the rails fails, the rails already connected are disconnected.
  *
  * ERRORS
- * rpma_flush() can fail with the following errors:
+ * rpma_rail_conn_connect() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn or dst is NULL
- * - RPMA_E_INVAL - unknown type value
- * - RPMA_E_INVAL - flags are not set
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
- * - RPMA_E_NOSUPP - type is RPMA_FLUSH_TYPE_PERSISTENT and the direct write to pmem is not
- *   supported
+ * - RPMA_E_INVAL - rpeer, addrs, any of the addresses, port or rconn_ptr is NULL
+ * - RPMA_E_INVAL - conns_per_rail is not positive or chunk_size is 0
+ * - RPMA_E_NOMEM - out of memory
+ * - any error rpma_stripe_connect(3) can fail with
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_remote_from_descriptor(3), librpma(7) and
- * https://pmem.io/rpma/
+ * rpma_rail_conn_delete(3), rpma_rail_conn_is_failed(3), rpma_rail_get_wc(3),
+ * rpma_rail_peer_new(3), rpma_rail_read(3), rpma_rail_write(3), rpma_stripe_connect(3),
+ * librpma(7) and https://pmem.io/rpma/
  */
-int rpma_flush(struct rpma_conn *conn,
-		struct rpma_mr_remote *dst, size_t dst_offset, size_t len,
-		enum rpma_flush_type type, int flags, const void *op_context);
+int rpma_rail_conn_connect(struct rpma_rail_peer *rpeer, const char *const *addrs,
+		const char *port, const struct rpma_conn_cfg *cfg,
+		const struct rpma_conn_private_data *pdata, int conns_per_rail, size_t chunk_size,
+		struct rpma_rail_conn **rconn_ptr);
 
 /** 3
- * rpma_send - initiate the send operation
+ * rpma_rail_conn_delete - disconnect and delete a multi-rail connection
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_local;
- *	int rpma_send(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset,
- *			size_t len, int flags, const void *op_context);
+ *	struct rpma_rail_conn;
+ *	int rpma_rail_conn_delete(struct rpma_rail_conn **rconn_ptr);
  *
  * DESCRIPTION
- * rpma_send() initiates the send operation which transfers a message from the local memory to
- * other side of the connection. To send a 0 byte message, set src to NULL and both offset and len
- * to 0.
+ * rpma_rail_conn_delete() deletes the striped connections of all the rails
+ * (see rpma_stripe_delete(3)) and frees the multi-rail connection. The parts still in flight
+ * are not reported.
  *
- * The attribute flags set the completion notification indicator:
- * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
- * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
+ * RETURN VALUE
+ * The rpma_rail_conn_delete() function returns 0 on success or a negative error code on
+ * failure. rpma_rail_conn_delete() sets *rconn_ptr value to NULL on success and on failure.
  *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * ERRORS
+ * rpma_rail_conn_delete() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rconn_ptr is NULL
+ * - any error rpma_stripe_delete(3) can fail with
+ *
+ * SEE ALSO
+ * rpma_rail_conn_connect(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_rail_conn_delete(struct rpma_rail_conn **rconn_ptr);
+
+/** 3
+ * rpma_rail_conn_is_failed - check if a rail of a multi-rail connection has failed
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_conn;
+ *	int rpma_rail_conn_is_failed(const struct rpma_rail_conn *rconn, int rail,
+ *			bool *failed);
+ *
+ * DESCRIPTION
+ * rpma_rail_conn_is_failed() checks if the rail of the given index has failed. A failed rail
+ * is not used by the operations initiated after the failure.
  *
  * RETURN VALUE
- * The rpma_send() function returns 0 on success or a negative error code on failure.
+ * The rpma_rail_conn_is_failed() function returns 0 on success or a negative error code on
+ * failure. rpma_rail_conn_is_failed() does not set *failed value on failure.
  *
  * ERRORS
- * rpma_send() can fail with the following errors:
+ * rpma_rail_conn_is_failed() can fail with the following error:
  *
- * - RPMA_E_INVAL - conn == NULL || flags == 0
- * - RPMA_E_INVAL - src == NULL && (offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_INVAL - rconn or failed is NULL or rail is out of range
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_rail_conn_connect(3), librpma(7) and https://pmem.io/rpma/
  */
-int rpma_send(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset, size_t len,
-		int flags, const void *op_context);
+int rpma_rail_conn_is_failed(const struct rpma_rail_conn *rconn, int rail, bool *failed);
 
 /** 3
- * rpma_send_with_imm - initiate the send operation with immediate data
+ * rpma_rail_read - initiate a multi-rail read operation
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_local;
- *	int rpma_send_with_imm(struct rpma_conn *conn, const struct rpma_mr_local *src,
- *			size_t offset, size_t len, int flags, uint32_t imm,
- *			const void *op_context);
+ *	struct rpma_rail_conn;
+ *	struct rpma_rail_mr;
+ *	struct rpma_rail_mr_remote;
+ *	int rpma_rail_read(struct rpma_rail_conn *rconn, const struct rpma_rail_mr *dst,
+ *			size_t dst_offset, const struct rpma_rail_mr_remote *src,
+ *			size_t src_offset, size_t len, int flags, const void *op_context);
  *
  * DESCRIPTION
- * rpma_send_with_imm() initiates the send operation with immediate data which transfers a message
- * from the local memory to other side of the connection. To send a 0 byte message, set src to NULL
- * and both offset and len to 0.
+ * rpma_rail_read() initiates transferring len bytes from the remote memory to the local memory
+ * as rpma_read(3) does. The operation is split into parts read over the rails which have not
+ * failed and it completes when all of its parts do. The operation is posted only if all of its
+ * parts fit into the send queues of the rails at once.
  *
  * The attribute flags set the completion notification indicator:
  * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
  * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
  *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * op_context is returned in the wr_id field of the completion of the whole operation
+ * (see rpma_rail_get_wc(3)).
  *
  * RETURN VALUE
- * The rpma_send_with_imm() function returns 0 on success or a negative error code on failure.
+ * The rpma_rail_read() function returns 0 on success or a negative error code on failure.
+ * If posting a part fails, the parts already posted are collected by rpma_rail_get_wc(3)
+ * but the operation is not reported.
  *
  * ERRORS
- * rpma_send_with_imm() can fail with the following errors:
+ * rpma_rail_read() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn == NULL || flags == 0
- * - RPMA_E_INVAL - src == NULL && (offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_INVAL - rconn, dst or src is NULL or len or flags is 0
+ * - RPMA_E_INVAL - dst or src does not describe the rails of the connection
+ * - RPMA_E_INVAL - a part of the operation consists of more chunks than a rail can hold
+ * - RPMA_E_AGAIN - there is no room in the send queues for all the parts of the operation
+ * - RPMA_E_PROVIDER - all the rails have failed or ibv_post_send(3) failed
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_rail_conn_connect(3), rpma_rail_get_wc(3), rpma_stripe_read(3), librpma(7) and
+ * https://pmem.io/rpma/
  */
-int rpma_send_with_imm(struct rpma_conn *conn, const struct rpma_mr_local *src, size_t offset,
-	size_t len, int flags, uint32_t imm, const void *op_context);
+int rpma_rail_read(struct rpma_rail_conn *rconn, const struct rpma_rail_mr *dst, size_t dst_offset,
+		const struct rpma_rail_mr_remote *src, size_t src_offset, size_t len, int flags,
+		const void *op_context);
 
 /** 3
- * rpma_recv - initiate the receive operation
+ * rpma_rail_write - initiate a multi-rail write operation
  *
  * SYNOPSIS
  *
  *	#include <librpma.h>
  *
- *	struct rpma_conn;
- *	struct rpma_mr_local;
- *	int rpma_recv(struct rpma_conn *conn, struct rpma_mr_local *dst, size_t offset, size_t len,
- *			const void *op_context);
+ *	struct rpma_rail_conn;
+ *	struct rpma_rail_mr;
+ *	struct rpma_rail_mr_remote;
+ *	int rpma_rail_write(struct rpma_rail_conn *rconn, const struct rpma_rail_mr_remote *dst,
+ *			size_t dst_offset, const struct rpma_rail_mr *src, size_t src_offset,
+ *			size_t len, int flags, const void *op_context);
  *
  * DESCRIPTION
- * rpma_recv() initiates the receive operation which prepares a buffer for a message sent from
- * other side of the connection. Please see rpma_send(3).
+ * rpma_rail_write() initiates transferring len bytes from the local memory to the remote
+ * memory as rpma_write(3) does. The operation is split into parts written over the rails which
+ * have not failed and it completes when all of its parts do. The operation is posted only if
+ * all of its parts fit into the send queues of the rails at once.
  *
- * All buffers prepared via rpma_recv(3) form an unordered set. When a message arrives it is placed
- * in one of the buffers awaitaning and a completion for the receive operation is generated.
+ * The attribute flags set the completion notification indicator:
+ * - RPMA_F_COMPLETION_ON_ERROR - generate the completion on error
+ * - RPMA_F_COMPLETION_ALWAYS - generate the completion regardless of result of the operation.
  *
- * A buffer for an incoming message have to be prepared beforehand.
+ * op_context is returned in the wr_id field of the completion of the whole operation
+ * (see rpma_rail_get_wc(3)).
  *
- * The order of buffers in the set does not affect the order of completions of receive operations
- * get via rpma_cq_get_wc(3).
+ * RETURN VALUE
+ * The rpma_rail_write() function returns 0 on success or a negative error code on failure.
+ * If posting a part fails, the parts already posted are collected by rpma_rail_get_wc(3)
+ * but the operation is not reported.
  *
- * op_context is returned in the wr_id field of the completion (struct ibv_wc).
+ * ERRORS
+ * rpma_rail_write() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - rconn, dst or src is NULL or len or flags is 0
+ * - RPMA_E_INVAL - dst or src does not describe the rails of the connection
+ * - RPMA_E_INVAL - a part of the operation consists of more chunks than a rail can hold
+ * - RPMA_E_AGAIN - there is no room in the send queues for all the parts of the operation
+ * - RPMA_E_PROVIDER - all the rails have failed or ibv_post_send(3) failed
+ *
+ * SEE ALSO
+ * rpma_rail_conn_connect(3), rpma_rail_get_wc(3), rpma_stripe_write(3), librpma(7) and
+ * https://pmem.io/rpma/
+ */
+int rpma_rail_write(struct rpma_rail_conn *rconn, const struct rpma_rail_mr_remote *dst,
+		size_t dst_offset, const struct rpma_rail_mr *src, size_t src_offset, size_t len,
+		int flags, const void *op_context);
+
+/** 3
+ * rpma_rail_get_wc - receive a completion of a multi-rail operation
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_rail_conn;
+ *	struct ibv_wc;
+ *	int rpma_rail_get_wc(struct rpma_rail_conn *rconn, struct ibv_wc *wc);
  *
- * NOTE
- * In the RDMA standard, receive requests form an ordered queue.
- * The RPMA does NOT inherit this guarantee.
+ * DESCRIPTION
+ * rpma_rail_get_wc() polls the striped connections of the rails in turn
+ * (see rpma_stripe_get_wc(3)) and collects the completions of the parts until a whole
+ * operation completes. A rail whose part completes with an error is marked as failed.
+ * The completion of the operation is reported if it was initiated with RPMA_F_COMPLETION_ALWAYS
+ * or if any of its parts failed. Then the wr_id field of wc is set to the op_context of
+ * the operation, the status field to the status of the first failed part or IBV_WC_SUCCESS,
+ * the opcode field to IBV_WC_RDMA_READ or IBV_WC_RDMA_WRITE and the byte_len field to
+ * the length of the operation (saturated at UINT32_MAX). A failed operation can be initiated
+ * again and it will be posted over the rails which have not failed.
+ *
+ * rpma_rail_get_wc() does not wait for the completions.
  *
  * RETURN VALUE
- * The rpma_recv() function returns 0 on success or a negative error code on failure.
+ * The rpma_rail_get_wc() function returns 0 on success or a negative error code on failure.
  *
  * ERRORS
- * rpma_recv() can fail with the following errors:
+ * rpma_rail_get_wc() can fail with the following errors:
  *
- * - RPMA_E_INVAL - conn == NULL
- * - RPMA_E_INVAL - dst == NULL && (offset != 0 || len != 0)
- * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ * - RPMA_E_INVAL - rconn or wc is NULL
+ * - RPMA_E_NO_COMPLETION - no operation has completed
+ * - RPMA_E_PROVIDER - ibv_poll_cq(3) failed with a provider error
  *
  * SEE ALSO
- * rpma_conn_req_connect(3), rpma_mr_reg(3), librpma(7) and https://pmem.io/rpma/
+ * rpma_rail_conn_connect(3), rpma_rail_read(3), rpma_rail_write(3), rpma_stripe_get_wc(3),
+ * librpma(7) and https://pmem.io/rpma/
  */
-int rpma_recv(struct rpma_conn *conn, struct rpma_mr_local *dst, size_t offset, size_t len,
-		const void *op_context);
+int rpma_rail_get_wc(struct rpma_rail_conn *rconn, struct ibv_wc *wc);
 
 /* completion handling */
 
@@ -3086,6 +6069,272 @@ int rpma_cq_wait(struct rpma_cq *cq);
  */
 int rpma_cq_get_wc(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc, int *num_entries_got);
 
+/** 3
+ * rpma_cq_get_wc_conn - receive one or more completions along with their connections
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_cq;
+ *	struct rpma_conn;
+ *	struct ibv_wc;
+ *
+ *	int rpma_cq_get_wc_conn(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc,
+ *			struct rpma_conn **conns, int *num_entries_got);
+ *
+ * DESCRIPTION
+ * rpma_cq_get_wc_conn() receives completions exactly like rpma_cq_get_wc(3) does and additionally
+ * saves the connection owning the QP of the i-th completion into conns[i]. It is meant for a CQ
+ * shared by many connections, e.g. the receive CQ of a shared RQ (see rpma_srq_get_rcq(3)), where
+ * the wc.qp_num attribute is the only way to tell the connections apart. The library keeps track
+ * of the QP numbers of all its connections, so the connection is found in a constant time and
+ * without any locking. The user context of the connection can be obtained then
+ * by rpma_conn_get_context(3).
+ *
+ * conns[i] is NULL if the QP of the completion does not belong to any existing connection, e.g.
+ * when the connection has been already deleted. Note that a connection may be deleted only when
+ * no completion of its QP is going to be received anymore, otherwise the returned pointer may
+ * become invalid at any time.
+ *
+ * RETURN VALUE
+ * The rpma_cq_get_wc_conn() function returns 0 on success or a negative error code on failure. On
+ * success, it saves all got completions, their connections and their number into the wc, conns
+ * and num_entries_got respectively.
+ *
+ * ERRORS
+ * rpma_cq_get_wc_conn() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - num_entries < 1, cq, wc or conns is NULL, num_entries > 1 and num_entries_got
+ *   is NULL
+ * - RPMA_E_NO_COMPLETION - no completions available
+ * - RPMA_E_PROVIDER - ibv_poll_cq(3) failed with a provider error
+ * - RPMA_E_UNKNOWN - ibv_poll_cq(3) failed but no provider error is available
+ *
+ * SEE ALSO
+ * rpma_conn_get_qp_num(3), rpma_conn_get_context(3), rpma_conn_set_context(3), rpma_cq_get_wc(3),
+ * rpma_srq_get_rcq(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_cq_get_wc_conn(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc,
+		struct rpma_conn **conns, int *num_entries_got);
+
+/* immediate data demultiplexing */
+
+struct rpma_imm_demux;
+
+/*
+ * the type used for defining handlers of the completions
+ */
+typedef int rpma_imm_handler(
+	/* the completion */
+	const struct ibv_wc *wc,
+	/* the immediate data of the completion in the host byte order */
+	uint32_t imm,
+	/* the argument provided at the registration */
+	void *arg);
+
+/** 3
+ * rpma_imm_demux_new - create a new immediate data demultiplexer
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_imm_demux;
+ *	int rpma_imm_demux_new(struct rpma_imm_demux **demux_ptr);
+ *
+ * DESCRIPTION
+ * rpma_imm_demux_new() creates a new immediate data demultiplexer. The demultiplexer maps ranges
+ * of the immediate data values carried by rpma_send_with_imm(3) and rpma_write_with_imm(3) to
+ * handlers, which are invoked straight from the CQ polling by rpma_imm_demux_dispatch(3).
+ * It allows one poller to serve many logical streams, e.g. with a stream identifier kept in
+ * the top bits and an offset kept in the low bits of the immediate data.
+ *
+ * The demultiplexer is not thread-safe.
+ *
+ * RETURN VALUE
+ * The rpma_imm_demux_new() function returns 0 on success or a negative error code on failure.
+ * rpma_imm_demux_new() does not set *demux_ptr value on failure.
+ *
+ * ERRORS
+ * rpma_imm_demux_new() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - demux_ptr is NULL
+ * - RPMA_E_NOMEM - out of memory
+ *
+ * SEE ALSO
+ * rpma_imm_demux_delete(3), rpma_imm_demux_dispatch(3), rpma_imm_demux_register(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_imm_demux_new(struct rpma_imm_demux **demux_ptr);
+
+/** 3
+ * rpma_imm_demux_delete - delete the immediate data demultiplexer
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_imm_demux;
+ *	int rpma_imm_demux_delete(struct rpma_imm_demux **demux_ptr);
+ *
+ * DESCRIPTION
+ * rpma_imm_demux_delete() deletes the immediate data demultiplexer together with all its
+ * registrations.
+ *
+ * RETURN VALUE
+ * The rpma_imm_demux_delete() function returns 0 on success or a negative error code on failure.
+ * rpma_imm_demux_delete() sets *demux_ptr value to NULL on success.
+ *
+ * ERRORS
+ * rpma_imm_demux_delete() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - demux_ptr is NULL
+ *
+ * SEE ALSO
+ * rpma_imm_demux_new(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_imm_demux_delete(struct rpma_imm_demux **demux_ptr);
+
+/** 3
+ * rpma_imm_demux_register - register a handler of a range of the immediate data values
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_imm_demux;
+ *	struct ibv_wc;
+ *	typedef int rpma_imm_handler(const struct ibv_wc *wc, uint32_t imm, void *arg);
+ *
+ *	int rpma_imm_demux_register(struct rpma_imm_demux *demux, uint32_t imm_min,
+ *			uint32_t imm_max, rpma_imm_handler *handler, void *arg);
+ *
+ * DESCRIPTION
+ * rpma_imm_demux_register() registers the handler of the successful completions carrying
+ * the immediate data between imm_min and imm_max inclusive. The handler gets the completion,
+ * its immediate data converted to the host byte order and arg. The ranges cannot overlap.
+ *
+ * RETURN VALUE
+ * The rpma_imm_demux_register() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_imm_demux_register() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - demux or handler is NULL or imm_min > imm_max
+ * - RPMA_E_INVAL - the range overlaps an already registered one
+ * - RPMA_E_NOMEM - out of memory
+ *
+ * SEE ALSO
+ * rpma_imm_demux_dispatch(3), rpma_imm_demux_new(3), rpma_imm_demux_set_default(3),
+ * rpma_imm_demux_unregister(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_imm_demux_register(struct rpma_imm_demux *demux, uint32_t imm_min, uint32_t imm_max,
+		rpma_imm_handler *handler, void *arg);
+
+/** 3
+ * rpma_imm_demux_unregister - unregister a handler of a range of the immediate data values
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_imm_demux;
+ *	int rpma_imm_demux_unregister(struct rpma_imm_demux *demux, uint32_t imm_min);
+ *
+ * DESCRIPTION
+ * rpma_imm_demux_unregister() unregisters the handler of the range starting at imm_min.
+ * It can be called from a handler.
+ *
+ * RETURN VALUE
+ * The rpma_imm_demux_unregister() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_imm_demux_unregister() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - demux is NULL
+ * - RPMA_E_INVAL - no range starting at imm_min is registered
+ *
+ * SEE ALSO
+ * rpma_imm_demux_register(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_imm_demux_unregister(struct rpma_imm_demux *demux, uint32_t imm_min);
+
+/** 3
+ * rpma_imm_demux_set_default - set a handler of all other completions
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_imm_demux;
+ *	struct ibv_wc;
+ *	typedef int rpma_imm_handler(const struct ibv_wc *wc, uint32_t imm, void *arg);
+ *
+ *	int rpma_imm_demux_set_default(struct rpma_imm_demux *demux, rpma_imm_handler *handler,
+ *			void *arg);
+ *
+ * DESCRIPTION
+ * rpma_imm_demux_set_default() sets the handler of the completions not matching any registered
+ * range, including the completions without the immediate data and the failed completions
+ * (imm is 0 for them). If handler is NULL (the default) such completions are dropped.
+ *
+ * RETURN VALUE
+ * The rpma_imm_demux_set_default() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_imm_demux_set_default() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - demux is NULL
+ *
+ * SEE ALSO
+ * rpma_imm_demux_dispatch(3), rpma_imm_demux_register(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_imm_demux_set_default(struct rpma_imm_demux *demux, rpma_imm_handler *handler,
+		void *arg);
+
+/** 3
+ * rpma_imm_demux_dispatch - collect completions and invoke their handlers
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	struct rpma_imm_demux;
+ *	struct rpma_cq;
+ *	int rpma_imm_demux_dispatch(struct rpma_imm_demux *demux, struct rpma_cq *cq,
+ *			int max_entries, int *num_dispatched);
+ *
+ * DESCRIPTION
+ * rpma_imm_demux_dispatch() collects up to max_entries completions from the CQ using
+ * rpma_cq_get_wc(3) and invokes the handler of each of them in the order they were collected.
+ * The number of dispatched completions is returned in num_dispatched if it is not NULL.
+ * If a handler returns a non-zero value, the remaining already collected completions are
+ * still dispatched, but no more completions are collected and the first non-zero value is
+ * returned.
+ *
+ * RETURN VALUE
+ * The rpma_imm_demux_dispatch() function returns 0 on success, the first non-zero value returned
+ * by a handler or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_imm_demux_dispatch() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - demux or cq is NULL or max_entries < 1
+ * - RPMA_E_NO_COMPLETION - no completions available
+ * - RPMA_E_PROVIDER - ibv_poll_cq(3) failed with a provider error
+ * - RPMA_E_UNKNOWN - ibv_poll_cq(3) failed but no provider error is available
+ *
+ * SEE ALSO
+ * rpma_cq_get_wc(3), rpma_cq_wait(3), rpma_imm_demux_register(3),
+ * rpma_imm_demux_set_default(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_imm_demux_dispatch(struct rpma_imm_demux *demux, struct rpma_cq *cq, int max_entries,
+		int *num_dispatched);
+
 /* error handling */
 
 /** 3
@@ -3194,6 +6443,10 @@ enum rpma_log_threshold {
  * - RPMA_LOG_LEVEL_INFO - massive info e.g. every write operation indication
  * - RPMA_LOG_LEVEL_DEBUG - debug info e.g. write operation dump
  *
+ * The messages below the level chosen by the RPMA_LOG_LEVEL_MIN CMake option when the library
+ * has been built (RPMA_LOG_LEVEL_DEBUG by default) are compiled out of the library, so they
+ * are never logged whatever the threshold is.
+ *
  * THE DEFAULT LOGGING FUNCTION
  * The default logging function writes messages to syslog(3) and to stderr(3), where syslog(3) is
  * the primary destination (RPMA_LOG_THRESHOLD applies) whereas stderr(3) is the secondary
@@ -3311,6 +6564,181 @@ typedef void rpma_log_function(
  */
 int rpma_log_set_function(rpma_log_function *log_function);
 
+/** 3
+ * rpma_log_async_start - start the asynchronous logging backend
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	int rpma_log_async_start(int ring_size);
+ *
+ * DESCRIPTION
+ * rpma_log_async_start() starts a background thread writing the logging messages out the way
+ * the default logging function does (see rpma_log_set_function(3)) and makes the library
+ * queue its messages for the thread instead of writing them out on the calling thread.
+ *
+ * Every thread logging a message gets its own lock-free ring of ring_size (rounded up to
+ * a power of 2) records. The calling thread only stores the raw arguments of the message
+ * (the way rpma_log_binary_start(3) does) and stamps it with the time and the thread ID.
+ * Formatting the message, converting the time, writing to stderr(3) and syslog(3) is done
+ * by the background thread, so logging never blocks the calling thread. If the ring of
+ * the thread is full, the message is dropped. The number of the dropped messages is reported
+ * by the background thread as a warning and by rpma_log_async_get_dropped(3).
+ *
+ * The messages longer than 511 characters are truncated. The arguments are stored with the same
+ * limits as rpma_log_binary_start(3) stores them. The rings are reused by the next threads when
+ * the threads owning them exit and they are freed when the library is unloaded.
+ *
+ * RETURN VALUE
+ * The rpma_log_async_start() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_log_async_start() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - ring_size is not in the range from 1 to 1048576
+ * - RPMA_E_INVAL - the backend is already started
+ * - RPMA_E_UNKNOWN - creating the background thread failed
+ *
+ * NOTE
+ * rpma_log_async_start() replaces the logging function set by rpma_log_set_function(3).
+ *
+ * SEE ALSO
+ * rpma_log_async_get_dropped(3), rpma_log_async_stop(3), rpma_log_set_function(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_log_async_start(int ring_size);
+
+/** 3
+ * rpma_log_async_stop - stop the asynchronous logging backend
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	int rpma_log_async_stop(void);
+ *
+ * DESCRIPTION
+ * rpma_log_async_stop() restores the default logging function (unless another logging
+ * function has been set by rpma_log_set_function(3) in the meantime), stops the background
+ * thread and writes out the messages still queued. A message being queued at the same time
+ * may be written out only after the backend is started again.
+ *
+ * RETURN VALUE
+ * The rpma_log_async_stop() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_log_async_stop() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - the backend is not started
+ *
+ * SEE ALSO
+ * rpma_log_async_start(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_log_async_stop(void);
+
+/** 3
+ * rpma_log_async_get_dropped - get the number of dropped logging messages
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	int rpma_log_async_get_dropped(uint64_t *dropped);
+ *
+ * DESCRIPTION
+ * rpma_log_async_get_dropped() gets the total number of the logging messages dropped by
+ * the asynchronous logging backend because the ring of the logging thread was full.
+ *
+ * RETURN VALUE
+ * The rpma_log_async_get_dropped() function returns 0 on success or a negative error code on
+ * failure. rpma_log_async_get_dropped() does not set *dropped value on failure.
+ *
+ * ERRORS
+ * rpma_log_async_get_dropped() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - dropped is NULL
+ *
+ * SEE ALSO
+ * rpma_log_async_start(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_log_async_get_dropped(uint64_t *dropped);
+
+/** 3
+ * rpma_log_binary_start - start storing the logging messages in a binary file
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	int rpma_log_binary_start(const char *path, size_t size);
+ *
+ * DESCRIPTION
+ * rpma_log_binary_start() creates (or truncates) the file of the given size, maps it into
+ * the memory and makes the library store its logging messages in it instead of writing them
+ * to stderr(3) and syslog(3). The message is not formatted: only the time, the thread ID,
+ * the ID of the call site and the raw arguments of the message are stored in the next record
+ * of the file. The format string, the source file and the function name are stored once per
+ * call site. It makes logging cheap enough to keep even the RPMA_LOG_LEVEL_DEBUG messages
+ * enabled (see rpma_log_set_threshold(3)).
+ *
+ * The records are overwritten in circles, so the file keeps the most recent messages.
+ * They are decoded into the text form by the rpma_log_decode tool (built along with
+ * the library), also after the process has crashed:
+ *
+ *	$ rpma_log_decode <path>
+ *
+ * Up to 8 arguments of a message are stored and the strings are truncated to fit 104 bytes
+ * per message. The messages of more than 1024 call sites are dropped.
+ *
+ * RETURN VALUE
+ * The rpma_log_binary_start() function returns 0 on success or a negative error code
+ * on failure.
+ *
+ * ERRORS
+ * rpma_log_binary_start() can fail with the following errors:
+ *
+ * - RPMA_E_INVAL - path is NULL or size is too small to hold the table of the call sites
+ *   and at least one record (about 420 kilobytes)
+ * - RPMA_E_INVAL - the messages are already stored in a binary file
+ * - RPMA_E_UNKNOWN - creating or mapping the file failed
+ *
+ * NOTE
+ * rpma_log_binary_start() replaces the logging function set by rpma_log_set_function(3).
+ *
+ * SEE ALSO
+ * rpma_log_binary_stop(3), rpma_log_set_function(3), rpma_log_set_threshold(3),
+ * librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_log_binary_start(const char *path, size_t size);
+
+/** 3
+ * rpma_log_binary_stop - stop storing the logging messages in a binary file
+ *
+ * SYNOPSIS
+ *
+ *	#include <librpma.h>
+ *
+ *	int rpma_log_binary_stop(void);
+ *
+ * DESCRIPTION
+ * rpma_log_binary_stop() restores the default logging function (unless another logging
+ * function has been set by rpma_log_set_function(3) in the meantime), waits for the messages
+ * being stored at the moment and unmaps the file started by rpma_log_binary_start(3).
+ *
+ * RETURN VALUE
+ * The rpma_log_binary_stop() function returns 0 on success or a negative error code on failure.
+ *
+ * ERRORS
+ * rpma_log_binary_stop() can fail with the following error:
+ *
+ * - RPMA_E_INVAL - the messages are not stored in a binary file
+ *
+ * SEE ALSO
+ * rpma_log_binary_start(3), librpma(7) and https://pmem.io/rpma/
+ */
+int rpma_log_binary_stop(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <netdb.h>
 
+#include "addr_cache.h"
 #include "conn_req.h"
 #include "debug.h"
 #include "info.h"
@@ -25,23 +26,17 @@ struct rpma_info {
 	enum rpma_info_side side;
 	/* a cache of the translated address */
 	struct rdma_addrinfo *rai;
+	/* a reference to rai if it is shared via the address cache (optional) */
+	struct rpma_addr_cache_ref *ref;
 };
 
-/* internal librpma API */
-
 /*
- * rpma_info_new -- create an address translation cache aka the info object
+ * info_getaddrinfo -- translate the address using rdma_getaddrinfo()
  */
-int
-rpma_info_new(const char *addr, const char *port, enum rpma_info_side side,
-		struct rpma_info **info_ptr)
+static int
+info_getaddrinfo(const char *addr, const char *port, enum rpma_info_side side,
+		struct rdma_addrinfo **rai_ptr)
 {
-	RPMA_DEBUG_TRACE;
-	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
-
-	if (addr == NULL || info_ptr == NULL)
-		return RPMA_E_INVAL;
-
 	/* prepare hints */
 	struct rdma_addrinfo hints;
 	memset(&hints, 0, sizeof(hints));
@@ -51,11 +46,10 @@ rpma_info_new(const char *addr, const char *port, enum rpma_info_side side,
 	hints.ai_port_space = RDMA_PS_TCP;
 
 	/* query */
-	struct rdma_addrinfo *rai = NULL;
 #ifdef RDMA_GETADDRINFO_OLD_SIGNATURE
-	int ret = rdma_getaddrinfo((char *)addr, (char *)port, &hints, &rai);
+	int ret = rdma_getaddrinfo((char *)addr, (char *)port, &hints, rai_ptr);
 #else
-	int ret = rdma_getaddrinfo(addr, port, &hints, &rai);
+	int ret = rdma_getaddrinfo(addr, port, &hints, rai_ptr);
 #endif
 	if (ret) {
 		const char *err = (ret == -1 || ret == EAI_SYSTEM) ?
@@ -66,21 +60,53 @@ rpma_info_new(const char *addr, const char *port, enum rpma_info_side side,
 		return RPMA_E_PROVIDER;
 	}
 
+	return 0;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_info_new -- create an address translation cache aka the info object
+ */
+int
+rpma_info_new(const char *addr, const char *port, enum rpma_info_side side,
+		struct rpma_info **info_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	if (addr == NULL || info_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	/* the address translated recently may be shared via the address cache */
+	struct rpma_addr_cache_ref *ref = NULL;
+	struct rdma_addrinfo *rai = rpma_addr_cache_lookup_addrinfo(addr, port, side, &ref);
+	if (rai == NULL) {
+		int ret = info_getaddrinfo(addr, port, side, &rai);
+		if (ret)
+			return ret;
+
+		/* if the address is not cached the info object remains its only owner */
+		(void) rpma_addr_cache_insert_addrinfo(addr, port, side, rai, &ref);
+	}
+
 	struct rpma_info *info = malloc(sizeof(*info));
-	if (info == NULL) {
-		ret = RPMA_E_NOMEM;
+	if (info == NULL)
 		goto err_freeaddrinfo;
-	}
 
 	info->side = side;
 	info->rai = rai;
+	info->ref = ref;
 	*info_ptr = info;
 
 	return 0;
 
 err_freeaddrinfo:
-	rdma_freeaddrinfo(rai);
-	return ret;
+	if (ref)
+		rpma_addr_cache_release(&ref);
+	else
+		rdma_freeaddrinfo(rai);
+	return RPMA_E_NOMEM;
 }
 
 /*
@@ -98,7 +124,10 @@ rpma_info_delete(struct rpma_info **info_ptr)
 	if (info == NULL)
 		return 0;
 
-	rdma_freeaddrinfo(info->rai);
+	if (info->ref)
+		rpma_addr_cache_release(&info->ref);
+	else
+		rdma_freeaddrinfo(info->rai);
 	free(info);
 	*info_ptr = NULL;
 
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * instr.c -- librpma connection instrumentation
+ */
+
+#include "instr.h"
+#include "metrics.h"
+
+/* internal librpma API */
+
+/*
+ * rpma_instr_init -- initialize the instrumentation of the connection of the QP
+ */
+void
+rpma_instr_init(struct rpma_instr *instr, struct ibv_qp *qp)
+{
+	rpma_stats_init(&instr->stats);
+	rpma_latency_queue_init(&instr->latency, qp);
+	rpma_trace_conn_init(&instr->trace);
+}
+
+/*
+ * rpma_instr_fini -- release the latency queue and the tracing state of the connection
+ */
+void
+rpma_instr_fini(struct rpma_instr *instr)
+{
+	rpma_trace_conn_fini(&instr->trace);
+	rpma_latency_queue_fini(&instr->latency);
+}
+
+/*
+ * rpma_instr_complete -- count, measure and trace the completions obtained for the connection
+ */
+void
+rpma_instr_complete(struct rpma_instr *instr, const struct ibv_wc *wc, int num)
+{
+	RPMA_STATS_ADD(&instr->stats, RPMA_STATS_COMPLETIONS, num);
+	for (int i = 0; i < num; i++) {
+		if (wc[i].status == IBV_WC_SUCCESS)
+			continue;
+		RPMA_STATS_ADD(&instr->stats, RPMA_STATS_COMPLETION_ERRORS, 1);
+		if (wc[i].status == IBV_WC_RNR_RETRY_EXC_ERR)
+			RPMA_METRICS_ADD(RPMA_METRICS_RNR_RETRY_EXCEEDED, 1);
+	}
+
+	rpma_latency_complete(&instr->latency, wc, num);
+	rpma_trace_complete(&instr->trace, wc, num);
+}
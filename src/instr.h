@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * instr.h -- librpma connection instrumentation internal definitions
+ */
+
+#ifndef LIBRPMA_INSTR_H
+#define LIBRPMA_INSTR_H
+
+#include <infiniband/verbs.h>
+
+#include "latency.h"
+#include "stats.h"
+#include "trace.h"
+
+/*
+ * The instrumentation of a connection: the operation statistics, the operations whose
+ * latency is measured and the tracing state. The CQs of the connection point to it,
+ * so the completions obtained from them are accounted in one place.
+ */
+struct rpma_instr {
+	struct rpma_stats stats;
+	struct rpma_latency_queue latency;
+	struct rpma_trace_conn trace;
+};
+
+/*
+ * rpma_instr_init -- initialize the instrumentation of the connection of the QP
+ *
+ * ASSUMPTIONS
+ * - instr != NULL && qp != NULL
+ */
+void rpma_instr_init(struct rpma_instr *instr, struct ibv_qp *qp);
+
+/*
+ * rpma_instr_fini -- release the latency queue and the tracing state of the connection
+ *
+ * ASSUMPTIONS
+ * - instr != NULL && rpma_instr_init(instr) has been called
+ */
+void rpma_instr_fini(struct rpma_instr *instr);
+
+/*
+ * rpma_instr_complete -- count, measure and trace the completions obtained for the connection
+ *
+ * ASSUMPTIONS
+ * - instr != NULL && (wc != NULL || num == 0)
+ */
+void rpma_instr_complete(struct rpma_instr *instr, const struct ibv_wc *wc, int num);
+
+#endif /* LIBRPMA_INSTR_H */
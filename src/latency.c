@@ -0,0 +1,552 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * latency.c -- librpma latency histograms
+ *
+ * The latency of an operation is the time from posting it to obtaining its completion.
+ * The latencies are recorded into a log-linear histogram per operation type: the values
+ * below 2^LATENCY_SUB_BITS nanoseconds have their own buckets and every next power of two
+ * is split into 2^(LATENCY_SUB_BITS - 1) buckets of equal width, so a value is known
+ * with the relative error below 1 / 2^(LATENCY_SUB_BITS - 1).
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "debug.h"
+#include "latency.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+#define LATENCY_SUB_BITS	5
+#define LATENCY_SUB_COUNT	(1U << LATENCY_SUB_BITS)
+#define LATENCY_HALF_COUNT	(LATENCY_SUB_COUNT / 2)
+/* the exact values and the halves of all the next powers of two up to 2^64 */
+#define LATENCY_BUCKETS_NUM \
+	(LATENCY_SUB_COUNT + (64 - LATENCY_SUB_BITS) * LATENCY_HALF_COUNT)
+
+struct latency_hist {
+	_Atomic uint64_t buckets[LATENCY_BUCKETS_NUM];
+	_Atomic uint64_t sum_ns;
+	_Atomic uint64_t min_ns;
+	_Atomic uint64_t max_ns;
+};
+
+static atomic_bool Latency_enabled;
+
+static struct {
+	pthread_mutex_t lock; /* protects the list and the allocation of the entries */
+	struct rpma_latency_queue *queues; /* all the registered queues */
+} Latency = {PTHREAD_MUTEX_INITIALIZER, NULL};
+static struct latency_hist Latency_hists[RPMA_LATENCY_OP_NUM] = {
+	[0 ... RPMA_LATENCY_OP_NUM - 1] = {.min_ns = UINT64_MAX}
+};
+
+/*
+ * latency_now -- the current time in nanoseconds
+ */
+static uint64_t
+latency_now(void)
+{
+	struct timespec ts;
+	(void) clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * latency_bucket -- the index of the bucket of the value
+ */
+static unsigned
+latency_bucket(uint64_t value)
+{
+	if (value < LATENCY_SUB_COUNT)
+		return (unsigned)value;
+
+	/* the position of the most significant bit is >= LATENCY_SUB_BITS */
+	unsigned msb = 63U - (unsigned)__builtin_clzll(value);
+	unsigned shift = msb - (LATENCY_SUB_BITS - 1);
+	/* LATENCY_HALF_COUNT <= sub < LATENCY_SUB_COUNT */
+	unsigned sub = (unsigned)(value >> shift);
+
+	return LATENCY_SUB_COUNT + (shift - 1) * LATENCY_HALF_COUNT + (sub - LATENCY_HALF_COUNT);
+}
+
+/*
+ * latency_bucket_highest -- the highest value falling into the bucket
+ */
+static uint64_t
+latency_bucket_highest(unsigned bucket)
+{
+	if (bucket < LATENCY_SUB_COUNT)
+		return bucket;
+
+	unsigned shift = (bucket - LATENCY_SUB_COUNT) / LATENCY_HALF_COUNT + 1;
+	uint64_t sub = (bucket - LATENCY_SUB_COUNT) % LATENCY_HALF_COUNT + LATENCY_HALF_COUNT;
+
+	/* it wraps around to UINT64_MAX for the last bucket */
+	return ((sub + 1) << shift) - 1;
+}
+
+/*
+ * latency_record -- record the latency of the operation
+ */
+static void
+latency_record(enum rpma_latency_op op, uint64_t latency_ns)
+{
+	struct latency_hist *hist = &Latency_hists[op];
+
+	atomic_fetch_add_explicit(&hist->buckets[latency_bucket(latency_ns)], 1,
+			memory_order_relaxed);
+	atomic_fetch_add_explicit(&hist->sum_ns, latency_ns, memory_order_relaxed);
+
+	uint64_t min = atomic_load_explicit(&hist->min_ns, memory_order_relaxed);
+	while (latency_ns < min && !atomic_compare_exchange_weak_explicit(&hist->min_ns, &min,
+			latency_ns, memory_order_relaxed, memory_order_relaxed))
+		;
+
+	uint64_t max = atomic_load_explicit(&hist->max_ns, memory_order_relaxed);
+	while (latency_ns > max && !atomic_compare_exchange_weak_explicit(&hist->max_ns, &max,
+			latency_ns, memory_order_relaxed, memory_order_relaxed))
+		;
+}
+
+/*
+ * latency_percentile -- the value not exceeded by the given part (in 1/1000) of the values
+ */
+static uint64_t
+latency_percentile(const uint64_t *buckets, uint64_t count, uint64_t permille, uint64_t max)
+{
+	/* the rank of the value (rounded up) */
+	uint64_t rank = (count * permille + 999) / 1000;
+	uint64_t seen = 0;
+
+	for (unsigned i = 0; i < LATENCY_BUCKETS_NUM; i++) {
+		seen += buckets[i];
+		if (seen >= rank) {
+			uint64_t highest = latency_bucket_highest(i);
+			return highest < max ? highest : max;
+		}
+	}
+
+	return max;
+}
+
+/*
+ * latency_queue_lock -- acquire the queue
+ */
+static void
+latency_queue_lock(struct rpma_latency_queue *queue)
+{
+	while (atomic_flag_test_and_set_explicit(&queue->lock, memory_order_acquire))
+		;
+}
+
+/*
+ * latency_queue_unlock -- release the queue
+ */
+static void
+latency_queue_unlock(struct rpma_latency_queue *queue)
+{
+	atomic_flag_clear_explicit(&queue->lock, memory_order_release);
+}
+
+/*
+ * latency_queue_entries_new -- allocate the entries of the queue up to the depth
+ * of the send queue of its QP
+ */
+static int
+latency_queue_entries_new(struct rpma_latency_queue *queue,
+		struct rpma_latency_entry **entries_ptr, uint32_t *capacity_ptr)
+{
+	struct ibv_qp_attr attr;
+	struct ibv_qp_init_attr init_attr;
+
+	int ret = ibv_query_qp(queue->qp, &attr, IBV_QP_CAP, &init_attr);
+	if (ret) {
+		RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_query_qp()");
+		return RPMA_E_PROVIDER;
+	}
+
+	uint32_t capacity = attr.cap.max_send_wr;
+	if (capacity == 0) {
+		*entries_ptr = NULL;
+		*capacity_ptr = 0;
+		return 0;
+	}
+
+	struct rpma_latency_entry *entries = malloc(capacity * sizeof(*entries));
+	if (entries == NULL)
+		return RPMA_E_NOMEM;
+
+	*entries_ptr = entries;
+	*capacity_ptr = capacity;
+
+	return 0;
+}
+
+/*
+ * latency_queue_wait_posted -- wait until the operation of the entry has been posted
+ * (or posting it has failed)
+ */
+static int
+latency_queue_wait_posted(struct rpma_latency_entry *entry)
+{
+	int state;
+
+	while ((state = atomic_load_explicit(&entry->state, memory_order_acquire)) ==
+			RPMA_LATENCY_ENTRY_POSTING)
+		;
+
+	return state;
+}
+
+/*
+ * latency_queue_drop -- drop all the entries of the queue (the ones being posted are waited for)
+ */
+static void
+latency_queue_drop(struct rpma_latency_queue *queue, uint32_t used)
+{
+	for (uint32_t i = 0; i < used; i++)
+		(void) latency_queue_wait_posted(
+				&queue->entries[(queue->head + i) % queue->capacity]);
+
+	queue->head = 0;
+}
+
+/*
+ * latency_queue_pop -- take the oldest entry of the wr_id out of the queue
+ *
+ * RETURN VALUE
+ * It returns false if the queue does not have any entry of the wr_id.
+ */
+static bool
+latency_queue_pop(struct rpma_latency_queue *queue, uint32_t *used_ptr, uint64_t wr_id,
+		struct rpma_latency_entry *popped)
+{
+	uint32_t used = *used_ptr;
+
+	/* the failed posts at the head of the queue are just dropped */
+	while (used > 0 && latency_queue_wait_posted(&queue->entries[queue->head]) ==
+			RPMA_LATENCY_ENTRY_FAILED) {
+		queue->head = (queue->head + 1) % queue->capacity;
+		used--;
+	}
+
+	for (uint32_t i = 0; i < used; i++) {
+		struct rpma_latency_entry *entry =
+			&queue->entries[(queue->head + i) % queue->capacity];
+		if (latency_queue_wait_posted(entry) != RPMA_LATENCY_ENTRY_POSTED ||
+				entry->wr_id != wr_id)
+			continue;
+
+		/* move the head entry in place of the popped one */
+		struct rpma_latency_entry *head = &queue->entries[queue->head];
+		popped->wr_id = entry->wr_id;
+		popped->post_ns = entry->post_ns;
+		popped->op = entry->op;
+		if (entry != head) {
+			entry->wr_id = head->wr_id;
+			entry->post_ns = head->post_ns;
+			entry->op = head->op;
+			atomic_store_explicit(&entry->state,
+				atomic_load_explicit(&head->state, memory_order_relaxed),
+				memory_order_relaxed);
+		}
+		queue->head = (queue->head + 1) % queue->capacity;
+		*used_ptr = used - 1;
+
+		return true;
+	}
+
+	*used_ptr = used;
+
+	return false;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_latency_queue_init -- initialize the empty queue of the QP and register it
+ */
+void
+rpma_latency_queue_init(struct rpma_latency_queue *queue, struct ibv_qp *qp)
+{
+	atomic_flag_clear(&queue->lock);
+	atomic_init(&queue->pending, 0);
+	queue->broken = false;
+	queue->capacity = 0;
+	queue->head = 0;
+	queue->entries = NULL;
+	queue->qp = qp;
+	queue->prev = NULL;
+
+	(void) pthread_mutex_lock(&Latency.lock);
+
+	if (atomic_load_explicit(&Latency_enabled, memory_order_relaxed) &&
+			latency_queue_entries_new(queue, &queue->entries, &queue->capacity))
+		RPMA_LOG_WARNING("the latency of the operations of the connection "
+				"will not be measured");
+
+	queue->next = Latency.queues;
+	if (Latency.queues)
+		Latency.queues->prev = queue;
+	Latency.queues = queue;
+
+	(void) pthread_mutex_unlock(&Latency.lock);
+}
+
+/*
+ * rpma_latency_queue_fini -- unregister the queue and free its entries
+ */
+void
+rpma_latency_queue_fini(struct rpma_latency_queue *queue)
+{
+	(void) pthread_mutex_lock(&Latency.lock);
+
+	if (queue->prev)
+		queue->prev->next = queue->next;
+	else
+		Latency.queues = queue->next;
+	if (queue->next)
+		queue->next->prev = queue->prev;
+
+	(void) pthread_mutex_unlock(&Latency.lock);
+
+	free(queue->entries);
+	queue->entries = NULL;
+	queue->capacity = 0;
+}
+
+/*
+ * rpma_latency_post_begin -- start measuring the latency of the operation being posted
+ * if the latency is measured and the operation is posted with RPMA_F_COMPLETION_ALWAYS
+ */
+struct rpma_latency_entry *
+rpma_latency_post_begin(struct rpma_latency_queue *queue, int flags, enum rpma_latency_op op,
+		const void *op_context)
+{
+	if ((flags & RPMA_F_COMPLETION_ALWAYS) != RPMA_F_COMPLETION_ALWAYS ||
+			!atomic_load_explicit(&Latency_enabled, memory_order_relaxed))
+		return NULL;
+
+	latency_queue_lock(queue);
+
+	uint32_t used = atomic_load_explicit(&queue->pending, memory_order_relaxed);
+	if (queue->broken || used >= queue->capacity) {
+		latency_queue_unlock(queue);
+		return NULL;
+	}
+
+	struct rpma_latency_entry *entry =
+		&queue->entries[(queue->head + used) % queue->capacity];
+	entry->wr_id = (uint64_t)(uintptr_t)op_context;
+	entry->op = op;
+	atomic_store_explicit(&entry->state, RPMA_LATENCY_ENTRY_POSTING, memory_order_relaxed);
+
+	/* the completion poller has to wait for the entry from now on */
+	atomic_store_explicit(&queue->pending, used + 1, memory_order_relaxed);
+
+	latency_queue_unlock(queue);
+
+	entry->post_ns = latency_now();
+
+	return entry;
+}
+
+/*
+ * rpma_latency_post_end -- mark the entry as posted if the operation has been posted
+ * successfully or as failed otherwise
+ */
+void
+rpma_latency_post_end(struct rpma_latency_entry *entry, int ret)
+{
+	atomic_store_explicit(&entry->state,
+			ret ? RPMA_LATENCY_ENTRY_FAILED : RPMA_LATENCY_ENTRY_POSTED,
+			memory_order_release);
+}
+
+/*
+ * rpma_latency_complete -- record the latencies of the operations completed by the send queue
+ * completions (the other ones are skipped)
+ */
+void
+rpma_latency_complete(struct rpma_latency_queue *queue, const struct ibv_wc *wc, int num)
+{
+	if (atomic_load_explicit(&queue->pending, memory_order_relaxed) == 0)
+		return;
+
+	uint64_t now = latency_now();
+
+	latency_queue_lock(queue);
+
+	uint32_t used = atomic_load_explicit(&queue->pending, memory_order_relaxed);
+	for (int i = 0; i < num && used > 0; i++) {
+		/* the completions of the receive queue */
+		if (wc[i].opcode & IBV_WC_RECV)
+			continue;
+
+		if (wc[i].status != IBV_WC_SUCCESS) {
+			/*
+			 * The QP is in the error state, so all the outstanding operations
+			 * (also the ones without RPMA_F_COMPLETION_ALWAYS) are flushed.
+			 */
+			latency_queue_drop(queue, used);
+			queue->broken = true;
+			used = 0;
+			break;
+		}
+
+		/* the operations posted before the latency was measured are skipped */
+		struct rpma_latency_entry entry;
+		if (latency_queue_pop(queue, &used, wc[i].wr_id, &entry))
+			latency_record(entry.op, now - entry.post_ns);
+	}
+	atomic_store_explicit(&queue->pending, used, memory_order_relaxed);
+
+	latency_queue_unlock(queue);
+}
+
+/* public librpma API */
+
+/*
+ * rpma_latency_enable -- start measuring the latency of the operations
+ */
+int
+rpma_latency_enable(void)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	int ret = 0;
+
+	(void) pthread_mutex_lock(&Latency.lock);
+
+	/* allocate the entries of all the queues first, so they are installed only on success */
+	struct rpma_latency_queue *queue;
+	size_t num = 0;
+	for (queue = Latency.queues; queue != NULL; queue = queue->next)
+		num++;
+
+	struct {
+		struct rpma_latency_entry *entries;
+		uint32_t capacity;
+	} *allocs = NULL;
+
+	if (num > 0) {
+		allocs = calloc(num, sizeof(*allocs));
+		if (allocs == NULL) {
+			ret = RPMA_E_NOMEM;
+			goto unlock;
+		}
+	}
+
+	size_t i = 0;
+	for (queue = Latency.queues; queue != NULL; queue = queue->next, i++) {
+		if (queue->entries != NULL)
+			continue;
+
+		ret = latency_queue_entries_new(queue, &allocs[i].entries, &allocs[i].capacity);
+		if (ret)
+			goto err_free_allocs;
+	}
+
+	/* install the entries and resume measuring on the connections stopped by an error */
+	i = 0;
+	for (queue = Latency.queues; queue != NULL; queue = queue->next, i++) {
+		latency_queue_lock(queue);
+		if (queue->entries == NULL) {
+			/* nothing can be pending without the entries */
+			queue->entries = allocs[i].entries;
+			queue->capacity = allocs[i].capacity;
+			queue->head = 0;
+		}
+		queue->broken = false;
+		latency_queue_unlock(queue);
+	}
+
+	free(allocs);
+
+	atomic_store_explicit(&Latency_enabled, true, memory_order_relaxed);
+
+unlock:
+	(void) pthread_mutex_unlock(&Latency.lock);
+
+	return ret;
+
+err_free_allocs:
+	for (i = 0; i < num; i++)
+		free(allocs[i].entries);
+	free(allocs);
+	goto unlock;
+}
+
+/*
+ * rpma_latency_disable -- stop measuring the latency of the operations
+ */
+int
+rpma_latency_disable(void)
+{
+	RPMA_DEBUG_TRACE;
+
+	atomic_store_explicit(&Latency_enabled, false, memory_order_relaxed);
+
+	return 0;
+}
+
+/*
+ * rpma_latency_get_stats -- get a snapshot of the latency histogram of the operation type
+ */
+int
+rpma_latency_get_stats(enum rpma_latency_op op, bool reset, struct rpma_latency_stats *stats)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if ((unsigned)op >= RPMA_LATENCY_OP_NUM || stats == NULL)
+		return RPMA_E_INVAL;
+
+	struct latency_hist *hist = &Latency_hists[op];
+	uint64_t buckets[LATENCY_BUCKETS_NUM];
+	uint64_t count = 0;
+	uint64_t sum_ns, min_ns, max_ns;
+
+	/* the operations recorded at the same time go either to this snapshot or to the next one */
+	if (reset) {
+		for (unsigned i = 0; i < LATENCY_BUCKETS_NUM; i++)
+			buckets[i] = atomic_exchange_explicit(&hist->buckets[i], 0,
+					memory_order_relaxed);
+		sum_ns = atomic_exchange_explicit(&hist->sum_ns, 0, memory_order_relaxed);
+		min_ns = atomic_exchange_explicit(&hist->min_ns, UINT64_MAX, memory_order_relaxed);
+		max_ns = atomic_exchange_explicit(&hist->max_ns, 0, memory_order_relaxed);
+	} else {
+		for (unsigned i = 0; i < LATENCY_BUCKETS_NUM; i++)
+			buckets[i] = atomic_load_explicit(&hist->buckets[i], memory_order_relaxed);
+		sum_ns = atomic_load_explicit(&hist->sum_ns, memory_order_relaxed);
+		min_ns = atomic_load_explicit(&hist->min_ns, memory_order_relaxed);
+		max_ns = atomic_load_explicit(&hist->max_ns, memory_order_relaxed);
+	}
+
+	for (unsigned i = 0; i < LATENCY_BUCKETS_NUM; i++)
+		count += buckets[i];
+
+	memset(stats, 0, sizeof(*stats));
+	if (count == 0)
+		return 0;
+
+	stats->count = count;
+	stats->min_ns = (min_ns == UINT64_MAX) ? 0 : min_ns;
+	stats->max_ns = max_ns;
+	stats->mean_ns = sum_ns / count;
+	stats->p50_ns = latency_percentile(buckets, count, 500, max_ns);
+	stats->p99_ns = latency_percentile(buckets, count, 990, max_ns);
+	stats->p999_ns = latency_percentile(buckets, count, 999, max_ns);
+
+	return 0;
+}
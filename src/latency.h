@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * latency.h -- librpma latency histograms internal definitions
+ */
+
+#ifndef LIBRPMA_LATENCY_H
+#define LIBRPMA_LATENCY_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "librpma.h"
+
+/* the state of an entry of the queue */
+enum rpma_latency_entry_state {
+	RPMA_LATENCY_ENTRY_POSTING, /* the operation is being posted */
+	RPMA_LATENCY_ENTRY_POSTED, /* the operation has been posted successfully */
+	RPMA_LATENCY_ENTRY_FAILED /* posting the operation has failed */
+};
+
+/* an operation posted on a connection and waiting for its completion */
+struct rpma_latency_entry {
+	uint64_t wr_id; /* the op_context of the operation */
+	uint64_t post_ns; /* CLOCK_MONOTONIC */
+	enum rpma_latency_op op;
+	_Atomic int state; /* enum rpma_latency_entry_state */
+};
+
+/*
+ * The operations posted on a connection with RPMA_F_COMPLETION_ALWAYS in the order their
+ * entries have been reserved. The completions of a send queue are generated in the order
+ * of posting, which differs from the order of the entries only for the operations posted
+ * concurrently, so the completion is matched with the oldest entry of the same wr_id.
+ *
+ * The entries are allocated up to the depth of the send queue of the QP when the latency
+ * measuring is enabled, so posting takes the lock only to reserve an entry and it is not
+ * held across ibv_post_send(3).
+ */
+struct rpma_latency_queue {
+	atomic_flag lock; /* protects all the fields below but pending and the entries' state */
+	_Atomic uint32_t pending; /* the number of the entries (and the posts in progress) */
+	bool broken; /* an error completion has been obtained; nothing is measured until enabled */
+	uint32_t capacity;
+	uint32_t head; /* the oldest entry */
+	struct rpma_latency_entry *entries; /* allocated when the latency measuring is enabled */
+	struct ibv_qp *qp; /* the QP whose send queue depth is the capacity */
+
+	/* the list of all the queues (protected by the global lock) */
+	struct rpma_latency_queue *prev;
+	struct rpma_latency_queue *next;
+};
+
+/*
+ * rpma_latency_queue_init -- initialize the empty queue of the QP and register it, so its
+ * entries are allocated while the latency is measured
+ *
+ * ASSUMPTIONS
+ * - queue != NULL && qp != NULL
+ */
+void rpma_latency_queue_init(struct rpma_latency_queue *queue, struct ibv_qp *qp);
+
+/*
+ * rpma_latency_queue_fini -- unregister the queue and free its entries
+ *
+ * ASSUMPTIONS
+ * - queue != NULL && rpma_latency_queue_init(queue) has been called
+ */
+void rpma_latency_queue_fini(struct rpma_latency_queue *queue);
+
+/*
+ * rpma_latency_post_begin -- start measuring the latency of the operation being posted
+ * if the latency is measured and the operation is posted with RPMA_F_COMPLETION_ALWAYS
+ *
+ * ASSUMPTIONS
+ * - queue != NULL
+ *
+ * RETURN VALUE
+ * It returns the entry reserved for the operation which has to be passed
+ * to rpma_latency_post_end() after the operation is posted or NULL if the operation
+ * is not measured.
+ */
+struct rpma_latency_entry *rpma_latency_post_begin(struct rpma_latency_queue *queue,
+		int flags, enum rpma_latency_op op, const void *op_context);
+
+/*
+ * rpma_latency_post_end -- mark the entry as posted if the operation has been posted
+ * successfully or as failed otherwise
+ *
+ * ASSUMPTIONS
+ * - entry != NULL && it has been returned by rpma_latency_post_begin()
+ */
+void rpma_latency_post_end(struct rpma_latency_entry *entry, int ret);
+
+/*
+ * rpma_latency_complete -- record the latencies of the operations completed by the send queue
+ * completions (the other ones are skipped)
+ *
+ * ASSUMPTIONS
+ * - queue != NULL && (wc != NULL || num == 0)
+ */
+void rpma_latency_complete(struct rpma_latency_queue *queue, const struct ibv_wc *wc, int num);
+
+#endif /* LIBRPMA_LATENCY_H */
@@ -5,8 +5,14 @@
  * librpma.c -- entry points for librpma
  */
 
+#include "addr_cache.h"
+#include "conn_table.h"
+#include "hook.h"
 #include "librpma.h"
+#include "log_async.h"
+#include "log_binary.h"
 #include "log_internal.h"
+#include "trace.h"
 
 /*
  * librpma_init -- load-time initialization for librpma
@@ -35,5 +41,11 @@ __attribute__((destructor)) static void
 #endif
 librpma_fini(void)
 {
+	rpma_conn_table_fini();
+	rpma_addr_cache_fini();
+	rpma_trace_fini();
+	rpma_hook_fini();
+	rpma_log_async_fini();
+	rpma_log_binary_fini();
 	rpma_log_fini();
 }
@@ -78,6 +78,66 @@ rpma_log_fini()
 	rpma_log_default_fini();
 }
 
+/*
+ * rpma_log_get_function -- get the logging function if the messages of the level
+ * are to be logged
+ */
+rpma_log_function *
+rpma_log_get_function(enum rpma_log_level level)
+{
+	if (level > Rpma_log_threshold[RPMA_LOG_THRESHOLD])
+		return NULL;
+
+	return (rpma_log_function *)Rpma_log_function;
+}
+
+#define NSEC_IN_SEC 1000000000ULL
+
+/*
+ * rpma_log_ratelimit -- take a token from the bucket of the call site
+ *
+ * The bucket is kept as the time at which it will be full again (GCRA): every message
+ * logged moves it RPMA_LOG_RATELIMIT_INTERVAL_NS forward and a message is suppressed
+ * if it would move it further than RPMA_LOG_RATELIMIT_BURST intervals from now.
+ */
+int
+rpma_log_ratelimit(struct rpma_log_ratelimit *rl, uint64_t *suppressed)
+{
+	struct timespec ts;
+	(void) clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint64_t now = (uint64_t)ts.tv_sec * NSEC_IN_SEC + (uint64_t)ts.tv_nsec;
+	uint64_t full_at;
+	uint64_t from;
+
+#ifdef ATOMIC_OPERATIONS_SUPPORTED
+	full_at = atomic_load_explicit(&rl->full_at_ns, __ATOMIC_RELAXED);
+	do {
+		from = full_at > now ? full_at : now;
+		if (from - now > (RPMA_LOG_RATELIMIT_BURST - 1) * RPMA_LOG_RATELIMIT_INTERVAL_NS) {
+			atomic_fetch_add_explicit(&rl->suppressed, 1, __ATOMIC_RELAXED);
+			return 0;
+		}
+	} while (!atomic_compare_exchange_weak_explicit(&rl->full_at_ns, &full_at,
+			from + RPMA_LOG_RATELIMIT_INTERVAL_NS, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	*suppressed = atomic_exchange_explicit(&rl->suppressed, 0, __ATOMIC_RELAXED);
+#else
+	/* without the atomic operations the counters are approximate only */
+	full_at = rl->full_at_ns;
+	from = full_at > now ? full_at : now;
+	if (from - now > (RPMA_LOG_RATELIMIT_BURST - 1) * RPMA_LOG_RATELIMIT_INTERVAL_NS) {
+		rl->suppressed++;
+		return 0;
+	}
+
+	rl->full_at_ns = from + RPMA_LOG_RATELIMIT_INTERVAL_NS;
+	*suppressed = rl->suppressed;
+	rl->suppressed = 0;
+#endif /* ATOMIC_OPERATIONS_SUPPORTED */
+
+	return 1;
+}
+
 /* public librpma log API */
 
 #if defined(RPMA_UNIT_TESTS) && !defined(ATOMIC_OPERATIONS_SUPPORTED)
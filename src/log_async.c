@@ -0,0 +1,374 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_async.c -- the asynchronous logging backend
+ *
+ * Every thread logging a message gets its own single-producer single-consumer ring of records.
+ * The thread stores the format and the raw arguments of the message in the next free record
+ * the way the binary logging sink does (see rpma_log_binary_encode()), stamps it with the time
+ * and its cached thread ID and publishes it by moving the tail of the ring. It never waits: if
+ * the ring is full the message is dropped and counted. The background thread formats
+ * the messages of all the rings (see rpma_log_binary_decode()) and writes them out the way
+ * the default logging function does (see rpma_log_default_write()).
+ *
+ * The rings are never freed until the library is unloaded. When a thread exits, its ring is
+ * released and it is reused by the next thread starting to log.
+ *
+ * The string arguments are copied into the record since they may point to buffers which do not
+ * outlive the call, so the long ones are truncated. The format strings are the literals of
+ * the library and they outlive the records.
+ */
+
+#define _GNU_SOURCE
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "librpma.h"
+#include "log_async.h"
+#include "log_binary_format.h"
+#include "log_default.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* the maximum length of a formatted message (the longer ones are truncated) */
+#define LOG_ASYNC_MESSAGE_MAX	512
+
+/* the maximum number of records of a ring */
+#define LOG_ASYNC_RING_SIZE_MAX	(1 << 20)
+
+/* how long the background thread sleeps when all the rings are empty */
+#define LOG_ASYNC_POLL_INTERVAL_NS	1000000
+
+struct log_async_record {
+	enum rpma_log_level level;
+	int line_no;
+	const char *file_name;
+	const char *function_name;
+	const char *format;
+	struct timespec ts;
+	long tid;
+	struct rpma_log_binary_record args; /* only the encoded arguments are used */
+};
+
+struct log_async_ring {
+	struct log_async_ring *next; /* the next ring on the list of all the rings */
+	atomic_bool owned; /* the ring is used by a thread */
+	uint32_t size; /* the number of records (a power of 2) */
+	_Atomic uint64_t head; /* the next record to write out (the background thread) */
+	_Atomic uint64_t tail; /* the next free record (the owning thread) */
+	_Atomic uint64_t dropped; /* the number of messages dropped because the ring was full */
+	struct log_async_record records[];
+};
+
+/* all the rings ever created */
+static struct log_async_ring *_Atomic Rings;
+
+/* the size of the new rings */
+static uint32_t Ring_size;
+
+static atomic_bool Running;
+static pthread_t Thread;
+
+/* the number of the dropped messages already reported */
+static uint64_t Dropped_reported;
+
+/* releases the ring of an exiting thread */
+static pthread_key_t Ring_key;
+static pthread_once_t Ring_key_once = PTHREAD_ONCE_INIT;
+static bool Ring_key_created;
+
+static __thread struct log_async_ring *Thread_ring;
+static __thread long Thread_tid;
+
+/*
+ * log_async_ring_release -- release the ring of the exiting thread
+ */
+static void
+log_async_ring_release(void *arg)
+{
+	struct log_async_ring *ring = arg;
+
+	atomic_store_explicit(&ring->owned, false, memory_order_release);
+}
+
+/*
+ * log_async_key_create -- create the key releasing the rings of the exiting threads
+ */
+static void
+log_async_key_create(void)
+{
+	Ring_key_created = (pthread_key_create(&Ring_key, log_async_ring_release) == 0);
+}
+
+/*
+ * log_async_get_ring -- get the ring of the calling thread, take a released one or create
+ * a new one if the thread has none yet
+ */
+static struct log_async_ring *
+log_async_get_ring(void)
+{
+	if (Thread_ring)
+		return Thread_ring;
+
+	struct log_async_ring *ring = atomic_load_explicit(&Rings, memory_order_acquire);
+	for (; ring != NULL; ring = ring->next) {
+		bool expected = false;
+		if (ring->size == Ring_size &&
+				atomic_compare_exchange_strong_explicit(&ring->owned, &expected,
+					true, memory_order_acquire, memory_order_relaxed))
+			break;
+	}
+
+	if (ring == NULL) {
+		ring = malloc(sizeof(*ring) + Ring_size * sizeof(ring->records[0]));
+		if (ring == NULL)
+			return NULL;
+
+		ring->size = Ring_size;
+		atomic_init(&ring->owned, true);
+		atomic_init(&ring->head, 0);
+		atomic_init(&ring->tail, 0);
+		atomic_init(&ring->dropped, 0);
+
+		struct log_async_ring *head = atomic_load_explicit(&Rings, memory_order_relaxed);
+		do {
+			ring->next = head;
+		} while (!atomic_compare_exchange_weak_explicit(&Rings, &head, ring,
+				memory_order_release, memory_order_relaxed));
+	}
+
+	if (Ring_key_created)
+		(void) pthread_setspecific(Ring_key, ring);
+
+	Thread_tid = syscall(SYS_gettid);
+	Thread_ring = ring;
+
+	return ring;
+}
+
+/*
+ * log_async_drain -- write out the records of all the rings and report the dropped messages
+ */
+static bool
+log_async_drain(void)
+{
+	bool written = false;
+	uint64_t dropped = 0;
+
+	struct log_async_ring *ring = atomic_load_explicit(&Rings, memory_order_acquire);
+	for (; ring != NULL; ring = ring->next) {
+		uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+		uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+		for (; head != tail; head++) {
+			struct log_async_record *rec = &ring->records[head & (ring->size - 1)];
+			char message[LOG_ASYNC_MESSAGE_MAX];
+			(void) rpma_log_binary_decode(&rec->args, rec->format, message,
+					sizeof(message));
+			rpma_log_default_write(rec->level, &rec->ts, rec->tid, rec->file_name,
+					rec->line_no, rec->function_name, message);
+			written = true;
+		}
+
+		/* the records can be reused from now on */
+		atomic_store_explicit(&ring->head, head, memory_order_release);
+		dropped += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+	}
+
+	if (dropped > Dropped_reported &&
+			RPMA_LOG_LEVEL_WARNING <= Rpma_log_threshold[RPMA_LOG_THRESHOLD]) {
+		char message[64];
+		(void) snprintf(message, sizeof(message),
+				"%" PRIu64 " log message(s) dropped, the ring was full\n",
+				dropped - Dropped_reported);
+		rpma_log_default_write(RPMA_LOG_LEVEL_WARNING, NULL, 0, NULL, 0, NULL, message);
+	}
+	Dropped_reported = dropped;
+
+	return written;
+}
+
+/*
+ * log_async_thread -- the background thread writing the records out
+ */
+static void *
+log_async_thread(void *arg)
+{
+	const struct timespec interval = {0, LOG_ASYNC_POLL_INTERVAL_NS};
+
+	while (atomic_load_explicit(&Running, memory_order_acquire)) {
+		if (!log_async_drain())
+			(void) nanosleep(&interval, NULL);
+	}
+
+	return NULL;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_log_async_function -- queue the message with its raw arguments for the background thread
+ */
+void
+rpma_log_async_function(enum rpma_log_level level, const char *file_name, const int line_no,
+	const char *function_name, const char *message_format, ...)
+{
+	if (RPMA_LOG_DISABLED == level)
+		return;
+
+	struct log_async_ring *ring = NULL;
+	if (atomic_load_explicit(&Running, memory_order_acquire))
+		ring = log_async_get_ring();
+
+	va_list arg;
+	va_start(arg, message_format);
+
+	if (ring == NULL) {
+		/* the backend is stopped or out of memory - write the message out right away */
+		char message[LOG_ASYNC_MESSAGE_MAX] = "";
+		int ret = vsnprintf(message, sizeof(message), message_format, arg);
+		va_end(arg);
+		if (ret >= 0)
+			rpma_log_default_write(level, NULL, 0, file_name, line_no, function_name,
+					message);
+		return;
+	}
+
+	uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+	if (tail - head >= ring->size) {
+		va_end(arg);
+		atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+		return;
+	}
+
+	struct log_async_record *rec = &ring->records[tail & (ring->size - 1)];
+	rpma_log_binary_encode(&rec->args, message_format, arg);
+	va_end(arg);
+
+	if (clock_gettime(CLOCK_REALTIME, &rec->ts)) {
+		rec->ts.tv_sec = 0;
+		rec->ts.tv_nsec = 0;
+	}
+	rec->tid = Thread_tid;
+	rec->level = level;
+	rec->file_name = file_name;
+	rec->line_no = line_no;
+	rec->function_name = function_name;
+	rec->format = message_format;
+
+	atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+/*
+ * rpma_log_async_fini -- stop the backend and free all the rings
+ */
+void
+rpma_log_async_fini(void)
+{
+	if (atomic_load(&Running))
+		(void) rpma_log_async_stop();
+
+	struct log_async_ring *ring = atomic_exchange(&Rings, NULL);
+	while (ring) {
+		struct log_async_ring *next = ring->next;
+		free(ring);
+		ring = next;
+	}
+
+	Thread_ring = NULL;
+	if (Ring_key_created) {
+		(void) pthread_key_delete(Ring_key);
+		Ring_key_created = false;
+	}
+}
+
+/* public librpma log API */
+
+/*
+ * rpma_log_async_start -- start the background thread and queue the messages for it
+ */
+int
+rpma_log_async_start(int ring_size)
+{
+	if (ring_size <= 0 || ring_size > LOG_ASYNC_RING_SIZE_MAX)
+		return RPMA_E_INVAL;
+
+	if (atomic_load(&Running))
+		return RPMA_E_INVAL;
+
+	/* round the size up to a power of 2 */
+	uint32_t size = 1;
+	while (size < (uint32_t)ring_size)
+		size <<= 1;
+
+	(void) pthread_once(&Ring_key_once, log_async_key_create);
+
+	Ring_size = size;
+	atomic_store(&Running, true);
+
+	int ret = pthread_create(&Thread, NULL, log_async_thread, NULL);
+	if (ret) {
+		atomic_store(&Running, false);
+		RPMA_LOG_ERROR_WITH_ERRNO(ret, "pthread_create()");
+		return RPMA_E_UNKNOWN;
+	}
+
+	while (RPMA_E_AGAIN == rpma_log_set_function(rpma_log_async_function))
+		;
+
+	return 0;
+}
+
+/*
+ * rpma_log_async_stop -- restore the default logging function, stop the background thread
+ * and write out the remaining records
+ */
+int
+rpma_log_async_stop(void)
+{
+	if (!atomic_load(&Running))
+		return RPMA_E_INVAL;
+
+	/* a user-defined logging function set in the meantime is kept */
+	if (Rpma_log_function == (uintptr_t)rpma_log_async_function) {
+		while (RPMA_E_AGAIN == rpma_log_set_function(RPMA_LOG_USE_DEFAULT_FUNCTION))
+			;
+	}
+
+	atomic_store(&Running, false);
+	(void) pthread_join(Thread, NULL);
+
+	(void) log_async_drain();
+
+	return 0;
+}
+
+/*
+ * rpma_log_async_get_dropped -- get the number of messages dropped because a ring was full
+ */
+int
+rpma_log_async_get_dropped(uint64_t *dropped)
+{
+	if (dropped == NULL)
+		return RPMA_E_INVAL;
+
+	uint64_t sum = 0;
+	struct log_async_ring *ring = atomic_load_explicit(&Rings, memory_order_acquire);
+	for (; ring != NULL; ring = ring->next)
+		sum += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+
+	*dropped = sum;
+
+	return 0;
+}
@@ -0,0 +1,28 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_async.h -- the asynchronous logging backend internal definitions
+ */
+
+#ifndef LIBRPMA_LOG_ASYNC_H
+#define LIBRPMA_LOG_ASYNC_H
+
+#include "librpma.h"
+
+/*
+ * rpma_log_async_function -- the logging function queueing the messages for the background
+ * thread (see rpma_log_async_start(3))
+ */
+void rpma_log_async_function(enum rpma_log_level level, const char *file_name,
+	const int line_no, const char *function_name, const char *message_format, ...);
+
+/*
+ * rpma_log_async_fini -- stop the backend and free all the rings when the library is unloaded
+ *
+ * ERRORS
+ * rpma_log_async_fini() cannot fail.
+ */
+void rpma_log_async_fini(void);
+
+#endif /* LIBRPMA_LOG_ASYNC_H */
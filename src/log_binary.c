@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_binary.c -- the binary logging sink
+ *
+ * Instead of formatting the message, the logging thread stores the time, its thread ID,
+ * the ID of the call site and the raw arguments of the message in the next record
+ * of the ring kept in a memory-mapped file (see log_binary_format.h). The format string,
+ * the file and the function name are stored only once per call site. Nothing is written
+ * out by the library; the file is decoded offline by the rpma_log_decode tool.
+ *
+ * The ring is overwritten in circles, so the file always keeps the most recent records.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "librpma.h"
+#include "log_binary.h"
+#include "log_binary_format.h"
+#include "log_default.h"
+#include "log_internal.h"
+
+#define NSEC_IN_SEC 1000000000ULL
+
+/* the records follow the header and the table of the call sites */
+#define LOG_BINARY_RECORDS_OFFSET \
+	(RPMA_LOG_BINARY_HEADER_SIZE + \
+	RPMA_LOG_BINARY_SITES_MAX * sizeof(struct rpma_log_binary_site))
+
+/* the minimum size of the file */
+#define LOG_BINARY_SIZE_MIN \
+	(LOG_BINARY_RECORDS_OFFSET + sizeof(struct rpma_log_binary_record))
+
+struct log_binary_map {
+	void *addr;
+	size_t size;
+	struct rpma_log_binary_header *header;
+	struct rpma_log_binary_site *sites;
+	struct rpma_log_binary_record *records;
+};
+
+static struct log_binary_map Map_storage;
+
+/* the file currently mapped (NULL if the sink is stopped) */
+static struct log_binary_map *_Atomic Map;
+
+/* the number of the threads using the mapping at the moment */
+static _Atomic uint64_t Writers;
+
+static __thread long Thread_tid;
+
+/*
+ * log_binary_copy -- copy the string truncating it if it does not fit
+ */
+static void
+log_binary_copy(char *dst, size_t size, const char *src)
+{
+	if (src == NULL)
+		src = "";
+
+	size_t len = strnlen(src, size - 1);
+	memcpy(dst, src, len);
+	dst[len] = '\0';
+}
+
+/*
+ * log_binary_get_site -- look up the call site or add it to the table
+ *
+ * RETURN VALUE
+ * The ID of the call site or -1 if the table is full.
+ */
+static int
+log_binary_get_site(struct log_binary_map *map, const char *file_name, int line_no,
+		const char *function_name, const char *format)
+{
+	uint64_t format_addr = (uint64_t)(uintptr_t)format;
+	uint64_t file_addr = (uint64_t)(uintptr_t)file_name;
+	uint64_t hash = format_addr ^ (file_addr >> 4) ^ (uint32_t)line_no;
+	hash *= UINT64_C(0x9E3779B97F4A7C15);
+
+	for (uint32_t i = 0; i < RPMA_LOG_BINARY_SITES_MAX; i++) {
+		uint32_t id = (uint32_t)((hash >> 32) + i) % RPMA_LOG_BINARY_SITES_MAX;
+		struct rpma_log_binary_site *site = &map->sites[id];
+
+		uint32_t state = atomic_load_explicit(&site->state, memory_order_acquire);
+		if (state == RPMA_LOG_BINARY_SITE_EMPTY) {
+			if (atomic_compare_exchange_strong_explicit(&site->state, &state,
+					RPMA_LOG_BINARY_SITE_BUSY, memory_order_acquire,
+					memory_order_acquire)) {
+				site->line_no = line_no;
+				site->format_addr = format_addr;
+				site->file_addr = file_addr;
+				log_binary_copy(site->file_name, sizeof(site->file_name),
+						file_name);
+				log_binary_copy(site->function_name, sizeof(site->function_name),
+						function_name);
+				log_binary_copy(site->format, sizeof(site->format), format);
+				atomic_store_explicit(&site->state, RPMA_LOG_BINARY_SITE_READY,
+						memory_order_release);
+				return (int)id;
+			}
+		}
+
+		/* the call site is being added by another thread right now */
+		while (state == RPMA_LOG_BINARY_SITE_BUSY) {
+			sched_yield();
+			state = atomic_load_explicit(&site->state, memory_order_acquire);
+		}
+
+		if (site->format_addr == format_addr && site->file_addr == file_addr &&
+				site->line_no == line_no)
+			return (int)id;
+	}
+
+	return -1;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_log_binary_function -- store the raw arguments of the message in the next record
+ */
+void
+rpma_log_binary_function(enum rpma_log_level level, const char *file_name, const int line_no,
+	const char *function_name, const char *message_format, ...)
+{
+	if (RPMA_LOG_DISABLED == level)
+		return;
+
+	va_list arg;
+	va_start(arg, message_format);
+
+	atomic_fetch_add(&Writers, 1);
+	struct log_binary_map *map = atomic_load(&Map);
+	if (map == NULL) {
+		atomic_fetch_sub(&Writers, 1);
+
+		/* the sink is stopped - write the message out right away */
+		char message[1024] = "";
+		int ret = vsnprintf(message, sizeof(message), message_format, arg);
+		va_end(arg);
+		if (ret >= 0)
+			rpma_log_default_write(level, NULL, 0, file_name, line_no, function_name,
+					message);
+		return;
+	}
+
+	struct rpma_log_binary_header *header = map->header;
+	int site = log_binary_get_site(map, file_name, line_no, function_name, message_format);
+	if (site < 0) {
+		atomic_fetch_add_explicit(&header->dropped, 1, memory_order_relaxed);
+		goto out;
+	}
+
+	if (Thread_tid == 0)
+		Thread_tid = syscall(SYS_gettid);
+
+	uint64_t seq = atomic_fetch_add_explicit(&header->next_seq, 1, memory_order_relaxed);
+	struct rpma_log_binary_record *rec = &map->records[seq % header->records_num];
+
+	/* the record is invalid until it is written completely */
+	atomic_store_explicit(&rec->seq, 0, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	struct timespec ts;
+	if (clock_gettime(CLOCK_REALTIME, &ts)) {
+		ts.tv_sec = 0;
+		ts.tv_nsec = 0;
+	}
+	rec->ts_ns = (uint64_t)ts.tv_sec * NSEC_IN_SEC + (uint64_t)ts.tv_nsec;
+	rec->tid = (int32_t)Thread_tid;
+	rec->site = (uint16_t)site;
+	rec->level = (uint8_t)level;
+	rpma_log_binary_encode(rec, message_format, arg);
+
+	atomic_store_explicit(&rec->seq, seq + 1, memory_order_release);
+
+out:
+	va_end(arg);
+	atomic_fetch_sub_explicit(&Writers, 1, memory_order_release);
+}
+
+/*
+ * rpma_log_binary_fini -- stop the sink when the library is unloaded
+ */
+void
+rpma_log_binary_fini(void)
+{
+	if (atomic_load(&Map) != NULL)
+		(void) rpma_log_binary_stop();
+}
+
+/* public librpma log API */
+
+/*
+ * rpma_log_binary_start -- map the file and store the messages in it
+ */
+int
+rpma_log_binary_start(const char *path, size_t size)
+{
+	if (path == NULL || size < LOG_BINARY_SIZE_MIN)
+		return RPMA_E_INVAL;
+
+	if (atomic_load(&Map) != NULL)
+		return RPMA_E_INVAL;
+
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "open(%s)", path);
+		return RPMA_E_UNKNOWN;
+	}
+
+	/* the file is filled with zeros - all the call sites and records are empty */
+	if (ftruncate(fd, (off_t)size)) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "ftruncate(%s)", path);
+		goto err_close;
+	}
+
+	void *addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (addr == MAP_FAILED) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "mmap(%s)", path);
+		goto err_close;
+	}
+	(void) close(fd);
+
+	struct rpma_log_binary_header *header = addr;
+	memcpy(header->magic, RPMA_LOG_BINARY_MAGIC, sizeof(RPMA_LOG_BINARY_MAGIC));
+	header->version = RPMA_LOG_BINARY_VERSION;
+	header->sites_max = RPMA_LOG_BINARY_SITES_MAX;
+	header->records_offset = LOG_BINARY_RECORDS_OFFSET;
+	header->records_num = (size - LOG_BINARY_RECORDS_OFFSET) /
+			sizeof(struct rpma_log_binary_record);
+
+	Map_storage.addr = addr;
+	Map_storage.size = size;
+	Map_storage.header = header;
+	Map_storage.sites = (struct rpma_log_binary_site *)
+			((char *)addr + RPMA_LOG_BINARY_HEADER_SIZE);
+	Map_storage.records = (struct rpma_log_binary_record *)
+			((char *)addr + LOG_BINARY_RECORDS_OFFSET);
+	atomic_store(&Map, &Map_storage);
+
+	while (RPMA_E_AGAIN == rpma_log_set_function(rpma_log_binary_function))
+		;
+
+	return 0;
+
+err_close:
+	(void) close(fd);
+	return RPMA_E_UNKNOWN;
+}
+
+/*
+ * rpma_log_binary_stop -- restore the default logging function and unmap the file
+ */
+int
+rpma_log_binary_stop(void)
+{
+	struct log_binary_map *map = atomic_exchange(&Map, NULL);
+	if (map == NULL)
+		return RPMA_E_INVAL;
+
+	/* a user-defined logging function set in the meantime is kept */
+	if (Rpma_log_function == (uintptr_t)rpma_log_binary_function) {
+		while (RPMA_E_AGAIN == rpma_log_set_function(RPMA_LOG_USE_DEFAULT_FUNCTION))
+			;
+	}
+
+	/* wait for the threads still writing their records */
+	while (atomic_load(&Writers) != 0)
+		sched_yield();
+
+	(void) munmap(map->addr, map->size);
+
+	return 0;
+}
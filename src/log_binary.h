@@ -0,0 +1,28 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_binary.h -- the binary logging sink internal definitions
+ */
+
+#ifndef LIBRPMA_LOG_BINARY_H
+#define LIBRPMA_LOG_BINARY_H
+
+#include "librpma.h"
+
+/*
+ * rpma_log_binary_function -- the logging function storing the raw arguments of the messages
+ * in the memory-mapped file (see rpma_log_binary_start(3))
+ */
+void rpma_log_binary_function(enum rpma_log_level level, const char *file_name,
+	const int line_no, const char *function_name, const char *message_format, ...);
+
+/*
+ * rpma_log_binary_fini -- stop the sink when the library is unloaded
+ *
+ * ERRORS
+ * rpma_log_binary_fini() cannot fail.
+ */
+void rpma_log_binary_fini(void);
+
+#endif /* LIBRPMA_LOG_BINARY_H */
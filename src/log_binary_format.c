@@ -0,0 +1,376 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_binary_format.c -- encoding and decoding of the records of the binary log
+ *
+ * A record keeps only the raw arguments of the message. The format string is kept once per
+ * call site and it is parsed twice: when the arguments are taken from the variable argument
+ * list and when the message is rebuilt from them (by the rpma_log_decode tool). Both sides
+ * use the same parser below, so they agree on the number and the classes of the arguments.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "log_binary_format.h"
+
+/* the classes of the arguments as they are passed through the variable argument list */
+enum log_binary_arg {
+	ARG_NONE,		/* "%%" */
+	ARG_INT,
+	ARG_LONG,
+	ARG_LLONG,
+	ARG_INTMAX,
+	ARG_SIZE,
+	ARG_PTRDIFF,
+	ARG_DOUBLE,
+	ARG_PTR,
+	ARG_STR,
+	ARG_UNSUPPORTED
+};
+
+/* the maximum length of a conversion specification (the longer ones are not recorded) */
+#define LOG_BINARY_SPEC_MAX	32
+
+struct log_binary_spec {
+	const char *start; /* the '%' character */
+	size_t len;
+	int stars; /* the width and/or the precision passed as int arguments */
+	enum log_binary_arg arg;
+};
+
+/*
+ * log_binary_next_spec -- find the next conversion specification of the format
+ *
+ * RETURN VALUE
+ * It returns false if there is no more conversion specifications.
+ */
+static bool
+log_binary_next_spec(const char *format, struct log_binary_spec *spec)
+{
+	const char *p = strchr(format, '%');
+	if (p == NULL)
+		return false;
+
+	spec->start = p++;
+	spec->stars = 0;
+
+	/* the flags */
+	while (*p != '\0' && strchr("-+ #0'", *p) != NULL)
+		p++;
+
+	/* the width and the precision */
+	if (*p == '*') {
+		spec->stars++;
+		p++;
+	}
+	while (*p >= '0' && *p <= '9')
+		p++;
+	if (*p == '.') {
+		p++;
+		if (*p == '*') {
+			spec->stars++;
+			p++;
+		}
+		while (*p >= '0' && *p <= '9')
+			p++;
+	}
+
+	/* the length modifier */
+	enum log_binary_arg integer = ARG_INT;
+	bool is_long_double = false;
+	bool is_wide = false;
+	switch (*p) {
+	case 'h':
+		p += (p[1] == 'h') ? 2 : 1;
+		break;
+	case 'l':
+		if (p[1] == 'l') {
+			integer = ARG_LLONG;
+			p += 2;
+		} else {
+			integer = ARG_LONG;
+			is_wide = true;
+			p++;
+		}
+		break;
+	case 'q':
+		integer = ARG_LLONG;
+		p++;
+		break;
+	case 'j':
+		integer = ARG_INTMAX;
+		p++;
+		break;
+	case 'z':
+		integer = ARG_SIZE;
+		p++;
+		break;
+	case 't':
+		integer = ARG_PTRDIFF;
+		p++;
+		break;
+	case 'L':
+		is_long_double = true;
+		p++;
+		break;
+	default:
+		break;
+	}
+
+	/* the conversion specifier */
+	switch (*p) {
+	case '%':
+		spec->arg = ARG_NONE;
+		break;
+	case 'd':
+	case 'i':
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+		spec->arg = integer;
+		break;
+	case 'c':
+		/* wint_t is promoted to unsigned int as well */
+		spec->arg = ARG_INT;
+		break;
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		spec->arg = is_long_double ? ARG_UNSUPPORTED : ARG_DOUBLE;
+		break;
+	case 'p':
+		spec->arg = ARG_PTR;
+		break;
+	case 's':
+		spec->arg = is_wide ? ARG_UNSUPPORTED : ARG_STR;
+		break;
+	default:
+		/* %n, %m and the invalid ones */
+		spec->arg = ARG_UNSUPPORTED;
+		break;
+	}
+
+	if (*p != '\0')
+		p++;
+	spec->len = (size_t)(p - spec->start);
+
+	return true;
+}
+
+/*
+ * log_binary_store_string -- copy the string into the strings area of the record
+ * and return its offset (the last byte of the area is always an empty string)
+ */
+static uint64_t
+log_binary_store_string(struct rpma_log_binary_record *rec, size_t *used, const char *str)
+{
+	if (str == NULL)
+		str = "(null)";
+
+	size_t left = RPMA_LOG_BINARY_STRINGS_SIZE - 1 - *used;
+	if (left == 0)
+		return RPMA_LOG_BINARY_STRINGS_SIZE - 1;
+
+	size_t len = strnlen(str, left - 1);
+	uint64_t offset = *used;
+	memcpy(&rec->strings[offset], str, len);
+	rec->strings[offset + len] = '\0';
+	*used += len + 1;
+
+	return offset;
+}
+
+/*
+ * rpma_log_binary_encode -- store the arguments described by the format in the record
+ */
+void
+rpma_log_binary_encode(struct rpma_log_binary_record *rec, const char *format, va_list ap)
+{
+	struct log_binary_spec spec;
+	size_t strings_used = 0;
+	uint8_t n = 0;
+
+	rec->strings[RPMA_LOG_BINARY_STRINGS_SIZE - 1] = '\0';
+
+	while (log_binary_next_spec(format, &spec)) {
+		format = spec.start + spec.len;
+		if (spec.arg == ARG_NONE)
+			continue;
+		if (spec.arg == ARG_UNSUPPORTED || spec.len >= LOG_BINARY_SPEC_MAX ||
+				n + spec.stars + 1 > RPMA_LOG_BINARY_ARGS_MAX)
+			break;
+
+		for (int i = 0; i < spec.stars; i++)
+			rec->args[n++] = (uint64_t)(int64_t)va_arg(ap, int);
+
+		double d;
+		switch (spec.arg) {
+		case ARG_INT:
+			rec->args[n] = (uint64_t)(int64_t)va_arg(ap, int);
+			break;
+		case ARG_LONG:
+			rec->args[n] = (uint64_t)va_arg(ap, long);
+			break;
+		case ARG_LLONG:
+			rec->args[n] = (uint64_t)va_arg(ap, long long);
+			break;
+		case ARG_INTMAX:
+			rec->args[n] = (uint64_t)va_arg(ap, intmax_t);
+			break;
+		case ARG_SIZE:
+			rec->args[n] = (uint64_t)va_arg(ap, size_t);
+			break;
+		case ARG_PTRDIFF:
+			rec->args[n] = (uint64_t)va_arg(ap, ptrdiff_t);
+			break;
+		case ARG_DOUBLE:
+			d = va_arg(ap, double);
+			memcpy(&rec->args[n], &d, sizeof(d));
+			break;
+		case ARG_PTR:
+			rec->args[n] = (uint64_t)(uintptr_t)va_arg(ap, void *);
+			break;
+		case ARG_STR:
+			rec->args[n] = log_binary_store_string(rec, &strings_used,
+					va_arg(ap, const char *));
+			break;
+		default:
+			break;
+		}
+		n++;
+	}
+
+	rec->args_num = n;
+}
+
+/*
+ * LOG_BINARY_PRINT -- print the conversion specification with its arguments
+ */
+#define LOG_BINARY_PRINT(buf, size, spec, stars, star, value) \
+	((stars) == 0 ? snprintf(buf, size, spec, value) : \
+	(stars) == 1 ? snprintf(buf, size, spec, star[0], value) : \
+	snprintf(buf, size, spec, star[0], star[1], value))
+
+/*
+ * log_binary_append -- append the text to the message
+ */
+static void
+log_binary_append(char *buf, size_t size, size_t *len, const char *text, size_t text_len)
+{
+	if (*len + 1 >= size)
+		return;
+
+	size_t left = size - 1 - *len;
+	if (text_len > left)
+		text_len = left;
+	memcpy(&buf[*len], text, text_len);
+	*len += text_len;
+	buf[*len] = '\0';
+}
+
+/*
+ * rpma_log_binary_decode -- format the message of the record using the format of its call site
+ */
+size_t
+rpma_log_binary_decode(const struct rpma_log_binary_record *rec, const char *format,
+		char *buf, size_t size)
+{
+	struct log_binary_spec spec;
+	size_t len = 0;
+	uint8_t n = 0;
+	uint8_t args_num = rec->args_num;
+
+	if (args_num > RPMA_LOG_BINARY_ARGS_MAX)
+		args_num = RPMA_LOG_BINARY_ARGS_MAX;
+
+	buf[0] = '\0';
+
+	while (log_binary_next_spec(format, &spec)) {
+		char spec_buf[LOG_BINARY_SPEC_MAX];
+		if (spec.arg == ARG_UNSUPPORTED || spec.len >= sizeof(spec_buf) ||
+				(spec.arg != ARG_NONE && n + spec.stars + 1 > args_num))
+			break;
+
+		/* the text preceding the conversion specification */
+		log_binary_append(buf, size, &len, format, (size_t)(spec.start - format));
+		format = spec.start + spec.len;
+
+		memcpy(spec_buf, spec.start, spec.len);
+		spec_buf[spec.len] = '\0';
+
+		int star[2] = {0, 0};
+		for (int i = 0; i < spec.stars; i++)
+			star[i] = (int)(int64_t)rec->args[n++];
+
+		char out[256];
+		uint64_t arg = (spec.arg == ARG_NONE) ? 0 : rec->args[n++];
+		char str[RPMA_LOG_BINARY_STRINGS_SIZE];
+		double d;
+		int ret;
+		switch (spec.arg) {
+		case ARG_NONE:
+			ret = snprintf(out, sizeof(out), "%%");
+			break;
+		case ARG_INT:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(int)(int64_t)arg);
+			break;
+		case ARG_LONG:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(long)arg);
+			break;
+		case ARG_LLONG:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(long long)arg);
+			break;
+		case ARG_INTMAX:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(intmax_t)arg);
+			break;
+		case ARG_SIZE:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(size_t)arg);
+			break;
+		case ARG_PTRDIFF:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(ptrdiff_t)arg);
+			break;
+		case ARG_DOUBLE:
+			memcpy(&d, &arg, sizeof(d));
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star, d);
+			break;
+		case ARG_PTR:
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star,
+					(void *)(uintptr_t)arg);
+			break;
+		case ARG_STR:
+			/* do not trust the offset read from the file */
+			if (arg >= RPMA_LOG_BINARY_STRINGS_SIZE)
+				arg = RPMA_LOG_BINARY_STRINGS_SIZE - 1;
+			memcpy(str, &rec->strings[arg], RPMA_LOG_BINARY_STRINGS_SIZE - arg);
+			str[RPMA_LOG_BINARY_STRINGS_SIZE - 1 - arg] = '\0';
+			ret = LOG_BINARY_PRINT(out, sizeof(out), spec_buf, spec.stars, star, str);
+			break;
+		default:
+			ret = -1;
+			break;
+		}
+
+		if (ret > 0)
+			log_binary_append(buf, size, &len, out, strnlen(out, sizeof(out)));
+	}
+
+	/* the rest of the format (including the conversions not recorded) */
+	log_binary_append(buf, size, &len, format, strlen(format));
+
+	return len;
+}
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_binary_format.h -- the layout of the binary log file and encoding/decoding of its records
+ * (shared by the binary logging sink and the rpma_log_decode tool)
+ */
+
+#ifndef LIBRPMA_LOG_BINARY_FORMAT_H
+#define LIBRPMA_LOG_BINARY_FORMAT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RPMA_LOG_BINARY_MAGIC		"RPMALOG"
+#define RPMA_LOG_BINARY_VERSION		1
+
+/* the size of the file header (the call sites follow it) */
+#define RPMA_LOG_BINARY_HEADER_SIZE	4096
+
+/* the maximum number of the call sites of a file */
+#define RPMA_LOG_BINARY_SITES_MAX	1024
+
+/* the maximum number of the arguments of a record (the following ones are not recorded) */
+#define RPMA_LOG_BINARY_ARGS_MAX	8
+
+/* the size of the area of a record holding the string arguments */
+#define RPMA_LOG_BINARY_STRINGS_SIZE	104
+
+/*
+ * The file is:
+ * - the header (RPMA_LOG_BINARY_HEADER_SIZE bytes),
+ * - RPMA_LOG_BINARY_SITES_MAX call sites,
+ * - the ring of records_num records overwritten in circles (the oldest ones first).
+ *
+ * The fields updated by many logging threads at the same time are atomic.
+ */
+struct rpma_log_binary_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t sites_max;
+	uint64_t records_num;
+	uint64_t records_offset;
+	_Atomic uint64_t next_seq; /* the sequence number of the next record */
+	_Atomic uint64_t dropped; /* the messages of call sites not fitting the table */
+};
+
+/* a call site is identified by its index in the table of the call sites */
+struct rpma_log_binary_site {
+	_Atomic uint32_t state; /* RPMA_LOG_BINARY_SITE_* */
+	int32_t line_no;
+	/* the addresses identifying the call site in the logging process */
+	uint64_t format_addr;
+	uint64_t file_addr;
+	char file_name[64];
+	char function_name[64];
+	char format[256];
+};
+
+#define RPMA_LOG_BINARY_SITE_EMPTY	0
+#define RPMA_LOG_BINARY_SITE_BUSY	1
+#define RPMA_LOG_BINARY_SITE_READY	2
+
+struct rpma_log_binary_record {
+	_Atomic uint64_t seq; /* the sequence number + 1 (0 - the record is being written) */
+	uint64_t ts_ns; /* CLOCK_REALTIME */
+	int32_t tid;
+	uint16_t site;
+	uint8_t level;
+	uint8_t args_num;
+	/* the raw arguments (a string argument is its offset in strings) */
+	uint64_t args[RPMA_LOG_BINARY_ARGS_MAX];
+	char strings[RPMA_LOG_BINARY_STRINGS_SIZE];
+};
+
+/*
+ * rpma_log_binary_encode -- store the arguments described by the format in the record
+ *
+ * The arguments are stored up to the first conversion which cannot be recorded (e.g. %n or
+ * a long double) or up to RPMA_LOG_BINARY_ARGS_MAX of them. The strings are copied
+ * (truncated if they do not fit the record).
+ *
+ * ASSUMPTIONS
+ * - rec != NULL && format != NULL
+ */
+void rpma_log_binary_encode(struct rpma_log_binary_record *rec, const char *format, va_list ap);
+
+/*
+ * rpma_log_binary_decode -- format the message of the record using the format of its call site
+ *
+ * The rest of the format following the last recorded argument is copied as is.
+ *
+ * ASSUMPTIONS
+ * - rec != NULL && format != NULL && buf != NULL && size > 0
+ *
+ * RETURN VALUE
+ * The length of the message (it is truncated if it does not fit the buffer).
+ */
+size_t rpma_log_binary_decode(const struct rpma_log_binary_record *rec, const char *format,
+		char *buf, size_t size);
+
+#endif /* LIBRPMA_LOG_BINARY_FORMAT_H */
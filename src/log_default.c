@@ -38,7 +38,8 @@ static const int rpma_log_level_syslog_severity[] = {
 };
 
 /*
- * rpma_get_timestamp_prefix -- provide actual time in a readable string
+ * rpma_get_timestamp_prefix -- provide the given time (or the actual time if ts == NULL)
+ * in a readable string
  *
  * NOTE
  * This function is static now, so we know all possible calls of snprintf()
@@ -48,22 +49,25 @@ static const int rpma_log_level_syslog_severity[] = {
  * - buf != NULL && buf_size >= 16
  */
 static void
-rpma_get_timestamp_prefix(char *buf, size_t buf_size)
+rpma_get_timestamp_prefix(char *buf, size_t buf_size, const struct timespec *ts)
 {
 	struct tm info;
 	char date[24];
-	struct timespec ts;
+	struct timespec now;
 	long usec;
 
 	const char error_message[] = "[time error] ";
 
-	if (clock_gettime(CLOCK_REALTIME, &ts))
-		goto err_message;
+	if (ts == NULL) {
+		if (clock_gettime(CLOCK_REALTIME, &now))
+			goto err_message;
+		ts = &now;
+	}
 
-	if (NULL == localtime_r(&ts.tv_sec, &info))
+	if (NULL == localtime_r(&ts->tv_sec, &info))
 		goto err_message;
 
-	usec = ts.tv_nsec / 1000;
+	usec = ts->tv_nsec / 1000;
 	if (!strftime(date, sizeof(date), "%b %d %H:%M:%S", &info))
 		goto err_message;
 
@@ -95,10 +99,7 @@ void
 rpma_log_default_function(enum rpma_log_level level, const char *file_name, const int line_no,
 	const char *function_name, const char *message_format, ...)
 {
-	char file_info_buffer[256] = "";
-	const char *file_info = file_info_buffer;
 	char message[1024] = "";
-	const char file_info_error[] = "[file info error]: ";
 
 	if (RPMA_LOG_DISABLED == level)
 		return;
@@ -111,6 +112,25 @@ rpma_log_default_function(enum rpma_log_level level, const char *file_name, cons
 	}
 	va_end(arg);
 
+	rpma_log_default_write(level, NULL, 0, file_name, line_no, function_name, message);
+}
+
+/*
+ * rpma_log_default_write -- write the already formatted message to syslog and/or stderr
+ *
+ * ASSUMPTIONS:
+ * - level >= RPMA_LOG_LEVEL_FATAL && level <= RPMA_LOG_LEVEL_DEBUG
+ * - file == NULL || (file != NULL && function != NULL)
+ * - message != NULL
+ */
+void
+rpma_log_default_write(enum rpma_log_level level, const struct timespec *ts, long tid,
+	const char *file_name, const int line_no, const char *function_name, const char *message)
+{
+	char file_info_buffer[256] = "";
+	const char *file_info = file_info_buffer;
+	const char file_info_error[] = "[file info error]: ";
+
 	if (file_name) {
 		/* extract base_file_name */
 		const char *base_file_name = strrchr(file_name, '/');
@@ -130,8 +150,9 @@ rpma_log_default_function(enum rpma_log_level level, const char *file_name, cons
 	if (level <= Rpma_log_threshold[RPMA_LOG_THRESHOLD_AUX] ||
 	    level == RPMA_LOG_LEVEL_ALWAYS) {
 		char times_tamp[45] = "";
-		rpma_get_timestamp_prefix(times_tamp, sizeof(times_tamp));
-		(void) fprintf(stderr, "%s[%ld] %s%s%s", times_tamp, syscall(SYS_gettid),
+		rpma_get_timestamp_prefix(times_tamp, sizeof(times_tamp), ts);
+		(void) fprintf(stderr, "%s[%ld] %s%s%s", times_tamp,
+			tid ? tid : syscall(SYS_gettid),
 			rpma_log_level_names[(level == RPMA_LOG_LEVEL_ALWAYS) ?
 						RPMA_LOG_LEVEL_DEBUG : level],
 			file_info, message);
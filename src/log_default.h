@@ -8,11 +8,21 @@
 #ifndef LIBRPMA_LOG_DEFAULT_H
 #define LIBRPMA_LOG_DEFAULT_H
 
+#include <time.h>
+
 #include "librpma.h"
 
 void rpma_log_default_function(enum rpma_log_level level, const char *file_name, const int line_no,
 	const char *function_name, const char *message_format, ...);
 
+/*
+ * rpma_log_default_write -- write the already formatted message the way
+ * rpma_log_default_function() does; the message is stamped with the given time and thread ID
+ * or with the current ones if ts == NULL and tid == 0 respectively
+ */
+void rpma_log_default_write(enum rpma_log_level level, const struct timespec *ts, long tid,
+	const char *file_name, const int line_no, const char *function_name, const char *message);
+
 void rpma_log_default_init(void);
 
 void rpma_log_default_fini(void);
@@ -8,6 +8,7 @@
 #ifndef LIBRPMA_LOG_INTERNAL_H
 #define LIBRPMA_LOG_INTERNAL_H
 
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include "librpma.h"
@@ -34,11 +35,87 @@ void rpma_log_init();
 
 void rpma_log_fini();
 
+/*
+ * The rate limiting of the data path messages: up to RPMA_LOG_RATELIMIT_BURST messages
+ * at once and then one message per RPMA_LOG_RATELIMIT_INTERVAL_NS from every call site.
+ */
+#define RPMA_LOG_RATELIMIT_BURST	10
+#define RPMA_LOG_RATELIMIT_INTERVAL_NS	1000000000ULL
+
+/* the rate limiting state of a call site (a token bucket) */
+struct rpma_log_ratelimit {
+	/* the time (CLOCK_MONOTONIC) at which the bucket will be full again */
+#ifdef ATOMIC_OPERATIONS_SUPPORTED
+	_Atomic
+#endif /* ATOMIC_OPERATIONS_SUPPORTED */
+	uint64_t full_at_ns;
+
+	/* the number of messages suppressed since the last one logged */
+#ifdef ATOMIC_OPERATIONS_SUPPORTED
+	_Atomic
+#endif /* ATOMIC_OPERATIONS_SUPPORTED */
+	uint64_t suppressed;
+};
+
+/*
+ * rpma_log_ratelimit -- take a token from the bucket of the call site
+ *
+ * ASSUMPTIONS
+ * - rl != NULL && suppressed != NULL
+ *
+ * RETURN VALUE
+ * It returns 1 and the number of messages suppressed since the last one logged
+ * if the message can be logged or 0 (and the message is counted as suppressed) otherwise.
+ */
+int rpma_log_ratelimit(struct rpma_log_ratelimit *rl, uint64_t *suppressed);
+
+/*
+ * The lowest level of the messages compiled in (set by the RPMA_LOG_LEVEL_MIN CMake option).
+ * The messages below it are compiled out along with their arguments.
+ */
+#ifndef RPMA_LOG_LEVEL_MIN
+#define RPMA_LOG_LEVEL_MIN RPMA_LOG_LEVEL_DEBUG
+#endif /* RPMA_LOG_LEVEL_MIN */
+
+/*
+ * rpma_log_get_function -- get the logging function if the messages of the level
+ * are to be logged
+ *
+ * It is the out-of-line part of the RPMA_LOG*() macros. Since it is marked as cold,
+ * the compiler moves the log calls (along with preparing their arguments) out of the hot
+ * code of the calling functions.
+ *
+ * RETURN VALUE
+ * The logging function or NULL if the messages of the level are not to be logged.
+ */
+rpma_log_function *rpma_log_get_function(enum rpma_log_level level) __attribute__((cold, noinline));
+
 #define RPMA_LOG(level, format, ...) \
 	do { \
-		if (level <= Rpma_log_threshold[RPMA_LOG_THRESHOLD] && 0 != Rpma_log_function) { \
-			((rpma_log_function *)Rpma_log_function)(level, __FILE__, __LINE__, \
-					__func__, format, ##__VA_ARGS__); \
+		rpma_log_function *rpma_log_fn; \
+		if ((level) <= RPMA_LOG_LEVEL_MIN && \
+				(rpma_log_fn = rpma_log_get_function(level)) != NULL) { \
+			rpma_log_fn(level, __FILE__, __LINE__, __func__, format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+/*
+ * RPMA_LOG_RATELIMITED -- RPMA_LOG() rate-limited per call site; the number of the messages
+ * suppressed in the meantime is logged before the next message which is let through.
+ */
+#define RPMA_LOG_RATELIMITED(level, format, ...) \
+	do { \
+		static struct rpma_log_ratelimit rpma_log_rl; \
+		uint64_t rpma_log_suppressed; \
+		rpma_log_function *rpma_log_fn; \
+		if ((level) <= RPMA_LOG_LEVEL_MIN && \
+				(rpma_log_fn = rpma_log_get_function(level)) != NULL && \
+				rpma_log_ratelimit(&rpma_log_rl, &rpma_log_suppressed)) { \
+			if (rpma_log_suppressed) \
+				rpma_log_fn(level, __FILE__, __LINE__, __func__, \
+						"suppressed %" PRIu64 " message(s)\n", \
+						rpma_log_suppressed); \
+			rpma_log_fn(level, __FILE__, __LINE__, __func__, format, ##__VA_ARGS__); \
 		} \
 	} while (0)
 
@@ -70,6 +147,16 @@ void rpma_log_fini();
 #define RPMA_LOG_FATAL(format, ...) \
 	RPMA_LOG(RPMA_LOG_LEVEL_FATAL, format "\n", ##__VA_ARGS__)
 
+/*
+ * The rate-limited variants for the data path (e.g. the failing posts and polls)
+ * which may be hit millions of times in a row.
+ */
+#define RPMA_LOG_WARNING_RATELIMITED(format, ...) \
+	RPMA_LOG_RATELIMITED(RPMA_LOG_LEVEL_WARNING, format "\n", ##__VA_ARGS__)
+
+#define RPMA_LOG_ERROR_RATELIMITED(format, ...) \
+	RPMA_LOG_RATELIMITED(RPMA_LOG_LEVEL_ERROR, format "\n", ##__VA_ARGS__)
+
 /*
  * 'f' stands here for 'function' or 'format' where the latter may accept
  * additional arguments.
@@ -77,4 +164,7 @@ void rpma_log_fini();
 #define RPMA_LOG_ERROR_WITH_ERRNO(e, f, ...) \
 	RPMA_LOG_ERROR(f " failed: %s", ##__VA_ARGS__, strerror(abs(e)));
 
+#define RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(e, f, ...) \
+	RPMA_LOG_ERROR_RATELIMITED(f " failed: %s", ##__VA_ARGS__, strerror(abs(e)));
+
 #endif /* LIBRPMA_LOG_INTERNAL_H */
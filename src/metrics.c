@@ -0,0 +1,303 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * metrics.c -- librpma metrics export in the OpenMetrics text format
+ *
+ * The counters of the connections are the ones already kept by their peers (see stats.c),
+ * so the export adds nothing to the data path. The peers are kept on a process-wide list
+ * protected by a spinlock held only when a peer is created or deleted and when the metrics
+ * are formatted. The other counters are process-wide relaxed atomics updated when the CQs,
+ * the shared RQs and the memory registrations are created and deleted.
+ */
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "debug.h"
+#include "metrics.h"
+
+_Atomic uint64_t Rpma_metrics[RPMA_METRICS_NUM];
+
+static struct {
+	atomic_flag lock; /* protects the list */
+	struct rpma_metrics_peer *head;
+} Metrics_peers = {ATOMIC_FLAG_INIT, NULL};
+
+struct metrics_buf {
+	char *buf;
+	size_t size;
+	size_t len; /* the length of the whole text (also the part not fitting the buffer) */
+};
+
+struct metrics_sample {
+	const char *labels; /* the labels following the ones of the peer (may be NULL) */
+	size_t offset; /* the offset of the value in struct rpma_conn_stats */
+};
+
+/* the metrics of the connections of a peer */
+struct metrics_family {
+	const char *name;
+	const char *help;
+	const char *unit; /* NULL if none */
+	struct metrics_sample samples[6];
+	int samples_num;
+};
+
+#define METRICS_STATS(field)	offsetof(struct rpma_conn_stats, field)
+
+static const struct metrics_family Metrics_conn_families[] = {
+	{"rpma_operations", "The operations posted on the connections.", NULL, {
+		{"op=\"read\"", METRICS_STATS(reads)},
+		{"op=\"write\"", METRICS_STATS(writes)},
+		{"op=\"atomic_write\"", METRICS_STATS(atomic_writes)},
+		{"op=\"flush\"", METRICS_STATS(flushes)},
+		{"op=\"send\"", METRICS_STATS(sends)},
+		{"op=\"recv\"", METRICS_STATS(recvs)}}, 6},
+	{"rpma_operation_bytes", "The bytes of the operations posted on the connections.",
+		"bytes", {
+		{"op=\"read\"", METRICS_STATS(read_bytes)},
+		{"op=\"write\"", METRICS_STATS(write_bytes)},
+		{"op=\"send\"", METRICS_STATS(send_bytes)},
+		{"op=\"recv\"", METRICS_STATS(recv_bytes)}}, 4},
+	{"rpma_post_errors", "The operations failed to be posted.", NULL, {
+		{NULL, METRICS_STATS(post_errors)}}, 1},
+	{"rpma_queue_full", "The operations failed to be posted because the queue was full.",
+		NULL, {
+		{"queue=\"sq\"", METRICS_STATS(sq_full)},
+		{"queue=\"rq\"", METRICS_STATS(rq_full)}}, 2},
+	{"rpma_completions", "The completions obtained.", NULL, {
+		{NULL, METRICS_STATS(completions)}}, 1},
+	{"rpma_completion_errors", "The completions obtained with an error status.", NULL, {
+		{NULL, METRICS_STATS(completion_errors)}}, 1},
+};
+
+#define METRICS_CONN_FAMILIES_NUM \
+	(sizeof(Metrics_conn_families) / sizeof(Metrics_conn_families[0]))
+
+/* the process-wide metrics */
+struct metrics_global {
+	const char *name;
+	const char *type;
+	const char *help;
+	const char *unit; /* NULL if none */
+	enum rpma_metrics_counter counter;
+};
+
+static const struct metrics_global Metrics_globals[] = {
+	{"rpma_cqs", "gauge", "The live completion queues.", NULL, RPMA_METRICS_CQS},
+	{"rpma_cq_poll_errors", "counter", "The failed polls of the completion queues.", NULL,
+		RPMA_METRICS_CQ_POLL_ERRORS},
+	{"rpma_rnr_retry_exceeded", "counter",
+		"The completions with the RNR retry counter exceeded.", NULL,
+		RPMA_METRICS_RNR_RETRY_EXCEEDED},
+	{"rpma_srqs", "gauge", "The live shared receive queues.", NULL, RPMA_METRICS_SRQS},
+	{"rpma_mrs", "gauge", "The live local memory registrations.", NULL, RPMA_METRICS_MRS},
+	{"rpma_mr_registered_bytes", "gauge", "The bytes of the live local memory registrations.",
+		"bytes", RPMA_METRICS_MR_BYTES},
+	{"rpma_mr_registrations", "counter", "The local memory registrations.", NULL,
+		RPMA_METRICS_MR_REGISTRATIONS},
+};
+
+#define METRICS_GLOBALS_NUM	(sizeof(Metrics_globals) / sizeof(Metrics_globals[0]))
+
+/*
+ * metrics_lock -- acquire the list of the peers
+ */
+static void
+metrics_lock(void)
+{
+	while (atomic_flag_test_and_set_explicit(&Metrics_peers.lock, memory_order_acquire))
+		;
+}
+
+/*
+ * metrics_unlock -- release the list of the peers
+ */
+static void
+metrics_unlock(void)
+{
+	atomic_flag_clear_explicit(&Metrics_peers.lock, memory_order_release);
+}
+
+/*
+ * metrics_printf -- append the formatted text to the buffer as long as it fits
+ * (the length of the whole text is counted anyway)
+ */
+static void
+metrics_printf(struct metrics_buf *mb, const char *format, ...)
+{
+	va_list ap;
+	char *dst = NULL;
+	size_t left = 0;
+
+	if (mb->len < mb->size) {
+		dst = mb->buf + mb->len;
+		left = mb->size - mb->len;
+	}
+
+	va_start(ap, format);
+	int ret = vsnprintf(dst, left, format, ap);
+	va_end(ap);
+
+	if (ret > 0)
+		mb->len += (size_t)ret;
+}
+
+/*
+ * metrics_header -- append the metadata of the metric family
+ */
+static void
+metrics_header(struct metrics_buf *mb, const char *name, const char *type, const char *help,
+		const char *unit)
+{
+	metrics_printf(mb, "# TYPE %s %s\n", name, type);
+	if (unit)
+		metrics_printf(mb, "# UNIT %s %s\n", name, unit);
+	metrics_printf(mb, "# HELP %s %s\n", name, help);
+}
+
+/*
+ * metrics_peer_labels -- append the labels identifying the peer
+ */
+static void
+metrics_peer_labels(struct metrics_buf *mb, const struct rpma_metrics_peer *mpeer)
+{
+	metrics_printf(mb, "device=\"%s\",pd=\"%" PRIu32 "\"",
+			mpeer->pd->context->device->name, mpeer->pd->handle);
+}
+
+/*
+ * metrics_format_peers -- append the metrics of the connections of all the peers
+ */
+static void
+metrics_format_peers(struct metrics_buf *mb)
+{
+	struct rpma_conn_stats stats;
+	uint64_t live_num;
+
+	metrics_header(mb, "rpma_peers", "gauge", "The live peers.", NULL);
+	uint64_t peers_num = 0;
+	for (struct rpma_metrics_peer *mpeer = Metrics_peers.head; mpeer; mpeer = mpeer->next)
+		peers_num++;
+	metrics_printf(mb, "rpma_peers %" PRIu64 "\n", peers_num);
+
+	metrics_header(mb, "rpma_connections", "gauge", "The live connections.", NULL);
+	for (struct rpma_metrics_peer *mpeer = Metrics_peers.head; mpeer; mpeer = mpeer->next) {
+		rpma_stats_list_get(mpeer->stats, &stats, &live_num);
+		metrics_printf(mb, "rpma_connections{");
+		metrics_peer_labels(mb, mpeer);
+		metrics_printf(mb, "} %" PRIu64 "\n", live_num);
+	}
+
+	for (size_t f = 0; f < METRICS_CONN_FAMILIES_NUM; f++) {
+		const struct metrics_family *family = &Metrics_conn_families[f];
+		metrics_header(mb, family->name, "counter", family->help, family->unit);
+
+		for (struct rpma_metrics_peer *mpeer = Metrics_peers.head; mpeer;
+				mpeer = mpeer->next) {
+			rpma_stats_list_get(mpeer->stats, &stats, NULL);
+
+			for (int s = 0; s < family->samples_num; s++) {
+				const struct metrics_sample *sample = &family->samples[s];
+				uint64_t value =
+					*(const uint64_t *)((const char *)&stats + sample->offset);
+
+				metrics_printf(mb, "%s_total{", family->name);
+				metrics_peer_labels(mb, mpeer);
+				if (sample->labels)
+					metrics_printf(mb, ",%s", sample->labels);
+				metrics_printf(mb, "} %" PRIu64 "\n", value);
+			}
+		}
+	}
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_metrics_peer_add -- add a new peer to the list of the exported peers
+ */
+void
+rpma_metrics_peer_add(struct rpma_metrics_peer *mpeer, struct ibv_pd *pd,
+		struct rpma_stats_list *stats)
+{
+	mpeer->pd = pd;
+	mpeer->stats = stats;
+
+	metrics_lock();
+
+	mpeer->prev = NULL;
+	mpeer->next = Metrics_peers.head;
+	if (Metrics_peers.head)
+		Metrics_peers.head->prev = mpeer;
+	Metrics_peers.head = mpeer;
+
+	metrics_unlock();
+}
+
+/*
+ * rpma_metrics_peer_remove -- remove a peer being deleted from the list of the exported peers
+ */
+void
+rpma_metrics_peer_remove(struct rpma_metrics_peer *mpeer)
+{
+	metrics_lock();
+
+	if (mpeer->prev)
+		mpeer->prev->next = mpeer->next;
+	else
+		Metrics_peers.head = mpeer->next;
+	if (mpeer->next)
+		mpeer->next->prev = mpeer->prev;
+	mpeer->prev = NULL;
+	mpeer->next = NULL;
+
+	metrics_unlock();
+}
+
+/* public librpma API */
+
+/*
+ * rpma_metrics_format -- render the metrics of the library in the OpenMetrics text format
+ */
+int
+rpma_metrics_format(char *buf, size_t *len)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (len == NULL || (buf == NULL && *len != 0))
+		return RPMA_E_INVAL;
+
+	struct metrics_buf mb = {buf, *len, 0};
+
+	metrics_lock();
+	metrics_format_peers(&mb);
+	metrics_unlock();
+
+	for (size_t g = 0; g < METRICS_GLOBALS_NUM; g++) {
+		const struct metrics_global *global = &Metrics_globals[g];
+		bool is_counter = (global->type[0] == 'c');
+
+		metrics_header(&mb, global->name, global->type, global->help, global->unit);
+		metrics_printf(&mb, "%s%s %" PRIu64 "\n", global->name, is_counter ? "_total" : "",
+				atomic_load_explicit(&Rpma_metrics[global->counter],
+				memory_order_relaxed));
+	}
+
+	metrics_printf(&mb, "# EOF\n");
+
+	/* the terminating null byte has to fit as well */
+	if (mb.len >= mb.size) {
+		*len = mb.len + 1;
+		return RPMA_E_NOMEM;
+	}
+
+	*len = mb.len;
+
+	return 0;
+}
@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * metrics.h -- librpma metrics export internal definitions
+ */
+
+#ifndef LIBRPMA_METRICS_H
+#define LIBRPMA_METRICS_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "librpma.h"
+#include "stats.h"
+
+/* the process-wide counters (the ones of the connections are kept by their peers) */
+enum rpma_metrics_counter {
+	RPMA_METRICS_CQS, /* the live CQs */
+	RPMA_METRICS_CQ_POLL_ERRORS,
+	RPMA_METRICS_RNR_RETRY_EXCEEDED, /* the completions with IBV_WC_RNR_RETRY_EXC_ERR */
+	RPMA_METRICS_SRQS, /* the live shared RQs */
+	RPMA_METRICS_MRS, /* the live local memory registrations */
+	RPMA_METRICS_MR_BYTES, /* the bytes of the live local memory registrations */
+	RPMA_METRICS_MR_REGISTRATIONS,
+	RPMA_METRICS_NUM
+};
+
+extern _Atomic uint64_t Rpma_metrics[RPMA_METRICS_NUM];
+
+#define RPMA_METRICS_ADD(counter, value) \
+	atomic_fetch_add_explicit(&Rpma_metrics[counter], (uint64_t)(value), \
+			memory_order_relaxed)
+
+#define RPMA_METRICS_SUB(counter, value) \
+	atomic_fetch_sub_explicit(&Rpma_metrics[counter], (uint64_t)(value), \
+			memory_order_relaxed)
+
+/* a peer on the list of the peers whose connection statistics are exported */
+struct rpma_metrics_peer {
+	struct ibv_pd *pd; /* identifies the peer by the device name and the PD handle */
+	struct rpma_stats_list *stats;
+	struct rpma_metrics_peer *prev;
+	struct rpma_metrics_peer *next;
+};
+
+/*
+ * rpma_metrics_peer_add -- add a new peer to the list of the exported peers
+ *
+ * ASSUMPTIONS
+ * - mpeer != NULL && pd != NULL && stats != NULL
+ */
+void rpma_metrics_peer_add(struct rpma_metrics_peer *mpeer, struct ibv_pd *pd,
+		struct rpma_stats_list *stats);
+
+/*
+ * rpma_metrics_peer_remove -- remove a peer being deleted from the list of the exported peers
+ *
+ * ASSUMPTIONS
+ * - mpeer != NULL && mpeer is on the list
+ */
+void rpma_metrics_peer_remove(struct rpma_metrics_peer *mpeer);
+
+#endif /* LIBRPMA_METRICS_H */
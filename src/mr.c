@@ -7,14 +7,18 @@
  */
 
 #include <endian.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <stdlib.h>
 
 #include "librpma.h"
 #include "debug.h"
+#include "hook.h"
 #include "log_internal.h"
+#include "metrics.h"
 #include "mr.h"
 #include "peer.h"
+#include "usdt.h"
 
 #ifdef TEST_MOCK_ALLOC
 #include "cmocka_alloc.h"
@@ -56,19 +60,16 @@ struct rpma_mr_remote {
 	int usage; /* usage of the memory region */
 };
 
-/* internal librpma API */
-
 /*
- * rpma_mr_read -- post an RDMA read from src to dst
+ * mr_post_read -- post an RDMA read from src to dst without firing any probe nor hook;
+ * returns the value returned by ibv_post_send(3)
  */
-int
-rpma_mr_read(struct ibv_qp *qp,
+static int
+mr_post_read(struct ibv_qp *qp,
 	struct rpma_mr_local *dst, size_t dst_offset,
 	const struct rpma_mr_remote *src, size_t src_offset,
 	size_t len, int flags, const void *op_context)
 {
-	RPMA_DEBUG_TRACE;
-
 	struct ibv_send_wr wr = {0};
 	struct ibv_sge sge = {0};
 
@@ -100,17 +101,63 @@ rpma_mr_read(struct ibv_qp *qp,
 	wr.send_flags = (flags & RPMA_F_COMPLETION_ON_SUCCESS) ? IBV_SEND_SIGNALED : 0;
 
 	struct ibv_send_wr *bad_wr;
-	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	int ret = ibv_post_send(qp, &wr, &bad_wr);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret,
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret,
 			"ibv_post_send(src_addr=0x%x, rkey=0x%x, dst_addr=0x%x, length=%u, lkey=0x%x, wr_id=0x%x, opcode=IBV_WR_RDMA_READ, send_flags=%s)",
 			wr.wr.rdma.remote_addr, wr.wr.rdma.rkey, sge.addr, sge.length, sge.lkey,
 			wr.wr_id, (flags & RPMA_F_COMPLETION_ON_SUCCESS) ?
 			"IBV_SEND_SIGNALED" : "0");
+	}
+
+	return ret;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_mr_read -- post an RDMA read from src to dst
+ */
+int
+rpma_mr_read(struct ibv_qp *qp,
+	struct rpma_mr_local *dst, size_t dst_offset,
+	const struct rpma_mr_remote *src, size_t src_offset,
+	size_t len, int flags, const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	int ret = mr_post_read(qp, dst, dst_offset, src, src_offset, len, flags, op_context);
+	RPMA_USDT4(read, qp->qp_num, len, op_context, ret);
+	if (ret) {
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_READ, qp->qp_num, len, op_context);
+	return 0;
+}
+
+/*
+ * rpma_mr_flush_apm -- initiate the APM-style flush operation: post an RDMA read of raw_len
+ * bytes from dst to raw reported as the flush of len bytes
+ */
+int
+rpma_mr_flush_apm(struct ibv_qp *qp, struct rpma_mr_local *raw, size_t raw_len,
+	const struct rpma_mr_remote *dst, size_t dst_offset, size_t len, int flags,
+	const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+
+	int ret = mr_post_read(qp, raw, 0, dst, dst_offset, raw_len, flags, op_context);
+	RPMA_USDT4(flush, qp->qp_num, len, op_context, ret);
+	if (ret) {
+		errno = ret;
+		return RPMA_E_PROVIDER;
+	}
+
+	RPMA_HOOK_POST(RPMA_HOOK_FLUSH, qp->qp_num, len, op_context);
 	return 0;
 }
 
@@ -176,15 +223,18 @@ rpma_mr_write(struct ibv_qp *qp,
 	struct ibv_send_wr *bad_wr;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	int ret = ibv_post_send(qp, &wr, &bad_wr);
+	RPMA_USDT4(write, qp->qp_num, len, op_context, ret);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret,
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret,
 			"ibv_post_send(dst_addr=0x%x, rkey=0x%x, src_addr=0x%x, length=%u, lkey=0x%x, wr_id=0x%x, opcode=IBV_WR_RDMA_WRITE, send_flags=%s)",
 			wr.wr.rdma.remote_addr, wr.wr.rdma.rkey, sge.addr, sge.length, sge.lkey,
 			wr.wr_id, (flags & RPMA_F_COMPLETION_ON_SUCCESS) ?
 			"IBV_SEND_SIGNALED" : "0");
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_WRITE, qp->qp_num, len, op_context);
 	return 0;
 }
 
@@ -207,11 +257,14 @@ rpma_mr_atomic_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_o
 		RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 		ibv_wr_atomic_write(qpx, dst->rkey, dst->raddr + dst_offset, src);
 		int ret = ibv_wr_complete(qpx);
+		RPMA_USDT4(atomic_write, qp->qp_num, 8, op_context, ret);
 		if (ret) {
-			RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_wr_complete()");
+			RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret, "ibv_wr_complete()");
+			errno = ret;
 			return RPMA_E_PROVIDER;
 		}
 
+		RPMA_HOOK_POST(RPMA_HOOK_ATOMIC_WRITE, qp->qp_num, 8, op_context);
 		return 0;
 	}
 #endif
@@ -244,14 +297,17 @@ rpma_mr_atomic_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_o
 	struct ibv_send_wr *bad_wr;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	int ret = ibv_post_send(qp, &wr, &bad_wr);
+	RPMA_USDT4(atomic_write, qp->qp_num, 8, op_context, ret);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret,
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret,
 			"ibv_post_send(dst_addr=0x%x, rkey=0x%x, src_addr=0x%x, wr_id=0x%x, opcode=IBV_WR_RDMA_WRITE, send_flags=%s)",
 			wr.wr.rdma.remote_addr, wr.wr.rdma.rkey, sge.addr, wr.wr_id,
 			(flags & RPMA_F_COMPLETION_ON_SUCCESS) ? "IBV_SEND_SIGNALED" : "0");
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_ATOMIC_WRITE, qp->qp_num, 8, op_context);
 	return 0;
 }
 
@@ -260,7 +316,8 @@ rpma_mr_atomic_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_o
  */
 int
 rpma_mr_send(struct ibv_qp *qp, const struct rpma_mr_local *src, size_t offset, size_t len,
-	int flags, enum ibv_wr_opcode operation, uint32_t imm, const void *op_context)
+	int flags, enum ibv_wr_opcode operation, uint32_t imm, bool fence,
+	const void *op_context)
 {
 	RPMA_DEBUG_TRACE;
 
@@ -300,15 +357,20 @@ rpma_mr_send(struct ibv_qp *qp, const struct rpma_mr_local *src, size_t offset,
 
 	wr.wr_id = (uint64_t)op_context;
 	wr.send_flags = (flags & RPMA_F_COMPLETION_ON_SUCCESS) ? IBV_SEND_SIGNALED : 0;
+	if (fence)
+		wr.send_flags |= IBV_SEND_FENCE;
 
 	struct ibv_send_wr *bad_wr;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	int ret = ibv_post_send(qp, &wr, &bad_wr);
+	RPMA_USDT4(send, qp->qp_num, len, op_context, ret);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_post_send");
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret, "ibv_post_send");
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_SEND, qp->qp_num, len, op_context);
 	return 0;
 }
 
@@ -343,11 +405,14 @@ rpma_mr_recv(struct ibv_qp *qp, struct rpma_mr_local *dst, size_t offset, size_t
 	struct ibv_recv_wr *bad_wr;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	int ret = ibv_post_recv(qp, &wr, &bad_wr);
+	RPMA_USDT4(recv, qp->qp_num, len, op_context, ret);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_post_recv");
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret, "ibv_post_recv");
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_RECV, qp->qp_num, len, op_context);
 	return 0;
 }
 
@@ -382,11 +447,14 @@ rpma_mr_srq_recv(struct ibv_srq *ibv_srq, struct rpma_mr_local *dst, size_t offs
 	struct ibv_recv_wr *bad_wr;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	int ret = ibv_post_srq_recv(ibv_srq, &wr, &bad_wr);
+	RPMA_USDT4(srq_recv, ibv_srq, len, op_context, ret);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_post_srq_recv");
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret, "ibv_post_srq_recv");
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_RECV, 0, len, op_context);
 	return 0;
 }
 
@@ -415,11 +483,14 @@ rpma_mr_flush(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_offset,
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	ibv_wr_flush(qpx, dst->rkey, dst->raddr + dst_offset, len, native_type, IBV_FLUSH_RANGE);
 	int ret = ibv_wr_complete(qpx);
+	RPMA_USDT4(flush, qp->qp_num, len, op_context, ret);
 	if (ret) {
-		RPMA_LOG_ERROR_WITH_ERRNO(ret, "ibv_wr_complete()");
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(ret, "ibv_wr_complete()");
+		errno = ret;
 		return RPMA_E_PROVIDER;
 	}
 
+	RPMA_HOOK_POST(RPMA_HOOK_FLUSH, qp->qp_num, len, op_context);
 	return 0;
 }
 #endif
@@ -460,6 +531,10 @@ rpma_mr_reg(struct rpma_peer *peer, void *ptr, size_t size, int usage,
 	mr->usage = usage;
 	*mr_ptr = mr;
 
+	RPMA_METRICS_ADD(RPMA_METRICS_MRS, 1);
+	RPMA_METRICS_ADD(RPMA_METRICS_MR_BYTES, size);
+	RPMA_METRICS_ADD(RPMA_METRICS_MR_REGISTRATIONS, 1);
+
 	return 0;
 }
 
@@ -479,6 +554,7 @@ rpma_mr_dereg(struct rpma_mr_local **mr_ptr)
 
 	int ret = 0;
 	struct rpma_mr_local *mr = *mr_ptr;
+	size_t size = mr->ibv_mr->length;
 	errno = ibv_dereg_mr(mr->ibv_mr);
 	if (errno) {
 		RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_dereg_mr()");
@@ -488,6 +564,9 @@ rpma_mr_dereg(struct rpma_mr_local **mr_ptr)
 	free(mr);
 	*mr_ptr = NULL;
 
+	RPMA_METRICS_SUB(RPMA_METRICS_MRS, 1);
+	RPMA_METRICS_SUB(RPMA_METRICS_MR_BYTES, size);
+
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	return ret;
 }
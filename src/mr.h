@@ -23,7 +23,7 @@
  * ERRORS
  * rpma_mr_read() can fail with the following error:
  *
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed (errno is set to its error)
  */
 int rpma_mr_read(struct ibv_qp *qp, struct rpma_mr_local *dst, size_t dst_offset,
 	const struct rpma_mr_remote *src, size_t src_offset, size_t len, int flags,
@@ -40,7 +40,7 @@ int rpma_mr_read(struct ibv_qp *qp, struct rpma_mr_local *dst, size_t dst_offset
  * rpma_mr_write() can fail with the following errors:
  *
  * - RPMA_E_NOSUPP   - unsupported 'operation' argument
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed (errno is set to its error)
  */
 int rpma_mr_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_offset,
 	const struct rpma_mr_local *src, size_t src_offset, size_t len, int flags,
@@ -53,7 +53,7 @@ int rpma_mr_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_offs
  * ERRORS
  * rpma_mr_atomic_write() can fail with the following error:
  *
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed (errno is set to its error)
  */
 int rpma_mr_atomic_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_offset,
 	const char src[8], int flags, const void *op_context);
@@ -63,14 +63,18 @@ int rpma_mr_atomic_write(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t d
  * - qp != NULL && flags != 0
  * - src != NULL || (offset == 0 && len == 0)
  *
+ * If fence is true the send is posted with IBV_SEND_FENCE, so it is executed only after all
+ * preceding RDMA reads are completed.
+ *
  * ERRORS
  * rpma_mr_send() can fail with the following error:
  *
  * - RPMA_E_NOSUPP   - unsupported 'operation' argument
- * - RPMA_E_PROVIDER - ibv_post_send(3) failed
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed (errno is set to its error)
  */
 int rpma_mr_send(struct ibv_qp *qp, const struct rpma_mr_local *src, size_t offset, size_t len,
-	int flags, enum ibv_wr_opcode operation, uint32_t imm, const void *op_context);
+	int flags, enum ibv_wr_opcode operation, uint32_t imm, bool fence,
+	const void *op_context);
 
 /*
  * ASSUMPTIONS
@@ -80,7 +84,7 @@ int rpma_mr_send(struct ibv_qp *qp, const struct rpma_mr_local *src, size_t offs
  * ERRORS
  * rpma_mr_recv() can fail with the following error:
  *
- * - RPMA_E_PROVIDER - ibv_post_recv(3) failed
+ * - RPMA_E_PROVIDER - ibv_post_recv(3) failed (errno is set to its error)
  */
 int rpma_mr_recv(struct ibv_qp *qp, struct rpma_mr_local *dst, size_t offset, size_t len,
 	const void *op_context);
@@ -93,7 +97,7 @@ int rpma_mr_recv(struct ibv_qp *qp, struct rpma_mr_local *dst, size_t offset, si
  * ERRORS
  * rpma_mr_srq_recv() can fail with the following error:
  *
- * - RPMA_E_PROVIDER - ibv_post_srq_recv(3) failed
+ * - RPMA_E_PROVIDER - ibv_post_srq_recv(3) failed (errno is set to its error)
  */
 int rpma_mr_srq_recv(struct ibv_srq *ibv_srq, struct rpma_mr_local *dst, size_t offset, size_t len,
 	const void *op_context);
@@ -105,9 +109,22 @@ int rpma_mr_srq_recv(struct ibv_srq *ibv_srq, struct rpma_mr_local *dst, size_t
  * ERRORS
  * rpma_mr_flush() can fail with the following error:
  *
- * - RPMA_E_PROVIDER - ibv_wr_complete(3) failed
+ * - RPMA_E_PROVIDER - ibv_wr_complete(3) failed (errno is set to its error)
  */
 int rpma_mr_flush(struct ibv_qp *qp, struct rpma_mr_remote *dst, size_t dst_offset,
 	size_t len, enum rpma_flush_type type, int flags, const void *op_context);
 
+/*
+ * ASSUMPTIONS
+ * - qp != NULL && raw != NULL && dst != NULL && flags != 0
+ *
+ * ERRORS
+ * rpma_mr_flush_apm() can fail with the following error:
+ *
+ * - RPMA_E_PROVIDER - ibv_post_send(3) failed (errno is set to its error)
+ */
+int rpma_mr_flush_apm(struct ibv_qp *qp, struct rpma_mr_local *raw, size_t raw_len,
+	const struct rpma_mr_remote *dst, size_t dst_offset, size_t len, int flags,
+	const void *op_context);
+
 #endif /* LIBRPMA_MR_H */
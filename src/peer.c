@@ -13,7 +13,9 @@
 #include "conn_req.h"
 #include "debug.h"
 #include "log_internal.h"
+#include "metrics.h"
 #include "peer.h"
+#include "res_pool.h"
 #include "srq.h"
 #include "srq_cfg.h"
 #include "utils.h"
@@ -31,13 +33,29 @@
 struct rpma_peer {
 	struct ibv_pd *pd; /* a protection domain */
 
-	int is_odp_supported; /* is On-Demand Paging supported */
+	struct rpma_peer_caps caps; /* the snapshot of the device capabilities */
 
-	int is_native_atomic_write_supported; /* is native atomic write supported */
+	struct rpma_res_pool *pool; /* recycled connection resources (optional) */
 
-	int is_native_flush_supported; /* is native flush supported */
+	struct rpma_stats_list stats; /* the statistics of the connections */
+	struct rpma_metrics_peer metrics; /* the peer on the list of the exported peers */
 };
 
+/*
+ * rpma_peer_clamp_u32 -- clamp the value to the device limit if the limit is known
+ */
+static uint32_t
+rpma_peer_clamp_u32(uint32_t value, uint32_t limit, const char *name)
+{
+	if (limit == 0 || value <= limit)
+		return value;
+
+	RPMA_LOG_NOTICE("%s (%" PRIu32 ") clamped to the device limit (%" PRIu32 ")",
+			name, value, limit);
+
+	return limit;
+}
+
 /* internal librpma API */
 
 /*
@@ -57,7 +75,7 @@ rpma_peer_usage2access(struct rpma_peer *peer, int usage)
 		access |= IBV_ACCESS_REMOTE_READ;
 
 #ifdef NATIVE_FLUSH_SUPPORTED
-	if (peer->is_native_flush_supported) {
+	if (peer->caps.is_native_flush_supported) {
 		if (usage & RPMA_MR_USAGE_FLUSH_TYPE_VISIBILITY)
 			access |= IBV_ACCESS_FLUSH_GLOBAL;
 
@@ -120,6 +138,7 @@ rpma_peer_create_srq(struct rpma_peer *peer, struct rpma_srq_cfg *cfg,
 
 	/* read size of the shared RQ from the configuration */
 	(void) rpma_srq_cfg_get_rq_size(cfg, &rq_size);
+	rq_size = rpma_peer_clamp_u32(rq_size, peer->caps.max_srq_wr, "shared RQ size");
 
 	struct ibv_srq_init_attr srq_init_attr;
 	srq_init_attr.srq_context = NULL;
@@ -137,6 +156,7 @@ rpma_peer_create_srq(struct rpma_peer *peer, struct rpma_srq_cfg *cfg,
 	/* read size of the shared receive CQ from the configuration */
 	int rcqe;
 	(void) rpma_srq_cfg_get_rcqe(cfg, &rcqe);
+	rcqe = rpma_peer_clamp_cqe(peer, rcqe);
 
 	int ret = 0;
 	struct rpma_cq *rcq = NULL;
@@ -178,6 +198,8 @@ rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq
 	struct rpma_srq *srq = NULL;
 	(void) rpma_conn_cfg_get_sq_size(cfg, &sq_size);
 	(void) rpma_conn_cfg_get_rq_size(cfg, &rq_size);
+	sq_size = rpma_peer_clamp_u32(sq_size, peer->caps.max_qp_wr, "SQ size");
+	rq_size = rpma_peer_clamp_u32(rq_size, peer->caps.max_qp_wr, "RQ size");
 	/* get the shared RQ object from the connection */
 	(void) rpma_conn_cfg_get_srq(cfg, &srq);
 
@@ -185,6 +207,8 @@ rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq
 
 	struct ibv_cq *ibv_cq = rpma_cq_get_ibv_cq(cq);
 
+	uint32_t max_sge = rpma_peer_clamp_u32(RPMA_MAX_SGE, peer->caps.max_sge, "SGE");
+
 	struct ibv_qp_init_attr_ex qp_init_attr;
 	qp_init_attr.qp_context = NULL;
 	qp_init_attr.send_cq = ibv_cq;
@@ -192,8 +216,8 @@ rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq
 	qp_init_attr.srq = ibv_srq;
 	qp_init_attr.cap.max_send_wr = sq_size;
 	qp_init_attr.cap.max_recv_wr = rq_size;
-	qp_init_attr.cap.max_send_sge = RPMA_MAX_SGE;
-	qp_init_attr.cap.max_recv_sge = RPMA_MAX_SGE;
+	qp_init_attr.cap.max_send_sge = max_sge;
+	qp_init_attr.cap.max_recv_sge = max_sge;
 	qp_init_attr.cap.max_inline_data = RPMA_MAX_INLINE_DATA;
 	/*
 	 * Reliable Connection - since we are using e.g. IBV_WR_RDMA_READ.
@@ -214,12 +238,12 @@ rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq
 #endif
 
 #ifdef NATIVE_ATOMIC_WRITE_SUPPORTED
-	if (peer->is_native_atomic_write_supported)
+	if (peer->caps.is_native_atomic_write_supported)
 		qp_init_attr.send_ops_flags |= IBV_QP_EX_WITH_ATOMIC_WRITE;
 #endif
 
 #ifdef NATIVE_FLUSH_SUPPORTED
-	if (peer->is_native_flush_supported)
+	if (peer->caps.is_native_flush_supported)
 		qp_init_attr.send_ops_flags |= IBV_QP_EX_WITH_FLUSH;
 #endif
 
@@ -234,8 +258,9 @@ rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpma_cq
 		RPMA_LOG_ERROR_WITH_ERRNO(errno,
 			"rdma_create_qp_ex(max_send_wr=%" PRIu32
 			", max_recv_wr=%" PRIu32
-			", max_send/recv_sge=%i, max_inline_data=%i, qp_type=IBV_QPT_RC, sq_sig_all=0)",
-			sq_size, rq_size, RPMA_MAX_SGE,
+			", max_send/recv_sge=%" PRIu32
+			", max_inline_data=%i, qp_type=IBV_QPT_RC, sq_sig_all=0)",
+			sq_size, rq_size, max_sge,
 			RPMA_MAX_INLINE_DATA);
 		return RPMA_E_PROVIDER;
 	}
@@ -279,7 +304,7 @@ rpma_peer_setup_mr_reg(struct rpma_peer *peer, struct ibv_mr **ibv_mr_ptr, void
 		return RPMA_E_PROVIDER;
 	}
 
-	if (!peer->is_odp_supported) {
+	if (!peer->caps.is_odp_supported) {
 		RPMA_LOG_ERROR_WITH_ERRNO(errno,
 			"Peer does not support On-Demand Paging: "
 			"ibv_reg_mr(addr=%p, length=%zu, access=%i)",
@@ -310,6 +335,48 @@ rpma_peer_setup_mr_reg(struct rpma_peer *peer, struct ibv_mr **ibv_mr_ptr, void
 #endif
 }
 
+/*
+ * rpma_peer_clamp_cqe -- clamp the number of CQ entries to the device limit
+ */
+int
+rpma_peer_clamp_cqe(const struct rpma_peer *peer, int cqe)
+{
+	if (peer->caps.max_cqe <= 0 || cqe <= peer->caps.max_cqe)
+		return cqe;
+
+	RPMA_LOG_NOTICE("CQ size (%i) clamped to the device limit (%i)", cqe, peer->caps.max_cqe);
+
+	return peer->caps.max_cqe;
+}
+
+/*
+ * rpma_peer_get_res_pool -- get the pool of recycled connection resources of the peer
+ */
+struct rpma_res_pool *
+rpma_peer_get_res_pool(const struct rpma_peer *peer)
+{
+	return peer->pool;
+}
+
+/*
+ * rpma_peer_attach_stats -- add the statistics of a new connection to the statistics
+ * of the peer
+ */
+void
+rpma_peer_attach_stats(struct rpma_peer *peer, struct rpma_stats *stats)
+{
+	rpma_stats_list_add(&peer->stats, stats);
+}
+
+/*
+ * rpma_peer_detach_stats -- keep only the sums of the counters of a deleted connection
+ */
+void
+rpma_peer_detach_stats(struct rpma_peer *peer, struct rpma_stats *stats)
+{
+	rpma_stats_list_remove(&peer->stats, stats);
+}
+
 /* public librpma API */
 
 /*
@@ -322,36 +389,25 @@ rpma_peer_new(struct ibv_context *ibv_ctx, struct rpma_peer **peer_ptr)
 	RPMA_DEBUG_TRACE;
 	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
 
-	int is_odp_supported = 0;
-	int is_native_atomic_write_supported = 0;
-	int is_native_flush_supported = 0;
+	struct rpma_peer_caps caps;
 	int ret;
 
 	if (ibv_ctx == NULL || peer_ptr == NULL)
 		return RPMA_E_INVAL;
 
-	ret = rpma_utils_ibv_context_is_atomic_write_capable(ibv_ctx,
-			&is_native_atomic_write_supported);
+	/* take the snapshot of the device capabilities at once */
+	ret = rpma_utils_ibv_context_query_caps(ibv_ctx, &caps);
 	if (ret)
 		return ret;
 
-	if (!is_native_atomic_write_supported)
+	if (!caps.is_native_atomic_write_supported)
 		RPMA_LOG_INFO(
 			"Native atomic write is not supported - ordinary RDMA write will be used instead.");
 
-	ret = rpma_utils_ibv_context_is_flush_capable(ibv_ctx,
-			&is_native_flush_supported);
-	if (ret)
-		return ret;
-
-	if (!is_native_flush_supported)
+	if (!caps.is_native_flush_supported)
 		RPMA_LOG_INFO(
 			"Native flush is not supported - ordinary RDMA read will be used instead.");
 
-	ret = rpma_utils_ibv_context_is_odp_capable(ibv_ctx, &is_odp_supported);
-	if (ret)
-		return ret;
-
 	/*
 	 * The ibv_alloc_pd(3) manual page does not document that this function returns any error
 	 * via errno but seemingly it is. For the usability sake, we try to deduce what really
@@ -386,9 +442,10 @@ rpma_peer_new(struct ibv_context *ibv_ctx, struct rpma_peer **peer_ptr)
 	}
 
 	peer->pd = pd;
-	peer->is_odp_supported = is_odp_supported;
-	peer->is_native_atomic_write_supported = is_native_atomic_write_supported;
-	peer->is_native_flush_supported = is_native_flush_supported;
+	peer->caps = caps;
+	peer->pool = NULL;
+	rpma_stats_list_init(&peer->stats);
+	rpma_metrics_peer_add(&peer->metrics, pd, &peer->stats);
 	*peer_ptr = peer;
 
 	return 0;
@@ -414,8 +471,12 @@ rpma_peer_delete(struct rpma_peer **peer_ptr)
 	if (peer == NULL)
 		return 0;
 
-	int ret = ibv_dealloc_pd(peer->pd);
-	if (ret) {
+	rpma_metrics_peer_remove(&peer->metrics);
+
+	/* the kept resources have to be deleted before the protection domain */
+	int ret = rpma_res_pool_delete(&peer->pool);
+
+	if (ibv_dealloc_pd(peer->pd)) {
 		RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_dealloc_pd()");
 		ret = RPMA_E_PROVIDER;
 	}
@@ -426,3 +487,75 @@ rpma_peer_delete(struct rpma_peer **peer_ptr)
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	return ret;
 }
+
+/*
+ * rpma_peer_set_res_pool_size -- replace the pool of recycled connection resources
+ * with a new one of the given size or disable recycling if size == 0
+ */
+int
+rpma_peer_set_res_pool_size(struct rpma_peer *peer, int size)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (peer == NULL || size < 0)
+		return RPMA_E_INVAL;
+
+	/* the live connections may still return their resources to the current pool */
+	struct rpma_conn_stats snapshot;
+	uint64_t live_num = 0;
+	rpma_stats_list_get(&peer->stats, &snapshot, &live_num);
+	if (live_num > 0) {
+		RPMA_LOG_ERROR("the pool cannot be replaced while the peer has %" PRIu64
+				" live connection(s)", live_num);
+		return RPMA_E_INVAL;
+	}
+
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	struct rpma_res_pool *pool = NULL;
+	if (size > 0) {
+		int ret = rpma_res_pool_new(size, &pool);
+		if (ret)
+			return ret;
+	}
+
+	/* the resources kept so far are not needed anymore */
+	int ret = rpma_res_pool_delete(&peer->pool);
+	peer->pool = pool;
+
+	return ret;
+}
+
+/*
+ * rpma_peer_get_caps -- get the snapshot of the device capabilities taken by rpma_peer_new()
+ */
+int
+rpma_peer_get_caps(const struct rpma_peer *peer, struct rpma_peer_caps *caps)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || caps == NULL)
+		return RPMA_E_INVAL;
+
+	*caps = peer->caps;
+
+	return 0;
+}
+
+/*
+ * rpma_peer_get_stats -- get the sums of the statistics of all the connections of the peer
+ */
+int
+rpma_peer_get_stats(struct rpma_peer *peer, struct rpma_conn_stats *stats)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || stats == NULL)
+		return RPMA_E_INVAL;
+
+	rpma_stats_list_get(&peer->stats, stats, NULL);
+
+	return 0;
+}
@@ -11,6 +11,8 @@
 
 #include "librpma.h"
 #include "cq.h"
+#include "res_pool.h"
+#include "stats.h"
 
 #include <rdma/rdma_cma.h>
 
@@ -49,4 +51,49 @@ int rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id, struct rpm
 int rpma_peer_setup_mr_reg(struct rpma_peer *peer, struct ibv_mr **ibv_mr_ptr, void *addr,
 		size_t length, int usage);
 
+/*
+ * rpma_peer_clamp_cqe -- clamp the number of CQ entries to the limit of the peer's device
+ *
+ * ASSUMPTIONS
+ * - peer != NULL
+ *
+ * ERRORS
+ * rpma_peer_clamp_cqe() cannot fail.
+ */
+int rpma_peer_clamp_cqe(const struct rpma_peer *peer, int cqe);
+
+/*
+ * rpma_peer_get_res_pool -- get the pool of recycled connection resources of the peer
+ *
+ * ASSUMPTIONS
+ * - peer != NULL
+ *
+ * ERRORS
+ * rpma_peer_get_res_pool() cannot fail. It returns NULL if recycling is disabled.
+ */
+struct rpma_res_pool *rpma_peer_get_res_pool(const struct rpma_peer *peer);
+
+/*
+ * rpma_peer_attach_stats -- add the statistics of a new connection to the statistics
+ * of the peer
+ *
+ * ASSUMPTIONS
+ * - peer != NULL && stats != NULL
+ *
+ * ERRORS
+ * rpma_peer_attach_stats() cannot fail.
+ */
+void rpma_peer_attach_stats(struct rpma_peer *peer, struct rpma_stats *stats);
+
+/*
+ * rpma_peer_detach_stats -- keep only the sums of the counters of a deleted connection
+ *
+ * ASSUMPTIONS
+ * - peer != NULL && stats != NULL && stats is attached to the peer
+ *
+ * ERRORS
+ * rpma_peer_detach_stats() cannot fail.
+ */
+void rpma_peer_detach_stats(struct rpma_peer *peer, struct rpma_stats *stats);
+
 #endif /* LIBRPMA_PEER_H */
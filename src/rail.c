@@ -0,0 +1,770 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail.c -- librpma multi-rail implementation
+ *
+ * A multi-rail peer consists of one peer per RDMA device (a rail). A multi-rail memory region
+ * is registered with every rail and its descriptor is a concatenation of the descriptors of
+ * the memory regions of all the rails:
+ *
+ *	uint8_t num_rails;
+ *	for every rail:
+ *		uint8_t desc_size;
+ *		char desc[desc_size];	(see rpma_mr_get_descriptor(3))
+ *
+ * A multi-rail connection consists of one striped connection per rail. An RDMA read or write
+ * is split into parts of whole chunks, one part per rail which has not failed yet, and every
+ * part is posted as a striped operation whose op_context points to the descriptor of the whole
+ * operation. The operation completes when its last part does. A rail is marked as failed when
+ * any of its parts completes with an error or fails to be posted and it is not used by
+ * the following operations, so the other rails keep working.
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+#include "stripe.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* no next free operation descriptor */
+#define RAIL_OP_NONE	UINT32_MAX
+
+/* the number of rails is stored in a single byte of the descriptor */
+#define RAIL_MAX	UINT8_MAX
+
+struct rpma_rail_peer {
+	int num_rails;
+	struct rpma_peer *peers[];
+};
+
+struct rpma_rail_mr {
+	int num_rails;
+	struct rpma_mr_local *mrs[];
+};
+
+struct rpma_rail_mr_remote {
+	int num_rails;
+	struct rpma_mr_remote *mrs[];
+};
+
+struct rail {
+	struct rpma_stripe *stripe;
+	uint64_t capacity; /* the number of chunks the striped connection can hold */
+	bool failed; /* the rail is not used by the following operations */
+};
+
+struct rail_op {
+	const void *op_context; /* the op_context of the operation */
+	size_t len; /* the length of the operation */
+	uint32_t parts; /* the number of parts in flight */
+	int flags; /* the flags of the operation */
+	enum ibv_wc_opcode opcode; /* IBV_WC_RDMA_READ or IBV_WC_RDMA_WRITE */
+	enum ibv_wc_status status; /* the status of the first failed part */
+	bool abandoned; /* posting the operation failed so it is not reported */
+	uint32_t next_free; /* the next free descriptor */
+};
+
+struct rpma_rail_conn {
+	struct rail *rails;
+	int num_rails;
+	size_t chunk_size; /* the maximum size of a chunk */
+
+	struct rail_op *ops; /* the descriptors of the operations */
+	uint32_t free_op; /* the first free descriptor */
+
+	int post_next; /* the rail the next operation starts at */
+	int poll_next; /* the rail which is polled next */
+};
+
+/*
+ * rail_fail -- mark the rail as failed
+ */
+static void
+rail_fail(struct rpma_rail_conn *rconn, int r, const char *reason)
+{
+	if (rconn->rails[r].failed)
+		return;
+
+	rconn->rails[r].failed = true;
+	RPMA_LOG_WARNING("rail %i has failed (%s) and it will not be used anymore", r, reason);
+}
+
+/*
+ * rail_op_release -- put the descriptor back on the free list
+ */
+static inline void
+rail_op_release(struct rpma_rail_conn *rconn, struct rail_op *op)
+{
+	op->next_free = rconn->free_op;
+	rconn->free_op = (uint32_t)(op - rconn->ops);
+}
+
+/*
+ * rail_op_complete -- account the completion of the part and report the whole operation
+ * if it was the last part
+ */
+static bool
+rail_op_complete(struct rpma_rail_conn *rconn, struct rail_op *op, struct ibv_wc *wc)
+{
+	if (wc->status != IBV_WC_SUCCESS && op->status == IBV_WC_SUCCESS)
+		op->status = wc->status;
+
+	if (--op->parts > 0)
+		return false;
+
+	bool report = !op->abandoned &&
+			(op->status != IBV_WC_SUCCESS ||
+			(op->flags & RPMA_F_COMPLETION_ALWAYS) == RPMA_F_COMPLETION_ALWAYS);
+	if (report) {
+		wc->wr_id = (uint64_t)(uintptr_t)op->op_context;
+		wc->status = op->status;
+		wc->opcode = op->opcode;
+		wc->byte_len = op->len > UINT32_MAX ? UINT32_MAX : (uint32_t)op->len;
+	}
+
+	rail_op_release(rconn, op);
+
+	return report;
+}
+
+/*
+ * rail_fits -- check if the rail can take a part of part_chunks chunks right now
+ */
+static inline bool
+rail_fits(const struct rail *rail, uint64_t part_chunks)
+{
+	return !rail->failed && rpma_stripe_get_free_chunks(rail->stripe) >= part_chunks;
+}
+
+/*
+ * rail_post -- split the operation into parts and post them over the rails which have not
+ * failed
+ */
+static int
+rail_post(struct rpma_rail_conn *rconn, enum ibv_wc_opcode opcode,
+		const struct rpma_rail_mr *local, size_t local_offset,
+		const struct rpma_rail_mr_remote *remote, size_t remote_offset,
+		size_t len, int flags, const void *op_context)
+{
+	if (local->num_rails != rconn->num_rails || remote->num_rails != rconn->num_rails) {
+		RPMA_LOG_ERROR("the memory regions do not match the rails of the connection");
+		return RPMA_E_INVAL;
+	}
+
+	uint64_t healthy = 0;
+	uint64_t min_capacity = UINT64_MAX;
+	for (int r = 0; r < rconn->num_rails; r++) {
+		if (rconn->rails[r].failed)
+			continue;
+		healthy++;
+		if (rconn->rails[r].capacity < min_capacity)
+			min_capacity = rconn->rails[r].capacity;
+	}
+
+	if (healthy == 0) {
+		RPMA_LOG_ERROR("all the rails have failed");
+		return RPMA_E_PROVIDER;
+	}
+
+	/* every part consists of whole chunks, the last part can be shorter */
+	uint64_t chunks = (len - 1) / rconn->chunk_size + 1;
+	uint64_t part_chunks = (chunks - 1) / healthy + 1;
+	if (part_chunks > min_capacity) {
+		RPMA_LOG_ERROR("a part of the operation consists of more chunks (%" PRIu64
+			") than a rail can hold (%" PRIu64 ")", part_chunks, min_capacity);
+		return RPMA_E_INVAL;
+	}
+
+	uint64_t parts = (chunks - 1) / part_chunks + 1;
+	uint64_t fitting = 0;
+	for (int r = 0; r < rconn->num_rails; r++) {
+		if (rail_fits(&rconn->rails[r], part_chunks))
+			fitting++;
+	}
+
+	if (fitting < parts || rconn->free_op == RAIL_OP_NONE)
+		return RPMA_E_AGAIN;
+
+	struct rail_op *op = &rconn->ops[rconn->free_op];
+	rconn->free_op = op->next_free;
+
+	op->op_context = op_context;
+	op->len = len;
+	op->parts = 0;
+	op->flags = flags;
+	op->opcode = opcode;
+	op->status = IBV_WC_SUCCESS;
+	op->abandoned = false;
+
+	size_t part_size = (size_t)part_chunks * rconn->chunk_size;
+	int ret = 0;
+	int r = rconn->post_next;
+	for (size_t offset = 0; offset < len; offset += part_size) {
+		size_t part_len = len - offset;
+		if (part_len > part_size)
+			part_len = part_size;
+
+		/* the next rail which can take the part */
+		while (!rail_fits(&rconn->rails[r], part_chunks))
+			r = (r + 1) % rconn->num_rails;
+
+		struct rail *rail = &rconn->rails[r];
+		if (opcode == IBV_WC_RDMA_READ)
+			ret = rpma_stripe_read(rail->stripe, local->mrs[r], local_offset + offset,
+					remote->mrs[r], remote_offset + offset, part_len,
+					RPMA_F_COMPLETION_ALWAYS, op);
+		else
+			ret = rpma_stripe_write(rail->stripe, remote->mrs[r],
+					remote_offset + offset, local->mrs[r],
+					local_offset + offset, part_len,
+					RPMA_F_COMPLETION_ALWAYS, op);
+		if (ret) {
+			if (ret == RPMA_E_PROVIDER)
+				rail_fail(rconn, r, "posting a part failed");
+			break;
+		}
+
+		op->parts++;
+		r = (r + 1) % rconn->num_rails;
+	}
+
+	rconn->post_next = r;
+
+	if (ret == 0)
+		return 0;
+
+	if (op->parts == 0) {
+		/* nothing has been posted */
+		rail_op_release(rconn, op);
+	} else {
+		/* the parts already posted are collected but not reported */
+		op->abandoned = true;
+	}
+
+	return ret;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_rail_peer_new -- create a peer for every RDMA device
+ */
+int
+rpma_rail_peer_new(struct ibv_context **ibv_ctxs, int num_rails,
+		struct rpma_rail_peer **rpeer_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ibv_ctxs == NULL || rpeer_ptr == NULL || num_rails <= 0 || num_rails > RAIL_MAX)
+		return RPMA_E_INVAL;
+
+	struct rpma_rail_peer *rpeer = malloc(sizeof(*rpeer) +
+			(size_t)num_rails * sizeof(rpeer->peers[0]));
+	if (rpeer == NULL)
+		return RPMA_E_NOMEM;
+
+	int ret = 0;
+	int r;
+	for (r = 0; r < num_rails; r++) {
+		ret = rpma_peer_new(ibv_ctxs[r], &rpeer->peers[r]);
+		if (ret)
+			goto err_peers_delete;
+	}
+
+	rpeer->num_rails = num_rails;
+	*rpeer_ptr = rpeer;
+
+	return 0;
+
+err_peers_delete:
+	while (r-- > 0)
+		(void) rpma_peer_delete(&rpeer->peers[r]);
+	free(rpeer);
+
+	return ret;
+}
+
+/*
+ * rpma_rail_peer_delete -- delete the peers of all the rails
+ */
+int
+rpma_rail_peer_delete(struct rpma_rail_peer **rpeer_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (rpeer_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_rail_peer *rpeer = *rpeer_ptr;
+	if (rpeer == NULL)
+		return 0;
+
+	int ret = 0;
+	for (int r = 0; r < rpeer->num_rails; r++) {
+		int ret2 = rpma_peer_delete(&rpeer->peers[r]);
+		if (ret2 && ret == 0)
+			ret = ret2;
+	}
+
+	free(rpeer);
+	*rpeer_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_rail_peer_get_peer -- get the peer of one of the rails
+ */
+int
+rpma_rail_peer_get_peer(const struct rpma_rail_peer *rpeer, int rail,
+		struct rpma_peer **peer_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rpeer == NULL || peer_ptr == NULL || rail < 0 || rail >= rpeer->num_rails)
+		return RPMA_E_INVAL;
+
+	*peer_ptr = rpeer->peers[rail];
+
+	return 0;
+}
+
+/*
+ * rpma_rail_mr_reg -- register the memory region with every rail
+ */
+int
+rpma_rail_mr_reg(struct rpma_rail_peer *rpeer, void *ptr, size_t size, int usage,
+		struct rpma_rail_mr **mr_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rpeer == NULL || ptr == NULL || size == 0 || usage == 0 || mr_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_rail_mr *mr = malloc(sizeof(*mr) +
+			(size_t)rpeer->num_rails * sizeof(mr->mrs[0]));
+	if (mr == NULL)
+		return RPMA_E_NOMEM;
+
+	int ret = 0;
+	int r;
+	for (r = 0; r < rpeer->num_rails; r++) {
+		ret = rpma_mr_reg(rpeer->peers[r], ptr, size, usage, &mr->mrs[r]);
+		if (ret)
+			goto err_mrs_dereg;
+	}
+
+	mr->num_rails = rpeer->num_rails;
+	*mr_ptr = mr;
+
+	return 0;
+
+err_mrs_dereg:
+	while (r-- > 0)
+		(void) rpma_mr_dereg(&mr->mrs[r]);
+	free(mr);
+
+	return ret;
+}
+
+/*
+ * rpma_rail_mr_dereg -- deregister the memory region from every rail
+ */
+int
+rpma_rail_mr_dereg(struct rpma_rail_mr **mr_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (mr_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_rail_mr *mr = *mr_ptr;
+	if (mr == NULL)
+		return 0;
+
+	int ret = 0;
+	for (int r = 0; r < mr->num_rails; r++) {
+		int ret2 = rpma_mr_dereg(&mr->mrs[r]);
+		if (ret2 && ret == 0)
+			ret = ret2;
+	}
+
+	free(mr);
+	*mr_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_rail_mr_get_descriptor_size -- get the size of the combined descriptor
+ */
+int
+rpma_rail_mr_get_descriptor_size(const struct rpma_rail_mr *mr, size_t *desc_size)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (mr == NULL || desc_size == NULL)
+		return RPMA_E_INVAL;
+
+	size_t total = sizeof(uint8_t);
+	for (int r = 0; r < mr->num_rails; r++) {
+		size_t size = 0;
+		int ret = rpma_mr_get_descriptor_size(mr->mrs[r], &size);
+		if (ret)
+			return ret;
+		total += sizeof(uint8_t) + size;
+	}
+
+	*desc_size = total;
+
+	return 0;
+}
+
+/*
+ * rpma_rail_mr_get_descriptor -- get the combined descriptor of the memory region
+ */
+int
+rpma_rail_mr_get_descriptor(const struct rpma_rail_mr *mr, void *desc)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (mr == NULL || desc == NULL)
+		return RPMA_E_INVAL;
+
+	char *buff = (char *)desc;
+	*(uint8_t *)buff = (uint8_t)mr->num_rails;
+	buff += sizeof(uint8_t);
+
+	for (int r = 0; r < mr->num_rails; r++) {
+		size_t size = 0;
+		int ret = rpma_mr_get_descriptor_size(mr->mrs[r], &size);
+		if (ret)
+			return ret;
+		if (size > UINT8_MAX)
+			return RPMA_E_INVAL;
+
+		*(uint8_t *)buff = (uint8_t)size;
+		buff += sizeof(uint8_t);
+
+		ret = rpma_mr_get_descriptor(mr->mrs[r], buff);
+		if (ret)
+			return ret;
+		buff += size;
+	}
+
+	return 0;
+}
+
+/*
+ * rpma_rail_mr_remote_from_descriptor -- create the remote memory regions of all the rails
+ * from the combined descriptor
+ */
+int
+rpma_rail_mr_remote_from_descriptor(const void *desc, size_t desc_size,
+		struct rpma_rail_mr_remote **mr_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (desc == NULL || desc_size < sizeof(uint8_t) || mr_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	const char *buff = (const char *)desc;
+	const char *end = buff + desc_size;
+
+	int num_rails = *(const uint8_t *)buff;
+	buff += sizeof(uint8_t);
+	if (num_rails == 0) {
+		RPMA_LOG_ERROR("the descriptor does not describe any rail");
+		return RPMA_E_INVAL;
+	}
+
+	struct rpma_rail_mr_remote *mr = malloc(sizeof(*mr) +
+			(size_t)num_rails * sizeof(mr->mrs[0]));
+	if (mr == NULL)
+		return RPMA_E_NOMEM;
+
+	int ret = 0;
+	int r;
+	for (r = 0; r < num_rails; r++) {
+		size_t size = 0;
+		if (buff < end) {
+			size = *(const uint8_t *)buff;
+			buff += sizeof(uint8_t);
+		}
+		if (size == 0 || size > (size_t)(end - buff)) {
+			RPMA_LOG_ERROR("the descriptor of the rail %i is truncated", r);
+			ret = RPMA_E_INVAL;
+			goto err_mrs_delete;
+		}
+
+		ret = rpma_mr_remote_from_descriptor(buff, size, &mr->mrs[r]);
+		if (ret)
+			goto err_mrs_delete;
+		buff += size;
+	}
+
+	mr->num_rails = num_rails;
+	*mr_ptr = mr;
+
+	return 0;
+
+err_mrs_delete:
+	while (r-- > 0)
+		(void) rpma_mr_remote_delete(&mr->mrs[r]);
+	free(mr);
+
+	return ret;
+}
+
+/*
+ * rpma_rail_mr_remote_delete -- delete the remote memory regions of all the rails
+ */
+int
+rpma_rail_mr_remote_delete(struct rpma_rail_mr_remote **mr_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (mr_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_rail_mr_remote *mr = *mr_ptr;
+	if (mr == NULL)
+		return 0;
+
+	int ret = 0;
+	for (int r = 0; r < mr->num_rails; r++) {
+		int ret2 = rpma_mr_remote_delete(&mr->mrs[r]);
+		if (ret2 && ret == 0)
+			ret = ret2;
+	}
+
+	free(mr);
+	*mr_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_rail_conn_connect -- establish a striped connection over every rail
+ */
+int
+rpma_rail_conn_connect(struct rpma_rail_peer *rpeer, const char *const *addrs,
+		const char *port, const struct rpma_conn_cfg *cfg,
+		const struct rpma_conn_private_data *pdata, int conns_per_rail, size_t chunk_size,
+		struct rpma_rail_conn **rconn_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rpeer == NULL || addrs == NULL || port == NULL || rconn_ptr == NULL ||
+			conns_per_rail <= 0 || chunk_size == 0)
+		return RPMA_E_INVAL;
+
+	int num_rails = rpeer->num_rails;
+	int ret = 0;
+
+	struct rpma_rail_conn *rconn = malloc(sizeof(*rconn));
+	if (rconn == NULL)
+		return RPMA_E_NOMEM;
+
+	struct rail *rails = malloc((size_t)num_rails * sizeof(*rails));
+	if (rails == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_rconn;
+	}
+
+	/* every operation takes at least one chunk of a rail */
+	uint64_t capacity = 0;
+	int r;
+	for (r = 0; r < num_rails; r++) {
+		if (addrs[r] == NULL) {
+			ret = RPMA_E_INVAL;
+			goto err_stripes_delete;
+		}
+
+		ret = rpma_stripe_connect(rpeer->peers[r], addrs[r], port, cfg, pdata,
+				conns_per_rail, chunk_size, &rails[r].stripe);
+		if (ret)
+			goto err_stripes_delete;
+
+		rails[r].capacity = rpma_stripe_get_capacity(rails[r].stripe);
+		rails[r].failed = false;
+		capacity += rails[r].capacity;
+	}
+
+	if (capacity >= RAIL_OP_NONE) {
+		ret = RPMA_E_INVAL;
+		goto err_stripes_delete;
+	}
+
+	struct rail_op *ops = malloc((size_t)capacity * sizeof(*ops));
+	if (ops == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_stripes_delete;
+	}
+
+	for (uint32_t i = 0; i < (uint32_t)capacity; i++)
+		ops[i].next_free = i + 1;
+	ops[capacity - 1].next_free = RAIL_OP_NONE;
+
+	rconn->rails = rails;
+	rconn->num_rails = num_rails;
+	rconn->chunk_size = chunk_size;
+	rconn->ops = ops;
+	rconn->free_op = 0;
+	rconn->post_next = 0;
+	rconn->poll_next = 0;
+
+	*rconn_ptr = rconn;
+
+	return 0;
+
+err_stripes_delete:
+	while (r-- > 0)
+		(void) rpma_stripe_delete(&rails[r].stripe);
+	free(rails);
+
+err_free_rconn:
+	free(rconn);
+
+	return ret;
+}
+
+/*
+ * rpma_rail_conn_delete -- disconnect and delete the striped connections of all the rails
+ */
+int
+rpma_rail_conn_delete(struct rpma_rail_conn **rconn_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (rconn_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_rail_conn *rconn = *rconn_ptr;
+	if (rconn == NULL)
+		return 0;
+
+	int ret = 0;
+	for (int r = 0; r < rconn->num_rails; r++) {
+		int ret2 = rpma_stripe_delete(&rconn->rails[r].stripe);
+		if (ret2 && ret == 0)
+			ret = ret2;
+	}
+
+	free(rconn->ops);
+	free(rconn->rails);
+	free(rconn);
+	*rconn_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_rail_conn_is_failed -- check if the rail has failed
+ */
+int
+rpma_rail_conn_is_failed(const struct rpma_rail_conn *rconn, int rail, bool *failed)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rconn == NULL || failed == NULL || rail < 0 || rail >= rconn->num_rails)
+		return RPMA_E_INVAL;
+
+	*failed = rconn->rails[rail].failed;
+
+	return 0;
+}
+
+/*
+ * rpma_rail_read -- initiate the multi-rail read operation
+ */
+int
+rpma_rail_read(struct rpma_rail_conn *rconn, const struct rpma_rail_mr *dst, size_t dst_offset,
+		const struct rpma_rail_mr_remote *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rconn == NULL || dst == NULL || src == NULL || len == 0 || flags == 0)
+		return RPMA_E_INVAL;
+
+	return rail_post(rconn, IBV_WC_RDMA_READ, dst, dst_offset, src, src_offset, len, flags,
+			op_context);
+}
+
+/*
+ * rpma_rail_write -- initiate the multi-rail write operation
+ */
+int
+rpma_rail_write(struct rpma_rail_conn *rconn, const struct rpma_rail_mr_remote *dst,
+		size_t dst_offset, const struct rpma_rail_mr *src, size_t src_offset, size_t len,
+		int flags, const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rconn == NULL || dst == NULL || src == NULL || len == 0 || flags == 0)
+		return RPMA_E_INVAL;
+
+	return rail_post(rconn, IBV_WC_RDMA_WRITE, src, src_offset, dst, dst_offset, len, flags,
+			op_context);
+}
+
+/*
+ * rpma_rail_get_wc -- collect the part completions until a whole operation completes
+ */
+int
+rpma_rail_get_wc(struct rpma_rail_conn *rconn, struct ibv_wc *wc)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rconn == NULL || wc == NULL)
+		return RPMA_E_INVAL;
+
+	/* stop after a whole round over the rails without any completion */
+	int idle = 0;
+	while (idle < rconn->num_rails) {
+		int r = rconn->poll_next;
+		rconn->poll_next = (rconn->poll_next + 1) % rconn->num_rails;
+
+		int ret = rpma_stripe_get_wc(rconn->rails[r].stripe, wc);
+		if (ret == RPMA_E_NO_COMPLETION) {
+			idle++;
+			continue;
+		}
+		if (ret)
+			return ret;
+
+		idle = 0;
+		if (wc->status != IBV_WC_SUCCESS)
+			rail_fail(rconn, r, ibv_wc_status_str(wc->status));
+
+		struct rail_op *op = (struct rail_op *)(uintptr_t)wc->wr_id;
+		if (rail_op_complete(rconn, op, wc))
+			return 0;
+	}
+
+	return RPMA_E_NO_COMPLETION;
+}
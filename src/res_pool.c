@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool.c -- librpma pool of recycled connection resources implementations
+ *
+ * The pool keeps the CQ sets (the main CQ, the receive CQ and the completion channel shared
+ * by them) and the flushing objects of the deleted connections so the next connections can
+ * reuse them instead of creating them from scratch. Every kept item occupies one slot.
+ * An item is taken by exchanging its slot with NULL so an item is owned by exactly one thread
+ * at a time and no locks are needed.
+ */
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "cq.h"
+#include "debug.h"
+#include "log_internal.h"
+#include "res_pool.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+struct rpma_res_pool_cqs {
+	struct rpma_cq *cq; /* main CQ */
+	struct rpma_cq *rcq; /* receive CQ (optional) */
+	struct ibv_comp_channel *channel; /* completion channel shared by CQs (optional) */
+};
+
+typedef _Atomic(struct rpma_res_pool_cqs *) rpma_res_pool_cqs_slot;
+typedef _Atomic(struct rpma_flush *) rpma_res_pool_flush_slot;
+
+struct rpma_res_pool {
+	int size; /* the number of slots of every kind */
+	rpma_res_pool_cqs_slot *cqs; /* the kept CQ sets */
+	rpma_res_pool_flush_slot *flushes; /* the kept flushing objects */
+};
+
+/*
+ * rpma_res_pool_cqs_delete -- delete all resources of the CQ set
+ */
+static int
+rpma_res_pool_cqs_delete(struct rpma_res_pool_cqs *cqs)
+{
+	int ret = rpma_cq_delete(&cqs->rcq);
+	int ret2 = rpma_cq_delete(&cqs->cq);
+	if (!ret)
+		ret = ret2;
+
+	if (cqs->channel) {
+		errno = ibv_destroy_comp_channel(cqs->channel);
+		if (errno) {
+			RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_destroy_comp_channel()");
+			if (!ret)
+				ret = RPMA_E_PROVIDER;
+		}
+	}
+
+	free(cqs);
+
+	return ret;
+}
+
+/*
+ * rpma_res_pool_cqs_keep -- store the CQ set in the first free slot
+ */
+static bool
+rpma_res_pool_cqs_keep(struct rpma_res_pool *pool, struct rpma_res_pool_cqs *cqs)
+{
+	for (int i = 0; i < pool->size; i++) {
+		struct rpma_res_pool_cqs *expected = NULL;
+		if (atomic_compare_exchange_strong(&pool->cqs[i], &expected, cqs))
+			return true;
+	}
+
+	return false;
+}
+
+/*
+ * rpma_res_pool_cqs_match -- check if the CQ set fits the requested one
+ */
+static bool
+rpma_res_pool_cqs_match(const struct rpma_res_pool_cqs *cqs, int cqe, int rcqe, bool shared)
+{
+	if ((cqs->channel != NULL) != shared)
+		return false;
+
+	if (rpma_cq_get_ibv_cq(cqs->cq)->cqe < cqe)
+		return false;
+
+	if (rcqe == 0)
+		return (cqs->rcq == NULL);
+
+	return (cqs->rcq != NULL && rpma_cq_get_ibv_cq(cqs->rcq)->cqe >= rcqe);
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_res_pool_new -- create a pool keeping up to size CQ sets and up to size flushing objects
+ */
+int
+rpma_res_pool_new(int size, struct rpma_res_pool **pool_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	struct rpma_res_pool *pool = malloc(sizeof(*pool));
+	if (pool == NULL)
+		return RPMA_E_NOMEM;
+
+	pool->cqs = calloc((size_t)size, sizeof(*pool->cqs));
+	if (pool->cqs == NULL)
+		goto err_free_pool;
+
+	pool->flushes = calloc((size_t)size, sizeof(*pool->flushes));
+	if (pool->flushes == NULL)
+		goto err_free_cqs;
+
+	pool->size = size;
+	*pool_ptr = pool;
+
+	return 0;
+
+err_free_cqs:
+	free(pool->cqs);
+
+err_free_pool:
+	free(pool);
+
+	return RPMA_E_NOMEM;
+}
+
+/*
+ * rpma_res_pool_delete -- delete the pool and all the resources kept in it
+ */
+int
+rpma_res_pool_delete(struct rpma_res_pool **pool_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	struct rpma_res_pool *pool = *pool_ptr;
+	int ret = 0;
+
+	if (pool == NULL)
+		return 0;
+
+	for (int i = 0; i < pool->size; i++) {
+		struct rpma_res_pool_cqs *cqs = atomic_exchange(&pool->cqs[i], NULL);
+		if (cqs) {
+			int ret2 = rpma_res_pool_cqs_delete(cqs);
+			if (!ret)
+				ret = ret2;
+		}
+
+		struct rpma_flush *flush = atomic_exchange(&pool->flushes[i], NULL);
+		if (flush) {
+			int ret2 = rpma_flush_delete(&flush);
+			if (!ret)
+				ret = ret2;
+		}
+	}
+
+	free(pool->flushes);
+	free(pool->cqs);
+	free(pool);
+	*pool_ptr = NULL;
+
+	return ret;
+}
+
+/*
+ * rpma_res_pool_take_cqs -- take out of the pool a CQ set of at least cqe (and rcqe) entries
+ */
+bool
+rpma_res_pool_take_cqs(struct rpma_res_pool *pool, int cqe, int rcqe, bool shared,
+		struct rpma_cq **cq_ptr, struct rpma_cq **rcq_ptr,
+		struct ibv_comp_channel **channel_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	for (int i = 0; i < pool->size; i++) {
+		struct rpma_res_pool_cqs *cqs = atomic_exchange(&pool->cqs[i], NULL);
+		if (cqs == NULL)
+			continue;
+
+		if (!rpma_res_pool_cqs_match(cqs, cqe, rcqe, shared)) {
+			/* give it back; if all slots got occupied in the meantime drop it */
+			if (!rpma_res_pool_cqs_keep(pool, cqs))
+				(void) rpma_res_pool_cqs_delete(cqs);
+			continue;
+		}
+
+		*cq_ptr = cqs->cq;
+		*rcq_ptr = cqs->rcq;
+		*channel_ptr = cqs->channel;
+		free(cqs);
+
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * rpma_res_pool_put_cqs -- reset the CQs and keep the CQ set in the pool
+ */
+bool
+rpma_res_pool_put_cqs(struct rpma_res_pool *pool, struct rpma_cq *cq, struct rpma_cq *rcq,
+		struct ibv_comp_channel *channel)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (rpma_cq_reset(cq))
+		return false;
+
+	if (rcq && rpma_cq_reset(rcq))
+		return false;
+
+	struct rpma_res_pool_cqs *cqs = malloc(sizeof(*cqs));
+	if (cqs == NULL)
+		return false;
+
+	cqs->cq = cq;
+	cqs->rcq = rcq;
+	cqs->channel = channel;
+
+	if (!rpma_res_pool_cqs_keep(pool, cqs)) {
+		free(cqs);
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * rpma_res_pool_take_flush -- take a flushing object out of the pool
+ */
+bool
+rpma_res_pool_take_flush(struct rpma_res_pool *pool, struct rpma_flush **flush_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	for (int i = 0; i < pool->size; i++) {
+		struct rpma_flush *flush = atomic_exchange(&pool->flushes[i], NULL);
+		if (flush) {
+			*flush_ptr = flush;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * rpma_res_pool_put_flush -- keep the flushing object in the pool
+ */
+bool
+rpma_res_pool_put_flush(struct rpma_res_pool *pool, struct rpma_flush *flush)
+{
+	RPMA_DEBUG_TRACE;
+
+	for (int i = 0; i < pool->size; i++) {
+		struct rpma_flush *expected = NULL;
+		if (atomic_compare_exchange_strong(&pool->flushes[i], &expected, flush))
+			return true;
+	}
+
+	return false;
+}
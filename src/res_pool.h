@@ -0,0 +1,98 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool.h -- librpma pool of recycled connection resources internal definitions
+ */
+
+#ifndef LIBRPMA_RES_POOL_H
+#define LIBRPMA_RES_POOL_H
+
+#include <stdbool.h>
+#include <infiniband/verbs.h>
+
+#include "librpma.h"
+#include "flush.h"
+
+struct rpma_res_pool;
+
+/*
+ * rpma_res_pool_new -- create a pool keeping up to size CQ sets and up to size flushing objects
+ *
+ * ASSUMPTIONS
+ * - size > 0 && pool_ptr != NULL
+ *
+ * ERRORS
+ * rpma_res_pool_new() can fail with the following error:
+ *
+ * - RPMA_E_NOMEM - out of memory
+ */
+int rpma_res_pool_new(int size, struct rpma_res_pool **pool_ptr);
+
+/*
+ * rpma_res_pool_delete -- delete the pool and all the resources kept in it
+ *
+ * ASSUMPTIONS
+ * - pool_ptr != NULL
+ * - no other thread uses the pool
+ *
+ * ERRORS
+ * rpma_res_pool_delete() can fail with the following error:
+ *
+ * - RPMA_E_PROVIDER - deleting one of the kept resources failed
+ */
+int rpma_res_pool_delete(struct rpma_res_pool **pool_ptr);
+
+/*
+ * rpma_res_pool_take_cqs -- take out of the pool a CQ set of at least cqe (and rcqe)
+ * entries. The set has a receive CQ only if rcqe > 0 and a completion channel shared
+ * by its CQs only if shared is true.
+ *
+ * ASSUMPTIONS
+ * - pool != NULL && cq_ptr != NULL && rcq_ptr != NULL && channel_ptr != NULL
+ *
+ * ERRORS
+ * rpma_res_pool_take_cqs() cannot fail. It returns false if no matching set is kept.
+ */
+bool rpma_res_pool_take_cqs(struct rpma_res_pool *pool, int cqe, int rcqe, bool shared,
+		struct rpma_cq **cq_ptr, struct rpma_cq **rcq_ptr,
+		struct ibv_comp_channel **channel_ptr);
+
+/*
+ * rpma_res_pool_put_cqs -- reset the CQs and keep the CQ set in the pool
+ *
+ * ASSUMPTIONS
+ * - pool != NULL && cq != NULL
+ * - the QP using the CQs is already destroyed
+ *
+ * ERRORS
+ * rpma_res_pool_put_cqs() cannot fail. It returns false if the set was not kept
+ * (the pool is full or resetting the CQs failed) so the caller has to delete it.
+ */
+bool rpma_res_pool_put_cqs(struct rpma_res_pool *pool, struct rpma_cq *cq, struct rpma_cq *rcq,
+		struct ibv_comp_channel *channel);
+
+/*
+ * rpma_res_pool_take_flush -- take a flushing object out of the pool
+ *
+ * ASSUMPTIONS
+ * - pool != NULL && flush_ptr != NULL
+ *
+ * ERRORS
+ * rpma_res_pool_take_flush() cannot fail. It returns false if no flushing object is kept.
+ */
+bool rpma_res_pool_take_flush(struct rpma_res_pool *pool, struct rpma_flush **flush_ptr);
+
+/*
+ * rpma_res_pool_put_flush -- keep the flushing object in the pool
+ *
+ * ASSUMPTIONS
+ * - pool != NULL && flush != NULL
+ *
+ * ERRORS
+ * rpma_res_pool_put_flush() cannot fail. It returns false if the pool is full
+ * so the caller has to delete the flushing object.
+ */
+bool rpma_res_pool_put_flush(struct rpma_res_pool *pool, struct rpma_flush *flush);
+
+#endif /* LIBRPMA_RES_POOL_H */
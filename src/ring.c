@@ -0,0 +1,419 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring.c -- librpma ring-buffer messaging implementations
+ *
+ * Each side of the connection owns a receive ring (written by the peer using RDMA writes)
+ * followed by a credit slot (written back by the peer with the amount of the consumed space).
+ * A message is written contiguously into the remote ring together with the immediate data
+ * carrying the new head index of the ring. Since every notification describes exactly one
+ * message the receiver can recover the message's offset and length (including the wrap-around)
+ * from its own tail index and the received head index.
+ */
+
+#include <arpa/inet.h>
+#include <endian.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "conn.h"
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* the size of the credit area placed right after the ring (a separate cache line) */
+#define RPMA_RING_CREDIT_SIZE 64
+
+#define RPMA_RING_SIZE_MIN 64
+#define RPMA_RING_SIZE_MAX ((size_t)1 << 31)
+
+/* the maximum message size is a quarter of the remote ring */
+#define RPMA_RING_MSG_SIZE_MAX(size) ((size) / 4)
+
+/* the consumed space is written back after releasing a quarter of the ring */
+#define RPMA_RING_CREDIT_THRESHOLD(size) ((size) / 4)
+
+#define IS_POWER_OF_TWO(x) ((x) != 0 && ((x) & ((x) - 1)) == 0)
+
+struct rpma_ring {
+	struct rpma_peer *peer; /* a peer used to register the memory */
+	struct rpma_conn *conn; /* the connection the ring is attached to */
+
+	/* the local (receive) side */
+	char *rx; /* the receive ring followed by the credit slot */
+	size_t rx_size; /* the size of the receive ring */
+	struct rpma_mr_local *rx_mr; /* a registration of rx */
+	uint32_t rx_tail; /* the end of the last received message */
+	uint32_t rx_released; /* the end of the last released message */
+	uint32_t rx_credited; /* the last value written back to the peer */
+
+	/* the remote (send) side */
+	char *tx; /* the staging buffer followed by the outgoing credit slot */
+	size_t tx_size; /* the size of the remote ring */
+	struct rpma_mr_local *tx_mr; /* a registration of tx */
+	struct rpma_mr_remote *remote_mr; /* the remote ring followed by its credit slot */
+	uint32_t tx_head; /* the head of the remote ring */
+};
+
+/*
+ * ring_credit_in -- the credit slot written back by the peer
+ */
+static inline uint64_t *
+ring_credit_in(const struct rpma_ring *ring)
+{
+	return (uint64_t *)(ring->rx + ring->rx_size);
+}
+
+/*
+ * ring_credit_out -- the source of the credit write-back
+ */
+static inline uint64_t *
+ring_credit_out(const struct rpma_ring *ring)
+{
+	return (uint64_t *)(ring->tx + ring->tx_size);
+}
+
+/*
+ * ring_write_back -- return the released space to the peer
+ */
+static int
+ring_write_back(struct rpma_ring *ring)
+{
+	*ring_credit_out(ring) = htole64((uint64_t)ring->rx_released);
+
+	int ret = rpma_write(ring->conn, ring->remote_mr, ring->tx_size, ring->tx_mr,
+			ring->tx_size, sizeof(uint64_t), RPMA_F_COMPLETION_ON_ERROR, NULL);
+	if (ret)
+		return ret;
+
+	ring->rx_credited = ring->rx_released;
+
+	return 0;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_ring_new -- allocate and register a new receive ring
+ */
+int
+rpma_ring_new(struct rpma_peer *peer, size_t size, struct rpma_ring **ring_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || ring_ptr == NULL || !IS_POWER_OF_TWO(size) ||
+			size < RPMA_RING_SIZE_MIN || size > RPMA_RING_SIZE_MAX)
+		return RPMA_E_INVAL;
+
+	int ret;
+
+	struct rpma_ring *ring = malloc(sizeof(*ring));
+	if (ring == NULL)
+		return RPMA_E_NOMEM;
+
+	char *rx = malloc(size + RPMA_RING_CREDIT_SIZE);
+	if (rx == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_ring;
+	}
+	memset(rx, 0, size + RPMA_RING_CREDIT_SIZE);
+
+	struct rpma_mr_local *rx_mr = NULL;
+	ret = rpma_mr_reg(peer, rx, size + RPMA_RING_CREDIT_SIZE, RPMA_MR_USAGE_WRITE_DST,
+			&rx_mr);
+	if (ret)
+		goto err_free_rx;
+
+	memset(ring, 0, sizeof(*ring));
+	ring->peer = peer;
+	ring->rx = rx;
+	ring->rx_size = size;
+	ring->rx_mr = rx_mr;
+
+	*ring_ptr = ring;
+
+	return 0;
+
+err_free_rx:
+	free(rx);
+
+err_free_ring:
+	free(ring);
+
+	return ret;
+}
+
+/*
+ * rpma_ring_delete -- deregister and free the ring
+ */
+int
+rpma_ring_delete(struct rpma_ring **ring_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (ring_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_ring *ring = *ring_ptr;
+	if (ring == NULL)
+		return 0;
+
+	int ret = 0;
+
+	if (ring->tx_mr) {
+		ret = rpma_mr_dereg(&ring->tx_mr);
+		(void) rpma_mr_remote_delete(&ring->remote_mr);
+	}
+
+	int ret2 = rpma_mr_dereg(&ring->rx_mr);
+	if (!ret)
+		ret = ret2;
+
+	free(ring->tx);
+	free(ring->rx);
+	free(ring);
+	*ring_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_ring_get_descriptor_size -- get the size of the ring descriptor
+ */
+int
+rpma_ring_get_descriptor_size(const struct rpma_ring *ring, size_t *desc_size)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ring == NULL || desc_size == NULL)
+		return RPMA_E_INVAL;
+
+	return rpma_mr_get_descriptor_size(ring->rx_mr, desc_size);
+}
+
+/*
+ * rpma_ring_get_descriptor -- get the descriptor of the ring
+ */
+int
+rpma_ring_get_descriptor(const struct rpma_ring *ring, void *desc)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ring == NULL || desc == NULL)
+		return RPMA_E_INVAL;
+
+	return rpma_mr_get_descriptor(ring->rx_mr, desc);
+}
+
+/*
+ * rpma_ring_attach -- attach the ring to the connection and the remote ring
+ */
+int
+rpma_ring_attach(struct rpma_ring *ring, struct rpma_conn *conn, const void *desc,
+		size_t desc_size, uint32_t recv_num)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ring == NULL || conn == NULL || desc == NULL || ring->conn != NULL)
+		return RPMA_E_INVAL;
+
+	/* all receives are posted at once so the receive queue has to hold them */
+	uint32_t rq_size;
+	int ret = rpma_conn_get_rq_size(conn, &rq_size);
+	if (ret)
+		return ret;
+
+	if (recv_num > rq_size) {
+		RPMA_LOG_ERROR("recv_num exceeds the receive queue size: %" PRIu32 " > %" PRIu32,
+			recv_num, rq_size);
+		return RPMA_E_INVAL;
+	}
+
+	struct rpma_mr_remote *remote_mr = NULL;
+	ret = rpma_mr_remote_from_descriptor(desc, desc_size, &remote_mr);
+	if (ret)
+		return ret;
+
+	size_t remote_size = 0;
+	ret = rpma_mr_remote_get_size(remote_mr, &remote_size);
+	if (ret)
+		goto err_remote_delete;
+
+	size_t tx_size = remote_size - RPMA_RING_CREDIT_SIZE;
+	if (remote_size <= RPMA_RING_CREDIT_SIZE || !IS_POWER_OF_TWO(tx_size) ||
+			tx_size < RPMA_RING_SIZE_MIN || tx_size > RPMA_RING_SIZE_MAX) {
+		RPMA_LOG_ERROR("invalid size of the remote ring: %zu", remote_size);
+		ret = RPMA_E_INVAL;
+		goto err_remote_delete;
+	}
+
+	char *tx = malloc(tx_size + sizeof(uint64_t));
+	if (tx == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_remote_delete;
+	}
+	memset(tx, 0, tx_size + sizeof(uint64_t));
+
+	struct rpma_mr_local *tx_mr = NULL;
+	ret = rpma_mr_reg(ring->peer, tx, tx_size + sizeof(uint64_t), RPMA_MR_USAGE_WRITE_SRC,
+			&tx_mr);
+	if (ret)
+		goto err_free_tx;
+
+	/* each notification consumes one receive (posted last since they cannot be withdrawn) */
+	uint32_t posted;
+	for (posted = 0; posted < recv_num; posted++) {
+		ret = rpma_recv(conn, NULL, 0, 0, ring);
+		if (ret)
+			goto err_flush_recv;
+	}
+
+	ring->conn = conn;
+	ring->tx = tx;
+	ring->tx_size = tx_size;
+	ring->tx_mr = tx_mr;
+	ring->remote_mr = remote_mr;
+
+	return 0;
+
+err_flush_recv:
+	/*
+	 * Disconnecting moves the QP into the error state, so the receives already posted
+	 * are flushed and no notification is matched against the ring which is not attached.
+	 */
+	if (posted > 0)
+		(void) rpma_conn_disconnect(conn);
+
+	(void) rpma_mr_dereg(&tx_mr);
+
+err_free_tx:
+	free(tx);
+
+err_remote_delete:
+	(void) rpma_mr_remote_delete(&remote_mr);
+
+	return ret;
+}
+
+/*
+ * rpma_ring_send -- write the message into the remote ring and notify the peer
+ */
+int
+rpma_ring_send(struct rpma_ring *ring, const void *msg, size_t len, int flags,
+		const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ring == NULL || ring->conn == NULL || flags == 0 || (msg == NULL && len != 0) ||
+			len > RPMA_RING_MSG_SIZE_MAX(ring->tx_size))
+		return RPMA_E_INVAL;
+
+	uint32_t credited = (uint32_t)le64toh(__atomic_load_n(ring_credit_in(ring),
+			__ATOMIC_ACQUIRE));
+	size_t pos = ring->tx_head & (ring->tx_size - 1);
+	size_t skip = (pos + len > ring->tx_size) ? ring->tx_size - pos : 0;
+	size_t used = (uint32_t)(ring->tx_head - credited);
+
+	if (used + skip + len > ring->tx_size)
+		return RPMA_E_AGAIN;
+
+	size_t offset = skip ? 0 : pos;
+	uint32_t head = ring->tx_head + (uint32_t)(skip + len);
+	int ret;
+
+	if (len == 0) {
+		ret = rpma_write_with_imm(ring->conn, NULL, 0, NULL, 0, 0, flags, head,
+				op_context);
+	} else {
+		memcpy(ring->tx + offset, msg, len);
+		ret = rpma_write_with_imm(ring->conn, ring->remote_mr, offset, ring->tx_mr,
+				offset, len, flags, head, op_context);
+	}
+	if (ret)
+		return ret;
+
+	ring->tx_head = head;
+
+	return 0;
+}
+
+/*
+ * rpma_ring_recv -- decode the message notified by the completion
+ */
+int
+rpma_ring_recv(struct rpma_ring *ring, const struct ibv_wc *wc, const void **msg_ptr,
+		size_t *len_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ring == NULL || ring->conn == NULL || wc == NULL || msg_ptr == NULL ||
+			len_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	if (wc->opcode != IBV_WC_RECV_RDMA_WITH_IMM || !(wc->wc_flags & IBV_WC_WITH_IMM))
+		return RPMA_E_INVAL;
+
+	uint32_t head = ntohl(wc->imm_data);
+	size_t total = (uint32_t)(head - ring->rx_tail);
+	if (total > ring->rx_size) {
+		RPMA_LOG_ERROR("invalid head of the ring: %" PRIu32 " (tail %" PRIu32 ")", head,
+			ring->rx_tail);
+		return RPMA_E_INVAL;
+	}
+
+	/* a message which does not fit before the end of the ring starts at the beginning */
+	size_t pos = ring->rx_tail & (ring->rx_size - 1);
+	size_t offset = pos;
+	size_t len = total;
+	if (pos + total > ring->rx_size) {
+		offset = 0;
+		len = total - (ring->rx_size - pos);
+	}
+
+	/* replace the consumed receive */
+	int ret = rpma_recv(ring->conn, NULL, 0, 0, ring);
+	if (ret)
+		return ret;
+
+	ring->rx_tail = head;
+
+	*msg_ptr = ring->rx + offset;
+	*len_ptr = len;
+
+	return 0;
+}
+
+/*
+ * rpma_ring_release -- release all received messages and return the space if needed
+ */
+int
+rpma_ring_release(struct rpma_ring *ring)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ring == NULL || ring->conn == NULL)
+		return RPMA_E_INVAL;
+
+	ring->rx_released = ring->rx_tail;
+
+	if ((uint32_t)(ring->rx_released - ring->rx_credited) <
+			RPMA_RING_CREDIT_THRESHOLD(ring->rx_size))
+		return 0;
+
+	return ring_write_back(ring);
+}
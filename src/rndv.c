@@ -0,0 +1,339 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv.c -- librpma rendezvous messaging implementations
+ *
+ * A message not longer than the threshold is sent eagerly straight from the source memory
+ * region. A longer message is announced with a small request-to-send (RTS) message carrying
+ * a descriptor of the source memory region. The receiver pulls the data with an RDMA read into
+ * its own memory region and notifies the sender with a zero-length FIN message posted with
+ * a fence, so it is executed only after the read is completed.
+ *
+ * The immediate data carries the type of the message and the sender's slot of the RTS.
+ */
+
+#include <arpa/inet.h>
+#include <endian.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "conn.h"
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+#include "mr.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* the maximum number of large messages in flight */
+#define RPMA_RNDV_SLOTS 64
+
+#define RPMA_RNDV_THRESHOLD_DEFAULT 4096
+
+#define RPMA_RNDV_TYPE_EAGER	1
+#define RPMA_RNDV_TYPE_RTS	2
+#define RPMA_RNDV_TYPE_FIN	3
+
+#define RPMA_RNDV_IMM(type, slot)	((uint32_t)(type) << 24 | (uint32_t)(slot))
+#define RPMA_RNDV_IMM_TYPE(imm)		((imm) >> 24)
+#define RPMA_RNDV_IMM_SLOT(imm)		((imm) & 0xFFFFFF)
+
+/*
+ * the RTS message layout:
+ * - uint32_t slot
+ * - uint32_t size of the descriptor
+ * - uint64_t offset in the source memory region
+ * - uint64_t length of the message
+ * - the descriptor of the source memory region
+ */
+#define RPMA_RNDV_RTS_HDR_SIZE (2 * sizeof(uint32_t) + 2 * sizeof(uint64_t))
+
+struct rpma_rndv_slot {
+	const void *op_context; /* the op_context of the pending rpma_rndv_send() */
+	size_t len; /* the length of the pending message */
+	bool used;
+};
+
+struct rpma_rndv {
+	struct rpma_conn *conn;
+	size_t threshold; /* the maximum length of an eager message */
+
+	char *rts; /* RTS messages (one per slot) */
+	struct rpma_mr_local *rts_mr; /* a registration of rts */
+	struct rpma_rndv_slot slots[RPMA_RNDV_SLOTS];
+};
+
+/* public librpma API */
+
+/*
+ * rpma_rndv_new -- create a new rendezvous messaging object for the connection
+ */
+int
+rpma_rndv_new(struct rpma_peer *peer, struct rpma_conn *conn, struct rpma_rndv **rndv_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || conn == NULL || rndv_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	int ret;
+
+	struct rpma_rndv *rndv = malloc(sizeof(*rndv));
+	if (rndv == NULL)
+		return RPMA_E_NOMEM;
+
+	char *rts = malloc(RPMA_RNDV_SLOTS * RPMA_RNDV_RTS_SIZE);
+	if (rts == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_rndv;
+	}
+
+	struct rpma_mr_local *rts_mr = NULL;
+	ret = rpma_mr_reg(peer, rts, RPMA_RNDV_SLOTS * RPMA_RNDV_RTS_SIZE, RPMA_MR_USAGE_SEND,
+			&rts_mr);
+	if (ret)
+		goto err_free_rts;
+
+	memset(rndv, 0, sizeof(*rndv));
+	rndv->conn = conn;
+	rndv->threshold = RPMA_RNDV_THRESHOLD_DEFAULT;
+	rndv->rts = rts;
+	rndv->rts_mr = rts_mr;
+
+	*rndv_ptr = rndv;
+
+	return 0;
+
+err_free_rts:
+	free(rts);
+
+err_free_rndv:
+	free(rndv);
+
+	return ret;
+}
+
+/*
+ * rpma_rndv_delete -- delete the rendezvous messaging object
+ */
+int
+rpma_rndv_delete(struct rpma_rndv **rndv_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (rndv_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_rndv *rndv = *rndv_ptr;
+	if (rndv == NULL)
+		return 0;
+
+	int ret = rpma_mr_dereg(&rndv->rts_mr);
+
+	free(rndv->rts);
+	free(rndv);
+	*rndv_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_rndv_set_threshold -- set the maximum length of an eager message
+ */
+int
+rpma_rndv_set_threshold(struct rpma_rndv *rndv, size_t threshold)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rndv == NULL)
+		return RPMA_E_INVAL;
+
+	rndv->threshold = threshold;
+
+	return 0;
+}
+
+/*
+ * rpma_rndv_get_threshold -- get the maximum length of an eager message
+ */
+int
+rpma_rndv_get_threshold(const struct rpma_rndv *rndv, size_t *threshold)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rndv == NULL || threshold == NULL)
+		return RPMA_E_INVAL;
+
+	*threshold = rndv->threshold;
+
+	return 0;
+}
+
+/*
+ * rpma_rndv_send -- send the message eagerly or announce it to be pulled by the receiver
+ */
+int
+rpma_rndv_send(struct rpma_rndv *rndv, const struct rpma_mr_local *src, size_t offset,
+		size_t len, int flags, const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rndv == NULL || flags == 0 || (src == NULL && (offset != 0 || len != 0)))
+		return RPMA_E_INVAL;
+
+	if (len <= rndv->threshold)
+		return rpma_send_with_imm(rndv->conn, src, offset, len, flags,
+				RPMA_RNDV_IMM(RPMA_RNDV_TYPE_EAGER, 0), op_context);
+
+	uint32_t slot;
+	for (slot = 0; slot < RPMA_RNDV_SLOTS; slot++) {
+		if (!rndv->slots[slot].used)
+			break;
+	}
+	if (slot == RPMA_RNDV_SLOTS)
+		return RPMA_E_AGAIN;
+
+	size_t desc_size;
+	int ret = rpma_mr_get_descriptor_size(src, &desc_size);
+	if (ret)
+		return ret;
+
+	if (RPMA_RNDV_RTS_HDR_SIZE + desc_size > RPMA_RNDV_RTS_SIZE) {
+		RPMA_LOG_ERROR("descriptor too big for the RTS message: %zu", desc_size);
+		return RPMA_E_NOSUPP;
+	}
+
+	char *buff = rndv->rts + slot * RPMA_RNDV_RTS_SIZE;
+
+	uint32_t slot_le = htole32(slot);
+	memcpy(buff, &slot_le, sizeof(uint32_t));
+	uint32_t desc_size_le = htole32((uint32_t)desc_size);
+	memcpy(buff + sizeof(uint32_t), &desc_size_le, sizeof(uint32_t));
+	uint64_t offset_le = htole64((uint64_t)offset);
+	memcpy(buff + 2 * sizeof(uint32_t), &offset_le, sizeof(uint64_t));
+	uint64_t len_le = htole64((uint64_t)len);
+	memcpy(buff + 2 * sizeof(uint32_t) + sizeof(uint64_t), &len_le, sizeof(uint64_t));
+
+	ret = rpma_mr_get_descriptor(src, buff + RPMA_RNDV_RTS_HDR_SIZE);
+	if (ret)
+		return ret;
+
+	/* the completion of the operation is the FIN message */
+	ret = rpma_send_with_imm(rndv->conn, rndv->rts_mr, slot * RPMA_RNDV_RTS_SIZE,
+			RPMA_RNDV_RTS_HDR_SIZE + desc_size, RPMA_F_COMPLETION_ON_ERROR,
+			RPMA_RNDV_IMM(RPMA_RNDV_TYPE_RTS, slot), NULL);
+	if (ret)
+		return ret;
+
+	rndv->slots[slot].op_context = op_context;
+	rndv->slots[slot].len = len;
+	rndv->slots[slot].used = true;
+
+	return 0;
+}
+
+/*
+ * rpma_rndv_recv -- decode the message received by the completion
+ */
+int
+rpma_rndv_recv(struct rpma_rndv *rndv, const struct ibv_wc *wc, const void *buf,
+		enum rpma_rndv_msg_type *type, size_t *len, const void **op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rndv == NULL || wc == NULL || type == NULL || len == NULL || op_context == NULL)
+		return RPMA_E_INVAL;
+
+	if (wc->opcode != IBV_WC_RECV || !(wc->wc_flags & IBV_WC_WITH_IMM))
+		return RPMA_E_INVAL;
+
+	uint32_t imm = ntohl(wc->imm_data);
+	uint32_t slot = RPMA_RNDV_IMM_SLOT(imm);
+
+	switch (RPMA_RNDV_IMM_TYPE(imm)) {
+	case RPMA_RNDV_TYPE_EAGER:
+		*type = RPMA_RNDV_EAGER;
+		*len = wc->byte_len;
+		*op_context = NULL;
+		break;
+	case RPMA_RNDV_TYPE_RTS:
+		if (buf == NULL || wc->byte_len < RPMA_RNDV_RTS_HDR_SIZE)
+			return RPMA_E_INVAL;
+		uint64_t len_le;
+		memcpy(&len_le, (char *)buf + 2 * sizeof(uint32_t) + sizeof(uint64_t),
+			sizeof(uint64_t));
+		*type = RPMA_RNDV_RTS;
+		*len = (size_t)le64toh(len_le);
+		*op_context = NULL;
+		break;
+	case RPMA_RNDV_TYPE_FIN:
+		if (slot >= RPMA_RNDV_SLOTS || !rndv->slots[slot].used) {
+			RPMA_LOG_ERROR("FIN for an unknown slot: %" PRIu32, slot);
+			return RPMA_E_INVAL;
+		}
+		*type = RPMA_RNDV_FIN;
+		*len = rndv->slots[slot].len;
+		*op_context = rndv->slots[slot].op_context;
+		rndv->slots[slot].used = false;
+		break;
+	default:
+		return RPMA_E_INVAL;
+	}
+
+	return 0;
+}
+
+/*
+ * rpma_rndv_pull -- pull the announced message and notify the sender
+ */
+int
+rpma_rndv_pull(struct rpma_rndv *rndv, const void *buf, struct rpma_mr_local *dst,
+		size_t dst_offset, const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (rndv == NULL || buf == NULL || dst == NULL)
+		return RPMA_E_INVAL;
+
+	const char *buff = buf;
+	uint32_t slot_le;
+	uint32_t desc_size_le;
+	uint64_t offset_le;
+	uint64_t len_le;
+	memcpy(&slot_le, buff, sizeof(uint32_t));
+	memcpy(&desc_size_le, buff + sizeof(uint32_t), sizeof(uint32_t));
+	memcpy(&offset_le, buff + 2 * sizeof(uint32_t), sizeof(uint64_t));
+	memcpy(&len_le, buff + 2 * sizeof(uint32_t) + sizeof(uint64_t), sizeof(uint64_t));
+
+	uint32_t slot = le32toh(slot_le);
+	size_t desc_size = le32toh(desc_size_le);
+	if (slot >= RPMA_RNDV_SLOTS || RPMA_RNDV_RTS_HDR_SIZE + desc_size > RPMA_RNDV_RTS_SIZE)
+		return RPMA_E_INVAL;
+
+	struct rpma_mr_remote *src = NULL;
+	int ret = rpma_mr_remote_from_descriptor(buff + RPMA_RNDV_RTS_HDR_SIZE, desc_size, &src);
+	if (ret)
+		return ret;
+
+	ret = rpma_read(rndv->conn, dst, dst_offset, src, (size_t)le64toh(offset_le),
+			(size_t)le64toh(len_le), RPMA_F_COMPLETION_ALWAYS, op_context);
+	/* the remote memory region is not needed after posting the read */
+	(void) rpma_mr_remote_delete(&src);
+	if (ret)
+		return ret;
+
+	/* the fence delays the FIN message until the read is completed */
+	return rpma_conn_send_with_imm_internal(rndv->conn, NULL, 0, 0, RPMA_F_COMPLETION_ON_ERROR,
+			RPMA_RNDV_IMM(RPMA_RNDV_TYPE_FIN, slot), true, NULL);
+}
@@ -12,6 +12,7 @@
 #include "debug.h"
 #include "librpma.h"
 #include "log_internal.h"
+#include "metrics.h"
 #include "peer.h"
 #include "mr.h"
 #include "srq_cfg.h"
@@ -73,6 +74,7 @@ rpma_srq_new(struct rpma_peer *peer, struct rpma_srq_cfg *cfg, struct rpma_srq *
 
 	(*srq_ptr)->ibv_srq = ibv_srq;
 	(*srq_ptr)->rcq = rcq;
+	RPMA_METRICS_ADD(RPMA_METRICS_SRQS, 1);
 
 	return 0;
 
@@ -112,6 +114,7 @@ rpma_srq_delete(struct rpma_srq **srq_ptr)
 
 	free(srq);
 	*srq_ptr = NULL;
+	RPMA_METRICS_SUB(RPMA_METRICS_SRQS, 1);
 
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 	return ret;
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stats.c -- librpma operation statistics
+ *
+ * Every connection keeps its own counters, so posting never touches a cache line shared
+ * with other connections. A peer keeps the list of the counters of its live connections
+ * and the sums of the deleted ones; a snapshot of the peer statistics adds them all up.
+ * The list is protected by a spinlock held only when a connection is created or deleted
+ * and when the snapshot is taken.
+ */
+
+#include <string.h>
+
+#include "stats.h"
+
+/*
+ * stats_list_lock -- acquire the list
+ */
+static void
+stats_list_lock(struct rpma_stats_list *list)
+{
+	while (atomic_flag_test_and_set_explicit(&list->lock, memory_order_acquire))
+		;
+}
+
+/*
+ * stats_list_unlock -- release the list
+ */
+static void
+stats_list_unlock(struct rpma_stats_list *list)
+{
+	atomic_flag_clear_explicit(&list->lock, memory_order_release);
+}
+
+/*
+ * stats_load -- load the current values of the counters
+ */
+static void
+stats_load(const struct rpma_stats *stats, uint64_t values[RPMA_STATS_NUM])
+{
+	for (int i = 0; i < RPMA_STATS_NUM; i++)
+		values[i] = atomic_load_explicit(&stats->counters[i], memory_order_relaxed);
+}
+
+/*
+ * stats_to_snapshot -- convert the values of the counters into the snapshot
+ */
+static void
+stats_to_snapshot(const uint64_t values[RPMA_STATS_NUM], struct rpma_conn_stats *snapshot)
+{
+	snapshot->reads = values[RPMA_STATS_READS];
+	snapshot->writes = values[RPMA_STATS_WRITES];
+	snapshot->atomic_writes = values[RPMA_STATS_ATOMIC_WRITES];
+	snapshot->flushes = values[RPMA_STATS_FLUSHES];
+	snapshot->sends = values[RPMA_STATS_SENDS];
+	snapshot->recvs = values[RPMA_STATS_RECVS];
+	snapshot->read_bytes = values[RPMA_STATS_READ_BYTES];
+	snapshot->write_bytes = values[RPMA_STATS_WRITE_BYTES];
+	snapshot->send_bytes = values[RPMA_STATS_SEND_BYTES];
+	snapshot->recv_bytes = values[RPMA_STATS_RECV_BYTES];
+	snapshot->post_errors = values[RPMA_STATS_POST_ERRORS];
+	snapshot->sq_full = values[RPMA_STATS_SQ_FULL];
+	snapshot->rq_full = values[RPMA_STATS_RQ_FULL];
+	snapshot->completions = values[RPMA_STATS_COMPLETIONS];
+	snapshot->completion_errors = values[RPMA_STATS_COMPLETION_ERRORS];
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_stats_init -- zero all the counters
+ */
+void
+rpma_stats_init(struct rpma_stats *stats)
+{
+	for (int i = 0; i < RPMA_STATS_NUM; i++)
+		atomic_init(&stats->counters[i], 0);
+
+	stats->prev = NULL;
+	stats->next = NULL;
+}
+
+/*
+ * rpma_stats_get -- take a snapshot of the counters
+ */
+void
+rpma_stats_get(const struct rpma_stats *stats, struct rpma_conn_stats *snapshot)
+{
+	uint64_t values[RPMA_STATS_NUM];
+
+	stats_load(stats, values);
+	stats_to_snapshot(values, snapshot);
+}
+
+/*
+ * rpma_stats_list_init -- initialize the empty list
+ */
+void
+rpma_stats_list_init(struct rpma_stats_list *list)
+{
+	atomic_flag_clear(&list->lock);
+	list->head = NULL;
+	memset(list->retired, 0, sizeof(list->retired));
+}
+
+/*
+ * rpma_stats_list_add -- add the statistics of a new connection to the list
+ */
+void
+rpma_stats_list_add(struct rpma_stats_list *list, struct rpma_stats *stats)
+{
+	stats_list_lock(list);
+
+	stats->prev = NULL;
+	stats->next = list->head;
+	if (list->head)
+		list->head->prev = stats;
+	list->head = stats;
+
+	stats_list_unlock(list);
+}
+
+/*
+ * rpma_stats_list_remove -- remove the statistics of a deleted connection from the list
+ * and add its counters to the sums of the deleted connections
+ */
+void
+rpma_stats_list_remove(struct rpma_stats_list *list, struct rpma_stats *stats)
+{
+	uint64_t values[RPMA_STATS_NUM];
+
+	stats_list_lock(list);
+
+	if (stats->prev)
+		stats->prev->next = stats->next;
+	else
+		list->head = stats->next;
+	if (stats->next)
+		stats->next->prev = stats->prev;
+	stats->prev = NULL;
+	stats->next = NULL;
+
+	stats_load(stats, values);
+	for (int i = 0; i < RPMA_STATS_NUM; i++)
+		list->retired[i] += values[i];
+
+	stats_list_unlock(list);
+}
+
+/*
+ * rpma_stats_list_get -- take a snapshot of the sums of the counters of all the connections
+ * on the list and of the deleted ones and count the connections on the list
+ */
+void
+rpma_stats_list_get(struct rpma_stats_list *list, struct rpma_conn_stats *snapshot,
+		uint64_t *live_num)
+{
+	uint64_t sums[RPMA_STATS_NUM];
+	uint64_t values[RPMA_STATS_NUM];
+	uint64_t num = 0;
+
+	stats_list_lock(list);
+
+	memcpy(sums, list->retired, sizeof(sums));
+	for (struct rpma_stats *stats = list->head; stats; stats = stats->next) {
+		stats_load(stats, values);
+		for (int i = 0; i < RPMA_STATS_NUM; i++)
+			sums[i] += values[i];
+		num++;
+	}
+
+	stats_list_unlock(list);
+
+	stats_to_snapshot(sums, snapshot);
+	if (live_num)
+		*live_num = num;
+}
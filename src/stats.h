@@ -0,0 +1,110 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stats.h -- librpma operation statistics internal definitions
+ */
+
+#ifndef LIBRPMA_STATS_H
+#define LIBRPMA_STATS_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "librpma.h"
+
+enum rpma_stats_counter {
+	RPMA_STATS_READS,
+	RPMA_STATS_WRITES,
+	RPMA_STATS_ATOMIC_WRITES,
+	RPMA_STATS_FLUSHES,
+	RPMA_STATS_SENDS,
+	RPMA_STATS_RECVS,
+	RPMA_STATS_READ_BYTES,
+	RPMA_STATS_WRITE_BYTES,
+	RPMA_STATS_SEND_BYTES,
+	RPMA_STATS_RECV_BYTES,
+	RPMA_STATS_POST_ERRORS,
+	RPMA_STATS_SQ_FULL,
+	RPMA_STATS_RQ_FULL,
+	RPMA_STATS_COMPLETIONS,
+	RPMA_STATS_COMPLETION_ERRORS,
+	RPMA_STATS_NUM
+};
+
+/*
+ * The counters of a connection. They are updated with relaxed atomic additions, so they
+ * are cheap on the data path and they can be read by any thread at any time.
+ */
+struct rpma_stats {
+	_Atomic uint64_t counters[RPMA_STATS_NUM];
+
+	/* the list of the statistics of the live connections of a peer */
+	struct rpma_stats *prev;
+	struct rpma_stats *next;
+};
+
+/* the statistics of all the connections of a peer */
+struct rpma_stats_list {
+	atomic_flag lock; /* protects the list and retired */
+	struct rpma_stats *head; /* the live connections */
+	uint64_t retired[RPMA_STATS_NUM]; /* the sums of the deleted connections */
+};
+
+#define RPMA_STATS_ADD(stats, counter, value) \
+	atomic_fetch_add_explicit(&(stats)->counters[counter], (uint64_t)(value), \
+			memory_order_relaxed)
+
+/*
+ * rpma_stats_init -- zero all the counters
+ *
+ * ASSUMPTIONS
+ * - stats != NULL
+ */
+void rpma_stats_init(struct rpma_stats *stats);
+
+/*
+ * rpma_stats_get -- take a snapshot of the counters
+ *
+ * ASSUMPTIONS
+ * - stats != NULL && snapshot != NULL
+ */
+void rpma_stats_get(const struct rpma_stats *stats, struct rpma_conn_stats *snapshot);
+
+/*
+ * rpma_stats_list_init -- initialize the empty list
+ *
+ * ASSUMPTIONS
+ * - list != NULL
+ */
+void rpma_stats_list_init(struct rpma_stats_list *list);
+
+/*
+ * rpma_stats_list_add -- add the statistics of a new connection to the list
+ *
+ * ASSUMPTIONS
+ * - list != NULL && stats != NULL
+ */
+void rpma_stats_list_add(struct rpma_stats_list *list, struct rpma_stats *stats);
+
+/*
+ * rpma_stats_list_remove -- remove the statistics of a deleted connection from the list
+ * and add its counters to the sums of the deleted connections
+ *
+ * ASSUMPTIONS
+ * - list != NULL && stats != NULL && stats is on the list
+ */
+void rpma_stats_list_remove(struct rpma_stats_list *list, struct rpma_stats *stats);
+
+/*
+ * rpma_stats_list_get -- take a snapshot of the sums of the counters of all the connections
+ * on the list and of the deleted ones and count the connections on the list
+ * (if live_num != NULL)
+ *
+ * ASSUMPTIONS
+ * - list != NULL && snapshot != NULL
+ */
+void rpma_stats_list_get(struct rpma_stats_list *list, struct rpma_conn_stats *snapshot,
+		uint64_t *live_num);
+
+#endif /* LIBRPMA_STATS_H */
@@ -0,0 +1,476 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe.c -- librpma striped connection implementation
+ *
+ * A striped connection consists of many connections to the same server. An RDMA read or write
+ * is split into chunks of a fixed size posted round-robin over the connections, so the chunks
+ * are processed by many QPs at the same time. Every chunk is posted with a completion and its
+ * wr_id points to the descriptor of the whole operation, which counts down the chunks still
+ * in flight. The operation completes when its last chunk does.
+ *
+ * The number of chunks in flight on every connection is tracked, so an operation is posted only
+ * if all of its chunks fit into the send queues at once. The descriptors of the operations are
+ * preallocated: since every operation takes at least one slot of a send queue, there can be no
+ * more operations in flight than all the send queues can hold.
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "conn_cfg.h"
+#include "debug.h"
+#include "librpma.h"
+#include "log_internal.h"
+#include "stripe.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+/* no next free operation descriptor */
+#define STRIPE_OP_NONE	UINT32_MAX
+
+struct stripe_conn {
+	struct rpma_conn *conn;
+	struct rpma_cq *cq; /* the main CQ of the connection */
+	uint32_t sq_size; /* the maximum number of chunks in flight */
+	uint32_t inflight; /* the number of chunks in flight */
+};
+
+struct stripe_op {
+	const void *op_context; /* the op_context of the operation */
+	size_t len; /* the length of the operation */
+	uint32_t chunks; /* the number of chunks in flight */
+	int flags; /* the flags of the operation */
+	enum ibv_wc_opcode opcode; /* IBV_WC_RDMA_READ or IBV_WC_RDMA_WRITE */
+	enum ibv_wc_status status; /* the status of the first failed chunk */
+	bool abandoned; /* posting the operation failed so it is not reported */
+	uint32_t next_free; /* the next free descriptor */
+};
+
+struct rpma_stripe {
+	struct stripe_conn *conns;
+	int num_conns;
+	size_t chunk_size; /* the maximum size of a chunk */
+	uint64_t capacity; /* the number of chunks all the send queues can hold */
+
+	struct stripe_op *ops; /* the descriptors of the operations */
+	uint32_t free_op; /* the first free descriptor */
+
+	int post_next; /* the connection the next operation starts at */
+	int poll_next; /* the connection whose CQ is polled next */
+};
+
+/*
+ * stripe_close -- disconnect and delete the connection
+ */
+static int
+stripe_close(struct rpma_conn **conn_ptr)
+{
+	enum rpma_conn_event event = RPMA_CONN_UNDEFINED;
+
+	int ret = rpma_conn_disconnect(*conn_ptr);
+	if (!ret)
+		ret = rpma_conn_next_event(*conn_ptr, &event);
+	if (!ret && event != RPMA_CONN_CLOSED)
+		RPMA_LOG_WARNING("unexpected event when closing the connection: %s",
+			rpma_utils_conn_event_2str(event));
+
+	int ret2 = rpma_conn_delete(conn_ptr);
+
+	return ret ? ret : ret2;
+}
+
+/*
+ * stripe_op_from_wr_id -- get the descriptor of the operation the chunk belongs to;
+ * returns NULL if the wr_id does not point to any descriptor of the striped connection
+ */
+static struct stripe_op *
+stripe_op_from_wr_id(struct rpma_stripe *stripe, uint64_t wr_id)
+{
+	uintptr_t first = (uintptr_t)stripe->ops;
+	uintptr_t end = (uintptr_t)(stripe->ops + stripe->capacity);
+
+	if (wr_id < first || wr_id >= end || (wr_id - first) % sizeof(struct stripe_op))
+		return NULL;
+
+	return (struct stripe_op *)(uintptr_t)wr_id;
+}
+
+/*
+ * stripe_op_complete -- account the completion of the chunk and report the whole operation
+ * if it was the last chunk
+ */
+static bool
+stripe_op_complete(struct rpma_stripe *stripe, struct stripe_op *op, struct ibv_wc *wc)
+{
+	if (wc->status != IBV_WC_SUCCESS && op->status == IBV_WC_SUCCESS)
+		op->status = wc->status;
+
+	if (--op->chunks > 0)
+		return false;
+
+	bool report = !op->abandoned &&
+			(op->status != IBV_WC_SUCCESS ||
+			(op->flags & RPMA_F_COMPLETION_ALWAYS) == RPMA_F_COMPLETION_ALWAYS);
+	if (report) {
+		wc->wr_id = (uint64_t)(uintptr_t)op->op_context;
+		wc->status = op->status;
+		wc->opcode = op->opcode;
+		wc->byte_len = op->len > UINT32_MAX ? UINT32_MAX : (uint32_t)op->len;
+	}
+
+	/* release the descriptor */
+	op->next_free = stripe->free_op;
+	stripe->free_op = (uint32_t)(op - stripe->ops);
+
+	return report;
+}
+
+/*
+ * stripe_post -- split the operation into chunks and post them round-robin over
+ * the connections
+ */
+static int
+stripe_post(struct rpma_stripe *stripe, enum ibv_wc_opcode opcode,
+		struct rpma_mr_local *local, size_t local_offset,
+		struct rpma_mr_remote *remote, size_t remote_offset,
+		size_t len, int flags, const void *op_context)
+{
+	uint64_t chunks = (len - 1) / stripe->chunk_size + 1;
+	if (chunks > stripe->capacity) {
+		RPMA_LOG_ERROR("the operation consists of more chunks (%" PRIu64
+			") than all the send queues can hold (%" PRIu64 ")",
+			chunks, stripe->capacity);
+		return RPMA_E_INVAL;
+	}
+
+	if (chunks > rpma_stripe_get_free_chunks(stripe) || stripe->free_op == STRIPE_OP_NONE)
+		return RPMA_E_AGAIN;
+
+	struct stripe_op *op = &stripe->ops[stripe->free_op];
+	stripe->free_op = op->next_free;
+
+	op->op_context = op_context;
+	op->len = len;
+	op->chunks = 0;
+	op->flags = flags;
+	op->opcode = opcode;
+	op->status = IBV_WC_SUCCESS;
+	op->abandoned = false;
+
+	int ret = 0;
+	int c = stripe->post_next;
+	for (size_t offset = 0; offset < len; offset += stripe->chunk_size) {
+		size_t chunk_len = len - offset;
+		if (chunk_len > stripe->chunk_size)
+			chunk_len = stripe->chunk_size;
+
+		/* the next connection with a free slot in its send queue */
+		while (stripe->conns[c].inflight == stripe->conns[c].sq_size)
+			c = (c + 1) % stripe->num_conns;
+
+		struct stripe_conn *sc = &stripe->conns[c];
+		if (opcode == IBV_WC_RDMA_READ)
+			ret = rpma_read(sc->conn, local, local_offset + offset,
+					remote, remote_offset + offset, chunk_len,
+					RPMA_F_COMPLETION_ALWAYS, op);
+		else
+			ret = rpma_write(sc->conn, remote, remote_offset + offset,
+					local, local_offset + offset, chunk_len,
+					RPMA_F_COMPLETION_ALWAYS, op);
+		if (ret)
+			break;
+
+		sc->inflight++;
+		op->chunks++;
+		c = (c + 1) % stripe->num_conns;
+	}
+
+	stripe->post_next = c;
+
+	if (ret == 0)
+		return 0;
+
+	if (op->chunks == 0) {
+		/* nothing has been posted */
+		op->next_free = stripe->free_op;
+		stripe->free_op = (uint32_t)(op - stripe->ops);
+	} else {
+		/* the chunks already posted are collected but not reported */
+		op->abandoned = true;
+	}
+
+	return ret;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_stripe_get_capacity -- get the number of chunks all the send queues can hold
+ */
+uint64_t
+rpma_stripe_get_capacity(const struct rpma_stripe *stripe)
+{
+	return stripe->capacity;
+}
+
+/*
+ * rpma_stripe_get_free_chunks -- get the number of free slots in all the send queues
+ */
+uint64_t
+rpma_stripe_get_free_chunks(const struct rpma_stripe *stripe)
+{
+	uint64_t free_slots = 0;
+	for (int i = 0; i < stripe->num_conns; i++)
+		free_slots += stripe->conns[i].sq_size - stripe->conns[i].inflight;
+
+	return free_slots;
+}
+
+/* public librpma API */
+
+/*
+ * rpma_stripe_connect -- establish the striped connection
+ */
+int
+rpma_stripe_connect(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, const struct rpma_conn_private_data *pdata,
+		int num_conns, size_t chunk_size, struct rpma_stripe **stripe_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (peer == NULL || addr == NULL || port == NULL || stripe_ptr == NULL ||
+			num_conns <= 0 || chunk_size == 0 || chunk_size > UINT32_MAX)
+		return RPMA_E_INVAL;
+
+	/* the send queues are clamped to the device limit (see rpma_peer_get_caps()) */
+	uint32_t sq_size = 0;
+	struct rpma_peer_caps caps = {0};
+	(void) rpma_conn_cfg_get_sq_size(cfg ? cfg : rpma_conn_cfg_default(), &sq_size);
+	(void) rpma_peer_get_caps(peer, &caps);
+	if (caps.max_qp_wr && sq_size > caps.max_qp_wr)
+		sq_size = caps.max_qp_wr;
+
+	uint64_t capacity = (uint64_t)sq_size * (uint64_t)num_conns;
+	if (sq_size == 0 || capacity >= STRIPE_OP_NONE)
+		return RPMA_E_INVAL;
+
+	int ret = 0;
+
+	struct rpma_stripe *stripe = malloc(sizeof(*stripe));
+	if (stripe == NULL)
+		return RPMA_E_NOMEM;
+
+	struct stripe_conn *conns = malloc((size_t)num_conns * sizeof(*conns));
+	if (conns == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_stripe;
+	}
+
+	struct stripe_op *ops = malloc((size_t)capacity * sizeof(*ops));
+	if (ops == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_conns;
+	}
+
+	struct rpma_conn_target *targets = malloc((size_t)num_conns * sizeof(*targets));
+	if (targets == NULL) {
+		ret = RPMA_E_NOMEM;
+		goto err_free_ops;
+	}
+
+	for (int i = 0; i < num_conns; i++) {
+		targets[i].addr = addr;
+		targets[i].port = port;
+		targets[i].cfg = cfg;
+		targets[i].pdata = pdata;
+		targets[i].conn = NULL;
+		targets[i].result = 0;
+	}
+
+	/* the connections established before a failure are closed below */
+	ret = rpma_conn_connect_all(peer, targets, num_conns, num_conns);
+
+	for (int i = 0; i < num_conns; i++) {
+		if (targets[i].result && ret == 0)
+			ret = targets[i].result;
+		conns[i].conn = targets[i].conn;
+		conns[i].cq = NULL;
+		conns[i].sq_size = sq_size;
+		conns[i].inflight = 0;
+		if (conns[i].conn)
+			(void) rpma_conn_get_cq(conns[i].conn, &conns[i].cq);
+	}
+	if (ret)
+		goto err_close_conns;
+
+	for (uint32_t i = 0; i < (uint32_t)capacity; i++)
+		ops[i].next_free = i + 1;
+	ops[capacity - 1].next_free = STRIPE_OP_NONE;
+
+	free(targets);
+
+	stripe->conns = conns;
+	stripe->num_conns = num_conns;
+	stripe->chunk_size = chunk_size;
+	stripe->capacity = capacity;
+	stripe->ops = ops;
+	stripe->free_op = 0;
+	stripe->post_next = 0;
+	stripe->poll_next = 0;
+
+	*stripe_ptr = stripe;
+
+	return 0;
+
+err_close_conns:
+	for (int i = 0; i < num_conns; i++) {
+		if (conns[i].conn)
+			(void) stripe_close(&conns[i].conn);
+	}
+
+	free(targets);
+
+err_free_ops:
+	free(ops);
+
+err_free_conns:
+	free(conns);
+
+err_free_stripe:
+	free(stripe);
+
+	return ret;
+}
+
+/*
+ * rpma_stripe_delete -- disconnect and delete all the connections of the striped connection
+ */
+int
+rpma_stripe_delete(struct rpma_stripe **stripe_ptr)
+{
+	RPMA_DEBUG_TRACE;
+
+	if (stripe_ptr == NULL)
+		return RPMA_E_INVAL;
+
+	struct rpma_stripe *stripe = *stripe_ptr;
+	if (stripe == NULL)
+		return 0;
+
+	int ret = 0;
+	for (int i = 0; i < stripe->num_conns; i++) {
+		int ret2 = stripe_close(&stripe->conns[i].conn);
+		if (ret2 && ret == 0)
+			ret = ret2;
+	}
+
+	free(stripe->ops);
+	free(stripe->conns);
+	free(stripe);
+	*stripe_ptr = NULL;
+
+	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	return ret;
+}
+
+/*
+ * rpma_stripe_get_conn -- get one of the connections of the striped connection
+ */
+int
+rpma_stripe_get_conn(const struct rpma_stripe *stripe, int index, struct rpma_conn **conn_ptr)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (stripe == NULL || conn_ptr == NULL || index < 0 || index >= stripe->num_conns)
+		return RPMA_E_INVAL;
+
+	*conn_ptr = stripe->conns[index].conn;
+
+	return 0;
+}
+
+/*
+ * rpma_stripe_read -- initiate the striped read operation
+ */
+int
+rpma_stripe_read(struct rpma_stripe *stripe, struct rpma_mr_local *dst, size_t dst_offset,
+		const struct rpma_mr_remote *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (stripe == NULL || dst == NULL || src == NULL || len == 0 || flags == 0)
+		return RPMA_E_INVAL;
+
+	return stripe_post(stripe, IBV_WC_RDMA_READ, dst, dst_offset,
+			(struct rpma_mr_remote *)src, src_offset, len, flags, op_context);
+}
+
+/*
+ * rpma_stripe_write -- initiate the striped write operation
+ */
+int
+rpma_stripe_write(struct rpma_stripe *stripe, struct rpma_mr_remote *dst, size_t dst_offset,
+		const struct rpma_mr_local *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (stripe == NULL || dst == NULL || src == NULL || len == 0 || flags == 0)
+		return RPMA_E_INVAL;
+
+	return stripe_post(stripe, IBV_WC_RDMA_WRITE, (struct rpma_mr_local *)src, src_offset,
+			dst, dst_offset, len, flags, op_context);
+}
+
+/*
+ * rpma_stripe_get_wc -- collect the chunk completions until a whole operation completes
+ */
+int
+rpma_stripe_get_wc(struct rpma_stripe *stripe, struct ibv_wc *wc)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (stripe == NULL || wc == NULL)
+		return RPMA_E_INVAL;
+
+	/* stop after a whole round over the CQs without any completion */
+	int idle = 0;
+	while (idle < stripe->num_conns) {
+		struct stripe_conn *sc = &stripe->conns[stripe->poll_next];
+		stripe->poll_next = (stripe->poll_next + 1) % stripe->num_conns;
+
+		int ret = rpma_cq_get_wc(sc->cq, 1, wc, NULL);
+		if (ret == RPMA_E_NO_COMPLETION) {
+			idle++;
+			continue;
+		}
+		if (ret)
+			return ret;
+
+		idle = 0;
+
+		struct stripe_op *op = stripe_op_from_wr_id(stripe, wc->wr_id);
+		if (op == NULL) {
+			RPMA_LOG_WARNING(
+				"completion of an operation not posted via the striped connection");
+			return 0;
+		}
+
+		sc->inflight--;
+		if (stripe_op_complete(stripe, op, wc))
+			return 0;
+	}
+
+	return RPMA_E_NO_COMPLETION;
+}
@@ -0,0 +1,37 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe.h -- librpma striped connection internal definitions
+ */
+
+#ifndef LIBRPMA_STRIPE_H
+#define LIBRPMA_STRIPE_H
+
+#include "librpma.h"
+
+/*
+ * rpma_stripe_get_capacity -- get the number of chunks all the send queues of the striped
+ * connection can hold
+ *
+ * ASSUMPTIONS
+ * - stripe != NULL
+ *
+ * ERRORS
+ * rpma_stripe_get_capacity() cannot fail.
+ */
+uint64_t rpma_stripe_get_capacity(const struct rpma_stripe *stripe);
+
+/*
+ * rpma_stripe_get_free_chunks -- get the number of chunks which can be posted to the striped
+ * connection right now
+ *
+ * ASSUMPTIONS
+ * - stripe != NULL
+ *
+ * ERRORS
+ * rpma_stripe_get_free_chunks() cannot fail.
+ */
+uint64_t rpma_stripe_get_free_chunks(const struct rpma_stripe *stripe);
+
+#endif /* LIBRPMA_STRIPE_H */
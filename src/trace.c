@@ -0,0 +1,682 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * trace.c -- librpma operation timeline tracing
+ *
+ * The posts, the completions and the connection events are recorded into the ring of events
+ * of the connection of a fixed size overwritten in circles (the oldest events first), so
+ * the connections do not contend with each other. The rings of all the connections (including
+ * the deleted ones) are merged when they are dumped in the Chrome trace event format (JSON)
+ * with a track per QP: a post is a complete event lasting until ibv_post_send(3)/
+ * ibv_post_recv(3) has rung the doorbell, a completion and a connection event are instant
+ * events and the queue depths are counters.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "debug.h"
+#include "log_internal.h"
+#include "trace.h"
+
+#ifdef TEST_MOCK_ALLOC
+#include "cmocka_alloc.h"
+#endif
+
+enum trace_type {
+	TRACE_POST,
+	TRACE_COMPLETION,
+	TRACE_CONN_EVENT
+};
+
+struct trace_event {
+	uint64_t ts_ns; /* CLOCK_MONOTONIC */
+	uint64_t dur_ns; /* the duration of the post */
+	uint64_t wr_id;
+	uint32_t qp_num;
+	uint32_t len;
+	/* the value returned by the post, the status of the completion or the connection event */
+	int32_t status;
+	int32_t sq_depth;
+	int32_t rq_depth;
+	int32_t errors;
+	uint32_t op; /* enum rpma_trace_op or the opcode of the completion */
+	uint8_t type; /* enum trace_type */
+	bool signaled;
+};
+
+struct trace_ring {
+	struct trace_ring *next; /* the next ring of a deleted connection */
+	size_t capacity;
+	uint64_t recorded; /* the number of the events recorded so far */
+	struct trace_event events[];
+};
+
+static atomic_bool Trace_enabled;
+
+static struct {
+	pthread_mutex_t lock; /* protects all the fields below */
+	struct rpma_trace_conn *conns; /* all the registered connections */
+	struct trace_ring *retired; /* the rings of the deleted connections */
+	size_t capacity; /* the capacity of the rings */
+} Trace = {PTHREAD_MUTEX_INITIALIZER, NULL, NULL, 0};
+
+static const char *const Trace_op_names[] = {
+	[RPMA_TRACE_READ] = "read",
+	[RPMA_TRACE_WRITE] = "write",
+	[RPMA_TRACE_ATOMIC_WRITE] = "atomic_write",
+	[RPMA_TRACE_FLUSH] = "flush",
+	[RPMA_TRACE_SEND] = "send",
+	[RPMA_TRACE_RECV] = "recv",
+};
+
+/*
+ * trace_now -- the current time in nanoseconds
+ */
+static uint64_t
+trace_now(void)
+{
+	struct timespec ts;
+	(void) clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * trace_conn_lock -- acquire the ring of the connection
+ */
+static void
+trace_conn_lock(struct rpma_trace_conn *tconn)
+{
+	while (atomic_flag_test_and_set_explicit(&tconn->lock, memory_order_acquire))
+		;
+}
+
+/*
+ * trace_conn_unlock -- release the ring of the connection
+ */
+static void
+trace_conn_unlock(struct rpma_trace_conn *tconn)
+{
+	atomic_flag_clear_explicit(&tconn->lock, memory_order_release);
+}
+
+/*
+ * trace_conn_swap_ring -- replace the ring of the connection and return the old one
+ */
+static struct trace_ring *
+trace_conn_swap_ring(struct rpma_trace_conn *tconn, struct trace_ring *ring)
+{
+	trace_conn_lock(tconn);
+	struct trace_ring *old_ring = tconn->ring;
+	tconn->ring = ring;
+	trace_conn_unlock(tconn);
+
+	return old_ring;
+}
+
+/*
+ * trace_ring_new -- allocate an empty ring of events
+ */
+static struct trace_ring *
+trace_ring_new(size_t capacity)
+{
+	struct trace_ring *ring = malloc(sizeof(*ring) + capacity * sizeof(ring->events[0]));
+	if (ring == NULL)
+		return NULL;
+
+	ring->next = NULL;
+	ring->capacity = capacity;
+	ring->recorded = 0;
+
+	return ring;
+}
+
+/*
+ * trace_ring_num -- the number of the events held by the ring
+ */
+static size_t
+trace_ring_num(const struct trace_ring *ring)
+{
+	if (ring == NULL)
+		return 0;
+
+	return ring->recorded < ring->capacity ? (size_t)ring->recorded : ring->capacity;
+}
+
+/*
+ * trace_ring_copy -- copy the events held by the ring (the oldest one first)
+ */
+static size_t
+trace_ring_copy(const struct trace_ring *ring, struct trace_event *events)
+{
+	size_t num = trace_ring_num(ring);
+	uint64_t first = num ? ring->recorded - num : 0;
+	for (size_t i = 0; i < num; i++)
+		events[i] = ring->events[(first + i) % ring->capacity];
+
+	return num;
+}
+
+/*
+ * trace_rings_free -- free the list of the rings
+ */
+static void
+trace_rings_free(struct trace_ring *ring)
+{
+	while (ring != NULL) {
+		struct trace_ring *next = ring->next;
+		free(ring);
+		ring = next;
+	}
+}
+
+/*
+ * trace_record -- store the event in the ring of the connection (the oldest one is
+ * overwritten if it is full)
+ */
+static void
+trace_record(struct rpma_trace_conn *tconn, const struct trace_event *event)
+{
+	trace_conn_lock(tconn);
+	struct trace_ring *ring = tconn->ring;
+	if (ring != NULL) {
+		ring->events[ring->recorded % ring->capacity] = *event;
+		ring->recorded++;
+	}
+	trace_conn_unlock(tconn);
+}
+
+/*
+ * trace_snapshot -- copy the events of all the connections, so posting is not held up
+ * by writing the file
+ */
+static int
+trace_snapshot(struct trace_event **events_ptr, size_t *num_ptr)
+{
+	struct trace_event *events = NULL;
+	size_t num = 0;
+	int ret = 0;
+
+	(void) pthread_mutex_lock(&Trace.lock);
+
+	/* the rings cannot be replaced nor freed while the global lock is held */
+	size_t max_num = 0;
+	for (struct rpma_trace_conn *tconn = Trace.conns; tconn != NULL; tconn = tconn->next)
+		max_num += tconn->ring ? tconn->ring->capacity : 0;
+	for (struct trace_ring *ring = Trace.retired; ring != NULL; ring = ring->next)
+		max_num += trace_ring_num(ring);
+
+	if (max_num > 0) {
+		events = malloc(max_num * sizeof(*events));
+		if (events == NULL) {
+			ret = RPMA_E_NOMEM;
+			goto unlock;
+		}
+	}
+
+	for (struct trace_ring *ring = Trace.retired; ring != NULL; ring = ring->next)
+		num += trace_ring_copy(ring, &events[num]);
+
+	for (struct rpma_trace_conn *tconn = Trace.conns; tconn != NULL; tconn = tconn->next) {
+		trace_conn_lock(tconn);
+		num += trace_ring_copy(tconn->ring, &events[num]);
+		trace_conn_unlock(tconn);
+	}
+
+	*events_ptr = events;
+	*num_ptr = num;
+
+unlock:
+	(void) pthread_mutex_unlock(&Trace.lock);
+
+	return ret;
+}
+
+/*
+ * trace_depth_dec -- decrement the queue depth unless it is 0 (the operations posted before
+ * tracing has been enabled are not counted)
+ */
+static int32_t
+trace_depth_dec(_Atomic int32_t *depth)
+{
+	int32_t value = atomic_load_explicit(depth, memory_order_relaxed);
+	while (value > 0 && !atomic_compare_exchange_weak_explicit(depth, &value, value - 1,
+			memory_order_relaxed, memory_order_relaxed))
+		;
+
+	return value > 0 ? value - 1 : 0;
+}
+
+/*
+ * trace_print_ts -- print the time in microseconds (the unit of the Chrome trace format)
+ */
+static void
+trace_print_ts(FILE *stream, const char *name, uint64_t ns)
+{
+	fprintf(stream, ",\"%s\":%" PRIu64 ".%03" PRIu64, name, ns / 1000, ns % 1000);
+}
+
+/*
+ * trace_print_event -- print the event and the queue depths after it
+ */
+static void
+trace_print_event(FILE *stream, const struct trace_event *ev, pid_t pid)
+{
+	bool depth_changed = true;
+
+	switch (ev->type) {
+	case TRACE_POST:
+		fprintf(stream, ",\n{\"name\":\"%s\",\"cat\":\"post\",\"ph\":\"X\"",
+				Trace_op_names[ev->op]);
+		trace_print_ts(stream, "ts", ev->ts_ns);
+		trace_print_ts(stream, "dur", ev->dur_ns);
+		fprintf(stream, ",\"pid\":%d,\"tid\":%" PRIu32 ",\"args\":{\"wr_id\":\"0x%" PRIx64
+				"\",\"len\":%" PRIu32 ",\"signaled\":%s,\"ret\":%" PRId32 "}}",
+				pid, ev->qp_num, ev->wr_id, ev->len,
+				ev->signaled ? "true" : "false", ev->status);
+		depth_changed = (ev->status == 0);
+		break;
+	case TRACE_COMPLETION:
+		fprintf(stream, ",\n{\"name\":\"completion\",\"cat\":\"completion\",\"ph\":\"i\","
+				"\"s\":\"t\"");
+		trace_print_ts(stream, "ts", ev->ts_ns);
+		fprintf(stream, ",\"pid\":%d,\"tid\":%" PRIu32 ",\"args\":{\"wr_id\":\"0x%" PRIx64
+				"\"", pid, ev->qp_num, ev->wr_id);
+		/* the opcode and the byte_len of an error completion are undefined */
+		if (ev->status == IBV_WC_SUCCESS)
+			fprintf(stream, ",\"opcode\":%" PRIu32 ",\"byte_len\":%" PRIu32,
+					ev->op, ev->len);
+		fprintf(stream, ",\"status\":%" PRId32 "}}", ev->status);
+		break;
+	case TRACE_CONN_EVENT:
+		fprintf(stream, ",\n{\"name\":\"%s\",\"cat\":\"cm\",\"ph\":\"i\",\"s\":\"t\"",
+				rpma_utils_conn_event_2str((enum rpma_conn_event)ev->status));
+		trace_print_ts(stream, "ts", ev->ts_ns);
+		fprintf(stream, ",\"pid\":%d,\"tid\":%" PRIu32 "}", pid, ev->qp_num);
+		depth_changed = false;
+		break;
+	default:
+		return;
+	}
+
+	if (!depth_changed)
+		return;
+
+	fprintf(stream, ",\n{\"name\":\"QP %" PRIu32 " depth\",\"ph\":\"C\"", ev->qp_num);
+	trace_print_ts(stream, "ts", ev->ts_ns + ev->dur_ns);
+	fprintf(stream, ",\"pid\":%d,\"args\":{\"sq\":%" PRId32 ",\"rq\":%" PRId32
+			",\"err\":%" PRId32 "}}", pid, ev->sq_depth, ev->rq_depth, ev->errors);
+}
+
+/*
+ * trace_qp_num_cmp -- compare the QP numbers of the events
+ */
+static int
+trace_qp_num_cmp(const void *a, const void *b)
+{
+	uint32_t qa = *(const uint32_t *)a;
+	uint32_t qb = *(const uint32_t *)b;
+
+	return (qa > qb) - (qa < qb);
+}
+
+/*
+ * trace_print_qp_names -- name the track of every QP the events have been recorded for
+ */
+static int
+trace_print_qp_names(FILE *stream, const struct trace_event *events, size_t num, pid_t pid)
+{
+	if (num == 0)
+		return 0;
+
+	uint32_t *qp_nums = malloc(num * sizeof(*qp_nums));
+	if (qp_nums == NULL)
+		return RPMA_E_NOMEM;
+
+	for (size_t i = 0; i < num; i++)
+		qp_nums[i] = events[i].qp_num;
+	qsort(qp_nums, num, sizeof(*qp_nums), trace_qp_num_cmp);
+
+	for (size_t i = 0; i < num; i++) {
+		if (i > 0 && qp_nums[i] == qp_nums[i - 1])
+			continue;
+		fprintf(stream, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+				"\"tid\":%" PRIu32 ",\"args\":{\"name\":\"QP %" PRIu32 "\"}}",
+				pid, qp_nums[i], qp_nums[i]);
+	}
+
+	free(qp_nums);
+
+	return 0;
+}
+
+/* internal librpma API */
+
+/*
+ * rpma_trace_conn_init -- initialize the tracing state of a connection and register it
+ */
+void
+rpma_trace_conn_init(struct rpma_trace_conn *tconn)
+{
+	atomic_init(&tconn->sq_depth, 0);
+	atomic_init(&tconn->rq_depth, 0);
+	atomic_init(&tconn->errors, 0);
+	atomic_flag_clear(&tconn->lock);
+	tconn->ring = NULL;
+	tconn->prev = NULL;
+
+	(void) pthread_mutex_lock(&Trace.lock);
+
+	if (atomic_load_explicit(&Trace_enabled, memory_order_relaxed)) {
+		tconn->ring = trace_ring_new(Trace.capacity);
+		if (tconn->ring == NULL)
+			RPMA_LOG_WARNING("the events of the connection will not be recorded");
+	}
+
+	tconn->next = Trace.conns;
+	if (Trace.conns)
+		Trace.conns->prev = tconn;
+	Trace.conns = tconn;
+
+	(void) pthread_mutex_unlock(&Trace.lock);
+}
+
+/*
+ * rpma_trace_conn_fini -- unregister the connection and keep its events
+ */
+void
+rpma_trace_conn_fini(struct rpma_trace_conn *tconn)
+{
+	(void) pthread_mutex_lock(&Trace.lock);
+
+	if (tconn->prev)
+		tconn->prev->next = tconn->next;
+	else
+		Trace.conns = tconn->next;
+	if (tconn->next)
+		tconn->next->prev = tconn->prev;
+	tconn->prev = NULL;
+	tconn->next = NULL;
+
+	struct trace_ring *ring = trace_conn_swap_ring(tconn, NULL);
+	if (ring && ring->recorded > 0) {
+		ring->next = Trace.retired;
+		Trace.retired = ring;
+	} else {
+		free(ring);
+	}
+
+	(void) pthread_mutex_unlock(&Trace.lock);
+}
+
+/*
+ * rpma_trace_post_begin -- start tracing the operation being posted if tracing is enabled
+ */
+uint64_t
+rpma_trace_post_begin(void)
+{
+	if (!atomic_load_explicit(&Trace_enabled, memory_order_relaxed))
+		return 0;
+
+	return trace_now();
+}
+
+/*
+ * rpma_trace_post_end -- record the post of the operation and update the queue depth
+ * if it has succeeded
+ */
+void
+rpma_trace_post_end(struct rpma_trace_conn *tconn, const struct ibv_qp *qp,
+		enum rpma_trace_op op, const void *op_context, size_t len, int flags, int ret,
+		uint64_t begin_ns)
+{
+	struct trace_event event = {0};
+	event.type = TRACE_POST;
+	event.ts_ns = begin_ns;
+	event.dur_ns = trace_now() - begin_ns;
+	event.wr_id = (uint64_t)(uintptr_t)op_context;
+	event.qp_num = qp->qp_num;
+	event.len = (uint32_t)len;
+	event.status = ret;
+	event.op = op;
+	event.signaled = (op == RPMA_TRACE_RECV) ||
+		((flags & RPMA_F_COMPLETION_ALWAYS) == RPMA_F_COMPLETION_ALWAYS);
+
+	if (ret == 0 && op == RPMA_TRACE_RECV)
+		atomic_fetch_add_explicit(&tconn->rq_depth, 1, memory_order_relaxed);
+	else if (ret == 0 && event.signaled)
+		atomic_fetch_add_explicit(&tconn->sq_depth, 1, memory_order_relaxed);
+
+	event.sq_depth = atomic_load_explicit(&tconn->sq_depth, memory_order_relaxed);
+	event.rq_depth = atomic_load_explicit(&tconn->rq_depth, memory_order_relaxed);
+	event.errors = atomic_load_explicit(&tconn->errors, memory_order_relaxed);
+
+	trace_record(tconn, &event);
+}
+
+/*
+ * rpma_trace_complete -- record the completions and update the queue depths
+ */
+void
+rpma_trace_complete(struct rpma_trace_conn *tconn, const struct ibv_wc *wc, int num)
+{
+	if (!atomic_load_explicit(&Trace_enabled, memory_order_relaxed))
+		return;
+
+	uint64_t now = trace_now();
+
+	for (int i = 0; i < num; i++) {
+		struct trace_event event = {0};
+		event.type = TRACE_COMPLETION;
+		event.ts_ns = now;
+		event.wr_id = wc[i].wr_id;
+		event.qp_num = wc[i].qp_num;
+		event.len = wc[i].byte_len;
+		event.status = (int32_t)wc[i].status;
+		event.op = (uint32_t)wc[i].opcode;
+
+		/*
+		 * the opcode of an error completion is undefined so it cannot be told
+		 * which queue it comes from
+		 */
+		if (wc[i].status != IBV_WC_SUCCESS) {
+			event.errors = atomic_fetch_add_explicit(&tconn->errors, 1,
+					memory_order_relaxed) + 1;
+			event.sq_depth = atomic_load_explicit(&tconn->sq_depth,
+					memory_order_relaxed);
+			event.rq_depth = atomic_load_explicit(&tconn->rq_depth,
+					memory_order_relaxed);
+		} else if (wc[i].opcode & IBV_WC_RECV) {
+			event.rq_depth = trace_depth_dec(&tconn->rq_depth);
+			event.sq_depth = atomic_load_explicit(&tconn->sq_depth,
+					memory_order_relaxed);
+			event.errors = atomic_load_explicit(&tconn->errors, memory_order_relaxed);
+		} else {
+			event.sq_depth = trace_depth_dec(&tconn->sq_depth);
+			event.rq_depth = atomic_load_explicit(&tconn->rq_depth,
+					memory_order_relaxed);
+			event.errors = atomic_load_explicit(&tconn->errors, memory_order_relaxed);
+		}
+
+		trace_record(tconn, &event);
+	}
+}
+
+/*
+ * rpma_trace_conn_event -- record the connection event
+ */
+void
+rpma_trace_conn_event(struct rpma_trace_conn *tconn, const struct ibv_qp *qp,
+		enum rpma_conn_event event)
+{
+	if (!atomic_load_explicit(&Trace_enabled, memory_order_relaxed))
+		return;
+
+	struct trace_event ev = {0};
+	ev.type = TRACE_CONN_EVENT;
+	ev.ts_ns = trace_now();
+	ev.qp_num = qp ? qp->qp_num : 0;
+	ev.status = (int32_t)event;
+	ev.sq_depth = atomic_load_explicit(&tconn->sq_depth, memory_order_relaxed);
+	ev.rq_depth = atomic_load_explicit(&tconn->rq_depth, memory_order_relaxed);
+	ev.errors = atomic_load_explicit(&tconn->errors, memory_order_relaxed);
+
+	trace_record(tconn, &ev);
+}
+
+/*
+ * rpma_trace_fini -- disable tracing and free the recorded events
+ */
+void
+rpma_trace_fini(void)
+{
+	atomic_store_explicit(&Trace_enabled, false, memory_order_relaxed);
+
+	(void) pthread_mutex_lock(&Trace.lock);
+
+	for (struct rpma_trace_conn *tconn = Trace.conns; tconn != NULL; tconn = tconn->next)
+		free(trace_conn_swap_ring(tconn, NULL));
+
+	trace_rings_free(Trace.retired);
+	Trace.retired = NULL;
+	Trace.capacity = 0;
+
+	(void) pthread_mutex_unlock(&Trace.lock);
+}
+
+/* public librpma API */
+
+/*
+ * rpma_trace_enable -- start recording the timelines of the operations
+ */
+int
+rpma_trace_enable(size_t max_events)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_NOMEM, {});
+
+	if (max_events == 0 ||
+			max_events > (SIZE_MAX - sizeof(struct trace_ring)) /
+				sizeof(struct trace_event))
+		return RPMA_E_INVAL;
+
+	int ret = 0;
+
+	(void) pthread_mutex_lock(&Trace.lock);
+
+	/* allocate all the new rings first, so the events are dropped only on success */
+	struct trace_ring *rings = NULL;
+	for (struct rpma_trace_conn *tconn = Trace.conns; tconn != NULL; tconn = tconn->next) {
+		struct trace_ring *ring = trace_ring_new(max_events);
+		if (ring == NULL) {
+			trace_rings_free(rings);
+			ret = RPMA_E_NOMEM;
+			goto unlock;
+		}
+		ring->next = rings;
+		rings = ring;
+	}
+
+	for (struct rpma_trace_conn *tconn = Trace.conns; tconn != NULL; tconn = tconn->next) {
+		struct trace_ring *ring = rings;
+		rings = ring->next;
+		ring->next = NULL;
+		free(trace_conn_swap_ring(tconn, ring));
+	}
+
+	trace_rings_free(Trace.retired);
+	Trace.retired = NULL;
+	Trace.capacity = max_events;
+
+	atomic_store_explicit(&Trace_enabled, true, memory_order_relaxed);
+
+unlock:
+	(void) pthread_mutex_unlock(&Trace.lock);
+
+	return ret;
+}
+
+/*
+ * rpma_trace_disable -- stop recording the timelines of the operations
+ */
+int
+rpma_trace_disable(void)
+{
+	RPMA_DEBUG_TRACE;
+
+	atomic_store_explicit(&Trace_enabled, false, memory_order_relaxed);
+
+	return 0;
+}
+
+/*
+ * rpma_trace_dump -- write the recorded events to the file in the Chrome trace event format
+ */
+int
+rpma_trace_dump(const char *path)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_UNKNOWN, {});
+
+	if (path == NULL)
+		return RPMA_E_INVAL;
+
+	struct trace_event *events = NULL;
+	size_t num = 0;
+	int ret = trace_snapshot(&events, &num);
+	if (ret)
+		return ret;
+
+	FILE *stream = fopen(path, "w");
+	if (stream == NULL) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "fopen(%s)", path);
+		ret = RPMA_E_UNKNOWN;
+		goto err_free_events;
+	}
+
+	pid_t pid = getpid();
+	fprintf(stream, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+			"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+			"\"args\":{\"name\":\"librpma\"}}", pid);
+
+	ret = trace_print_qp_names(stream, events, num, pid);
+	if (ret)
+		goto err_fclose;
+
+	for (size_t i = 0; i < num; i++)
+		trace_print_event(stream, &events[i], pid);
+
+	fprintf(stream, "\n]}\n");
+
+	if (ferror(stream)) {
+		RPMA_LOG_ERROR("writing %s failed", path);
+		ret = RPMA_E_UNKNOWN;
+		goto err_fclose;
+	}
+
+	if (fclose(stream)) {
+		RPMA_LOG_ERROR_WITH_ERRNO(errno, "fclose(%s)", path);
+		ret = RPMA_E_UNKNOWN;
+		goto err_free_events;
+	}
+
+	free(events);
+
+	return 0;
+
+err_fclose:
+	(void) fclose(stream);
+
+err_free_events:
+	free(events);
+
+	return ret;
+}
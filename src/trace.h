@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * trace.h -- librpma operation timeline tracing internal definitions
+ */
+
+#ifndef LIBRPMA_TRACE_H
+#define LIBRPMA_TRACE_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "librpma.h"
+
+enum rpma_trace_op {
+	RPMA_TRACE_READ,
+	RPMA_TRACE_WRITE,
+	RPMA_TRACE_ATOMIC_WRITE,
+	RPMA_TRACE_FLUSH,
+	RPMA_TRACE_SEND,
+	RPMA_TRACE_RECV
+};
+
+struct trace_ring;
+
+/*
+ * The tracing state of a connection: the queue depths - the operations posted with
+ * RPMA_F_COMPLETION_ALWAYS (the send queue) and the receives (the receive queue) whose
+ * successful completions have not been obtained yet, the number of the error completions
+ * (which cannot be assigned to any of the queues) and the ring of the events of the connection.
+ * Only the operations posted while tracing are counted.
+ */
+struct rpma_trace_conn {
+	_Atomic int32_t sq_depth;
+	_Atomic int32_t rq_depth;
+	_Atomic int32_t errors;
+
+	atomic_flag lock; /* protects the ring */
+	struct trace_ring *ring; /* NULL if the events are not recorded */
+
+	/* the list of all the traced connections (protected by the global lock) */
+	struct rpma_trace_conn *prev;
+	struct rpma_trace_conn *next;
+};
+
+/*
+ * rpma_trace_conn_init -- initialize the tracing state of a connection and register it,
+ * so its events are recorded while tracing is enabled
+ *
+ * ASSUMPTIONS
+ * - tconn != NULL
+ */
+void rpma_trace_conn_init(struct rpma_trace_conn *tconn);
+
+/*
+ * rpma_trace_conn_fini -- unregister the connection; its events are kept until tracing
+ * is enabled again or the library is unloaded
+ *
+ * ASSUMPTIONS
+ * - tconn != NULL && rpma_trace_conn_init(tconn) has been called
+ */
+void rpma_trace_conn_fini(struct rpma_trace_conn *tconn);
+
+/*
+ * rpma_trace_post_begin -- start tracing the operation being posted if tracing is enabled
+ *
+ * RETURN VALUE
+ * The time of the beginning of the post or 0 if the operation is not traced.
+ */
+uint64_t rpma_trace_post_begin(void);
+
+/*
+ * rpma_trace_post_end -- record the post of the operation (ended by ringing the doorbell
+ * in ibv_post_send(3)/ibv_post_recv(3)) and update the queue depth if it has succeeded
+ *
+ * ASSUMPTIONS
+ * - tconn != NULL && qp != NULL && rpma_trace_post_begin() has returned begin_ns != 0
+ */
+void rpma_trace_post_end(struct rpma_trace_conn *tconn, const struct ibv_qp *qp,
+		enum rpma_trace_op op, const void *op_context, size_t len, int flags, int ret,
+		uint64_t begin_ns);
+
+/*
+ * rpma_trace_complete -- record the completions and update the queue depths
+ *
+ * ASSUMPTIONS
+ * - tconn != NULL && (wc != NULL || num == 0)
+ */
+void rpma_trace_complete(struct rpma_trace_conn *tconn, const struct ibv_wc *wc, int num);
+
+/*
+ * rpma_trace_conn_event -- record the connection event
+ *
+ * ASSUMPTIONS
+ * - tconn != NULL
+ */
+void rpma_trace_conn_event(struct rpma_trace_conn *tconn, const struct ibv_qp *qp,
+		enum rpma_conn_event event);
+
+/*
+ * rpma_trace_fini -- disable tracing and free the recorded events
+ */
+void rpma_trace_fini(void);
+
+#endif /* LIBRPMA_TRACE_H */
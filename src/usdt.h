@@ -0,0 +1,42 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * usdt.h -- librpma USDT (User Statically-Defined Tracing) probes
+ *
+ * The probes of the "rpma" provider are compiled in if <sys/sdt.h> is available at build time
+ * (USDT_SUPPORTED). A probe is a single nop instruction until a tracer (e.g. bpftrace(8),
+ * perf(1) or stap(1)) attaches to it, so the arguments should be the values already at hand.
+ * Otherwise the probes are compiled out and their arguments are not evaluated at all.
+ */
+
+#ifndef LIBRPMA_USDT_H
+#define LIBRPMA_USDT_H
+
+#ifdef USDT_SUPPORTED
+
+#include <sys/sdt.h>
+
+#define RPMA_USDT1(name, a1) \
+	DTRACE_PROBE1(rpma, name, a1)
+#define RPMA_USDT2(name, a1, a2) \
+	DTRACE_PROBE2(rpma, name, a1, a2)
+#define RPMA_USDT3(name, a1, a2, a3) \
+	DTRACE_PROBE3(rpma, name, a1, a2, a3)
+#define RPMA_USDT4(name, a1, a2, a3, a4) \
+	DTRACE_PROBE4(rpma, name, a1, a2, a3, a4)
+
+#else
+
+#define RPMA_USDT1(name, a1) \
+	do { } while (0)
+#define RPMA_USDT2(name, a1, a2) \
+	do { } while (0)
+#define RPMA_USDT3(name, a1, a2, a3) \
+	do { } while (0)
+#define RPMA_USDT4(name, a1, a2, a3, a4) \
+	do { } while (0)
+
+#endif /* USDT_SUPPORTED */
+
+#endif /* LIBRPMA_USDT_H */
@@ -6,60 +6,47 @@
  * utils.c -- generic helper functions for librpma
  */
 
+#include <string.h>
 #include <rdma/rdma_cma.h>
 
 #include "librpma.h"
+#include "addr_cache.h"
 #include "debug.h"
 #include "log_internal.h"
 #include "info.h"
 #include "utils.h"
 
-/* internal librpma API */
-
+#ifdef ON_DEMAND_PAGING_SUPPORTED
 /*
- * rpma_utils_ibv_context_is_atomic_write_capable -- query the extended device
- * context's capabilities and check if kernel supports native atomic write.
+ * utils_attr_is_odp_capable -- check whether On-Demand Paging is supported for all required
+ * types of operations
  */
-int
-rpma_utils_ibv_context_is_atomic_write_capable(struct ibv_context *ibv_ctx,
-		int *is_atomic_write_capable)
+static int
+utils_attr_is_odp_capable(const struct ibv_device_attr_ex *attr)
 {
-	RPMA_DEBUG_TRACE;
-	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
+	const struct ibv_odp_caps *odp_caps = &attr->odp_caps;
+	if (!(odp_caps->general_caps & IBV_ODP_SUPPORT))
+		return 0;
 
-	*is_atomic_write_capable = 0;
-
-#ifdef NATIVE_ATOMIC_WRITE_SUPPORTED
-	/* query an RDMA device's attributes */
-	struct ibv_device_attr_ex attr = {{{0}}};
-	errno = ibv_query_device_ex(ibv_ctx, NULL /* input */, &attr);
-	if (errno) {
-		RPMA_LOG_ERROR_WITH_ERRNO(errno, "ibv_query_device_ex(attr={0})");
-		return RPMA_E_PROVIDER;
-	}
+	/* flags for the Reliable Connected transport type */
+	uint32_t rc_odp_caps = odp_caps->per_transport_caps.rc_odp_caps;
 
-	/* check whether native atomic write is supported in kernel */
-	if (attr.device_cap_flags_ex & IB_UVERBS_DEVICE_ATOMIC_WRITE)
-		*is_atomic_write_capable = 1;
-#endif
-	return 0;
+	return (rc_odp_caps & IBV_ODP_SUPPORT_WRITE) && (rc_odp_caps & IBV_ODP_SUPPORT_READ);
 }
+#endif
+
+/* internal librpma API */
 
 /*
- * rpma_utils_ibv_context_is_flush_capable -- query the extended device
- * context's capabilities and check if kernel supports both of native flush
- * types (Global visibility and Persistence).
+ * rpma_utils_ibv_context_query_caps -- query the extended device context's attributes once
+ * and take the snapshot of the device capabilities
  */
 int
-rpma_utils_ibv_context_is_flush_capable(struct ibv_context *ibv_ctx,
-		int *is_flush_capable)
+rpma_utils_ibv_context_query_caps(struct ibv_context *ibv_ctx, struct rpma_peer_caps *caps)
 {
 	RPMA_DEBUG_TRACE;
 	RPMA_FAULT_INJECTION(RPMA_E_PROVIDER, {});
 
-	*is_flush_capable = 0;
-
-#ifdef NATIVE_FLUSH_SUPPORTED
 	/* query an RDMA device's attributes */
 	struct ibv_device_attr_ex attr = {{{0}}};
 	errno = ibv_query_device_ex(ibv_ctx, NULL /* input */, &attr);
@@ -68,11 +55,30 @@ rpma_utils_ibv_context_is_flush_capable(struct ibv_context *ibv_ctx,
 		return RPMA_E_PROVIDER;
 	}
 
+	memset(caps, 0, sizeof(*caps));
+	caps->max_qp_wr = (uint32_t)attr.orig_attr.max_qp_wr;
+	caps->max_sge = (uint32_t)attr.orig_attr.max_sge;
+	caps->max_cqe = attr.orig_attr.max_cqe;
+	caps->max_srq_wr = (uint32_t)attr.orig_attr.max_srq_wr;
+	caps->is_atomic_supported = (attr.orig_attr.atomic_cap != IBV_ATOMIC_NONE);
+
+#ifdef NATIVE_ATOMIC_WRITE_SUPPORTED
+	/* check whether native atomic write is supported in kernel */
+	if (attr.device_cap_flags_ex & IB_UVERBS_DEVICE_ATOMIC_WRITE)
+		caps->is_native_atomic_write_supported = 1;
+#endif
+
+#ifdef NATIVE_FLUSH_SUPPORTED
 	/* check whether both global visibility and persistence are supported in kernel */
 	if ((attr.device_cap_flags_ex & IB_UVERBS_DEVICE_FLUSH_GLOBAL) &&
 			(attr.device_cap_flags_ex & IB_UVERBS_DEVICE_FLUSH_PERSISTENT))
-		*is_flush_capable = 1;
+		caps->is_native_flush_supported = 1;
 #endif
+
+#ifdef ON_DEMAND_PAGING_SUPPORTED
+	caps->is_odp_supported = utils_attr_is_odp_capable(&attr);
+#endif
+
 	return 0;
 }
 
@@ -103,6 +109,9 @@ rpma_utils_get_ibv_context(const char *addr, enum rpma_util_ibv_context_type typ
 		return RPMA_E_INVAL;
 	}
 
+	if (rpma_addr_cache_lookup_ibv_context(addr, side, ibv_ctx_ptr))
+		return 0;
+
 	struct rpma_info *info;
 	int ret = rpma_info_new(addr, NULL /* port */, side, &info);
 	if (ret)
@@ -130,6 +139,7 @@ rpma_utils_get_ibv_context(const char *addr, enum rpma_util_ibv_context_type typ
 
 	/* obtain the device */
 	*ibv_ctx_ptr = temp_id->verbs;
+	rpma_addr_cache_insert_ibv_context(addr, side, temp_id->verbs);
 
 err_destroy_id:
 	(void) rdma_destroy_id(temp_id);
@@ -139,6 +149,37 @@ err_info_delete:
 	return ret;
 }
 
+/*
+ * rpma_utils_addr_cache_set_ttl -- set the time the resolved addresses and devices are cached
+ */
+int
+rpma_utils_addr_cache_set_ttl(int ttl_ms)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	if (ttl_ms < 0)
+		return RPMA_E_INVAL;
+
+	rpma_addr_cache_set_ttl(ttl_ms);
+
+	return 0;
+}
+
+/*
+ * rpma_utils_addr_cache_invalidate -- drop the cached entries of the removed device
+ */
+int
+rpma_utils_addr_cache_invalidate(struct ibv_context *ibv_ctx)
+{
+	RPMA_DEBUG_TRACE;
+	RPMA_FAULT_INJECTION(RPMA_E_INVAL, {});
+
+	rpma_addr_cache_invalidate(ibv_ctx);
+
+	return 0;
+}
+
 /*
  * rpma_utils_ibv_context_is_odp_capable -- query the extended device context's capabilities and
  * check if it supports On-Demand Paging
@@ -163,18 +204,7 @@ rpma_utils_ibv_context_is_odp_capable(struct ibv_context *ibv_ctx, int *is_odp_c
 		return RPMA_E_PROVIDER;
 	}
 
-	/*
-	 * Check whether On-Demand Paging is supported for all required types of operations.
-	 */
-	struct ibv_odp_caps *odp_caps = &attr.odp_caps;
-	if (odp_caps->general_caps & IBV_ODP_SUPPORT) {
-		/* flags for the Reliable Connected transport type */
-		uint32_t rc_odp_caps = odp_caps->per_transport_caps.rc_odp_caps;
-		if ((rc_odp_caps & IBV_ODP_SUPPORT_WRITE) &&
-				(rc_odp_caps & IBV_ODP_SUPPORT_READ)) {
-			*is_odp_capable = 1;
-		}
-	}
+	*is_odp_capable = utils_attr_is_odp_capable(&attr);
 #endif
 	return 0;
 }
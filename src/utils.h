@@ -12,25 +12,13 @@
 
 /*
  * ERRORS
- * rpma_utils_ibv_context_is_atomic_write_capable() can fail with the following error:
+ * rpma_utils_ibv_context_query_caps() can fail with the following error:
  *
  * - RPMA_E_PROVIDER - ibv_query_device_ex() failed
  *
  * ASSUMPTIONS
- * ibv_ctx != NULL && is_atomic_write_capable != NULL
+ * ibv_ctx != NULL && caps != NULL
  */
-int rpma_utils_ibv_context_is_atomic_write_capable(struct ibv_context *ibv_ctx,
-		int *is_atomic_write_capable);
-
-/*
- * ERRORS
- * rpma_utils_ibv_context_is_flush_capable() can fail with the following error:
- *
- * - RPMA_E_PROVIDER - ibv_query_device_ex() failed
- *
- * ASSUMPTIONS
- * ibv_ctx != NULL && is_flush_capable != NULL
- */
-int rpma_utils_ibv_context_is_flush_capable(struct ibv_context *ibv_ctx, int *is_flush_capable);
+int rpma_utils_ibv_context_query_caps(struct ibv_context *ibv_ctx, struct rpma_peer_caps *caps);
 
 #endif /* LIBRPMA_UTILS_H */
@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * addr_cache-addrinfo.c -- the addr_cache unit tests of the resolved addresses
+ *
+ * APIs covered:
+ * - rpma_addr_cache_set_ttl()
+ * - rpma_addr_cache_lookup_addrinfo()
+ * - rpma_addr_cache_insert_addrinfo()
+ * - rpma_addr_cache_release()
+ * - rpma_addr_cache_invalidate()
+ */
+
+#include <stdio.h>
+
+#include "cmocka_headers.h"
+#include "addr_cache-common.h"
+#include "mocks-rdma_cm.h"
+
+/*
+ * insert__disabled -- nothing is cached if the cache is disabled
+ */
+static void
+insert__disabled(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+
+	/* run test */
+	bool cached = rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &rai, &ref);
+	struct rdma_addrinfo *found = rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS,
+			MOCK_PORT, RPMA_INFO_ACTIVE, &ref);
+
+	/* verify the results */
+	assert_false(cached);
+	assert_null(found);
+	assert_null(ref);
+}
+
+/*
+ * insert__malloc_ERRNO -- the address is not cached if malloc() fails
+ */
+static void
+insert__malloc_ERRNO(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+
+	for (int i = 0; i < 2; i++) {
+		/* configure mocks */
+		if (i == 1)
+			will_return(__wrap__test_malloc, MOCK_OK);
+		will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+		/* run test */
+		struct rpma_addr_cache_ref *ref = NULL;
+		bool cached = rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+				RPMA_INFO_ACTIVE, &rai, &ref);
+
+		/* verify the results */
+		assert_false(cached);
+		assert_null(ref);
+		assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+				RPMA_INFO_ACTIVE, &ref));
+	}
+}
+
+/*
+ * lifecycle__shared -- the cached address is shared until its last holder releases it
+ */
+static void
+lifecycle__shared(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+	struct rpma_addr_cache_ref *ref2 = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+
+	/* run test */
+	bool cached = rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &rai, &ref);
+	struct rdma_addrinfo *found = rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS,
+			MOCK_PORT, RPMA_INFO_ACTIVE, &ref2);
+
+	/* verify the results */
+	assert_true(cached);
+	assert_non_null(ref);
+	assert_ptr_equal(found, &rai);
+	assert_ptr_equal(ref2, ref);
+
+	/* the cache still holds the address */
+	rpma_addr_cache_release(&ref);
+	rpma_addr_cache_release(&ref2);
+	assert_null(ref);
+	assert_null(ref2);
+
+	/* configure mocks */
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* the last holder releases the address */
+	rpma_addr_cache_invalidate(NULL);
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &ref));
+}
+
+/*
+ * lookup__key_mismatch -- the address cached for another port, side or addr is not found
+ */
+static void
+lookup__key_mismatch(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+
+	/* run test */
+	assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &rai, &ref));
+
+	/* verify the results */
+	struct rpma_addr_cache_ref *ref2 = NULL;
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT_2,
+			RPMA_INFO_ACTIVE, &ref2));
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, NULL,
+			RPMA_INFO_ACTIVE, &ref2));
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_PASSIVE, &ref2));
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS_2, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &ref2));
+	assert_null(ref2);
+
+	/* configure mocks */
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* cleanup */
+	rpma_addr_cache_invalidate(NULL);
+	rpma_addr_cache_release(&ref);
+}
+
+/*
+ * lookup__expired -- the address is not found after its TTL passed
+ */
+static void
+lookup__expired(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+
+	/* run test */
+	assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &rai, &ref));
+	rpma_addr_cache_release(&ref);
+
+	time_advance_ms(MOCK_TTL_MS - 1);
+	struct rdma_addrinfo *found = rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS,
+			MOCK_PORT, RPMA_INFO_ACTIVE, &ref);
+	assert_ptr_equal(found, &rai);
+	rpma_addr_cache_release(&ref);
+
+	time_advance_ms(1);
+	found = rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT, RPMA_INFO_ACTIVE,
+			&ref);
+
+	/* verify the results */
+	assert_null(found);
+	assert_null(ref);
+
+	/* configure mocks */
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* cleanup */
+	rpma_addr_cache_invalidate(NULL);
+}
+
+/*
+ * insert__replace -- the address cached again replaces the previous one
+ */
+static void
+insert__replace(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rdma_addrinfo rai2 = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+	struct rpma_addr_cache_ref *ref2 = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* run test */
+	assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_PASSIVE, &rai, &ref));
+	rpma_addr_cache_release(&ref);
+	assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_PASSIVE, &rai2, &ref2));
+	rpma_addr_cache_release(&ref2);
+
+	/* verify the results */
+	struct rdma_addrinfo *found = rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS,
+			MOCK_PORT, RPMA_INFO_PASSIVE, &ref);
+	assert_ptr_equal(found, &rai2);
+	rpma_addr_cache_release(&ref);
+
+	/* configure mocks */
+	struct rdma_addrinfo_args args2 = {MOCK_VALIDATE, &rai2};
+	will_return(rdma_freeaddrinfo, &args2);
+
+	/* cleanup */
+	rpma_addr_cache_invalidate(NULL);
+}
+
+/*
+ * insert__full -- the entry expiring first is replaced when the cache is full
+ */
+static void
+insert__full(void **unused)
+{
+	struct rdma_addrinfo rais[ADDR_CACHE_SIZE + 1];
+	char ports[ADDR_CACHE_SIZE + 1][8];
+	struct rpma_addr_cache_ref *ref = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2 * (ADDR_CACHE_SIZE + 1));
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rais[0]};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* run test */
+	for (int i = 0; i <= ADDR_CACHE_SIZE; i++) {
+		snprintf(ports[i], sizeof(ports[i]), "%d", i);
+		assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, ports[i],
+				RPMA_INFO_ACTIVE, &rais[i], &ref));
+		rpma_addr_cache_release(&ref);
+		time_advance_ms(1);
+	}
+
+	/* verify the results */
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, ports[0],
+			RPMA_INFO_ACTIVE, &ref));
+	for (int i = 1; i <= ADDR_CACHE_SIZE; i++) {
+		assert_ptr_equal(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, ports[i],
+				RPMA_INFO_ACTIVE, &ref), &rais[i]);
+		rpma_addr_cache_release(&ref);
+	}
+
+	/* configure mocks */
+	struct rdma_addrinfo_args args_all = {MOCK_PASSTHROUGH, NULL};
+	will_return_count(rdma_freeaddrinfo, &args_all, ADDR_CACHE_SIZE);
+
+	/* cleanup */
+	rpma_addr_cache_invalidate(NULL);
+}
+
+/*
+ * set_ttl__zero -- disabling the cache drops the cached addresses
+ */
+static void
+set_ttl__zero(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+
+	/* run test */
+	assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &rai, &ref));
+	rpma_addr_cache_set_ttl(0);
+
+	/* verify the results */
+	struct rpma_addr_cache_ref *ref2 = NULL;
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT,
+			RPMA_INFO_ACTIVE, &ref2));
+
+	/* configure mocks */
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* the address stays valid until its holder releases it */
+	rpma_addr_cache_release(&ref);
+	assert_null(ref);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(insert__disabled),
+		cmocka_unit_test_setup_teardown(insert__malloc_ERRNO,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(lifecycle__shared,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(lookup__key_mismatch,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(lookup__expired,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(insert__replace,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(insert__full,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(set_ttl__zero,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * addr_cache-common.c -- the addr_cache unit tests common functions
+ */
+
+#include <time.h>
+
+#include "cmocka_headers.h"
+#include "addr_cache-common.h"
+
+#define NSEC_IN_MSEC	1000000
+#define NSEC_IN_SEC	1000000000
+
+/* the current CLOCK_MONOTONIC time */
+static struct timespec Mock_monotonic = {1, 0};
+
+/*
+ * __wrap_clock_gettime -- clock_gettime() mock returning Mock_monotonic
+ */
+int
+__wrap_clock_gettime(clockid_t __clock_id, struct timespec *__tp)
+{
+	assert_int_equal(__clock_id, CLOCK_MONOTONIC);
+	assert_non_null(__tp);
+
+	*__tp = Mock_monotonic;
+
+	return 0;
+}
+
+/*
+ * time_advance_ms -- move the CLOCK_MONOTONIC time forward by ms milliseconds
+ */
+void
+time_advance_ms(int ms)
+{
+	long nsec = Mock_monotonic.tv_nsec + (long)ms * NSEC_IN_MSEC;
+
+	Mock_monotonic.tv_sec += nsec / NSEC_IN_SEC;
+	Mock_monotonic.tv_nsec = nsec % NSEC_IN_SEC;
+}
+
+/*
+ * setup__addr_cache_enable -- enable the cache with MOCK_TTL_MS
+ */
+int
+setup__addr_cache_enable(void **unused)
+{
+	rpma_addr_cache_set_ttl(MOCK_TTL_MS);
+
+	return 0;
+}
+
+/*
+ * teardown__addr_cache_disable -- disable the cache
+ *
+ * NOTE: the tests drop the resolved addresses they cached themselves
+ * so no rdma_freeaddrinfo() is expected here.
+ */
+int
+teardown__addr_cache_disable(void **unused)
+{
+	rpma_addr_cache_set_ttl(0);
+
+	return 0;
+}
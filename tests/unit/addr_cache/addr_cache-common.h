@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * addr_cache-common.h -- the addr_cache unit tests common definitions
+ */
+
+#ifndef ADDR_CACHE_COMMON_H
+#define ADDR_CACHE_COMMON_H
+
+#include "test-common.h"
+#include "addr_cache.h"
+
+#define MOCK_TTL_MS	100
+#define MOCK_PORT_2	"4321"
+#define MOCK_IP_ADDRESS_2	"127.0.0.2"
+
+/* the number of the entries the cache keeps */
+#define ADDR_CACHE_SIZE	64
+
+void time_advance_ms(int ms);
+
+int setup__addr_cache_enable(void **unused);
+int teardown__addr_cache_disable(void **unused);
+
+#endif /* ADDR_CACHE_COMMON_H */
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * addr_cache-ibv_context.c -- the addr_cache unit tests of the devices
+ *
+ * APIs covered:
+ * - rpma_addr_cache_lookup_ibv_context()
+ * - rpma_addr_cache_insert_ibv_context()
+ * - rpma_addr_cache_invalidate()
+ * - rpma_addr_cache_fini()
+ */
+
+#include "cmocka_headers.h"
+#include "addr_cache-common.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
+
+#define MOCK_VERBS_2	(struct ibv_context *)0xC7C2
+
+/*
+ * insert__disabled -- nothing is cached if the cache is disabled
+ */
+static void
+insert__disabled(void **unused)
+{
+	/* run test */
+	rpma_addr_cache_insert_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE, MOCK_VERBS);
+
+	/* verify the results */
+	struct ibv_context *ibv_ctx = NULL;
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE,
+			&ibv_ctx));
+	assert_null(ibv_ctx);
+}
+
+/*
+ * insert__malloc_ERRNO -- the device is not cached if malloc() fails
+ */
+static void
+insert__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+	/* run test */
+	rpma_addr_cache_insert_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE, MOCK_VERBS);
+
+	/* verify the results */
+	struct ibv_context *ibv_ctx = NULL;
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE,
+			&ibv_ctx));
+	assert_null(ibv_ctx);
+}
+
+/*
+ * lookup__success -- the device is found for the same addr and side until its TTL passes
+ */
+static void
+lookup__success(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	rpma_addr_cache_insert_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_ACTIVE, MOCK_VERBS);
+
+	/* verify the results */
+	struct ibv_context *ibv_ctx = NULL;
+	assert_true(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_ACTIVE,
+			&ibv_ctx));
+	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
+
+	ibv_ctx = NULL;
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE,
+			&ibv_ctx));
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS_2, RPMA_INFO_ACTIVE,
+			&ibv_ctx));
+	assert_null(ibv_ctx);
+
+	time_advance_ms(MOCK_TTL_MS);
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_ACTIVE,
+			&ibv_ctx));
+	assert_null(ibv_ctx);
+}
+
+/*
+ * invalidate__device -- only the entries of the removed device and the resolved addresses
+ * are dropped
+ */
+static void
+invalidate__device(void **unused)
+{
+	struct rdma_addrinfo rai = {0};
+	struct rpma_addr_cache_ref *ref = NULL;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	will_return(rdma_freeaddrinfo, &args);
+
+	/* run test */
+	rpma_addr_cache_insert_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE, MOCK_VERBS);
+	rpma_addr_cache_insert_ibv_context(MOCK_IP_ADDRESS_2, RPMA_INFO_PASSIVE, MOCK_VERBS_2);
+	assert_true(rpma_addr_cache_insert_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT, RPMA_INFO_PASSIVE,
+			&rai, &ref));
+	rpma_addr_cache_release(&ref);
+
+	rpma_addr_cache_invalidate(MOCK_VERBS);
+
+	/* verify the results */
+	struct ibv_context *ibv_ctx = NULL;
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS, RPMA_INFO_PASSIVE,
+			&ibv_ctx));
+	assert_null(rpma_addr_cache_lookup_addrinfo(MOCK_IP_ADDRESS, MOCK_PORT, RPMA_INFO_PASSIVE,
+			&ref));
+	assert_true(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS_2, RPMA_INFO_PASSIVE,
+			&ibv_ctx));
+	assert_ptr_equal(ibv_ctx, MOCK_VERBS_2);
+
+	/* cleanup */
+	rpma_addr_cache_fini();
+	assert_false(rpma_addr_cache_lookup_ibv_context(MOCK_IP_ADDRESS_2, RPMA_INFO_PASSIVE,
+			&ibv_ctx));
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(insert__disabled),
+		cmocka_unit_test_setup_teardown(insert__malloc_ERRNO,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(lookup__success,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+		cmocka_unit_test_setup_teardown(invalidate__device,
+			setup__addr_cache_enable, teardown__addr_cache_disable),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -49,8 +49,28 @@ ibv_query_device(struct ibv_context *ibv_ctx,
 	return 0;
 }
 
-#if defined(ON_DEMAND_PAGING_SUPPORTED) || defined(NATIVE_ATOMIC_WRITE_SUPPORTED) || \
-	defined(NATIVE_FLUSH_SUPPORTED)
+/*
+ * ibv_query_qp -- ibv_query_qp() mock
+ */
+int
+ibv_query_qp(struct ibv_qp *qp, struct ibv_qp_attr *attr, int attr_mask,
+		struct ibv_qp_init_attr *init_attr)
+{
+	assert_ptr_equal(qp, MOCK_QP);
+	assert_non_null(attr);
+	assert_true(attr_mask & IBV_QP_CAP);
+
+	int ret = mock_type(int);
+	if (ret)
+		return ret;
+
+	memset(attr, 0, sizeof(*attr));
+	attr->cap.max_send_wr = mock_type(uint32_t);
+	attr->cap.max_recv_wr = attr->cap.max_send_wr;
+
+	return 0;
+}
+
 /*
  * ibv_query_device_ex_mock -- ibv_query_device_ex() mock
  */
@@ -73,7 +93,6 @@ ibv_query_device_ex_mock(struct ibv_context *ibv_ctx,
 
 	return 0;
 }
-#endif
 
 /*
  * ibv_create_cq -- ibv_create_cq() mock
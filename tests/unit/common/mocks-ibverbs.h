@@ -100,13 +100,10 @@ struct ibv_wr_flush_mock_args {
 };
 #endif
 
-#if defined(ON_DEMAND_PAGING_SUPPORTED) || defined(NATIVE_ATOMIC_WRITE_SUPPORTED) || \
-	defined(NATIVE_FLUSH_SUPPORTED)
 int ibv_query_device_ex_mock(struct ibv_context *ibv_ctx,
 		const struct ibv_query_device_ex_input *input,
 		struct ibv_device_attr_ex *attr,
 		size_t attr_size);
-#endif
 
 int ibv_post_send_mock(struct ibv_qp *qp, struct ibv_send_wr *wr,
 		struct ibv_send_wr **bad_wr);
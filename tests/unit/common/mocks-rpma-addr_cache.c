@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-addr_cache.c -- librpma addr_cache.c module mocks
+ */
+
+#include <librpma.h>
+
+#include "cmocka_headers.h"
+#include "addr_cache.h"
+#include "mocks-rpma-addr_cache.h"
+
+bool Mock_addr_cache_enabled = false;
+
+/*
+ * rpma_addr_cache_set_ttl -- rpma_addr_cache_set_ttl() mock
+ */
+void
+rpma_addr_cache_set_ttl(int ttl_ms)
+{
+	check_expected(ttl_ms);
+}
+
+/*
+ * rpma_addr_cache_lookup_addrinfo -- rpma_addr_cache_lookup_addrinfo() mock
+ */
+struct rdma_addrinfo *
+rpma_addr_cache_lookup_addrinfo(const char *addr, const char *port, enum rpma_info_side side,
+		struct rpma_addr_cache_ref **ref_ptr)
+{
+	assert_non_null(addr);
+	assert_non_null(ref_ptr);
+
+	if (!Mock_addr_cache_enabled)
+		return NULL;
+
+	check_expected(side);
+
+	struct rdma_addrinfo *rai = mock_type(struct rdma_addrinfo *);
+	if (rai)
+		*ref_ptr = MOCK_ADDR_CACHE_REF;
+
+	return rai;
+}
+
+/*
+ * rpma_addr_cache_insert_addrinfo -- rpma_addr_cache_insert_addrinfo() mock
+ */
+bool
+rpma_addr_cache_insert_addrinfo(const char *addr, const char *port, enum rpma_info_side side,
+		struct rdma_addrinfo *rai, struct rpma_addr_cache_ref **ref_ptr)
+{
+	assert_non_null(addr);
+	assert_non_null(ref_ptr);
+
+	if (!Mock_addr_cache_enabled)
+		return false;
+
+	check_expected(side);
+	check_expected_ptr(rai);
+
+	bool cached = mock_type(bool);
+	if (cached)
+		*ref_ptr = MOCK_ADDR_CACHE_REF;
+
+	return cached;
+}
+
+/*
+ * rpma_addr_cache_release -- rpma_addr_cache_release() mock
+ */
+void
+rpma_addr_cache_release(struct rpma_addr_cache_ref **ref_ptr)
+{
+	struct rpma_addr_cache_ref *ref = *ref_ptr;
+	check_expected_ptr(ref);
+
+	*ref_ptr = NULL;
+}
+
+/*
+ * rpma_addr_cache_lookup_ibv_context -- rpma_addr_cache_lookup_ibv_context() mock
+ */
+bool
+rpma_addr_cache_lookup_ibv_context(const char *addr, enum rpma_info_side side,
+		struct ibv_context **ibv_ctx_ptr)
+{
+	assert_non_null(addr);
+	assert_non_null(ibv_ctx_ptr);
+
+	if (!Mock_addr_cache_enabled)
+		return false;
+
+	check_expected(side);
+
+	struct ibv_context *ibv_ctx = mock_type(struct ibv_context *);
+	if (ibv_ctx == NULL)
+		return false;
+
+	*ibv_ctx_ptr = ibv_ctx;
+
+	return true;
+}
+
+/*
+ * rpma_addr_cache_insert_ibv_context -- rpma_addr_cache_insert_ibv_context() mock
+ */
+void
+rpma_addr_cache_insert_ibv_context(const char *addr, enum rpma_info_side side,
+		struct ibv_context *ibv_ctx)
+{
+	assert_non_null(addr);
+
+	if (!Mock_addr_cache_enabled)
+		return;
+
+	check_expected(side);
+	check_expected_ptr(ibv_ctx);
+}
+
+/*
+ * rpma_addr_cache_invalidate -- rpma_addr_cache_invalidate() mock
+ */
+void
+rpma_addr_cache_invalidate(const struct ibv_context *ibv_ctx)
+{
+	check_expected_ptr(ibv_ctx);
+}
+
+/*
+ * rpma_addr_cache_fini -- rpma_addr_cache_fini() mock
+ */
+void
+rpma_addr_cache_fini(void)
+{
+	function_called();
+}
@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-addr_cache.h -- a rpma-addr_cache mocks header
+ */
+
+#ifndef MOCKS_RPMA_ADDR_CACHE_H
+#define MOCKS_RPMA_ADDR_CACHE_H
+
+#include <stdbool.h>
+
+#define MOCK_ADDR_CACHE_REF	(struct rpma_addr_cache_ref *)0xAC4E
+
+/* if false the cache behaves as disabled and its lookup and insert mocks consume nothing */
+extern bool Mock_addr_cache_enabled;
+
+#endif /* MOCKS_RPMA_ADDR_CACHE_H */
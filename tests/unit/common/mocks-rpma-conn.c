@@ -19,13 +19,15 @@
 int
 rpma_conn_new(struct rpma_peer *peer, struct rdma_cm_id *id,
 		struct rpma_cq *cq, struct rpma_cq *rcq,
-		struct ibv_comp_channel *channel, struct rpma_conn **conn_ptr)
+		struct ibv_comp_channel *channel, struct rpma_conn_evch *conn_evch,
+		struct rpma_conn **conn_ptr)
 {
 	assert_ptr_equal(peer, MOCK_PEER);
 	check_expected_ptr(id);
 	assert_ptr_equal(cq, MOCK_RPMA_CQ);
 	check_expected_ptr(rcq);
 	check_expected_ptr(channel);
+	assert_null(conn_evch);
 
 	assert_non_null(conn_ptr);
 
@@ -67,6 +69,17 @@ rpma_conn_delete(struct rpma_conn **conn_ptr)
 	return 0;
 }
 
+/*
+ * rpma_conn_disconnect -- rpma_conn_disconnect() mock
+ */
+int
+rpma_conn_disconnect(struct rpma_conn *conn)
+{
+	check_expected_ptr(conn);
+
+	return mock_type(int);
+}
+
 /*
  * rpma_conn_transfer_private_data -- rpma_conn_transfer_private_data() mock
  */
@@ -80,3 +93,184 @@ rpma_conn_transfer_private_data(struct rpma_conn *conn,
 	check_expected(pdata->ptr);
 	check_expected(pdata->len);
 }
+
+/*
+ * rpma_write -- rpma_write() mock
+ */
+int
+rpma_write(struct rpma_conn *conn,
+	struct rpma_mr_remote *dst, size_t dst_offset,
+	const struct rpma_mr_local *src, size_t src_offset,
+	size_t len, int flags, const void *op_context)
+{
+	assert_int_not_equal(flags, 0);
+
+	check_expected_ptr(conn);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_write_with_imm -- rpma_write_with_imm() mock
+ */
+int
+rpma_write_with_imm(struct rpma_conn *conn,
+	struct rpma_mr_remote *dst, size_t dst_offset,
+	const struct rpma_mr_local *src, size_t src_offset,
+	size_t len, int flags, uint32_t imm, const void *op_context)
+{
+	assert_int_not_equal(flags, 0);
+
+	check_expected_ptr(conn);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	check_expected(imm);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_recv -- rpma_recv() mock
+ */
+int
+rpma_recv(struct rpma_conn *conn,
+	struct rpma_mr_local *dst, size_t offset, size_t len,
+	const void *op_context)
+{
+	check_expected_ptr(conn);
+	check_expected_ptr(dst);
+	check_expected(offset);
+	check_expected(len);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_read -- rpma_read() mock
+ */
+int
+rpma_read(struct rpma_conn *conn,
+	struct rpma_mr_local *dst, size_t dst_offset,
+	const struct rpma_mr_remote *src, size_t src_offset,
+	size_t len, int flags, const void *op_context)
+{
+	assert_int_not_equal(flags, 0);
+
+	check_expected_ptr(conn);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_send_with_imm -- rpma_send_with_imm() mock
+ */
+int
+rpma_send_with_imm(struct rpma_conn *conn,
+	const struct rpma_mr_local *src, size_t offset, size_t len,
+	int flags, uint32_t imm, const void *op_context)
+{
+	assert_int_not_equal(flags, 0);
+
+	check_expected_ptr(conn);
+	check_expected_ptr(src);
+	check_expected(offset);
+	check_expected(len);
+	check_expected(flags);
+	check_expected(imm);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_conn_send_with_imm_internal -- rpma_conn_send_with_imm_internal() mock
+ */
+int
+rpma_conn_send_with_imm_internal(struct rpma_conn *conn,
+	const struct rpma_mr_local *src, size_t offset, size_t len,
+	int flags, uint32_t imm, bool fence, const void *op_context)
+{
+	assert_int_not_equal(flags, 0);
+
+	check_expected_ptr(conn);
+	check_expected_ptr(src);
+	check_expected(offset);
+	check_expected(len);
+	check_expected(flags);
+	check_expected(imm);
+	check_expected(fence);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_conn_get_rq_size -- rpma_conn_get_rq_size() mock
+ */
+int
+rpma_conn_get_rq_size(const struct rpma_conn *conn, uint32_t *rq_size)
+{
+	check_expected_ptr(conn);
+	assert_non_null(rq_size);
+
+	int result = mock_type(int);
+	if (result)
+		return result;
+
+	*rq_size = mock_type(uint32_t);
+	return 0;
+}
+
+/*
+ * rpma_conn_get_event_fd -- rpma_conn_get_event_fd() mock
+ */
+int
+rpma_conn_get_event_fd(const struct rpma_conn *conn, int *fd)
+{
+	check_expected_ptr(conn);
+	assert_non_null(fd);
+
+	int result = mock_type(int);
+	if (result)
+		return result;
+
+	*fd = mock_type(int);
+	return 0;
+}
+
+/*
+ * rpma_conn_next_event -- rpma_conn_next_event() mock
+ */
+int
+rpma_conn_next_event(struct rpma_conn *conn, enum rpma_conn_event *event)
+{
+	check_expected_ptr(conn);
+	assert_non_null(event);
+
+	int result = mock_type(int);
+	if (result)
+		return result;
+
+	*event = mock_type(enum rpma_conn_event);
+	return 0;
+}
@@ -132,3 +132,19 @@ rpma_conn_cfg_get_srq(const struct rpma_conn_cfg *cfg, struct rpma_srq **srq_ptr
 
 	return 0;
 }
+
+/*
+ * rpma_conn_cfg_get_evch -- rpma_conn_cfg_get_evch() mock
+ */
+int
+rpma_conn_cfg_get_evch(const struct rpma_conn_cfg *cfg, struct rpma_conn_evch **evch_ptr)
+{
+	struct conn_cfg_get_mock_args *args = mock_type(struct conn_cfg_get_mock_args *);
+
+	assert_ptr_equal(cfg, args->cfg);
+	assert_non_null(evch_ptr);
+
+	*evch_ptr = args->evch;
+
+	return 0;
+}
@@ -38,6 +38,7 @@ struct conn_cfg_get_mock_args {
 	bool shared;
 	struct rpma_srq *srq;
 	struct rpma_cq *srq_rcq;
+	struct rpma_conn_evch *evch;
 };
 
 /* current hardcoded values */
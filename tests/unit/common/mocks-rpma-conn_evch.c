@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-conn_evch.c -- librpma conn_evch.c module mocks
+ */
+
+#include "conn_evch.h"
+
+#include "cmocka_headers.h"
+#include "mocks-rdma_cm.h"
+
+/*
+ * rpma_conn_evch_get_cm_evch -- rpma_conn_evch_get_cm_evch() mock
+ */
+struct rdma_event_channel *
+rpma_conn_evch_get_cm_evch(const struct rpma_conn_evch *evch)
+{
+	check_expected_ptr(evch);
+
+	return MOCK_EVCH;
+}
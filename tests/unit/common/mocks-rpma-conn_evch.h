@@ -0,0 +1,13 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-conn_evch.h -- a rpma-conn_evch mocks header
+ */
+
+#ifndef MOCKS_RPMA_CONN_EVCH_H
+#define MOCKS_RPMA_CONN_EVCH_H
+
+#define MOCK_RPMA_CONN_EVCH	(struct rpma_conn_evch *)0xCE7C
+
+#endif /* MOCKS_RPMA_CONN_EVCH_H */
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-conn_req.c -- librpma conn_req.c module mocks
+ */
+
+#include <librpma.h>
+
+#include "cmocka_headers.h"
+#include "test-common.h"
+
+/*
+ * rpma_conn_req_new_async -- rpma_conn_req_new_async() mock
+ */
+int
+rpma_conn_req_new_async(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, struct rpma_conn_req **req_ptr)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+	check_expected_ptr(addr);
+	assert_string_equal(port, MOCK_PORT);
+	check_expected_ptr(cfg);
+	assert_non_null(req_ptr);
+
+	struct rpma_conn_req *req = mock_type(struct rpma_conn_req *);
+	if (!req)
+		return mock_type(int);
+
+	*req_ptr = req;
+	return 0;
+}
+
+/*
+ * rpma_conn_req_get_fd -- rpma_conn_req_get_fd() mock
+ */
+int
+rpma_conn_req_get_fd(const struct rpma_conn_req *req, int *fd)
+{
+	check_expected_ptr(req);
+	assert_non_null(fd);
+
+	int result = mock_type(int);
+	if (result)
+		return result;
+
+	*fd = mock_type(int);
+	return 0;
+}
+
+/*
+ * rpma_conn_req_step -- rpma_conn_req_step() mock
+ */
+int
+rpma_conn_req_step(struct rpma_conn_req *req, enum rpma_conn_req_state *state)
+{
+	check_expected_ptr(req);
+	assert_non_null(state);
+
+	int result = mock_type(int);
+	if (result)
+		return result;
+
+	*state = mock_type(enum rpma_conn_req_state);
+	return 0;
+}
+
+/*
+ * rpma_conn_req_connect -- rpma_conn_req_connect() mock
+ */
+int
+rpma_conn_req_connect(struct rpma_conn_req **req_ptr,
+		const struct rpma_conn_private_data *pdata, struct rpma_conn **conn_ptr)
+{
+	assert_non_null(req_ptr);
+	struct rpma_conn_req *req = *req_ptr;
+	check_expected_ptr(req);
+	check_expected_ptr(pdata);
+	assert_non_null(conn_ptr);
+
+	/* the request is consumed regardless of the result */
+	*req_ptr = NULL;
+
+	struct rpma_conn *conn = mock_type(struct rpma_conn *);
+	if (!conn)
+		return mock_type(int);
+
+	*conn_ptr = conn;
+	return 0;
+}
+
+/*
+ * rpma_conn_req_delete -- rpma_conn_req_delete() mock
+ */
+int
+rpma_conn_req_delete(struct rpma_conn_req **req_ptr)
+{
+	assert_non_null(req_ptr);
+	struct rpma_conn_req *req = *req_ptr;
+	check_expected_ptr(req);
+
+	*req_ptr = NULL;
+	return mock_type(int);
+}
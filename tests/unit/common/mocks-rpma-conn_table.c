@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-conn_table.c -- librpma conn_table.c module mocks
+ */
+
+#include <rdma/rdma_cma.h>
+#include <librpma.h>
+
+#include "cmocka_headers.h"
+#include "conn_table.h"
+
+/*
+ * rpma_conn_table_insert -- rpma_conn_table_insert() mock
+ */
+int
+rpma_conn_table_insert(const struct rdma_cm_id *id, struct rpma_conn *conn)
+{
+	assert_non_null(id);
+	assert_non_null(conn);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_conn_table_remove -- rpma_conn_table_remove() mock
+ */
+void
+rpma_conn_table_remove(const struct rdma_cm_id *id, struct rpma_conn *conn)
+{
+	assert_non_null(id);
+	assert_non_null(conn);
+}
+
+/*
+ * rpma_conn_table_lookup -- rpma_conn_table_lookup() mock
+ */
+struct rpma_conn *
+rpma_conn_table_lookup(const struct ibv_context *ctx, uint32_t qp_num)
+{
+	check_expected_ptr(ctx);
+	check_expected(qp_num);
+
+	return mock_ptr_type(struct rpma_conn *);
+}
+
+/*
+ * rpma_conn_table_fini -- rpma_conn_table_fini() mock
+ */
+void
+rpma_conn_table_fini(void)
+{
+	function_called();
+}
@@ -86,6 +86,17 @@ rpma_cq_delete(struct rpma_cq **cq_ptr)
 	return result;
 }
 
+/*
+ * rpma_cq_reset -- rpma_cq_reset() mock
+ */
+int
+rpma_cq_reset(struct rpma_cq *cq)
+{
+	check_expected_ptr(cq);
+
+	return mock_type(int);
+}
+
 /*
  * rpma_cq_get_ibv_cq -- rpma_cq_get_ibv_cq() mock
  */
@@ -96,3 +107,36 @@ rpma_cq_get_ibv_cq(const struct rpma_cq *cq)
 
 	return mock_type(struct ibv_cq *);
 }
+
+/*
+ * rpma_cq_get_wc -- rpma_cq_get_wc() mock
+ */
+int
+rpma_cq_get_wc(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc, int *num_entries_got)
+{
+	assert_ptr_equal(cq, MOCK_RPMA_CQ);
+	assert_non_null(wc);
+	check_expected(num_entries);
+
+	int ret = mock_type(int);
+	if (ret)
+		return ret;
+
+	int num = mock_type(int);
+	assert_true(num <= num_entries);
+	const struct ibv_wc *wcs = mock_type(const struct ibv_wc *);
+	memcpy(wc, wcs, (size_t)num * sizeof(*wc));
+	if (num_entries_got)
+		*num_entries_got = num;
+
+	return 0;
+}
+
+/*
+ * rpma_cq_set_instr -- rpma_cq_set_instr() mock
+ */
+void
+rpma_cq_set_instr(struct rpma_cq *cq, struct rpma_instr *instr)
+{
+	assert_true(cq == MOCK_RPMA_CQ || cq == MOCK_RPMA_RCQ);
+}
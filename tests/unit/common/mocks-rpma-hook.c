@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-hook.c -- librpma hook.c module mocks
+ */
+
+#include "cmocka_headers.h"
+#include "hook.h"
+
+/*
+ * rpma_hook_fini -- rpma_hook_fini() mock
+ */
+void
+rpma_hook_fini(void)
+{
+	function_called();
+}
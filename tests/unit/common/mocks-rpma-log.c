@@ -32,6 +32,18 @@ _Atomic
 #endif /* ATOMIC_OPERATIONS_SUPPORTED */
 uintptr_t Rpma_log_function = (uintptr_t)mock_function;
 
+/*
+ * rpma_log_get_function -- rpma_log_get_function() mock
+ */
+rpma_log_function *
+rpma_log_get_function(enum rpma_log_level level)
+{
+	if (level > Rpma_log_threshold[RPMA_LOG_THRESHOLD])
+		return NULL;
+
+	return (rpma_log_function *)Rpma_log_function;
+}
+
 /*
  * rpma_log_init -- rpma_log_init() mock
  */
@@ -64,3 +76,14 @@ rpma_log_get_threshold(enum rpma_log_threshold threshold,
 
 	return 0;
 }
+
+/*
+ * rpma_log_ratelimit -- rpma_log_ratelimit() mock (nothing is suppressed)
+ */
+int
+rpma_log_ratelimit(struct rpma_log_ratelimit *rl, uint64_t *suppressed)
+{
+	*suppressed = 0;
+
+	return 1;
+}
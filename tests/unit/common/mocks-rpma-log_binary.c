@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-log_binary.c -- librpma log_binary.c module mocks
+ */
+
+#include "cmocka_headers.h"
+#include "log_binary.h"
+
+/*
+ * rpma_log_binary_fini -- rpma_log_binary_fini() mock
+ */
+void
+rpma_log_binary_fini(void)
+{
+	function_called();
+}
@@ -19,6 +19,17 @@ rpma_log_default_function(enum rpma_log_level level, const char *file_name,
 	function_called();
 }
 
+/*
+ * rpma_log_default_write -- rpma_log_default_write() mock
+ */
+void
+rpma_log_default_write(enum rpma_log_level level, const struct timespec *ts, long tid,
+	const char *file_name, const int line_no, const char *function_name, const char *message)
+{
+	check_expected(level);
+	check_expected(message);
+}
+
 /*
  * rpma_log_default_init -- rpma_log_default_init() mock
  */
@@ -106,7 +106,11 @@ rpma_mr_reg(struct rpma_peer *peer, void *ptr, size_t size, int usage,
 	assert_non_null(mr_ptr);
 
 	void **paddr = mock_type(void **);
-	assert_ptr_equal(ptr, *paddr);
+	/* if the address is not known in advance just save it */
+	if (*paddr == NULL)
+		*paddr = ptr;
+	else
+		assert_ptr_equal(ptr, *paddr);
 
 	*mr_ptr = mock_type(struct rpma_mr_local *);
 	if (*mr_ptr == NULL)
@@ -141,7 +145,7 @@ int
 rpma_mr_send(struct ibv_qp *qp,
 	const struct rpma_mr_local *src,  size_t offset,
 	size_t len, int flags, enum ibv_wr_opcode operation,
-	uint32_t imm, const void *op_context)
+	uint32_t imm, bool fence, const void *op_context)
 {
 	assert_non_null(qp);
 	assert_int_not_equal(flags, 0);
@@ -154,6 +158,7 @@ rpma_mr_send(struct ibv_qp *qp,
 	check_expected(flags);
 	check_expected(operation);
 	check_expected(imm);
+	check_expected(fence);
 	check_expected_ptr(op_context);
 
 	return mock_type(int);
@@ -198,6 +203,31 @@ rpma_mr_srq_recv(struct ibv_srq *srq, struct rpma_mr_local *dst, size_t offset,
 	return mock_type(int);
 }
 
+/*
+ * rpma_mr_flush_apm -- mock of rpma_mr_flush_apm
+ */
+int
+rpma_mr_flush_apm(struct ibv_qp *qp, struct rpma_mr_local *raw, size_t raw_len,
+	const struct rpma_mr_remote *dst, size_t dst_offset, size_t len, int flags,
+	const void *op_context)
+{
+	assert_non_null(qp);
+	assert_int_not_equal(flags, 0);
+	assert_non_null(raw);
+	assert_non_null(dst);
+
+	check_expected_ptr(qp);
+	check_expected_ptr(raw);
+	check_expected(raw_len);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected(len);
+	check_expected(flags);
+	check_expected_ptr(op_context);
+
+	return mock_type(int);
+}
+
 #ifdef NATIVE_FLUSH_SUPPORTED
 /*
  * rpma_mr_flush -- mock of rpma_mr_flush
@@ -235,3 +265,77 @@ rpma_mr_remote_get_flush_type(const struct rpma_mr_remote *mr, int *flush_type)
 
 	return 0;
 }
+
+/*
+ * rpma_mr_get_descriptor -- rpma_mr_get_descriptor() mock
+ */
+int
+rpma_mr_get_descriptor(const struct rpma_mr_local *mr, void *desc)
+{
+	check_expected_ptr(mr);
+	check_expected_ptr(desc);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_mr_get_descriptor_size -- rpma_mr_get_descriptor_size() mock
+ */
+int
+rpma_mr_get_descriptor_size(const struct rpma_mr_local *mr, size_t *desc_size)
+{
+	check_expected_ptr(mr);
+	assert_non_null(desc_size);
+
+	*desc_size = mock_type(size_t);
+
+	return 0;
+}
+
+/*
+ * rpma_mr_remote_from_descriptor -- rpma_mr_remote_from_descriptor() mock
+ */
+int
+rpma_mr_remote_from_descriptor(const void *desc, size_t desc_size,
+	struct rpma_mr_remote **mr_ptr)
+{
+	check_expected_ptr(desc);
+	check_expected(desc_size);
+	assert_non_null(mr_ptr);
+
+	struct rpma_mr_remote *mr = mock_type(struct rpma_mr_remote *);
+	if (mr == NULL)
+		return mock_type(int);
+
+	*mr_ptr = mr;
+
+	return 0;
+}
+
+/*
+ * rpma_mr_remote_get_size -- rpma_mr_remote_get_size() mock
+ */
+int
+rpma_mr_remote_get_size(const struct rpma_mr_remote *mr, size_t *size)
+{
+	check_expected_ptr(mr);
+	assert_non_null(size);
+
+	*size = mock_type(size_t);
+
+	return 0;
+}
+
+/*
+ * rpma_mr_remote_delete -- rpma_mr_remote_delete() mock
+ */
+int
+rpma_mr_remote_delete(struct rpma_mr_remote **mr_ptr)
+{
+	assert_non_null(mr_ptr);
+	check_expected_ptr(*mr_ptr);
+
+	*mr_ptr = NULL;
+
+	return 0;
+}
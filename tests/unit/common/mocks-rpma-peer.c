@@ -13,6 +13,7 @@
 #include "mocks-ibverbs.h"
 #include "mocks-rpma-peer.h"
 #include "mocks-rpma-cq.h"
+#include "mocks-rpma-res_pool.h"
 #include "mocks-rpma-srq.h"
 #include "mocks-rpma-srq_cfg.h"
 
@@ -62,6 +63,51 @@ rpma_peer_setup_qp(struct rpma_peer *peer, struct rdma_cm_id *id,
 	return result;
 }
 
+/*
+ * rpma_peer_clamp_cqe -- rpma_peer_clamp_cqe() mock (the device limits are never exceeded)
+ */
+int
+rpma_peer_clamp_cqe(const struct rpma_peer *peer, int cqe)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+
+	return cqe;
+}
+
+/* the pool returned by rpma_peer_get_res_pool() (the recycling is disabled by default) */
+struct rpma_res_pool *Mock_res_pool = NULL;
+
+/*
+ * rpma_peer_get_res_pool -- rpma_peer_get_res_pool() mock
+ */
+struct rpma_res_pool *
+rpma_peer_get_res_pool(const struct rpma_peer *peer)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+
+	return Mock_res_pool;
+}
+
+/*
+ * rpma_peer_attach_stats -- rpma_peer_attach_stats() mock
+ */
+void
+rpma_peer_attach_stats(struct rpma_peer *peer, struct rpma_stats *stats)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+	assert_non_null(stats);
+}
+
+/*
+ * rpma_peer_detach_stats -- rpma_peer_detach_stats() mock
+ */
+void
+rpma_peer_detach_stats(struct rpma_peer *peer, struct rpma_stats *stats)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+	assert_non_null(stats);
+}
+
 /*
  * rpma_peer_setup_mr_reg -- a mock of rpma_peer_setup_mr_reg()
  */
@@ -20,4 +20,7 @@ struct rpma_peer_setup_mr_reg_args {
 	int verrno;
 };
 
+/* the pool returned by rpma_peer_get_res_pool() */
+extern struct rpma_res_pool *Mock_res_pool;
+
 #endif /* MOCKS_RPMA_PEER_H */
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-res_pool.c -- librpma res_pool.c module mocks
+ */
+
+#include <librpma.h>
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rpma-cq.h"
+#include "mocks-rpma-res_pool.h"
+#include "res_pool.h"
+
+/*
+ * rpma_res_pool_new -- rpma_res_pool_new() mock
+ */
+int
+rpma_res_pool_new(int size, struct rpma_res_pool **pool_ptr)
+{
+	check_expected(size);
+	assert_non_null(pool_ptr);
+
+	int result = mock_type(int);
+	if (result == 0)
+		*pool_ptr = MOCK_RES_POOL;
+
+	return result;
+}
+
+/*
+ * rpma_res_pool_delete -- rpma_res_pool_delete() mock
+ */
+int
+rpma_res_pool_delete(struct rpma_res_pool **pool_ptr)
+{
+	assert_non_null(pool_ptr);
+
+	/* there is nothing to delete when the recycling is disabled */
+	if (*pool_ptr == NULL)
+		return 0;
+
+	assert_ptr_equal(*pool_ptr, MOCK_RES_POOL);
+	*pool_ptr = NULL;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_res_pool_take_cqs -- rpma_res_pool_take_cqs() mock
+ */
+bool
+rpma_res_pool_take_cqs(struct rpma_res_pool *pool, int cqe, int rcqe, bool shared,
+		struct rpma_cq **cq_ptr, struct rpma_cq **rcq_ptr,
+		struct ibv_comp_channel **channel_ptr)
+{
+	assert_ptr_equal(pool, MOCK_RES_POOL);
+	check_expected(cqe);
+	check_expected(rcqe);
+	check_expected(shared);
+
+	bool taken = mock_type(bool);
+	if (taken) {
+		*cq_ptr = MOCK_RPMA_CQ;
+		*rcq_ptr = rcqe ? MOCK_RPMA_RCQ : NULL;
+		*channel_ptr = shared ? MOCK_COMP_CHANNEL : NULL;
+	}
+
+	return taken;
+}
+
+/*
+ * rpma_res_pool_put_cqs -- rpma_res_pool_put_cqs() mock
+ */
+bool
+rpma_res_pool_put_cqs(struct rpma_res_pool *pool, struct rpma_cq *cq, struct rpma_cq *rcq,
+		struct ibv_comp_channel *channel)
+{
+	assert_ptr_equal(pool, MOCK_RES_POOL);
+	check_expected_ptr(cq);
+	check_expected_ptr(rcq);
+	check_expected_ptr(channel);
+
+	return mock_type(bool);
+}
+
+/*
+ * rpma_res_pool_take_flush -- rpma_res_pool_take_flush() mock
+ */
+bool
+rpma_res_pool_take_flush(struct rpma_res_pool *pool, struct rpma_flush **flush_ptr)
+{
+	assert_ptr_equal(pool, MOCK_RES_POOL);
+	assert_non_null(flush_ptr);
+
+	/* NULL means no flushing object is kept */
+	struct rpma_flush *flush = mock_type(struct rpma_flush *);
+	if (flush)
+		*flush_ptr = flush;
+
+	return (flush != NULL);
+}
+
+/*
+ * rpma_res_pool_put_flush -- rpma_res_pool_put_flush() mock
+ */
+bool
+rpma_res_pool_put_flush(struct rpma_res_pool *pool, struct rpma_flush *flush)
+{
+	assert_ptr_equal(pool, MOCK_RES_POOL);
+	check_expected_ptr(flush);
+
+	return mock_type(bool);
+}
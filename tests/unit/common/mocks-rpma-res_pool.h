@@ -0,0 +1,13 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-res_pool.h -- a rpma-res_pool mocks header
+ */
+
+#ifndef MOCKS_RPMA_RES_POOL_H
+#define MOCKS_RPMA_RES_POOL_H
+
+#define MOCK_RES_POOL	(struct rpma_res_pool *)0xE5F0
+
+#endif /* MOCKS_RPMA_RES_POOL_H */
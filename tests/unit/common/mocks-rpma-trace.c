@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mocks-rpma-trace.c -- librpma trace.c module mocks
+ */
+
+#include "cmocka_headers.h"
+#include "trace.h"
+
+/*
+ * rpma_trace_fini -- rpma_trace_fini() mock
+ */
+void
+rpma_trace_fini(void)
+{
+	function_called();
+}
@@ -14,18 +14,16 @@
 #include "test-common.h"
 
 /*
- * rpma_utils_ibv_context_is_atomic_write_capable --
- * rpma_utils_ibv_context_is_atomic_write_capable() mock
+ * rpma_utils_ibv_context_query_caps -- rpma_utils_ibv_context_query_caps() mock
  */
 int
-rpma_utils_ibv_context_is_atomic_write_capable(struct ibv_context *ibv_ctx,
-		int *is_atomic_write_capable)
+rpma_utils_ibv_context_query_caps(struct ibv_context *ibv_ctx, struct rpma_peer_caps *caps)
 {
 	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
-	assert_non_null(is_atomic_write_capable);
+	assert_non_null(caps);
 
-	*is_atomic_write_capable = mock_type(int);
-	if (*is_atomic_write_capable == MOCK_ERR_PENDING) {
+	struct rpma_peer_caps *mock_caps = mock_type(struct rpma_peer_caps *);
+	if (mock_caps == NULL) {
 		int ret = mock_type(int);
 		/* XXX validate the errno handling */
 		if (ret == RPMA_E_PROVIDER)
@@ -33,50 +31,7 @@ rpma_utils_ibv_context_is_atomic_write_capable(struct ibv_context *ibv_ctx,
 		return ret;
 	}
 
-	return 0;
-}
-
-/*
- * rpma_utils_ibv_context_is_flush_capable --
- * rpma_utils_ibv_context_is_flush_capable() mock
- */
-int
-rpma_utils_ibv_context_is_flush_capable(struct ibv_context *ibv_ctx, int *is_flush_capable)
-{
-	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
-	assert_non_null(is_flush_capable);
-
-	*is_flush_capable = mock_type(int);
-	if (*is_flush_capable == MOCK_ERR_PENDING) {
-		int ret = mock_type(int);
-		/* XXX validate the errno handling */
-		if (ret == RPMA_E_PROVIDER)
-			errno = mock_type(int);
-		return ret;
-	}
-
-	return 0;
-}
-
-/*
- * rpma_utils_ibv_context_is_odp_capable --
- * rpma_utils_ibv_context_is_odp_capable() mock
- */
-int
-rpma_utils_ibv_context_is_odp_capable(struct ibv_context *ibv_ctx,
-		int *is_odp_capable)
-{
-	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
-	assert_non_null(is_odp_capable);
-
-	*is_odp_capable = mock_type(int);
-	if (*is_odp_capable == MOCK_ERR_PENDING) {
-		int ret = mock_type(int);
-		/* XXX validate the errno handling */
-		if (ret == RPMA_E_PROVIDER)
-			errno = mock_type(int);
-		return ret;
-	}
+	*caps = *mock_caps;
 
 	return 0;
 }
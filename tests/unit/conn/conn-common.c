@@ -94,11 +94,12 @@ setup__conn_new(void **cstate_ptr)
 	will_return(rdma_migrate_id, MOCK_OK);
 	will_return(rpma_flush_new, MOCK_OK);
 	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rpma_conn_table_insert, MOCK_OK);
 
 	/* prepare an object */
 	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID,
 			MOCK_RPMA_CQ, cstate->rcq, cstate->channel,
-			&cstate->conn);
+			NULL, &cstate->conn);
 
 	/* verify the results */
 	assert_int_equal(ret, MOCK_OK);
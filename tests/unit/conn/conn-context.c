@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn-context.c -- the connection user context unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_set_context()
+ * - rpma_conn_get_context()
+ */
+
+#include "conn-common.h"
+
+#define MOCK_USER_CONTEXT	(void *)0xC0C0
+
+/*
+ * set_context__conn_NULL -- conn NULL is invalid
+ */
+static void
+set_context__conn_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_set_context(NULL, MOCK_USER_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_context__conn_NULL -- conn NULL is invalid
+ */
+static void
+get_context__conn_NULL(void **unused)
+{
+	/* run test */
+	void *context = MOCK_USER_CONTEXT;
+	int ret = rpma_conn_get_context(NULL, &context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_ptr_equal(context, MOCK_USER_CONTEXT);
+}
+
+/*
+ * get_context__context_ptr_NULL -- context_ptr NULL is invalid
+ */
+static void
+get_context__context_ptr_NULL(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_get_context(cstate->conn, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_context__default -- the context of a new connection is NULL
+ */
+static void
+get_context__default(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	void *context = MOCK_USER_CONTEXT;
+	int ret = rpma_conn_get_context(cstate->conn, &context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(context);
+}
+
+/*
+ * set_get_context__success -- happy day scenario
+ */
+static void
+set_get_context__success(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_set_context(cstate->conn, MOCK_USER_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	/* run test */
+	void *context = NULL;
+	ret = rpma_conn_get_context(cstate->conn, &context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(context, MOCK_USER_CONTEXT);
+}
+
+static const struct CMUnitTest tests_context[] = {
+	/* rpma_conn_set_context() unit tests */
+	cmocka_unit_test(set_context__conn_NULL),
+
+	/* rpma_conn_get_context() unit tests */
+	cmocka_unit_test(get_context__conn_NULL),
+	cmocka_unit_test_setup_teardown(get_context__context_ptr_NULL,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(get_context__default,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(set_get_context__success,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_context, NULL, NULL);
+}
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn-get_rq_size.c -- the connection get_rq_size unit tests
+ *
+ * API covered:
+ * - rpma_conn_get_rq_size()
+ */
+
+#include "conn-common.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
+
+#define MOCK_RQ_SIZE	16
+
+/*
+ * get_rq_size__query_qp_ERRNO -- ibv_query_qp() fails
+ */
+static void
+get_rq_size__query_qp_ERRNO(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	will_return(ibv_query_qp, MOCK_ERRNO);
+
+	/* run test */
+	uint32_t rq_size = 0;
+	int ret = rpma_conn_get_rq_size(cstate->conn, &rq_size);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_int_equal(rq_size, 0);
+}
+
+/*
+ * get_rq_size__success -- happy day scenario
+ */
+static void
+get_rq_size__success(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	will_return(ibv_query_qp, MOCK_OK);
+	will_return(ibv_query_qp, MOCK_RQ_SIZE);
+
+	/* run test */
+	uint32_t rq_size = 0;
+	int ret = rpma_conn_get_rq_size(cstate->conn, &rq_size);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(rq_size, MOCK_RQ_SIZE);
+}
+
+/*
+ * group_setup_get_rq_size -- prepare resources for all tests in the group
+ */
+static int
+group_setup_get_rq_size(void **unused)
+{
+	Cm_id.qp = MOCK_QP;
+	return 0;
+}
+
+static const struct CMUnitTest tests_get_rq_size[] = {
+	/* rpma_conn_get_rq_size() unit tests */
+	cmocka_unit_test_setup_teardown(
+		get_rq_size__query_qp_ERRNO,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(
+		get_rq_size__success,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_get_rq_size,
+			group_setup_get_rq_size, NULL);
+}
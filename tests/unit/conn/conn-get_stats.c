@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn-get_stats.c -- the rpma_conn_get_stats() unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_get_stats()
+ */
+
+#include <errno.h>
+
+#include "conn-common.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
+
+/*
+ * get_stats__conn_NULL -- NULL conn is invalid
+ */
+static void
+get_stats__conn_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_stats stats;
+	int ret = rpma_conn_get_stats(NULL, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_stats__stats_NULL -- NULL stats is invalid
+ */
+static void
+get_stats__stats_NULL(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_get_stats(cstate->conn, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_stats__zeroed -- the statistics of a new connection are zeroed
+ */
+static void
+get_stats__zeroed(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	struct rpma_conn_stats stats;
+	memset(&stats, 0xff, sizeof(stats));
+	int ret = rpma_conn_get_stats(cstate->conn, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	struct rpma_conn_stats zeroed = {0};
+	assert_memory_equal(&stats, &zeroed, sizeof(stats));
+}
+
+/*
+ * configure_mr_read -- configure the rpma_mr_read() mock
+ */
+static void
+configure_mr_read(int ret)
+{
+	expect_value(rpma_mr_read, qp, MOCK_QP);
+	expect_value(rpma_mr_read, dst, MOCK_RPMA_MR_LOCAL);
+	expect_value(rpma_mr_read, dst_offset, MOCK_LOCAL_OFFSET);
+	expect_value(rpma_mr_read, src, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_mr_read, src_offset, MOCK_REMOTE_OFFSET);
+	expect_value(rpma_mr_read, len, MOCK_LEN);
+	expect_value(rpma_mr_read, flags, MOCK_FLAGS);
+	expect_value(rpma_mr_read, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_mr_read, ret);
+}
+
+/*
+ * get_stats__read -- the posted reads and their bytes are counted
+ */
+static void
+get_stats__read(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	for (int i = 0; i < 2; i++) {
+		configure_mr_read(MOCK_OK);
+		int ret = rpma_read(cstate->conn, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+				MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+				MOCK_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+		assert_int_equal(ret, MOCK_OK);
+	}
+
+	struct rpma_conn_stats stats;
+	int ret = rpma_conn_get_stats(cstate->conn, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.reads, 2);
+	assert_int_equal(stats.read_bytes, 2 * MOCK_LEN);
+	assert_int_equal(stats.post_errors, 0);
+	assert_int_equal(stats.sq_full, 0);
+	assert_int_equal(stats.writes, 0);
+}
+
+/*
+ * get_stats__read_sq_full -- a post failing with ENOMEM is counted as an error
+ * and as a full send queue hit
+ */
+static void
+get_stats__read_sq_full(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	configure_mr_read(RPMA_E_PROVIDER);
+
+	/* run test */
+	errno = ENOMEM;
+	int ret = rpma_read(cstate->conn, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	struct rpma_conn_stats stats;
+	ret = rpma_conn_get_stats(cstate->conn, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.reads, 0);
+	assert_int_equal(stats.read_bytes, 0);
+	assert_int_equal(stats.post_errors, 1);
+	assert_int_equal(stats.sq_full, 1);
+}
+
+/*
+ * get_stats__read_error -- a post failing with another error is not a full send queue hit
+ */
+static void
+get_stats__read_error(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	configure_mr_read(RPMA_E_PROVIDER);
+
+	/* run test */
+	errno = EINVAL;
+	int ret = rpma_read(cstate->conn, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	struct rpma_conn_stats stats;
+	ret = rpma_conn_get_stats(cstate->conn, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.post_errors, 1);
+	assert_int_equal(stats.sq_full, 0);
+}
+
+/*
+ * get_stats__recv_rq_full -- a recv failing with ENOMEM is a full receive queue hit
+ */
+static void
+get_stats__recv_rq_full(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_recv, qp, MOCK_QP);
+	expect_value(rpma_mr_recv, dst, MOCK_RPMA_MR_LOCAL);
+	expect_value(rpma_mr_recv, offset, MOCK_LOCAL_OFFSET);
+	expect_value(rpma_mr_recv, len, MOCK_LEN);
+	expect_value(rpma_mr_recv, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_mr_recv, RPMA_E_PROVIDER);
+
+	/* run test */
+	errno = ENOMEM;
+	int ret = rpma_recv(cstate->conn, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_LEN, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	struct rpma_conn_stats stats;
+	ret = rpma_conn_get_stats(cstate->conn, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.recvs, 0);
+	assert_int_equal(stats.post_errors, 1);
+	assert_int_equal(stats.rq_full, 1);
+	assert_int_equal(stats.sq_full, 0);
+}
+
+/*
+ * group_setup_get_stats -- prepare resources for all tests in the group
+ */
+static int
+group_setup_get_stats(void **unused)
+{
+	/* set value of QP in mock of CM ID */
+	Cm_id.qp = MOCK_QP;
+
+	return 0;
+}
+
+static const struct CMUnitTest tests_get_stats[] = {
+	/* rpma_conn_get_stats() unit tests */
+	cmocka_unit_test(get_stats__conn_NULL),
+	cmocka_unit_test_setup_teardown(get_stats__stats_NULL,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(get_stats__zeroed,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(get_stats__read,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(get_stats__read_sq_full,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(get_stats__read_error,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test_setup_teardown(get_stats__recv_rq_full,
+		setup__conn_new, teardown__conn_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_get_stats, group_setup_get_stats, NULL);
+}
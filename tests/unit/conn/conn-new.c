@@ -13,6 +13,10 @@
 #include "conn-common.h"
 #include "mocks-ibverbs.h"
 #include "mocks-rdma_cm.h"
+#include "mocks-rpma-conn_evch.h"
+#include "mocks-rpma-flush.h"
+#include "mocks-rpma-peer.h"
+#include "mocks-rpma-res_pool.h"
 #include "test-common.h"
 
 /*
@@ -24,7 +28,7 @@ new__peer_NULL(void **unused)
 	/* run test */
 	struct rpma_conn *conn = NULL;
 	int ret = rpma_conn_new(NULL, MOCK_CM_ID, MOCK_RPMA_CQ, NULL, NULL,
-				&conn);
+				NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_INVAL);
@@ -40,7 +44,7 @@ new__id_NULL(void **unused)
 	/* run test */
 	struct rpma_conn *conn = NULL;
 	int ret = rpma_conn_new(MOCK_PEER, NULL, MOCK_RPMA_CQ, NULL, NULL,
-				&conn);
+				NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_INVAL);
@@ -55,7 +59,7 @@ new__cq_NULL(void **unused)
 {
 	/* run test */
 	struct rpma_conn *conn = NULL;
-	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, NULL, NULL, NULL, &conn);
+	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, NULL, NULL, NULL, NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_INVAL);
@@ -70,7 +74,7 @@ new__conn_ptr_NULL(void **unused)
 {
 	/* run test */
 	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
-			NULL, NULL);
+			NULL, NULL, NULL);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_INVAL);
@@ -84,7 +88,7 @@ static void
 new__peer_id_cq_conn_ptr_NULL(void **unused)
 {
 	/* run test */
-	int ret = rpma_conn_new(NULL, NULL, NULL, NULL, NULL, NULL);
+	int ret = rpma_conn_new(NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_INVAL);
@@ -105,7 +109,7 @@ new__create_evch_ERRNO(void **unused)
 	/* run test */
 	struct rpma_conn *conn = NULL;
 	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
-			NULL, &conn);
+			NULL, NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_PROVIDER);
@@ -128,7 +132,7 @@ new__migrate_id_ERRNO(void **unused)
 	/* run test */
 	struct rpma_conn *conn = NULL;
 	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
-			NULL, &conn);
+			NULL, NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_PROVIDER);
@@ -146,11 +150,12 @@ new__flush_E_NOMEM(void **unused)
 	will_return_maybe(rdma_create_event_channel, MOCK_EVCH);
 	Rdma_migrate_id_counter = RDMA_MIGRATE_COUNTER_INIT;
 	will_return_maybe(rdma_migrate_id, MOCK_OK);
+	will_return_maybe(__wrap__test_malloc, MOCK_OK);
 
 	/* run test */
 	struct rpma_conn *conn = NULL;
 	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
-			NULL, &conn);
+			NULL, NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_NOMEM);
@@ -174,13 +179,98 @@ new__malloc_ERRNO(void **unused)
 	/* run test */
 	struct rpma_conn *conn = NULL;
 	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
-			NULL, &conn);
+			NULL, NULL, &conn);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_NOMEM);
 	assert_null(conn);
 }
 
+/*
+ * new__conn_table_insert_E_NOMEM - rpma_conn_table_insert() fails with RPMA_E_NOMEM
+ */
+static void
+new__conn_table_insert_E_NOMEM(void **unused)
+{
+	/* configure mock */
+	will_return(rpma_conn_table_insert, RPMA_E_NOMEM);
+	will_return_maybe(rdma_create_event_channel, MOCK_EVCH);
+	Rdma_migrate_id_counter = RDMA_MIGRATE_COUNTER_INIT;
+	will_return_maybe(rdma_migrate_id, MOCK_OK);
+	will_return_maybe(rpma_flush_new, MOCK_OK);
+	will_return_maybe(rpma_flush_delete, MOCK_OK);
+	will_return_maybe(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
+			NULL, NULL, &conn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(conn);
+}
+
+/*
+ * new__shared_evch_migrate_id_ERRNO - rdma_migrate_id() into the shared event channel fails
+ * with MOCK_ERRNO
+ */
+static void
+new__shared_evch_migrate_id_ERRNO(void **unused)
+{
+	/* configure mock */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_conn_evch_get_cm_evch, evch, MOCK_RPMA_CONN_EVCH);
+	Rdma_migrate_id_counter = RDMA_MIGRATE_COUNTER_INIT;
+	will_return(rdma_migrate_id, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
+			NULL, MOCK_RPMA_CONN_EVCH, &conn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(conn);
+	assert_null(Cm_id.context);
+}
+
+/*
+ * new__shared_evch_success - the connection sharing the event channel is created,
+ * it can be found by its CM ID and its events cannot be obtained via rpma_conn_next_event()
+ */
+static void
+new__shared_evch_success(void **unused)
+{
+	struct conn_test_state cstate = Conn_no_rcq_no_channel;
+	struct conn_test_state *cstate_ptr = &cstate;
+
+	/* configure mock */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_conn_evch_get_cm_evch, evch, MOCK_RPMA_CONN_EVCH);
+	Rdma_migrate_id_counter = RDMA_MIGRATE_COUNTER_INIT;
+	will_return(rdma_migrate_id, MOCK_OK);
+	will_return(rpma_flush_new, MOCK_OK);
+	will_return(rpma_conn_table_insert, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, NULL,
+			NULL, MOCK_RPMA_CONN_EVCH, &cstate.conn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(cstate.conn);
+	assert_ptr_equal(Cm_id.context, cstate.conn);
+
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	ret = rpma_conn_next_event(cstate.conn, &c_event);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+
+	/* delete the connection */
+	(void) teardown__conn_delete((void **)&cstate_ptr);
+}
+
 /*
  * conn_test_lifecycle - happy day scenario
  */
@@ -552,6 +642,101 @@ delete__ibv_destroy_comp_channel_E_PROVIDER(void **cstate_ptr)
 	assert_null(cstate->conn);
 }
 
+/*
+ * new_delete__res_pool_recycled -- the flushing object is taken from the pool
+ * and all the recycled resources are given back to it instead of being deleted
+ */
+static void
+new_delete__res_pool_recycled(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+	Mock_res_pool = MOCK_RES_POOL;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+	Rdma_migrate_id_counter = RDMA_MIGRATE_COUNTER_INIT;
+	will_return(rdma_migrate_id, MOCK_OK);
+	will_return(rpma_res_pool_take_flush, MOCK_FLUSH);
+	will_return(rpma_conn_table_insert, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, cstate->rcq,
+			cstate->channel, NULL, &cstate->conn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(cstate->conn);
+
+	/* configure mocks */
+	expect_value(rpma_res_pool_put_flush, flush, MOCK_FLUSH);
+	will_return(rpma_res_pool_put_flush, true);
+	expect_value(rdma_destroy_qp, id, MOCK_CM_ID);
+	expect_value(rpma_res_pool_put_cqs, cq, MOCK_RPMA_CQ);
+	expect_value(rpma_res_pool_put_cqs, rcq, cstate->rcq);
+	expect_value(rpma_res_pool_put_cqs, channel, cstate->channel);
+	will_return(rpma_res_pool_put_cqs, true);
+	expect_value_count(rpma_cq_delete, *cq_ptr, NULL, 2);
+	will_return_count(rpma_cq_delete, MOCK_OK, 2);
+	expect_value(rdma_destroy_id, id, MOCK_CM_ID);
+	will_return(rdma_destroy_id, MOCK_OK);
+	expect_value(rpma_private_data_delete, pdata->ptr, NULL);
+	expect_value(rpma_private_data_delete, pdata->len, 0);
+
+	/* run test */
+	ret = rpma_conn_delete(&cstate->conn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(cstate->conn);
+
+	Mock_res_pool = NULL;
+}
+
+/*
+ * new_delete__res_pool_full -- the pool keeps nothing so all the resources are created
+ * and deleted as usual
+ */
+static void
+new_delete__res_pool_full(void **cstate_ptr)
+{
+	struct conn_test_state *cstate = *cstate_ptr;
+	Mock_res_pool = MOCK_RES_POOL;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+	Rdma_migrate_id_counter = RDMA_MIGRATE_COUNTER_INIT;
+	will_return(rdma_migrate_id, MOCK_OK);
+	will_return(rpma_res_pool_take_flush, NULL);
+	will_return(rpma_flush_new, MOCK_OK);
+	will_return(rpma_conn_table_insert, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_new(MOCK_PEER, MOCK_CM_ID, MOCK_RPMA_CQ, cstate->rcq,
+			cstate->channel, NULL, &cstate->conn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(cstate->conn);
+
+	/* configure mocks */
+	expect_value(rpma_res_pool_put_flush, flush, MOCK_FLUSH);
+	will_return(rpma_res_pool_put_flush, false);
+	expect_value(rpma_res_pool_put_cqs, cq, MOCK_RPMA_CQ);
+	expect_value(rpma_res_pool_put_cqs, rcq, cstate->rcq);
+	expect_value(rpma_res_pool_put_cqs, channel, cstate->channel);
+	will_return(rpma_res_pool_put_cqs, false);
+
+	/* run test */
+	ret = teardown__conn_delete((void **)&cstate);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	Mock_res_pool = NULL;
+}
+
 static const struct CMUnitTest tests_new[] = {
 	/* rpma_conn_new() unit tests */
 	cmocka_unit_test(new__peer_NULL),
@@ -563,6 +748,9 @@ static const struct CMUnitTest tests_new[] = {
 	cmocka_unit_test(new__migrate_id_ERRNO),
 	cmocka_unit_test(new__flush_E_NOMEM),
 	cmocka_unit_test(new__malloc_ERRNO),
+	cmocka_unit_test(new__conn_table_insert_E_NOMEM),
+	cmocka_unit_test(new__shared_evch_migrate_id_ERRNO),
+	cmocka_unit_test(new__shared_evch_success),
 
 	/* rpma_conn_new()/_delete() lifecycle */
 	CONN_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ_CHANNEL(
@@ -584,6 +772,10 @@ static const struct CMUnitTest tests_new[] = {
 	CONN_TEST_WITH_AND_WITHOUT_RCQ_CHANNEL(delete__destroy_id_ERRNO),
 	CONN_TEST_WITH_AND_WITHOUT_RCQ_CHANNEL(
 		delete__ibv_destroy_comp_channel_E_PROVIDER),
+
+	/* rpma_conn_new()/_delete() with the pool of recycled resources */
+	CONN_TEST_WITH_AND_WITHOUT_RCQ_CHANNEL(new_delete__res_pool_recycled),
+	CONN_TEST_WITH_AND_WITHOUT_RCQ_CHANNEL(new_delete__res_pool_full),
 	cmocka_unit_test(NULL)
 };
 
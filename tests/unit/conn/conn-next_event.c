@@ -10,6 +10,7 @@
  */
 
 #include "conn-common.h"
+#include "mocks-ibverbs.h"
 #include "mocks-rdma_cm.h"
 
 /*
@@ -435,6 +436,10 @@ next_event__success_DEVICE_REMOVAL(void **cstate_ptr)
 	expect_value(rdma_ack_cm_event, event, &event);
 	will_return(rdma_ack_cm_event, MOCK_OK);
 
+	/* the cached addresses of the removed device are dropped */
+	Cm_id.verbs = MOCK_VERBS;
+	expect_value(rpma_addr_cache_invalidate, ibv_ctx, MOCK_VERBS);
+
 	/* run test */
 	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
 	int ret = rpma_conn_next_event(cstate->conn, &c_event);
@@ -442,6 +447,8 @@ next_event__success_DEVICE_REMOVAL(void **cstate_ptr)
 	/* verify the results */
 	assert_int_equal(ret, MOCK_OK);
 	assert_int_equal(c_event, RPMA_CONN_LOST);
+
+	Cm_id.verbs = NULL;
 }
 
 /*
@@ -120,6 +120,7 @@ send_with_imm__success(void **cstate_ptr)
 	expect_value(rpma_mr_send, flags, MOCK_FLAGS);
 	expect_value(rpma_mr_send, operation, IBV_WR_SEND_WITH_IMM);
 	expect_value(rpma_mr_send, imm, MOCK_IMM_DATA);
+	expect_value(rpma_mr_send, fence, false);
 	expect_value(rpma_mr_send, op_context, MOCK_OP_CONTEXT);
 	will_return(rpma_mr_send, MOCK_OK);
 
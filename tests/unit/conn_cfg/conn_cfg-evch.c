@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_cfg-evch.c -- the rpma_conn_cfg_set/get_evch() unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_cfg_set_evch()
+ * - rpma_conn_cfg_get_evch()
+ */
+
+#include "conn_cfg-common.h"
+#include "test-common.h"
+#include "mocks-rpma-conn_evch.h"
+
+/*
+ * set__cfg_NULL -- NULL cfg is invalid
+ */
+static void
+set__cfg_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_cfg_set_evch(NULL, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get__cfg_NULL -- NULL cfg is invalid
+ */
+static void
+get__cfg_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_evch *evch = NULL;
+	int ret = rpma_conn_cfg_get_evch(NULL, &evch);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get__evch_ptr_NULL -- NULL evch_ptr is invalid
+ */
+static void
+get__evch_ptr_NULL(void **cstate_ptr)
+{
+	struct conn_cfg_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_cfg_get_evch(cstate->cfg, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * evch__lifecycle -- happy day scenario
+ */
+static void
+evch__lifecycle(void **cstate_ptr)
+{
+	struct conn_cfg_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_cfg_set_evch(cstate->cfg, MOCK_RPMA_CONN_EVCH);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	struct rpma_conn_evch *evch = NULL;
+	ret = rpma_conn_cfg_get_evch(cstate->cfg, &evch);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(evch, MOCK_RPMA_CONN_EVCH);
+}
+
+/*
+ * get__default -- the CM event channel is not shared by default
+ */
+static void
+get__default(void **cstate_ptr)
+{
+	struct conn_cfg_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	struct rpma_conn_evch *evch = MOCK_RPMA_CONN_EVCH;
+	int ret = rpma_conn_cfg_get_evch(cstate->cfg, &evch);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(evch);
+}
+
+static const struct CMUnitTest test_evch[] = {
+	/* rpma_conn_cfg_set_evch() unit tests */
+	cmocka_unit_test(set__cfg_NULL),
+
+	/* rpma_conn_cfg_get_evch() unit tests */
+	cmocka_unit_test(get__cfg_NULL),
+	cmocka_unit_test_setup_teardown(get__evch_ptr_NULL,
+		setup__conn_cfg, teardown__conn_cfg),
+	cmocka_unit_test_setup_teardown(get__default,
+		setup__conn_cfg, teardown__conn_cfg),
+
+	/* rpma_conn_cfg_set/get_evch() lifecycle */
+	cmocka_unit_test_setup_teardown(evch__lifecycle,
+		setup__conn_cfg, teardown__conn_cfg),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(test_evch, NULL, NULL);
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch-common.c -- the rpma_conn_evch unit tests common functions
+ */
+
+#include "conn.h"
+#include "conn_evch-common.h"
+
+static struct conn_evch_test_state Conn_evch_state;
+
+/*
+ * rpma_conn_handle_cm_event -- rpma_conn_handle_cm_event() mock
+ */
+int
+rpma_conn_handle_cm_event(struct rpma_conn *conn, struct rdma_cm_event *edata,
+		enum rpma_conn_event *event)
+{
+	check_expected_ptr(conn);
+	check_expected_ptr(edata);
+	assert_non_null(event);
+
+	int ret = mock_type(int);
+	if (ret)
+		return ret;
+
+	*event = mock_type(enum rpma_conn_event);
+
+	return 0;
+}
+
+/*
+ * setup__conn_evch_new -- prepare a valid rpma_conn_evch object
+ */
+int
+setup__conn_evch_new(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = &Conn_evch_state;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+
+	/* prepare an object */
+	int ret = rpma_conn_evch_new(&cstate->evch);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(cstate->evch);
+
+	*cstate_ptr = cstate;
+
+	return 0;
+}
+
+/*
+ * teardown__conn_evch_delete -- delete the rpma_conn_evch object
+ */
+int
+teardown__conn_evch_delete(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* delete the object */
+	int ret = rpma_conn_evch_delete(&cstate->evch);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(cstate->evch);
+
+	*cstate_ptr = NULL;
+
+	return 0;
+}
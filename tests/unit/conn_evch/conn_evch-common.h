@@ -0,0 +1,27 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch-common.h -- the rpma_conn_evch unit tests common definitions
+ */
+
+#ifndef CONN_EVCH_COMMON_H
+#define CONN_EVCH_COMMON_H
+
+#include "cmocka_headers.h"
+#include "conn_evch.h"
+#include "mocks-rdma_cm.h"
+#include "test-common.h"
+
+#define MOCK_CONN	(struct rpma_conn *)0xC004
+#define MOCK_FD		0x00FD
+
+/* all the resources used between setup__conn_evch_new and teardown__conn_evch_delete */
+struct conn_evch_test_state {
+	struct rpma_conn_evch *evch;
+};
+
+int setup__conn_evch_new(void **cstate_ptr);
+int teardown__conn_evch_delete(void **cstate_ptr);
+
+#endif /* CONN_EVCH_COMMON_H */
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch-get_fd.c -- the rpma_conn_evch_get_fd() unit tests
+ *
+ * API covered:
+ * - rpma_conn_evch_get_fd()
+ */
+
+#include "conn_evch-common.h"
+
+/*
+ * get_fd__evch_NULL -- NULL evch is invalid
+ */
+static void
+get_fd__evch_NULL(void **unused)
+{
+	/* run test */
+	int fd = 0;
+	int ret = rpma_conn_evch_get_fd(NULL, &fd);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(fd, 0);
+}
+
+/*
+ * get_fd__fd_NULL -- NULL fd is invalid
+ */
+static void
+get_fd__fd_NULL(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_evch_get_fd(cstate->evch, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_fd__success -- happy day scenario
+ */
+static void
+get_fd__success(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	Evch.fd = MOCK_FD;
+
+	/* run test */
+	int fd = 0;
+	int ret = rpma_conn_evch_get_fd(cstate->evch, &fd);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(fd, MOCK_FD);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_conn_evch_get_fd() unit tests */
+		cmocka_unit_test(get_fd__evch_NULL),
+		cmocka_unit_test_setup_teardown(get_fd__fd_NULL,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(get_fd__success,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch-new_delete.c -- the rpma_conn_evch_new/delete() unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_evch_new()
+ * - rpma_conn_evch_delete()
+ */
+
+#include "conn_evch-common.h"
+
+/*
+ * new__evch_ptr_NULL -- NULL evch_ptr is invalid
+ */
+static void
+new__evch_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_evch_new(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new__malloc_ERRNO -- malloc() fails with MOCK_ERRNO
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn_evch *evch = NULL;
+	int ret = rpma_conn_evch_new(&evch);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(evch);
+}
+
+/*
+ * new__create_evch_ERRNO -- rdma_create_event_channel() fails with MOCK_ERRNO
+ */
+static void
+new__create_evch_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rdma_create_event_channel, NULL);
+	will_return(rdma_create_event_channel, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn_evch *evch = NULL;
+	int ret = rpma_conn_evch_new(&evch);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(evch);
+}
+
+/*
+ * delete__evch_ptr_NULL -- NULL evch_ptr is invalid
+ */
+static void
+delete__evch_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_evch_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * delete__evch_NULL -- NULL evch is valid - quick exit
+ */
+static void
+delete__evch_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_evch *evch = NULL;
+	int ret = rpma_conn_evch_delete(&evch);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * evch__lifecycle -- happy day scenario
+ */
+static void
+evch__lifecycle(void **unused)
+{
+	/*
+	 * The thing is done by setup__conn_evch_new()
+	 * and teardown__conn_evch_delete().
+	 */
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_conn_evch_new() unit tests */
+		cmocka_unit_test(new__evch_ptr_NULL),
+		cmocka_unit_test(new__malloc_ERRNO),
+		cmocka_unit_test(new__create_evch_ERRNO),
+
+		/* rpma_conn_evch_delete() unit tests */
+		cmocka_unit_test(delete__evch_ptr_NULL),
+		cmocka_unit_test(delete__evch_NULL),
+
+		/* rpma_conn_evch_new()/_delete() lifecycle */
+		cmocka_unit_test_setup_teardown(evch__lifecycle,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_evch-next_event.c -- the rpma_conn_evch_next_event() unit tests
+ *
+ * API covered:
+ * - rpma_conn_evch_next_event()
+ */
+
+#include "conn_evch-common.h"
+
+/*
+ * next_event__evch_NULL -- NULL evch is invalid
+ */
+static void
+next_event__evch_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(NULL, &conn, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(conn);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+}
+
+/*
+ * next_event__conn_ptr_NULL -- NULL conn_ptr is invalid
+ */
+static void
+next_event__conn_ptr_NULL(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(cstate->evch, NULL, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+}
+
+/*
+ * next_event__event_NULL -- NULL event is invalid
+ */
+static void
+next_event__event_NULL(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_conn_evch_next_event(cstate->evch, &conn, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(conn);
+}
+
+/*
+ * next_event__get_cm_event_ENODATA -- rdma_get_cm_event() fails with ENODATA
+ */
+static void
+next_event__get_cm_event_ENODATA(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, NULL);
+	will_return(rdma_get_cm_event, ENODATA);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(cstate->evch, &conn, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_EVENT);
+	assert_null(conn);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+}
+
+/*
+ * next_event__get_cm_event_ERRNO -- rdma_get_cm_event() fails with MOCK_ERRNO
+ */
+static void
+next_event__get_cm_event_ERRNO(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, NULL);
+	will_return(rdma_get_cm_event, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(cstate->evch, &conn, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(conn);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+}
+
+/*
+ * next_event__context_NULL -- the event does not concern any connection
+ */
+static void
+next_event__context_NULL(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	struct rdma_cm_event event = {0};
+	event.event = RDMA_CM_EVENT_ESTABLISHED;
+	event.id = MOCK_CM_ID;
+	Cm_id.context = NULL;
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, &event);
+	expect_value(rdma_ack_cm_event, event, &event);
+	will_return(rdma_ack_cm_event, MOCK_OK);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(cstate->evch, &conn, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_UNKNOWN);
+	assert_null(conn);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+}
+
+/*
+ * next_event__handle_cm_event_E_UNKNOWN -- the event of the connection cannot be handled
+ */
+static void
+next_event__handle_cm_event_E_UNKNOWN(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	struct rdma_cm_event event = {0};
+	event.event = RDMA_CM_EVENT_ADDR_RESOLVED;
+	event.id = MOCK_CM_ID;
+	Cm_id.context = MOCK_CONN;
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, &event);
+	expect_value(rpma_conn_handle_cm_event, conn, MOCK_CONN);
+	expect_value(rpma_conn_handle_cm_event, edata, &event);
+	will_return(rpma_conn_handle_cm_event, RPMA_E_UNKNOWN);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(cstate->evch, &conn, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_UNKNOWN);
+	assert_ptr_equal(conn, MOCK_CONN);
+	assert_int_equal(c_event, RPMA_CONN_UNDEFINED);
+
+	Cm_id.context = NULL;
+}
+
+/*
+ * next_event__success -- the event is returned along with the connection it concerns
+ */
+static void
+next_event__success(void **cstate_ptr)
+{
+	struct conn_evch_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	struct rdma_cm_event event = {0};
+	event.event = RDMA_CM_EVENT_ESTABLISHED;
+	event.id = MOCK_CM_ID;
+	Cm_id.context = MOCK_CONN;
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, &event);
+	expect_value(rpma_conn_handle_cm_event, conn, MOCK_CONN);
+	expect_value(rpma_conn_handle_cm_event, edata, &event);
+	will_return(rpma_conn_handle_cm_event, MOCK_OK);
+	will_return(rpma_conn_handle_cm_event, RPMA_CONN_ESTABLISHED);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	enum rpma_conn_event c_event = RPMA_CONN_UNDEFINED;
+	int ret = rpma_conn_evch_next_event(cstate->evch, &conn, &c_event);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(conn, MOCK_CONN);
+	assert_int_equal(c_event, RPMA_CONN_ESTABLISHED);
+
+	Cm_id.context = NULL;
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_conn_evch_next_event() unit tests */
+		cmocka_unit_test(next_event__evch_NULL),
+		cmocka_unit_test_setup_teardown(next_event__conn_ptr_NULL,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(next_event__event_NULL,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(next_event__get_cm_event_ENODATA,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(next_event__get_cm_event_ERRNO,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(next_event__context_NULL,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(next_event__handle_cm_event_E_UNKNOWN,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test_setup_teardown(next_event__success,
+			setup__conn_evch_new, teardown__conn_evch_delete),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_fanout-common.c -- the rpma_conn_connect_all() unit tests common functions
+ */
+
+#include "conn_fanout-common.h"
+
+static const char *Addrs[MOCK_NUM_TARGETS] = {"192.168.0.1", "192.168.0.2", "192.168.0.3"};
+
+struct rpma_conn_target Targets[MOCK_NUM_TARGETS];
+
+/*
+ * __wrap_poll -- poll() mock reporting all the file descriptors as ready
+ */
+int
+__wrap_poll(struct pollfd *fds, nfds_t nfds, int timeout)
+{
+	assert_non_null(fds);
+	check_expected(nfds);
+	assert_int_equal(timeout, -1);
+
+	int ret = mock_type(int);
+	if (ret < 0) {
+		errno = mock_type(int);
+		return -1;
+	}
+
+	for (nfds_t i = 0; i < nfds; i++) {
+		assert_int_equal(fds[i].events, POLLIN);
+		fds[i].revents = POLLIN;
+	}
+
+	return (int)nfds;
+}
+
+/*
+ * configure_targets -- prepare the targets with invalid output values
+ */
+void
+configure_targets(void)
+{
+	for (int i = 0; i < MOCK_NUM_TARGETS; i++) {
+		Targets[i].addr = Addrs[i];
+		Targets[i].port = MOCK_PORT;
+		Targets[i].cfg = NULL;
+		Targets[i].pdata = NULL;
+		Targets[i].conn = MOCK_CONN;
+		Targets[i].result = MOCK_ERRNO;
+	}
+}
+
+/*
+ * configure_poll -- configure mocks for poll() of nfds file descriptors
+ */
+void
+configure_poll(nfds_t nfds, int ret)
+{
+	expect_value(__wrap_poll, nfds, nfds);
+	will_return(__wrap_poll, ret);
+	if (ret < 0)
+		will_return(__wrap_poll, MOCK_ERRNO);
+}
+
+/*
+ * configure_start -- configure mocks for starting connecting the target
+ */
+void
+configure_start(int i)
+{
+	expect_value(rpma_conn_req_new_async, addr, Addrs[i]);
+	expect_value(rpma_conn_req_new_async, cfg, NULL);
+	will_return(rpma_conn_req_new_async, MOCK_REQ(i));
+	expect_value(rpma_conn_req_get_fd, req, MOCK_REQ(i));
+	will_return(rpma_conn_req_get_fd, MOCK_OK);
+	will_return(rpma_conn_req_get_fd, MOCK_REQ_FD(i));
+}
+
+/*
+ * configure_step -- configure mocks for rpma_conn_req_step() of the target
+ */
+void
+configure_step(int i, int ret, enum rpma_conn_req_state state)
+{
+	expect_value(rpma_conn_req_step, req, MOCK_REQ(i));
+	will_return(rpma_conn_req_step, ret);
+	if (ret == MOCK_OK)
+		will_return(rpma_conn_req_step, state);
+}
+
+/*
+ * configure_connect -- configure mocks for rpma_conn_req_connect()
+ * and rpma_conn_get_event_fd() of the target
+ */
+void
+configure_connect(int i, int ret)
+{
+	expect_value(rpma_conn_req_connect, req, MOCK_REQ(i));
+	expect_value(rpma_conn_req_connect, pdata, NULL);
+	if (ret) {
+		will_return(rpma_conn_req_connect, NULL);
+		will_return(rpma_conn_req_connect, ret);
+		return;
+	}
+
+	will_return(rpma_conn_req_connect, MOCK_TARGET_CONN(i));
+	expect_value(rpma_conn_get_event_fd, conn, MOCK_TARGET_CONN(i));
+	will_return(rpma_conn_get_event_fd, MOCK_OK);
+	will_return(rpma_conn_get_event_fd, MOCK_CONN_FD(i));
+}
+
+/*
+ * configure_next_event -- configure mocks for rpma_conn_next_event() of the target
+ */
+void
+configure_next_event(int i, int ret, enum rpma_conn_event event)
+{
+	expect_value(rpma_conn_next_event, conn, MOCK_TARGET_CONN(i));
+	will_return(rpma_conn_next_event, ret);
+	if (ret == MOCK_OK)
+		will_return(rpma_conn_next_event, event);
+}
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_fanout-common.h -- the rpma_conn_connect_all() unit tests common definitions
+ */
+
+#ifndef CONN_FANOUT_COMMON_H
+#define CONN_FANOUT_COMMON_H
+
+#include <errno.h>
+#include <poll.h>
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "test-common.h"
+
+#define MOCK_NUM_TARGETS	3
+
+#define MOCK_REQ(i)		((struct rpma_conn_req *)(uintptr_t)(0xC410 + (i)))
+#define MOCK_TARGET_CONN(i)	((struct rpma_conn *)(uintptr_t)(0xC000 + (i)))
+#define MOCK_REQ_FD(i)		(0x100 + (i))
+#define MOCK_CONN_FD(i)		(0x200 + (i))
+
+extern struct rpma_conn_target Targets[MOCK_NUM_TARGETS];
+
+void configure_targets(void);
+void configure_poll(nfds_t nfds, int ret);
+void configure_start(int i);
+void configure_step(int i, int ret, enum rpma_conn_req_state state);
+void configure_connect(int i, int ret);
+void configure_next_event(int i, int ret, enum rpma_conn_event event);
+
+#endif /* CONN_FANOUT_COMMON_H */
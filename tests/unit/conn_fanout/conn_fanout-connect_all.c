@@ -0,0 +1,321 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_fanout-connect_all.c -- the rpma_conn_connect_all() unit tests
+ *
+ * API covered:
+ * - rpma_conn_connect_all()
+ */
+
+#include "conn_fanout-common.h"
+
+/*
+ * connect_all__peer_NULL -- NULL peer is invalid
+ */
+static void
+connect_all__peer_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_connect_all(NULL, Targets, MOCK_NUM_TARGETS, MOCK_NUM_TARGETS);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * connect_all__targets_NULL -- NULL targets is invalid
+ */
+static void
+connect_all__targets_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, NULL, MOCK_NUM_TARGETS, MOCK_NUM_TARGETS);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * connect_all__num_targets_0 -- num_targets == 0 is invalid
+ */
+static void
+connect_all__num_targets_0(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 0, MOCK_NUM_TARGETS);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * connect_all__max_inflight_0 -- max_inflight == 0 is invalid
+ */
+static void
+connect_all__max_inflight_0(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, MOCK_NUM_TARGETS, 0);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * connect_all__malloc_ERRNO -- malloc() fails with MOCK_ERRNO
+ */
+static void
+connect_all__malloc_ERRNO(void **unused)
+{
+	for (int i = 0; i < 2; i++) {
+		/* configure mocks */
+		if (i > 0)
+			will_return(__wrap__test_malloc, MOCK_OK);
+		will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+		/* run test */
+		int ret = rpma_conn_connect_all(MOCK_PEER, Targets, MOCK_NUM_TARGETS,
+				MOCK_NUM_TARGETS);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_NOMEM);
+	}
+}
+
+/*
+ * connect_all__new_async_E_PROVIDER -- rpma_conn_req_new_async() fails with RPMA_E_PROVIDER
+ */
+static void
+connect_all__new_async_E_PROVIDER(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	expect_value(rpma_conn_req_new_async, addr, Targets[0].addr);
+	expect_value(rpma_conn_req_new_async, cfg, NULL);
+	will_return(rpma_conn_req_new_async, NULL);
+	will_return(rpma_conn_req_new_async, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 1, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Targets[0].result, RPMA_E_PROVIDER);
+	assert_null(Targets[0].conn);
+}
+
+/*
+ * connect_all__step_E_PROVIDER -- rpma_conn_req_step() fails with RPMA_E_PROVIDER
+ */
+static void
+connect_all__step_E_PROVIDER(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	configure_start(0);
+	configure_poll(1, MOCK_OK);
+	configure_step(0, RPMA_E_PROVIDER, RPMA_CONN_REQ_READY);
+	expect_value(rpma_conn_req_delete, req, MOCK_REQ(0));
+	will_return(rpma_conn_req_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 1, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Targets[0].result, RPMA_E_PROVIDER);
+	assert_null(Targets[0].conn);
+}
+
+/*
+ * connect_all__connect_E_PROVIDER -- rpma_conn_req_connect() fails with RPMA_E_PROVIDER
+ */
+static void
+connect_all__connect_E_PROVIDER(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	configure_start(0);
+	configure_poll(1, MOCK_OK);
+	configure_step(0, MOCK_OK, RPMA_CONN_REQ_READY);
+	configure_connect(0, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 1, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Targets[0].result, RPMA_E_PROVIDER);
+	assert_null(Targets[0].conn);
+}
+
+/*
+ * connect_all__rejected -- the connection is rejected
+ */
+static void
+connect_all__rejected(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	configure_start(0);
+	configure_poll(1, MOCK_OK);
+	configure_step(0, MOCK_OK, RPMA_CONN_REQ_READY);
+	configure_connect(0, MOCK_OK);
+	configure_poll(1, MOCK_OK);
+	configure_next_event(0, MOCK_OK, RPMA_CONN_REJECTED);
+	expect_value(rpma_conn_delete, conn, MOCK_TARGET_CONN(0));
+	will_return(rpma_conn_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 1, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Targets[0].result, RPMA_E_PROVIDER);
+	assert_null(Targets[0].conn);
+}
+
+/*
+ * connect_all__poll_ERRNO -- poll() fails with MOCK_ERRNO
+ */
+static void
+connect_all__poll_ERRNO(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	configure_start(0);
+	configure_poll(1, -1);
+	expect_value(rpma_conn_req_delete, req, MOCK_REQ(0));
+	will_return(rpma_conn_req_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 2, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	for (int i = 0; i < 2; i++) {
+		assert_int_equal(Targets[i].result, RPMA_E_PROVIDER);
+		assert_null(Targets[i].conn);
+	}
+}
+
+/*
+ * connect_all__poll_ERRNO_established -- poll() fails with MOCK_ERRNO after one of the targets
+ * has been connected
+ */
+static void
+connect_all__poll_ERRNO_established(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	configure_start(0);
+	configure_poll(1, MOCK_OK);
+	configure_step(0, MOCK_OK, RPMA_CONN_REQ_READY);
+	configure_connect(0, MOCK_OK);
+	configure_poll(1, MOCK_OK);
+	configure_next_event(0, MOCK_OK, RPMA_CONN_ESTABLISHED);
+	configure_start(1);
+	configure_poll(1, -1);
+	expect_value(rpma_conn_req_delete, req, MOCK_REQ(1));
+	will_return(rpma_conn_req_delete, MOCK_OK);
+	/* the established connection is closed */
+	expect_value(rpma_conn_disconnect, conn, MOCK_TARGET_CONN(0));
+	will_return(rpma_conn_disconnect, MOCK_OK);
+	configure_next_event(0, MOCK_OK, RPMA_CONN_CLOSED);
+	expect_value(rpma_conn_delete, conn, MOCK_TARGET_CONN(0));
+	will_return(rpma_conn_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, 2, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	for (int i = 0; i < 2; i++) {
+		assert_int_equal(Targets[i].result, RPMA_E_PROVIDER);
+		assert_null(Targets[i].conn);
+	}
+}
+
+/*
+ * connect_all__success -- all the targets are connected with at most two of them
+ * being connected at the same time
+ */
+static void
+connect_all__success(void **unused)
+{
+	configure_targets();
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	configure_start(0);
+	configure_start(1);
+	/* poll() interrupted by a signal is restarted */
+	expect_value(__wrap_poll, nfds, 2);
+	will_return(__wrap_poll, -1);
+	will_return(__wrap_poll, EINTR);
+	/* the slots are handled from the last one */
+	configure_poll(2, MOCK_OK);
+	configure_step(1, MOCK_OK, RPMA_CONN_REQ_ROUTE_RESOLVING);
+	configure_step(0, MOCK_OK, RPMA_CONN_REQ_READY);
+	configure_connect(0, MOCK_OK);
+	configure_poll(2, MOCK_OK);
+	configure_step(1, MOCK_OK, RPMA_CONN_REQ_READY);
+	configure_connect(1, MOCK_OK);
+	configure_next_event(0, MOCK_OK, RPMA_CONN_ESTABLISHED);
+	/* the target #1 takes the slot of the target #0 and the target #2 starts */
+	configure_start(2);
+	configure_poll(2, MOCK_OK);
+	configure_step(2, RPMA_E_NO_EVENT, RPMA_CONN_REQ_READY);
+	configure_next_event(1, MOCK_OK, RPMA_CONN_ESTABLISHED);
+	configure_poll(1, MOCK_OK);
+	configure_step(2, MOCK_OK, RPMA_CONN_REQ_READY);
+	configure_connect(2, MOCK_OK);
+	configure_poll(1, MOCK_OK);
+	configure_next_event(2, MOCK_OK, RPMA_CONN_ESTABLISHED);
+
+	/* run test */
+	int ret = rpma_conn_connect_all(MOCK_PEER, Targets, MOCK_NUM_TARGETS, 2);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	for (int i = 0; i < MOCK_NUM_TARGETS; i++) {
+		assert_int_equal(Targets[i].result, MOCK_OK);
+		assert_ptr_equal(Targets[i].conn, MOCK_TARGET_CONN(i));
+	}
+}
+
+static const struct CMUnitTest tests_connect_all[] = {
+	/* rpma_conn_connect_all() unit tests */
+	cmocka_unit_test(connect_all__peer_NULL),
+	cmocka_unit_test(connect_all__targets_NULL),
+	cmocka_unit_test(connect_all__num_targets_0),
+	cmocka_unit_test(connect_all__max_inflight_0),
+	cmocka_unit_test(connect_all__malloc_ERRNO),
+	cmocka_unit_test(connect_all__new_async_E_PROVIDER),
+	cmocka_unit_test(connect_all__step_E_PROVIDER),
+	cmocka_unit_test(connect_all__connect_E_PROVIDER),
+	cmocka_unit_test(connect_all__rejected),
+	cmocka_unit_test(connect_all__poll_ERRNO),
+	cmocka_unit_test(connect_all__poll_ERRNO_established),
+	cmocka_unit_test(connect_all__success),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_connect_all, NULL, NULL);
+}
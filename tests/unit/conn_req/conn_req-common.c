@@ -126,20 +126,17 @@ configure_conn_req(void **cstate_ptr)
 }
 
 /*
- * setup__conn_req_new_from_cm_event -- prepare a valid rpma_conn_req object from CM
- * event
+ * configure_conn_req_setup_id -- configure mocks for equipping the CM ID of the incoming
+ * connection request with QP and CQ
  */
-int
-setup__conn_req_new_from_cm_event(void **cstate_ptr)
+void
+configure_conn_req_setup_id(struct conn_req_test_state *cstate)
 {
-	struct conn_req_test_state *cstate = *cstate_ptr;
-	configure_conn_req((void **)&cstate);
-
-	/* configure mocks */
 	will_return(rpma_conn_cfg_get_cqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -159,6 +156,20 @@ setup__conn_req_new_from_cm_event(void **cstate_ptr)
 	expect_value(rpma_peer_setup_qp, cfg, cstate->get_args.cfg);
 	expect_value(rpma_peer_setup_qp, rcq, MOCK_GET_RCQ(cstate));
 	will_return(rpma_peer_setup_qp, MOCK_OK);
+}
+
+/*
+ * setup__conn_req_new_from_cm_event -- prepare a valid rpma_conn_req object from CM
+ * event
+ */
+int
+setup__conn_req_new_from_cm_event(void **cstate_ptr)
+{
+	struct conn_req_test_state *cstate = *cstate_ptr;
+	configure_conn_req((void **)&cstate);
+
+	/* configure mocks */
+	configure_conn_req_setup_id(cstate);
 	will_return(__wrap__test_malloc, MOCK_OK);
 	will_return_maybe(__wrap_snprintf, MOCK_OK);
 	will_return(rpma_private_data_store, MOCK_PRIVATE_DATA);
@@ -209,6 +220,61 @@ teardown__conn_req_new_from_cm_event(void **cstate_ptr)
 	return 0;
 }
 
+/*
+ * setup__conn_req_new_deferred -- prepare a pending rpma_conn_req object from CM event
+ */
+int
+setup__conn_req_new_deferred(void **cstate_ptr)
+{
+	struct conn_req_test_state *cstate = *cstate_ptr;
+	configure_conn_req((void **)&cstate);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rpma_private_data_store, MOCK_PRIVATE_DATA);
+
+	/* run test */
+	int ret = rpma_conn_req_new_deferred_from_cm_event(MOCK_PEER, &cstate->event,
+			cstate->get_args.cfg, &cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(cstate->req);
+
+	*cstate_ptr = cstate;
+
+	return 0;
+}
+
+/*
+ * teardown__conn_req_new_deferred -- delete the pending rpma_conn_req object
+ */
+int
+teardown__conn_req_new_deferred(void **cstate_ptr)
+{
+	struct conn_req_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rdma_reject, id, &cstate->id);
+	will_return(rdma_reject, MOCK_OK);
+	expect_function_call(rpma_private_data_delete);
+
+	/* run test */
+	int ret = rpma_conn_req_delete(&cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(cstate->req);
+
+	*cstate_ptr = NULL;
+
+	return 0;
+}
+
 /*
  * setup__conn_req_new -- prepare a new outgoing rpma_conn_req
  */
@@ -233,6 +299,7 @@ setup__conn_req_new(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -302,3 +369,87 @@ teardown__conn_req_new(void **cstate_ptr)
 
 	return 0;
 }
+
+/*
+ * setup__conn_req_new_async -- prepare a new outgoing rpma_conn_req established asynchronously
+ * with its address already resolved (in the RPMA_CONN_REQ_ROUTE_RESOLVING state)
+ */
+int
+setup__conn_req_new_async(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+	configure_conn_req_new((void **)&cstate);
+
+	/* configure mocks for rpma_conn_req_new_async() */
+	Mock_ctrl_defer_destruction = MOCK_CTRL_DEFER;
+	will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+	will_return(rpma_info_new, MOCK_INFO);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+	will_return(rdma_create_id, &cstate->id);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_info_resolve_addr, id, &cstate->id);
+	expect_value(rpma_info_resolve_addr, timeout_ms, cstate->get_args.timeout_ms);
+	will_return(rpma_info_resolve_addr, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT,
+			MOCK_GET_CONN_CFG(cstate), &cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(cstate->req);
+
+	/* configure mocks for rpma_conn_req_step() */
+	cstate->event.event = RDMA_CM_EVENT_ADDR_RESOLVED;
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, &cstate->event);
+	expect_value(rdma_ack_cm_event, event, &cstate->event);
+	will_return(rdma_ack_cm_event, MOCK_OK);
+	expect_value(rdma_resolve_route, timeout_ms, cstate->get_args.timeout_ms);
+	will_return(rdma_resolve_route, MOCK_OK);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(state, RPMA_CONN_REQ_ROUTE_RESOLVING);
+
+	*cstate_ptr = cstate;
+
+	/* restore default mock configuration */
+	Mock_ctrl_defer_destruction = MOCK_CTRL_NO_DEFER;
+
+	return 0;
+}
+
+/*
+ * teardown__conn_req_new_async -- delete the outgoing rpma_conn_req object
+ * established asynchronously which is not ready yet
+ */
+int
+teardown__conn_req_new_async(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rdma_destroy_id, id, &cstate->id);
+	will_return(rdma_destroy_id, MOCK_OK);
+	expect_function_call(rpma_private_data_delete);
+
+	/* run test */
+	int ret = rpma_conn_req_delete(&cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(cstate->req);
+
+	*cstate_ptr = NULL;
+
+	return 0;
+}
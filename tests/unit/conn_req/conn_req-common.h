@@ -91,12 +91,18 @@ extern struct conn_req_test_state Conn_req_conn_cfg_default_with_srq_rcq;
 int setup__conn_req_new_from_cm_event(void **cstate_ptr);
 int teardown__conn_req_new_from_cm_event(void **cstate_ptr);
 
+int setup__conn_req_new_deferred(void **cstate_ptr);
+int teardown__conn_req_new_deferred(void **cstate_ptr);
+
+void configure_conn_req_setup_id(struct conn_req_test_state *cstate);
+
 /*
  * All the resources used between setup__conn_req_new and teardown__conn_req_new
  */
 struct conn_req_new_test_state {
 	struct conn_cfg_get_mock_args get_args;
 
+	struct rdma_cm_event event; /* an event of the asynchronous establishment */
 	struct rdma_cm_id id;
 	struct rpma_conn_req *req;
 };
@@ -109,6 +115,9 @@ extern struct conn_req_new_test_state Conn_req_new_conn_cfg_default_with_srq_rcq
 int setup__conn_req_new(void **cstate_ptr);
 int teardown__conn_req_new(void **cstate_ptr);
 
+int setup__conn_req_new_async(void **cstate_ptr);
+int teardown__conn_req_new_async(void **cstate_ptr);
+
 void configure_conn_req_new(void **cstate_ptr);
 void configure_conn_req(void **cstate_ptr);
 
@@ -577,6 +577,37 @@ connect_via_connect_with_pdata__success_outgoing(void **cstate_ptr)
 	assert_int_equal(conn, MOCK_CONN);
 }
 
+/*
+ * connect__req_not_ready -- a connection request established asynchronously
+ * has to be ready
+ */
+static void
+connect__req_not_ready(void **cstate_ptr)
+{
+	/* WA for cmocka/issues#47 */
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+	assert_int_equal(setup__conn_req_new_async((void **)&cstate), 0);
+	assert_non_null(cstate);
+
+	/* configure mocks for rpma_conn_req_delete() */
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rdma_destroy_id, id, &cstate->id);
+	will_return(rdma_destroy_id, MOCK_OK);
+	expect_function_call(rpma_private_data_delete);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_conn_req_connect(&cstate->req, NULL, &conn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(cstate->req);
+	assert_null(conn);
+}
+
 static const struct CMUnitTest test_connect[] = {
 	/* rpma_conn_req_connect() unit tests */
 	cmocka_unit_test(connect__req_ptr_NULL),
@@ -585,6 +616,7 @@ static const struct CMUnitTest test_connect[] = {
 	cmocka_unit_test(connect__pdata_NULL_pdata_ptr_NULL),
 	cmocka_unit_test(connect__pdata_NULL_pdata_len_0),
 	cmocka_unit_test(connect__pdata_NULL_pdata_ptr_NULL_len_0),
+	cmocka_unit_test(connect__req_not_ready),
 	/* connect via rdma_accept() */
 	CONN_REQ_TEST_WITH_AND_WITHOUT_RCQ(connect_via_accept__accept_ERRNO),
 	CONN_REQ_TEST_WITH_AND_WITHOUT_RCQ(
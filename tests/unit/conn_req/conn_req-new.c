@@ -11,7 +11,10 @@
 
 #include "conn_req-common.h"
 #include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
 #include "mocks-rpma-conn_cfg.h"
+#include "mocks-rpma-peer.h"
+#include "mocks-rpma-res_pool.h"
 
 /*
  * new__peer_NULL -- NULL peer is invalid
@@ -298,6 +301,7 @@ new__shared_true_srq_rcq_not_NULL(void **unused)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, MOCK_RPMA_SRQ_RCQ);
@@ -341,6 +345,7 @@ new__cq_new_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -394,6 +399,7 @@ new__cq_new_ERRNO_subsequent_ERRNO2(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -446,6 +452,7 @@ new__rcq_new_ERRNO(void **unused)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.shared)
 		will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
 	expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
@@ -501,6 +508,7 @@ new__rcq_new_ERRNO_subsequent_ERRNO2(void **unused)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.shared)
 		will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
 	expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
@@ -556,6 +564,7 @@ new__peer_create_qp_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -623,6 +632,7 @@ new__peer_create_qp_ERRNO_subsequent_ERRNO2(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -695,6 +705,7 @@ new__malloc_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -763,6 +774,7 @@ new__malloc_ERRNO_subsequent_ERRNO2(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -821,6 +833,79 @@ new__success(void **unused)
 	 */
 }
 
+/*
+ * new__res_pool -- the CQs are taken from the pool of recycled resources
+ * or created if the pool has no matching ones
+ */
+static void
+new__res_pool(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+	configure_conn_req_new((void **)&cstate);
+	Mock_res_pool = MOCK_RES_POOL;
+
+	for (int taken = 1; taken >= 0; taken--) {
+		/* configure mocks */
+		Mock_ctrl_defer_destruction = MOCK_CTRL_DEFER;
+		will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+		will_return(rpma_info_new, MOCK_INFO);
+		will_return(rdma_create_id, &cstate->id);
+		expect_value(rpma_info_resolve_addr, id, &cstate->id);
+		expect_value(rpma_info_resolve_addr, timeout_ms, cstate->get_args.timeout_ms);
+		will_return(rpma_info_resolve_addr, MOCK_OK);
+		expect_value(rdma_resolve_route, timeout_ms, cstate->get_args.timeout_ms);
+		will_return(rdma_resolve_route, MOCK_OK);
+		will_return(rpma_conn_cfg_get_cqe, &cstate->get_args);
+		will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
+		will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
+		will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+		will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
+		if (cstate->get_args.srq) {
+			expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
+			will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
+		}
+		expect_value(rpma_res_pool_take_cqs, cqe, cstate->get_args.cq_size);
+		expect_value(rpma_res_pool_take_cqs, rcqe,
+				cstate->get_args.srq_rcq ? 0 : cstate->get_args.rcq_size);
+		expect_value(rpma_res_pool_take_cqs, shared, cstate->get_args.shared);
+		will_return(rpma_res_pool_take_cqs, taken);
+		if (!taken) {
+			if (!cstate->get_args.srq_rcq && cstate->get_args.shared)
+				will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
+			expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
+			expect_value(rpma_cq_new, shared_channel, MOCK_GET_CHANNEL(cstate));
+			will_return(rpma_cq_new, MOCK_RPMA_CQ);
+			if (!cstate->get_args.srq_rcq && cstate->get_args.rcq_size) {
+				expect_value(rpma_cq_new, cqe, cstate->get_args.rcq_size);
+				expect_value(rpma_cq_new, shared_channel,
+						MOCK_GET_CHANNEL(cstate));
+				will_return(rpma_cq_new, MOCK_RPMA_RCQ);
+			}
+		}
+		expect_value(rpma_peer_setup_qp, id, &cstate->id);
+		expect_value(rpma_peer_setup_qp, cfg, cstate->get_args.cfg);
+		expect_value(rpma_peer_setup_qp, rcq, MOCK_GET_RCQ(cstate));
+		will_return(rpma_peer_setup_qp, MOCK_OK);
+		will_return(__wrap__test_malloc, MOCK_OK);
+		will_return_maybe(__wrap_snprintf, MOCK_STDIO_ERROR);
+
+		/* run test */
+		int ret = rpma_conn_req_new(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT,
+				MOCK_GET_CONN_CFG(cstate), &cstate->req);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_non_null(cstate->req);
+		Mock_ctrl_defer_destruction = MOCK_CTRL_NO_DEFER;
+
+		/* the CQs are deleted along with the request */
+		struct conn_req_new_test_state *cstate_del = cstate;
+		(void) teardown__conn_req_new((void **)&cstate_del);
+	}
+
+	Mock_res_pool = NULL;
+}
+
 static const struct CMUnitTest test_new[] = {
 	/* rpma_conn_req_new() unit tests */
 	cmocka_unit_test(new__peer_NULL),
@@ -858,6 +943,8 @@ static const struct CMUnitTest test_new[] = {
 		new__success, setup__conn_req_new, teardown__conn_req_new),
 	CONN_REQ_NEW_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_SRQ_RCQ(
 		new__success, setup__conn_req_new, teardown__conn_req_new),
+	CONN_REQ_NEW_TEST_WITH_AND_WITHOUT_RCQ(new__res_pool),
+	CONN_REQ_NEW_TEST_WITH_AND_WITHOUT_SRQ_RCQ(new__res_pool),
 	cmocka_unit_test(NULL)
 };
 
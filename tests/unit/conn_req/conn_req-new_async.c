@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_req-new_async.c -- the rpma_conn_req_new_async() unit tests
+ *
+ * API covered:
+ * - rpma_conn_req_new_async()
+ */
+
+#include "conn_req-common.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
+#include "mocks-rpma-conn_cfg.h"
+
+/*
+ * new_async__peer_NULL -- NULL peer is invalid
+ */
+static void
+new_async__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(NULL, MOCK_IP_ADDRESS, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(req);
+}
+
+/*
+ * new_async__addr_NULL -- NULL addr is invalid
+ */
+static void
+new_async__addr_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, NULL, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(req);
+}
+
+/*
+ * new_async__port_NULL -- NULL port is invalid
+ */
+static void
+new_async__port_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, NULL, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(req);
+}
+
+/*
+ * new_async__req_ptr_NULL -- NULL req_ptr is invalid
+ */
+static void
+new_async__req_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new_async__info_new_E_NOMEM -- rpma_info_new() fails with RPMA_E_NOMEM
+ */
+static void
+new_async__info_new_E_NOMEM(void **unused)
+{
+	struct conn_req_new_test_state *cstate = NULL;
+	configure_conn_req_new((void **)&cstate);
+
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+	will_return(rpma_info_new, NULL);
+	will_return(rpma_info_new, RPMA_E_NOMEM);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(req);
+}
+
+/*
+ * new_async__create_event_channel_ERRNO -- rdma_create_event_channel() fails with MOCK_ERRNO
+ */
+static void
+new_async__create_event_channel_ERRNO(void **unused)
+{
+	struct conn_req_new_test_state *cstate = NULL;
+	configure_conn_req_new((void **)&cstate);
+
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+	will_return(rpma_info_new, MOCK_INFO);
+	will_return(rdma_create_event_channel, NULL);
+	will_return(rdma_create_event_channel, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(req);
+}
+
+/*
+ * new_async__create_id_ERRNO -- rdma_create_id() fails with MOCK_ERRNO
+ */
+static void
+new_async__create_id_ERRNO(void **unused)
+{
+	struct conn_req_new_test_state *cstate = NULL;
+	configure_conn_req_new((void **)&cstate);
+
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+	will_return(rpma_info_new, MOCK_INFO);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+	will_return(rdma_create_id, NULL);
+	will_return(rdma_create_id, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(req);
+}
+
+/*
+ * new_async__malloc_ERRNO -- malloc() fails with MOCK_ERRNO
+ */
+static void
+new_async__malloc_ERRNO(void **unused)
+{
+	struct conn_req_new_test_state *cstate = NULL;
+	configure_conn_req_new((void **)&cstate);
+
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+	will_return(rpma_info_new, MOCK_INFO);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+	will_return(rdma_create_id, &cstate->id);
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+	will_return(rdma_destroy_id, MOCK_OK);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(req);
+}
+
+/*
+ * new_async__resolve_addr_E_PROVIDER -- rpma_info_resolve_addr() fails with RPMA_E_PROVIDER
+ */
+static void
+new_async__resolve_addr_E_PROVIDER(void **unused)
+{
+	struct conn_req_new_test_state *cstate = NULL;
+	configure_conn_req_new((void **)&cstate);
+
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_timeout, &cstate->get_args);
+	will_return(rpma_info_new, MOCK_INFO);
+	will_return(rdma_create_event_channel, MOCK_EVCH);
+	will_return(rdma_create_id, &cstate->id);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_info_resolve_addr, id, &cstate->id);
+	expect_value(rpma_info_resolve_addr, timeout_ms, RPMA_DEFAULT_TIMEOUT_MS);
+	will_return(rpma_info_resolve_addr, RPMA_E_PROVIDER);
+	will_return(rpma_info_resolve_addr, MOCK_ERRNO);
+	will_return(rdma_destroy_id, MOCK_OK);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_async(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(req);
+}
+
+/*
+ * new_async__success -- all is OK
+ */
+static void
+new_async__success(void **unused)
+{
+	/*
+	 * The thing is done by setup__conn_req_new_async() and
+	 * teardown__conn_req_new_async().
+	 */
+}
+
+static const struct CMUnitTest test_new_async[] = {
+	/* rpma_conn_req_new_async() unit tests */
+	cmocka_unit_test(new_async__peer_NULL),
+	cmocka_unit_test(new_async__addr_NULL),
+	cmocka_unit_test(new_async__port_NULL),
+	cmocka_unit_test(new_async__req_ptr_NULL),
+	cmocka_unit_test(new_async__info_new_E_NOMEM),
+	cmocka_unit_test(new_async__create_event_channel_ERRNO),
+	cmocka_unit_test(new_async__create_id_ERRNO),
+	cmocka_unit_test(new_async__malloc_ERRNO),
+	cmocka_unit_test(new_async__resolve_addr_E_PROVIDER),
+	CONN_REQ_NEW_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(new_async__success,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(test_new_async, NULL, NULL);
+}
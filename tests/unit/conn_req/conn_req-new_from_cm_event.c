@@ -110,6 +110,7 @@ from_cm_event__shared_true_srq_rcq_not_NULL(void **unused)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, MOCK_RPMA_SRQ_RCQ);
@@ -140,6 +141,7 @@ from_cm_event__ibv_create_comp_channel_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	will_return(ibv_create_comp_channel, NULL);
 	will_return(ibv_create_comp_channel, MOCK_ERRNO);
 
@@ -168,6 +170,7 @@ from_cm_event__ibv_create_comp_channel_ERRNO_rdma_ack_cm_event_ERRNO2(void **cst
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	will_return(ibv_create_comp_channel, NULL);
 	will_return(ibv_create_comp_channel, MOCK_ERRNO);
 
@@ -195,6 +198,7 @@ from_cm_event__cq_new_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -234,6 +238,7 @@ from_cm_event__rcq_new_ERRNO(void **unused)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.shared)
 		will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
 	expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
@@ -274,6 +279,7 @@ from_cm_event__peer_create_qp_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -327,6 +333,7 @@ from_cm_event__create_qp_ERRNO_subsequent_ERRNO2(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -385,6 +392,7 @@ from_cm_event__malloc_ERRNO(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -439,6 +447,7 @@ from_cm_event__malloc_ERRNO_subsequent_ERRNO2(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -499,6 +508,7 @@ from_cm_event__private_data_store_E_NOMEM(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
@@ -559,6 +569,7 @@ from_cm_event__private_data_store_E_NOMEM_subsequent_ERRNO2(void **cstate_ptr)
 	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
 	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
 	if (cstate->get_args.srq) {
 		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
 		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
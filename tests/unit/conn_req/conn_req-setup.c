@@ -0,0 +1,359 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_req-setup.c -- the deferred setup of connection requests unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_req_new_deferred_from_cm_event()
+ * - rpma_conn_req_setup()
+ */
+
+#include "conn_req-common.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
+#include "mocks-rpma-conn_cfg.h"
+
+/*
+ * configure_setup_id_cq_new_ERRNO -- configure mocks for rpma_cq_new(cqe) failing
+ * with MOCK_ERRNO while equipping the CM ID with QP and CQ
+ */
+static void
+configure_setup_id_cq_new_ERRNO(struct conn_req_test_state *cstate)
+{
+	will_return(rpma_conn_cfg_get_cqe, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
+	if (!cstate->get_args.srq_rcq && cstate->get_args.shared)
+		will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
+	expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
+	expect_value(rpma_cq_new, shared_channel, MOCK_GET_CHANNEL(cstate));
+	will_return(rpma_cq_new, NULL);
+	will_return(rpma_cq_new, RPMA_E_PROVIDER);
+	will_return(rpma_cq_new, MOCK_ERRNO);
+	if (!cstate->get_args.srq_rcq && cstate->get_args.shared)
+		will_return(ibv_destroy_comp_channel, MOCK_OK);
+}
+
+/*
+ * new_deferred__peer_NULL -- NULL peer is invalid
+ */
+static void
+new_deferred__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rdma_cm_event event = CM_EVENT_CONNECTION_REQUEST_INIT;
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_deferred_from_cm_event(NULL, &event,
+			MOCK_CONN_CFG_DEFAULT, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(req);
+}
+
+/*
+ * new_deferred__event_NULL -- NULL event is invalid
+ */
+static void
+new_deferred__event_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_deferred_from_cm_event(MOCK_PEER, NULL,
+			MOCK_CONN_CFG_DEFAULT, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(req);
+}
+
+/*
+ * new_deferred__event_REJECTED -- an event different than RDMA_CM_EVENT_CONNECT_REQUEST
+ * is invalid
+ */
+static void
+new_deferred__event_REJECTED(void **unused)
+{
+	/* run test */
+	struct rdma_cm_event event = CM_EVENT_CONNECTION_REQUEST_INIT;
+	event.event = RDMA_CM_EVENT_REJECTED;
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_deferred_from_cm_event(MOCK_PEER, &event,
+			MOCK_CONN_CFG_DEFAULT, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(req);
+}
+
+/*
+ * new_deferred__req_ptr_NULL -- NULL req_ptr is invalid
+ */
+static void
+new_deferred__req_ptr_NULL(void **unused)
+{
+	/* run test */
+	struct rdma_cm_event event = CM_EVENT_CONNECTION_REQUEST_INIT;
+	int ret = rpma_conn_req_new_deferred_from_cm_event(MOCK_PEER, &event,
+			MOCK_CONN_CFG_DEFAULT, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new_deferred__malloc_ERRNO -- malloc() fails with MOCK_ERRNO
+ */
+static void
+new_deferred__malloc_ERRNO(void **unused)
+{
+	struct conn_req_test_state *cstate = NULL;
+	configure_conn_req((void **)&cstate);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_deferred_from_cm_event(MOCK_PEER, &cstate->event,
+			MOCK_CONN_CFG_DEFAULT, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(req);
+}
+
+/*
+ * new_deferred__private_data_store_E_NOMEM -- rpma_private_data_store() fails
+ * with RPMA_E_NOMEM
+ */
+static void
+new_deferred__private_data_store_E_NOMEM(void **unused)
+{
+	struct conn_req_test_state *cstate = NULL;
+	configure_conn_req((void **)&cstate);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rpma_private_data_store, NULL);
+
+	/* run test */
+	struct rpma_conn_req *req = NULL;
+	int ret = rpma_conn_req_new_deferred_from_cm_event(MOCK_PEER, &cstate->event,
+			MOCK_CONN_CFG_DEFAULT, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(req);
+}
+
+/*
+ * new_deferred__success -- all is OK
+ */
+static void
+new_deferred__success(void **unused)
+{
+	/*
+	 * The thing is done by setup__conn_req_new_deferred() and
+	 * teardown__conn_req_new_deferred().
+	 */
+}
+
+/*
+ * setup__req_NULL -- NULL req is invalid
+ */
+static void
+setup__req_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_conn_req_setup(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * setup__req_not_pending -- a connection request established asynchronously
+ * which is not ready yet cannot be set up
+ */
+static void
+setup__req_not_pending(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_req_setup(cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * setup__req_ready -- there is nothing to do for a ready connection request
+ */
+static void
+setup__req_ready(void **cstate_ptr)
+{
+	struct conn_req_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_req_setup(cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * setup__cq_new_ERRNO -- rpma_cq_new(cqe) fails with MOCK_ERRNO so the request
+ * remains pending
+ */
+static void
+setup__cq_new_ERRNO(void **cstate_ptr)
+{
+	struct conn_req_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	configure_setup_id_cq_new_ERRNO(cstate);
+
+	/* run test */
+	int ret = rpma_conn_req_setup(cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	/* the pending request cannot be stepped */
+	enum rpma_conn_req_state state = RPMA_CONN_REQ_READY;
+	ret = rpma_conn_req_step(cstate->req, &state);
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * setup__success -- the pending request is set up and it becomes ready
+ */
+static void
+setup__success(void **cstate_ptr)
+{
+	/* WA for cmocka/issues#47 */
+	struct conn_req_test_state *cstate = *cstate_ptr;
+	assert_int_equal(setup__conn_req_new_deferred((void **)&cstate), 0);
+	assert_non_null(cstate);
+
+	/* configure mocks */
+	configure_conn_req_setup_id(cstate);
+	will_return_maybe(__wrap_snprintf, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_req_setup(cstate->req);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	enum rpma_conn_req_state state = RPMA_CONN_REQ_SETUP_PENDING;
+	ret = rpma_conn_req_step(cstate->req, &state);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(state, RPMA_CONN_REQ_READY);
+
+	*cstate_ptr = cstate;
+}
+
+/*
+ * setup__connect_cq_new_ERRNO -- rpma_conn_req_connect() fails to set up the pending request
+ */
+static void
+setup__connect_cq_new_ERRNO(void **cstate_ptr)
+{
+	/* WA for cmocka/issues#47 */
+	struct conn_req_test_state *cstate = *cstate_ptr;
+	assert_int_equal(setup__conn_req_new_deferred((void **)&cstate), 0);
+	assert_non_null(cstate);
+
+	/* configure mocks */
+	configure_setup_id_cq_new_ERRNO(cstate);
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rpma_cq_delete, *cq_ptr, NULL);
+	will_return(rpma_cq_delete, MOCK_OK);
+	expect_value(rdma_reject, id, &cstate->id);
+	will_return(rdma_reject, MOCK_OK);
+	expect_function_call(rpma_private_data_delete);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_conn_req_connect(&cstate->req, NULL, &conn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(cstate->req);
+	assert_null(conn);
+}
+
+/*
+ * setup__connect_success -- rpma_conn_req_connect() sets up the pending request
+ * before accepting it
+ */
+static void
+setup__connect_success(void **cstate_ptr)
+{
+	/* WA for cmocka/issues#47 */
+	struct conn_req_test_state *cstate = *cstate_ptr;
+	assert_int_equal(setup__conn_req_new_deferred((void **)&cstate), 0);
+	assert_non_null(cstate);
+
+	/* configure mocks */
+	configure_conn_req_setup_id(cstate);
+	will_return_maybe(__wrap_snprintf, MOCK_OK);
+	expect_value(rdma_accept, id, &cstate->id);
+	will_return(rdma_accept, MOCK_OK);
+	expect_value(rpma_conn_new, id, &cstate->id);
+	expect_value(rpma_conn_new, rcq, MOCK_GET_RCQ(cstate));
+	expect_value(rpma_conn_new, channel, MOCK_GET_CHANNEL(cstate));
+	will_return(rpma_conn_new, MOCK_CONN);
+	expect_value(rpma_conn_transfer_private_data, conn, MOCK_CONN);
+	expect_value(rpma_conn_transfer_private_data, pdata->ptr, MOCK_PRIVATE_DATA);
+	expect_value(rpma_conn_transfer_private_data, pdata->len, MOCK_PDATA_LEN);
+
+	/* run test */
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_conn_req_connect(&cstate->req, NULL, &conn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(cstate->req);
+	assert_int_equal(conn, MOCK_CONN);
+}
+
+static const struct CMUnitTest test_setup[] = {
+	/* rpma_conn_req_new_deferred_from_cm_event() unit tests */
+	cmocka_unit_test(new_deferred__peer_NULL),
+	cmocka_unit_test(new_deferred__event_NULL),
+	cmocka_unit_test(new_deferred__event_REJECTED),
+	cmocka_unit_test(new_deferred__req_ptr_NULL),
+	cmocka_unit_test(new_deferred__malloc_ERRNO),
+	cmocka_unit_test(new_deferred__private_data_store_E_NOMEM),
+	CONN_REQ_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(new_deferred__success,
+		setup__conn_req_new_deferred, teardown__conn_req_new_deferred),
+	/* rpma_conn_req_setup() unit tests */
+	cmocka_unit_test(setup__req_NULL),
+	CONN_REQ_NEW_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(setup__req_not_pending,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	CONN_REQ_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(setup__req_ready,
+		setup__conn_req_new_from_cm_event, teardown__conn_req_new_from_cm_event),
+	CONN_REQ_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(setup__cq_new_ERRNO,
+		setup__conn_req_new_deferred, teardown__conn_req_new_deferred),
+	CONN_REQ_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(setup__success,
+		NULL, teardown__conn_req_new_from_cm_event),
+	CONN_REQ_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_SRQ_RCQ(setup__success,
+		NULL, teardown__conn_req_new_from_cm_event),
+	CONN_REQ_TEST_WITH_AND_WITHOUT_RCQ(setup__connect_cq_new_ERRNO),
+	CONN_REQ_TEST_WITH_AND_WITHOUT_RCQ(setup__connect_success),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(test_setup, NULL, NULL);
+}
@@ -0,0 +1,354 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_req-step.c -- the rpma_conn_req_step() and rpma_conn_req_get_fd() unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_req_get_fd()
+ * - rpma_conn_req_step()
+ */
+
+#include "conn_req-common.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rdma_cm.h"
+#include "mocks-rpma-conn_cfg.h"
+#include "test-common.h"
+
+/*
+ * configure_mocks_get_cm_event -- configure mocks for receiving the event
+ */
+static void
+configure_mocks_get_cm_event(struct conn_req_new_test_state *cstate,
+		enum rdma_cm_event_type event)
+{
+	cstate->event.event = event;
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, &cstate->event);
+	expect_value(rdma_ack_cm_event, event, &cstate->event);
+	will_return(rdma_ack_cm_event, MOCK_OK);
+}
+
+/*
+ * get_fd__req_NULL -- NULL req is invalid
+ */
+static void
+get_fd__req_NULL(void **unused)
+{
+	/* run test */
+	int fd = 0;
+	int ret = rpma_conn_req_get_fd(NULL, &fd);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(fd, 0);
+}
+
+/*
+ * get_fd__fd_NULL -- NULL fd is invalid
+ */
+static void
+get_fd__fd_NULL(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_req_get_fd(cstate->req, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_fd__not_async -- a connection request created by rpma_conn_req_new()
+ * has no event channel
+ */
+static void
+get_fd__not_async(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int fd = 0;
+	int ret = rpma_conn_req_get_fd(cstate->req, &fd);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(fd, 0);
+}
+
+/*
+ * get_fd__success -- happy day scenario
+ */
+static void
+get_fd__success(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int fd = 0;
+	int ret = rpma_conn_req_get_fd(cstate->req, &fd);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(fd, Evch.fd);
+}
+
+/*
+ * step__req_NULL -- NULL req is invalid
+ */
+static void
+step__req_NULL(void **unused)
+{
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(NULL, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * step__state_NULL -- NULL state is invalid
+ */
+static void
+step__state_NULL(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* run test */
+	int ret = rpma_conn_req_step(cstate->req, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * step__get_cm_event_ENODATA -- no event is waiting
+ */
+static void
+step__get_cm_event_ENODATA(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, NULL);
+	will_return(rdma_get_cm_event, ENODATA);
+
+	/* run test */
+	enum rpma_conn_req_state state = RPMA_CONN_REQ_ROUTE_RESOLVING;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_EVENT);
+	assert_int_equal(state, RPMA_CONN_REQ_ROUTE_RESOLVING);
+}
+
+/*
+ * step__get_cm_event_ERRNO -- rdma_get_cm_event() fails with MOCK_ERRNO
+ */
+static void
+step__get_cm_event_ERRNO(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, NULL);
+	will_return(rdma_get_cm_event, MOCK_ERRNO);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * step__ack_cm_event_ERRNO -- rdma_ack_cm_event() fails with MOCK_ERRNO
+ */
+static void
+step__ack_cm_event_ERRNO(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	cstate->event.event = RDMA_CM_EVENT_ROUTE_RESOLVED;
+	expect_value(rdma_get_cm_event, channel, MOCK_EVCH);
+	will_return(rdma_get_cm_event, &cstate->event);
+	expect_value(rdma_ack_cm_event, event, &cstate->event);
+	will_return(rdma_ack_cm_event, MOCK_ERRNO);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * step__route_error -- resolving the route fails
+ */
+static void
+step__route_error(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	configure_mocks_get_cm_event(cstate, RDMA_CM_EVENT_ROUTE_ERROR);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * step__unexpected_event -- an event not expected in the current state
+ */
+static void
+step__unexpected_event(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	configure_mocks_get_cm_event(cstate, RDMA_CM_EVENT_ADDR_RESOLVED);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_UNKNOWN);
+}
+
+/*
+ * step__cq_new_ERRNO -- rpma_cq_new() fails with MOCK_ERRNO
+ * when the route is resolved
+ */
+static void
+step__cq_new_ERRNO(void **cstate_ptr)
+{
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+
+	/* configure mocks */
+	configure_mocks_get_cm_event(cstate, RDMA_CM_EVENT_ROUTE_RESOLVED);
+	will_return(rpma_conn_cfg_get_cqe, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
+	if (cstate->get_args.shared)
+		will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
+	expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
+	expect_value(rpma_cq_new, shared_channel, MOCK_GET_CHANNEL(cstate));
+	will_return(rpma_cq_new, NULL);
+	will_return(rpma_cq_new, RPMA_E_PROVIDER);
+	will_return(rpma_cq_new, MOCK_ERRNO);
+	if (cstate->get_args.shared)
+		will_return(ibv_destroy_comp_channel, MOCK_OK);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * step__success -- the route is resolved and the connection request becomes ready
+ */
+static void
+step__success(void **cstate_ptr)
+{
+	/* WA for cmocka/issues#47 */
+	struct conn_req_new_test_state *cstate = *cstate_ptr;
+	assert_int_equal(setup__conn_req_new_async((void **)&cstate), 0);
+	assert_non_null(cstate);
+
+	/* configure mocks */
+	configure_mocks_get_cm_event(cstate, RDMA_CM_EVENT_ROUTE_RESOLVED);
+	will_return(rpma_conn_cfg_get_cqe, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_rcqe, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_compl_channel, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_srq, &cstate->get_args);
+	will_return(rpma_conn_cfg_get_evch, &cstate->get_args);
+	if (cstate->get_args.srq) {
+		expect_value(rpma_srq_get_rcq, srq, MOCK_RPMA_SRQ);
+		will_return(rpma_srq_get_rcq, cstate->get_args.srq_rcq);
+	}
+	if (!cstate->get_args.srq_rcq && cstate->get_args.shared)
+		will_return(ibv_create_comp_channel, MOCK_COMP_CHANNEL);
+	expect_value(rpma_cq_new, cqe, cstate->get_args.cq_size);
+	expect_value(rpma_cq_new, shared_channel, MOCK_GET_CHANNEL(cstate));
+	will_return(rpma_cq_new, MOCK_RPMA_CQ);
+	if (!cstate->get_args.srq_rcq && cstate->get_args.rcq_size) {
+		expect_value(rpma_cq_new, cqe, cstate->get_args.rcq_size);
+		expect_value(rpma_cq_new, shared_channel, MOCK_GET_CHANNEL(cstate));
+		will_return(rpma_cq_new, MOCK_RPMA_RCQ);
+	}
+	expect_value(rpma_peer_setup_qp, id, &cstate->id);
+	expect_value(rpma_peer_setup_qp, cfg, cstate->get_args.cfg);
+	expect_value(rpma_peer_setup_qp, rcq, MOCK_GET_RCQ(cstate));
+	will_return(rpma_peer_setup_qp, MOCK_OK);
+	will_return_maybe(__wrap_snprintf, MOCK_STDIO_ERROR);
+
+	/* run test */
+	enum rpma_conn_req_state state;
+	int ret = rpma_conn_req_step(cstate->req, &state);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(state, RPMA_CONN_REQ_READY);
+
+	/* a ready connection request does not wait for any event */
+	ret = rpma_conn_req_step(cstate->req, &state);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(state, RPMA_CONN_REQ_READY);
+
+	assert_int_equal(teardown__conn_req_new((void **)&cstate), 0);
+	assert_null(cstate);
+}
+
+static const struct CMUnitTest test_step[] = {
+	/* rpma_conn_req_get_fd() unit tests */
+	cmocka_unit_test(get_fd__req_NULL),
+	cmocka_unit_test_setup_teardown(get_fd__fd_NULL,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test_setup_teardown(get_fd__not_async,
+		setup__conn_req_new, teardown__conn_req_new),
+	cmocka_unit_test_setup_teardown(get_fd__success,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+
+	/* rpma_conn_req_step() unit tests */
+	cmocka_unit_test(step__req_NULL),
+	cmocka_unit_test_setup_teardown(step__state_NULL,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test_setup_teardown(step__get_cm_event_ENODATA,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test_setup_teardown(step__get_cm_event_ERRNO,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test_setup_teardown(step__ack_cm_event_ERRNO,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test_setup_teardown(step__route_error,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	cmocka_unit_test_setup_teardown(step__unexpected_event,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	CONN_REQ_NEW_TEST_SETUP_TEARDOWN_WITH_AND_WITHOUT_RCQ(step__cq_new_ERRNO,
+		setup__conn_req_new_async, teardown__conn_req_new_async),
+	CONN_REQ_NEW_TEST_WITH_AND_WITHOUT_RCQ(step__success),
+	CONN_REQ_NEW_TEST_WITH_AND_WITHOUT_SRQ_RCQ(step__success),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(test_step, NULL, NULL);
+}
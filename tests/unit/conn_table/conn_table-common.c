@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_table-common.c -- the conn_table unit tests common functions
+ */
+
+#include <string.h>
+
+#include "conn_table-common.h"
+
+/*
+ * conn_table_id_init -- prepare a CM ID of the QP number on the device
+ */
+void
+conn_table_id_init(struct conn_table_id *cid, struct ibv_context *verbs, uint32_t qp_num)
+{
+	memset(cid, 0, sizeof(*cid));
+	cid->id.verbs = verbs;
+	cid->id.qp = &cid->qp;
+	cid->qp.qp_num = qp_num;
+}
+
+/*
+ * insert__success_common -- register the connection successfully
+ * making the given number of allocations
+ */
+void
+insert__success_common(struct conn_table_id *cid, struct rpma_conn *conn, int table_allocs)
+{
+	/* configure mocks */
+	for (int i = 0; i < table_allocs; i++)
+		will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_conn_table_insert(&cid->id, conn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(rpma_conn_table_lookup(cid->id.verbs, cid->qp.qp_num), conn);
+}
+
+/*
+ * teardown__conn_table_fini -- free the tables of all devices
+ */
+int
+teardown__conn_table_fini(void **unused)
+{
+	rpma_conn_table_fini();
+
+	return 0;
+}
@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_table-common.h -- the conn_table unit tests common definitions
+ */
+
+#ifndef CONN_TABLE_COMMON_H
+#define CONN_TABLE_COMMON_H
+
+#include "cmocka_headers.h"
+#include "conn_table.h"
+#include "test-common.h"
+
+#define MOCK_VERBS_A		(struct ibv_context *)0xDE0A
+#define MOCK_VERBS_B		(struct ibv_context *)0xDE0B
+#define MOCK_CONN_2		(struct rpma_conn *)0xC005
+#define MOCK_QP_NUM_2		(MOCK_QP_NUM + 1)
+
+/* a CM ID with its QP */
+struct conn_table_id {
+	struct rdma_cm_id id;
+	struct ibv_qp qp;
+};
+
+void conn_table_id_init(struct conn_table_id *cid, struct ibv_context *verbs, uint32_t qp_num);
+void insert__success_common(struct conn_table_id *cid, struct rpma_conn *conn,
+		int table_allocs);
+
+int teardown__conn_table_fini(void **unused);
+
+#endif /* CONN_TABLE_COMMON_H */
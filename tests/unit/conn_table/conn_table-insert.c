@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_table-insert.c -- the rpma_conn_table_insert() unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_table_insert()
+ * - rpma_conn_table_fini()
+ */
+
+#include "conn_table-common.h"
+
+/* the largest QP number */
+#define MOCK_QP_NUM_MAX		0xFFFFFF
+
+/*
+ * insert__qp_num_out_of_range -- a QP number wider than 24 bits is invalid
+ */
+static void
+insert__qp_num_out_of_range(void **unused)
+{
+	struct conn_table_id cid;
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM_MAX + 1);
+
+	/* run test */
+	int ret = rpma_conn_table_insert(&cid.id, MOCK_CONN);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * insert__table_malloc_ERRNO -- malloc() of the table of the device fails with MOCK_ERRNO
+ */
+static void
+insert__table_malloc_ERRNO(void **unused)
+{
+	struct conn_table_id cid;
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_conn_table_insert(&cid.id, MOCK_CONN);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM));
+}
+
+/*
+ * insert__leaf_malloc_ERRNO -- malloc() of the leaf of the directory fails with MOCK_ERRNO
+ */
+static void
+insert__leaf_malloc_ERRNO(void **unused)
+{
+	struct conn_table_id cid;
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_conn_table_insert(&cid.id, MOCK_CONN);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM));
+}
+
+/*
+ * insert__success -- the table and the leaf are allocated only once
+ */
+static void
+insert__success(void **unused)
+{
+	struct conn_table_id cid;
+
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM);
+	insert__success_common(&cid, MOCK_CONN, 2 /* the table and the leaf */);
+
+	/* the same leaf */
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM_2);
+	insert__success_common(&cid, MOCK_CONN_2, 0);
+
+	/* another leaf */
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM_MAX);
+	insert__success_common(&cid, MOCK_CONN, 1);
+
+	assert_ptr_equal(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM), MOCK_CONN);
+	assert_ptr_equal(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM_2), MOCK_CONN_2);
+}
+
+static const struct CMUnitTest tests_insert[] = {
+	/* rpma_conn_table_insert() unit tests */
+	cmocka_unit_test(insert__qp_num_out_of_range),
+	cmocka_unit_test_teardown(insert__table_malloc_ERRNO, teardown__conn_table_fini),
+	cmocka_unit_test_teardown(insert__leaf_malloc_ERRNO, teardown__conn_table_fini),
+	cmocka_unit_test_teardown(insert__success, teardown__conn_table_fini),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_insert, NULL, NULL);
+}
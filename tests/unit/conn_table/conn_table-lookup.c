@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * conn_table-lookup.c -- the rpma_conn_table_lookup() unit tests
+ *
+ * APIs covered:
+ * - rpma_conn_table_lookup()
+ * - rpma_conn_table_remove()
+ */
+
+#include "conn_table-common.h"
+
+/*
+ * lookup__empty -- nothing is found in the empty table
+ */
+static void
+lookup__empty(void **unused)
+{
+	/* run test */
+	struct rpma_conn *conn = rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM);
+
+	/* verify the results */
+	assert_null(conn);
+}
+
+/*
+ * lookup__devices -- the same QP number on two devices belongs to different connections
+ */
+static void
+lookup__devices(void **unused)
+{
+	struct conn_table_id cid_a;
+	struct conn_table_id cid_b;
+	conn_table_id_init(&cid_a, MOCK_VERBS_A, MOCK_QP_NUM);
+	conn_table_id_init(&cid_b, MOCK_VERBS_B, MOCK_QP_NUM);
+
+	insert__success_common(&cid_a, MOCK_CONN, 2 /* the table and the leaf */);
+	insert__success_common(&cid_b, MOCK_CONN_2, 2 /* the table and the leaf */);
+
+	/* run test */
+	assert_ptr_equal(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM), MOCK_CONN);
+	assert_ptr_equal(rpma_conn_table_lookup(MOCK_VERBS_B, MOCK_QP_NUM), MOCK_CONN_2);
+	assert_null(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM_2));
+
+	rpma_conn_table_remove(&cid_a.id, MOCK_CONN);
+
+	/* verify the results */
+	assert_null(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM));
+	assert_ptr_equal(rpma_conn_table_lookup(MOCK_VERBS_B, MOCK_QP_NUM), MOCK_CONN_2);
+}
+
+/*
+ * remove__unknown -- removing a connection which has never been registered is a no-op
+ */
+static void
+remove__unknown(void **unused)
+{
+	struct conn_table_id cid;
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM);
+
+	/* run test */
+	rpma_conn_table_remove(&cid.id, MOCK_CONN);
+
+	/* verify the results */
+	assert_null(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM));
+}
+
+/*
+ * remove__qp_num_reused -- removing a connection does not unregister another connection
+ * which has got its QP number in the meantime
+ */
+static void
+remove__qp_num_reused(void **unused)
+{
+	struct conn_table_id cid;
+	conn_table_id_init(&cid, MOCK_VERBS_A, MOCK_QP_NUM);
+
+	insert__success_common(&cid, MOCK_CONN, 2 /* the table and the leaf */);
+	insert__success_common(&cid, MOCK_CONN_2, 0);
+
+	/* run test */
+	rpma_conn_table_remove(&cid.id, MOCK_CONN);
+
+	/* verify the results */
+	assert_ptr_equal(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM), MOCK_CONN_2);
+
+	/* run test */
+	rpma_conn_table_remove(&cid.id, MOCK_CONN_2);
+
+	/* verify the results */
+	assert_null(rpma_conn_table_lookup(MOCK_VERBS_A, MOCK_QP_NUM));
+}
+
+static const struct CMUnitTest tests_lookup[] = {
+	/* rpma_conn_table_lookup() unit tests */
+	cmocka_unit_test(lookup__empty),
+	cmocka_unit_test_teardown(lookup__devices, teardown__conn_table_fini),
+
+	/* rpma_conn_table_remove() unit tests */
+	cmocka_unit_test(remove__unknown),
+	cmocka_unit_test_teardown(remove__qp_num_reused, teardown__conn_table_fini),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_lookup, NULL, NULL);
+}
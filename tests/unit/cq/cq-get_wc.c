@@ -15,6 +15,7 @@
 #include "cmocka_headers.h"
 #include "mocks-ibverbs.h"
 #include "cq-common.h"
+#include "hook.h"
 
 static enum ibv_wc_opcode opcodes[] = {
 	IBV_WC_RDMA_READ,
@@ -289,6 +290,112 @@ get_wc__success_all_opcodes(void **cq_ptr)
 	}
 }
 
+/*
+ * get_wc__stats -- the completions and the error completions are counted
+ * in the statistics of the connection whose instrumentation is set
+ */
+static void
+get_wc__stats(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+	struct rpma_cq *cq = cstate->cq;
+	struct rpma_instr instr;
+	rpma_instr_init(&instr, MOCK_QP);
+	struct rpma_stats *stats = &instr.stats;
+	rpma_cq_set_instr(cq, &instr);
+
+	/* configure mock */
+	struct ibv_wc orig_wc[2] = {{0}};
+	orig_wc[0].status = IBV_WC_SUCCESS;
+	orig_wc[1].status = IBV_WC_REM_ACCESS_ERR;
+	expect_value(poll_cq, cq, MOCK_IBV_CQ);
+	expect_value(poll_cq, num_entries, 2);
+	will_return(poll_cq, 2);
+	will_return(poll_cq, orig_wc);
+
+	/* run test */
+	struct ibv_wc wc[2];
+	int num_entries_got = 0;
+	int ret = rpma_cq_get_wc(cq, 2, wc, &num_entries_got);
+
+	/* verify the result */
+	assert_int_equal(ret, 0);
+	assert_int_equal(atomic_load(&stats->counters[RPMA_STATS_COMPLETIONS]), 2);
+	assert_int_equal(atomic_load(&stats->counters[RPMA_STATS_COMPLETION_ERRORS]), 1);
+
+	/* the completions are not counted after the instrumentation is unset */
+	rpma_cq_set_instr(cq, NULL);
+	expect_value(poll_cq, cq, MOCK_IBV_CQ);
+	expect_value(poll_cq, num_entries, 2);
+	will_return(poll_cq, 2);
+	will_return(poll_cq, orig_wc);
+
+	ret = rpma_cq_get_wc(cq, 2, wc, &num_entries_got);
+
+	assert_int_equal(ret, 0);
+	assert_int_equal(atomic_load(&stats->counters[RPMA_STATS_COMPLETIONS]), 2);
+
+	rpma_instr_fini(&instr);
+}
+
+/*
+ * completion_hook -- rpma_hook_completion_function mock
+ */
+static void
+completion_hook(const struct ibv_wc *wc, void *arg)
+{
+	uint64_t wr_id = wc->wr_id;
+
+	check_expected_ptr(arg);
+	check_expected(wr_id);
+}
+
+/*
+ * get_wc__hook -- every second completion is passed to the completion hook
+ */
+static void
+get_wc__hook(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+	struct rpma_cq *cq = cstate->cq;
+
+	will_return(__wrap__test_malloc, MOCK_OK);
+	assert_int_equal(rpma_hook_set(NULL, completion_hook, MOCK_OP_CONTEXT, 2), MOCK_OK);
+
+	/* configure mock */
+	struct ibv_wc orig_wc[3] = {{0}};
+	for (int i = 0; i < 3; i++)
+		orig_wc[i].wr_id = (uint64_t)i;
+	expect_value(poll_cq, cq, MOCK_IBV_CQ);
+	expect_value(poll_cq, num_entries, 3);
+	will_return(poll_cq, 3);
+	will_return(poll_cq, orig_wc);
+	expect_value(completion_hook, arg, MOCK_OP_CONTEXT);
+	expect_value(completion_hook, wr_id, 1);
+
+	/* run test */
+	struct ibv_wc wc[3];
+	int num_entries_got = 0;
+	int ret = rpma_cq_get_wc(cq, 3, wc, &num_entries_got);
+
+	/* verify the result */
+	assert_int_equal(ret, 0);
+	assert_int_equal(num_entries_got, 3);
+
+	/* the hook is not called after it is unset */
+	assert_int_equal(rpma_hook_set(NULL, NULL, NULL, 0), MOCK_OK);
+	expect_value(poll_cq, cq, MOCK_IBV_CQ);
+	expect_value(poll_cq, num_entries, 3);
+	will_return(poll_cq, 3);
+	will_return(poll_cq, orig_wc);
+
+	ret = rpma_cq_get_wc(cq, 3, wc, &num_entries_got);
+
+	assert_int_equal(ret, 0);
+
+	rpma_hook_fini();
+}
+
 /*
  * group_setup_get -- prepare resources for all tests in the group
  */
@@ -321,6 +428,10 @@ static const struct CMUnitTest tests_get_wc[] = {
 		setup__cq_new, teardown__cq_delete),
 	cmocka_unit_test_setup_teardown(get_wc__success_all_opcodes,
 		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test_setup_teardown(get_wc__stats,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test_setup_teardown(get_wc__hook,
+		setup__cq_new, teardown__cq_delete),
 	cmocka_unit_test(NULL)
 };
 
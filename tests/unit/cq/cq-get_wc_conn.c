@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * cq-get_wc_conn.c -- the rpma_cq_get_wc_conn() unit tests
+ *
+ * API covered:
+ * - rpma_cq_get_wc_conn()
+ */
+
+#include <string.h>
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "cq-common.h"
+
+#define MOCK_QP_NUM_2		(MOCK_QP_NUM + 1)
+#define MOCK_CONN_2		(struct rpma_conn *)0xC005
+
+/*
+ * poll_cq -- mock of ibv_poll_cq()
+ */
+static int
+poll_cq(struct ibv_cq *cq, int num_entries, struct ibv_wc *wc)
+{
+	assert_ptr_equal(cq, MOCK_IBV_CQ);
+	check_expected(num_entries);
+
+	int result = mock_type(int);
+	if (result < 1 || result > num_entries)
+		return result;
+
+	struct ibv_wc *wc_ret = mock_type(struct ibv_wc *);
+	memcpy(wc, wc_ret, sizeof(struct ibv_wc) * (size_t)result);
+
+	return result;
+}
+
+/*
+ * get_wc_conn__conns_NULL -- conns NULL is invalid
+ */
+static void
+get_wc_conn__conns_NULL(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+
+	/* run test */
+	struct ibv_wc wc = {0};
+	int ret = rpma_cq_get_wc_conn(cstate->cq, 1, &wc, NULL, NULL);
+
+	/* verify the result */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_wc_conn__cq_NULL -- cq NULL is invalid
+ */
+static void
+get_wc_conn__cq_NULL(void **unused)
+{
+	/* run test */
+	struct ibv_wc wc = {0};
+	struct rpma_conn *conn = NULL;
+	int ret = rpma_cq_get_wc_conn(NULL, 1, &wc, &conn, NULL);
+
+	/* verify the result */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_wc_conn__poll_cq_no_data -- no completion in the CQ
+ */
+static void
+get_wc_conn__poll_cq_no_data(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+
+	/* configure mock */
+	expect_value(poll_cq, num_entries, 1);
+	will_return(poll_cq, 0);
+
+	/* run test */
+	struct ibv_wc wc = {0};
+	struct rpma_conn *conn = MOCK_CONN;
+	int ret = rpma_cq_get_wc_conn(cstate->cq, 1, &wc, &conn, NULL);
+
+	/* verify the result */
+	assert_int_equal(ret, RPMA_E_NO_COMPLETION);
+	assert_ptr_equal(conn, MOCK_CONN);
+}
+
+/*
+ * get_wc_conn__success -- happy day scenario including a completion of an unknown QP
+ */
+static void
+get_wc_conn__success(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+
+	/* configure mocks */
+	struct ibv_wc orig_wc[3];
+	memset(orig_wc, 0, sizeof(orig_wc));
+	orig_wc[0].qp_num = MOCK_QP_NUM;
+	orig_wc[1].qp_num = MOCK_QP_NUM_2;
+	orig_wc[2].qp_num = MOCK_QP_NUM;
+	expect_value(poll_cq, num_entries, 4);
+	will_return(poll_cq, 3);
+	will_return(poll_cq, orig_wc);
+	expect_value(rpma_conn_table_lookup, ctx, MOCK_VERBS);
+	expect_value(rpma_conn_table_lookup, qp_num, MOCK_QP_NUM);
+	will_return(rpma_conn_table_lookup, MOCK_CONN);
+	expect_value(rpma_conn_table_lookup, ctx, MOCK_VERBS);
+	expect_value(rpma_conn_table_lookup, qp_num, MOCK_QP_NUM_2);
+	will_return(rpma_conn_table_lookup, NULL);
+	expect_value(rpma_conn_table_lookup, ctx, MOCK_VERBS);
+	expect_value(rpma_conn_table_lookup, qp_num, MOCK_QP_NUM);
+	will_return(rpma_conn_table_lookup, MOCK_CONN);
+
+	/* run test */
+	struct ibv_wc wc[4];
+	struct rpma_conn *conns[4] = {NULL, NULL, NULL, MOCK_CONN_2};
+	int num_entries_got = 0;
+	int ret = rpma_cq_get_wc_conn(cstate->cq, 4, wc, conns, &num_entries_got);
+
+	/* verify the result */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num_entries_got, 3);
+	assert_int_equal(memcmp(orig_wc, wc, sizeof(orig_wc)), 0);
+	assert_ptr_equal(conns[0], MOCK_CONN);
+	assert_null(conns[1]);
+	assert_ptr_equal(conns[2], MOCK_CONN);
+	assert_ptr_equal(conns[3], MOCK_CONN_2);
+}
+
+/*
+ * group_setup_get_wc_conn -- prepare resources for all tests in the group
+ */
+static int
+group_setup_get_wc_conn(void **unused)
+{
+	/* set the poll_cq callback in mock of IBV CQ */
+	MOCK_VERBS->ops.poll_cq = poll_cq;
+
+	return group_setup_common_cq(NULL);
+}
+
+static const struct CMUnitTest tests_get_wc_conn[] = {
+	/* rpma_cq_get_wc_conn() unit tests */
+	cmocka_unit_test_setup_teardown(get_wc_conn__conns_NULL,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test(get_wc_conn__cq_NULL),
+	cmocka_unit_test_setup_teardown(get_wc_conn__poll_cq_no_data,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test_setup_teardown(get_wc_conn__success,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_get_wc_conn,
+			group_setup_get_wc_conn, NULL);
+}
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * cq-reset.c -- the rpma_cq_reset() unit tests
+ *
+ * API covered:
+ * - rpma_cq_reset()
+ */
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "cq-common.h"
+
+/*
+ * poll_cq -- mock of ibv_poll_cq()
+ */
+static int
+poll_cq(struct ibv_cq *cq, int num_entries, struct ibv_wc *wc)
+{
+	check_expected_ptr(cq);
+	assert_true(num_entries > 0);
+	assert_non_null(wc);
+
+	return mock_type(int);
+}
+
+/*
+ * reset__poll_cq_ERR -- ibv_poll_cq() fails
+ */
+static void
+reset__poll_cq_ERR(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+
+	/* configure mocks */
+	expect_value(poll_cq, cq, MOCK_IBV_CQ);
+	will_return(poll_cq, -1);
+
+	/* run test */
+	int ret = rpma_cq_reset(cstate->cq);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * reset__req_notify_cq_ERRNO -- ibv_req_notify_cq() fails with MOCK_ERRNO
+ */
+static void
+reset__req_notify_cq_ERRNO(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+
+	/* configure mocks */
+	expect_value(poll_cq, cq, MOCK_IBV_CQ);
+	will_return(poll_cq, 0);
+	expect_value(ibv_req_notify_cq_mock, cq, MOCK_IBV_CQ);
+	will_return(ibv_req_notify_cq_mock, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_cq_reset(cstate->cq);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * reset__success -- all the completions left are drained and the CQ is armed again
+ */
+static void
+reset__success(void **cq_ptr)
+{
+	struct cq_test_state *cstate = *cq_ptr;
+
+	/* configure mocks */
+	expect_value_count(poll_cq, cq, MOCK_IBV_CQ, 3);
+	will_return(poll_cq, 16);
+	will_return(poll_cq, 5);
+	will_return(poll_cq, 0);
+	expect_value(ibv_req_notify_cq_mock, cq, MOCK_IBV_CQ);
+	will_return(ibv_req_notify_cq_mock, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_cq_reset(cstate->cq);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * group_setup_reset -- prepare resources for all tests in the group
+ */
+static int
+group_setup_reset(void **unused)
+{
+	/* set the poll_cq callback in mock of IBV CQ */
+	MOCK_VERBS->ops.poll_cq = poll_cq;
+
+	return group_setup_common_cq(NULL);
+}
+
+static const struct CMUnitTest tests_reset[] = {
+	/* rpma_cq_reset() unit tests */
+	cmocka_unit_test_setup_teardown(reset__poll_cq_ERR,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test_setup_teardown(reset__req_notify_cq_ERRNO,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test_setup_teardown(reset__success,
+		setup__cq_new, teardown__cq_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_reset, group_setup_reset, NULL);
+}
@@ -5,6 +5,8 @@
  * ep-common.c -- common part of the endpoint unit tests
  */
 
+#include <poll.h>
+
 #include "librpma.h"
 #include "ep-common.h"
 #include "info.h"
@@ -38,6 +40,9 @@ const struct rdma_event_channel Evch_zero = {.fd = MOCK_FD};
  */
 int Mock_ctrl_defer_destruction = MOCK_CTRL_NO_DEFER;
 
+/* the backlog expected by rdma_listen() */
+int Mock_ctrl_listen_backlog = 0;
+
 /*
  * rpma_info_bind() function requires successful creation of two types of
  * objects so both of them have to be created before queuing any expect_*
@@ -211,6 +216,7 @@ rpma_info_bind_addr(const struct rpma_info *info, struct rdma_cm_id *id)
 		return RPMA_E_PROVIDER;
 
 	expect_value(rdma_listen, id, id);
+	expect_value(rdma_listen, backlog, Mock_ctrl_listen_backlog);
 
 	return 0;
 }
@@ -222,7 +228,7 @@ int
 rdma_listen(struct rdma_cm_id *id, int backlog)
 {
 	check_expected_ptr(id);
-	assert_int_equal(backlog, 0);
+	check_expected(backlog);
 
 	errno = mock_type(int);
 	if (errno)
@@ -272,6 +278,27 @@ rpma_conn_req_new_from_cm_event(struct rpma_peer *peer,
 	return 0;
 }
 
+/*
+ * rpma_conn_req_new_deferred_from_cm_event -- rpma_conn_req_new_deferred_from_cm_event() mock
+ */
+int
+rpma_conn_req_new_deferred_from_cm_event(struct rpma_peer *peer,
+		struct rdma_cm_event *event, const struct rpma_conn_cfg *cfg,
+		struct rpma_conn_req **req_ptr)
+{
+	check_expected_ptr(peer);
+	check_expected_ptr(event);
+	check_expected_ptr(cfg);
+	assert_non_null(req_ptr);
+
+	struct rpma_conn_req *req = mock_type(struct rpma_conn_req *);
+	if (!req)
+		return mock_type(int);
+
+	*req_ptr = req;
+	return 0;
+}
+
 /*
  * rpma_conn_req_delete -- rpma_conn_req_delete() mock
  */
@@ -295,6 +322,28 @@ rdma_ack_cm_event(struct rdma_cm_event *event)
 	return mock_type(int);
 }
 
+/*
+ * __wrap_poll -- poll() mock checking if the next event of the endpoint is waiting
+ */
+int
+__wrap_poll(struct pollfd *fds, nfds_t nfds, int timeout)
+{
+	assert_non_null(fds);
+	assert_int_equal(nfds, 1);
+	assert_int_equal(fds[0].fd, MOCK_FD);
+	assert_int_equal(fds[0].events, POLLIN);
+	assert_int_equal(timeout, 0);
+
+	int ret = mock_type(int);
+	if (ret < 0) {
+		errno = mock_type(int);
+		return -1;
+	}
+
+	fds[0].revents = ret ? POLLIN : 0;
+	return ret;
+}
+
 /*
  * rdma_event_str -- rdma_event_str() mock
  */
@@ -21,6 +21,7 @@
 extern const struct rdma_cm_id Cmid_zero;
 extern const struct rdma_event_channel Evch_zero;
 extern int Mock_ctrl_defer_destruction;
+extern int Mock_ctrl_listen_backlog;
 
 int setup__ep_listen(void **estate_ptr);
 int teardown__ep_shutdown(void **estate_ptr);
@@ -7,6 +7,7 @@
  *
  * APIs covered:
  * - rpma_ep_listen()
+ * - rpma_ep_listen_with_backlog()
  * - rpma_ep_shutdown()
  */
 
@@ -15,6 +16,8 @@
 #include "cmocka_headers.h"
 #include "test-common.h"
 
+#define MOCK_BACKLOG	1024
+
 static struct ep_test_state prestate_conn_cfg_default;
 
 /*
@@ -293,6 +296,75 @@ listen__malloc_ERRNO_destroy_id_ERRNO2(void **unused)
 	assert_null(ep);
 }
 
+/*
+ * listen_with_backlog__backlog_negative - backlog < 0 is invalid
+ */
+static void
+listen_with_backlog__backlog_negative(void **unused)
+{
+	/* run test */
+	struct rpma_ep *ep = NULL;
+	int ret = rpma_ep_listen_with_backlog(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, -1, &ep);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(ep);
+}
+
+/*
+ * listen_with_backlog__peer_NULL - NULL peer is invalid
+ */
+static void
+listen_with_backlog__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_ep *ep = NULL;
+	int ret = rpma_ep_listen_with_backlog(NULL, MOCK_IP_ADDRESS, MOCK_PORT, MOCK_BACKLOG,
+			&ep);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(ep);
+}
+
+/*
+ * listen_with_backlog__success - the backlog is passed to rdma_listen()
+ */
+static void
+listen_with_backlog__success(void **unused)
+{
+	/* configure mocks */
+	struct rdma_event_channel evch;
+	will_return(rdma_create_event_channel, &evch);
+	struct rdma_cm_id id;
+	will_return(rdma_create_id, &id);
+	will_return(rpma_info_new, MOCK_INFO);
+	will_return(rpma_info_bind_addr, MOCK_OK);
+	Mock_ctrl_listen_backlog = MOCK_BACKLOG;
+	will_return(rdma_listen, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(rdma_destroy_id, MOCK_OK);
+
+	/* run test */
+	struct rpma_ep *ep = NULL;
+	int ret = rpma_ep_listen_with_backlog(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT,
+			MOCK_BACKLOG, &ep);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(ep);
+
+	/* restore default mock configuration */
+	Mock_ctrl_listen_backlog = 0;
+
+	/* run test */
+	ret = rpma_ep_shutdown(&ep);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(ep);
+}
+
 /*
  * shutdown__ep_ptr_NULL - NULL ep_ptr is invalid
  */
@@ -380,6 +452,11 @@ main(int argc, char *argv[])
 		cmocka_unit_test(listen__malloc_ERRNO),
 		cmocka_unit_test(listen__malloc_ERRNO_destroy_id_ERRNO2),
 
+		/* rpma_ep_listen_with_backlog() unit tests */
+		cmocka_unit_test(listen_with_backlog__backlog_negative),
+		cmocka_unit_test(listen_with_backlog__peer_NULL),
+		cmocka_unit_test(listen_with_backlog__success),
+
 		/* rpma_ep_listen()/_shutdown() lifecycle */
 		cmocka_unit_test_prestate_setup_teardown(ep__lifecycle,
 			setup__ep_listen, teardown__ep_shutdown,
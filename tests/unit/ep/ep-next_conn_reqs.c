@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ep-next_conn_reqs.c -- the endpoint unit tests
+ *
+ * API covered:
+ * - rpma_ep_next_conn_reqs()
+ */
+
+#include "librpma.h"
+#include "ep-common.h"
+#include "cmocka_headers.h"
+#include "mocks-rpma-conn_cfg.h"
+#include "test-common.h"
+
+#define MOCK_MAX_REQS	3
+
+#define MOCK_CONN_REQ_N(i)	((struct rpma_conn_req *)(uintptr_t)(0xCFE0 + (i)))
+
+static struct rdma_cm_event Events[MOCK_MAX_REQS];
+
+/*
+ * configure_conn_req -- configure mocks for obtaining the i-th connection request
+ */
+static void
+configure_conn_req(struct ep_test_state *estate, int i, int ret)
+{
+	Events[i].event = RDMA_CM_EVENT_CONNECT_REQUEST;
+	expect_value(rdma_get_cm_event, channel, &estate->evch);
+	will_return(rdma_get_cm_event, &Events[i]);
+
+	expect_value(rpma_conn_req_new_from_cm_event, peer, MOCK_PEER);
+	expect_value(rpma_conn_req_new_from_cm_event, event, &Events[i]);
+	expect_value(rpma_conn_req_new_from_cm_event, cfg,
+			(estate->cfg == NULL ? MOCK_CONN_CFG_DEFAULT : estate->cfg));
+	if (ret) {
+		will_return(rpma_conn_req_new_from_cm_event, NULL);
+		will_return(rpma_conn_req_new_from_cm_event, ret);
+	} else {
+		will_return(rpma_conn_req_new_from_cm_event, MOCK_CONN_REQ_N(i));
+	}
+
+	expect_value(rdma_ack_cm_event, event, &Events[i]);
+	will_return(rdma_ack_cm_event, MOCK_OK);
+}
+
+/*
+ * next_conn_reqs__ep_NULL - NULL ep is invalid
+ */
+static void
+next_conn_reqs__ep_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(NULL, NULL, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(num_reqs, 0);
+}
+
+/*
+ * next_conn_reqs__reqs_NULL - NULL reqs is invalid
+ */
+static void
+next_conn_reqs__reqs_NULL(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* run test */
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, NULL, NULL, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(num_reqs, 0);
+}
+
+/*
+ * next_conn_reqs__max_reqs_0 - max_reqs == 0 is invalid
+ */
+static void
+next_conn_reqs__max_reqs_0(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, NULL, reqs, 0, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(num_reqs, 0);
+}
+
+/*
+ * next_conn_reqs__num_reqs_NULL - NULL num_reqs is invalid
+ */
+static void
+next_conn_reqs__num_reqs_NULL(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int ret = rpma_ep_next_conn_reqs(estate->ep, NULL, reqs, MOCK_MAX_REQS, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * next_conn_reqs__get_cm_event_ENODATA - no connection request is waiting
+ */
+static void
+next_conn_reqs__get_cm_event_ENODATA(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	expect_value(rdma_get_cm_event, channel, &estate->evch);
+	will_return(rdma_get_cm_event, NULL);
+	will_return(rdma_get_cm_event, ENODATA);
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, estate->cfg, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_EVENT);
+	assert_int_equal(num_reqs, 0);
+}
+
+/*
+ * next_conn_reqs__first_E_NOMEM - creating the first connection request fails
+ */
+static void
+next_conn_reqs__first_E_NOMEM(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	configure_conn_req(estate, 0, RPMA_E_NOMEM);
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, estate->cfg, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_int_equal(num_reqs, 0);
+}
+
+/*
+ * next_conn_reqs__next_E_NOMEM - creating the second connection request fails
+ * so only the first one is returned
+ */
+static void
+next_conn_reqs__next_E_NOMEM(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	configure_conn_req(estate, 0, MOCK_OK);
+	will_return(__wrap_poll, 1);
+	configure_conn_req(estate, 1, RPMA_E_NOMEM);
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, estate->cfg, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num_reqs, 1);
+	assert_ptr_equal(reqs[0], MOCK_CONN_REQ_N(0));
+}
+
+/*
+ * next_conn_reqs__poll_ERRNO - poll() fails so only the first request is returned
+ */
+static void
+next_conn_reqs__poll_ERRNO(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	configure_conn_req(estate, 0, MOCK_OK);
+	will_return(__wrap_poll, -1);
+	will_return(__wrap_poll, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, estate->cfg, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num_reqs, 1);
+	assert_ptr_equal(reqs[0], MOCK_CONN_REQ_N(0));
+}
+
+/*
+ * next_conn_reqs__success_all_waiting - all the waiting requests are obtained
+ */
+static void
+next_conn_reqs__success_all_waiting(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	configure_conn_req(estate, 0, MOCK_OK);
+	will_return(__wrap_poll, 1);
+	configure_conn_req(estate, 1, MOCK_OK);
+	will_return(__wrap_poll, 0);
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, estate->cfg, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num_reqs, 2);
+	for (int i = 0; i < num_reqs; i++)
+		assert_ptr_equal(reqs[i], MOCK_CONN_REQ_N(i));
+}
+
+/*
+ * next_conn_reqs__success_max_reqs - no more than max_reqs requests are obtained
+ */
+static void
+next_conn_reqs__success_max_reqs(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	configure_conn_req(estate, 0, MOCK_OK);
+	for (int i = 1; i < MOCK_MAX_REQS; i++) {
+		will_return(__wrap_poll, 1);
+		configure_conn_req(estate, i, MOCK_OK);
+	}
+
+	/* run test */
+	struct rpma_conn_req *reqs[MOCK_MAX_REQS];
+	int num_reqs = 0;
+	int ret = rpma_ep_next_conn_reqs(estate->ep, estate->cfg, reqs, MOCK_MAX_REQS, &num_reqs);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num_reqs, MOCK_MAX_REQS);
+	for (int i = 0; i < num_reqs; i++)
+		assert_ptr_equal(reqs[i], MOCK_CONN_REQ_N(i));
+}
+
+int
+main(int argc, char *argv[])
+{
+	/* prepare prestates */
+	struct ep_test_state prestate_conn_cfg_default;
+	prestate_init(&prestate_conn_cfg_default, NULL);
+	struct ep_test_state prestate_conn_cfg_custom;
+	prestate_init(&prestate_conn_cfg_custom, MOCK_CONN_CFG_CUSTOM);
+
+	const struct CMUnitTest tests[] = {
+		/* rpma_ep_next_conn_reqs() unit tests */
+		cmocka_unit_test(next_conn_reqs__ep_NULL),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__reqs_NULL,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__max_reqs_0,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__num_reqs_NULL,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__get_cm_event_ENODATA,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__first_E_NOMEM,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__next_E_NOMEM,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__poll_ERRNO,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__success_all_waiting,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__success_all_waiting,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_custom),
+		cmocka_unit_test_prestate_setup_teardown(next_conn_reqs__success_max_reqs,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
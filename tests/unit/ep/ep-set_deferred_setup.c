@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ep-set_deferred_setup.c -- the endpoint unit tests
+ *
+ * API covered:
+ * - rpma_ep_set_deferred_setup()
+ */
+
+#include "librpma.h"
+#include "ep-common.h"
+#include "cmocka_headers.h"
+#include "mocks-rpma-conn_cfg.h"
+#include "test-common.h"
+
+#define MOCK_CONN_REQ_PENDING	(struct rpma_conn_req *)0xCFED
+
+/*
+ * set_deferred_setup__ep_NULL -- NULL ep is invalid
+ */
+static void
+set_deferred_setup__ep_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ep_set_deferred_setup(NULL, true);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * set_deferred_setup__next_conn_req_E_NOMEM -- creating the pending connection request
+ * fails with RPMA_E_NOMEM
+ */
+static void
+set_deferred_setup__next_conn_req_E_NOMEM(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+
+	/* configure mocks */
+	struct rdma_cm_event event = {0};
+	event.event = RDMA_CM_EVENT_CONNECT_REQUEST;
+	expect_value(rdma_get_cm_event, channel, &estate->evch);
+	will_return(rdma_get_cm_event, &event);
+	expect_value(rpma_conn_req_new_deferred_from_cm_event, peer, MOCK_PEER);
+	expect_value(rpma_conn_req_new_deferred_from_cm_event, event, &event);
+	expect_value(rpma_conn_req_new_deferred_from_cm_event, cfg, MOCK_CONN_CFG_DEFAULT);
+	will_return(rpma_conn_req_new_deferred_from_cm_event, NULL);
+	will_return(rpma_conn_req_new_deferred_from_cm_event, RPMA_E_NOMEM);
+	expect_value(rdma_ack_cm_event, event, &event);
+	will_return(rdma_ack_cm_event, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ep_set_deferred_setup(estate->ep, true);
+	assert_int_equal(ret, MOCK_OK);
+
+	struct rpma_conn_req *req = NULL;
+	ret = rpma_ep_next_conn_req(estate->ep, NULL, &req);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(req);
+}
+
+/*
+ * set_deferred_setup__next_conn_req_success -- the pending connection request is obtained
+ * when the deferred setup is enabled and the ready one otherwise
+ */
+static void
+set_deferred_setup__next_conn_req_success(void **estate_ptr)
+{
+	struct ep_test_state *estate = *estate_ptr;
+	const struct rpma_conn_cfg *cfg = (estate->cfg == NULL ?
+			MOCK_CONN_CFG_DEFAULT : estate->cfg);
+	struct rdma_cm_event event = {0};
+	event.event = RDMA_CM_EVENT_CONNECT_REQUEST;
+
+	for (int deferred = 1; deferred >= 0; deferred--) {
+		/* configure mocks */
+		expect_value(rdma_get_cm_event, channel, &estate->evch);
+		will_return(rdma_get_cm_event, &event);
+		if (deferred) {
+			expect_value(rpma_conn_req_new_deferred_from_cm_event, peer, MOCK_PEER);
+			expect_value(rpma_conn_req_new_deferred_from_cm_event, event, &event);
+			expect_value(rpma_conn_req_new_deferred_from_cm_event, cfg, cfg);
+			will_return(rpma_conn_req_new_deferred_from_cm_event,
+					MOCK_CONN_REQ_PENDING);
+		} else {
+			expect_value(rpma_conn_req_new_from_cm_event, peer, MOCK_PEER);
+			expect_value(rpma_conn_req_new_from_cm_event, event, &event);
+			expect_value(rpma_conn_req_new_from_cm_event, cfg, cfg);
+			will_return(rpma_conn_req_new_from_cm_event, MOCK_CONN_REQ);
+		}
+		expect_value(rdma_ack_cm_event, event, &event);
+		will_return(rdma_ack_cm_event, MOCK_OK);
+
+		/* run test */
+		int ret = rpma_ep_set_deferred_setup(estate->ep, deferred);
+		assert_int_equal(ret, MOCK_OK);
+
+		struct rpma_conn_req *req = NULL;
+		ret = rpma_ep_next_conn_req(estate->ep, estate->cfg, &req);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_ptr_equal(req, deferred ? MOCK_CONN_REQ_PENDING : MOCK_CONN_REQ);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	/* prepare prestates */
+	struct ep_test_state prestate_conn_cfg_default;
+	prestate_init(&prestate_conn_cfg_default, NULL);
+	struct ep_test_state prestate_conn_cfg_custom;
+	prestate_init(&prestate_conn_cfg_custom, MOCK_CONN_CFG_CUSTOM);
+
+	const struct CMUnitTest tests[] = {
+		/* rpma_ep_set_deferred_setup() unit tests */
+		cmocka_unit_test(set_deferred_setup__ep_NULL),
+		cmocka_unit_test_prestate_setup_teardown(
+			set_deferred_setup__next_conn_req_E_NOMEM,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(
+			set_deferred_setup__next_conn_req_success,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_default),
+		cmocka_unit_test_prestate_setup_teardown(
+			set_deferred_setup__next_conn_req_success,
+			setup__ep_listen, teardown__ep_shutdown, &prestate_conn_cfg_custom),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
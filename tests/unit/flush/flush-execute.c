@@ -24,15 +24,15 @@ static void
 apm_execute__success(void **fstate_ptr)
 {
 	/* configure mocks */
-	expect_value(rpma_mr_read, qp, MOCK_QP);
-	expect_value(rpma_mr_read, dst, MOCK_RPMA_MR_LOCAL);
-	expect_value(rpma_mr_read, dst_offset, 0);
-	expect_value(rpma_mr_read, src, MOCK_RPMA_MR_REMOTE);
-	expect_value(rpma_mr_read, src_offset, MOCK_REMOTE_OFFSET);
-	expect_value(rpma_mr_read, len, MOCK_RAW_LEN);
-	expect_value(rpma_mr_read, flags, MOCK_FLAGS);
-	expect_value(rpma_mr_read, op_context, MOCK_OP_CONTEXT);
-	will_return(rpma_mr_read, MOCK_OK);
+	expect_value(rpma_mr_flush_apm, qp, MOCK_QP);
+	expect_value(rpma_mr_flush_apm, raw, MOCK_RPMA_MR_LOCAL);
+	expect_value(rpma_mr_flush_apm, raw_len, MOCK_RAW_LEN);
+	expect_value(rpma_mr_flush_apm, dst, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_mr_flush_apm, dst_offset, MOCK_REMOTE_OFFSET);
+	expect_value(rpma_mr_flush_apm, len, MOCK_LEN);
+	expect_value(rpma_mr_flush_apm, flags, MOCK_FLAGS);
+	expect_value(rpma_mr_flush_apm, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_mr_flush_apm, MOCK_OK);
 
 	/* run test */
 	struct flush_test_state *fstate = *fstate_ptr;
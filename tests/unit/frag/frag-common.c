@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * frag-common.c -- the rpma_frag unit tests common functions
+ */
+
+#include "frag-common.h"
+
+/*
+ * setup__frag_new -- prepare a valid frag object
+ */
+int
+setup__frag_new(void **fstate_ptr)
+{
+	static struct frag_test_state fstate;
+	memset(&fstate, 0, sizeof(fstate));
+
+	/* configure mocks */
+	configure_frag_get_rq_size(MOCK_DEPTH, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_RECV);
+	will_return(rpma_mr_reg, &fstate.rx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL);
+	for (uint32_t i = 0; i < MOCK_DEPTH; i++)
+		configure_frag_recv(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &fstate.frag);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(fstate.frag);
+
+	*fstate_ptr = &fstate;
+
+	return 0;
+}
+
+/*
+ * teardown__frag_delete -- delete the frag object
+ */
+int
+teardown__frag_delete(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_frag_delete(&fstate->frag);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(fstate->frag);
+
+	return 0;
+}
+
+/*
+ * configure_frag_get_rq_size -- configure the rpma_conn_get_rq_size() mock
+ */
+void
+configure_frag_get_rq_size(uint32_t rq_size, int ret)
+{
+	expect_value(rpma_conn_get_rq_size, conn, MOCK_CONN);
+	will_return(rpma_conn_get_rq_size, ret);
+	if (ret == MOCK_OK)
+		will_return(rpma_conn_get_rq_size, rq_size);
+}
+
+/*
+ * configure_frag_recv -- configure the rpma_recv() mock for the given receive buffer
+ */
+void
+configure_frag_recv(uint32_t buf, int ret)
+{
+	expect_value(rpma_recv, conn, MOCK_CONN);
+	expect_value(rpma_recv, dst, MOCK_RPMA_MR_LOCAL);
+	expect_value(rpma_recv, offset, buf * MOCK_FRAG_SIZE);
+	expect_value(rpma_recv, len, MOCK_FRAG_SIZE);
+	expect_any(rpma_recv, op_context);
+	will_return(rpma_recv, ret);
+}
+
+/*
+ * configure_frag_send -- configure the rpma_send_with_imm() mock for a fragment
+ * of MOCK_RPMA_MR_LOCAL_SRC
+ */
+void
+configure_frag_send(size_t offset, size_t len, uint32_t imm, int ret)
+{
+	expect_value(rpma_send_with_imm, conn, MOCK_CONN);
+	expect_value(rpma_send_with_imm, src, len ? MOCK_RPMA_MR_LOCAL_SRC : NULL);
+	expect_value(rpma_send_with_imm, offset, len ? MOCK_SRC_OFFSET + offset : 0);
+	expect_value(rpma_send_with_imm, len, len);
+	expect_value(rpma_send_with_imm, flags, RPMA_F_COMPLETION_ALWAYS);
+	expect_value(rpma_send_with_imm, imm, imm);
+	expect_any(rpma_send_with_imm, op_context);
+	will_return(rpma_send_with_imm, ret);
+}
+
+/*
+ * frag_wc_recv -- a completion of a receive of a fragment
+ */
+struct ibv_wc
+frag_wc_recv(struct rpma_frag *frag, uint32_t imm, uint32_t byte_len)
+{
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)frag;
+	wc.opcode = IBV_WC_RECV;
+	wc.wc_flags = IBV_WC_WITH_IMM;
+	wc.imm_data = htonl(imm);
+	wc.byte_len = byte_len;
+
+	return wc;
+}
+
+/*
+ * frag_wc_send -- a completion of a sent fragment
+ */
+struct ibv_wc
+frag_wc_send(struct rpma_frag *frag)
+{
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)frag;
+	wc.opcode = IBV_WC_SEND;
+
+	return wc;
+}
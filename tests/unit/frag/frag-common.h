@@ -0,0 +1,41 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * frag-common.h -- the rpma_frag unit tests common definitions
+ */
+
+#ifndef FRAG_COMMON_H
+#define FRAG_COMMON_H
+
+#include <arpa/inet.h>
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "test-common.h"
+
+#define MOCK_FRAG_SIZE		16
+#define MOCK_DEPTH		4
+#define MOCK_RX_MR_SIZE		(MOCK_FRAG_SIZE * MOCK_DEPTH)
+#define MOCK_RPMA_MR_LOCAL_SRC	(struct rpma_mr_local *)0xC422
+#define MOCK_SRC_OFFSET		((size_t)0x1000)
+
+/* the immediate data of the fragments (the wire format) */
+#define MOCK_IMM_LAST		((uint32_t)1 << 31)
+#define MOCK_IMM_ABORT		((uint32_t)1 << 30)
+
+struct frag_test_state {
+	char *rx; /* the receive buffers allocated by rpma_frag_new() */
+	struct rpma_frag *frag;
+};
+
+int setup__frag_new(void **fstate_ptr);
+int teardown__frag_delete(void **fstate_ptr);
+
+void configure_frag_get_rq_size(uint32_t rq_size, int ret);
+void configure_frag_recv(uint32_t buf, int ret);
+void configure_frag_send(size_t offset, size_t len, uint32_t imm, int ret);
+struct ibv_wc frag_wc_recv(struct rpma_frag *frag, uint32_t imm, uint32_t byte_len);
+struct ibv_wc frag_wc_send(struct rpma_frag *frag);
+
+#endif /* FRAG_COMMON_H */
@@ -0,0 +1,344 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * frag-new.c -- the rpma_frag_new/_delete() unit tests
+ *
+ * APIs covered:
+ * - rpma_frag_new()
+ * - rpma_frag_delete()
+ */
+
+#include "frag-common.h"
+
+/*
+ * new__peer_NULL -- NULL peer is invalid
+ */
+static void
+new__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(NULL, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(frag);
+}
+
+/*
+ * new__conn_NULL -- NULL conn is invalid
+ */
+static void
+new__conn_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, NULL, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(frag);
+}
+
+/*
+ * new__frag_ptr_NULL -- NULL frag_ptr is invalid
+ */
+static void
+new__frag_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new__frag_size_invalid -- frag_size has to be between 1 and UINT32_MAX
+ */
+static void
+new__frag_size_invalid(void **unused)
+{
+	size_t frag_sizes[] = {0, (size_t)UINT32_MAX + 1};
+
+	for (size_t i = 0; i < sizeof(frag_sizes) / sizeof(frag_sizes[0]); i++) {
+		/* run test */
+		struct rpma_frag *frag = NULL;
+		int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, frag_sizes[i], MOCK_DEPTH, &frag);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_INVAL);
+		assert_null(frag);
+	}
+}
+
+/*
+ * new__depth_0 -- depth == 0 is invalid
+ */
+static void
+new__depth_0(void **unused)
+{
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, 0, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(frag);
+}
+
+/*
+ * new__get_rq_size_ERRNO -- rpma_conn_get_rq_size() fails
+ */
+static void
+new__get_rq_size_ERRNO(void **unused)
+{
+	/* configure mocks */
+	configure_frag_get_rq_size(0, RPMA_E_PROVIDER);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(frag);
+}
+
+/*
+ * new__depth_exceeds_rq_size -- the receive queue cannot hold depth receives
+ * (nothing is posted)
+ */
+static void
+new__depth_exceeds_rq_size(void **unused)
+{
+	/* configure mocks */
+	configure_frag_get_rq_size(MOCK_DEPTH - 1, MOCK_OK);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(frag);
+}
+
+/*
+ * new__malloc_ERRNO -- malloc() fails
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	configure_frag_get_rq_size(MOCK_DEPTH, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(frag);
+}
+
+/*
+ * new__malloc_rx_ERRNO -- malloc() of the receive buffers fails
+ */
+static void
+new__malloc_rx_ERRNO(void **unused)
+{
+	/* configure mocks */
+	configure_frag_get_rq_size(MOCK_DEPTH, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(frag);
+}
+
+/*
+ * new__mr_reg_ERRNO -- rpma_mr_reg() fails
+ */
+static void
+new__mr_reg_ERRNO(void **unused)
+{
+	/* configure mocks */
+	void *rx = NULL;
+	configure_frag_get_rq_size(MOCK_DEPTH, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_RECV);
+	will_return(rpma_mr_reg, &rx);
+	will_return(rpma_mr_reg, NULL);
+	will_return(rpma_mr_reg, RPMA_E_PROVIDER);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(frag);
+}
+
+/*
+ * new__recv_first_ERRNO -- the first rpma_recv() fails
+ */
+static void
+new__recv_first_ERRNO(void **unused)
+{
+	/* configure mocks */
+	void *rx = NULL;
+	configure_frag_get_rq_size(MOCK_DEPTH, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_RECV);
+	will_return(rpma_mr_reg, &rx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL);
+	configure_frag_recv(0, RPMA_E_PROVIDER);
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, MOCK_OK);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(frag);
+}
+
+/*
+ * new__recv_ERRNO -- rpma_recv() fails after a receive has been posted
+ * (the connection is disconnected to flush it)
+ */
+static void
+new__recv_ERRNO(void **unused)
+{
+	/* configure mocks */
+	void *rx = NULL;
+	configure_frag_get_rq_size(MOCK_DEPTH, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_RECV);
+	will_return(rpma_mr_reg, &rx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL);
+	configure_frag_recv(0, MOCK_OK);
+	configure_frag_recv(1, RPMA_E_PROVIDER);
+	expect_value(rpma_conn_disconnect, conn, MOCK_CONN);
+	will_return(rpma_conn_disconnect, MOCK_OK);
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, MOCK_OK);
+
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_new(MOCK_PEER, MOCK_CONN, MOCK_FRAG_SIZE, MOCK_DEPTH, &frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(frag);
+}
+
+/*
+ * new__success -- happy day scenario
+ */
+static void
+new__success(void **fstate_ptr)
+{
+	/*
+	 * The thing is done by setup__frag_new()
+	 * and teardown__frag_delete().
+	 */
+}
+
+/*
+ * delete__frag_ptr_NULL -- NULL frag_ptr is invalid
+ */
+static void
+delete__frag_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_frag_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * delete__frag_NULL -- NULL *frag_ptr should exit quickly
+ */
+static void
+delete__frag_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_frag *frag = NULL;
+	int ret = rpma_frag_delete(&frag);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * delete__mr_dereg_ERRNO -- rpma_mr_dereg() fails
+ */
+static void
+delete__mr_dereg_ERRNO(void **unused)
+{
+	struct frag_test_state *fstate;
+	setup__frag_new((void **)&fstate);
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, RPMA_E_PROVIDER);
+	will_return(rpma_mr_dereg, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_frag_delete(&fstate->frag);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(fstate->frag);
+}
+
+static const struct CMUnitTest tests_new[] = {
+	/* rpma_frag_new() unit tests */
+	cmocka_unit_test(new__peer_NULL),
+	cmocka_unit_test(new__conn_NULL),
+	cmocka_unit_test(new__frag_ptr_NULL),
+	cmocka_unit_test(new__frag_size_invalid),
+	cmocka_unit_test(new__depth_0),
+	cmocka_unit_test(new__get_rq_size_ERRNO),
+	cmocka_unit_test(new__depth_exceeds_rq_size),
+	cmocka_unit_test(new__malloc_ERRNO),
+	cmocka_unit_test(new__malloc_rx_ERRNO),
+	cmocka_unit_test(new__mr_reg_ERRNO),
+	cmocka_unit_test(new__recv_first_ERRNO),
+	cmocka_unit_test(new__recv_ERRNO),
+	cmocka_unit_test_setup_teardown(new__success, setup__frag_new, teardown__frag_delete),
+
+	/* rpma_frag_delete() unit tests */
+	cmocka_unit_test(delete__frag_ptr_NULL),
+	cmocka_unit_test(delete__frag_NULL),
+	cmocka_unit_test(delete__mr_dereg_ERRNO),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_new, NULL, NULL);
+}
@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * frag-recv.c -- the rpma_frag_recv() unit tests
+ *
+ * API covered:
+ * - rpma_frag_recv()
+ */
+
+#include "frag-common.h"
+
+#define MOCK_DST_SIZE	(4 * MOCK_FRAG_SIZE)
+#define MOCK_LAST_LEN	5
+
+/*
+ * fill_rx -- fill the receive buffer with the pattern
+ */
+static void
+fill_rx(struct frag_test_state *fstate, uint32_t buf, char pattern)
+{
+	memset(fstate->rx + buf * MOCK_FRAG_SIZE, pattern, MOCK_FRAG_SIZE);
+}
+
+/*
+ * recv__frag_NULL -- NULL frag is invalid
+ */
+static void
+recv__frag_NULL(void **unused)
+{
+	char dst[MOCK_DST_SIZE];
+	struct ibv_wc wc = frag_wc_recv(NULL, 0, MOCK_FRAG_SIZE);
+	bool done = false;
+	size_t len = 0;
+
+	/* run test */
+	int ret = rpma_frag_recv(NULL, &wc, dst, sizeof(dst), &done, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * recv__dst_NULL -- NULL dst with a non-zero dst_size is invalid
+ */
+static void
+recv__dst_NULL(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	struct ibv_wc wc = frag_wc_recv(fstate->frag, 0, MOCK_FRAG_SIZE);
+	bool done = false;
+	size_t len = 0;
+
+	/* run test */
+	int ret = rpma_frag_recv(fstate->frag, &wc, NULL, MOCK_DST_SIZE, &done, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * recv__wrong_wc -- the completion is not a receive of a fragment
+ */
+static void
+recv__wrong_wc(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_DST_SIZE];
+	bool done = false;
+	size_t len = 0;
+
+	struct ibv_wc wcs[4];
+	for (size_t i = 0; i < sizeof(wcs) / sizeof(wcs[0]); i++)
+		wcs[i] = frag_wc_recv(fstate->frag, 0, MOCK_FRAG_SIZE);
+	wcs[0].opcode = IBV_WC_SEND;
+	wcs[1].wc_flags = 0;
+	wcs[2].wr_id = (uint64_t)MOCK_OP_CONTEXT;
+	wcs[3].byte_len = MOCK_FRAG_SIZE + 1;
+
+	for (size_t i = 0; i < sizeof(wcs) / sizeof(wcs[0]); i++) {
+		/* run test */
+		int ret = rpma_frag_recv(fstate->frag, &wcs[i], dst, sizeof(dst), &done, &len);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_INVAL);
+	}
+}
+
+/*
+ * recv__out_of_sequence -- the fragment does not follow the previous one
+ * (the rest of its message is dropped and the reassembly resumes with the next one)
+ */
+static void
+recv__out_of_sequence(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_DST_SIZE];
+	uint32_t imms[] = {1, 2 | MOCK_IMM_LAST, 3 | MOCK_IMM_LAST};
+	int rets[] = {RPMA_E_INVAL, MOCK_OK, MOCK_OK};
+	bool dones[] = {false, false, true};
+
+	for (uint32_t i = 0; i < 3; i++) {
+		/* configure mocks */
+		fill_rx(fstate, i, (char)('a' + i));
+		configure_frag_recv(i, MOCK_OK);
+		struct ibv_wc wc = frag_wc_recv(fstate->frag, imms[i], MOCK_LAST_LEN);
+		bool done = !dones[i];
+		size_t len = 0;
+
+		/* run test */
+		int ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+
+		/* verify the results */
+		assert_int_equal(ret, rets[i]);
+		assert_int_equal(done, dones[i]);
+	}
+
+	assert_int_equal(dst[0], 'c');
+}
+
+/*
+ * recv__recv_ERRNO -- rpma_recv() fails (the fragment is consumed anyway)
+ */
+static void
+recv__recv_ERRNO(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_DST_SIZE];
+	struct ibv_wc wc = frag_wc_recv(fstate->frag, 0, MOCK_FRAG_SIZE);
+	bool done = true;
+	size_t len = 0;
+
+	/* configure mocks */
+	configure_frag_recv(0, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_false(done);
+	assert_int_equal(len, MOCK_FRAG_SIZE);
+
+	/* the next fragment is received into the next buffer */
+	configure_frag_recv(1, MOCK_OK);
+	wc = frag_wc_recv(fstate->frag, 1 | MOCK_IMM_LAST, MOCK_LAST_LEN);
+	ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+	assert_int_equal(ret, MOCK_OK);
+	assert_true(done);
+	assert_int_equal(len, MOCK_FRAG_SIZE + MOCK_LAST_LEN);
+}
+
+/*
+ * recv__aborted -- the sender aborts the message
+ */
+static void
+recv__aborted(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_DST_SIZE];
+	uint32_t imms[] = {0, 1 | MOCK_IMM_ABORT, 2 | MOCK_IMM_LAST};
+	uint32_t lens[] = {MOCK_FRAG_SIZE, 0, MOCK_LAST_LEN};
+	int rets[] = {MOCK_OK, RPMA_E_INVAL, MOCK_OK};
+	bool dones[] = {false, false, true};
+
+	for (uint32_t i = 0; i < 3; i++) {
+		/* configure mocks */
+		fill_rx(fstate, i, (char)('a' + i));
+		configure_frag_recv(i, MOCK_OK);
+		struct ibv_wc wc = frag_wc_recv(fstate->frag, imms[i], lens[i]);
+		bool done = !dones[i];
+		size_t len = 0;
+
+		/* run test */
+		int ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+
+		/* verify the results */
+		assert_int_equal(ret, rets[i]);
+		assert_int_equal(done, dones[i]);
+	}
+
+	/* the next message is reassembled from the beginning of dst */
+	assert_int_equal(dst[0], 'c');
+}
+
+/*
+ * recv__success -- the fragments are reassembled in the destination
+ */
+static void
+recv__success(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_DST_SIZE];
+	memset(dst, 0, sizeof(dst));
+	uint32_t imms[] = {0, 1, 2 | MOCK_IMM_LAST};
+	uint32_t lens[] = {MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, MOCK_LAST_LEN};
+	size_t total = 0;
+
+	for (uint32_t i = 0; i < 3; i++) {
+		/* configure mocks */
+		fill_rx(fstate, i, (char)('a' + i));
+		configure_frag_recv(i, MOCK_OK);
+		struct ibv_wc wc = frag_wc_recv(fstate->frag, imms[i], lens[i]);
+		bool done = true;
+		size_t len = 0;
+
+		/* run test */
+		int ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+
+		/* verify the results */
+		total += lens[i];
+		assert_int_equal(ret, MOCK_OK);
+		assert_int_equal(done, i == 2);
+		assert_int_equal(len, total);
+	}
+
+	char exp[MOCK_DST_SIZE];
+	memset(exp, 0, sizeof(exp));
+	memset(exp, 'a', MOCK_FRAG_SIZE);
+	memset(exp + MOCK_FRAG_SIZE, 'b', MOCK_FRAG_SIZE);
+	memset(exp + 2 * MOCK_FRAG_SIZE, 'c', MOCK_LAST_LEN);
+	assert_memory_equal(dst, exp, sizeof(dst));
+}
+
+/*
+ * recv__buffers_wrap -- the receive buffers are reused in the order of posting
+ */
+static void
+recv__buffers_wrap(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_DST_SIZE];
+
+	for (uint32_t i = 0; i < MOCK_DEPTH + 1; i++) {
+		/* configure mocks */
+		uint32_t buf = i % MOCK_DEPTH;
+		fill_rx(fstate, buf, (char)('a' + i));
+		configure_frag_recv(buf, MOCK_OK);
+		struct ibv_wc wc = frag_wc_recv(fstate->frag, i | MOCK_IMM_LAST, MOCK_LAST_LEN);
+		bool done = false;
+		size_t len = 0;
+
+		/* run test */
+		int ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_true(done);
+		assert_int_equal(len, MOCK_LAST_LEN);
+		assert_int_equal(dst[0], 'a' + i);
+	}
+}
+
+/*
+ * recv__overflow -- the message does not fit into the destination
+ */
+static void
+recv__overflow(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	char dst[MOCK_FRAG_SIZE + MOCK_LAST_LEN];
+	uint32_t imms[] = {0, 1, 2 | MOCK_IMM_LAST, 3 | MOCK_IMM_LAST};
+	uint32_t lens[] = {MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, MOCK_LAST_LEN};
+	int rets[] = {MOCK_OK, RPMA_E_INVAL, MOCK_OK, MOCK_OK};
+	bool dones[] = {false, false, false, true};
+
+	for (uint32_t i = 0; i < 4; i++) {
+		/* configure mocks */
+		configure_frag_recv(i, MOCK_OK);
+		struct ibv_wc wc = frag_wc_recv(fstate->frag, imms[i], lens[i]);
+		bool done = false;
+		size_t len = 0;
+
+		/* run test */
+		int ret = rpma_frag_recv(fstate->frag, &wc, dst, sizeof(dst), &done, &len);
+
+		/* verify the results */
+		assert_int_equal(ret, rets[i]);
+		assert_int_equal(done, dones[i]);
+	}
+}
+
+static const struct CMUnitTest tests_recv[] = {
+	/* rpma_frag_recv() unit tests */
+	cmocka_unit_test(recv__frag_NULL),
+	cmocka_unit_test_setup_teardown(recv__dst_NULL,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__wrong_wc,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__out_of_sequence,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__recv_ERRNO,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__aborted,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__success,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__buffers_wrap,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(recv__overflow,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_recv, NULL, NULL);
+}
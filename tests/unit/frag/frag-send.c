@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * frag-send.c -- the rpma_frag_send/_send_progress() unit tests
+ *
+ * APIs covered:
+ * - rpma_frag_send()
+ * - rpma_frag_send_progress()
+ */
+
+#include "frag-common.h"
+
+/* 6 fragments, the last one is shorter */
+#define MOCK_MSG_LEN	(6 * MOCK_FRAG_SIZE - 4)
+
+/*
+ * send__frag_NULL -- NULL frag is invalid
+ */
+static void
+send__frag_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_frag_send(NULL, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET, MOCK_MSG_LEN,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__src_NULL_len_not_0 -- NULL src with a non-zero length is invalid
+ */
+static void
+send__src_NULL_len_not_0(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* run test */
+	int ret = rpma_frag_send(fstate->frag, NULL, 0, MOCK_MSG_LEN, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__send_with_imm_ERRNO -- posting the first fragment fails
+ */
+static void
+send__send_with_imm_ERRNO(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	configure_frag_send(0, MOCK_FRAG_SIZE, 0, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_frag_send(fstate->frag, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_MSG_LEN, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	/* the message is not being sent so an empty one can be sent instead */
+	configure_frag_send(0, 0, 0 | MOCK_IMM_LAST, MOCK_OK);
+	ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__later_send_with_imm_ERRNO -- posting a fragment fails after some have been posted
+ * (the message is aborted and the failure is reported with the last completion)
+ */
+static void
+send__later_send_with_imm_ERRNO(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	configure_frag_send(0, MOCK_FRAG_SIZE, 0, MOCK_OK);
+	configure_frag_send(MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, 1, MOCK_OK);
+	configure_frag_send(2 * MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, 2, RPMA_E_PROVIDER);
+	configure_frag_send(0, 0, 2 | MOCK_IMM_ABORT, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_frag_send(fstate->frag, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_MSG_LEN, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	/* the message is still being sent */
+	ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_AGAIN);
+
+	/* the abort fragment is posted again with the first completion */
+	configure_frag_send(0, 0, 2 | MOCK_IMM_ABORT, MOCK_OK);
+
+	struct ibv_wc wc = frag_wc_send(fstate->frag);
+	bool done = true;
+	const void *op_context = MOCK_OP_CONTEXT;
+	for (int i = 0; i < 2; i++) {
+		/* run test */
+		ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_false(done);
+		assert_null(op_context);
+	}
+
+	/* run test */
+	ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_true(done);
+	assert_ptr_equal(op_context, MOCK_OP_CONTEXT);
+
+	/* the sequence numbers continue after the abort fragment */
+	configure_frag_send(0, 0, 3 | MOCK_IMM_LAST, MOCK_OK);
+	ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__empty_success -- an empty message is a single zero-length fragment
+ */
+static void
+send__empty_success(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	configure_frag_send(0, 0, 0 | MOCK_IMM_LAST, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	/* run test */
+	struct ibv_wc wc = frag_wc_send(fstate->frag);
+	bool done = false;
+	const void *op_context = NULL;
+	ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_true(done);
+	assert_ptr_equal(op_context, MOCK_OP_CONTEXT);
+}
+
+/*
+ * send__pipeline_success -- up to depth fragments are in flight
+ */
+static void
+send__pipeline_success(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	for (uint32_t i = 0; i < MOCK_DEPTH; i++)
+		configure_frag_send(i * MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_frag_send(fstate->frag, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_MSG_LEN, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	/* another message cannot be sent in the meantime */
+	ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_AGAIN);
+
+	/* the completions of the first two fragments let the remaining ones go */
+	configure_frag_send(4 * MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, 4, MOCK_OK);
+	configure_frag_send(5 * MOCK_FRAG_SIZE, MOCK_FRAG_SIZE - 4, 5 | MOCK_IMM_LAST, MOCK_OK);
+
+	struct ibv_wc wc = frag_wc_send(fstate->frag);
+	bool done = true;
+	const void *op_context = MOCK_OP_CONTEXT;
+	for (int i = 0; i < 5; i++) {
+		/* run test */
+		ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_false(done);
+		assert_null(op_context);
+	}
+
+	/* run test */
+	ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_true(done);
+	assert_ptr_equal(op_context, MOCK_OP_CONTEXT);
+
+	/* the sequence numbers continue with the next message */
+	configure_frag_send(0, 0, 6 | MOCK_IMM_LAST, MOCK_OK);
+	ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send_progress__frag_NULL -- NULL frag is invalid
+ */
+static void
+send_progress__frag_NULL(void **unused)
+{
+	struct ibv_wc wc = frag_wc_send(NULL);
+	bool done = false;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_frag_send_progress(NULL, &wc, &done, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send_progress__not_sending -- there is no message being sent
+ */
+static void
+send_progress__not_sending(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+	struct ibv_wc wc = frag_wc_send(fstate->frag);
+	bool done = false;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send_progress__wrong_wc -- the completion is not a completion of a fragment
+ */
+static void
+send_progress__wrong_wc(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	configure_frag_send(0, 0, 0 | MOCK_IMM_LAST, MOCK_OK);
+	int ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+
+	struct ibv_wc wcs[2];
+	wcs[0] = frag_wc_send(fstate->frag);
+	wcs[0].opcode = IBV_WC_RECV;
+	wcs[1] = frag_wc_send(NULL);
+	bool done = false;
+	const void *op_context = NULL;
+
+	for (size_t i = 0; i < sizeof(wcs) / sizeof(wcs[0]); i++) {
+		/* run test */
+		ret = rpma_frag_send_progress(fstate->frag, &wcs[i], &done, &op_context);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_INVAL);
+	}
+}
+
+/*
+ * send_progress__send_with_imm_ERRNO -- posting the next fragment fails
+ * (the message is aborted and the failure is reported with the last completion)
+ */
+static void
+send_progress__send_with_imm_ERRNO(void **fstate_ptr)
+{
+	struct frag_test_state *fstate = *fstate_ptr;
+
+	/* configure mocks */
+	for (uint32_t i = 0; i < MOCK_DEPTH; i++)
+		configure_frag_send(i * MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, i, MOCK_OK);
+	int ret = rpma_frag_send(fstate->frag, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_MSG_LEN, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+	configure_frag_send(4 * MOCK_FRAG_SIZE, MOCK_FRAG_SIZE, 4, RPMA_E_PROVIDER);
+	configure_frag_send(0, 0, 4 | MOCK_IMM_ABORT, MOCK_OK);
+
+	struct ibv_wc wc = frag_wc_send(fstate->frag);
+	bool done = true;
+	const void *op_context = MOCK_OP_CONTEXT;
+	for (int i = 0; i < MOCK_DEPTH; i++) {
+		/* run test */
+		ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_false(done);
+		assert_null(op_context);
+	}
+
+	/* run test */
+	ret = rpma_frag_send_progress(fstate->frag, &wc, &done, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_true(done);
+	assert_ptr_equal(op_context, MOCK_OP_CONTEXT);
+
+	/* the sequence numbers continue after the abort fragment */
+	configure_frag_send(0, 0, 5 | MOCK_IMM_LAST, MOCK_OK);
+	ret = rpma_frag_send(fstate->frag, NULL, 0, 0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_send[] = {
+	/* rpma_frag_send() unit tests */
+	cmocka_unit_test(send__frag_NULL),
+	cmocka_unit_test_setup_teardown(send__src_NULL_len_not_0,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(send__send_with_imm_ERRNO,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(send__later_send_with_imm_ERRNO,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(send__empty_success,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(send__pipeline_success,
+		setup__frag_new, teardown__frag_delete),
+
+	/* rpma_frag_send_progress() unit tests */
+	cmocka_unit_test(send_progress__frag_NULL),
+	cmocka_unit_test_setup_teardown(send_progress__not_sending,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(send_progress__wrong_wc,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test_setup_teardown(send_progress__send_with_imm_ERRNO,
+		setup__frag_new, teardown__frag_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_send, NULL, NULL);
+}
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * hook-set.c -- the rpma_hook_set() unit tests
+ *
+ * APIs covered:
+ * - rpma_hook_set()
+ * - rpma_hook_post()
+ * - rpma_hook_completion()
+ * - rpma_hook_fini()
+ */
+
+#include "cmocka_headers.h"
+#include "hook.h"
+#include "test-common.h"
+
+#define MOCK_ARG		((void *)0xA4C1)
+#define MOCK_ARG_2		((void *)0xA4C2)
+#define MOCK_SAMPLING_RATE	3
+
+/*
+ * post_hook -- rpma_hook_post_function mock
+ */
+static void
+post_hook(enum rpma_hook_op op, uint32_t qp_num, size_t len, const void *op_context, void *arg)
+{
+	check_expected(op);
+	check_expected(qp_num);
+	check_expected(len);
+	check_expected_ptr(op_context);
+	check_expected_ptr(arg);
+}
+
+/*
+ * completion_hook -- rpma_hook_completion_function mock
+ */
+static void
+completion_hook(const struct ibv_wc *wc, void *arg)
+{
+	uint64_t wr_id = wc->wr_id;
+
+	check_expected(wr_id);
+	check_expected_ptr(arg);
+}
+
+/*
+ * expect_post_hook -- configure the expected call of post_hook()
+ */
+static void
+expect_post_hook(enum rpma_hook_op op, void *arg)
+{
+	expect_value(post_hook, op, op);
+	expect_value(post_hook, qp_num, MOCK_QP_NUM);
+	expect_value(post_hook, len, MOCK_LEN);
+	expect_value(post_hook, op_context, MOCK_OP_CONTEXT);
+	expect_value(post_hook, arg, arg);
+}
+
+/*
+ * teardown__hook_fini -- free all the hooks
+ */
+static int
+teardown__hook_fini(void **unused)
+{
+	rpma_hook_fini();
+
+	return 0;
+}
+
+/*
+ * set__sampling_rate_0 -- sampling_rate == 0 is invalid
+ */
+static void
+set__sampling_rate_0(void **unused)
+{
+	/* run test */
+	int ret = rpma_hook_set(post_hook, completion_hook, MOCK_ARG, 0);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * set__malloc_ERRNO -- malloc() fails with MOCK_ERRNO
+ */
+static void
+set__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_hook_set(post_hook, completion_hook, MOCK_ARG, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+
+	/* no hook is called */
+	rpma_hook_post(RPMA_HOOK_WRITE, MOCK_QP_NUM, MOCK_LEN, MOCK_OP_CONTEXT);
+}
+
+/*
+ * set__success -- every post and every completion is passed to the hooks
+ */
+static void
+set__success(void **unused)
+{
+	struct ibv_wc wc[2] = {{0}};
+	wc[0].wr_id = 0;
+	wc[1].wr_id = 1;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_hook_set(post_hook, completion_hook, MOCK_ARG, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	expect_post_hook(RPMA_HOOK_READ, MOCK_ARG);
+	RPMA_HOOK_POST(RPMA_HOOK_READ, MOCK_QP_NUM, MOCK_LEN, MOCK_OP_CONTEXT);
+
+	expect_value(completion_hook, wr_id, 0);
+	expect_value(completion_hook, arg, MOCK_ARG);
+	expect_value(completion_hook, wr_id, 1);
+	expect_value(completion_hook, arg, MOCK_ARG);
+	RPMA_HOOK_COMPLETION(wc, 2);
+}
+
+/*
+ * set__sampling -- only every sampling_rate-th post and completion is passed to the hooks
+ */
+static void
+set__sampling(void **unused)
+{
+	struct ibv_wc wc[2 * MOCK_SAMPLING_RATE] = {{0}};
+	for (int i = 0; i < 2 * MOCK_SAMPLING_RATE; i++)
+		wc[i].wr_id = (uint64_t)i;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_hook_set(post_hook, completion_hook, MOCK_ARG, MOCK_SAMPLING_RATE);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	expect_post_hook(RPMA_HOOK_SEND, MOCK_ARG);
+	expect_post_hook(RPMA_HOOK_SEND, MOCK_ARG);
+	for (int i = 0; i < 2 * MOCK_SAMPLING_RATE; i++)
+		rpma_hook_post(RPMA_HOOK_SEND, MOCK_QP_NUM, MOCK_LEN, MOCK_OP_CONTEXT);
+
+	expect_value(completion_hook, wr_id, MOCK_SAMPLING_RATE - 1);
+	expect_value(completion_hook, arg, MOCK_ARG);
+	expect_value(completion_hook, wr_id, 2 * MOCK_SAMPLING_RATE - 1);
+	expect_value(completion_hook, arg, MOCK_ARG);
+	rpma_hook_completion(wc, 2 * MOCK_SAMPLING_RATE);
+}
+
+/*
+ * set__replace -- the new hooks replace the previous ones
+ */
+static void
+set__replace(void **unused)
+{
+	struct ibv_wc wc = {0};
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_hook_set(NULL, completion_hook, MOCK_ARG, 1);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_hook_set(post_hook, NULL, MOCK_ARG_2, 1);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	expect_post_hook(RPMA_HOOK_FLUSH, MOCK_ARG_2);
+	rpma_hook_post(RPMA_HOOK_FLUSH, MOCK_QP_NUM, MOCK_LEN, MOCK_OP_CONTEXT);
+
+	/* the completion hook is not set anymore */
+	rpma_hook_completion(&wc, 1);
+}
+
+/*
+ * set__unset -- no hook is called after the hooks are unset
+ */
+static void
+set__unset(void **unused)
+{
+	struct ibv_wc wc = {0};
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	int ret = rpma_hook_set(post_hook, completion_hook, MOCK_ARG, 1);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* run test */
+	ret = rpma_hook_set(NULL, NULL, NULL, 0);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	RPMA_HOOK_POST(RPMA_HOOK_RECV, MOCK_QP_NUM, MOCK_LEN, MOCK_OP_CONTEXT);
+	RPMA_HOOK_COMPLETION(&wc, 1);
+	rpma_hook_post(RPMA_HOOK_RECV, MOCK_QP_NUM, MOCK_LEN, MOCK_OP_CONTEXT);
+	rpma_hook_completion(&wc, 1);
+}
+
+static const struct CMUnitTest tests_set[] = {
+	/* rpma_hook_set() unit tests */
+	cmocka_unit_test(set__sampling_rate_0),
+	cmocka_unit_test(set__malloc_ERRNO),
+	cmocka_unit_test_teardown(set__success, teardown__hook_fini),
+	cmocka_unit_test_teardown(set__sampling, teardown__hook_fini),
+	cmocka_unit_test_teardown(set__replace, teardown__hook_fini),
+	cmocka_unit_test_teardown(set__unset, teardown__hook_fini),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_set, NULL, NULL);
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * imm_demux-common.c -- the rpma_imm_demux unit tests common functions
+ */
+
+#include "imm_demux-common.h"
+
+/*
+ * setup__imm_demux_new -- prepare a valid demux object
+ */
+int
+setup__imm_demux_new(void **demux_ptr)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test */
+	struct rpma_imm_demux *demux = NULL;
+	int ret = rpma_imm_demux_new(&demux);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(demux);
+
+	*demux_ptr = demux;
+
+	return 0;
+}
+
+/*
+ * teardown__imm_demux_delete -- delete the demux object
+ */
+int
+teardown__imm_demux_delete(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	/* run test */
+	int ret = rpma_imm_demux_delete(&demux);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(demux);
+
+	return 0;
+}
+
+/*
+ * handler_mock -- a handler of the completions
+ */
+int
+handler_mock(const struct ibv_wc *wc, uint32_t imm, void *arg)
+{
+	check_expected(wc->wr_id);
+	check_expected(imm);
+	check_expected_ptr(arg);
+
+	return mock_type(int);
+}
+
+/*
+ * configure_handler -- configure the handler_mock() for the completion
+ */
+void
+configure_handler(uint64_t wr_id, uint32_t imm, void *arg, int ret)
+{
+	expect_value(handler_mock, wc->wr_id, wr_id);
+	expect_value(handler_mock, imm, imm);
+	expect_value(handler_mock, arg, arg);
+	will_return(handler_mock, ret);
+}
+
+/*
+ * imm_wc -- a successful completion carrying the immediate data
+ */
+struct ibv_wc
+imm_wc(uint64_t wr_id, uint32_t imm)
+{
+	struct ibv_wc wc = {0};
+	wc.wr_id = wr_id;
+	wc.status = IBV_WC_SUCCESS;
+	wc.opcode = IBV_WC_RECV;
+	wc.wc_flags = IBV_WC_WITH_IMM;
+	wc.imm_data = htonl(imm);
+
+	return wc;
+}
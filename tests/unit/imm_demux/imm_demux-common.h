@@ -0,0 +1,35 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * imm_demux-common.h -- the rpma_imm_demux unit tests common definitions
+ */
+
+#ifndef IMM_DEMUX_COMMON_H
+#define IMM_DEMUX_COMMON_H
+
+#include <arpa/inet.h>
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "mocks-rpma-cq.h"
+#include "test-common.h"
+
+#define MOCK_ARG_A		(void *)0xA1A1
+#define MOCK_ARG_B		(void *)0xB1B1
+#define MOCK_ARG_DEFAULT	(void *)0xD1D1
+
+/* two streams identified by the top 8 bits of the immediate data */
+#define MOCK_STREAM_A_MIN	0x01000000
+#define MOCK_STREAM_A_MAX	0x01FFFFFF
+#define MOCK_STREAM_B_MIN	0x02000000
+#define MOCK_STREAM_B_MAX	0x02FFFFFF
+
+int setup__imm_demux_new(void **demux_ptr);
+int teardown__imm_demux_delete(void **demux_ptr);
+
+int handler_mock(const struct ibv_wc *wc, uint32_t imm, void *arg);
+void configure_handler(uint64_t wr_id, uint32_t imm, void *arg, int ret);
+struct ibv_wc imm_wc(uint64_t wr_id, uint32_t imm);
+
+#endif /* IMM_DEMUX_COMMON_H */
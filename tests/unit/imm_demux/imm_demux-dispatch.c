@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * imm_demux-dispatch.c -- the rpma_imm_demux_dispatch() unit tests
+ *
+ * API covered:
+ * - rpma_imm_demux_dispatch()
+ */
+
+#include "imm_demux-common.h"
+
+#define MOCK_BATCH	32
+
+/*
+ * configure_get_wc -- configure the rpma_cq_get_wc() mock
+ */
+static void
+configure_get_wc(int num_entries, int num_got, const struct ibv_wc *wc)
+{
+	expect_value(rpma_cq_get_wc, num_entries, num_entries);
+	will_return(rpma_cq_get_wc, MOCK_OK);
+	will_return(rpma_cq_get_wc, num_got);
+	will_return(rpma_cq_get_wc, wc);
+}
+
+/*
+ * setup__streams -- prepare a demux object with the two streams registered
+ */
+static int
+setup__streams(void **demux_ptr)
+{
+	setup__imm_demux_new(demux_ptr);
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	int ret = rpma_imm_demux_register(demux, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX,
+			handler_mock, MOCK_ARG_A);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_imm_demux_register(demux, MOCK_STREAM_B_MIN, MOCK_STREAM_B_MAX,
+			handler_mock, MOCK_ARG_B);
+	assert_int_equal(ret, MOCK_OK);
+
+	return 0;
+}
+
+/*
+ * dispatch__demux_NULL -- NULL demux is invalid
+ */
+static void
+dispatch__demux_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_imm_demux_dispatch(NULL, MOCK_RPMA_CQ, 1, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * dispatch__cq_NULL -- NULL cq is invalid
+ */
+static void
+dispatch__cq_NULL(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	/* run test */
+	int ret = rpma_imm_demux_dispatch(demux, NULL, 1, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * dispatch__max_entries_0 -- max_entries < 1 is invalid
+ */
+static void
+dispatch__max_entries_0(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	/* run test */
+	int ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 0, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * dispatch__get_wc_ERRNO -- rpma_cq_get_wc() fails
+ */
+static void
+dispatch__get_wc_ERRNO(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	int errors[] = {RPMA_E_NO_COMPLETION, RPMA_E_PROVIDER};
+
+	for (size_t i = 0; i < sizeof(errors) / sizeof(errors[0]); i++) {
+		/* configure mocks */
+		expect_value(rpma_cq_get_wc, num_entries, 1);
+		will_return(rpma_cq_get_wc, errors[i]);
+
+		/* run test */
+		int num = -1;
+		int ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 1, &num);
+
+		/* verify the results */
+		assert_int_equal(ret, errors[i]);
+		assert_int_equal(num, 0);
+	}
+}
+
+/*
+ * dispatch__success -- the completions are dispatched to the handlers of their streams
+ */
+static void
+dispatch__success(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	uint32_t imms[] = {MOCK_STREAM_A_MIN, MOCK_STREAM_B_MAX, MOCK_STREAM_A_MAX,
+			MOCK_STREAM_B_MIN + 0x1234};
+	void *args[] = {MOCK_ARG_A, MOCK_ARG_B, MOCK_ARG_A, MOCK_ARG_B};
+	struct ibv_wc wc[4];
+
+	/* configure mocks */
+	for (uint32_t i = 0; i < 4; i++) {
+		wc[i] = imm_wc(i, imms[i]);
+		configure_handler(i, imms[i], args[i], MOCK_OK);
+	}
+	configure_get_wc(8, 4, wc);
+
+	/* run test */
+	int num = 0;
+	int ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 8, &num);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num, 4);
+}
+
+/*
+ * dispatch__default -- the completions not matching any stream go to the default handler
+ */
+static void
+dispatch__default(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	struct ibv_wc wc[3];
+	wc[0] = imm_wc(0, MOCK_STREAM_B_MAX + 1);
+	wc[1] = imm_wc(1, MOCK_STREAM_A_MIN);
+	wc[1].wc_flags = 0;
+	wc[2] = imm_wc(2, MOCK_STREAM_A_MIN);
+	wc[2].status = IBV_WC_WR_FLUSH_ERR;
+
+	/* configure mocks */
+	int ret = rpma_imm_demux_set_default(demux, handler_mock, MOCK_ARG_DEFAULT);
+	assert_int_equal(ret, MOCK_OK);
+	configure_handler(0, MOCK_STREAM_B_MAX + 1, MOCK_ARG_DEFAULT, MOCK_OK);
+	configure_handler(1, 0, MOCK_ARG_DEFAULT, MOCK_OK);
+	configure_handler(2, 0, MOCK_ARG_DEFAULT, MOCK_OK);
+	configure_get_wc(3, 3, wc);
+
+	/* run test */
+	int num = 0;
+	ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 3, &num);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num, 3);
+}
+
+/*
+ * dispatch__no_default -- the completions not matching any stream are dropped
+ */
+static void
+dispatch__no_default(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	struct ibv_wc wc[2];
+	wc[0] = imm_wc(0, 0);
+	wc[1] = imm_wc(1, MOCK_STREAM_B_MIN);
+
+	/* configure mocks */
+	configure_handler(1, MOCK_STREAM_B_MIN, MOCK_ARG_B, MOCK_OK);
+	configure_get_wc(2, 2, wc);
+
+	/* run test */
+	int num = 0;
+	int ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 2, &num);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num, 2);
+}
+
+/*
+ * dispatch__handler_error -- all collected completions are dispatched but no more are collected
+ */
+static void
+dispatch__handler_error(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	struct ibv_wc wc[3];
+	wc[0] = imm_wc(0, MOCK_STREAM_A_MIN);
+	wc[1] = imm_wc(1, MOCK_STREAM_B_MIN);
+	wc[2] = imm_wc(2, MOCK_STREAM_A_MIN);
+
+	/* configure mocks */
+	configure_handler(0, MOCK_STREAM_A_MIN, MOCK_ARG_A, MOCK_OK);
+	configure_handler(1, MOCK_STREAM_B_MIN, MOCK_ARG_B, MOCK_ERRNO);
+	configure_handler(2, MOCK_STREAM_A_MIN, MOCK_ARG_A, -MOCK_ERRNO);
+	configure_get_wc(MOCK_BATCH, 3, wc);
+
+	/* run test */
+	int num = 0;
+	int ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 2 * MOCK_BATCH, &num);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_ERRNO);
+	assert_int_equal(num, 3);
+}
+
+/*
+ * dispatch__batches -- the completions are collected in batches until the CQ is empty
+ */
+static void
+dispatch__batches(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	struct ibv_wc wc[MOCK_BATCH];
+
+	/* configure mocks */
+	for (uint32_t i = 0; i < MOCK_BATCH; i++) {
+		wc[i] = imm_wc(i, MOCK_STREAM_A_MIN + i);
+		configure_handler(i, MOCK_STREAM_A_MIN + i, MOCK_ARG_A, MOCK_OK);
+	}
+	configure_get_wc(MOCK_BATCH, MOCK_BATCH, wc);
+	expect_value(rpma_cq_get_wc, num_entries, 8);
+	will_return(rpma_cq_get_wc, RPMA_E_NO_COMPLETION);
+
+	/* run test */
+	int num = 0;
+	int ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, MOCK_BATCH + 8, &num);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num, MOCK_BATCH);
+}
+
+static const struct CMUnitTest tests_dispatch[] = {
+	/* rpma_imm_demux_dispatch() unit tests */
+	cmocka_unit_test(dispatch__demux_NULL),
+	cmocka_unit_test_setup_teardown(dispatch__cq_NULL,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__max_entries_0,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__get_wc_ERRNO,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__success,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__default,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__no_default,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__handler_error,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(dispatch__batches,
+		setup__streams, teardown__imm_demux_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_dispatch, NULL, NULL);
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * imm_demux-new.c -- the rpma_imm_demux_new/_delete() unit tests
+ *
+ * APIs covered:
+ * - rpma_imm_demux_new()
+ * - rpma_imm_demux_delete()
+ */
+
+#include "imm_demux-common.h"
+
+/*
+ * new__demux_ptr_NULL -- NULL demux_ptr is invalid
+ */
+static void
+new__demux_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_imm_demux_new(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new__malloc_ERRNO -- malloc() fails
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_imm_demux *demux = NULL;
+	int ret = rpma_imm_demux_new(&demux);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(demux);
+}
+
+/*
+ * new__malloc_ranges_ERRNO -- malloc() of the ranges fails
+ */
+static void
+new__malloc_ranges_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_imm_demux *demux = NULL;
+	int ret = rpma_imm_demux_new(&demux);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(demux);
+}
+
+/*
+ * new__success -- happy day scenario
+ */
+static void
+new__success(void **demux_ptr)
+{
+	/*
+	 * The thing is done by setup__imm_demux_new()
+	 * and teardown__imm_demux_delete().
+	 */
+}
+
+/*
+ * delete__demux_ptr_NULL -- NULL demux_ptr is invalid
+ */
+static void
+delete__demux_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_imm_demux_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * delete__demux_NULL -- NULL *demux_ptr should exit quickly
+ */
+static void
+delete__demux_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_imm_demux *demux = NULL;
+	int ret = rpma_imm_demux_delete(&demux);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_new[] = {
+	/* rpma_imm_demux_new() unit tests */
+	cmocka_unit_test(new__demux_ptr_NULL),
+	cmocka_unit_test(new__malloc_ERRNO),
+	cmocka_unit_test(new__malloc_ranges_ERRNO),
+	cmocka_unit_test_setup_teardown(new__success,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+
+	/* rpma_imm_demux_delete() unit tests */
+	cmocka_unit_test(delete__demux_ptr_NULL),
+	cmocka_unit_test(delete__demux_NULL),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_new, NULL, NULL);
+}
@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * imm_demux-register.c -- the rpma_imm_demux_register/_unregister/_set_default() unit tests
+ *
+ * APIs covered:
+ * - rpma_imm_demux_register()
+ * - rpma_imm_demux_unregister()
+ * - rpma_imm_demux_set_default()
+ */
+
+#include "imm_demux-common.h"
+
+/*
+ * register__demux_NULL -- NULL demux is invalid
+ */
+static void
+register__demux_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_imm_demux_register(NULL, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX,
+			handler_mock, MOCK_ARG_A);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * register__handler_NULL -- NULL handler is invalid
+ */
+static void
+register__handler_NULL(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	/* run test */
+	int ret = rpma_imm_demux_register(demux, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX,
+			NULL, MOCK_ARG_A);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * register__min_greater_than_max -- imm_min > imm_max is invalid
+ */
+static void
+register__min_greater_than_max(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	/* run test */
+	int ret = rpma_imm_demux_register(demux, MOCK_STREAM_A_MAX, MOCK_STREAM_A_MIN,
+			handler_mock, MOCK_ARG_A);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * register__overlap -- the ranges cannot overlap
+ */
+static void
+register__overlap(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	uint32_t mins[] = {
+		MOCK_STREAM_A_MIN, MOCK_STREAM_A_MIN - 1, MOCK_STREAM_A_MAX, MOCK_STREAM_A_MIN + 1,
+		0
+	};
+	uint32_t maxs[] = {
+		MOCK_STREAM_A_MAX, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX + 1, MOCK_STREAM_A_MAX - 1,
+		UINT32_MAX
+	};
+
+	int ret = rpma_imm_demux_register(demux, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX,
+			handler_mock, MOCK_ARG_A);
+	assert_int_equal(ret, MOCK_OK);
+
+	for (size_t i = 0; i < sizeof(mins) / sizeof(mins[0]); i++) {
+		/* run test */
+		ret = rpma_imm_demux_register(demux, mins[i], maxs[i], handler_mock, MOCK_ARG_B);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_INVAL);
+	}
+}
+
+/*
+ * register__malloc_ERRNO -- growing the ranges array fails
+ */
+static void
+register__malloc_ERRNO(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	int ret;
+
+	/* fill the initial capacity */
+	for (uint32_t i = 0; i < 8; i++) {
+		ret = rpma_imm_demux_register(demux, i, i, handler_mock, MOCK_ARG_A);
+		assert_int_equal(ret, MOCK_OK);
+	}
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	ret = rpma_imm_demux_register(demux, 8, 8, handler_mock, MOCK_ARG_A);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+}
+
+/*
+ * register__grow_success -- the ranges array grows and stays sorted
+ */
+static void
+register__grow_success(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+	int ret;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* register the ranges in the reversed order */
+	for (uint32_t i = 10; i > 0; i--) {
+		ret = rpma_imm_demux_register(demux, i << 24, (i << 24) | 0xFF, handler_mock,
+				(void *)(uintptr_t)i);
+		assert_int_equal(ret, MOCK_OK);
+	}
+
+	/* configure mocks */
+	struct ibv_wc wc[10];
+	for (uint32_t i = 0; i < 10; i++) {
+		wc[i] = imm_wc(i, ((i + 1) << 24) | 0x10);
+		configure_handler(i, ((i + 1) << 24) | 0x10, (void *)(uintptr_t)(i + 1), MOCK_OK);
+	}
+	expect_value(rpma_cq_get_wc, num_entries, 10);
+	will_return(rpma_cq_get_wc, MOCK_OK);
+	will_return(rpma_cq_get_wc, 10);
+	will_return(rpma_cq_get_wc, wc);
+
+	/* run test */
+	int num = 0;
+	ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 10, &num);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(num, 10);
+}
+
+/*
+ * unregister__demux_NULL -- NULL demux is invalid
+ */
+static void
+unregister__demux_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_imm_demux_unregister(NULL, MOCK_STREAM_A_MIN);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * unregister__not_registered -- only a registered range can be unregistered
+ */
+static void
+unregister__not_registered(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	int ret = rpma_imm_demux_register(demux, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX,
+			handler_mock, MOCK_ARG_A);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* run test */
+	ret = rpma_imm_demux_unregister(demux, MOCK_STREAM_A_MIN + 1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * unregister__success -- the completions of the unregistered range go to the default handler
+ */
+static void
+unregister__success(void **demux_ptr)
+{
+	struct rpma_imm_demux *demux = *demux_ptr;
+
+	int ret = rpma_imm_demux_register(demux, MOCK_STREAM_A_MIN, MOCK_STREAM_A_MAX,
+			handler_mock, MOCK_ARG_A);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_imm_demux_register(demux, MOCK_STREAM_B_MIN, MOCK_STREAM_B_MAX,
+			handler_mock, MOCK_ARG_B);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_imm_demux_set_default(demux, handler_mock, MOCK_ARG_DEFAULT);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* run test */
+	ret = rpma_imm_demux_unregister(demux, MOCK_STREAM_A_MIN);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	/* configure mocks */
+	struct ibv_wc wc[2];
+	wc[0] = imm_wc(0, MOCK_STREAM_A_MIN);
+	wc[1] = imm_wc(1, MOCK_STREAM_B_MIN);
+	configure_handler(0, MOCK_STREAM_A_MIN, MOCK_ARG_DEFAULT, MOCK_OK);
+	configure_handler(1, MOCK_STREAM_B_MIN, MOCK_ARG_B, MOCK_OK);
+	expect_value(rpma_cq_get_wc, num_entries, 2);
+	will_return(rpma_cq_get_wc, MOCK_OK);
+	will_return(rpma_cq_get_wc, 2);
+	will_return(rpma_cq_get_wc, wc);
+
+	/* run test */
+	ret = rpma_imm_demux_dispatch(demux, MOCK_RPMA_CQ, 2, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * set_default__demux_NULL -- NULL demux is invalid
+ */
+static void
+set_default__demux_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_imm_demux_set_default(NULL, handler_mock, MOCK_ARG_DEFAULT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+static const struct CMUnitTest tests_register[] = {
+	/* rpma_imm_demux_register() unit tests */
+	cmocka_unit_test(register__demux_NULL),
+	cmocka_unit_test_setup_teardown(register__handler_NULL,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(register__min_greater_than_max,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(register__overlap,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(register__malloc_ERRNO,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(register__grow_success,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+
+	/* rpma_imm_demux_unregister() unit tests */
+	cmocka_unit_test(unregister__demux_NULL),
+	cmocka_unit_test_setup_teardown(unregister__not_registered,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+	cmocka_unit_test_setup_teardown(unregister__success,
+		setup__imm_demux_new, teardown__imm_demux_delete),
+
+	/* rpma_imm_demux_set_default() unit tests */
+	cmocka_unit_test(set_default__demux_NULL),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_register, NULL, NULL);
+}
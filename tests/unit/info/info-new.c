@@ -19,6 +19,7 @@
 #include "librpma.h"
 #include "info-common.h"
 #include "mocks-rdma_cm.h"
+#include "mocks-rpma-addr_cache.h"
 #include "mocks-string.h"
 #include "mocks-netdb.h"
 
@@ -227,6 +228,117 @@ new__lifecycle(void **unused)
 	assert_null(info);
 }
 
+/*
+ * new__malloc_ERRNO_cached -- malloc() fails with MOCK_ERRNO after the translated address
+ * got cached
+ */
+static void
+new__malloc_ERRNO_cached(void **unused)
+{
+	/* configure mocks */
+	Mock_addr_cache_enabled = true;
+	struct rdma_addrinfo rai = {0};
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	expect_value(rpma_addr_cache_lookup_addrinfo, side, RPMA_INFO_ACTIVE);
+	will_return(rpma_addr_cache_lookup_addrinfo, NULL);
+	will_return(rdma_getaddrinfo, &args);
+	expect_value(rdma_getaddrinfo, hints->ai_flags, 0);
+	expect_value(rpma_addr_cache_insert_addrinfo, side, RPMA_INFO_ACTIVE);
+	expect_value(rpma_addr_cache_insert_addrinfo, rai, &rai);
+	will_return(rpma_addr_cache_insert_addrinfo, true);
+	will_return(__wrap__test_malloc, MOCK_ERRNO);
+	/* the cache owns the translated address now */
+	expect_value(rpma_addr_cache_release, ref, MOCK_ADDR_CACHE_REF);
+
+	/* run test */
+	struct rpma_info *info = NULL;
+	int ret = rpma_info_new(MOCK_IP_ADDRESS, MOCK_PORT, RPMA_INFO_ACTIVE, &info);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(info);
+
+	Mock_addr_cache_enabled = false;
+}
+
+/*
+ * new__lifecycle_cache_miss -- the translated address is cached and released via the cache
+ */
+static void
+new__lifecycle_cache_miss(void **unused)
+{
+	/* configure mocks for rpma_info_new() */
+	Mock_addr_cache_enabled = true;
+	struct rdma_addrinfo rai = {0};
+	struct rdma_addrinfo_args args = {MOCK_VALIDATE, &rai};
+	expect_value(rpma_addr_cache_lookup_addrinfo, side, RPMA_INFO_PASSIVE);
+	will_return(rpma_addr_cache_lookup_addrinfo, NULL);
+	will_return(rdma_getaddrinfo, &args);
+	expect_value(rdma_getaddrinfo, hints->ai_flags, RAI_PASSIVE);
+	expect_value(rpma_addr_cache_insert_addrinfo, side, RPMA_INFO_PASSIVE);
+	expect_value(rpma_addr_cache_insert_addrinfo, rai, &rai);
+	will_return(rpma_addr_cache_insert_addrinfo, true);
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test - step 1 */
+	struct rpma_info *info = NULL;
+	int ret = rpma_info_new(MOCK_IP_ADDRESS, MOCK_PORT, RPMA_INFO_PASSIVE, &info);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(info);
+
+	/*
+	 * configure mocks for rpma_info_delete():
+	 * NOTE: rdma_freeaddrinfo() is called by the cache and not by the info.
+	 */
+	expect_value(rpma_addr_cache_release, ref, MOCK_ADDR_CACHE_REF);
+
+	/* run test - step 2 */
+	ret = rpma_info_delete(&info);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(info);
+
+	Mock_addr_cache_enabled = false;
+}
+
+/*
+ * new__lifecycle_cache_hit -- the cached translated address is used
+ * and rdma_getaddrinfo() is not called
+ */
+static void
+new__lifecycle_cache_hit(void **unused)
+{
+	/* configure mocks for rpma_info_new() */
+	Mock_addr_cache_enabled = true;
+	struct rdma_addrinfo rai = {0};
+	expect_value(rpma_addr_cache_lookup_addrinfo, side, RPMA_INFO_ACTIVE);
+	will_return(rpma_addr_cache_lookup_addrinfo, &rai);
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* run test - step 1 */
+	struct rpma_info *info = NULL;
+	int ret = rpma_info_new(MOCK_IP_ADDRESS, MOCK_PORT, RPMA_INFO_ACTIVE, &info);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(info);
+
+	/* configure mocks for rpma_info_delete() */
+	expect_value(rpma_addr_cache_release, ref, MOCK_ADDR_CACHE_REF);
+
+	/* run test - step 2 */
+	ret = rpma_info_delete(&info);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(info);
+
+	Mock_addr_cache_enabled = false;
+}
+
 /*
  * delete__info_ptr_NULL -- NULL info_ptr is not valid
  */
@@ -276,6 +388,7 @@ main(int argc, char *argv[])
 		cmocka_unit_test(new__getaddrinfo_ERRNO_ACTIVE),
 		cmocka_unit_test(new__getaddrinfo_ERRNO_PASSIVE),
 		cmocka_unit_test(new__malloc_ERRNO),
+		cmocka_unit_test(new__malloc_ERRNO_cached),
 
 		/* rpma_info_delete() unit tests */
 		cmocka_unit_test(delete__info_ptr_NULL),
@@ -283,6 +396,8 @@ main(int argc, char *argv[])
 
 		/* rpma_info_new()/_delete() lifecycle */
 		cmocka_unit_test(new__lifecycle),
+		cmocka_unit_test(new__lifecycle_cache_miss),
+		cmocka_unit_test(new__lifecycle_cache_hit),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * latency-common.c -- the latency unit tests common functions
+ */
+
+#include <time.h>
+
+#include "latency-common.h"
+
+uint64_t Mock_time_ns;
+
+/*
+ * ibv_query_qp -- ibv_query_qp() mock
+ */
+int
+ibv_query_qp(struct ibv_qp *qp, struct ibv_qp_attr *attr, int attr_mask,
+		struct ibv_qp_init_attr *init_attr)
+{
+	assert_ptr_equal(qp, MOCK_QP);
+	assert_true(attr_mask & IBV_QP_CAP);
+
+	attr->cap.max_send_wr = MOCK_SQ_SIZE;
+
+	return 0;
+}
+
+/*
+ * __wrap_clock_gettime -- clock_gettime() mock
+ */
+int
+__wrap_clock_gettime(clockid_t clockid, struct timespec *tp)
+{
+	assert_int_equal(clockid, CLOCK_MONOTONIC);
+
+	tp->tv_sec = (time_t)(Mock_time_ns / 1000000000ULL);
+	tp->tv_nsec = (long)(Mock_time_ns % 1000000000ULL);
+
+	return 0;
+}
+
+/*
+ * post_op -- post the operation successfully
+ */
+struct rpma_latency_entry *
+post_op(struct rpma_latency_queue *queue, enum rpma_latency_op op, const void *op_context)
+{
+	struct rpma_latency_entry *entry = rpma_latency_post_begin(queue,
+			RPMA_F_COMPLETION_ALWAYS, op, op_context);
+	assert_non_null(entry);
+	rpma_latency_post_end(entry, MOCK_OK);
+
+	return entry;
+}
+
+/*
+ * measure_op -- post and complete the operation taking the given time
+ */
+void
+measure_op(struct rpma_latency_queue *queue, enum rpma_latency_op op,
+		const void *op_context, uint64_t latency_ns)
+{
+	(void) post_op(queue, op, op_context);
+
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)op_context;
+	wc.status = IBV_WC_SUCCESS;
+	wc.opcode = IBV_WC_RDMA_WRITE;
+
+	Mock_time_ns += latency_ns;
+	rpma_latency_complete(queue, &wc, 1);
+}
+
+/*
+ * setup__latency -- enable measuring the latency and prepare an empty queue
+ */
+int
+setup__latency(void **queue_ptr)
+{
+	static struct rpma_latency_queue queue;
+
+	/* reset all the histograms */
+	struct rpma_latency_stats stats;
+	for (int op = 0; op < RPMA_LATENCY_OP_NUM; op++)
+		assert_int_equal(rpma_latency_get_stats(op, true, &stats), MOCK_OK);
+
+	Mock_time_ns = MOCK_START_NS;
+	rpma_latency_queue_init(&queue, MOCK_QP);
+	assert_int_equal(rpma_latency_enable(), MOCK_OK);
+
+	*queue_ptr = &queue;
+
+	return 0;
+}
+
+/*
+ * teardown__latency -- disable measuring the latency and free the queue
+ */
+int
+teardown__latency(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	assert_int_equal(rpma_latency_disable(), MOCK_OK);
+	rpma_latency_queue_fini(queue);
+
+	return 0;
+}
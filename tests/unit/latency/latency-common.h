@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * latency-common.h -- the latency unit tests common definitions
+ */
+
+#ifndef LATENCY_COMMON_H
+#define LATENCY_COMMON_H
+
+#include "cmocka_headers.h"
+#include "latency.h"
+#include "test-common.h"
+
+#define MOCK_START_NS	1000000000ULL
+#define MOCK_QP		(struct ibv_qp *)0xC0D1
+#define MOCK_SQ_SIZE	100
+
+/* the current time returned by the clock_gettime() mock */
+extern uint64_t Mock_time_ns;
+
+struct rpma_latency_entry *post_op(struct rpma_latency_queue *queue, enum rpma_latency_op op,
+		const void *op_context);
+void measure_op(struct rpma_latency_queue *queue, enum rpma_latency_op op,
+		const void *op_context, uint64_t latency_ns);
+
+int setup__latency(void **queue_ptr);
+int teardown__latency(void **queue_ptr);
+
+#endif /* LATENCY_COMMON_H */
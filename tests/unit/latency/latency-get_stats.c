@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * latency-get_stats.c -- the rpma_latency_get_stats() unit tests
+ *
+ * APIs covered:
+ * - rpma_latency_get_stats()
+ */
+
+#include "latency-common.h"
+
+/*
+ * get_stats__op_invalid -- an invalid operation type is invalid
+ */
+static void
+get_stats__op_invalid(void **unused)
+{
+	/* run test */
+	struct rpma_latency_stats stats;
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_OP_NUM, false, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_stats__stats_NULL -- NULL stats is invalid
+ */
+static void
+get_stats__stats_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_READ, false, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_stats__empty -- all the fields are 0 if nothing has been measured
+ */
+static void
+get_stats__empty(void **queue_ptr)
+{
+	/* run test */
+	struct rpma_latency_stats stats;
+	memset(&stats, 0xff, sizeof(stats));
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_READ, false, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	struct rpma_latency_stats zeroed = {0};
+	assert_memory_equal(&stats, &zeroed, sizeof(stats));
+}
+
+/*
+ * get_stats__exact -- the latencies below 32 ns are exact
+ */
+static void
+get_stats__exact(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	/* 1, 2, ..., 20 ns */
+	for (uint64_t ns = 1; ns <= 20; ns++)
+		measure_op(queue, RPMA_LATENCY_FLUSH, MOCK_OP_CONTEXT, ns);
+
+	/* run test */
+	struct rpma_latency_stats stats;
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_FLUSH, false, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 20);
+	assert_int_equal(stats.min_ns, 1);
+	assert_int_equal(stats.mean_ns, 10);
+	assert_int_equal(stats.p50_ns, 10);
+	assert_int_equal(stats.p99_ns, 20);
+	assert_int_equal(stats.p999_ns, 20);
+	assert_int_equal(stats.max_ns, 20);
+}
+
+/*
+ * get_stats__percentiles -- the percentiles are rounded up to the highest values
+ * of their buckets but not above the maximum
+ */
+static void
+get_stats__percentiles(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	/* 1, 2, ..., 1000 ns */
+	for (uint64_t ns = 1; ns <= 1000; ns++)
+		measure_op(queue, RPMA_LATENCY_READ, MOCK_OP_CONTEXT, ns);
+
+	/* run test */
+	struct rpma_latency_stats stats;
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_READ, false, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 1000);
+	assert_int_equal(stats.min_ns, 1);
+	assert_int_equal(stats.mean_ns, 500);
+	/* 500 falls into [496, 511] */
+	assert_int_equal(stats.p50_ns, 511);
+	/* 990 falls into [960, 991] */
+	assert_int_equal(stats.p99_ns, 991);
+	/* 999 falls into [992, 1023] */
+	assert_int_equal(stats.p999_ns, 1000);
+	assert_int_equal(stats.max_ns, 1000);
+
+	/* the other operation types are not affected */
+	ret = rpma_latency_get_stats(RPMA_LATENCY_WRITE, false, &stats);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 0);
+}
+
+/*
+ * get_stats__huge -- the latency falling into the last bucket
+ */
+static void
+get_stats__huge(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	measure_op(queue, RPMA_LATENCY_SEND, MOCK_OP_CONTEXT, UINT64_MAX - MOCK_START_NS);
+
+	/* run test */
+	struct rpma_latency_stats stats;
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_SEND, false, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 1);
+	assert_int_equal(stats.p50_ns, UINT64_MAX - MOCK_START_NS);
+	assert_int_equal(stats.max_ns, UINT64_MAX - MOCK_START_NS);
+}
+
+/*
+ * get_stats__reset -- the histogram is reset along with taking the snapshot
+ */
+static void
+get_stats__reset(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	measure_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT, 100);
+	measure_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT, 300);
+
+	/* run test */
+	struct rpma_latency_stats stats;
+	int ret = rpma_latency_get_stats(RPMA_LATENCY_WRITE, true, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 2);
+	assert_int_equal(stats.min_ns, 100);
+	assert_int_equal(stats.mean_ns, 200);
+	assert_int_equal(stats.max_ns, 300);
+
+	ret = rpma_latency_get_stats(RPMA_LATENCY_WRITE, false, &stats);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 0);
+	assert_int_equal(stats.min_ns, 0);
+	assert_int_equal(stats.max_ns, 0);
+
+	/* the minimum starts over */
+	measure_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT, 200);
+	ret = rpma_latency_get_stats(RPMA_LATENCY_WRITE, false, &stats);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.count, 1);
+	assert_int_equal(stats.min_ns, 200);
+	assert_int_equal(stats.max_ns, 200);
+}
+
+static const struct CMUnitTest tests_get_stats[] = {
+	/* rpma_latency_get_stats() unit tests */
+	cmocka_unit_test(get_stats__op_invalid),
+	cmocka_unit_test(get_stats__stats_NULL),
+	cmocka_unit_test_setup_teardown(get_stats__empty,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(get_stats__exact,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(get_stats__percentiles,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(get_stats__huge,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(get_stats__reset,
+		setup__latency, teardown__latency),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_get_stats, NULL, NULL);
+}
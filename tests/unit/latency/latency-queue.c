@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * latency-queue.c -- the unit tests of measuring the latency of the operations of a connection
+ *
+ * APIs covered:
+ * - rpma_latency_enable()
+ * - rpma_latency_disable()
+ * - rpma_latency_post_begin()
+ * - rpma_latency_post_end()
+ * - rpma_latency_complete()
+ */
+
+#include "latency-common.h"
+
+#define MOCK_OP_CONTEXT_2	(void *)0xC0C2
+
+/*
+ * get_count -- get the number of the operations of the type measured so far
+ */
+static uint64_t
+get_count(enum rpma_latency_op op)
+{
+	struct rpma_latency_stats stats;
+	assert_int_equal(rpma_latency_get_stats(op, false, &stats), MOCK_OK);
+
+	return stats.count;
+}
+
+/*
+ * post__disabled -- nothing is measured when measuring is disabled
+ */
+static void
+post__disabled(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	assert_int_equal(rpma_latency_disable(), MOCK_OK);
+
+	/* run test */
+	struct rpma_latency_entry *entry = rpma_latency_post_begin(queue,
+			RPMA_F_COMPLETION_ALWAYS, RPMA_LATENCY_READ, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_null(entry);
+}
+
+/*
+ * post__completion_on_error -- the operations without a completion are not measured
+ */
+static void
+post__completion_on_error(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	/* run test */
+	struct rpma_latency_entry *entry = rpma_latency_post_begin(queue,
+			RPMA_F_COMPLETION_ON_ERROR, RPMA_LATENCY_READ, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_null(entry);
+}
+
+/*
+ * post__failed -- an operation failed to be posted is not measured
+ */
+static void
+post__failed(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	/* run test */
+	struct rpma_latency_entry *entry = rpma_latency_post_begin(queue,
+			RPMA_F_COMPLETION_ALWAYS, RPMA_LATENCY_READ, MOCK_OP_CONTEXT);
+	assert_non_null(entry);
+	rpma_latency_post_end(entry, RPMA_E_PROVIDER);
+
+	/* the next operation is measured as usual */
+	measure_op(queue, RPMA_LATENCY_READ, MOCK_OP_CONTEXT, 100);
+
+	/* verify the results */
+	struct rpma_latency_stats stats;
+	assert_int_equal(rpma_latency_get_stats(RPMA_LATENCY_READ, false, &stats), MOCK_OK);
+	assert_int_equal(stats.count, 1);
+	assert_int_equal(stats.max_ns, 100);
+	assert_int_equal(atomic_load(&queue->pending), 0);
+}
+
+/*
+ * post__queue_full -- the operations beyond the depth of the send queue are not measured
+ */
+static void
+post__queue_full(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	for (int i = 0; i < MOCK_SQ_SIZE; i++)
+		(void) post_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT);
+
+	/* run test */
+	struct rpma_latency_entry *entry = rpma_latency_post_begin(queue,
+			RPMA_F_COMPLETION_ALWAYS, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_null(entry);
+	assert_int_equal(queue->capacity, MOCK_SQ_SIZE);
+	assert_int_equal(atomic_load(&queue->pending), MOCK_SQ_SIZE);
+}
+
+/*
+ * complete__skipped -- the receive completions and the completions of the operations
+ * not measured are skipped
+ */
+static void
+complete__skipped(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	(void) post_op(queue, RPMA_LATENCY_SEND, MOCK_OP_CONTEXT);
+
+	struct ibv_wc wc[3] = {{0}};
+	/* a receive completion */
+	wc[0].wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	wc[0].status = IBV_WC_SUCCESS;
+	wc[0].opcode = IBV_WC_RECV;
+	/* an operation posted before measuring has been enabled */
+	wc[1].wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT_2;
+	wc[1].status = IBV_WC_SUCCESS;
+	wc[1].opcode = IBV_WC_SEND;
+	/* the measured operation */
+	wc[2].wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	wc[2].status = IBV_WC_SUCCESS;
+	wc[2].opcode = IBV_WC_SEND;
+
+	/* run test */
+	Mock_time_ns += 500;
+	rpma_latency_complete(queue, wc, 3);
+
+	/* verify the results */
+	struct rpma_latency_stats stats;
+	assert_int_equal(rpma_latency_get_stats(RPMA_LATENCY_SEND, false, &stats), MOCK_OK);
+	assert_int_equal(stats.count, 1);
+	assert_int_equal(stats.max_ns, 500);
+	assert_int_equal(atomic_load(&queue->pending), 0);
+}
+
+/*
+ * complete__out_of_order -- the operations whose entries have been reserved in a different
+ * order than they have been posted in are matched by their op_contexts
+ */
+static void
+complete__out_of_order(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	(void) post_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT);
+	Mock_time_ns += 10;
+	(void) post_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT_2);
+
+	struct ibv_wc wc = {0};
+	wc.status = IBV_WC_SUCCESS;
+	wc.opcode = IBV_WC_RDMA_WRITE;
+
+	/* run test */
+	Mock_time_ns += 5;
+	wc.wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT_2;
+	rpma_latency_complete(queue, &wc, 1);
+	Mock_time_ns += 5;
+	wc.wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	rpma_latency_complete(queue, &wc, 1);
+
+	/* verify the results */
+	struct rpma_latency_stats stats;
+	assert_int_equal(rpma_latency_get_stats(RPMA_LATENCY_WRITE, false, &stats), MOCK_OK);
+	assert_int_equal(stats.count, 2);
+	assert_int_equal(stats.min_ns, 5);
+	assert_int_equal(stats.max_ns, 20);
+	assert_int_equal(atomic_load(&queue->pending), 0);
+}
+
+/*
+ * complete__error -- an error completion stops measuring on the connection
+ * until measuring is enabled again
+ */
+static void
+complete__error(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+
+	(void) post_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT);
+
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	wc.status = IBV_WC_WR_FLUSH_ERR;
+
+	/* run test */
+	rpma_latency_complete(queue, &wc, 1);
+
+	/* verify the results */
+	assert_int_equal(get_count(RPMA_LATENCY_WRITE), 0);
+	assert_int_equal(atomic_load(&queue->pending), 0);
+	assert_null(rpma_latency_post_begin(queue, RPMA_F_COMPLETION_ALWAYS,
+			RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT));
+
+	/* enabling measuring again resumes it */
+	assert_int_equal(rpma_latency_enable(), MOCK_OK);
+	measure_op(queue, RPMA_LATENCY_WRITE, MOCK_OP_CONTEXT, 100);
+	assert_int_equal(get_count(RPMA_LATENCY_WRITE), 1);
+}
+
+/*
+ * complete__in_order -- many outstanding operations wrapping around the queue
+ * are matched with their completions in the order of posting
+ */
+static void
+complete__in_order(void **queue_ptr)
+{
+	struct rpma_latency_queue *queue = *queue_ptr;
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	wc.status = IBV_WC_SUCCESS;
+	wc.opcode = IBV_WC_RDMA_READ;
+
+	/* post 50 operations 1 ns apart and complete 40 of them */
+	for (int i = 0; i < 50; i++) {
+		(void) post_op(queue, RPMA_LATENCY_READ, MOCK_OP_CONTEXT);
+		Mock_time_ns++;
+	}
+	for (int i = 0; i < 40; i++)
+		rpma_latency_complete(queue, &wc, 1);
+
+	/* post 60 operations more (70 outstanding) */
+	for (int i = 0; i < 60; i++) {
+		(void) post_op(queue, RPMA_LATENCY_READ, MOCK_OP_CONTEXT);
+		Mock_time_ns++;
+	}
+	assert_int_equal(atomic_load(&queue->pending), 70);
+
+	/* run test */
+	for (int i = 0; i < 70; i++)
+		rpma_latency_complete(queue, &wc, 1);
+
+	/* verify the results */
+	struct rpma_latency_stats stats;
+	assert_int_equal(rpma_latency_get_stats(RPMA_LATENCY_READ, false, &stats), MOCK_OK);
+	assert_int_equal(stats.count, 110);
+	/* the last one posted has completed right after posting */
+	assert_int_equal(stats.min_ns, 1);
+	/* the 41st one has waited for the next 60 posts */
+	assert_int_equal(stats.max_ns, 70);
+	assert_int_equal(atomic_load(&queue->pending), 0);
+}
+
+static const struct CMUnitTest tests_queue[] = {
+	cmocka_unit_test_setup_teardown(post__disabled,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(post__completion_on_error,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(post__failed,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(post__queue_full,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(complete__skipped,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(complete__out_of_order,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(complete__error,
+		setup__latency, teardown__latency),
+	cmocka_unit_test_setup_teardown(complete__in_order,
+		setup__latency, teardown__latency),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_queue, NULL, NULL);
+}
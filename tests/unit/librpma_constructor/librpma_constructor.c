@@ -26,6 +26,12 @@ init__success(void **unused)
 static void
 fini__success(void **unused)
 {
+	expect_function_call(rpma_conn_table_fini);
+	expect_function_call(rpma_addr_cache_fini);
+	expect_function_call(rpma_trace_fini);
+	expect_function_call(rpma_hook_fini);
+	expect_function_call(rpma_log_async_fini);
+	expect_function_call(rpma_log_binary_fini);
 	expect_function_call(rpma_log_fini);
 	librpma_fini();
 }
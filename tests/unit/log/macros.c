@@ -13,6 +13,10 @@
 #define MOCK_OUTPUT	1024
 #define MOCK_FILE_NAME	__FILE__
 
+/* the messages below RPMA_LOG_LEVEL_MIN are compiled out */
+#define MOCK_IS_LOGGED(level, primary) \
+	((level) <= (primary) && (level) <= RPMA_LOG_LEVEL_MIN)
+
 /*
  * mock_log_function -- custom log function
  */
@@ -80,22 +84,22 @@ log__all(void **level_ptr)
 					RPMA_LOG_THRESHOLD_AUX, secondary))
 			;
 
-		if (RPMA_LOG_LEVEL_NOTICE <= primary) {
+		if (MOCK_IS_LOGGED(RPMA_LOG_LEVEL_NOTICE, primary)) {
 			MOCK_CONFIGURE_LOG_FUNC(RPMA_LOG_LEVEL_NOTICE);
 		}
 		RPMA_LOG_NOTICE("%s", MOCK_MESSAGE);
 
-		if (RPMA_LOG_LEVEL_WARNING <= primary) {
+		if (MOCK_IS_LOGGED(RPMA_LOG_LEVEL_WARNING, primary)) {
 			MOCK_CONFIGURE_LOG_FUNC(RPMA_LOG_LEVEL_WARNING);
 		}
 		RPMA_LOG_WARNING("%s", MOCK_MESSAGE);
 
-		if (RPMA_LOG_LEVEL_ERROR <= primary) {
+		if (MOCK_IS_LOGGED(RPMA_LOG_LEVEL_ERROR, primary)) {
 			MOCK_CONFIGURE_LOG_FUNC(RPMA_LOG_LEVEL_ERROR);
 		}
 		RPMA_LOG_ERROR("%s", MOCK_MESSAGE);
 
-		if (RPMA_LOG_LEVEL_FATAL <= primary) {
+		if (MOCK_IS_LOGGED(RPMA_LOG_LEVEL_FATAL, primary)) {
 			MOCK_CONFIGURE_LOG_FUNC(RPMA_LOG_LEVEL_FATAL);
 		}
 		RPMA_LOG_FATAL("%s", MOCK_MESSAGE);
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ratelimit.c -- RPMA_LOG_*_RATELIMITED macros unit tests
+ */
+
+#include <time.h>
+
+#include "cmocka_headers.h"
+#include "log_internal.h"
+#include "log_default.h"
+
+#define MOCK_MESSAGE	"Message"
+#define MOCK_OUTPUT	1024
+
+/* the current time returned by clock_gettime() */
+static uint64_t Mock_time_ns = RPMA_LOG_RATELIMIT_INTERVAL_NS;
+
+/*
+ * __wrap_clock_gettime -- clock_gettime() mock
+ */
+int
+__wrap_clock_gettime(clockid_t clockid, struct timespec *tp)
+{
+	assert_int_equal(clockid, CLOCK_MONOTONIC);
+
+	tp->tv_sec = (time_t)(Mock_time_ns / 1000000000ULL);
+	tp->tv_nsec = (long)(Mock_time_ns % 1000000000ULL);
+
+	return 0;
+}
+
+/*
+ * mock_log_function -- custom log function
+ */
+void
+mock_log_function(enum rpma_log_level level, const char *file_name,
+		const int line_no, const char *function_name,
+		const char *message_format, ...)
+{
+	static char output[MOCK_OUTPUT];
+
+	check_expected(level);
+
+	va_list ap;
+	va_start(ap, message_format);
+	assert_true(vsnprintf(output, MOCK_OUTPUT, message_format, ap) > 0);
+	va_end(ap);
+
+	check_expected_ptr(output);
+}
+
+/*
+ * expect_output -- expect the message to be logged
+ */
+static void
+expect_output(enum rpma_log_level level, const char *output)
+{
+	expect_value(mock_log_function, level, level);
+	expect_string(mock_log_function, output, output);
+}
+
+/*
+ * log_error -- log MOCK_MESSAGE from the same call site
+ */
+static void
+log_error(void)
+{
+	RPMA_LOG_ERROR_RATELIMITED("%s", MOCK_MESSAGE);
+}
+
+/*
+ * ratelimit__burst -- only the burst of messages is logged at once and the number
+ * of the suppressed ones is reported along with the next message let through
+ */
+static void
+ratelimit__burst(void **unused)
+{
+	/* configure mocks */
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST; i++)
+		expect_output(RPMA_LOG_LEVEL_ERROR, MOCK_MESSAGE "\n");
+
+	/* run test */
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST + 3; i++)
+		log_error();
+
+	/* configure mocks */
+	expect_output(RPMA_LOG_LEVEL_ERROR, "suppressed 3 message(s)\n");
+	expect_output(RPMA_LOG_LEVEL_ERROR, MOCK_MESSAGE "\n");
+
+	/* run test */
+	Mock_time_ns += RPMA_LOG_RATELIMIT_INTERVAL_NS;
+	log_error();
+	log_error();
+
+	/* configure mocks */
+	expect_output(RPMA_LOG_LEVEL_ERROR, "suppressed 1 message(s)\n");
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST; i++)
+		expect_output(RPMA_LOG_LEVEL_ERROR, MOCK_MESSAGE "\n");
+
+	/* run test - the bucket is full again */
+	Mock_time_ns += RPMA_LOG_RATELIMIT_BURST * RPMA_LOG_RATELIMIT_INTERVAL_NS;
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST; i++)
+		log_error();
+}
+
+/*
+ * ratelimit__call_sites -- every call site has its own bucket
+ */
+static void
+ratelimit__call_sites(void **unused)
+{
+	/* configure mocks */
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST; i++)
+		expect_output(RPMA_LOG_LEVEL_WARNING, MOCK_MESSAGE "\n");
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST; i++)
+		expect_output(RPMA_LOG_LEVEL_ERROR, "ibv_post_send failed: Invalid argument\n");
+
+	/* run test */
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST + 1; i++)
+		RPMA_LOG_WARNING_RATELIMITED("%s", MOCK_MESSAGE);
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST + 1; i++)
+		RPMA_LOG_ERROR_WITH_ERRNO_RATELIMITED(EINVAL, "ibv_post_send");
+}
+
+/*
+ * ratelimit__below_threshold -- the messages below the threshold do not take tokens
+ */
+static void
+ratelimit__below_threshold(void **unused)
+{
+	/* run test */
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST + 1; i++)
+		RPMA_LOG_RATELIMITED(RPMA_LOG_LEVEL_DEBUG, "%s\n", MOCK_MESSAGE);
+
+	/* configure mocks */
+	while (RPMA_E_AGAIN == rpma_log_set_threshold(RPMA_LOG_THRESHOLD,
+			RPMA_LOG_LEVEL_DEBUG))
+		;
+	for (int i = 0; i < RPMA_LOG_RATELIMIT_BURST; i++)
+		expect_output(RPMA_LOG_LEVEL_DEBUG, MOCK_MESSAGE "\n");
+
+	/* run test */
+	for (int i = 0; i < 2 * RPMA_LOG_RATELIMIT_BURST; i++)
+		RPMA_LOG_RATELIMITED(RPMA_LOG_LEVEL_DEBUG, "%s\n", MOCK_MESSAGE);
+
+	while (RPMA_E_AGAIN == rpma_log_set_threshold(RPMA_LOG_THRESHOLD,
+			RPMA_LOG_LEVEL_WARNING))
+		;
+}
+
+int
+main(int argc, char *argv[])
+{
+	/* set a custom logging function */
+	while (RPMA_E_AGAIN == rpma_log_set_function(mock_log_function))
+		;
+	while (RPMA_E_AGAIN == rpma_log_set_threshold(RPMA_LOG_THRESHOLD,
+			RPMA_LOG_LEVEL_WARNING))
+		;
+
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(ratelimit__burst),
+		cmocka_unit_test(ratelimit__call_sites),
+		cmocka_unit_test(ratelimit__below_threshold),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_async-common.c -- the asynchronous logging backend unit tests common functions
+ */
+
+#include <pthread.h>
+
+#include "log_async-common.h"
+
+/*
+ * __wrap_pthread_create -- pthread_create() mock (no thread is started so the records are
+ * written out only by rpma_log_async_stop())
+ */
+int
+__wrap_pthread_create(pthread_t *thread, const pthread_attr_t *attr,
+		void *(*start_routine)(void *), void *arg)
+{
+	assert_non_null(thread);
+	assert_non_null(start_routine);
+
+	return mock_type(int);
+}
+
+/*
+ * __wrap_pthread_join -- pthread_join() mock
+ */
+int
+__wrap_pthread_join(pthread_t thread, void **retval)
+{
+	return 0;
+}
+
+/*
+ * setup__log_async_start -- start the backend
+ */
+int
+setup__log_async_start(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap_pthread_create, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_log_async_start(MOCK_RING_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(Rpma_log_function, rpma_log_async_function);
+
+	return 0;
+}
+
+/*
+ * teardown__log_async_stop -- stop the backend
+ */
+int
+teardown__log_async_stop(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_async_stop();
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(Rpma_log_function, rpma_log_default_function);
+
+	return 0;
+}
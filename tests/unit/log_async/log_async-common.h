@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_async-common.h -- the asynchronous logging backend unit tests common definitions
+ */
+
+#ifndef LOG_ASYNC_COMMON_H
+#define LOG_ASYNC_COMMON_H
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "log_async.h"
+#include "log_internal.h"
+#include "test-common.h"
+
+/*
+ * The ring size used by all the tests. The ring of the test thread is created by the first
+ * rpma_log_async_start() and it is reused by the following ones.
+ */
+#define MOCK_RING_SIZE		2
+
+#define MOCK_FILE_NAME		"foo_bar.c"
+#define MOCK_LINE_NUMBER	199
+#define MOCK_FUNCTION_NAME	"foo_bar()"
+
+int setup__log_async_start(void **unused);
+int teardown__log_async_stop(void **unused);
+
+#endif /* LOG_ASYNC_COMMON_H */
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_async-function.c -- the rpma_log_async_function() unit tests
+ *
+ * API covered:
+ * - rpma_log_async_function()
+ */
+
+#include "log_async-common.h"
+
+/*
+ * expect_write -- expect the message to be written out
+ */
+static void
+expect_write(enum rpma_log_level level, const char *message)
+{
+	expect_value(rpma_log_default_write, level, level);
+	expect_string(rpma_log_default_write, message, message);
+}
+
+/*
+ * function__disabled -- RPMA_LOG_DISABLED messages are ignored
+ */
+static void
+function__disabled(void **unused)
+{
+	/* run test */
+	rpma_log_async_function(RPMA_LOG_DISABLED, MOCK_FILE_NAME, MOCK_LINE_NUMBER,
+			MOCK_FUNCTION_NAME, "disabled\n");
+
+	/* the message is not written out by the teardown */
+}
+
+/*
+ * function__not_started -- the message is written out right away if the backend is stopped
+ */
+static void
+function__not_started(void **unused)
+{
+	/* configure mocks */
+	expect_write(RPMA_LOG_LEVEL_ERROR, "error 1\n");
+
+	/* run test */
+	rpma_log_async_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, MOCK_LINE_NUMBER,
+			MOCK_FUNCTION_NAME, "error %d\n", 1);
+}
+
+/*
+ * function__queued -- the messages are written out in order by the background thread and
+ * not by the logging one
+ */
+static void
+function__queued(void **unused)
+{
+	/* run test */
+	rpma_log_async_function(RPMA_LOG_LEVEL_WARNING, MOCK_FILE_NAME, MOCK_LINE_NUMBER,
+			MOCK_FUNCTION_NAME, "warning %s\n", "first");
+	rpma_log_async_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, MOCK_LINE_NUMBER,
+			MOCK_FUNCTION_NAME, "error %s\n", "second");
+
+	/* configure mocks */
+	expect_write(RPMA_LOG_LEVEL_WARNING, "warning first\n");
+	expect_write(RPMA_LOG_LEVEL_ERROR, "error second\n");
+
+	/* the messages are written out by the teardown */
+}
+
+/*
+ * function__args_copied -- the string arguments are copied, so the buffers they point to can be
+ * reused right after the call
+ */
+static void
+function__args_copied(void **unused)
+{
+	char buf[] = "first";
+
+	/* run test */
+	rpma_log_async_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, MOCK_LINE_NUMBER,
+			MOCK_FUNCTION_NAME, "error %s %d %p\n", buf, -1, (void *)0x10);
+	memset(buf, 'x', sizeof(buf) - 1);
+
+	/* configure mocks */
+	expect_write(RPMA_LOG_LEVEL_ERROR, "error first -1 0x10\n");
+
+	/* the message is written out by the teardown */
+}
+
+/*
+ * function__dropped -- the messages not fitting into the ring are dropped and counted
+ */
+static void
+function__dropped(void **unused)
+{
+	uint64_t dropped_before = 0;
+	int ret = rpma_log_async_get_dropped(&dropped_before);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* run test */
+	for (int i = 0; i < MOCK_RING_SIZE + 2; i++)
+		rpma_log_async_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, MOCK_LINE_NUMBER,
+				MOCK_FUNCTION_NAME, "error %d\n", i);
+
+	/* verify the results */
+	uint64_t dropped = 0;
+	ret = rpma_log_async_get_dropped(&dropped);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(dropped - dropped_before, 2);
+
+	/* configure mocks */
+	expect_write(RPMA_LOG_LEVEL_ERROR, "error 0\n");
+	expect_write(RPMA_LOG_LEVEL_ERROR, "error 1\n");
+	expect_write(RPMA_LOG_LEVEL_WARNING, "2 log message(s) dropped, the ring was full\n");
+
+	/* the messages and the summary are written out by the teardown */
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_log_async_function() unit tests */
+		cmocka_unit_test_setup_teardown(function__disabled,
+			setup__log_async_start, teardown__log_async_stop),
+		cmocka_unit_test(function__not_started),
+		cmocka_unit_test_setup_teardown(function__queued,
+			setup__log_async_start, teardown__log_async_stop),
+		cmocka_unit_test_setup_teardown(function__args_copied,
+			setup__log_async_start, teardown__log_async_stop),
+		cmocka_unit_test_setup_teardown(function__dropped,
+			setup__log_async_start, teardown__log_async_stop),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_async-start_stop.c -- the rpma_log_async_start/_stop/_get_dropped() unit tests
+ *
+ * APIs covered:
+ * - rpma_log_async_start()
+ * - rpma_log_async_stop()
+ * - rpma_log_async_get_dropped()
+ * - rpma_log_async_fini()
+ */
+
+#include "log_async-common.h"
+
+/*
+ * user_function -- a user-defined logging function
+ */
+static void
+user_function(enum rpma_log_level level, const char *file_name, const int line_no,
+	const char *function_name, const char *message_format, ...)
+{
+}
+
+/*
+ * start__invalid_ring_size -- the ring size is out of range
+ */
+static void
+start__invalid_ring_size(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_async_start(0);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_log_async_start((1 << 20) + 1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * start__pthread_create_ERRNO -- pthread_create() fails
+ */
+static void
+start__pthread_create_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap_pthread_create, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_log_async_start(MOCK_RING_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_UNKNOWN);
+	assert_int_not_equal(Rpma_log_function, rpma_log_async_function);
+	ret = rpma_log_async_stop();
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * start__already_started -- the backend cannot be started twice
+ */
+static void
+start__already_started(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_async_start(MOCK_RING_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * stop__not_started -- the backend is not started
+ */
+static void
+stop__not_started(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_async_stop();
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * start_stop__success -- the logging function is switched to the backend and back
+ */
+static void
+start_stop__success(void **unused)
+{
+	/*
+	 * The thing is done by setup__log_async_start()
+	 * and teardown__log_async_stop().
+	 */
+}
+
+/*
+ * stop__user_function -- the user-defined logging function set in the meantime is kept
+ */
+static void
+stop__user_function(void **unused)
+{
+	setup__log_async_start(NULL);
+
+	/* run test */
+	int ret = rpma_log_set_function(user_function);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_log_async_stop();
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(Rpma_log_function, user_function);
+}
+
+/*
+ * get_dropped__invalid -- NULL dropped is invalid
+ */
+static void
+get_dropped__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_async_get_dropped(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * fini__success -- rpma_log_async_fini() stops the backend
+ */
+static void
+fini__success(void **unused)
+{
+	setup__log_async_start(NULL);
+
+	/* run test */
+	rpma_log_async_fini();
+
+	/* verify the results */
+	assert_ptr_equal(Rpma_log_function, rpma_log_default_function);
+	int ret = rpma_log_async_stop();
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_log_async_start() unit tests */
+		cmocka_unit_test(start__invalid_ring_size),
+		cmocka_unit_test(start__pthread_create_ERRNO),
+		cmocka_unit_test_setup_teardown(start__already_started,
+			setup__log_async_start, teardown__log_async_stop),
+
+		/* rpma_log_async_stop() unit tests */
+		cmocka_unit_test(stop__not_started),
+		cmocka_unit_test_setup_teardown(start_stop__success,
+			setup__log_async_start, teardown__log_async_stop),
+		cmocka_unit_test(stop__user_function),
+
+		/* rpma_log_async_get_dropped() unit tests */
+		cmocka_unit_test(get_dropped__invalid),
+
+		/* rpma_log_async_fini() unit tests */
+		cmocka_unit_test(fini__success),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_binary-format.c -- the binary log records encoding/decoding unit tests
+ *
+ * APIs covered:
+ * - rpma_log_binary_encode()
+ * - rpma_log_binary_decode()
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cmocka_headers.h"
+#include "log_binary_format.h"
+
+#define MOCK_OUTPUT	1024
+
+/*
+ * encode -- encode the arguments of the format into the record
+ */
+static void
+encode(struct rpma_log_binary_record *rec, const char *format, ...)
+{
+	va_list ap;
+	va_start(ap, format);
+	rpma_log_binary_encode(rec, format, ap);
+	va_end(ap);
+}
+
+/*
+ * decode -- decode the record and compare it with the expected message
+ */
+static void
+decode(const struct rpma_log_binary_record *rec, const char *format, const char *expected)
+{
+	char output[MOCK_OUTPUT];
+	size_t len = rpma_log_binary_decode(rec, format, output, sizeof(output));
+
+	assert_string_equal(output, expected);
+	assert_int_equal(len, strlen(expected));
+}
+
+/*
+ * format__integers -- all the integer conversions
+ */
+static void
+format__integers(void **unused)
+{
+	struct rpma_log_binary_record rec = {0};
+	const char *format = "%d %u %x %hhd %ld %lld %" PRIu64 " %zu %jd %td %c\n";
+
+	/* run test */
+	encode(&rec, format, -1, 2U, 0xabU, 4, -5L, 6LL, UINT64_MAX, (size_t)7, (intmax_t)8,
+			(ptrdiff_t)-9, 'z');
+
+	/* verify the results */
+	assert_int_equal(rec.args_num, RPMA_LOG_BINARY_ARGS_MAX);
+	decode(&rec, format, "-1 2 ab 4 -5 6 18446744073709551615 7 %jd %td %c\n");
+}
+
+/*
+ * format__other -- the strings, pointers, doubles, '*' and "%%"
+ */
+static void
+format__other(void **unused)
+{
+	struct rpma_log_binary_record rec = {0};
+	const char *format = "%s: %p %5.2f%% [%*d] [%.*s] %s\n";
+
+	/* run test */
+	encode(&rec, format, "ibv_post_send", (void *)0x1234, 3.14159, 4, 7, 3, "abcdef", NULL);
+
+	/* verify the results */
+	assert_int_equal(rec.args_num, 8);
+	decode(&rec, format, "ibv_post_send: 0x1234  3.14% [   7] [abc] (null)\n");
+}
+
+/*
+ * format__unsupported -- the conversions following an unsupported one are not recorded
+ */
+static void
+format__unsupported(void **unused)
+{
+	struct rpma_log_binary_record rec = {0};
+	const char *format = "%d %Lf %d\n";
+
+	/* run test */
+	encode(&rec, format, 1, (long double)2.0, 3);
+
+	/* verify the results */
+	assert_int_equal(rec.args_num, 1);
+	decode(&rec, format, "1 %Lf %d\n");
+}
+
+/*
+ * format__long_strings -- the strings are truncated to fit the record
+ */
+static void
+format__long_strings(void **unused)
+{
+	struct rpma_log_binary_record rec = {0};
+	char str[2 * RPMA_LOG_BINARY_STRINGS_SIZE];
+	memset(str, 'a', sizeof(str) - 1);
+	str[sizeof(str) - 1] = '\0';
+
+	/* run test */
+	encode(&rec, "%s|%s|%s", str, str, "b");
+
+	/* verify the results */
+	assert_int_equal(rec.args_num, 3);
+	char output[MOCK_OUTPUT];
+	(void) rpma_log_binary_decode(&rec, "%s|%s|%s", output, sizeof(output));
+	char expected[MOCK_OUTPUT];
+	(void) snprintf(expected, sizeof(expected), "%.*s||",
+			RPMA_LOG_BINARY_STRINGS_SIZE - 2, str);
+	assert_string_equal(output, expected);
+}
+
+/*
+ * format__corrupted -- the corrupted records are decoded safely
+ */
+static void
+format__corrupted(void **unused)
+{
+	struct rpma_log_binary_record rec = {0};
+	encode(&rec, "%s %d", "abc", 1);
+
+	/* run test */
+	rec.args[0] = UINT64_MAX;
+	rec.args_num = UINT8_MAX;
+
+	/* verify the results */
+	decode(&rec, "%s %d", " 1");
+}
+
+/*
+ * format__truncated -- the message is truncated to fit the buffer
+ */
+static void
+format__truncated(void **unused)
+{
+	struct rpma_log_binary_record rec = {0};
+	encode(&rec, "%s %d\n", "abcdef", 12345);
+
+	/* run test */
+	char output[8];
+	size_t len = rpma_log_binary_decode(&rec, "%s %d\n", output, sizeof(output));
+
+	/* verify the results */
+	assert_int_equal(len, sizeof(output) - 1);
+	assert_string_equal(output, "abcdef ");
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(format__integers),
+		cmocka_unit_test(format__other),
+		cmocka_unit_test(format__unsupported),
+		cmocka_unit_test(format__long_strings),
+		cmocka_unit_test(format__corrupted),
+		cmocka_unit_test(format__truncated),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * log_binary-start_stop.c -- the rpma_log_binary_start/_stop() unit tests
+ *
+ * APIs covered:
+ * - rpma_log_binary_start()
+ * - rpma_log_binary_stop()
+ * - rpma_log_binary_function()
+ * - rpma_log_binary_fini()
+ */
+
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "log_binary.h"
+#include "log_binary_format.h"
+#include "log_internal.h"
+#include "test-common.h"
+
+#define MOCK_SIZE_MIN	(RPMA_LOG_BINARY_HEADER_SIZE + \
+	RPMA_LOG_BINARY_SITES_MAX * sizeof(struct rpma_log_binary_site) + \
+	sizeof(struct rpma_log_binary_record))
+#define MOCK_RECORDS	4
+#define MOCK_FILE_SIZE	(MOCK_SIZE_MIN + \
+	(MOCK_RECORDS - 1) * sizeof(struct rpma_log_binary_record))
+#define MOCK_FILE_NAME	"foo_bar.c"
+#define MOCK_FUNCTION_NAME	"foo_bar()"
+#define MOCK_OUTPUT	1024
+
+static char Path[] = "/tmp/rpma_log_binary-XXXXXX";
+
+/*
+ * user_function -- a user-defined logging function
+ */
+static void
+user_function(enum rpma_log_level level, const char *file_name, const int line_no,
+	const char *function_name, const char *message_format, ...)
+{
+}
+
+/*
+ * setup__start -- start storing the messages in the file
+ */
+static int
+setup__start(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_binary_start(Path, MOCK_FILE_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Rpma_log_function, (uintptr_t)rpma_log_binary_function);
+
+	return 0;
+}
+
+/*
+ * teardown__stop -- stop storing the messages in the file
+ */
+static int
+teardown__stop(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_binary_stop();
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Rpma_log_function, (uintptr_t)rpma_log_default_function);
+
+	return 0;
+}
+
+/*
+ * start__invalid -- NULL path or too small size
+ */
+static void
+start__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_binary_start(NULL, MOCK_FILE_SIZE);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_log_binary_start(Path, MOCK_SIZE_MIN - 1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * start__open_ERRNO -- the file cannot be created
+ */
+static void
+start__open_ERRNO(void **unused)
+{
+	/* turn off logging of the error */
+	Rpma_log_function = 0;
+
+	/* run test */
+	int ret = rpma_log_binary_start("/nonexistent-rpma-dir/log", MOCK_FILE_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_UNKNOWN);
+	assert_int_equal(Rpma_log_function, 0);
+}
+
+/*
+ * start__already_started -- the sink cannot be started twice
+ */
+static void
+start__already_started(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_binary_start(Path, MOCK_FILE_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * stop__not_started -- the sink is not started
+ */
+static void
+stop__not_started(void **unused)
+{
+	/* run test */
+	int ret = rpma_log_binary_stop();
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * stop__user_function -- the user-defined logging function set in the meantime is kept
+ */
+static void
+stop__user_function(void **unused)
+{
+	setup__start(NULL);
+
+	/* run test */
+	int ret = rpma_log_set_function(user_function);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_log_binary_stop();
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(Rpma_log_function, (uintptr_t)user_function);
+}
+
+/*
+ * function__not_started -- the message is written out right away if the sink is stopped
+ */
+static void
+function__not_started(void **unused)
+{
+	/* configure mocks */
+	expect_value(rpma_log_default_write, level, RPMA_LOG_LEVEL_ERROR);
+	expect_string(rpma_log_default_write, message, "error 1\n");
+
+	/* run test */
+	rpma_log_binary_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, __LINE__,
+			MOCK_FUNCTION_NAME, "error %d\n", 1);
+}
+
+/*
+ * log_message -- log the message from the same call site
+ */
+static void
+log_message(int i)
+{
+	rpma_log_binary_function(RPMA_LOG_LEVEL_DEBUG, MOCK_FILE_NAME, 1,
+			MOCK_FUNCTION_NAME, "message %d of %s\n", i, "test");
+}
+
+/*
+ * function__records -- the records are stored in the file; the oldest ones are overwritten
+ */
+static void
+function__records(void **unused)
+{
+	setup__start(NULL);
+
+	/* run test */
+	rpma_log_binary_function(RPMA_LOG_DISABLED, MOCK_FILE_NAME, 1,
+			MOCK_FUNCTION_NAME, "disabled\n");
+	for (int i = 0; i < MOCK_RECORDS + 1; i++)
+		log_message(i);
+	teardown__stop(NULL);
+
+	/* verify the results */
+	int fd = open(Path, O_RDONLY);
+	assert_true(fd >= 0);
+	char *addr = mmap(NULL, MOCK_FILE_SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+	(void) close(fd);
+	assert_ptr_not_equal(addr, MAP_FAILED);
+
+	const struct rpma_log_binary_header *header = (void *)addr;
+	assert_memory_equal(header->magic, RPMA_LOG_BINARY_MAGIC, sizeof(RPMA_LOG_BINARY_MAGIC));
+	assert_int_equal(header->version, RPMA_LOG_BINARY_VERSION);
+	assert_int_equal(header->records_num, MOCK_RECORDS);
+	assert_int_equal(header->next_seq, MOCK_RECORDS + 1);
+	assert_int_equal(header->dropped, 0);
+
+	const struct rpma_log_binary_record *records =
+			(void *)(addr + header->records_offset);
+	const struct rpma_log_binary_site *sites = (void *)(addr + RPMA_LOG_BINARY_HEADER_SIZE);
+
+	/* the first record has been overwritten by the last one */
+	for (int i = 0; i < MOCK_RECORDS; i++) {
+		const struct rpma_log_binary_record *rec = &records[i];
+		int seq = (i == 0) ? MOCK_RECORDS : i;
+		assert_int_equal(rec->seq, seq + 1);
+		assert_int_equal(rec->level, RPMA_LOG_LEVEL_DEBUG);
+		assert_int_equal(rec->tid, (int32_t)syscall(SYS_gettid));
+		assert_int_not_equal(rec->ts_ns, 0);
+
+		const struct rpma_log_binary_site *site = &sites[rec->site];
+		assert_int_equal(site->state, RPMA_LOG_BINARY_SITE_READY);
+		assert_int_equal(site->line_no, 1);
+		assert_string_equal(site->file_name, MOCK_FILE_NAME);
+		assert_string_equal(site->function_name, MOCK_FUNCTION_NAME);
+
+		char output[MOCK_OUTPUT];
+		char expected[MOCK_OUTPUT];
+		(void) rpma_log_binary_decode(rec, site->format, output, sizeof(output));
+		(void) snprintf(expected, sizeof(expected), "message %d of test\n", seq);
+		assert_string_equal(output, expected);
+	}
+
+	(void) munmap(addr, MOCK_FILE_SIZE);
+}
+
+/*
+ * function__call_sites -- every call site gets its own ID
+ */
+static void
+function__call_sites(void **unused)
+{
+	setup__start(NULL);
+
+	/* run test */
+	rpma_log_binary_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, 1,
+			MOCK_FUNCTION_NAME, "%s\n", "a");
+	rpma_log_binary_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, 2,
+			MOCK_FUNCTION_NAME, "%s\n", "b");
+	rpma_log_binary_function(RPMA_LOG_LEVEL_ERROR, MOCK_FILE_NAME, 1,
+			MOCK_FUNCTION_NAME, "%s\n", "c");
+	teardown__stop(NULL);
+
+	/* verify the results */
+	int fd = open(Path, O_RDONLY);
+	assert_true(fd >= 0);
+	char *addr = mmap(NULL, MOCK_FILE_SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+	(void) close(fd);
+	assert_ptr_not_equal(addr, MAP_FAILED);
+
+	const struct rpma_log_binary_header *header = (void *)addr;
+	const struct rpma_log_binary_record *records =
+			(void *)(addr + header->records_offset);
+	assert_int_equal(header->next_seq, 3);
+	assert_int_not_equal(records[0].site, records[1].site);
+	assert_int_equal(records[0].site, records[2].site);
+
+	(void) munmap(addr, MOCK_FILE_SIZE);
+}
+
+/*
+ * fini__success -- rpma_log_binary_fini() stops the sink
+ */
+static void
+fini__success(void **unused)
+{
+	setup__start(NULL);
+
+	/* run test */
+	rpma_log_binary_fini();
+
+	/* verify the results */
+	assert_int_equal(Rpma_log_function, (uintptr_t)rpma_log_default_function);
+	int ret = rpma_log_binary_stop();
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int fd = mkstemp(Path);
+	if (fd < 0)
+		return -1;
+	(void) close(fd);
+
+	const struct CMUnitTest tests[] = {
+		/* rpma_log_binary_start() unit tests */
+		cmocka_unit_test(start__invalid),
+		cmocka_unit_test(start__open_ERRNO),
+		cmocka_unit_test_setup_teardown(start__already_started,
+			setup__start, teardown__stop),
+
+		/* rpma_log_binary_stop() unit tests */
+		cmocka_unit_test(stop__not_started),
+		cmocka_unit_test(stop__user_function),
+
+		/* rpma_log_binary_function() unit tests */
+		cmocka_unit_test(function__not_started),
+		cmocka_unit_test(function__records),
+		cmocka_unit_test(function__call_sites),
+
+		/* rpma_log_binary_fini() unit tests */
+		cmocka_unit_test(fini__success),
+	};
+
+	int ret = cmocka_run_group_tests(tests, NULL, NULL);
+
+	(void) unlink(Path);
+
+	return ret;
+}
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * metrics-format.c -- the rpma_metrics_format() unit tests
+ *
+ * APIs covered:
+ * - rpma_metrics_format()
+ * - rpma_metrics_peer_add()
+ * - rpma_metrics_peer_remove()
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmocka_headers.h"
+#include "metrics.h"
+#include "test-common.h"
+
+#define MOCK_BUF_SIZE	8192
+#define MOCK_PD_HANDLE	0x2A
+
+static struct ibv_device Device = {.name = "mlx5_0"};
+static struct ibv_context Context = {.device = &Device};
+static struct ibv_pd Pd = {.context = &Context, .handle = MOCK_PD_HANDLE};
+
+/*
+ * format__len_NULL -- NULL len is invalid
+ */
+static void
+format__len_NULL(void **unused)
+{
+	char buf[MOCK_BUF_SIZE];
+
+	/* run test */
+	int ret = rpma_metrics_format(buf, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * format__buf_NULL_len_not_0 -- NULL buf of a non-zero length is invalid
+ */
+static void
+format__buf_NULL_len_not_0(void **unused)
+{
+	size_t len = MOCK_BUF_SIZE;
+
+	/* run test */
+	int ret = rpma_metrics_format(NULL, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, MOCK_BUF_SIZE);
+}
+
+/*
+ * format__size -- the required size of the buffer is returned when the buffer is too small
+ * and the text fits the buffer of exactly this size
+ */
+static void
+format__size(void **unused)
+{
+	char buf[MOCK_BUF_SIZE];
+	size_t len = 0;
+
+	/* run test */
+	int ret = rpma_metrics_format(NULL, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_true(len > 1 && len <= MOCK_BUF_SIZE);
+	size_t size = len;
+
+	/* run test */
+	len = size - 1;
+	ret = rpma_metrics_format(buf, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_int_equal(len, size);
+
+	/* run test */
+	ret = rpma_metrics_format(buf, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(len, size - 1);
+	assert_int_equal(strlen(buf), len);
+}
+
+/*
+ * format__no_peers -- only the metrics without labels are rendered when there are no peers
+ */
+static void
+format__no_peers(void **unused)
+{
+	char buf[MOCK_BUF_SIZE];
+	size_t len = sizeof(buf);
+
+	/* run test */
+	int ret = rpma_metrics_format(buf, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(strstr(buf, "# TYPE rpma_peers gauge\n"
+			"# HELP rpma_peers The live peers.\n"
+			"rpma_peers 0\n"));
+	assert_null(strstr(buf, "device="));
+	assert_string_equal(buf + len - strlen("# EOF\n"), "# EOF\n");
+}
+
+/*
+ * format__peers -- the counters of all the connections of every peer are rendered
+ * with the labels of the peer
+ */
+static void
+format__peers(void **unused)
+{
+	struct rpma_stats_list list;
+	struct rpma_stats live;
+	struct rpma_stats deleted;
+	struct rpma_metrics_peer mpeer;
+	char buf[MOCK_BUF_SIZE];
+	size_t len = sizeof(buf);
+
+	/* prepare a peer with one live and one deleted connection */
+	rpma_stats_list_init(&list);
+	rpma_stats_init(&live);
+	rpma_stats_init(&deleted);
+	rpma_stats_list_add(&list, &live);
+	rpma_stats_list_add(&list, &deleted);
+	RPMA_STATS_ADD(&live, RPMA_STATS_WRITES, 2);
+	RPMA_STATS_ADD(&live, RPMA_STATS_WRITE_BYTES, 8192);
+	RPMA_STATS_ADD(&deleted, RPMA_STATS_WRITES, 1);
+	RPMA_STATS_ADD(&deleted, RPMA_STATS_WRITE_BYTES, 4096);
+	RPMA_STATS_ADD(&deleted, RPMA_STATS_SQ_FULL, 3);
+	rpma_stats_list_remove(&list, &deleted);
+	rpma_metrics_peer_add(&mpeer, &Pd, &list);
+
+	/* run test */
+	int ret = rpma_metrics_format(buf, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(strstr(buf, "\nrpma_peers 1\n"));
+	assert_non_null(strstr(buf, "# TYPE rpma_connections gauge\n"
+			"# HELP rpma_connections The live connections.\n"
+			"rpma_connections{device=\"mlx5_0\",pd=\"42\"} 1\n"));
+	assert_non_null(strstr(buf,
+			"\nrpma_operations_total{device=\"mlx5_0\",pd=\"42\",op=\"write\"} 3\n"));
+	assert_non_null(strstr(buf,
+			"\nrpma_operations_total{device=\"mlx5_0\",pd=\"42\",op=\"read\"} 0\n"));
+	assert_non_null(strstr(buf, "# TYPE rpma_operation_bytes counter\n"
+			"# UNIT rpma_operation_bytes bytes\n"));
+	assert_non_null(strstr(buf,
+			"\nrpma_operation_bytes_total{device=\"mlx5_0\",pd=\"42\",op=\"write\"} "
+			"12288\n"));
+	assert_non_null(strstr(buf,
+			"\nrpma_queue_full_total{device=\"mlx5_0\",pd=\"42\",queue=\"sq\"} 3\n"));
+	assert_non_null(strstr(buf,
+			"\nrpma_completions_total{device=\"mlx5_0\",pd=\"42\"} 0\n"));
+
+	/* run test */
+	rpma_metrics_peer_remove(&mpeer);
+	len = sizeof(buf);
+	ret = rpma_metrics_format(buf, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(strstr(buf, "\nrpma_peers 0\n"));
+	assert_null(strstr(buf, "device="));
+}
+
+/*
+ * format__globals -- the process-wide counters are rendered
+ */
+static void
+format__globals(void **unused)
+{
+	char buf[MOCK_BUF_SIZE];
+	size_t len = sizeof(buf);
+
+	RPMA_METRICS_ADD(RPMA_METRICS_CQS, 2);
+	RPMA_METRICS_ADD(RPMA_METRICS_CQ_POLL_ERRORS, 1);
+	RPMA_METRICS_ADD(RPMA_METRICS_RNR_RETRY_EXCEEDED, 4);
+	RPMA_METRICS_ADD(RPMA_METRICS_MRS, 1);
+	RPMA_METRICS_ADD(RPMA_METRICS_MR_BYTES, 65536);
+	RPMA_METRICS_ADD(RPMA_METRICS_MR_REGISTRATIONS, 5);
+
+	/* run test */
+	int ret = rpma_metrics_format(buf, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(strstr(buf, "\nrpma_cqs 2\n"));
+	assert_non_null(strstr(buf, "# TYPE rpma_cq_poll_errors counter\n"
+			"# HELP rpma_cq_poll_errors The failed polls of the completion queues.\n"
+			"rpma_cq_poll_errors_total 1\n"));
+	assert_non_null(strstr(buf, "\nrpma_rnr_retry_exceeded_total 4\n"));
+	assert_non_null(strstr(buf, "\nrpma_srqs 0\n"));
+	assert_non_null(strstr(buf, "\nrpma_mrs 1\n"));
+	assert_non_null(strstr(buf, "# TYPE rpma_mr_registered_bytes gauge\n"
+			"# UNIT rpma_mr_registered_bytes bytes\n"));
+	assert_non_null(strstr(buf, "\nrpma_mr_registered_bytes 65536\n"));
+	assert_non_null(strstr(buf, "\nrpma_mr_registrations_total 5\n"
+			"# EOF\n"));
+
+	RPMA_METRICS_SUB(RPMA_METRICS_CQS, 2);
+	RPMA_METRICS_SUB(RPMA_METRICS_CQ_POLL_ERRORS, 1);
+	RPMA_METRICS_SUB(RPMA_METRICS_RNR_RETRY_EXCEEDED, 4);
+	RPMA_METRICS_SUB(RPMA_METRICS_MRS, 1);
+	RPMA_METRICS_SUB(RPMA_METRICS_MR_BYTES, 65536);
+	RPMA_METRICS_SUB(RPMA_METRICS_MR_REGISTRATIONS, 5);
+}
+
+static const struct CMUnitTest tests_format[] = {
+	/* rpma_metrics_format() unit tests */
+	cmocka_unit_test(format__len_NULL),
+	cmocka_unit_test(format__buf_NULL_len_not_0),
+	cmocka_unit_test(format__size),
+	cmocka_unit_test(format__no_peers),
+	cmocka_unit_test(format__peers),
+	cmocka_unit_test(format__globals),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_format, NULL, NULL);
+}
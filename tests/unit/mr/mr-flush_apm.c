@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * mr-flush_apm.c -- rpma_mr_flush_apm() unit tests
+ */
+
+#include <infiniband/verbs.h>
+#include <stdlib.h>
+
+#include "cmocka_headers.h"
+#include "mr.h"
+#include "librpma.h"
+
+#include "mr-common.h"
+#include "mocks-ibverbs.h"
+#include "test-common.h"
+
+#define MOCK_RAW_LEN	8
+
+/*
+ * flush_apm__failed_E_PROVIDER - rpma_mr_flush_apm failed with RPMA_E_PROVIDER
+ */
+static void
+flush_apm__failed_E_PROVIDER(void **mrs_ptr)
+{
+	struct mrs *mrs = (struct mrs *)*mrs_ptr;
+
+	/* configure mocks */
+	struct ibv_post_send_mock_args args;
+	args.qp = MOCK_QP;
+	args.opcode = IBV_WR_RDMA_READ;
+	args.send_flags = IBV_SEND_SIGNALED; /* for RPMA_F_COMPLETION_ALWAYS */
+	args.wr_id = (uint64_t)MOCK_OP_CONTEXT;
+	args.remote_addr = MOCK_RADDR + MOCK_DST_OFFSET;
+	args.rkey = MOCK_RKEY;
+	args.ret = MOCK_ERRNO;
+	will_return(ibv_post_send_mock, &args);
+
+	/* run test */
+	int ret = rpma_mr_flush_apm(MOCK_QP, mrs->local, MOCK_RAW_LEN, mrs->remote,
+				MOCK_DST_OFFSET, MOCK_LEN, RPMA_F_COMPLETION_ALWAYS,
+				MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_int_equal(errno, MOCK_ERRNO);
+}
+
+/*
+ * flush_apm__success - happy day scenario
+ */
+static void
+flush_apm__success(void **mrs_ptr)
+{
+	struct mrs *mrs = (struct mrs *)*mrs_ptr;
+
+	/* configure mocks */
+	struct ibv_post_send_mock_args args;
+	args.qp = MOCK_QP;
+	args.opcode = IBV_WR_RDMA_READ;
+	args.send_flags = 0; /* for RPMA_F_COMPLETION_ON_ERROR */
+	args.wr_id = (uint64_t)MOCK_OP_CONTEXT;
+	args.remote_addr = MOCK_RADDR + MOCK_DST_OFFSET;
+	args.rkey = MOCK_RKEY;
+	args.ret = MOCK_OK;
+	will_return(ibv_post_send_mock, &args);
+
+	/* run test */
+	int ret = rpma_mr_flush_apm(MOCK_QP, mrs->local, MOCK_RAW_LEN, mrs->remote,
+				MOCK_DST_OFFSET, MOCK_LEN, RPMA_F_COMPLETION_ON_ERROR,
+				MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * group_setup_mr_flush_apm -- prepare resources for all tests in the group
+ */
+static int
+group_setup_mr_flush_apm(void **unused)
+{
+	/* configure global mocks */
+	MOCK_VERBS->ops.post_send = ibv_post_send_mock;
+	Ibv_qp.context = MOCK_VERBS;
+
+	return 0;
+}
+
+static const struct CMUnitTest tests_mr_flush_apm[] = {
+	/* rpma_mr_flush_apm() unit tests */
+	cmocka_unit_test_setup_teardown(flush_apm__failed_E_PROVIDER,
+			setup__mr_local_and_remote,
+			teardown__mr_local_and_remote),
+	cmocka_unit_test_setup_teardown(flush_apm__success,
+			setup__mr_local_and_remote,
+			teardown__mr_local_and_remote),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_mr_flush_apm, group_setup_mr_flush_apm, NULL);
+}
@@ -28,7 +28,7 @@ send__failed_E_NOSUPP(void **mrs_ptr)
 	/* run test */
 	int ret = rpma_mr_send(MOCK_QP, mrs->local, MOCK_SRC_OFFSET,
 			MOCK_LEN, RPMA_F_COMPLETION_ON_ERROR,
-			MOCK_UNKNOWN_OP, 0, MOCK_OP_CONTEXT);
+			MOCK_UNKNOWN_OP, 0, false, MOCK_OP_CONTEXT);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_NOSUPP);
@@ -54,7 +54,7 @@ send__failed_E_PROVIDER(void **mrs_ptr)
 	/* run test */
 	int ret = rpma_mr_send(MOCK_QP, mrs->local, MOCK_SRC_OFFSET,
 			MOCK_LEN, RPMA_F_COMPLETION_ON_ERROR,
-			IBV_WR_SEND, 0, MOCK_OP_CONTEXT);
+			IBV_WR_SEND, 0, false, MOCK_OP_CONTEXT);
 
 	/* verify the results */
 	assert_int_equal(ret, RPMA_E_PROVIDER);
@@ -95,7 +95,7 @@ send__success(void **mrs_ptr)
 		/* run test */
 		int ret = rpma_mr_send(MOCK_QP, mrs->local, MOCK_SRC_OFFSET,
 				MOCK_LEN, RPMA_F_COMPLETION_ALWAYS,
-				opcodes[i], imms[i], MOCK_OP_CONTEXT);
+				opcodes[i], imms[i], false, MOCK_OP_CONTEXT);
 
 		/* verify the results */
 		assert_int_equal(ret, MOCK_OK);
@@ -136,13 +136,41 @@ send_0B_message__success(void **mrs_ptr)
 		/* run test */
 		int ret = rpma_mr_send(MOCK_QP, NULL, 0, 0,
 				RPMA_F_COMPLETION_ALWAYS, opcodes[i], imms[i],
-				MOCK_OP_CONTEXT);
+				false, MOCK_OP_CONTEXT);
 
 		/* verify the results */
 		assert_int_equal(ret, MOCK_OK);
 	}
 }
 
+/*
+ * send__fence_success -- the fenced send is posted with IBV_SEND_FENCE
+ */
+static void
+send__fence_success(void **mrs_ptr)
+{
+	struct mrs *mrs = (struct mrs *)*mrs_ptr;
+
+	/* configure mocks */
+	struct ibv_post_send_mock_args args;
+	args.qp = MOCK_QP;
+	args.opcode = IBV_WR_SEND_WITH_IMM;
+	/* for RPMA_F_COMPLETION_ALWAYS and the fence */
+	args.send_flags = IBV_SEND_SIGNALED | IBV_SEND_FENCE;
+	args.wr_id = (uint64_t)MOCK_OP_CONTEXT;
+	args.imm_data = htonl(MOCK_IMM_DATA);
+	args.ret = MOCK_OK;
+	will_return(ibv_post_send_mock, &args);
+
+	/* run test */
+	int ret = rpma_mr_send(MOCK_QP, mrs->local, MOCK_SRC_OFFSET,
+			MOCK_LEN, RPMA_F_COMPLETION_ALWAYS,
+			IBV_WR_SEND_WITH_IMM, MOCK_IMM_DATA, true, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
 /*
  * group_setup_mr_send -- prepare resources for all tests in the group
  */
@@ -181,6 +209,9 @@ static const struct CMUnitTest tests_mr_send[] = {
 	cmocka_unit_test_setup_teardown(send_0B_message__success,
 			setup__mr_local_and_remote,
 			teardown__mr_local_and_remote),
+	cmocka_unit_test_setup_teardown(send__fence_success,
+			setup__mr_local_and_remote,
+			teardown__mr_local_and_remote),
 	cmocka_unit_test(NULL)
 };
 
@@ -6,6 +6,7 @@
  * peer-common.c -- the common part of the peer unit test
  */
 
+#include <string.h>
 #include <infiniband/verbs.h>
 
 #include "cmocka_headers.h"
@@ -17,9 +18,12 @@
 #include "test-common.h"
 
 struct prestate prestate_Capable = {IBV_TRANSPORT_IB, 0, 0, MOCK_ODP_CAPABLE,
-		MOCK_ATOMIC_WRITE_CAPABLE, MOCK_FLUSH_CAPABLE, NULL};
+		MOCK_ATOMIC_WRITE_CAPABLE, MOCK_FLUSH_CAPABLE, 0, NULL};
 struct prestate prestate_Incapable = {IBV_TRANSPORT_IB, 0, 0, MOCK_ODP_INCAPABLE,
-		MOCK_ATOMIC_WRITE_INCAPABLE, MOCK_FLUSH_INCAPABLE, NULL};
+		MOCK_ATOMIC_WRITE_INCAPABLE, MOCK_FLUSH_INCAPABLE, 0, NULL};
+
+/* the device capabilities reported by rpma_utils_ibv_context_query_caps() */
+struct rpma_peer_caps Mock_caps;
 
 /*
  * setup__peer -- prepare a valid rpma_peer object
@@ -35,11 +39,15 @@ setup__peer(void **pprestate)
 	 * NOTE: it is not allowed to call ibv_dealloc_pd() if ibv_alloc_pd()
 	 * succeeded.
 	 */
-	will_return(rpma_utils_ibv_context_is_atomic_write_capable,
-			prestate->is_atomic_write_capable);
-	will_return(rpma_utils_ibv_context_is_flush_capable, prestate->is_flush_capable);
-	will_return(rpma_utils_ibv_context_is_odp_capable,
-			prestate->is_odp_capable);
+	memset(&Mock_caps, 0, sizeof(Mock_caps));
+	Mock_caps.max_qp_wr = prestate->max_wr;
+	Mock_caps.max_sge = prestate->max_wr;
+	Mock_caps.max_cqe = (int)prestate->max_wr;
+	Mock_caps.max_srq_wr = prestate->max_wr;
+	Mock_caps.is_native_atomic_write_supported = prestate->is_atomic_write_capable;
+	Mock_caps.is_native_flush_supported = prestate->is_flush_capable;
+	Mock_caps.is_odp_supported = prestate->is_odp_capable;
+	will_return(rpma_utils_ibv_context_query_caps, &Mock_caps);
 	struct ibv_alloc_pd_mock_args alloc_args = {MOCK_VALIDATE, MOCK_IBV_PD};
 	will_return(ibv_alloc_pd, &alloc_args);
 	expect_value(ibv_alloc_pd, ibv_ctx, MOCK_VERBS);
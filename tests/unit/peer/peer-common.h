@@ -46,11 +46,13 @@ struct prestate {
 	int is_odp_capable;
 	int is_atomic_write_capable;
 	int is_flush_capable;
+	uint32_t max_wr; /* the limit of the number of WRs and CQ entries (0 - no limit) */
 	struct rpma_peer *peer;
 };
 
 extern struct prestate prestate_Capable;
 extern struct prestate prestate_Incapable;
+extern struct rpma_peer_caps Mock_caps;
 
 int setup__peer(void **pprestate);
 int teardown__peer(void **pprestate);
@@ -17,11 +17,19 @@
 #include "mocks-rpma-conn_cfg.h"
 #include "mocks-rpma-cq.h"
 #include "mocks-rpma-srq.h"
+#include "mocks-rpma-utils.h"
 #include "peer.h"
 #include "peer-common.h"
 
 #define MOCK_GET_IBV_RCQ(rcq) rcq == MOCK_RPMA_RCQ ? MOCK_IBV_RCQ : MOCK_IBV_SRQ_RCQ
 
+/* the size clamped to the device limit (0 - no limit) */
+#define CLAMP(size, limit) ((limit) && (size) > (limit) ? (limit) : (size))
+
+/* the device limits lower than MOCK_SQ_SIZE_CUSTOM and MOCK_RQ_SIZE_CUSTOM */
+static struct prestate prestate_Limited = {IBV_TRANSPORT_IB, 0, 0, MOCK_ODP_CAPABLE,
+		MOCK_ATOMIC_WRITE_CAPABLE, MOCK_FLUSH_CAPABLE, MOCK_RQ_SIZE_CUSTOM / 2, NULL};
+
 static struct conn_cfg_get_mock_args Get_args = {
 	.cfg = MOCK_CONN_CFG_CUSTOM,
 	.sq_size = MOCK_SQ_SIZE_CUSTOM,
@@ -66,9 +74,9 @@ configure_create_qp_ex(struct prestate *prestate, struct rpma_cq *rcq)
 	expect_value(rdma_create_qp_ex, qp_init_attr->srq, Get_args.srq ?
 		MOCK_IBV_SRQ : NULL);
 	expect_value(rdma_create_qp_ex, qp_init_attr->cap.max_send_wr,
-		MOCK_SQ_SIZE_CUSTOM);
+		CLAMP(MOCK_SQ_SIZE_CUSTOM, prestate->max_wr));
 	expect_value(rdma_create_qp_ex, qp_init_attr->cap.max_recv_wr,
-		MOCK_RQ_SIZE_CUSTOM);
+		CLAMP(MOCK_RQ_SIZE_CUSTOM, prestate->max_wr));
 	expect_value(rdma_create_qp_ex, qp_init_attr->cap.max_send_sge,
 		RPMA_MAX_SGE);
 	expect_value(rdma_create_qp_ex, qp_init_attr->cap.max_recv_sge,
@@ -201,6 +209,9 @@ main(int argc, char *argv[])
 				setup__peer, teardown__peer, &prestate_Capable),
 		cmocka_unit_test_prestate_setup_teardown(create_qp__success,
 				setup__peer, teardown__peer, &prestate_Capable),
+		/* the SQ and RQ sizes are clamped to the device limits */
+		cmocka_unit_test_prestate_setup_teardown(create_qp__success,
+				setup__peer, teardown__peer, &prestate_Limited),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * peer-get_caps.c -- the rpma_peer_get_caps() unit tests
+ *
+ * API covered:
+ * - rpma_peer_get_caps()
+ */
+
+#include "librpma.h"
+#include "peer.h"
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rpma-utils.h"
+#include "peer-common.h"
+#include "test-common.h"
+
+#define MOCK_MAX_WR	64
+
+static struct prestate prestate_Limited = {IBV_TRANSPORT_IB, 0, 0, MOCK_ODP_CAPABLE,
+		MOCK_ATOMIC_WRITE_INCAPABLE, MOCK_FLUSH_CAPABLE, MOCK_MAX_WR, NULL};
+
+/*
+ * get_caps__peer_NULL -- NULL peer is invalid
+ */
+static void
+get_caps__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_peer_get_caps(NULL, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_caps__caps_NULL -- NULL caps is invalid
+ */
+static void
+get_caps__caps_NULL(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* run test */
+	int ret = rpma_peer_get_caps(prestate->peer, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_caps__success -- the snapshot taken by rpma_peer_new() is returned
+ */
+static void
+get_caps__success(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_peer_get_caps(prestate->peer, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(caps.max_qp_wr, MOCK_MAX_WR);
+	assert_int_equal(caps.max_sge, MOCK_MAX_WR);
+	assert_int_equal(caps.max_cqe, MOCK_MAX_WR);
+	assert_int_equal(caps.max_srq_wr, MOCK_MAX_WR);
+	assert_int_equal(caps.is_atomic_supported, 0);
+	assert_int_equal(caps.is_native_atomic_write_supported, MOCK_ATOMIC_WRITE_INCAPABLE);
+	assert_int_equal(caps.is_native_flush_supported, MOCK_FLUSH_CAPABLE);
+	assert_int_equal(caps.is_odp_supported, MOCK_ODP_CAPABLE);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_peer_get_caps() unit tests */
+		cmocka_unit_test(get_caps__peer_NULL),
+		cmocka_unit_test_prestate_setup_teardown(get_caps__caps_NULL,
+				setup__peer, teardown__peer, &prestate_Capable),
+		cmocka_unit_test_prestate_setup_teardown(get_caps__success,
+				setup__peer, teardown__peer, &prestate_Limited),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * peer-get_stats.c -- the rpma_peer_get_stats() unit tests
+ *
+ * APIs covered:
+ * - rpma_peer_get_stats()
+ * - rpma_peer_attach_stats()
+ * - rpma_peer_detach_stats()
+ */
+
+#include "librpma.h"
+#include "peer.h"
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "peer-common.h"
+#include "test-common.h"
+
+/*
+ * get_stats__peer_NULL -- NULL peer is invalid
+ */
+static void
+get_stats__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_conn_stats stats;
+	int ret = rpma_peer_get_stats(NULL, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_stats__stats_NULL -- NULL stats is invalid
+ */
+static void
+get_stats__stats_NULL(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* run test */
+	int ret = rpma_peer_get_stats(prestate->peer, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_stats__no_conns -- the statistics of a peer without connections are zeroed
+ */
+static void
+get_stats__no_conns(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* run test */
+	struct rpma_conn_stats stats;
+	memset(&stats, 0xff, sizeof(stats));
+	int ret = rpma_peer_get_stats(prestate->peer, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	struct rpma_conn_stats zeroed = {0};
+	assert_memory_equal(&stats, &zeroed, sizeof(stats));
+}
+
+/*
+ * get_stats__sums -- the counters of the live and of the deleted connections are summed up
+ */
+static void
+get_stats__sums(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+	struct rpma_stats conn_stats[3];
+
+	for (int i = 0; i < 3; i++) {
+		rpma_stats_init(&conn_stats[i]);
+		rpma_peer_attach_stats(prestate->peer, &conn_stats[i]);
+		RPMA_STATS_ADD(&conn_stats[i], RPMA_STATS_WRITES, i + 1);
+		RPMA_STATS_ADD(&conn_stats[i], RPMA_STATS_WRITE_BYTES, MOCK_LEN);
+	}
+
+	/* the counters of the deleted connection are kept */
+	rpma_peer_detach_stats(prestate->peer, &conn_stats[1]);
+	RPMA_STATS_ADD(&conn_stats[0], RPMA_STATS_COMPLETIONS, 4);
+
+	/* run test */
+	struct rpma_conn_stats stats;
+	int ret = rpma_peer_get_stats(prestate->peer, &stats);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.writes, 1 + 2 + 3);
+	assert_int_equal(stats.write_bytes, 3 * MOCK_LEN);
+	assert_int_equal(stats.completions, 4);
+	assert_int_equal(stats.reads, 0);
+
+	rpma_peer_detach_stats(prestate->peer, &conn_stats[0]);
+	rpma_peer_detach_stats(prestate->peer, &conn_stats[2]);
+
+	ret = rpma_peer_get_stats(prestate->peer, &stats);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(stats.writes, 1 + 2 + 3);
+	assert_int_equal(stats.completions, 4);
+}
+
+static const struct CMUnitTest tests_get_stats[] = {
+	/* rpma_peer_get_stats() unit tests */
+	cmocka_unit_test(get_stats__peer_NULL),
+	cmocka_unit_test_prestate_setup_teardown(get_stats__stats_NULL,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test_prestate_setup_teardown(get_stats__no_conns,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test_prestate_setup_teardown(get_stats__sums,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_get_stats, NULL, NULL);
+}
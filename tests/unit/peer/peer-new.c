@@ -92,9 +92,7 @@ new__alloc_pd_ENOMEM(void **unused)
 	will_return(ibv_alloc_pd, &alloc_args);
 	expect_value(ibv_alloc_pd, ibv_ctx, MOCK_VERBS);
 	will_return(ibv_alloc_pd, ENOMEM);
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_flush_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_odp_capable, 1);
+	will_return_maybe(rpma_utils_ibv_context_query_caps, &Mock_caps);
 	will_return_maybe(__wrap__test_malloc, MOCK_OK);
 
 	/* run test */
@@ -121,9 +119,7 @@ new__alloc_pd_ERRNO(void **unused)
 	will_return(ibv_alloc_pd, &alloc_args);
 	expect_value(ibv_alloc_pd, ibv_ctx, MOCK_VERBS);
 	will_return(ibv_alloc_pd, MOCK_ERRNO);
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_flush_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_odp_capable, 1);
+	will_return_maybe(rpma_utils_ibv_context_query_caps, &Mock_caps);
 	will_return_maybe(__wrap__test_malloc, MOCK_OK);
 
 	/* run test */
@@ -150,9 +146,7 @@ new__alloc_pd_no_error(void **unused)
 	will_return(ibv_alloc_pd, &alloc_args);
 	expect_value(ibv_alloc_pd, ibv_ctx, MOCK_VERBS);
 	will_return(ibv_alloc_pd, MOCK_OK);
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_flush_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_odp_capable, 1);
+	will_return_maybe(rpma_utils_ibv_context_query_caps, &Mock_caps);
 	will_return_maybe(__wrap__test_malloc, MOCK_OK);
 
 	/* run test */
@@ -165,66 +159,15 @@ new__alloc_pd_no_error(void **unused)
 }
 
 /*
- * new__atomic_write_ERRNO -- rpma_utils_ibv_context_is_atomic_write_capable()
- * fails with MOCK_ERRNO
+ * new__query_caps_ERRNO -- rpma_utils_ibv_context_query_caps() fails with MOCK_ERRNO
  */
 static void
-new__atomic_write_ERRNO(void **unused)
+new__query_caps_ERRNO(void **unused)
 {
 	/* configure mocks */
-	will_return(rpma_utils_ibv_context_is_atomic_write_capable, MOCK_ERR_PENDING);
-	will_return(rpma_utils_ibv_context_is_atomic_write_capable, RPMA_E_PROVIDER);
-	will_return(rpma_utils_ibv_context_is_atomic_write_capable, MOCK_ERRNO);
-	will_return_maybe(__wrap__test_malloc, MOCK_OK);
-	will_return_maybe(ibv_alloc_pd, MOCK_IBV_PD);
-	will_return_maybe(ibv_dealloc_pd, MOCK_OK);
-
-	/* run test */
-	struct rpma_peer *peer = NULL;
-	int ret = rpma_peer_new(MOCK_VERBS, &peer);
-
-	/* verify the results */
-	assert_int_equal(ret, RPMA_E_PROVIDER);
-	assert_null(peer);
-}
-
-/*
- * new__flush_ERRNO -- rpma_utils_ibv_context_is_flush_capable() fails with MOCK_ERRNO
- */
-static void
-new__flush_ERRNO(void **unused)
-{
-	/* configure mocks */
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 1);
-	will_return(rpma_utils_ibv_context_is_flush_capable, MOCK_ERR_PENDING);
-	will_return(rpma_utils_ibv_context_is_flush_capable, RPMA_E_PROVIDER);
-	will_return(rpma_utils_ibv_context_is_flush_capable, MOCK_ERRNO);
-	will_return_maybe(__wrap__test_malloc, MOCK_OK);
-	will_return_maybe(ibv_alloc_pd, MOCK_IBV_PD);
-	will_return_maybe(ibv_dealloc_pd, MOCK_OK);
-
-	/* run test */
-	struct rpma_peer *peer = NULL;
-	int ret = rpma_peer_new(MOCK_VERBS, &peer);
-
-	/* verify the results */
-	assert_int_equal(ret, RPMA_E_PROVIDER);
-	assert_null(peer);
-}
-
-/*
- * new__odp_ERRNO -- rpma_utils_ibv_context_is_odp_capable()
- * fails with MOCK_ERRNO
- */
-static void
-new__odp_ERRNO(void **unused)
-{
-	/* configure mocks */
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_flush_capable, 1);
-	will_return(rpma_utils_ibv_context_is_odp_capable, MOCK_ERR_PENDING);
-	will_return(rpma_utils_ibv_context_is_odp_capable, RPMA_E_PROVIDER);
-	will_return(rpma_utils_ibv_context_is_odp_capable, MOCK_ERRNO);
+	will_return(rpma_utils_ibv_context_query_caps, NULL);
+	will_return(rpma_utils_ibv_context_query_caps, RPMA_E_PROVIDER);
+	will_return(rpma_utils_ibv_context_query_caps, MOCK_ERRNO);
 	will_return_maybe(__wrap__test_malloc, MOCK_OK);
 	will_return_maybe(ibv_alloc_pd, MOCK_IBV_PD);
 	will_return_maybe(ibv_dealloc_pd, MOCK_OK);
@@ -252,9 +195,7 @@ new__malloc_ERRNO(void **unused)
 	struct ibv_dealloc_pd_mock_args dealloc_args =
 		{MOCK_PASSTHROUGH, MOCK_OK};
 	will_return_maybe(ibv_dealloc_pd, &dealloc_args);
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_flush_capable, 1);
-	will_return_maybe(rpma_utils_ibv_context_is_odp_capable, 1);
+	will_return_maybe(rpma_utils_ibv_context_query_caps, &Mock_caps);
 
 	/* run test */
 	struct rpma_peer *peer = NULL;
@@ -279,9 +220,7 @@ new__success(void **unused)
 	struct ibv_alloc_pd_mock_args alloc_args = {MOCK_VALIDATE, MOCK_IBV_PD};
 	will_return(ibv_alloc_pd, &alloc_args);
 	expect_value(ibv_alloc_pd, ibv_ctx, MOCK_VERBS);
-	will_return_maybe(rpma_utils_ibv_context_is_atomic_write_capable, 0);
-	will_return_maybe(rpma_utils_ibv_context_is_flush_capable, 0);
-	will_return(rpma_utils_ibv_context_is_odp_capable, 1);
+	will_return(rpma_utils_ibv_context_query_caps, &Mock_caps);
 	will_return(__wrap__test_malloc, MOCK_OK);
 
 	/* run test - step 1 */
@@ -387,9 +326,7 @@ main(int argc, char *argv[])
 		cmocka_unit_test(new__alloc_pd_ENOMEM),
 		cmocka_unit_test(new__alloc_pd_ERRNO),
 		cmocka_unit_test(new__alloc_pd_no_error),
-		cmocka_unit_test(new__odp_ERRNO),
-		cmocka_unit_test(new__atomic_write_ERRNO),
-		cmocka_unit_test(new__flush_ERRNO),
+		cmocka_unit_test(new__query_caps_ERRNO),
 		cmocka_unit_test(new__malloc_ERRNO),
 		cmocka_unit_test(new__success),
 
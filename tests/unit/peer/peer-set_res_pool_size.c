@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * peer-set_res_pool_size.c -- the rpma_peer_set_res_pool_size() unit tests
+ *
+ * APIs covered:
+ * - rpma_peer_set_res_pool_size()
+ * - rpma_peer_get_res_pool()
+ * - rpma_peer_attach_stats()
+ * - rpma_peer_detach_stats()
+ * - rpma_peer_delete()
+ */
+
+#include "librpma.h"
+#include "peer.h"
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rpma-res_pool.h"
+#include "peer-common.h"
+#include "test-common.h"
+
+#define MOCK_RES_POOL_SIZE	4
+
+/*
+ * set_res_pool_size__peer_NULL -- NULL peer is invalid
+ */
+static void
+set_res_pool_size__peer_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(NULL, MOCK_RES_POOL_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * set_res_pool_size__size_negative -- size < 0 is invalid
+ */
+static void
+set_res_pool_size__size_negative(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(prestate->peer, -1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(rpma_peer_get_res_pool(prestate->peer));
+}
+
+/*
+ * set_res_pool_size__live_conns -- the pool cannot be replaced while the peer has
+ * live connections
+ */
+static void
+set_res_pool_size__live_conns(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+	struct rpma_stats conn_stats;
+	rpma_stats_init(&conn_stats);
+	rpma_peer_attach_stats(prestate->peer, &conn_stats);
+
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(prestate->peer, MOCK_RES_POOL_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(rpma_peer_get_res_pool(prestate->peer));
+
+	/* the pool can be set after the connection is deleted */
+	rpma_peer_detach_stats(prestate->peer, &conn_stats);
+	expect_value(rpma_res_pool_new, size, MOCK_RES_POOL_SIZE);
+	will_return(rpma_res_pool_new, MOCK_OK);
+	ret = rpma_peer_set_res_pool_size(prestate->peer, MOCK_RES_POOL_SIZE);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* the pool will be deleted along with the peer */
+	will_return(rpma_res_pool_delete, MOCK_OK);
+}
+
+/*
+ * set_res_pool_size__res_pool_new_E_NOMEM -- rpma_res_pool_new() fails with RPMA_E_NOMEM
+ */
+static void
+set_res_pool_size__res_pool_new_E_NOMEM(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* configure mocks */
+	expect_value(rpma_res_pool_new, size, MOCK_RES_POOL_SIZE);
+	will_return(rpma_res_pool_new, RPMA_E_NOMEM);
+
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(prestate->peer, MOCK_RES_POOL_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rpma_peer_get_res_pool(prestate->peer));
+}
+
+/*
+ * set_res_pool_size__res_pool_delete_E_PROVIDER -- deleting the previous pool fails
+ * but the new one is used anyway
+ */
+static void
+set_res_pool_size__res_pool_delete_E_PROVIDER(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* configure mocks */
+	expect_value(rpma_res_pool_new, size, MOCK_RES_POOL_SIZE);
+	will_return(rpma_res_pool_new, MOCK_OK);
+	expect_value(rpma_res_pool_new, size, 2 * MOCK_RES_POOL_SIZE);
+	will_return(rpma_res_pool_new, MOCK_OK);
+	will_return(rpma_res_pool_delete, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(prestate->peer, MOCK_RES_POOL_SIZE);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_peer_set_res_pool_size(prestate->peer, 2 * MOCK_RES_POOL_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_ptr_equal(rpma_peer_get_res_pool(prestate->peer), MOCK_RES_POOL);
+
+	/* the pool will be deleted along with the peer */
+	will_return(rpma_res_pool_delete, MOCK_OK);
+}
+
+/*
+ * set_res_pool_size__success -- the pool is created and then deleted by size == 0
+ */
+static void
+set_res_pool_size__success(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* configure mocks */
+	expect_value(rpma_res_pool_new, size, MOCK_RES_POOL_SIZE);
+	will_return(rpma_res_pool_new, MOCK_OK);
+	will_return(rpma_res_pool_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(prestate->peer, MOCK_RES_POOL_SIZE);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(rpma_peer_get_res_pool(prestate->peer), MOCK_RES_POOL);
+
+	/* run test */
+	ret = rpma_peer_set_res_pool_size(prestate->peer, 0);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(rpma_peer_get_res_pool(prestate->peer));
+}
+
+/*
+ * delete__res_pool_delete_E_PROVIDER -- deleting the pool fails but the peer is deleted anyway
+ */
+static void
+delete__res_pool_delete_E_PROVIDER(void **pprestate)
+{
+	struct prestate *prestate = *pprestate;
+
+	/* configure mocks */
+	expect_value(rpma_res_pool_new, size, MOCK_RES_POOL_SIZE);
+	will_return(rpma_res_pool_new, MOCK_OK);
+	will_return(rpma_res_pool_delete, RPMA_E_PROVIDER);
+	struct ibv_dealloc_pd_mock_args dealloc_args = {MOCK_VALIDATE, MOCK_OK};
+	will_return(ibv_dealloc_pd, &dealloc_args);
+	expect_value(ibv_dealloc_pd, pd, MOCK_IBV_PD);
+
+	/* run test */
+	int ret = rpma_peer_set_res_pool_size(prestate->peer, MOCK_RES_POOL_SIZE);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_peer_delete(&prestate->peer);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(prestate->peer);
+}
+
+static const struct CMUnitTest tests_set_res_pool_size[] = {
+	/* rpma_peer_set_res_pool_size() unit tests */
+	cmocka_unit_test(set_res_pool_size__peer_NULL),
+	cmocka_unit_test_prestate_setup_teardown(set_res_pool_size__size_negative,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test_prestate_setup_teardown(set_res_pool_size__live_conns,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test_prestate_setup_teardown(set_res_pool_size__res_pool_new_E_NOMEM,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test_prestate_setup_teardown(set_res_pool_size__res_pool_delete_E_PROVIDER,
+		setup__peer, teardown__peer, &prestate_Capable),
+	cmocka_unit_test_prestate_setup_teardown(set_res_pool_size__success,
+		setup__peer, teardown__peer, &prestate_Capable),
+
+	/* rpma_peer_delete() unit tests */
+	cmocka_unit_test_prestate_setup_teardown(delete__res_pool_delete_E_PROVIDER,
+		setup__peer, NULL, &prestate_Capable),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_set_res_pool_size, NULL, NULL);
+}
@@ -0,0 +1,508 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail-common.c -- the multi-rail unit tests common functions
+ */
+
+#include <string.h>
+
+#include "rail-common.h"
+
+struct ibv_context *Ibv_ctxs[MOCK_NUM_RAILS] = {
+	MOCK_RAIL_CTX(0), MOCK_RAIL_CTX(1), MOCK_RAIL_CTX(2)
+};
+
+const char *Addrs[MOCK_NUM_RAILS] = {"127.0.0.1", "127.0.0.2", "127.0.0.3"};
+
+uint64_t Free_chunks[MOCK_NUM_RAILS];
+
+const void *Part_op_context;
+
+/*
+ * rpma_peer_new -- rpma_peer_new() mock
+ */
+int
+rpma_peer_new(struct ibv_context *ibv_ctx, struct rpma_peer **peer_ptr)
+{
+	check_expected_ptr(ibv_ctx);
+	assert_non_null(peer_ptr);
+
+	int ret = mock_type(int);
+	if (ret == MOCK_OK)
+		*peer_ptr = MOCK_RAIL_PEER((uintptr_t)ibv_ctx - (uintptr_t)MOCK_RAIL_CTX(0));
+
+	return ret;
+}
+
+/*
+ * rpma_peer_delete -- rpma_peer_delete() mock
+ */
+int
+rpma_peer_delete(struct rpma_peer **peer_ptr)
+{
+	assert_non_null(peer_ptr);
+
+	struct rpma_peer *peer = *peer_ptr;
+	check_expected_ptr(peer);
+
+	*peer_ptr = NULL;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_mr_reg -- rpma_mr_reg() mock
+ */
+int
+rpma_mr_reg(struct rpma_peer *peer, void *ptr, size_t size, int usage,
+		struct rpma_mr_local **mr_ptr)
+{
+	check_expected_ptr(peer);
+	assert_ptr_equal(ptr, MOCK_RAIL_PTR);
+	assert_int_equal(size, MOCK_RAIL_SIZE);
+	assert_int_equal(usage, MOCK_RAIL_USAGE);
+	assert_non_null(mr_ptr);
+
+	int ret = mock_type(int);
+	if (ret == MOCK_OK)
+		*mr_ptr = MOCK_RAIL_MR((uintptr_t)peer - (uintptr_t)MOCK_RAIL_PEER(0));
+
+	return ret;
+}
+
+/*
+ * rpma_mr_dereg -- rpma_mr_dereg() mock
+ */
+int
+rpma_mr_dereg(struct rpma_mr_local **mr_ptr)
+{
+	assert_non_null(mr_ptr);
+
+	struct rpma_mr_local *mr = *mr_ptr;
+	check_expected_ptr(mr);
+
+	*mr_ptr = NULL;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_mr_get_descriptor_size -- rpma_mr_get_descriptor_size() mock
+ */
+int
+rpma_mr_get_descriptor_size(const struct rpma_mr_local *mr, size_t *desc_size)
+{
+	assert_non_null(mr);
+	assert_non_null(desc_size);
+
+	*desc_size = MOCK_DESC_SIZE;
+
+	return 0;
+}
+
+/*
+ * rpma_mr_get_descriptor -- rpma_mr_get_descriptor() mock (the descriptor holds the index of
+ * the rail)
+ */
+int
+rpma_mr_get_descriptor(const struct rpma_mr_local *mr, void *desc)
+{
+	assert_non_null(desc);
+
+	uint32_t index = (uint32_t)((uintptr_t)mr - (uintptr_t)MOCK_RAIL_MR(0));
+	memcpy(desc, &index, MOCK_DESC_SIZE);
+
+	return 0;
+}
+
+/*
+ * rpma_mr_remote_from_descriptor -- rpma_mr_remote_from_descriptor() mock
+ */
+int
+rpma_mr_remote_from_descriptor(const void *desc, size_t desc_size,
+		struct rpma_mr_remote **mr_ptr)
+{
+	assert_non_null(desc);
+	assert_int_equal(desc_size, MOCK_DESC_SIZE);
+	assert_non_null(mr_ptr);
+
+	uint32_t index;
+	memcpy(&index, desc, MOCK_DESC_SIZE);
+	*mr_ptr = MOCK_RAIL_MR_REMOTE(index);
+
+	return 0;
+}
+
+/*
+ * rpma_mr_remote_delete -- rpma_mr_remote_delete() mock
+ */
+int
+rpma_mr_remote_delete(struct rpma_mr_remote **mr_ptr)
+{
+	assert_non_null(mr_ptr);
+
+	struct rpma_mr_remote *mr = *mr_ptr;
+	check_expected_ptr(mr);
+
+	*mr_ptr = NULL;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_stripe_connect -- rpma_stripe_connect() mock
+ */
+int
+rpma_stripe_connect(struct rpma_peer *peer, const char *addr, const char *port,
+		const struct rpma_conn_cfg *cfg, const struct rpma_conn_private_data *pdata,
+		int num_conns, size_t chunk_size, struct rpma_stripe **stripe_ptr)
+{
+	check_expected_ptr(peer);
+	check_expected_ptr(addr);
+	assert_string_equal(port, MOCK_PORT);
+	assert_null(cfg);
+	assert_null(pdata);
+	assert_int_equal(num_conns, MOCK_CONNS_PER_RAIL);
+	assert_int_equal(chunk_size, MOCK_CHUNK_SIZE);
+	assert_non_null(stripe_ptr);
+
+	int ret = mock_type(int);
+	if (ret == MOCK_OK)
+		*stripe_ptr = MOCK_RAIL_STRIPE((uintptr_t)peer - (uintptr_t)MOCK_RAIL_PEER(0));
+
+	return ret;
+}
+
+/*
+ * rpma_stripe_delete -- rpma_stripe_delete() mock
+ */
+int
+rpma_stripe_delete(struct rpma_stripe **stripe_ptr)
+{
+	assert_non_null(stripe_ptr);
+
+	struct rpma_stripe *stripe = *stripe_ptr;
+	check_expected_ptr(stripe);
+
+	*stripe_ptr = NULL;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_stripe_get_capacity -- rpma_stripe_get_capacity() mock
+ */
+uint64_t
+rpma_stripe_get_capacity(const struct rpma_stripe *stripe)
+{
+	assert_non_null(stripe);
+
+	return MOCK_RAIL_CAPACITY;
+}
+
+/*
+ * rpma_stripe_get_free_chunks -- rpma_stripe_get_free_chunks() mock (the values are taken
+ * from Free_chunks)
+ */
+uint64_t
+rpma_stripe_get_free_chunks(const struct rpma_stripe *stripe)
+{
+	return Free_chunks[(uintptr_t)stripe - (uintptr_t)MOCK_RAIL_STRIPE(0)];
+}
+
+/*
+ * rpma_stripe_read -- rpma_stripe_read() mock (the op_context is stored in Part_op_context)
+ */
+int
+rpma_stripe_read(struct rpma_stripe *stripe, struct rpma_mr_local *dst, size_t dst_offset,
+		const struct rpma_mr_remote *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	check_expected_ptr(stripe);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	assert_non_null(op_context);
+
+	Part_op_context = op_context;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_stripe_write -- rpma_stripe_write() mock (the op_context is stored in Part_op_context)
+ */
+int
+rpma_stripe_write(struct rpma_stripe *stripe, struct rpma_mr_remote *dst, size_t dst_offset,
+		const struct rpma_mr_local *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	check_expected_ptr(stripe);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	assert_non_null(op_context);
+
+	Part_op_context = op_context;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_stripe_get_wc -- rpma_stripe_get_wc() mock
+ */
+int
+rpma_stripe_get_wc(struct rpma_stripe *stripe, struct ibv_wc *wc)
+{
+	check_expected_ptr(stripe);
+	assert_non_null(wc);
+
+	int ret = mock_type(int);
+	if (ret)
+		return ret;
+
+	*wc = *mock_type(struct ibv_wc *);
+
+	return 0;
+}
+
+/*
+ * setup__rail_peer_new -- prepare a valid multi-rail peer
+ */
+int
+setup__rail_peer_new(void **rstate_ptr)
+{
+	static struct rail_test_state rstate;
+	memset(&rstate, 0, sizeof(rstate));
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_peer_new(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_peer_new(Ibv_ctxs, MOCK_NUM_RAILS, &rstate.rpeer);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(rstate.rpeer);
+
+	*rstate_ptr = &rstate;
+
+	return 0;
+}
+
+/*
+ * teardown__rail_peer_delete -- delete the multi-rail peer
+ */
+int
+teardown__rail_peer_delete(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_peer_delete(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_peer_delete(&rstate->rpeer);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(rstate->rpeer);
+
+	return 0;
+}
+
+/*
+ * setup__rail_conn_connect -- prepare a valid multi-rail connection along with a local and
+ * a remote multi-rail memory regions
+ */
+int
+setup__rail_conn_connect(void **rstate_ptr)
+{
+	setup__rail_peer_new(rstate_ptr);
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_mr_reg(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE,
+			&rstate->mr);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* the remote memory regions are created from the descriptor of the local ones */
+	char desc[MOCK_RAIL_DESC_SIZE];
+	ret = rpma_rail_mr_get_descriptor(rstate->mr, desc);
+	assert_int_equal(ret, MOCK_OK);
+
+	will_return(__wrap__test_malloc, MOCK_OK);
+	ret = rpma_rail_mr_remote_from_descriptor(desc, sizeof(desc), &rstate->remote);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 3);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++) {
+		configure_stripe_connect(i, MOCK_OK);
+		Free_chunks[i] = MOCK_RAIL_CAPACITY;
+	}
+
+	/* run test */
+	ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rstate->rconn);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(rstate->rconn);
+
+	return 0;
+}
+
+/*
+ * teardown__rail_conn_delete -- delete the multi-rail connection, the memory regions and
+ * the multi-rail peer
+ */
+int
+teardown__rail_conn_delete(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_RAILS; i++) {
+		configure_stripe_delete(i, MOCK_OK);
+		configure_remote_delete(i, MOCK_OK);
+		configure_mr_dereg(i, MOCK_OK);
+	}
+
+	/* run test */
+	int ret = rpma_rail_conn_delete(&rstate->rconn);
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(rstate->rconn);
+	ret = rpma_rail_mr_remote_delete(&rstate->remote);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_rail_mr_dereg(&rstate->mr);
+	assert_int_equal(ret, MOCK_OK);
+
+	return teardown__rail_peer_delete(rstate_ptr);
+}
+
+/*
+ * configure_peer_new -- configure the rpma_peer_new() mock for the i-th rail
+ */
+void
+configure_peer_new(int i, int ret)
+{
+	expect_value(rpma_peer_new, ibv_ctx, MOCK_RAIL_CTX(i));
+	will_return(rpma_peer_new, ret);
+}
+
+/*
+ * configure_peer_delete -- configure the rpma_peer_delete() mock for the i-th rail
+ */
+void
+configure_peer_delete(int i, int ret)
+{
+	expect_value(rpma_peer_delete, peer, MOCK_RAIL_PEER(i));
+	will_return(rpma_peer_delete, ret);
+}
+
+/*
+ * configure_mr_reg -- configure the rpma_mr_reg() mock for the i-th rail
+ */
+void
+configure_mr_reg(int i, int ret)
+{
+	expect_value(rpma_mr_reg, peer, MOCK_RAIL_PEER(i));
+	will_return(rpma_mr_reg, ret);
+}
+
+/*
+ * configure_mr_dereg -- configure the rpma_mr_dereg() mock for the i-th rail
+ */
+void
+configure_mr_dereg(int i, int ret)
+{
+	expect_value(rpma_mr_dereg, mr, MOCK_RAIL_MR(i));
+	will_return(rpma_mr_dereg, ret);
+}
+
+/*
+ * configure_remote_delete -- configure the rpma_mr_remote_delete() mock for the i-th rail
+ */
+void
+configure_remote_delete(int i, int ret)
+{
+	expect_value(rpma_mr_remote_delete, mr, MOCK_RAIL_MR_REMOTE(i));
+	will_return(rpma_mr_remote_delete, ret);
+}
+
+/*
+ * configure_stripe_connect -- configure the rpma_stripe_connect() mock for the i-th rail
+ */
+void
+configure_stripe_connect(int i, int ret)
+{
+	expect_value(rpma_stripe_connect, peer, MOCK_RAIL_PEER(i));
+	expect_value(rpma_stripe_connect, addr, Addrs[i]);
+	will_return(rpma_stripe_connect, ret);
+}
+
+/*
+ * configure_stripe_delete -- configure the rpma_stripe_delete() mock for the i-th rail
+ */
+void
+configure_stripe_delete(int i, int ret)
+{
+	expect_value(rpma_stripe_delete, stripe, MOCK_RAIL_STRIPE(i));
+	will_return(rpma_stripe_delete, ret);
+}
+
+/*
+ * configure_part -- configure the rpma_stripe_read() or rpma_stripe_write() mock for a part
+ * posted over the i-th rail
+ */
+void
+configure_part(enum ibv_wc_opcode opcode, int i, size_t offset, size_t len, int ret)
+{
+	if (opcode == IBV_WC_RDMA_READ) {
+		expect_value(rpma_stripe_read, stripe, MOCK_RAIL_STRIPE(i));
+		expect_value(rpma_stripe_read, dst, MOCK_RAIL_MR(i));
+		expect_value(rpma_stripe_read, dst_offset, MOCK_LOCAL_OFFSET + offset);
+		expect_value(rpma_stripe_read, src, MOCK_RAIL_MR_REMOTE(i));
+		expect_value(rpma_stripe_read, src_offset, MOCK_REMOTE_OFFSET + offset);
+		expect_value(rpma_stripe_read, len, len);
+		expect_value(rpma_stripe_read, flags, RPMA_F_COMPLETION_ALWAYS);
+		will_return(rpma_stripe_read, ret);
+	} else {
+		expect_value(rpma_stripe_write, stripe, MOCK_RAIL_STRIPE(i));
+		expect_value(rpma_stripe_write, dst, MOCK_RAIL_MR_REMOTE(i));
+		expect_value(rpma_stripe_write, dst_offset, MOCK_REMOTE_OFFSET + offset);
+		expect_value(rpma_stripe_write, src, MOCK_RAIL_MR(i));
+		expect_value(rpma_stripe_write, src_offset, MOCK_LOCAL_OFFSET + offset);
+		expect_value(rpma_stripe_write, len, len);
+		expect_value(rpma_stripe_write, flags, RPMA_F_COMPLETION_ALWAYS);
+		will_return(rpma_stripe_write, ret);
+	}
+}
+
+/*
+ * configure_get_wc -- configure the rpma_stripe_get_wc() mock of the i-th rail
+ */
+void
+configure_get_wc(int i, int ret, struct ibv_wc *wc)
+{
+	expect_value(rpma_stripe_get_wc, stripe, MOCK_RAIL_STRIPE(i));
+	will_return(rpma_stripe_get_wc, ret);
+	if (ret == MOCK_OK)
+		will_return(rpma_stripe_get_wc, wc);
+}
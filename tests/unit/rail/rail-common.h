@@ -0,0 +1,65 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail-common.h -- the multi-rail unit tests common definitions
+ */
+
+#ifndef RAIL_COMMON_H
+#define RAIL_COMMON_H
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "test-common.h"
+
+#define MOCK_NUM_RAILS		3
+#define MOCK_CONNS_PER_RAIL	2
+#define MOCK_CHUNK_SIZE		16
+/* the number of chunks the striped connection of a rail can hold */
+#define MOCK_RAIL_CAPACITY	4
+/* the size of the mocked descriptor of a memory region of a rail */
+#define MOCK_DESC_SIZE		4
+/* the size of the combined descriptor */
+#define MOCK_RAIL_DESC_SIZE	(1 + MOCK_NUM_RAILS * (1 + MOCK_DESC_SIZE))
+
+#define MOCK_RAIL_PTR		((void *)0xA0A0)
+#define MOCK_RAIL_SIZE		((size_t)0x1000)
+#define MOCK_RAIL_USAGE		(RPMA_MR_USAGE_READ_DST | RPMA_MR_USAGE_WRITE_SRC)
+#define MOCK_REMOTE_OFFSET	((size_t)0x2000)
+
+#define MOCK_RAIL_CTX(i)	((struct ibv_context *)(uintptr_t)(0xA000 + (i)))
+#define MOCK_RAIL_PEER(i)	((struct rpma_peer *)(uintptr_t)(0xA100 + (i)))
+#define MOCK_RAIL_MR(i)		((struct rpma_mr_local *)(uintptr_t)(0xA200 + (i)))
+#define MOCK_RAIL_MR_REMOTE(i)	((struct rpma_mr_remote *)(uintptr_t)(0xA300 + (i)))
+#define MOCK_RAIL_STRIPE(i)	((struct rpma_stripe *)(uintptr_t)(0xA400 + (i)))
+
+struct rail_test_state {
+	struct rpma_rail_peer *rpeer;
+	struct rpma_rail_mr *mr;
+	struct rpma_rail_mr_remote *remote;
+	struct rpma_rail_conn *rconn;
+};
+
+extern struct ibv_context *Ibv_ctxs[MOCK_NUM_RAILS];
+extern const char *Addrs[MOCK_NUM_RAILS];
+/* the number of chunks every rail can take right now */
+extern uint64_t Free_chunks[MOCK_NUM_RAILS];
+/* the op_context of the last part posted */
+extern const void *Part_op_context;
+
+int setup__rail_peer_new(void **rstate_ptr);
+int teardown__rail_peer_delete(void **rstate_ptr);
+int setup__rail_conn_connect(void **rstate_ptr);
+int teardown__rail_conn_delete(void **rstate_ptr);
+
+void configure_peer_new(int i, int ret);
+void configure_peer_delete(int i, int ret);
+void configure_mr_reg(int i, int ret);
+void configure_mr_dereg(int i, int ret);
+void configure_remote_delete(int i, int ret);
+void configure_stripe_connect(int i, int ret);
+void configure_stripe_delete(int i, int ret);
+void configure_part(enum ibv_wc_opcode opcode, int i, size_t offset, size_t len, int ret);
+void configure_get_wc(int i, int ret, struct ibv_wc *wc);
+
+#endif /* RAIL_COMMON_H */
@@ -0,0 +1,469 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail-conn.c -- the multi-rail connection unit tests
+ *
+ * APIs covered:
+ * - rpma_rail_conn_connect()
+ * - rpma_rail_conn_delete()
+ * - rpma_rail_conn_is_failed()
+ * - rpma_rail_read()
+ * - rpma_rail_write()
+ */
+
+#include "rail-common.h"
+
+/* the length of an operation split into a part of two chunks per rail */
+#define MOCK_SPLIT_LEN	(MOCK_NUM_RAILS * 2 * MOCK_CHUNK_SIZE)
+/* the length of an operation fitting into a single chunk */
+#define MOCK_SMALL_LEN	10
+
+/*
+ * connect__invalid -- invalid arguments
+ */
+static void
+connect__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	struct rpma_rail_conn *rconn = NULL;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_conn_connect(NULL, Addrs, MOCK_PORT, NULL, NULL, MOCK_CONNS_PER_RAIL,
+			MOCK_CHUNK_SIZE, &rconn);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_connect(rstate->rpeer, NULL, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rconn);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, NULL, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rconn);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL, 0,
+			MOCK_CHUNK_SIZE, &rconn);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, 0, &rconn);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(rconn);
+}
+
+/*
+ * connect__malloc_ERRNO -- malloc() fails
+ */
+static void
+connect__malloc_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_rail_conn *rconn = NULL;
+	int ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rconn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rconn);
+}
+
+/*
+ * connect__malloc_ops_ERRNO -- malloc() of the operation descriptors fails so all the rails
+ * are disconnected
+ */
+static void
+connect__malloc_ops_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_stripe_connect(i, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+	for (int i = MOCK_NUM_RAILS - 1; i >= 0; i--)
+		configure_stripe_delete(i, MOCK_OK);
+
+	/* run test */
+	struct rpma_rail_conn *rconn = NULL;
+	int ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rconn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rconn);
+}
+
+/*
+ * connect__stripe_connect_ERRNO -- connecting the last rail fails so the other rails are
+ * disconnected
+ */
+static void
+connect__stripe_connect_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	for (int i = 0; i < MOCK_NUM_RAILS - 1; i++)
+		configure_stripe_connect(i, MOCK_OK);
+	configure_stripe_connect(MOCK_NUM_RAILS - 1, RPMA_E_PROVIDER);
+	for (int i = MOCK_NUM_RAILS - 2; i >= 0; i--)
+		configure_stripe_delete(i, MOCK_OK);
+
+	/* run test */
+	struct rpma_rail_conn *rconn = NULL;
+	int ret = rpma_rail_conn_connect(rstate->rpeer, Addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rconn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rconn);
+}
+
+/*
+ * connect__null_addr -- the address of the last rail is NULL so the other rails are
+ * disconnected
+ */
+static void
+connect__null_addr(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	const char *addrs[MOCK_NUM_RAILS] = {Addrs[0], Addrs[1], NULL};
+
+	/* configure mocks */
+	will_return_count(__wrap__test_malloc, MOCK_OK, 2);
+	for (int i = 0; i < MOCK_NUM_RAILS - 1; i++)
+		configure_stripe_connect(i, MOCK_OK);
+	for (int i = MOCK_NUM_RAILS - 2; i >= 0; i--)
+		configure_stripe_delete(i, MOCK_OK);
+
+	/* run test */
+	struct rpma_rail_conn *rconn = NULL;
+	int ret = rpma_rail_conn_connect(rstate->rpeer, addrs, MOCK_PORT, NULL, NULL,
+			MOCK_CONNS_PER_RAIL, MOCK_CHUNK_SIZE, &rconn);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(rconn);
+}
+
+/*
+ * connect__success -- all the rails are connected and disconnected
+ */
+static void
+connect__success(void **unused)
+{
+	/*
+	 * The thing is done by setup__rail_conn_connect()
+	 * and teardown__rail_conn_delete().
+	 */
+}
+
+/*
+ * delete__invalid -- NULL rconn_ptr is invalid
+ */
+static void
+delete__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_rail_conn_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * is_failed__invalid -- invalid arguments
+ */
+static void
+is_failed__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	bool failed;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_conn_is_failed(NULL, 0, &failed);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_is_failed(rstate->rconn, 0, NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_is_failed(rstate->rconn, -1, &failed);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_conn_is_failed(rstate->rconn, MOCK_NUM_RAILS, &failed);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * assert_failed -- verify which rails have failed
+ */
+static void
+assert_failed(struct rpma_rail_conn *rconn, int failed_rail)
+{
+	for (int i = 0; i < MOCK_NUM_RAILS; i++) {
+		bool failed = true;
+		int ret = rpma_rail_conn_is_failed(rconn, i, &failed);
+		assert_int_equal(ret, MOCK_OK);
+		assert_int_equal(failed, i == failed_rail);
+	}
+}
+
+/*
+ * read_write__invalid -- invalid arguments
+ */
+static void
+read_write__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_read(NULL, rstate->mr, 0, rstate->remote, 0, MOCK_SMALL_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_read(rstate->rconn, NULL, 0, rstate->remote, 0, MOCK_SMALL_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_read(rstate->rconn, rstate->mr, 0, NULL, 0, MOCK_SMALL_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_read(rstate->rconn, rstate->mr, 0, rstate->remote, 0, 0,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_write(rstate->rconn, rstate->remote, 0, rstate->mr, 0, MOCK_SMALL_LEN,
+			0, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_write(NULL, rstate->remote, 0, rstate->mr, 0, MOCK_SMALL_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * read__split -- the read is split into equal parts over all the rails
+ */
+static void
+read__split(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	size_t part_len = MOCK_SPLIT_LEN / MOCK_NUM_RAILS;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_part(IBV_WC_RDMA_READ, i, (size_t)i * part_len, part_len, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SPLIT_LEN, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * write__round_robin -- the writes fitting into a single chunk are posted round-robin
+ * over the rails
+ */
+static void
+write__round_robin(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	for (int i = 0; i < MOCK_NUM_RAILS + 1; i++) {
+		/* configure mocks */
+		configure_part(IBV_WC_RDMA_WRITE, i % MOCK_NUM_RAILS, 0, MOCK_SMALL_LEN,
+				MOCK_OK);
+
+		/* run test */
+		int ret = rpma_rail_write(rstate->rconn, rstate->remote, MOCK_REMOTE_OFFSET,
+				rstate->mr, MOCK_LOCAL_OFFSET, MOCK_SMALL_LEN,
+				RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+	}
+}
+
+/*
+ * write__skip_full -- the rail without room for a part is skipped
+ */
+static void
+write__skip_full(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	Free_chunks[0] = 0;
+	configure_part(IBV_WC_RDMA_WRITE, 1, 0, MOCK_CHUNK_SIZE, MOCK_OK);
+	configure_part(IBV_WC_RDMA_WRITE, 2, MOCK_CHUNK_SIZE, MOCK_CHUNK_SIZE, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_write(rstate->rconn, rstate->remote, MOCK_REMOTE_OFFSET, rstate->mr,
+			MOCK_LOCAL_OFFSET, 2 * MOCK_CHUNK_SIZE, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * read__again -- not all the parts fit into the rails right now
+ */
+static void
+read__again(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	Free_chunks[1] = 1;
+
+	/* run test */
+	int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SPLIT_LEN, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_AGAIN);
+}
+
+/*
+ * read__too_big -- a part of the read consists of more chunks than a rail can hold
+ */
+static void
+read__too_big(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	size_t len = (MOCK_NUM_RAILS * MOCK_RAIL_CAPACITY + 1) * MOCK_CHUNK_SIZE;
+
+	/* run test */
+	int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, len, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * read__post_ERRNO -- posting the part over the second rail fails so the rail fails and
+ * the next read is split over the other rails
+ */
+static void
+read__post_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	size_t part_len = MOCK_SPLIT_LEN / MOCK_NUM_RAILS;
+
+	/* configure mocks */
+	configure_part(IBV_WC_RDMA_READ, 0, 0, part_len, MOCK_OK);
+	configure_part(IBV_WC_RDMA_READ, 1, part_len, part_len, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SPLIT_LEN, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_failed(rstate->rconn, 1);
+
+	/* configure mocks */
+	part_len = MOCK_SPLIT_LEN / (MOCK_NUM_RAILS - 1);
+	configure_part(IBV_WC_RDMA_READ, 2, 0, part_len, MOCK_OK);
+	configure_part(IBV_WC_RDMA_READ, 0, part_len, part_len, MOCK_OK);
+
+	/* run test */
+	ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SPLIT_LEN, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * read__all_failed -- all the rails have failed
+ */
+static void
+read__all_failed(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	for (int i = 0; i < MOCK_NUM_RAILS; i++) {
+		/* configure mocks */
+		configure_part(IBV_WC_RDMA_READ, i, 0, MOCK_SMALL_LEN, RPMA_E_PROVIDER);
+
+		/* run test */
+		int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET,
+				rstate->remote, MOCK_REMOTE_OFFSET, MOCK_SMALL_LEN,
+				RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_PROVIDER);
+	}
+
+	/* run test */
+	int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SMALL_LEN, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_rail_conn_connect() unit tests */
+		cmocka_unit_test_setup_teardown(connect__invalid,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(connect__malloc_ERRNO,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(connect__malloc_ops_ERRNO,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(connect__stripe_connect_ERRNO,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(connect__null_addr,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(connect__success,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+
+		/* rpma_rail_conn_delete() unit tests */
+		cmocka_unit_test(delete__invalid),
+
+		/* rpma_rail_conn_is_failed() unit tests */
+		cmocka_unit_test_setup_teardown(is_failed__invalid,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+
+		/* rpma_rail_read/_write() unit tests */
+		cmocka_unit_test_setup_teardown(read_write__invalid,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(read__split,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(write__round_robin,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(write__skip_full,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(read__again,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(read__too_big,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(read__post_ERRNO,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(read__all_failed,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail-get_wc.c -- the rpma_rail_get_wc() unit tests
+ *
+ * API covered:
+ * - rpma_rail_get_wc()
+ */
+
+#include "rail-common.h"
+
+/* the length of an operation split into a part of one chunk per rail */
+#define MOCK_SPLIT_LEN	(MOCK_NUM_RAILS * MOCK_CHUNK_SIZE)
+
+/*
+ * wc_part -- a completion of a part of the last operation posted
+ */
+static struct ibv_wc
+wc_part(enum ibv_wc_status status)
+{
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)Part_op_context;
+	wc.status = status;
+	wc.opcode = IBV_WC_RDMA_READ;
+
+	return wc;
+}
+
+/*
+ * post_split_read -- post a read split over all the rails
+ */
+static void
+post_split_read(struct rail_test_state *rstate, int flags)
+{
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_part(IBV_WC_RDMA_READ, i, (size_t)i * MOCK_CHUNK_SIZE, MOCK_CHUNK_SIZE,
+				MOCK_OK);
+
+	int ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SPLIT_LEN, flags, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * get_wc__invalid -- NULL rconn or wc is invalid
+ */
+static void
+get_wc__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	struct ibv_wc wc;
+
+	/* run test */
+	int ret = rpma_rail_get_wc(NULL, &wc);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_get_wc(rstate->rconn, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_wc__no_completion -- none of the rails has a completion
+ */
+static void
+get_wc__no_completion(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_get_wc(i, RPMA_E_NO_COMPLETION, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_rail_get_wc(rstate->rconn, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_COMPLETION);
+}
+
+/*
+ * get_wc__get_wc_ERRNO -- rpma_stripe_get_wc() fails
+ */
+static void
+get_wc__get_wc_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_get_wc(0, RPMA_E_NO_COMPLETION, NULL);
+	configure_get_wc(1, RPMA_E_PROVIDER, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_rail_get_wc(rstate->rconn, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * get_wc__success -- the operation is reported when all of its parts complete
+ */
+static void
+get_wc__success(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	post_split_read(rstate, RPMA_F_COMPLETION_ALWAYS);
+
+	/* configure mocks */
+	struct ibv_wc wc_success = wc_part(IBV_WC_SUCCESS);
+	configure_get_wc(0, MOCK_OK, &wc_success);
+	configure_get_wc(1, RPMA_E_NO_COMPLETION, NULL);
+	configure_get_wc(2, MOCK_OK, &wc_success);
+	configure_get_wc(0, RPMA_E_NO_COMPLETION, NULL);
+	configure_get_wc(1, MOCK_OK, &wc_success);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_rail_get_wc(rstate->rconn, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(wc.wr_id, MOCK_OP_CONTEXT);
+	assert_int_equal(wc.status, IBV_WC_SUCCESS);
+	assert_int_equal(wc.opcode, IBV_WC_RDMA_READ);
+	assert_int_equal(wc.byte_len, MOCK_SPLIT_LEN);
+}
+
+/*
+ * get_wc__on_error_success -- the successful operation posted with
+ * RPMA_F_COMPLETION_ON_ERROR is not reported
+ */
+static void
+get_wc__on_error_success(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	post_split_read(rstate, RPMA_F_COMPLETION_ON_ERROR);
+
+	/* configure mocks */
+	struct ibv_wc wc_success = wc_part(IBV_WC_SUCCESS);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_get_wc(i, MOCK_OK, &wc_success);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_get_wc(i, RPMA_E_NO_COMPLETION, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_rail_get_wc(rstate->rconn, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_COMPLETION);
+}
+
+/*
+ * get_wc__rail_failed -- a part fails so the operation is reported with the error and its
+ * rail is not used anymore
+ */
+static void
+get_wc__rail_failed(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	post_split_read(rstate, RPMA_F_COMPLETION_ON_ERROR);
+
+	/* configure mocks */
+	struct ibv_wc wc_success = wc_part(IBV_WC_SUCCESS);
+	struct ibv_wc wc_error = wc_part(IBV_WC_REM_ACCESS_ERR);
+	configure_get_wc(0, MOCK_OK, &wc_success);
+	configure_get_wc(1, MOCK_OK, &wc_error);
+	configure_get_wc(2, MOCK_OK, &wc_success);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_rail_get_wc(rstate->rconn, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(wc.wr_id, MOCK_OP_CONTEXT);
+	assert_int_equal(wc.status, IBV_WC_REM_ACCESS_ERR);
+
+	bool failed = false;
+	ret = rpma_rail_conn_is_failed(rstate->rconn, 1, &failed);
+	assert_int_equal(ret, MOCK_OK);
+	assert_true(failed);
+	ret = rpma_rail_conn_is_failed(rstate->rconn, 0, &failed);
+	assert_int_equal(ret, MOCK_OK);
+	assert_false(failed);
+
+	/* configure mocks */
+	size_t part_len = 2 * MOCK_CHUNK_SIZE;
+	configure_part(IBV_WC_RDMA_READ, 0, 0, part_len, MOCK_OK);
+	configure_part(IBV_WC_RDMA_READ, 2, part_len, MOCK_SPLIT_LEN - part_len, MOCK_OK);
+
+	/* run test */
+	ret = rpma_rail_read(rstate->rconn, rstate->mr, MOCK_LOCAL_OFFSET, rstate->remote,
+			MOCK_REMOTE_OFFSET, MOCK_SPLIT_LEN, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_rail_get_wc() unit tests */
+		cmocka_unit_test_setup_teardown(get_wc__invalid,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(get_wc__no_completion,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(get_wc__get_wc_ERRNO,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(get_wc__success,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(get_wc__on_error_success,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+		cmocka_unit_test_setup_teardown(get_wc__rail_failed,
+			setup__rail_conn_connect, teardown__rail_conn_delete),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,363 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail-mr.c -- the multi-rail memory regions unit tests
+ *
+ * APIs covered:
+ * - rpma_rail_mr_reg()
+ * - rpma_rail_mr_dereg()
+ * - rpma_rail_mr_get_descriptor_size()
+ * - rpma_rail_mr_get_descriptor()
+ * - rpma_rail_mr_remote_from_descriptor()
+ * - rpma_rail_mr_remote_delete()
+ */
+
+#include <string.h>
+
+#include "rail-common.h"
+
+/*
+ * setup__mr_reg -- prepare a multi-rail peer and a memory region registered with every rail
+ */
+static int
+setup__mr_reg(void **rstate_ptr)
+{
+	setup__rail_peer_new(rstate_ptr);
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_mr_reg(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE,
+			&rstate->mr);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(rstate->mr);
+
+	return 0;
+}
+
+/*
+ * teardown__mr_dereg -- deregister the memory region and delete the multi-rail peer
+ */
+static int
+teardown__mr_dereg(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_mr_dereg(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_mr_dereg(&rstate->mr);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(rstate->mr);
+
+	return teardown__rail_peer_delete(rstate_ptr);
+}
+
+/*
+ * mr_reg__invalid -- invalid arguments
+ */
+static void
+mr_reg__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	struct rpma_rail_mr *mr = NULL;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_mr_reg(NULL, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE, &mr);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_reg(rstate->rpeer, NULL, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE, &mr);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, 0, MOCK_RAIL_USAGE, &mr);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, 0, &mr);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE,
+			NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(mr);
+}
+
+/*
+ * mr_reg__malloc_ERRNO -- malloc() fails
+ */
+static void
+mr_reg__malloc_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_rail_mr *mr = NULL;
+	int ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE,
+			&mr);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(mr);
+}
+
+/*
+ * mr_reg__mr_reg_ERRNO -- rpma_mr_reg() of the last rail fails so the memory region is
+ * deregistered from the other rails
+ */
+static void
+mr_reg__mr_reg_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	for (int i = 0; i < MOCK_NUM_RAILS - 1; i++)
+		configure_mr_reg(i, MOCK_OK);
+	configure_mr_reg(MOCK_NUM_RAILS - 1, RPMA_E_PROVIDER);
+	for (int i = MOCK_NUM_RAILS - 2; i >= 0; i--)
+		configure_mr_dereg(i, MOCK_OK);
+
+	/* run test */
+	struct rpma_rail_mr *mr = NULL;
+	int ret = rpma_rail_mr_reg(rstate->rpeer, MOCK_RAIL_PTR, MOCK_RAIL_SIZE, MOCK_RAIL_USAGE,
+			&mr);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(mr);
+}
+
+/*
+ * mr_dereg__invalid -- NULL mr_ptr is invalid
+ */
+static void
+mr_dereg__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_rail_mr_dereg(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * mr_dereg__mr_dereg_ERRNO -- rpma_mr_dereg() of the first rail fails but the memory region
+ * is deregistered from all the rails
+ */
+static void
+mr_dereg__mr_dereg_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_mr_dereg(0, RPMA_E_PROVIDER);
+	for (int i = 1; i < MOCK_NUM_RAILS; i++)
+		configure_mr_dereg(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_mr_dereg(&rstate->mr);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rstate->mr);
+
+	teardown__rail_peer_delete(rstate_ptr);
+}
+
+/*
+ * descriptor__invalid -- invalid arguments
+ */
+static void
+descriptor__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	char desc[MOCK_RAIL_DESC_SIZE];
+	size_t desc_size;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_mr_get_descriptor_size(NULL, &desc_size);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_get_descriptor_size(rstate->mr, NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_get_descriptor(NULL, desc);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_get_descriptor(rstate->mr, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * descriptor__success -- the remote memory regions of all the rails are created from
+ * the combined descriptor
+ */
+static void
+descriptor__success(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	size_t desc_size = 0;
+	int ret = rpma_rail_mr_get_descriptor_size(rstate->mr, &desc_size);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(desc_size, MOCK_RAIL_DESC_SIZE);
+
+	char desc[MOCK_RAIL_DESC_SIZE];
+	ret = rpma_rail_mr_get_descriptor(rstate->mr, desc);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal((uint8_t)desc[0], MOCK_NUM_RAILS);
+
+	will_return(__wrap__test_malloc, MOCK_OK);
+	struct rpma_rail_mr_remote *remote = NULL;
+	ret = rpma_rail_mr_remote_from_descriptor(desc, desc_size, &remote);
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(remote);
+
+	/* the remote memory regions are deleted in the order of the rails */
+	for (int i = 0; i < MOCK_NUM_RAILS; i++)
+		configure_remote_delete(i, MOCK_OK);
+	ret = rpma_rail_mr_remote_delete(&remote);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(remote);
+}
+
+/*
+ * remote__invalid -- invalid arguments
+ */
+static void
+remote__invalid(void **unused)
+{
+	char desc[MOCK_RAIL_DESC_SIZE] = {0};
+	struct rpma_rail_mr_remote *remote = NULL;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_mr_remote_from_descriptor(NULL, sizeof(desc), &remote);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_remote_from_descriptor(desc, 0, &remote);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_mr_remote_from_descriptor(desc, sizeof(desc), NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* the descriptor does not describe any rail */
+	ret = rpma_rail_mr_remote_from_descriptor(desc, sizeof(desc), &remote);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(remote);
+}
+
+/*
+ * remote__truncated -- the descriptor of the last rail is truncated so the remote memory
+ * regions of the other rails are deleted
+ */
+static void
+remote__truncated(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	char desc[MOCK_RAIL_DESC_SIZE];
+	int ret = rpma_rail_mr_get_descriptor(rstate->mr, desc);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	for (int i = MOCK_NUM_RAILS - 2; i >= 0; i--)
+		configure_remote_delete(i, MOCK_OK);
+
+	/* run test */
+	struct rpma_rail_mr_remote *remote = NULL;
+	ret = rpma_rail_mr_remote_from_descriptor(desc, sizeof(desc) - 1, &remote);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(remote);
+}
+
+/*
+ * remote__malloc_ERRNO -- malloc() fails
+ */
+static void
+remote__malloc_ERRNO(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	char desc[MOCK_RAIL_DESC_SIZE];
+	int ret = rpma_rail_mr_get_descriptor(rstate->mr, desc);
+	assert_int_equal(ret, MOCK_OK);
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_rail_mr_remote *remote = NULL;
+	ret = rpma_rail_mr_remote_from_descriptor(desc, sizeof(desc), &remote);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(remote);
+}
+
+/*
+ * remote_delete__invalid -- NULL mr_ptr is invalid
+ */
+static void
+remote_delete__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_rail_mr_remote_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_rail_mr_reg() unit tests */
+		cmocka_unit_test_setup_teardown(mr_reg__invalid,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(mr_reg__malloc_ERRNO,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(mr_reg__mr_reg_ERRNO,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+
+		/* rpma_rail_mr_dereg() unit tests */
+		cmocka_unit_test(mr_dereg__invalid),
+		cmocka_unit_test_setup_teardown(mr_dereg__mr_dereg_ERRNO, setup__mr_reg, NULL),
+
+		/* rpma_rail_mr_get_descriptor*() unit tests */
+		cmocka_unit_test_setup_teardown(descriptor__invalid,
+			setup__mr_reg, teardown__mr_dereg),
+		cmocka_unit_test_setup_teardown(descriptor__success,
+			setup__mr_reg, teardown__mr_dereg),
+
+		/* rpma_rail_mr_remote_from_descriptor() unit tests */
+		cmocka_unit_test(remote__invalid),
+		cmocka_unit_test_setup_teardown(remote__truncated,
+			setup__mr_reg, teardown__mr_dereg),
+		cmocka_unit_test_setup_teardown(remote__malloc_ERRNO,
+			setup__mr_reg, teardown__mr_dereg),
+
+		/* rpma_rail_mr_remote_delete() unit tests */
+		cmocka_unit_test(remote_delete__invalid),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
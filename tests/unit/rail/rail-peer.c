@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rail-peer.c -- the rpma_rail_peer_new/_delete/_get_peer() unit tests
+ *
+ * APIs covered:
+ * - rpma_rail_peer_new()
+ * - rpma_rail_peer_delete()
+ * - rpma_rail_peer_get_peer()
+ */
+
+#include "rail-common.h"
+
+/*
+ * new__invalid -- invalid arguments
+ */
+static void
+new__invalid(void **unused)
+{
+	struct rpma_rail_peer *rpeer = NULL;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_peer_new(NULL, MOCK_NUM_RAILS, &rpeer);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_peer_new(Ibv_ctxs, MOCK_NUM_RAILS, NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_peer_new(Ibv_ctxs, 0, &rpeer);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_peer_new(Ibv_ctxs, UINT8_MAX + 1, &rpeer);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(rpeer);
+}
+
+/*
+ * new__malloc_ERRNO -- malloc() fails
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_rail_peer *rpeer = NULL;
+	int ret = rpma_rail_peer_new(Ibv_ctxs, MOCK_NUM_RAILS, &rpeer);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rpeer);
+}
+
+/*
+ * new__peer_new_ERRNO -- rpma_peer_new() of the last rail fails so the peers of the other
+ * rails are deleted
+ */
+static void
+new__peer_new_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	for (int i = 0; i < MOCK_NUM_RAILS - 1; i++)
+		configure_peer_new(i, MOCK_OK);
+	configure_peer_new(MOCK_NUM_RAILS - 1, RPMA_E_PROVIDER);
+	for (int i = MOCK_NUM_RAILS - 2; i >= 0; i--)
+		configure_peer_delete(i, MOCK_OK);
+
+	/* run test */
+	struct rpma_rail_peer *rpeer = NULL;
+	int ret = rpma_rail_peer_new(Ibv_ctxs, MOCK_NUM_RAILS, &rpeer);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rpeer);
+}
+
+/*
+ * delete__invalid -- NULL rpeer_ptr is invalid
+ */
+static void
+delete__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_rail_peer_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * delete__null_rpeer -- NULL *rpeer_ptr is valid
+ */
+static void
+delete__null_rpeer(void **unused)
+{
+	/* run test */
+	struct rpma_rail_peer *rpeer = NULL;
+	int ret = rpma_rail_peer_delete(&rpeer);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * delete__peer_delete_ERRNO -- rpma_peer_delete() of the first rail fails but all the peers
+ * are deleted
+ */
+static void
+delete__peer_delete_ERRNO(void **unused)
+{
+	struct rail_test_state *rstate;
+	setup__rail_peer_new((void **)&rstate);
+
+	/* configure mocks */
+	configure_peer_delete(0, RPMA_E_PROVIDER);
+	for (int i = 1; i < MOCK_NUM_RAILS; i++)
+		configure_peer_delete(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rail_peer_delete(&rstate->rpeer);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rstate->rpeer);
+}
+
+/*
+ * new__success -- the peers of all the rails are created and deleted
+ */
+static void
+new__success(void **unused)
+{
+	/*
+	 * The thing is done by setup__rail_peer_new()
+	 * and teardown__rail_peer_delete().
+	 */
+}
+
+/*
+ * get_peer__invalid -- invalid arguments
+ */
+static void
+get_peer__invalid(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+	struct rpma_peer *peer = NULL;
+	int ret;
+
+	/* run test */
+	ret = rpma_rail_peer_get_peer(NULL, 0, &peer);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_peer_get_peer(rstate->rpeer, 0, NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_peer_get_peer(rstate->rpeer, -1, &peer);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_rail_peer_get_peer(rstate->rpeer, MOCK_NUM_RAILS, &peer);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(peer);
+}
+
+/*
+ * get_peer__success -- get the peer of every rail
+ */
+static void
+get_peer__success(void **rstate_ptr)
+{
+	struct rail_test_state *rstate = *rstate_ptr;
+
+	for (int i = 0; i < MOCK_NUM_RAILS; i++) {
+		/* run test */
+		struct rpma_peer *peer = NULL;
+		int ret = rpma_rail_peer_get_peer(rstate->rpeer, i, &peer);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_ptr_equal(peer, MOCK_RAIL_PEER(i));
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_rail_peer_new() unit tests */
+		cmocka_unit_test(new__invalid),
+		cmocka_unit_test(new__malloc_ERRNO),
+		cmocka_unit_test(new__peer_new_ERRNO),
+		cmocka_unit_test_setup_teardown(new__success,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+
+		/* rpma_rail_peer_delete() unit tests */
+		cmocka_unit_test(delete__invalid),
+		cmocka_unit_test(delete__null_rpeer),
+		cmocka_unit_test(delete__peer_delete_ERRNO),
+
+		/* rpma_rail_peer_get_peer() unit tests */
+		cmocka_unit_test_setup_teardown(get_peer__invalid,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+		cmocka_unit_test_setup_teardown(get_peer__success,
+			setup__rail_peer_new, teardown__rail_peer_delete),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
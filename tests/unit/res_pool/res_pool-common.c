@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool-common.c -- the res_pool unit tests common functions
+ */
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rpma-cq.h"
+#include "res_pool-common.h"
+
+struct ibv_cq Pool_ibv_cq = {.cqe = MOCK_CQE};
+struct ibv_cq Pool_ibv_rcq = {.cqe = MOCK_RCQE};
+
+/*
+ * setup__res_pool_new -- create an empty pool
+ */
+int
+setup__res_pool_new(void **pool_ptr)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+
+	/* prepare an object */
+	struct rpma_res_pool *pool = NULL;
+	int ret = rpma_res_pool_new(MOCK_POOL_SIZE, &pool);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(pool);
+
+	*pool_ptr = pool;
+
+	return 0;
+}
+
+/*
+ * teardown__res_pool_delete -- delete the pool (all resources have to be taken out of it)
+ */
+int
+teardown__res_pool_delete(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* delete the object */
+	int ret = rpma_res_pool_delete(&pool);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(pool);
+
+	return 0;
+}
+
+/*
+ * configure_put_cqs -- configure mocks for keeping MOCK_RPMA_CQ (and MOCK_RPMA_RCQ)
+ */
+void
+configure_put_cqs(bool with_rcq)
+{
+	expect_value(rpma_cq_reset, cq, MOCK_RPMA_CQ);
+	will_return(rpma_cq_reset, MOCK_OK);
+	if (with_rcq) {
+		expect_value(rpma_cq_reset, cq, MOCK_RPMA_RCQ);
+		will_return(rpma_cq_reset, MOCK_OK);
+	}
+	will_return(__wrap__test_malloc, MOCK_OK);
+}
+
+/*
+ * configure_delete_cqs -- configure mocks for deleting the kept CQ set
+ */
+void
+configure_delete_cqs(bool with_rcq, bool with_channel)
+{
+	if (with_rcq) {
+		expect_value(rpma_cq_delete, *cq_ptr, MOCK_RPMA_RCQ);
+		will_return(rpma_cq_delete, MOCK_OK);
+	} else {
+		expect_value(rpma_cq_delete, *cq_ptr, NULL);
+		will_return(rpma_cq_delete, MOCK_OK);
+	}
+	expect_value(rpma_cq_delete, *cq_ptr, MOCK_RPMA_CQ);
+	will_return(rpma_cq_delete, MOCK_OK);
+	if (with_channel)
+		will_return(ibv_destroy_comp_channel, MOCK_OK);
+}
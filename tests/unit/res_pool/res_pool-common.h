@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool-common.h -- the res_pool unit tests common definitions
+ */
+
+#ifndef RES_POOL_COMMON_H
+#define RES_POOL_COMMON_H
+
+#include <stdbool.h>
+
+#include "test-common.h"
+#include "res_pool.h"
+
+#define MOCK_POOL_SIZE	2
+#define MOCK_CQE	16
+#define MOCK_RCQE	32
+
+/* the IBV CQs returned by rpma_cq_get_ibv_cq() for MOCK_RPMA_CQ and MOCK_RPMA_RCQ */
+extern struct ibv_cq Pool_ibv_cq;
+extern struct ibv_cq Pool_ibv_rcq;
+
+int setup__res_pool_new(void **pool_ptr);
+int teardown__res_pool_delete(void **pool_ptr);
+
+void configure_put_cqs(bool with_rcq);
+void configure_delete_cqs(bool with_rcq, bool with_channel);
+
+#endif /* RES_POOL_COMMON_H */
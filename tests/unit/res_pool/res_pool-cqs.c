@@ -0,0 +1,280 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool-cqs.c -- the res_pool CQ sets unit tests
+ *
+ * APIs covered:
+ * - rpma_res_pool_take_cqs()
+ * - rpma_res_pool_put_cqs()
+ */
+
+#include <errno.h>
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rpma-cq.h"
+#include "res_pool-common.h"
+
+/*
+ * configure_get_ibv_cq -- configure mocks for reading the size of the CQ
+ */
+static void
+configure_get_ibv_cq(struct rpma_cq *cq, struct ibv_cq *ibv_cq)
+{
+	expect_value(rpma_cq_get_ibv_cq, cq, cq);
+	will_return(rpma_cq_get_ibv_cq, ibv_cq);
+}
+
+/*
+ * put_cqs__reset_E_PROVIDER -- rpma_cq_reset() of the main CQ fails
+ */
+static void
+put_cqs__reset_E_PROVIDER(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_cq_reset, cq, MOCK_RPMA_CQ);
+	will_return(rpma_cq_reset, RPMA_E_PROVIDER);
+
+	/* run test */
+	bool kept = rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, MOCK_RPMA_RCQ, NULL);
+
+	/* verify the results */
+	assert_false(kept);
+}
+
+/*
+ * put_cqs__rcq_reset_E_PROVIDER -- rpma_cq_reset() of the receive CQ fails
+ */
+static void
+put_cqs__rcq_reset_E_PROVIDER(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_cq_reset, cq, MOCK_RPMA_CQ);
+	will_return(rpma_cq_reset, MOCK_OK);
+	expect_value(rpma_cq_reset, cq, MOCK_RPMA_RCQ);
+	will_return(rpma_cq_reset, RPMA_E_PROVIDER);
+
+	/* run test */
+	bool kept = rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, MOCK_RPMA_RCQ, NULL);
+
+	/* verify the results */
+	assert_false(kept);
+}
+
+/*
+ * put_cqs__malloc_ERRNO -- malloc() fails with ENOMEM
+ */
+static void
+put_cqs__malloc_ERRNO(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_cq_reset, cq, MOCK_RPMA_CQ);
+	will_return(rpma_cq_reset, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	bool kept = rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, NULL, NULL);
+
+	/* verify the results */
+	assert_false(kept);
+}
+
+/*
+ * put_cqs__full -- the CQ set is not kept when all slots are occupied
+ */
+static void
+put_cqs__full(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i <= MOCK_POOL_SIZE; i++)
+		configure_put_cqs(false);
+
+	/* run test */
+	for (int i = 0; i < MOCK_POOL_SIZE; i++)
+		assert_true(rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, NULL, NULL));
+	bool kept = rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, NULL, NULL);
+
+	/* verify the results */
+	assert_false(kept);
+
+	/* the kept CQ sets will be deleted along with the pool */
+	for (int i = 0; i < MOCK_POOL_SIZE; i++)
+		configure_delete_cqs(false, false);
+}
+
+/*
+ * take_cqs__empty -- no CQ set is kept
+ */
+static void
+take_cqs__empty(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* run test */
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	struct ibv_comp_channel *channel = NULL;
+	bool taken = rpma_res_pool_take_cqs(pool, MOCK_CQE, 0, false, &cq, &rcq, &channel);
+
+	/* verify the results */
+	assert_false(taken);
+	assert_null(cq);
+}
+
+/*
+ * take_cqs__shared_mismatch -- the kept CQ set has a different kind of the completion channel
+ */
+static void
+take_cqs__shared_mismatch(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* keep a CQ set with the shared completion channel */
+	configure_put_cqs(false);
+	assert_true(rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, NULL, MOCK_COMP_CHANNEL));
+
+	/* run test */
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	struct ibv_comp_channel *channel = NULL;
+	bool taken = rpma_res_pool_take_cqs(pool, MOCK_CQE, 0, false, &cq, &rcq, &channel);
+
+	/* verify the results */
+	assert_false(taken);
+	assert_null(cq);
+
+	/* the CQ set is still kept */
+	configure_delete_cqs(false, true);
+}
+
+/*
+ * take_cqs__cqe_too_big -- the kept CQ is too small
+ */
+static void
+take_cqs__cqe_too_big(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* keep a CQ set */
+	configure_put_cqs(false);
+	assert_true(rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, NULL, NULL));
+
+	/* configure mocks */
+	configure_get_ibv_cq(MOCK_RPMA_CQ, &Pool_ibv_cq);
+
+	/* run test */
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	struct ibv_comp_channel *channel = NULL;
+	bool taken = rpma_res_pool_take_cqs(pool, MOCK_CQE + 1, 0, false, &cq, &rcq, &channel);
+
+	/* verify the results */
+	assert_false(taken);
+	assert_null(cq);
+
+	/* the CQ set is still kept */
+	configure_delete_cqs(false, false);
+}
+
+/*
+ * take_cqs__rcq_mismatch -- the presence of the receive CQ differs
+ */
+static void
+take_cqs__rcq_mismatch(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* keep a CQ set with a receive CQ */
+	configure_put_cqs(true);
+	assert_true(rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, MOCK_RPMA_RCQ, NULL));
+
+	/* configure mocks */
+	configure_get_ibv_cq(MOCK_RPMA_CQ, &Pool_ibv_cq);
+
+	/* run test */
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	struct ibv_comp_channel *channel = NULL;
+	bool taken = rpma_res_pool_take_cqs(pool, MOCK_CQE, 0, false, &cq, &rcq, &channel);
+
+	/* verify the results */
+	assert_false(taken);
+	assert_null(cq);
+
+	/* the CQ set is still kept */
+	configure_delete_cqs(true, false);
+}
+
+/*
+ * put_take_cqs__success -- the kept CQ set is taken by a request of not bigger sizes
+ */
+static void
+put_take_cqs__success(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* keep a CQ set */
+	configure_put_cqs(true);
+	assert_true(rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, MOCK_RPMA_RCQ, MOCK_COMP_CHANNEL));
+
+	/* configure mocks */
+	configure_get_ibv_cq(MOCK_RPMA_CQ, &Pool_ibv_cq);
+	configure_get_ibv_cq(MOCK_RPMA_RCQ, &Pool_ibv_rcq);
+
+	/* run test */
+	struct rpma_cq *cq = NULL;
+	struct rpma_cq *rcq = NULL;
+	struct ibv_comp_channel *channel = NULL;
+	bool taken = rpma_res_pool_take_cqs(pool, MOCK_CQE / 2, MOCK_RCQE, true,
+			&cq, &rcq, &channel);
+
+	/* verify the results */
+	assert_true(taken);
+	assert_ptr_equal(cq, MOCK_RPMA_CQ);
+	assert_ptr_equal(rcq, MOCK_RPMA_RCQ);
+	assert_ptr_equal(channel, MOCK_COMP_CHANNEL);
+
+	/* the pool is empty now */
+	assert_false(rpma_res_pool_take_cqs(pool, MOCK_CQE, MOCK_RCQE, true,
+			&cq, &rcq, &channel));
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_res_pool_put_cqs() unit tests */
+		cmocka_unit_test_setup_teardown(put_cqs__reset_E_PROVIDER,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(put_cqs__rcq_reset_E_PROVIDER,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(put_cqs__malloc_ERRNO,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(put_cqs__full,
+			setup__res_pool_new, teardown__res_pool_delete),
+
+		/* rpma_res_pool_take_cqs() unit tests */
+		cmocka_unit_test_setup_teardown(take_cqs__empty,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(take_cqs__shared_mismatch,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(take_cqs__cqe_too_big,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(take_cqs__rcq_mismatch,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(put_take_cqs__success,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
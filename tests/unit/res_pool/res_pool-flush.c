@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool-flush.c -- the res_pool flushing objects unit tests
+ *
+ * APIs covered:
+ * - rpma_res_pool_take_flush()
+ * - rpma_res_pool_put_flush()
+ */
+
+#include "cmocka_headers.h"
+#include "mocks-rpma-flush.h"
+#include "res_pool-common.h"
+
+#define MOCK_FLUSH_2	(struct rpma_flush *)0xF1A2
+#define MOCK_FLUSH_3	(struct rpma_flush *)0xF1A3
+
+/*
+ * take_flush__empty -- no flushing object is kept
+ */
+static void
+take_flush__empty(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* run test */
+	struct rpma_flush *flush = NULL;
+	bool taken = rpma_res_pool_take_flush(pool, &flush);
+
+	/* verify the results */
+	assert_false(taken);
+	assert_null(flush);
+}
+
+/*
+ * put_take_flush__success -- the kept flushing objects are taken out of the pool
+ */
+static void
+put_take_flush__success(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* run test */
+	assert_true(rpma_res_pool_put_flush(pool, MOCK_FLUSH));
+	assert_true(rpma_res_pool_put_flush(pool, MOCK_FLUSH_2));
+
+	struct rpma_flush *flush = NULL;
+	struct rpma_flush *flush_2 = NULL;
+	assert_true(rpma_res_pool_take_flush(pool, &flush));
+	assert_true(rpma_res_pool_take_flush(pool, &flush_2));
+
+	/* verify the results */
+	assert_ptr_equal(flush, MOCK_FLUSH);
+	assert_ptr_equal(flush_2, MOCK_FLUSH_2);
+	assert_false(rpma_res_pool_take_flush(pool, &flush));
+}
+
+/*
+ * put_flush__full -- the flushing object is not kept when all slots are occupied
+ */
+static void
+put_flush__full(void **pool_ptr)
+{
+	struct rpma_res_pool *pool = *pool_ptr;
+
+	/* run test */
+	assert_true(rpma_res_pool_put_flush(pool, MOCK_FLUSH));
+	assert_true(rpma_res_pool_put_flush(pool, MOCK_FLUSH_2));
+	bool kept = rpma_res_pool_put_flush(pool, MOCK_FLUSH_3);
+
+	/* verify the results */
+	assert_false(kept);
+
+	/* empty the pool */
+	struct rpma_flush *flush = NULL;
+	for (int i = 0; i < MOCK_POOL_SIZE; i++) {
+		assert_true(rpma_res_pool_take_flush(pool, &flush));
+		assert_ptr_not_equal(flush, MOCK_FLUSH_3);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_res_pool_take_flush() unit tests */
+		cmocka_unit_test_setup_teardown(take_flush__empty,
+			setup__res_pool_new, teardown__res_pool_delete),
+
+		/* rpma_res_pool_put_flush() unit tests */
+		cmocka_unit_test_setup_teardown(put_take_flush__success,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test_setup_teardown(put_flush__full,
+			setup__res_pool_new, teardown__res_pool_delete),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * res_pool-new_delete.c -- the res_pool new/delete unit tests
+ *
+ * APIs covered:
+ * - rpma_res_pool_new()
+ * - rpma_res_pool_delete()
+ */
+
+#include <errno.h>
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "mocks-rpma-cq.h"
+#include "mocks-rpma-flush.h"
+#include "res_pool-common.h"
+
+/*
+ * new__malloc_ERRNO -- malloc() fails with ENOMEM
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_res_pool *pool = NULL;
+	int ret = rpma_res_pool_new(MOCK_POOL_SIZE, &pool);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(pool);
+}
+
+/*
+ * delete__pool_NULL -- there is nothing to delete
+ */
+static void
+delete__pool_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_res_pool *pool = NULL;
+	int ret = rpma_res_pool_delete(&pool);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(pool);
+}
+
+/*
+ * new_delete__success -- an empty pool is created and deleted
+ */
+static void
+new_delete__success(void **unused)
+{
+	struct rpma_res_pool *pool = NULL;
+
+	setup__res_pool_new((void **)&pool);
+	teardown__res_pool_delete((void **)&pool);
+}
+
+/*
+ * delete__resources_kept -- all the kept resources are deleted along with the pool
+ */
+static void
+delete__resources_kept(void **unused)
+{
+	struct rpma_res_pool *pool = NULL;
+	setup__res_pool_new((void **)&pool);
+
+	/* keep a CQ set and a flushing object */
+	configure_put_cqs(true);
+	assert_true(rpma_res_pool_put_cqs(pool, MOCK_RPMA_CQ, MOCK_RPMA_RCQ, MOCK_COMP_CHANNEL));
+	assert_true(rpma_res_pool_put_flush(pool, MOCK_FLUSH));
+
+	/* configure mocks */
+	configure_delete_cqs(true, true);
+	will_return(rpma_flush_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_res_pool_delete(&pool);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(pool);
+}
+
+/*
+ * delete__flush_delete_E_PROVIDER -- rpma_flush_delete() fails with RPMA_E_PROVIDER
+ * but the pool is deleted anyway
+ */
+static void
+delete__flush_delete_E_PROVIDER(void **unused)
+{
+	struct rpma_res_pool *pool = NULL;
+	setup__res_pool_new((void **)&pool);
+
+	/* keep a flushing object */
+	assert_true(rpma_res_pool_put_flush(pool, MOCK_FLUSH));
+
+	/* configure mocks */
+	will_return(rpma_flush_delete, RPMA_E_PROVIDER);
+	will_return(rpma_flush_delete, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_res_pool_delete(&pool);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(pool);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_res_pool_new() unit tests */
+		cmocka_unit_test(new__malloc_ERRNO),
+
+		/* rpma_res_pool_delete() unit tests */
+		cmocka_unit_test(delete__pool_NULL),
+		cmocka_unit_test(delete__resources_kept),
+		cmocka_unit_test(delete__flush_delete_E_PROVIDER),
+
+		/* rpma_res_pool_new()/_delete() lifecycle */
+		cmocka_unit_test(new_delete__success),
+		cmocka_unit_test(NULL)
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,337 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-attach.c -- the rpma_ring_attach() unit tests
+ *
+ * APIs covered:
+ * - rpma_ring_attach()
+ */
+
+#include "ring-common.h"
+
+/*
+ * configure_remote -- configure mocks of getting the remote ring of the given size
+ */
+static void
+configure_remote(size_t size)
+{
+	expect_value(rpma_mr_remote_from_descriptor, desc, MOCK_RING_DESC);
+	expect_value(rpma_mr_remote_from_descriptor, desc_size, MOCK_RING_DESC_SIZE);
+	will_return(rpma_mr_remote_from_descriptor, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_mr_remote_get_size, mr, MOCK_RPMA_MR_REMOTE);
+	will_return(rpma_mr_remote_get_size, size);
+}
+
+/*
+ * attach__ring_NULL -- NULL ring is invalid
+ */
+static void
+attach__ring_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ring_attach(NULL, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * attach__conn_NULL -- NULL conn is invalid
+ */
+static void
+attach__conn_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, NULL, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * attach__desc_NULL -- NULL desc is invalid
+ */
+static void
+attach__desc_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, NULL, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * attach__already_attached -- the ring can be attached only once
+ */
+static void
+attach__already_attached(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * attach__get_rq_size_ERRNO -- rpma_conn_get_rq_size() fails
+ */
+static void
+attach__get_rq_size_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_ring_get_rq_size(0, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * attach__recv_num_exceeds_rq_size -- the receive queue cannot hold recv_num receives
+ * (nothing is posted)
+ */
+static void
+attach__recv_num_exceeds_rq_size(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_ring_get_rq_size(MOCK_RECV_NUM - 1, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * attach__from_descriptor_ERRNO -- rpma_mr_remote_from_descriptor() fails
+ */
+static void
+attach__from_descriptor_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+	expect_value(rpma_mr_remote_from_descriptor, desc, MOCK_RING_DESC);
+	expect_value(rpma_mr_remote_from_descriptor, desc_size, MOCK_RING_DESC_SIZE);
+	will_return(rpma_mr_remote_from_descriptor, NULL);
+	will_return(rpma_mr_remote_from_descriptor, RPMA_E_INVAL);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * attach__remote_size_invalid -- the remote memory region is not a valid ring
+ */
+static void
+attach__remote_size_invalid(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+	size_t sizes[] = {0, 64, MOCK_RING_SIZE, MOCK_RING_MR_SIZE + 1};
+
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		/* configure mocks */
+		configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+		configure_remote(sizes[i]);
+		expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+
+		/* run test */
+		int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC,
+				MOCK_RING_DESC_SIZE, MOCK_RECV_NUM);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_INVAL);
+	}
+}
+
+/*
+ * attach__malloc_ERRNO -- malloc() of the staging buffer fails
+ */
+static void
+attach__malloc_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+	configure_remote(MOCK_RING_MR_SIZE);
+	will_return(__wrap__test_malloc, ENOMEM);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+}
+
+/*
+ * attach__mr_reg_ERRNO -- rpma_mr_reg() of the staging buffer fails
+ */
+static void
+attach__mr_reg_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	void *tx = NULL;
+	configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+	configure_remote(MOCK_RING_MR_SIZE);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_TX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_WRITE_SRC);
+	will_return(rpma_mr_reg, &tx);
+	will_return(rpma_mr_reg, NULL);
+	will_return(rpma_mr_reg, RPMA_E_PROVIDER);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * attach__recv_first_ERRNO -- the first rpma_recv() fails so there is nothing to flush
+ */
+static void
+attach__recv_first_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	void *tx = NULL;
+	configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+	configure_remote(MOCK_RING_MR_SIZE);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_TX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_WRITE_SRC);
+	will_return(rpma_mr_reg, &tx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL_TX);
+	configure_ring_recv(RPMA_E_PROVIDER);
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL_TX);
+	will_return(rpma_mr_dereg, MOCK_OK);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * attach__recv_ERRNO -- rpma_recv() fails after a receive has been posted, so the connection
+ * is disconnected to flush it
+ */
+static void
+attach__recv_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	void *tx = NULL;
+	configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+	configure_remote(MOCK_RING_MR_SIZE);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_TX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_WRITE_SRC);
+	will_return(rpma_mr_reg, &tx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL_TX);
+	configure_ring_recv(MOCK_OK);
+	configure_ring_recv(RPMA_E_PROVIDER);
+	expect_value(rpma_conn_disconnect, conn, MOCK_CONN);
+	will_return(rpma_conn_disconnect, MOCK_OK);
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL_TX);
+	will_return(rpma_mr_dereg, MOCK_OK);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * attach__success -- happy day scenario
+ */
+static void
+attach__success(void **rstate_ptr)
+{
+	/*
+	 * The thing is done by setup__ring_attach()
+	 * and teardown__ring_detach_delete().
+	 */
+}
+
+static const struct CMUnitTest tests_attach[] = {
+	/* rpma_ring_attach() unit tests */
+	cmocka_unit_test(attach__ring_NULL),
+	cmocka_unit_test_setup_teardown(attach__conn_NULL,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__desc_NULL,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__already_attached,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(attach__get_rq_size_ERRNO,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__recv_num_exceeds_rq_size,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__from_descriptor_ERRNO,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__remote_size_invalid,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__malloc_ERRNO,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__mr_reg_ERRNO,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__recv_first_ERRNO,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__recv_ERRNO,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(attach__success,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_attach, NULL, NULL);
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-common.c -- the rpma_ring unit tests common functions
+ */
+
+#include "ring-common.h"
+
+/*
+ * setup__ring_new -- prepare a valid, not attached ring object
+ */
+int
+setup__ring_new(void **rstate_ptr)
+{
+	static struct ring_test_state rstate;
+	memset(&rstate, 0, sizeof(rstate));
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RING_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_WRITE_DST);
+	will_return(rpma_mr_reg, &rstate.rx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL);
+
+	/* run test */
+	int ret = rpma_ring_new(MOCK_PEER, MOCK_RING_SIZE, &rstate.ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(rstate.ring);
+
+	*rstate_ptr = &rstate;
+
+	return 0;
+}
+
+/*
+ * teardown__ring_delete -- delete the not attached ring object
+ */
+int
+teardown__ring_delete(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_delete(&rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(rstate->ring);
+
+	return 0;
+}
+
+/*
+ * setup__ring_attach -- prepare a valid ring object attached to MOCK_CONN
+ */
+int
+setup__ring_attach(void **rstate_ptr)
+{
+	setup__ring_new(rstate_ptr);
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_ring_get_rq_size(MOCK_RECV_NUM, MOCK_OK);
+	expect_value(rpma_mr_remote_from_descriptor, desc, MOCK_RING_DESC);
+	expect_value(rpma_mr_remote_from_descriptor, desc_size, MOCK_RING_DESC_SIZE);
+	will_return(rpma_mr_remote_from_descriptor, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_mr_remote_get_size, mr, MOCK_RPMA_MR_REMOTE);
+	will_return(rpma_mr_remote_get_size, MOCK_RING_MR_SIZE);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_TX_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_WRITE_SRC);
+	will_return(rpma_mr_reg, &rstate->tx);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL_TX);
+	for (int i = 0; i < MOCK_RECV_NUM; i++)
+		configure_ring_recv(MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_attach(rstate->ring, MOCK_CONN, MOCK_RING_DESC, MOCK_RING_DESC_SIZE,
+			MOCK_RECV_NUM);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+
+	return 0;
+}
+
+/*
+ * teardown__ring_detach_delete -- delete the attached ring object
+ */
+int
+teardown__ring_detach_delete(void **rstate_ptr)
+{
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL_TX);
+	will_return(rpma_mr_dereg, MOCK_OK);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+
+	return teardown__ring_delete(rstate_ptr);
+}
+
+/*
+ * configure_ring_get_rq_size -- configure the rpma_conn_get_rq_size() mock
+ */
+void
+configure_ring_get_rq_size(uint32_t rq_size, int ret)
+{
+	expect_value(rpma_conn_get_rq_size, conn, MOCK_CONN);
+	will_return(rpma_conn_get_rq_size, ret);
+	if (ret == MOCK_OK)
+		will_return(rpma_conn_get_rq_size, rq_size);
+}
+
+/*
+ * configure_ring_recv -- configure the rpma_recv() mock for a zero-length receive
+ */
+void
+configure_ring_recv(int ret)
+{
+	expect_value(rpma_recv, conn, MOCK_CONN);
+	expect_value(rpma_recv, dst, NULL);
+	expect_value(rpma_recv, offset, 0);
+	expect_value(rpma_recv, len, 0);
+	expect_any(rpma_recv, op_context);
+	will_return(rpma_recv, ret);
+}
+
+/*
+ * ring_wc -- a completion of a write with immediate data carrying the head
+ */
+struct ibv_wc
+ring_wc(uint32_t head)
+{
+	struct ibv_wc wc = {0};
+	wc.opcode = IBV_WC_RECV_RDMA_WITH_IMM;
+	wc.wc_flags = IBV_WC_WITH_IMM;
+	wc.imm_data = htonl(head);
+
+	return wc;
+}
@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-common.h -- the rpma_ring unit tests common definitions
+ */
+
+#ifndef RING_COMMON_H
+#define RING_COMMON_H
+
+#include <arpa/inet.h>
+#include <endian.h>
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "test-common.h"
+
+#define MOCK_RING_SIZE		1024
+#define MOCK_RING_MR_SIZE	(MOCK_RING_SIZE + 64) /* the ring + the credit area */
+#define MOCK_TX_MR_SIZE		(MOCK_RING_SIZE + sizeof(uint64_t))
+#define MOCK_RPMA_MR_LOCAL_TX	(struct rpma_mr_local *)0xC421
+#define MOCK_RPMA_MR_REMOTE	(struct rpma_mr_remote *)0xC412
+#define MOCK_RING_DESC		(void *)0xC418
+#define MOCK_RING_DESC_SIZE	21
+#define MOCK_RECV_NUM		4
+#define MOCK_MSG_LEN		100
+
+struct ring_test_state {
+	void *rx; /* the receive ring allocated by rpma_ring_new() */
+	void *tx; /* the staging buffer allocated by rpma_ring_attach() */
+	struct rpma_ring *ring;
+};
+
+int setup__ring_new(void **rstate_ptr);
+int teardown__ring_delete(void **rstate_ptr);
+int setup__ring_attach(void **rstate_ptr);
+int teardown__ring_detach_delete(void **rstate_ptr);
+
+void configure_ring_get_rq_size(uint32_t rq_size, int ret);
+void configure_ring_recv(int ret);
+struct ibv_wc ring_wc(uint32_t head);
+
+#endif /* RING_COMMON_H */
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-descriptor.c -- the ring descriptor unit tests
+ *
+ * APIs covered:
+ * - rpma_ring_get_descriptor()
+ * - rpma_ring_get_descriptor_size()
+ */
+
+#include "ring-common.h"
+
+/*
+ * get_desc_size__ring_NULL -- NULL ring is invalid
+ */
+static void
+get_desc_size__ring_NULL(void **unused)
+{
+	/* run test */
+	size_t desc_size = 0;
+	int ret = rpma_ring_get_descriptor_size(NULL, &desc_size);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(desc_size, 0);
+}
+
+/*
+ * get_desc_size__desc_size_NULL -- NULL desc_size is invalid
+ */
+static void
+get_desc_size__desc_size_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_get_descriptor_size(rstate->ring, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_desc_size__success -- happy day scenario
+ */
+static void
+get_desc_size__success(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_get_descriptor_size, mr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_get_descriptor_size, MOCK_RING_DESC_SIZE);
+
+	/* run test */
+	size_t desc_size = 0;
+	int ret = rpma_ring_get_descriptor_size(rstate->ring, &desc_size);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(desc_size, MOCK_RING_DESC_SIZE);
+}
+
+/*
+ * get_desc__ring_NULL -- NULL ring is invalid
+ */
+static void
+get_desc__ring_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ring_get_descriptor(NULL, MOCK_RING_DESC);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_desc__desc_NULL -- NULL desc is invalid
+ */
+static void
+get_desc__desc_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_get_descriptor(rstate->ring, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_desc__success -- happy day scenario
+ */
+static void
+get_desc__success(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_get_descriptor, mr, MOCK_RPMA_MR_LOCAL);
+	expect_value(rpma_mr_get_descriptor, desc, MOCK_RING_DESC);
+	will_return(rpma_mr_get_descriptor, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_get_descriptor(rstate->ring, MOCK_RING_DESC);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_descriptor[] = {
+	/* rpma_ring_get_descriptor_size() unit tests */
+	cmocka_unit_test(get_desc_size__ring_NULL),
+	cmocka_unit_test_setup_teardown(get_desc_size__desc_size_NULL,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(get_desc_size__success,
+		setup__ring_new, teardown__ring_delete),
+
+	/* rpma_ring_get_descriptor() unit tests */
+	cmocka_unit_test(get_desc__ring_NULL),
+	cmocka_unit_test_setup_teardown(get_desc__desc_NULL,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(get_desc__success,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_descriptor, NULL, NULL);
+}
@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-new.c -- the rpma_ring_new/_delete() unit tests
+ *
+ * APIs covered:
+ * - rpma_ring_new()
+ * - rpma_ring_delete()
+ */
+
+#include "ring-common.h"
+
+/*
+ * new__peer_NULL -- NULL peer is invalid
+ */
+static void
+new__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_new(NULL, MOCK_RING_SIZE, &ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(ring);
+}
+
+/*
+ * new__ring_ptr_NULL -- NULL ring_ptr is invalid
+ */
+static void
+new__ring_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ring_new(MOCK_PEER, MOCK_RING_SIZE, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new__size_not_power_of_two -- the size has to be a power of two
+ */
+static void
+new__size_not_power_of_two(void **unused)
+{
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_new(MOCK_PEER, MOCK_RING_SIZE + 1, &ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(ring);
+}
+
+/*
+ * new__size_too_small -- the size has to be at least 64 bytes
+ */
+static void
+new__size_too_small(void **unused)
+{
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_new(MOCK_PEER, 32, &ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(ring);
+}
+
+/*
+ * new__malloc_ERRNO -- malloc() fails
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_new(MOCK_PEER, MOCK_RING_SIZE, &ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(ring);
+}
+
+/*
+ * new__malloc_rx_ERRNO -- malloc() of the receive ring fails
+ */
+static void
+new__malloc_rx_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_new(MOCK_PEER, MOCK_RING_SIZE, &ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(ring);
+}
+
+/*
+ * new__mr_reg_ERRNO -- rpma_mr_reg() fails
+ */
+static void
+new__mr_reg_ERRNO(void **unused)
+{
+	/* configure mocks */
+	void *rx = NULL;
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RING_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_WRITE_DST);
+	will_return(rpma_mr_reg, &rx);
+	will_return(rpma_mr_reg, NULL);
+	will_return(rpma_mr_reg, RPMA_E_PROVIDER);
+
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_new(MOCK_PEER, MOCK_RING_SIZE, &ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(ring);
+}
+
+/*
+ * new__success -- happy day scenario
+ */
+static void
+new__success(void **rstate_ptr)
+{
+	/*
+	 * The thing is done by setup__ring_new()
+	 * and teardown__ring_delete().
+	 */
+}
+
+/*
+ * delete__ring_ptr_NULL -- NULL ring_ptr is invalid
+ */
+static void
+delete__ring_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ring_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * delete__ring_NULL -- NULL *ring_ptr should exit quickly
+ */
+static void
+delete__ring_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_ring *ring = NULL;
+	int ret = rpma_ring_delete(&ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * delete__mr_dereg_ERRNO -- rpma_mr_dereg() fails
+ */
+static void
+delete__mr_dereg_ERRNO(void **unused)
+{
+	struct ring_test_state *rstate;
+	setup__ring_new((void **)&rstate);
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, RPMA_E_PROVIDER);
+	will_return(rpma_mr_dereg, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_ring_delete(&rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rstate->ring);
+}
+
+/*
+ * delete__attached_tx_mr_dereg_ERRNO -- rpma_mr_dereg() of the staging buffer fails
+ */
+static void
+delete__attached_tx_mr_dereg_ERRNO(void **unused)
+{
+	struct ring_test_state *rstate;
+	setup__ring_attach((void **)&rstate);
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL_TX);
+	will_return(rpma_mr_dereg, RPMA_E_PROVIDER);
+	will_return(rpma_mr_dereg, MOCK_ERRNO);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_delete(&rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rstate->ring);
+}
+
+static const struct CMUnitTest tests_new[] = {
+	/* rpma_ring_new() unit tests */
+	cmocka_unit_test(new__peer_NULL),
+	cmocka_unit_test(new__ring_ptr_NULL),
+	cmocka_unit_test(new__size_not_power_of_two),
+	cmocka_unit_test(new__size_too_small),
+	cmocka_unit_test(new__malloc_ERRNO),
+	cmocka_unit_test(new__malloc_rx_ERRNO),
+	cmocka_unit_test(new__mr_reg_ERRNO),
+	cmocka_unit_test_setup_teardown(new__success, setup__ring_new, teardown__ring_delete),
+
+	/* rpma_ring_delete() unit tests */
+	cmocka_unit_test(delete__ring_ptr_NULL),
+	cmocka_unit_test(delete__ring_NULL),
+	cmocka_unit_test(delete__mr_dereg_ERRNO),
+	cmocka_unit_test(delete__attached_tx_mr_dereg_ERRNO),
+	cmocka_unit_test_setup_teardown(new__success, setup__ring_attach,
+		teardown__ring_detach_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_new, NULL, NULL);
+}
@@ -0,0 +1,381 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-recv.c -- the rpma_ring_recv/_release() unit tests
+ *
+ * APIs covered:
+ * - rpma_ring_recv()
+ * - rpma_ring_release()
+ */
+
+#include "ring-common.h"
+
+/*
+ * recv_ok -- receive a message notified with the given head and verify it
+ */
+static void
+recv_ok(struct ring_test_state *rstate, uint32_t head, size_t exp_offset, size_t exp_len)
+{
+	/* configure mocks */
+	struct ibv_wc wc = ring_wc(head);
+	configure_ring_recv(MOCK_OK);
+
+	/* run test */
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal(msg, (char *)rstate->rx + exp_offset);
+	assert_int_equal(len, exp_len);
+}
+
+/*
+ * configure_write_back -- configure the rpma_write() mock returning the consumed space
+ */
+static void
+configure_write_back(int ret)
+{
+	expect_value(rpma_write, conn, MOCK_CONN);
+	expect_value(rpma_write, dst, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_write, dst_offset, MOCK_RING_SIZE);
+	expect_value(rpma_write, src, MOCK_RPMA_MR_LOCAL_TX);
+	expect_value(rpma_write, src_offset, MOCK_RING_SIZE);
+	expect_value(rpma_write, len, sizeof(uint64_t));
+	expect_value(rpma_write, flags, RPMA_F_COMPLETION_ON_ERROR);
+	expect_value(rpma_write, op_context, NULL);
+	will_return(rpma_write, ret);
+}
+
+/*
+ * recv__ring_NULL -- NULL ring is invalid
+ */
+static void
+recv__ring_NULL(void **unused)
+{
+	/* run test */
+	struct ibv_wc wc = ring_wc(MOCK_MSG_LEN);
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(NULL, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(msg);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__not_attached -- the ring has to be attached
+ */
+static void
+recv__not_attached(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	struct ibv_wc wc = ring_wc(MOCK_MSG_LEN);
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * recv__wc_NULL -- NULL wc is invalid
+ */
+static void
+recv__wc_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, NULL, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * recv__msg_ptr_NULL -- NULL msg_ptr is invalid
+ */
+static void
+recv__msg_ptr_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	struct ibv_wc wc = ring_wc(MOCK_MSG_LEN);
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, &wc, NULL, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * recv__len_ptr_NULL -- NULL len_ptr is invalid
+ */
+static void
+recv__len_ptr_NULL(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	struct ibv_wc wc = ring_wc(MOCK_MSG_LEN);
+	const void *msg = NULL;
+	int ret = rpma_ring_recv(rstate->ring, &wc, &msg, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * recv__opcode_invalid -- only writes with immediate data carry ring messages
+ */
+static void
+recv__opcode_invalid(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	struct ibv_wc wc = ring_wc(MOCK_MSG_LEN);
+	wc.opcode = IBV_WC_RECV;
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* run test */
+	wc = ring_wc(MOCK_MSG_LEN);
+	wc.wc_flags = 0;
+	ret = rpma_ring_recv(rstate->ring, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(msg);
+}
+
+/*
+ * recv__head_invalid -- the head cannot be further than the size of the ring
+ */
+static void
+recv__head_invalid(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	struct ibv_wc wc = ring_wc(MOCK_RING_SIZE + 1);
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(msg);
+}
+
+/*
+ * recv__recv_ERRNO -- rpma_recv() fails
+ */
+static void
+recv__recv_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	struct ibv_wc wc = ring_wc(MOCK_MSG_LEN);
+	configure_ring_recv(RPMA_E_PROVIDER);
+
+	/* run test */
+	const void *msg = NULL;
+	size_t len = 0;
+	int ret = rpma_ring_recv(rstate->ring, &wc, &msg, &len);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(msg);
+
+	/* the tail has not moved */
+	recv_ok(rstate, MOCK_MSG_LEN, 0, MOCK_MSG_LEN);
+}
+
+/*
+ * recv__success -- happy day scenario
+ */
+static void
+recv__success(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	recv_ok(rstate, MOCK_MSG_LEN, 0, MOCK_MSG_LEN);
+	recv_ok(rstate, 2 * MOCK_MSG_LEN, MOCK_MSG_LEN, MOCK_MSG_LEN);
+	/* a zero-length message */
+	recv_ok(rstate, 2 * MOCK_MSG_LEN, 2 * MOCK_MSG_LEN, 0);
+}
+
+/*
+ * recv__wrap_around -- a message not fitting before the end of the ring starts at its beginning
+ */
+static void
+recv__wrap_around(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+	size_t len = 250;
+
+	for (size_t i = 0; i < 4; i++)
+		recv_ok(rstate, (i + 1) * len, i * len, len);
+
+	/* 24 bytes at the end of the ring are skipped */
+	recv_ok(rstate, MOCK_RING_SIZE + MOCK_MSG_LEN, 0, MOCK_MSG_LEN);
+}
+
+/*
+ * release__ring_NULL -- NULL ring is invalid
+ */
+static void
+release__ring_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ring_release(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * release__not_attached -- the ring has to be attached
+ */
+static void
+release__not_attached(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_release(rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * release__below_threshold -- the space is not returned until a quarter of the ring is released
+ */
+static void
+release__below_threshold(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	recv_ok(rstate, MOCK_MSG_LEN, 0, MOCK_MSG_LEN);
+
+	/* run test */
+	int ret = rpma_ring_release(rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * release__write_ERRNO -- rpma_write() fails
+ */
+static void
+release__write_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	recv_ok(rstate, MOCK_RING_SIZE / 4, 0, MOCK_RING_SIZE / 4);
+
+	/* configure mocks */
+	configure_write_back(RPMA_E_PROVIDER);
+	/* the space is not returned yet so the write-back is repeated */
+	configure_write_back(MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_release(rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	/* run test */
+	ret = rpma_ring_release(rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * release__success -- happy day scenario
+ */
+static void
+release__success(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	recv_ok(rstate, MOCK_RING_SIZE / 4, 0, MOCK_RING_SIZE / 4);
+
+	/* configure mocks */
+	configure_write_back(MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_release(rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	uint64_t *credit_out = (uint64_t *)((char *)rstate->tx + MOCK_RING_SIZE);
+	assert_int_equal(le64toh(*credit_out), MOCK_RING_SIZE / 4);
+
+	/* the space has been already returned */
+	ret = rpma_ring_release(rstate->ring);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_recv[] = {
+	/* rpma_ring_recv() unit tests */
+	cmocka_unit_test(recv__ring_NULL),
+	cmocka_unit_test_setup_teardown(recv__not_attached,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(recv__wc_NULL,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__msg_ptr_NULL,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__len_ptr_NULL,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__opcode_invalid,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__head_invalid,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__recv_ERRNO,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__success,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(recv__wrap_around,
+		setup__ring_attach, teardown__ring_detach_delete),
+
+	/* rpma_ring_release() unit tests */
+	cmocka_unit_test(release__ring_NULL),
+	cmocka_unit_test_setup_teardown(release__not_attached,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(release__below_threshold,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(release__write_ERRNO,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(release__success,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_recv, NULL, NULL);
+}
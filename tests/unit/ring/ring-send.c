@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * ring-send.c -- the rpma_ring_send() unit tests
+ *
+ * APIs covered:
+ * - rpma_ring_send()
+ */
+
+#include "ring-common.h"
+
+static char Msg[MOCK_RING_SIZE];
+
+/*
+ * configure_write_with_imm -- configure the rpma_write_with_imm() mock
+ */
+static void
+configure_write_with_imm(size_t offset, size_t len, uint32_t imm, int ret)
+{
+	expect_value(rpma_write_with_imm, conn, MOCK_CONN);
+	expect_value(rpma_write_with_imm, dst, len ? MOCK_RPMA_MR_REMOTE : NULL);
+	expect_value(rpma_write_with_imm, dst_offset, offset);
+	expect_value(rpma_write_with_imm, src, len ? MOCK_RPMA_MR_LOCAL_TX : NULL);
+	expect_value(rpma_write_with_imm, src_offset, offset);
+	expect_value(rpma_write_with_imm, len, len);
+	expect_value(rpma_write_with_imm, flags, MOCK_FLAGS);
+	expect_value(rpma_write_with_imm, imm, imm);
+	expect_value(rpma_write_with_imm, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_write_with_imm, ret);
+}
+
+/*
+ * set_credit -- simulate the write-back of the consumed space by the peer
+ */
+static void
+set_credit(struct ring_test_state *rstate, uint64_t credit)
+{
+	uint64_t *credit_in = (uint64_t *)((char *)rstate->rx + MOCK_RING_SIZE);
+	*credit_in = htole64(credit);
+}
+
+/*
+ * send__ring_NULL -- NULL ring is invalid
+ */
+static void
+send__ring_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_ring_send(NULL, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__not_attached -- the ring has to be attached
+ */
+static void
+send__not_attached(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__flags_0 -- flags == 0 is invalid
+ */
+static void
+send__flags_0(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, 0, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__msg_NULL_len_not_0 -- NULL msg and not 0 len is invalid
+ */
+static void
+send__msg_NULL_len_not_0(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, NULL, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__len_too_big -- a message cannot be longer than a quarter of the remote ring
+ */
+static void
+send__len_too_big(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, Msg, MOCK_RING_SIZE / 4 + 1, MOCK_FLAGS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__write_with_imm_ERRNO -- rpma_write_with_imm() fails
+ */
+static void
+send__write_with_imm_ERRNO(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_write_with_imm(0, MOCK_MSG_LEN, MOCK_MSG_LEN, RPMA_E_PROVIDER);
+	/* the head has not moved */
+	configure_write_with_imm(0, MOCK_MSG_LEN, MOCK_MSG_LEN, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	/* run test */
+	ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__success -- happy day scenario
+ */
+static void
+send__success(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	memset(Msg, 'A', MOCK_MSG_LEN);
+	configure_write_with_imm(0, MOCK_MSG_LEN, MOCK_MSG_LEN, MOCK_OK);
+	configure_write_with_imm(MOCK_MSG_LEN, MOCK_MSG_LEN, 2 * MOCK_MSG_LEN, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_memory_equal(rstate->tx, Msg, MOCK_MSG_LEN);
+
+	/* run test */
+	ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_memory_equal((char *)rstate->tx + MOCK_MSG_LEN, Msg, MOCK_MSG_LEN);
+}
+
+/*
+ * send__len_0 -- a zero-length message is a bare notification
+ */
+static void
+send__len_0(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_write_with_imm(0, 0, 0, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_ring_send(rstate->ring, NULL, 0, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__no_space_AGAIN -- no space in the remote ring until it is returned
+ */
+static void
+send__no_space_AGAIN(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+	size_t len = MOCK_RING_SIZE / 4;
+
+	/* configure mocks */
+	for (size_t i = 0; i < 4; i++)
+		configure_write_with_imm(i * len, len, (i + 1) * len, MOCK_OK);
+
+	/* run test */
+	int ret;
+	for (size_t i = 0; i < 4; i++) {
+		ret = rpma_ring_send(rstate->ring, Msg, len, MOCK_FLAGS, MOCK_OP_CONTEXT);
+		assert_int_equal(ret, MOCK_OK);
+	}
+
+	ret = rpma_ring_send(rstate->ring, Msg, len, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_AGAIN);
+
+	/* configure mocks */
+	set_credit(rstate, len);
+	configure_write_with_imm(0, len, 5 * len, MOCK_OK);
+
+	/* run test */
+	ret = rpma_ring_send(rstate->ring, Msg, len, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__wrap_around -- a message not fitting before the end of the ring starts at its beginning
+ */
+static void
+send__wrap_around(void **rstate_ptr)
+{
+	struct ring_test_state *rstate = *rstate_ptr;
+	size_t len = 250;
+
+	/* configure mocks */
+	for (size_t i = 0; i < 4; i++)
+		configure_write_with_imm(i * len, len, (i + 1) * len, MOCK_OK);
+
+	/* run test */
+	for (size_t i = 0; i < 4; i++) {
+		int ret = rpma_ring_send(rstate->ring, Msg, len, MOCK_FLAGS, MOCK_OP_CONTEXT);
+		assert_int_equal(ret, MOCK_OK);
+	}
+
+	/* configure mocks */
+	set_credit(rstate, 4 * len);
+	/* 24 bytes at the end of the ring are skipped */
+	configure_write_with_imm(0, MOCK_MSG_LEN, MOCK_RING_SIZE + MOCK_MSG_LEN, MOCK_OK);
+
+	/* run test */
+	memset(Msg, 'B', MOCK_MSG_LEN);
+	int ret = rpma_ring_send(rstate->ring, Msg, MOCK_MSG_LEN, MOCK_FLAGS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_memory_equal(rstate->tx, Msg, MOCK_MSG_LEN);
+}
+
+static const struct CMUnitTest tests_send[] = {
+	/* rpma_ring_send() unit tests */
+	cmocka_unit_test(send__ring_NULL),
+	cmocka_unit_test_setup_teardown(send__not_attached,
+		setup__ring_new, teardown__ring_delete),
+	cmocka_unit_test_setup_teardown(send__flags_0,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__msg_NULL_len_not_0,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__len_too_big,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__write_with_imm_ERRNO,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__success,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__len_0,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__no_space_AGAIN,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test_setup_teardown(send__wrap_around,
+		setup__ring_attach, teardown__ring_detach_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_send, NULL, NULL);
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-common.c -- the rpma_rndv unit tests common functions
+ */
+
+#include "rndv-common.h"
+
+/*
+ * setup__rndv_new -- prepare a valid rndv object
+ */
+int
+setup__rndv_new(void **rstate_ptr)
+{
+	static struct rndv_test_state rstate;
+	memset(&rstate, 0, sizeof(rstate));
+
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RTS_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_SEND);
+	will_return(rpma_mr_reg, &rstate.rts);
+	will_return(rpma_mr_reg, MOCK_RPMA_MR_LOCAL);
+
+	/* run test */
+	int ret = rpma_rndv_new(MOCK_PEER, MOCK_CONN, &rstate.rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(rstate.rndv);
+
+	*rstate_ptr = &rstate;
+
+	return 0;
+}
+
+/*
+ * teardown__rndv_delete -- delete the rndv object
+ */
+int
+teardown__rndv_delete(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rndv_delete(&rstate->rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(rstate->rndv);
+
+	return 0;
+}
+
+/*
+ * configure_rndv_send_rts -- configure mocks for sending the RTS message of MOCK_RNDV_LEN bytes
+ * from MOCK_RPMA_MR_LOCAL_SRC using the given slot
+ */
+void
+configure_rndv_send_rts(struct rndv_test_state *rstate, uint32_t slot, int ret)
+{
+	expect_value(rpma_mr_get_descriptor_size, mr, MOCK_RPMA_MR_LOCAL_SRC);
+	will_return(rpma_mr_get_descriptor_size, MOCK_DESC_SIZE);
+	expect_value(rpma_mr_get_descriptor, mr, MOCK_RPMA_MR_LOCAL_SRC);
+	expect_value(rpma_mr_get_descriptor, desc,
+		rstate->rts + slot * RPMA_RNDV_RTS_SIZE + MOCK_RTS_HDR_SIZE);
+	will_return(rpma_mr_get_descriptor, MOCK_OK);
+	expect_value(rpma_send_with_imm, conn, MOCK_CONN);
+	expect_value(rpma_send_with_imm, src, MOCK_RPMA_MR_LOCAL);
+	expect_value(rpma_send_with_imm, offset, slot * RPMA_RNDV_RTS_SIZE);
+	expect_value(rpma_send_with_imm, len, MOCK_RTS_HDR_SIZE + MOCK_DESC_SIZE);
+	expect_value(rpma_send_with_imm, flags, RPMA_F_COMPLETION_ON_ERROR);
+	expect_value(rpma_send_with_imm, imm, MOCK_IMM_RTS(slot));
+	expect_value(rpma_send_with_imm, op_context, NULL);
+	will_return(rpma_send_with_imm, ret);
+}
+
+/*
+ * rndv_rts -- build the RTS message
+ */
+void
+rndv_rts(char *buf, uint32_t slot, uint32_t desc_size, uint64_t offset, uint64_t len)
+{
+	uint32_t slot_le = htole32(slot);
+	uint32_t desc_size_le = htole32(desc_size);
+	uint64_t offset_le = htole64(offset);
+	uint64_t len_le = htole64(len);
+
+	memset(buf, 0, RPMA_RNDV_RTS_SIZE);
+	memcpy(buf, &slot_le, sizeof(slot_le));
+	memcpy(buf + 4, &desc_size_le, sizeof(desc_size_le));
+	memcpy(buf + 8, &offset_le, sizeof(offset_le));
+	memcpy(buf + 16, &len_le, sizeof(len_le));
+}
+
+/*
+ * rndv_wc -- a completion of a receive with immediate data
+ */
+struct ibv_wc
+rndv_wc(uint32_t imm, uint32_t byte_len)
+{
+	struct ibv_wc wc = {0};
+	wc.opcode = IBV_WC_RECV;
+	wc.wc_flags = IBV_WC_WITH_IMM;
+	wc.imm_data = htonl(imm);
+	wc.byte_len = byte_len;
+
+	return wc;
+}
@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-common.h -- the rpma_rndv unit tests common definitions
+ */
+
+#ifndef RNDV_COMMON_H
+#define RNDV_COMMON_H
+
+#include <arpa/inet.h>
+#include <endian.h>
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "test-common.h"
+
+#define MOCK_RNDV_SLOTS		64
+#define MOCK_RTS_MR_SIZE	(MOCK_RNDV_SLOTS * RPMA_RNDV_RTS_SIZE)
+#define MOCK_RTS_HDR_SIZE	24
+#define MOCK_THRESHOLD_DEFAULT	4096
+#define MOCK_RPMA_MR_LOCAL_SRC	(struct rpma_mr_local *)0xC422
+#define MOCK_RPMA_MR_REMOTE	(struct rpma_mr_remote *)0xC412
+#define MOCK_DESC_SIZE		21
+#define MOCK_SRC_OFFSET		((size_t)0x1000)
+#define MOCK_DST_OFFSET		((size_t)0x2000)
+#define MOCK_EAGER_LEN		((size_t)100)
+#define MOCK_RNDV_LEN		((size_t)0x100000)
+
+/* the immediate data of the messages (the wire format) */
+#define MOCK_IMM_EAGER		((uint32_t)1 << 24)
+#define MOCK_IMM_RTS(slot)	((uint32_t)2 << 24 | (uint32_t)(slot))
+#define MOCK_IMM_FIN(slot)	((uint32_t)3 << 24 | (uint32_t)(slot))
+
+struct rndv_test_state {
+	char *rts; /* the RTS messages buffer allocated by rpma_rndv_new() */
+	struct rpma_rndv *rndv;
+};
+
+int setup__rndv_new(void **rstate_ptr);
+int teardown__rndv_delete(void **rstate_ptr);
+
+void configure_rndv_send_rts(struct rndv_test_state *rstate, uint32_t slot, int ret);
+void rndv_rts(char *buf, uint32_t slot, uint32_t desc_size, uint64_t offset, uint64_t len);
+struct ibv_wc rndv_wc(uint32_t imm, uint32_t byte_len);
+
+#endif /* RNDV_COMMON_H */
@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-new.c -- the rpma_rndv_new/_delete() unit tests
+ *
+ * APIs covered:
+ * - rpma_rndv_new()
+ * - rpma_rndv_delete()
+ */
+
+#include "rndv-common.h"
+
+/*
+ * new__peer_NULL -- NULL peer is invalid
+ */
+static void
+new__peer_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_rndv *rndv = NULL;
+	int ret = rpma_rndv_new(NULL, MOCK_CONN, &rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(rndv);
+}
+
+/*
+ * new__conn_NULL -- NULL conn is invalid
+ */
+static void
+new__conn_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_rndv *rndv = NULL;
+	int ret = rpma_rndv_new(MOCK_PEER, NULL, &rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(rndv);
+}
+
+/*
+ * new__rndv_ptr_NULL -- NULL rndv_ptr is invalid
+ */
+static void
+new__rndv_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_rndv_new(MOCK_PEER, MOCK_CONN, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * new__malloc_ERRNO -- malloc() fails
+ */
+static void
+new__malloc_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_rndv *rndv = NULL;
+	int ret = rpma_rndv_new(MOCK_PEER, MOCK_CONN, &rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rndv);
+}
+
+/*
+ * new__malloc_rts_ERRNO -- malloc() of the RTS messages buffer fails
+ */
+static void
+new__malloc_rts_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, ENOMEM);
+
+	/* run test */
+	struct rpma_rndv *rndv = NULL;
+	int ret = rpma_rndv_new(MOCK_PEER, MOCK_CONN, &rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+	assert_null(rndv);
+}
+
+/*
+ * new__mr_reg_ERRNO -- rpma_mr_reg() fails
+ */
+static void
+new__mr_reg_ERRNO(void **unused)
+{
+	/* configure mocks */
+	void *rts = NULL;
+	will_return(__wrap__test_malloc, MOCK_OK);
+	will_return(__wrap__test_malloc, MOCK_OK);
+	expect_value(rpma_mr_reg, peer, MOCK_PEER);
+	expect_value(rpma_mr_reg, size, MOCK_RTS_MR_SIZE);
+	expect_value(rpma_mr_reg, usage, RPMA_MR_USAGE_SEND);
+	will_return(rpma_mr_reg, &rts);
+	will_return(rpma_mr_reg, NULL);
+	will_return(rpma_mr_reg, RPMA_E_PROVIDER);
+
+	/* run test */
+	struct rpma_rndv *rndv = NULL;
+	int ret = rpma_rndv_new(MOCK_PEER, MOCK_CONN, &rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rndv);
+}
+
+/*
+ * new__success -- happy day scenario
+ */
+static void
+new__success(void **rstate_ptr)
+{
+	/*
+	 * The thing is done by setup__rndv_new()
+	 * and teardown__rndv_delete().
+	 */
+}
+
+/*
+ * delete__rndv_ptr_NULL -- NULL rndv_ptr is invalid
+ */
+static void
+delete__rndv_ptr_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_rndv_delete(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * delete__rndv_NULL -- NULL *rndv_ptr should exit quickly
+ */
+static void
+delete__rndv_NULL(void **unused)
+{
+	/* run test */
+	struct rpma_rndv *rndv = NULL;
+	int ret = rpma_rndv_delete(&rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * delete__mr_dereg_ERRNO -- rpma_mr_dereg() fails
+ */
+static void
+delete__mr_dereg_ERRNO(void **unused)
+{
+	struct rndv_test_state *rstate;
+	setup__rndv_new((void **)&rstate);
+
+	/* configure mocks */
+	expect_value(rpma_mr_dereg, *mr_ptr, MOCK_RPMA_MR_LOCAL);
+	will_return(rpma_mr_dereg, RPMA_E_PROVIDER);
+	will_return(rpma_mr_dereg, MOCK_ERRNO);
+
+	/* run test */
+	int ret = rpma_rndv_delete(&rstate->rndv);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(rstate->rndv);
+}
+
+static const struct CMUnitTest tests_new[] = {
+	/* rpma_rndv_new() unit tests */
+	cmocka_unit_test(new__peer_NULL),
+	cmocka_unit_test(new__conn_NULL),
+	cmocka_unit_test(new__rndv_ptr_NULL),
+	cmocka_unit_test(new__malloc_ERRNO),
+	cmocka_unit_test(new__malloc_rts_ERRNO),
+	cmocka_unit_test(new__mr_reg_ERRNO),
+	cmocka_unit_test_setup_teardown(new__success, setup__rndv_new, teardown__rndv_delete),
+
+	/* rpma_rndv_delete() unit tests */
+	cmocka_unit_test(delete__rndv_ptr_NULL),
+	cmocka_unit_test(delete__rndv_NULL),
+	cmocka_unit_test(delete__mr_dereg_ERRNO),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_new, NULL, NULL);
+}
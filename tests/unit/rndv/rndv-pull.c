@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-pull.c -- the rpma_rndv_pull() unit tests
+ *
+ * API covered:
+ * - rpma_rndv_pull()
+ */
+
+#include "mr.h"
+#include "rndv-common.h"
+
+#define MOCK_SLOT	5
+
+/*
+ * configure_pull_read -- configure mocks for the remote memory region and the read
+ */
+static void
+configure_pull_read(const char *buf, int ret)
+{
+	expect_value(rpma_mr_remote_from_descriptor, desc, buf + MOCK_RTS_HDR_SIZE);
+	expect_value(rpma_mr_remote_from_descriptor, desc_size, MOCK_DESC_SIZE);
+	will_return(rpma_mr_remote_from_descriptor, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_read, conn, MOCK_CONN);
+	expect_value(rpma_read, dst, MOCK_RPMA_MR_LOCAL_SRC);
+	expect_value(rpma_read, dst_offset, MOCK_DST_OFFSET);
+	expect_value(rpma_read, src, MOCK_RPMA_MR_REMOTE);
+	expect_value(rpma_read, src_offset, MOCK_SRC_OFFSET);
+	expect_value(rpma_read, len, MOCK_RNDV_LEN);
+	expect_value(rpma_read, flags, RPMA_F_COMPLETION_ALWAYS);
+	expect_value(rpma_read, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_read, ret);
+	expect_value(rpma_mr_remote_delete, *mr_ptr, MOCK_RPMA_MR_REMOTE);
+}
+
+/*
+ * pull__rndv_NULL -- NULL rndv is invalid
+ */
+static void
+pull__rndv_NULL(void **unused)
+{
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* run test */
+	int ret = rpma_rndv_pull(NULL, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * pull__buf_NULL -- NULL buf is invalid
+ */
+static void
+pull__buf_NULL(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, NULL, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * pull__dst_NULL -- NULL dst is invalid
+ */
+static void
+pull__dst_NULL(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, NULL, MOCK_DST_OFFSET, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * pull__slot_invalid -- the slot of the RTS message is out of range
+ */
+static void
+pull__slot_invalid(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_RNDV_SLOTS, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * pull__desc_size_invalid -- the descriptor does not fit into the RTS message
+ */
+static void
+pull__desc_size_invalid(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, RPMA_RNDV_RTS_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * pull__remote_from_descriptor_ERRNO -- rpma_mr_remote_from_descriptor() fails
+ */
+static void
+pull__remote_from_descriptor_ERRNO(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* configure mocks */
+	expect_value(rpma_mr_remote_from_descriptor, desc, buf + MOCK_RTS_HDR_SIZE);
+	expect_value(rpma_mr_remote_from_descriptor, desc_size, MOCK_DESC_SIZE);
+	will_return(rpma_mr_remote_from_descriptor, NULL);
+	will_return(rpma_mr_remote_from_descriptor, RPMA_E_NOMEM);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOMEM);
+}
+
+/*
+ * pull__read_ERRNO -- rpma_read() fails so the FIN message is not sent
+ */
+static void
+pull__read_ERRNO(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* configure mocks */
+	configure_pull_read(buf, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * pull__send_ERRNO -- sending the FIN message fails
+ */
+static void
+pull__send_ERRNO(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* configure mocks */
+	configure_pull_read(buf, MOCK_OK);
+	expect_value(rpma_conn_send_with_imm_internal, conn, MOCK_CONN);
+	expect_value(rpma_conn_send_with_imm_internal, src, NULL);
+	expect_value(rpma_conn_send_with_imm_internal, offset, 0);
+	expect_value(rpma_conn_send_with_imm_internal, len, 0);
+	expect_any(rpma_conn_send_with_imm_internal, flags);
+	expect_value(rpma_conn_send_with_imm_internal, imm, MOCK_IMM_FIN(MOCK_SLOT));
+	expect_any(rpma_conn_send_with_imm_internal, fence);
+	expect_value(rpma_conn_send_with_imm_internal, op_context, NULL);
+	will_return(rpma_conn_send_with_imm_internal, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * pull__success -- the read is posted and followed by the fenced FIN message
+ */
+static void
+pull__success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, MOCK_SLOT, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+
+	/* configure mocks */
+	configure_pull_read(buf, MOCK_OK);
+	expect_value(rpma_conn_send_with_imm_internal, conn, MOCK_CONN);
+	expect_value(rpma_conn_send_with_imm_internal, src, NULL);
+	expect_value(rpma_conn_send_with_imm_internal, offset, 0);
+	expect_value(rpma_conn_send_with_imm_internal, len, 0);
+	expect_value(rpma_conn_send_with_imm_internal, flags, RPMA_F_COMPLETION_ON_ERROR);
+	expect_value(rpma_conn_send_with_imm_internal, imm, MOCK_IMM_FIN(MOCK_SLOT));
+	expect_value(rpma_conn_send_with_imm_internal, fence, true);
+	expect_value(rpma_conn_send_with_imm_internal, op_context, NULL);
+	will_return(rpma_conn_send_with_imm_internal, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rndv_pull(rstate->rndv, buf, MOCK_RPMA_MR_LOCAL_SRC, MOCK_DST_OFFSET,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_pull[] = {
+	/* rpma_rndv_pull() unit tests */
+	cmocka_unit_test(pull__rndv_NULL),
+	cmocka_unit_test_setup_teardown(pull__buf_NULL,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__dst_NULL,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__slot_invalid,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__desc_size_invalid,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__remote_from_descriptor_ERRNO,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__read_ERRNO,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__send_ERRNO,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(pull__success,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_pull, NULL, NULL);
+}
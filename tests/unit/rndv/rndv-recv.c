@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-recv.c -- the rpma_rndv_recv() unit tests
+ *
+ * API covered:
+ * - rpma_rndv_recv()
+ */
+
+#include "rndv-common.h"
+
+/*
+ * recv__rndv_NULL -- NULL rndv is invalid
+ */
+static void
+recv__rndv_NULL(void **unused)
+{
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_EAGER, MOCK_EAGER_LEN);
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_rndv_recv(NULL, &wc, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__wc_NULL -- NULL wc is invalid
+ */
+static void
+recv__wc_NULL(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, NULL, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__wrong_opcode -- the completion is not a receive
+ */
+static void
+recv__wrong_opcode(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_EAGER, MOCK_EAGER_LEN);
+	wc.opcode = IBV_WC_RECV_RDMA_WITH_IMM;
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, &wc, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__no_imm -- the receive completion does not carry the immediate data
+ */
+static void
+recv__no_imm(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_EAGER, MOCK_EAGER_LEN);
+	wc.wc_flags = 0;
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, &wc, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__unknown_type -- the immediate data does not carry a known message type
+ */
+static void
+recv__unknown_type(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	struct ibv_wc wc = rndv_wc((uint32_t)0xFF << 24, MOCK_EAGER_LEN);
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, &wc, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__eager_success -- the eager message is in the receive buffer
+ */
+static void
+recv__eager_success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_EAGER, MOCK_EAGER_LEN);
+	enum rpma_rndv_msg_type type = RPMA_RNDV_FIN;
+	size_t len = 0;
+	const void *op_context = MOCK_OP_CONTEXT;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, &wc, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(type, RPMA_RNDV_EAGER);
+	assert_int_equal(len, MOCK_EAGER_LEN);
+	assert_null(op_context);
+}
+
+/*
+ * recv__rts_too_short -- the RTS message is too short
+ */
+static void
+recv__rts_too_short(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, 0, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_RTS(0), MOCK_RTS_HDR_SIZE - 1);
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, &wc, buf, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(len, 0);
+}
+
+/*
+ * recv__rts_success -- the RTS message announces the length of the message
+ */
+static void
+recv__rts_success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	char buf[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(buf, 0, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_RTS(0), MOCK_RTS_HDR_SIZE + MOCK_DESC_SIZE);
+	enum rpma_rndv_msg_type type = RPMA_RNDV_FIN;
+	size_t len = 0;
+	const void *op_context = MOCK_OP_CONTEXT;
+
+	/* run test */
+	int ret = rpma_rndv_recv(rstate->rndv, &wc, buf, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(type, RPMA_RNDV_RTS);
+	assert_int_equal(len, MOCK_RNDV_LEN);
+	assert_null(op_context);
+}
+
+/*
+ * recv__fin_unknown_slot -- the FIN message for a slot not in use is invalid
+ */
+static void
+recv__fin_unknown_slot(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	uint32_t slots[] = {0, MOCK_RNDV_SLOTS};
+	enum rpma_rndv_msg_type type;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++) {
+		struct ibv_wc wc = rndv_wc(MOCK_IMM_FIN(slots[i]), 0);
+
+		/* run test */
+		int ret = rpma_rndv_recv(rstate->rndv, &wc, NULL, &type, &len, &op_context);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_INVAL);
+		assert_int_equal(len, 0);
+	}
+}
+
+/*
+ * recv__fin_success -- the FIN message completes the send and releases the slot
+ */
+static void
+recv__fin_success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_rndv_send_rts(rstate, 0, MOCK_OK);
+	configure_rndv_send_rts(rstate, 1, MOCK_OK);
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, NULL);
+	assert_int_equal(ret, MOCK_OK);
+
+	struct ibv_wc wc = rndv_wc(MOCK_IMM_FIN(0), 0);
+	enum rpma_rndv_msg_type type = RPMA_RNDV_EAGER;
+	size_t len = 0;
+	const void *op_context = NULL;
+
+	/* run test */
+	ret = rpma_rndv_recv(rstate->rndv, &wc, NULL, &type, &len, &op_context);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(type, RPMA_RNDV_FIN);
+	assert_int_equal(len, MOCK_RNDV_LEN);
+	assert_ptr_equal(op_context, MOCK_OP_CONTEXT);
+
+	/* the released slot is used again */
+	configure_rndv_send_rts(rstate, 0, MOCK_OK);
+	ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_recv[] = {
+	/* rpma_rndv_recv() unit tests */
+	cmocka_unit_test(recv__rndv_NULL),
+	cmocka_unit_test_setup_teardown(recv__wc_NULL,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__wrong_opcode,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__no_imm,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__unknown_type,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__eager_success,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__rts_too_short,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__rts_success,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__fin_unknown_slot,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(recv__fin_success,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_recv, NULL, NULL);
+}
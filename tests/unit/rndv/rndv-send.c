@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-send.c -- the rpma_rndv_send() unit tests
+ *
+ * API covered:
+ * - rpma_rndv_send()
+ */
+
+#include "rndv-common.h"
+
+/*
+ * send__rndv_NULL -- NULL rndv is invalid
+ */
+static void
+send__rndv_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_rndv_send(NULL, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET, MOCK_EAGER_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__flags_0 -- flags == 0 is invalid
+ */
+static void
+send__flags_0(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_EAGER_LEN, 0, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__src_NULL_len_not_0 -- NULL src with a non-zero length is invalid
+ */
+static void
+send__src_NULL_len_not_0(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, NULL, 0, MOCK_EAGER_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__eager_success -- a message not longer than the threshold is sent eagerly
+ */
+static void
+send__eager_success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_send_with_imm, conn, MOCK_CONN);
+	expect_value(rpma_send_with_imm, src, MOCK_RPMA_MR_LOCAL_SRC);
+	expect_value(rpma_send_with_imm, offset, MOCK_SRC_OFFSET);
+	expect_value(rpma_send_with_imm, len, MOCK_THRESHOLD_DEFAULT);
+	expect_value(rpma_send_with_imm, flags, RPMA_F_COMPLETION_ALWAYS);
+	expect_value(rpma_send_with_imm, imm, MOCK_IMM_EAGER);
+	expect_value(rpma_send_with_imm, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_send_with_imm, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_THRESHOLD_DEFAULT, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__eager_send_with_imm_ERRNO -- rpma_send_with_imm() of an eager message fails
+ */
+static void
+send__eager_send_with_imm_ERRNO(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_send_with_imm, conn, MOCK_CONN);
+	expect_value(rpma_send_with_imm, src, MOCK_RPMA_MR_LOCAL_SRC);
+	expect_value(rpma_send_with_imm, offset, MOCK_SRC_OFFSET);
+	expect_value(rpma_send_with_imm, len, MOCK_EAGER_LEN);
+	expect_value(rpma_send_with_imm, flags, RPMA_F_COMPLETION_ON_ERROR);
+	expect_value(rpma_send_with_imm, imm, MOCK_IMM_EAGER);
+	expect_value(rpma_send_with_imm, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_send_with_imm, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_EAGER_LEN, RPMA_F_COMPLETION_ON_ERROR, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * send__rts_success -- a message longer than the threshold is announced with the RTS message
+ */
+static void
+send__rts_success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_rndv_send_rts(rstate, 0, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	char rts[RPMA_RNDV_RTS_SIZE];
+	rndv_rts(rts, 0, MOCK_DESC_SIZE, MOCK_SRC_OFFSET, MOCK_RNDV_LEN);
+	assert_memory_equal(rstate->rts, rts, MOCK_RTS_HDR_SIZE);
+}
+
+/*
+ * send__rts_send_with_imm_ERRNO -- the slot is not used if sending the RTS message fails
+ */
+static void
+send__rts_send_with_imm_ERRNO(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	configure_rndv_send_rts(rstate, 0, RPMA_E_PROVIDER);
+	configure_rndv_send_rts(rstate, 0, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	/* the same slot is used again */
+	ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * send__rts_get_descriptor_ERRNO -- rpma_mr_get_descriptor() fails
+ */
+static void
+send__rts_get_descriptor_ERRNO(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_get_descriptor_size, mr, MOCK_RPMA_MR_LOCAL_SRC);
+	will_return(rpma_mr_get_descriptor_size, MOCK_DESC_SIZE);
+	expect_value(rpma_mr_get_descriptor, mr, MOCK_RPMA_MR_LOCAL_SRC);
+	expect_value(rpma_mr_get_descriptor, desc, rstate->rts + MOCK_RTS_HDR_SIZE);
+	will_return(rpma_mr_get_descriptor, RPMA_E_INVAL);
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * send__rts_descriptor_too_big -- the descriptor does not fit into the RTS message
+ */
+static void
+send__rts_descriptor_too_big(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* configure mocks */
+	expect_value(rpma_mr_get_descriptor_size, mr, MOCK_RPMA_MR_LOCAL_SRC);
+	will_return(rpma_mr_get_descriptor_size, RPMA_RNDV_RTS_SIZE);
+
+	/* run test */
+	int ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NOSUPP);
+}
+
+/*
+ * send__rts_E_AGAIN -- all slots are waiting for the FIN messages
+ */
+static void
+send__rts_E_AGAIN(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+	int ret;
+
+	for (uint32_t slot = 0; slot < MOCK_RNDV_SLOTS; slot++) {
+		/* configure mocks */
+		configure_rndv_send_rts(rstate, slot, MOCK_OK);
+
+		/* run test */
+		ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+				MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+	}
+
+	/* run test */
+	ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_AGAIN);
+}
+
+static const struct CMUnitTest tests_send[] = {
+	/* rpma_rndv_send() unit tests */
+	cmocka_unit_test(send__rndv_NULL),
+	cmocka_unit_test_setup_teardown(send__flags_0,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__src_NULL_len_not_0,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__eager_success,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__eager_send_with_imm_ERRNO,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__rts_success,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__rts_send_with_imm_ERRNO,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__rts_get_descriptor_ERRNO,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__rts_descriptor_too_big,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(send__rts_E_AGAIN,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_send, NULL, NULL);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rndv-threshold.c -- the rpma_rndv_set/get_threshold() unit tests
+ *
+ * APIs covered:
+ * - rpma_rndv_set_threshold()
+ * - rpma_rndv_get_threshold()
+ */
+
+#include "rndv-common.h"
+
+/*
+ * set_threshold__rndv_NULL -- NULL rndv is invalid
+ */
+static void
+set_threshold__rndv_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_rndv_set_threshold(NULL, MOCK_EAGER_LEN);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_threshold__rndv_NULL -- NULL rndv is invalid
+ */
+static void
+get_threshold__rndv_NULL(void **unused)
+{
+	/* run test */
+	size_t threshold = 0;
+	int ret = rpma_rndv_get_threshold(NULL, &threshold);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(threshold, 0);
+}
+
+/*
+ * get_threshold__threshold_NULL -- NULL threshold is invalid
+ */
+static void
+get_threshold__threshold_NULL(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_rndv_get_threshold(rstate->rndv, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_threshold__default -- the default threshold is 4096 bytes
+ */
+static void
+get_threshold__default(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	size_t threshold = 0;
+	int ret = rpma_rndv_get_threshold(rstate->rndv, &threshold);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(threshold, MOCK_THRESHOLD_DEFAULT);
+}
+
+/*
+ * set_threshold__success -- the new threshold is effective for the next send
+ */
+static void
+set_threshold__success(void **rstate_ptr)
+{
+	struct rndv_test_state *rstate = *rstate_ptr;
+
+	/* run test */
+	int ret = rpma_rndv_set_threshold(rstate->rndv, MOCK_RNDV_LEN);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	size_t threshold = 0;
+	ret = rpma_rndv_get_threshold(rstate->rndv, &threshold);
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(threshold, MOCK_RNDV_LEN);
+
+	/* configure mocks */
+	expect_value(rpma_send_with_imm, conn, MOCK_CONN);
+	expect_value(rpma_send_with_imm, src, MOCK_RPMA_MR_LOCAL_SRC);
+	expect_value(rpma_send_with_imm, offset, MOCK_SRC_OFFSET);
+	expect_value(rpma_send_with_imm, len, MOCK_RNDV_LEN);
+	expect_value(rpma_send_with_imm, flags, RPMA_F_COMPLETION_ALWAYS);
+	expect_value(rpma_send_with_imm, imm, MOCK_IMM_EAGER);
+	expect_value(rpma_send_with_imm, op_context, MOCK_OP_CONTEXT);
+	will_return(rpma_send_with_imm, MOCK_OK);
+
+	/* run test */
+	ret = rpma_rndv_send(rstate->rndv, MOCK_RPMA_MR_LOCAL_SRC, MOCK_SRC_OFFSET,
+			MOCK_RNDV_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+static const struct CMUnitTest tests_threshold[] = {
+	/* rpma_rndv_set_threshold() unit tests */
+	cmocka_unit_test(set_threshold__rndv_NULL),
+	cmocka_unit_test_setup_teardown(set_threshold__success,
+		setup__rndv_new, teardown__rndv_delete),
+
+	/* rpma_rndv_get_threshold() unit tests */
+	cmocka_unit_test(get_threshold__rndv_NULL),
+	cmocka_unit_test_setup_teardown(get_threshold__threshold_NULL,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test_setup_teardown(get_threshold__default,
+		setup__rndv_new, teardown__rndv_delete),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_threshold, NULL, NULL);
+}
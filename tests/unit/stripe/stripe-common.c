@@ -0,0 +1,327 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe-common.c -- the rpma_stripe unit tests common functions
+ */
+
+#include "stripe-common.h"
+
+struct conn_cfg_get_mock_args Cfg_args = {
+	.cfg = MOCK_CONN_CFG_CUSTOM,
+	.sq_size = MOCK_SQ_SIZE,
+};
+
+const void *Chunk_op_context;
+
+/*
+ * rpma_conn_connect_all -- rpma_conn_connect_all() mock
+ */
+int
+rpma_conn_connect_all(struct rpma_peer *peer, struct rpma_conn_target *targets,
+		int num_targets, int max_inflight)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+	assert_non_null(targets);
+	assert_int_equal(num_targets, MOCK_NUM_CONNS);
+	assert_int_equal(max_inflight, MOCK_NUM_CONNS);
+
+	for (int i = 0; i < num_targets; i++) {
+		assert_string_equal(targets[i].addr, MOCK_IP_ADDRESS);
+		assert_string_equal(targets[i].port, MOCK_PORT);
+		assert_ptr_equal(targets[i].cfg, MOCK_CONN_CFG_CUSTOM);
+		assert_null(targets[i].pdata);
+	}
+
+	int ret = mock_type(int);
+	if (ret) {
+		/* the target left established despite the failure (if any) */
+		int established = mock_type(int);
+		if (established >= 0)
+			targets[established].conn = MOCK_STRIPE_CONN(established);
+		return ret;
+	}
+
+	int failed = mock_type(int);
+	int result = mock_type(int);
+	for (int i = 0; i < num_targets; i++) {
+		targets[i].result = (i == failed) ? result : 0;
+		targets[i].conn = (i == failed) ? NULL : MOCK_STRIPE_CONN(i);
+	}
+
+	return 0;
+}
+
+/*
+ * rpma_conn_get_cq -- rpma_conn_get_cq() mock
+ */
+int
+rpma_conn_get_cq(const struct rpma_conn *conn, struct rpma_cq **cq_ptr)
+{
+	assert_non_null(cq_ptr);
+
+	*cq_ptr = MOCK_STRIPE_CQ((uintptr_t)conn - (uintptr_t)MOCK_STRIPE_CONN(0));
+
+	return 0;
+}
+
+/*
+ * rpma_conn_disconnect -- rpma_conn_disconnect() mock
+ */
+int
+rpma_conn_disconnect(struct rpma_conn *conn)
+{
+	check_expected_ptr(conn);
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_conn_next_event -- rpma_conn_next_event() mock
+ */
+int
+rpma_conn_next_event(struct rpma_conn *conn, enum rpma_conn_event *event)
+{
+	check_expected_ptr(conn);
+	assert_non_null(event);
+
+	int ret = mock_type(int);
+	if (ret)
+		return ret;
+
+	*event = mock_type(enum rpma_conn_event);
+
+	return 0;
+}
+
+/*
+ * rpma_conn_delete -- rpma_conn_delete() mock
+ */
+int
+rpma_conn_delete(struct rpma_conn **conn_ptr)
+{
+	assert_non_null(conn_ptr);
+
+	struct rpma_conn *conn = *conn_ptr;
+	check_expected_ptr(conn);
+
+	*conn_ptr = NULL;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_read -- rpma_read() mock (the op_context is stored in Chunk_op_context)
+ */
+int
+rpma_read(struct rpma_conn *conn, struct rpma_mr_local *dst, size_t dst_offset,
+		const struct rpma_mr_remote *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	check_expected_ptr(conn);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	assert_non_null(op_context);
+
+	Chunk_op_context = op_context;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_write -- rpma_write() mock (the op_context is stored in Chunk_op_context)
+ */
+int
+rpma_write(struct rpma_conn *conn, struct rpma_mr_remote *dst, size_t dst_offset,
+		const struct rpma_mr_local *src, size_t src_offset, size_t len, int flags,
+		const void *op_context)
+{
+	check_expected_ptr(conn);
+	check_expected_ptr(dst);
+	check_expected(dst_offset);
+	check_expected_ptr(src);
+	check_expected(src_offset);
+	check_expected(len);
+	check_expected(flags);
+	assert_non_null(op_context);
+
+	Chunk_op_context = op_context;
+
+	return mock_type(int);
+}
+
+/*
+ * rpma_peer_get_caps -- rpma_peer_get_caps() mock
+ */
+int
+rpma_peer_get_caps(const struct rpma_peer *peer, struct rpma_peer_caps *caps)
+{
+	assert_ptr_equal(peer, MOCK_PEER);
+	assert_non_null(caps);
+
+	memset(caps, 0, sizeof(*caps));
+	caps->max_qp_wr = mock_type(uint32_t);
+
+	return 0;
+}
+
+/*
+ * rpma_cq_get_wc -- rpma_cq_get_wc() mock
+ */
+int
+rpma_cq_get_wc(struct rpma_cq *cq, int num_entries, struct ibv_wc *wc, int *num_entries_got)
+{
+	check_expected_ptr(cq);
+	assert_int_equal(num_entries, 1);
+	assert_non_null(wc);
+
+	int ret = mock_type(int);
+	if (ret)
+		return ret;
+
+	*wc = *mock_type(struct ibv_wc *);
+	if (num_entries_got)
+		*num_entries_got = 1;
+
+	return 0;
+}
+
+/*
+ * setup__stripe_connect -- prepare a valid striped connection
+ */
+int
+setup__stripe_connect(void **sstate_ptr)
+{
+	static struct stripe_test_state sstate;
+	memset(&sstate, 0, sizeof(sstate));
+
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_sq_size, &Cfg_args);
+	will_return(rpma_peer_get_caps, 0);
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	configure_connect_all(MOCK_OK, -1, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, MOCK_CONN_CFG_CUSTOM,
+			NULL, MOCK_NUM_CONNS, MOCK_CHUNK_SIZE, &sstate.stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_non_null(sstate.stripe);
+
+	*sstate_ptr = &sstate;
+
+	return 0;
+}
+
+/*
+ * teardown__stripe_delete -- delete the striped connection
+ */
+int
+teardown__stripe_delete(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_CONNS; i++)
+		configure_close(i, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_stripe_delete(&sstate->stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_null(sstate->stripe);
+
+	return 0;
+}
+
+/*
+ * configure_connect_all -- configure the rpma_conn_connect_all() mock; the target of
+ * the failed index (if any) fails with the result
+ */
+void
+configure_connect_all(int ret, int failed, int result)
+{
+	will_return(rpma_conn_connect_all, ret);
+	if (ret) {
+		will_return(rpma_conn_connect_all, -1);
+		return;
+	}
+
+	will_return(rpma_conn_connect_all, failed);
+	will_return(rpma_conn_connect_all, result);
+}
+
+/*
+ * configure_connect_all_failed -- configure the rpma_conn_connect_all() mock failing with ret
+ * with the target of the established index (if any) left connected
+ */
+void
+configure_connect_all_failed(int ret, int established)
+{
+	will_return(rpma_conn_connect_all, ret);
+	will_return(rpma_conn_connect_all, established);
+}
+
+/*
+ * configure_close -- configure mocks for closing the i-th connection; ret is the result of
+ * rpma_conn_disconnect()
+ */
+void
+configure_close(int i, int ret)
+{
+	expect_value(rpma_conn_disconnect, conn, MOCK_STRIPE_CONN(i));
+	will_return(rpma_conn_disconnect, ret);
+	if (ret == MOCK_OK) {
+		expect_value(rpma_conn_next_event, conn, MOCK_STRIPE_CONN(i));
+		will_return(rpma_conn_next_event, MOCK_OK);
+		will_return(rpma_conn_next_event, RPMA_CONN_CLOSED);
+	}
+	expect_value(rpma_conn_delete, conn, MOCK_STRIPE_CONN(i));
+	will_return(rpma_conn_delete, MOCK_OK);
+}
+
+/*
+ * configure_chunk -- configure the rpma_read() or rpma_write() mock for a chunk posted
+ * over the i-th connection
+ */
+void
+configure_chunk(enum ibv_wc_opcode opcode, int i, size_t offset, size_t len, int ret)
+{
+	if (opcode == IBV_WC_RDMA_READ) {
+		expect_value(rpma_read, conn, MOCK_STRIPE_CONN(i));
+		expect_value(rpma_read, dst, MOCK_RPMA_MR_LOCAL);
+		expect_value(rpma_read, dst_offset, MOCK_LOCAL_OFFSET + offset);
+		expect_value(rpma_read, src, MOCK_RPMA_MR_REMOTE);
+		expect_value(rpma_read, src_offset, MOCK_REMOTE_OFFSET + offset);
+		expect_value(rpma_read, len, len);
+		expect_value(rpma_read, flags, RPMA_F_COMPLETION_ALWAYS);
+		will_return(rpma_read, ret);
+	} else {
+		expect_value(rpma_write, conn, MOCK_STRIPE_CONN(i));
+		expect_value(rpma_write, dst, MOCK_RPMA_MR_REMOTE);
+		expect_value(rpma_write, dst_offset, MOCK_REMOTE_OFFSET + offset);
+		expect_value(rpma_write, src, MOCK_RPMA_MR_LOCAL);
+		expect_value(rpma_write, src_offset, MOCK_LOCAL_OFFSET + offset);
+		expect_value(rpma_write, len, len);
+		expect_value(rpma_write, flags, RPMA_F_COMPLETION_ALWAYS);
+		will_return(rpma_write, ret);
+	}
+}
+
+/*
+ * configure_get_wc -- configure the rpma_cq_get_wc() mock of the CQ of the i-th connection
+ */
+void
+configure_get_wc(int i, int ret, struct ibv_wc *wc)
+{
+	expect_value(rpma_cq_get_wc, cq, MOCK_STRIPE_CQ(i));
+	will_return(rpma_cq_get_wc, ret);
+	if (ret == MOCK_OK)
+		will_return(rpma_cq_get_wc, wc);
+}
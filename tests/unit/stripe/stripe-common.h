@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe-common.h -- the rpma_stripe unit tests common definitions
+ */
+
+#ifndef STRIPE_COMMON_H
+#define STRIPE_COMMON_H
+
+#include "cmocka_headers.h"
+#include "librpma.h"
+#include "mocks-rpma-conn_cfg.h"
+#include "test-common.h"
+
+#define MOCK_NUM_CONNS		3
+#define MOCK_CHUNK_SIZE		16
+#define MOCK_SQ_SIZE		2
+/* the number of chunks all the send queues can hold */
+#define MOCK_CAPACITY		(MOCK_NUM_CONNS * MOCK_SQ_SIZE)
+
+#define MOCK_STRIPE_CONN(i)	((struct rpma_conn *)(uintptr_t)(0xC000 + (i)))
+#define MOCK_STRIPE_CQ(i)	((struct rpma_cq *)(uintptr_t)(0xD400 + (i)))
+#define MOCK_RPMA_MR_REMOTE	(struct rpma_mr_remote *)0xC412
+#define MOCK_REMOTE_OFFSET	((size_t)0x2000)
+
+struct stripe_test_state {
+	struct rpma_stripe *stripe;
+};
+
+extern struct conn_cfg_get_mock_args Cfg_args;
+/* the op_context of the last chunk posted */
+extern const void *Chunk_op_context;
+
+int setup__stripe_connect(void **sstate_ptr);
+int teardown__stripe_delete(void **sstate_ptr);
+
+void configure_connect_all(int ret, int failed, int result);
+void configure_connect_all_failed(int ret, int established);
+void configure_close(int i, int ret);
+void configure_chunk(enum ibv_wc_opcode opcode, int i, size_t offset, size_t len, int ret);
+void configure_get_wc(int i, int ret, struct ibv_wc *wc);
+
+#endif /* STRIPE_COMMON_H */
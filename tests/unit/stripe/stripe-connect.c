@@ -0,0 +1,328 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe-connect.c -- the rpma_stripe_connect/_delete/_get_conn() unit tests
+ *
+ * APIs covered:
+ * - rpma_stripe_connect()
+ * - rpma_stripe_delete()
+ * - rpma_stripe_get_conn()
+ */
+
+#include "stripe-common.h"
+
+/*
+ * connect__invalid -- invalid arguments
+ */
+static void
+connect__invalid(void **unused)
+{
+	struct rpma_stripe *stripe = NULL;
+	int ret;
+
+	/* run test */
+	ret = rpma_stripe_connect(NULL, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL, MOCK_NUM_CONNS,
+			MOCK_CHUNK_SIZE, &stripe);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_connect(MOCK_PEER, NULL, MOCK_PORT, NULL, NULL, MOCK_NUM_CONNS,
+			MOCK_CHUNK_SIZE, &stripe);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, NULL, NULL, NULL, MOCK_NUM_CONNS,
+			MOCK_CHUNK_SIZE, &stripe);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL, MOCK_NUM_CONNS,
+			MOCK_CHUNK_SIZE, NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL, 0,
+			MOCK_CHUNK_SIZE, &stripe);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL, MOCK_NUM_CONNS,
+			0, &stripe);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL, MOCK_NUM_CONNS,
+			(size_t)UINT32_MAX + 1, &stripe);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(stripe);
+}
+
+/*
+ * connect__capacity_too_big -- the send queues cannot hold UINT32_MAX chunks
+ */
+static void
+connect__capacity_too_big(void **unused)
+{
+	/* configure mocks */
+	struct conn_cfg_get_mock_args cfg_args = {
+		.cfg = MOCK_CONN_CFG_DEFAULT,
+		.sq_size = UINT32_MAX / 2,
+	};
+	will_return(rpma_conn_cfg_get_sq_size, &cfg_args);
+	will_return(rpma_peer_get_caps, 0);
+
+	/* run test */
+	struct rpma_stripe *stripe = NULL;
+	int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, NULL, NULL,
+			MOCK_NUM_CONNS, MOCK_CHUNK_SIZE, &stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_null(stripe);
+}
+
+/*
+ * connect__malloc_ERRNO -- malloc() fails with MOCK_ERRNO
+ */
+static void
+connect__malloc_ERRNO(void **unused)
+{
+	for (int i = 0; i < 4; i++) {
+		/* configure mocks */
+		will_return(rpma_conn_cfg_get_sq_size, &Cfg_args);
+		will_return(rpma_peer_get_caps, 0);
+		if (i)
+			will_return_count(__wrap__test_malloc, MOCK_OK, i);
+		will_return(__wrap__test_malloc, MOCK_ERRNO);
+
+		/* run test */
+		struct rpma_stripe *stripe = NULL;
+		int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT,
+				MOCK_CONN_CFG_CUSTOM, NULL, MOCK_NUM_CONNS, MOCK_CHUNK_SIZE,
+				&stripe);
+
+		/* verify the results */
+		assert_int_equal(ret, RPMA_E_NOMEM);
+		assert_null(stripe);
+	}
+}
+
+/*
+ * connect__connect_all_ERRNO -- rpma_conn_connect_all() fails
+ */
+static void
+connect__connect_all_ERRNO(void **unused)
+{
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_sq_size, &Cfg_args);
+	will_return(rpma_peer_get_caps, 0);
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	configure_connect_all(RPMA_E_PROVIDER, -1, MOCK_OK);
+
+	/* run test */
+	struct rpma_stripe *stripe = NULL;
+	int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, MOCK_CONN_CFG_CUSTOM,
+			NULL, MOCK_NUM_CONNS, MOCK_CHUNK_SIZE, &stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(stripe);
+}
+
+/*
+ * connect__connect_all_ERRNO_established -- rpma_conn_connect_all() fails leaving one of
+ * the connections established so it is closed
+ */
+static void
+connect__connect_all_ERRNO_established(void **unused)
+{
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_sq_size, &Cfg_args);
+	will_return(rpma_peer_get_caps, 0);
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	configure_connect_all_failed(RPMA_E_PROVIDER, 1);
+	configure_close(1, MOCK_OK);
+
+	/* run test */
+	struct rpma_stripe *stripe = NULL;
+	int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, MOCK_CONN_CFG_CUSTOM,
+			NULL, MOCK_NUM_CONNS, MOCK_CHUNK_SIZE, &stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(stripe);
+}
+
+/*
+ * connect__target_failed -- one of the connections cannot be established so the other ones
+ * are closed
+ */
+static void
+connect__target_failed(void **unused)
+{
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_sq_size, &Cfg_args);
+	will_return(rpma_peer_get_caps, 0);
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	configure_connect_all(MOCK_OK, 1, RPMA_E_PROVIDER);
+	configure_close(0, MOCK_OK);
+	configure_close(2, RPMA_E_PROVIDER);
+
+	/* run test */
+	struct rpma_stripe *stripe = NULL;
+	int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, MOCK_CONN_CFG_CUSTOM,
+			NULL, MOCK_NUM_CONNS, MOCK_CHUNK_SIZE, &stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(stripe);
+}
+
+/*
+ * connect__sq_size_clamped -- the send queue size is clamped to the device limit, so only
+ * one chunk fits into every send queue
+ */
+static void
+connect__sq_size_clamped(void **unused)
+{
+	/* configure mocks */
+	will_return(rpma_conn_cfg_get_sq_size, &Cfg_args);
+	will_return(rpma_peer_get_caps, 1);
+	will_return_count(__wrap__test_malloc, MOCK_OK, 4);
+	configure_connect_all(MOCK_OK, -1, MOCK_OK);
+
+	/* run test */
+	struct rpma_stripe *stripe = NULL;
+	int ret = rpma_stripe_connect(MOCK_PEER, MOCK_IP_ADDRESS, MOCK_PORT, MOCK_CONN_CFG_CUSTOM,
+			NULL, MOCK_NUM_CONNS, MOCK_CHUNK_SIZE, &stripe);
+	assert_int_equal(ret, MOCK_OK);
+
+	ret = rpma_stripe_read(stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, MOCK_RPMA_MR_REMOTE,
+			MOCK_REMOTE_OFFSET, (MOCK_NUM_CONNS + 1) * MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	/* cleanup */
+	for (int i = 0; i < MOCK_NUM_CONNS; i++)
+		configure_close(i, MOCK_OK);
+	ret = rpma_stripe_delete(&stripe);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * connect__success -- happy day scenario
+ */
+static void
+connect__success(void **unused)
+{
+	void *sstate = NULL;
+
+	/* run test */
+	assert_int_equal(setup__stripe_connect(&sstate), 0);
+	assert_int_equal(teardown__stripe_delete(&sstate), 0);
+}
+
+/*
+ * delete__invalid -- NULL stripe_ptr is invalid and NULL *stripe_ptr is a no-op
+ */
+static void
+delete__invalid(void **unused)
+{
+	/* run test */
+	int ret = rpma_stripe_delete(NULL);
+	assert_int_equal(ret, RPMA_E_INVAL);
+
+	struct rpma_stripe *stripe = NULL;
+	ret = rpma_stripe_delete(&stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * delete__disconnect_ERRNO -- closing a connection fails but all of them are deleted and
+ * the first error is returned
+ */
+static void
+delete__disconnect_ERRNO(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_close(0, MOCK_OK);
+	configure_close(1, RPMA_E_PROVIDER);
+	expect_value(rpma_conn_disconnect, conn, MOCK_STRIPE_CONN(2));
+	will_return(rpma_conn_disconnect, MOCK_OK);
+	expect_value(rpma_conn_next_event, conn, MOCK_STRIPE_CONN(2));
+	will_return(rpma_conn_next_event, RPMA_E_UNKNOWN);
+	expect_value(rpma_conn_delete, conn, MOCK_STRIPE_CONN(2));
+	will_return(rpma_conn_delete, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_stripe_delete(&sstate->stripe);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+	assert_null(sstate->stripe);
+}
+
+/*
+ * get_conn__invalid -- invalid arguments
+ */
+static void
+get_conn__invalid(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+	struct rpma_conn *conn = NULL;
+
+	/* run test */
+	assert_int_equal(rpma_stripe_get_conn(NULL, 0, &conn), RPMA_E_INVAL);
+	assert_int_equal(rpma_stripe_get_conn(sstate->stripe, 0, NULL), RPMA_E_INVAL);
+	assert_int_equal(rpma_stripe_get_conn(sstate->stripe, -1, &conn), RPMA_E_INVAL);
+	assert_int_equal(rpma_stripe_get_conn(sstate->stripe, MOCK_NUM_CONNS, &conn),
+			RPMA_E_INVAL);
+
+	/* verify the results */
+	assert_null(conn);
+}
+
+/*
+ * get_conn__success -- all the connections are available
+ */
+static void
+get_conn__success(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	for (int i = 0; i < MOCK_NUM_CONNS; i++) {
+		/* run test */
+		struct rpma_conn *conn = NULL;
+		int ret = rpma_stripe_get_conn(sstate->stripe, i, &conn);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_ptr_equal(conn, MOCK_STRIPE_CONN(i));
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_stripe_connect() unit tests */
+		cmocka_unit_test(connect__invalid),
+		cmocka_unit_test(connect__capacity_too_big),
+		cmocka_unit_test(connect__malloc_ERRNO),
+		cmocka_unit_test(connect__connect_all_ERRNO),
+	cmocka_unit_test(connect__connect_all_ERRNO_established),
+		cmocka_unit_test(connect__target_failed),
+		cmocka_unit_test(connect__sq_size_clamped),
+		cmocka_unit_test(connect__success),
+
+		/* rpma_stripe_delete() unit tests */
+		cmocka_unit_test(delete__invalid),
+		cmocka_unit_test_setup_teardown(delete__disconnect_ERRNO,
+				setup__stripe_connect, NULL),
+
+		/* rpma_stripe_get_conn() unit tests */
+		cmocka_unit_test_setup_teardown(get_conn__invalid, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_conn__success, setup__stripe_connect,
+				teardown__stripe_delete),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe-get_wc.c -- the rpma_stripe_get_wc() unit tests
+ *
+ * API covered:
+ * - rpma_stripe_get_wc()
+ */
+
+#include "stripe-common.h"
+
+/*
+ * wc_chunk -- a completion of a chunk of the last operation posted
+ */
+static struct ibv_wc
+wc_chunk(enum ibv_wc_status status)
+{
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)Chunk_op_context;
+	wc.status = status;
+	wc.opcode = IBV_WC_RDMA_READ;
+
+	return wc;
+}
+
+/*
+ * get_wc__invalid -- NULL stripe or wc is invalid
+ */
+static void
+get_wc__invalid(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+	struct ibv_wc wc;
+
+	/* run test */
+	int ret = rpma_stripe_get_wc(NULL, &wc);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_get_wc(sstate->stripe, NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * get_wc__no_completion -- none of the CQs has a completion
+ */
+static void
+get_wc__no_completion(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_NUM_CONNS; i++)
+		configure_get_wc(i, RPMA_E_NO_COMPLETION, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_COMPLETION);
+}
+
+/*
+ * get_wc__get_wc_ERRNO -- rpma_cq_get_wc() fails
+ */
+static void
+get_wc__get_wc_ERRNO(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_get_wc(0, RPMA_E_NO_COMPLETION, NULL);
+	configure_get_wc(1, RPMA_E_PROVIDER, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * get_wc__success -- the operation is reported when all of its chunks complete and their slots
+ * of the send queues are free again
+ */
+static void
+get_wc__success(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_chunk(IBV_WC_RDMA_READ, 0, 0, MOCK_CHUNK_SIZE, MOCK_OK);
+	configure_chunk(IBV_WC_RDMA_READ, 1, MOCK_CHUNK_SIZE, MOCK_CHUNK_SIZE, MOCK_OK);
+	int ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, 2 * MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+
+	struct ibv_wc chunk_wc = wc_chunk(IBV_WC_SUCCESS);
+	configure_get_wc(0, RPMA_E_NO_COMPLETION, NULL);
+	configure_get_wc(1, MOCK_OK, &chunk_wc);
+	configure_get_wc(2, RPMA_E_NO_COMPLETION, NULL);
+	configure_get_wc(0, MOCK_OK, &chunk_wc);
+
+	/* run test */
+	struct ibv_wc wc;
+	ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal((void *)(uintptr_t)wc.wr_id, MOCK_OP_CONTEXT);
+	assert_int_equal(wc.status, IBV_WC_SUCCESS);
+	assert_int_equal(wc.opcode, IBV_WC_RDMA_READ);
+	assert_int_equal(wc.byte_len, 2 * MOCK_CHUNK_SIZE);
+
+	/* all the send queues are free again */
+	for (int i = 0; i < MOCK_CAPACITY; i++)
+		configure_chunk(IBV_WC_RDMA_READ, (i + 2) % MOCK_NUM_CONNS,
+				(size_t)i * MOCK_CHUNK_SIZE, MOCK_CHUNK_SIZE, MOCK_OK);
+	ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, MOCK_CAPACITY * MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * get_wc__on_error_success -- the successful operation posted with RPMA_F_COMPLETION_ON_ERROR
+ * is not reported
+ */
+static void
+get_wc__on_error_success(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_chunk(IBV_WC_RDMA_WRITE, 0, 0, MOCK_CHUNK_SIZE, MOCK_OK);
+	int ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ON_ERROR, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+
+	struct ibv_wc chunk_wc = wc_chunk(IBV_WC_SUCCESS);
+	configure_get_wc(0, MOCK_OK, &chunk_wc);
+	for (int i = 1; i <= MOCK_NUM_CONNS; i++)
+		configure_get_wc(i % MOCK_NUM_CONNS, RPMA_E_NO_COMPLETION, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_COMPLETION);
+}
+
+/*
+ * get_wc__chunk_failed -- the operation is reported with the status of the first failed chunk
+ */
+static void
+get_wc__chunk_failed(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_chunk(IBV_WC_RDMA_WRITE, 0, 0, MOCK_CHUNK_SIZE, MOCK_OK);
+	configure_chunk(IBV_WC_RDMA_WRITE, 1, MOCK_CHUNK_SIZE, 1, MOCK_OK);
+	int ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, MOCK_CHUNK_SIZE + 1,
+			RPMA_F_COMPLETION_ON_ERROR, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+
+	struct ibv_wc chunk_wc_1 = wc_chunk(IBV_WC_REM_ACCESS_ERR);
+	struct ibv_wc chunk_wc_2 = wc_chunk(IBV_WC_WR_FLUSH_ERR);
+	configure_get_wc(0, MOCK_OK, &chunk_wc_1);
+	configure_get_wc(1, MOCK_OK, &chunk_wc_2);
+
+	/* run test */
+	struct ibv_wc wc;
+	ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal((void *)(uintptr_t)wc.wr_id, MOCK_OP_CONTEXT);
+	assert_int_equal(wc.status, IBV_WC_REM_ACCESS_ERR);
+	assert_int_equal(wc.opcode, IBV_WC_RDMA_WRITE);
+	assert_int_equal(wc.byte_len, MOCK_CHUNK_SIZE + 1);
+}
+
+/*
+ * get_wc__abandoned -- the chunks posted before posting the operation failed are collected
+ * but the operation is not reported
+ */
+static void
+get_wc__abandoned(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_chunk(IBV_WC_RDMA_READ, 0, 0, MOCK_CHUNK_SIZE, MOCK_OK);
+	configure_chunk(IBV_WC_RDMA_READ, 1, MOCK_CHUNK_SIZE, MOCK_CHUNK_SIZE, RPMA_E_PROVIDER);
+	int ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, 2 * MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	struct ibv_wc chunk_wc = wc_chunk(IBV_WC_SUCCESS);
+	configure_get_wc(0, MOCK_OK, &chunk_wc);
+	for (int i = 1; i <= MOCK_NUM_CONNS; i++)
+		configure_get_wc(i % MOCK_NUM_CONNS, RPMA_E_NO_COMPLETION, NULL);
+
+	/* run test */
+	struct ibv_wc wc;
+	ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_NO_COMPLETION);
+}
+
+/*
+ * get_wc__foreign -- the completion of an operation posted directly on one of the connections
+ * is returned unchanged
+ */
+static void
+get_wc__foreign(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	struct ibv_wc foreign_wc = {0};
+	foreign_wc.wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	foreign_wc.status = IBV_WC_SUCCESS;
+	foreign_wc.opcode = IBV_WC_RECV;
+	configure_get_wc(0, MOCK_OK, &foreign_wc);
+
+	/* run test */
+	struct ibv_wc wc;
+	int ret = rpma_stripe_get_wc(sstate->stripe, &wc);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_ptr_equal((void *)(uintptr_t)wc.wr_id, MOCK_OP_CONTEXT);
+	assert_int_equal(wc.opcode, IBV_WC_RECV);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_stripe_get_wc() unit tests */
+		cmocka_unit_test_setup_teardown(get_wc__invalid, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__no_completion, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__get_wc_ERRNO, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__success, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__on_error_success, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__chunk_failed, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__abandoned, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(get_wc__foreign, setup__stripe_connect,
+				teardown__stripe_delete),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * stripe-read_write.c -- the rpma_stripe_read/_write() unit tests
+ *
+ * APIs covered:
+ * - rpma_stripe_read()
+ * - rpma_stripe_write()
+ */
+
+#include "stripe-common.h"
+
+/* 5 chunks, the last one is shorter */
+#define MOCK_OP_LEN	(5 * MOCK_CHUNK_SIZE - 4)
+
+/*
+ * read__invalid -- invalid arguments
+ */
+static void
+read__invalid(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+	int ret;
+
+	/* run test */
+	ret = rpma_stripe_read(NULL, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, MOCK_RPMA_MR_REMOTE,
+			MOCK_REMOTE_OFFSET, MOCK_OP_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_read(sstate->stripe, NULL, MOCK_LOCAL_OFFSET, MOCK_RPMA_MR_REMOTE,
+			MOCK_REMOTE_OFFSET, MOCK_OP_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, NULL,
+			MOCK_REMOTE_OFFSET, MOCK_OP_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, 0, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, MOCK_OP_LEN, 0, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * write__invalid -- invalid arguments
+ */
+static void
+write__invalid(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+	int ret;
+
+	/* run test */
+	ret = rpma_stripe_write(NULL, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, MOCK_RPMA_MR_LOCAL,
+			MOCK_LOCAL_OFFSET, MOCK_OP_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_write(sstate->stripe, NULL, MOCK_REMOTE_OFFSET, MOCK_RPMA_MR_LOCAL,
+			MOCK_LOCAL_OFFSET, MOCK_OP_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, NULL,
+			MOCK_LOCAL_OFFSET, MOCK_OP_LEN, RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, 0, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+	assert_int_equal(ret, RPMA_E_INVAL);
+	ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, MOCK_OP_LEN, 0, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * read__too_many_chunks -- the operation cannot fit into the send queues at all
+ */
+static void
+read__too_many_chunks(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* run test */
+	int ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_CAPACITY * MOCK_CHUNK_SIZE + 1, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * read__success -- the chunks are posted round-robin over the connections
+ */
+static void
+read__success(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < 5; i++)
+		configure_chunk(IBV_WC_RDMA_READ, i % MOCK_NUM_CONNS, (size_t)i * MOCK_CHUNK_SIZE,
+				i < 4 ? MOCK_CHUNK_SIZE : MOCK_CHUNK_SIZE - 4, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, MOCK_OP_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * write__success -- the next operation starts at the connection following the last one used
+ */
+static void
+write__success(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_chunk(IBV_WC_RDMA_WRITE, 0, 0, MOCK_CHUNK_SIZE, MOCK_OK);
+	configure_chunk(IBV_WC_RDMA_WRITE, 1, MOCK_CHUNK_SIZE, 1, MOCK_OK);
+	configure_chunk(IBV_WC_RDMA_WRITE, 2, 0, 1, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, MOCK_CHUNK_SIZE + 1,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_stripe_write(sstate->stripe, MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET, 1, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+}
+
+/*
+ * read__AGAIN -- the operation does not fit into the free slots of the send queues
+ */
+static void
+read__AGAIN(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	for (int i = 0; i < MOCK_CAPACITY - 1; i++)
+		configure_chunk(IBV_WC_RDMA_READ, i % MOCK_NUM_CONNS, (size_t)i * MOCK_CHUNK_SIZE,
+				MOCK_CHUNK_SIZE, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET,
+			(MOCK_CAPACITY - 1) * MOCK_CHUNK_SIZE, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+	ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, 2 * MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_AGAIN);
+}
+
+/*
+ * read__ERRNO -- posting the first chunk fails and no slot of the send queues is taken
+ */
+static void
+read__ERRNO(void **sstate_ptr)
+{
+	struct stripe_test_state *sstate = *sstate_ptr;
+
+	/* configure mocks */
+	configure_chunk(IBV_WC_RDMA_READ, 0, 0, MOCK_CHUNK_SIZE, RPMA_E_PROVIDER);
+
+	/* run test */
+	int ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, MOCK_OP_LEN,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+
+	/* all the send queues are still free */
+	for (int i = 0; i < MOCK_CAPACITY; i++)
+		configure_chunk(IBV_WC_RDMA_READ, i % MOCK_NUM_CONNS, (size_t)i * MOCK_CHUNK_SIZE,
+				MOCK_CHUNK_SIZE, MOCK_OK);
+	ret = rpma_stripe_read(sstate->stripe, MOCK_RPMA_MR_LOCAL, MOCK_LOCAL_OFFSET,
+			MOCK_RPMA_MR_REMOTE, MOCK_REMOTE_OFFSET, MOCK_CAPACITY * MOCK_CHUNK_SIZE,
+			RPMA_F_COMPLETION_ALWAYS, MOCK_OP_CONTEXT);
+	assert_int_equal(ret, MOCK_OK);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_stripe_read() unit tests */
+		cmocka_unit_test_setup_teardown(read__invalid, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(read__too_many_chunks, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(read__success, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(read__AGAIN, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(read__ERRNO, setup__stripe_connect,
+				teardown__stripe_delete),
+
+		/* rpma_stripe_write() unit tests */
+		cmocka_unit_test_setup_teardown(write__invalid, setup__stripe_connect,
+				teardown__stripe_delete),
+		cmocka_unit_test_setup_teardown(write__success, setup__stripe_connect,
+				teardown__stripe_delete),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * trace-common.c -- the trace unit tests common functions
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "trace-common.h"
+
+uint64_t Mock_time_ns;
+
+char Trace_path[] = "/tmp/rpma_trace-XXXXXX";
+
+/* the QP of the traced connection */
+static struct ibv_qp Qp = {.qp_num = MOCK_QP_NUM};
+
+/*
+ * __wrap_clock_gettime -- clock_gettime() mock
+ */
+int
+__wrap_clock_gettime(clockid_t clockid, struct timespec *tp)
+{
+	assert_int_equal(clockid, CLOCK_MONOTONIC);
+
+	tp->tv_sec = (time_t)(Mock_time_ns / 1000000000ULL);
+	tp->tv_nsec = (long)(Mock_time_ns % 1000000000ULL);
+
+	return 0;
+}
+
+/*
+ * trace_post -- post the operation of MOCK_LEN bytes taking 100 ns
+ */
+void
+trace_post(struct rpma_trace_conn *tconn, enum rpma_trace_op op,
+		const void *op_context, int flags, int ret)
+{
+	uint64_t begin_ns = rpma_trace_post_begin();
+	assert_int_equal(begin_ns, Mock_time_ns);
+
+	Mock_time_ns += 100;
+	rpma_trace_post_end(tconn, &Qp, op, op_context, MOCK_LEN, flags, ret, begin_ns);
+}
+
+/*
+ * trace_complete -- obtain the successful completion of the operation
+ */
+void
+trace_complete(struct rpma_trace_conn *tconn, enum ibv_wc_opcode opcode,
+		const void *op_context)
+{
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)op_context;
+	wc.status = IBV_WC_SUCCESS;
+	wc.opcode = opcode;
+	wc.qp_num = MOCK_QP_NUM;
+	wc.byte_len = MOCK_LEN;
+
+	Mock_time_ns += 1000;
+	rpma_trace_complete(tconn, &wc, 1);
+}
+
+/*
+ * trace_read_dump -- dump the events and read the file
+ */
+void
+trace_read_dump(char *buf)
+{
+	assert_int_equal(rpma_trace_dump(Trace_path), MOCK_OK);
+
+	FILE *stream = fopen(Trace_path, "r");
+	assert_non_null(stream);
+	size_t len = fread(buf, 1, MOCK_DUMP_SIZE - 1, stream);
+	assert_true(len < MOCK_DUMP_SIZE - 1);
+	buf[len] = '\0';
+	(void) fclose(stream);
+}
+
+/*
+ * setup__trace -- enable tracing and register a connection
+ */
+int
+setup__trace(void **tconn_ptr)
+{
+	static struct rpma_trace_conn tconn;
+
+	Mock_time_ns = MOCK_START_NS;
+	rpma_trace_conn_init(&tconn);
+	assert_int_equal(rpma_trace_enable(MOCK_MAX_EVENTS), MOCK_OK);
+
+	*tconn_ptr = &tconn;
+
+	return 0;
+}
+
+/*
+ * teardown__trace -- disable tracing, unregister the connection and free the events
+ */
+int
+teardown__trace(void **tconn_ptr)
+{
+	assert_int_equal(rpma_trace_disable(), MOCK_OK);
+	rpma_trace_conn_fini(*tconn_ptr);
+	rpma_trace_fini();
+
+	return 0;
+}
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * trace-common.h -- the trace unit tests common definitions
+ */
+
+#ifndef TRACE_COMMON_H
+#define TRACE_COMMON_H
+
+#include "cmocka_headers.h"
+#include "trace.h"
+#include "test-common.h"
+
+#define MOCK_START_NS	1000000000ULL
+#define MOCK_MAX_EVENTS	16
+#define MOCK_DUMP_SIZE	8192
+
+/* the current time returned by the clock_gettime() mock */
+extern uint64_t Mock_time_ns;
+
+/* the file the events are dumped to */
+extern char Trace_path[];
+
+void trace_post(struct rpma_trace_conn *tconn, enum rpma_trace_op op,
+		const void *op_context, int flags, int ret);
+void trace_complete(struct rpma_trace_conn *tconn, enum ibv_wc_opcode opcode,
+		const void *op_context);
+void trace_read_dump(char *buf);
+
+int setup__trace(void **tconn_ptr);
+int teardown__trace(void **tconn_ptr);
+
+#endif /* TRACE_COMMON_H */
@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * trace-dump.c -- the rpma_trace_dump() unit tests
+ *
+ * APIs covered:
+ * - rpma_trace_dump()
+ * - rpma_trace_post_end()
+ * - rpma_trace_complete()
+ * - rpma_trace_conn_event()
+ * - rpma_trace_conn_fini()
+ * - rpma_trace_fini()
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "trace-common.h"
+
+/*
+ * dump__path_NULL -- NULL path is invalid
+ */
+static void
+dump__path_NULL(void **unused)
+{
+	/* run test */
+	int ret = rpma_trace_dump(NULL);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * dump__fopen_ERRNO -- the file cannot be created
+ */
+static void
+dump__fopen_ERRNO(void **unused)
+{
+	/* run test */
+	int ret = rpma_trace_dump("/nonexistent/rpma_trace.json");
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_UNKNOWN);
+}
+
+/*
+ * dump__no_events -- the trace is empty if nothing has been recorded
+ */
+static void
+dump__no_events(void **unused)
+{
+	char buf[MOCK_DUMP_SIZE];
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	char expected[MOCK_DUMP_SIZE];
+	(void) snprintf(expected, sizeof(expected),
+		"{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+		"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+		"\"args\":{\"name\":\"librpma\"}}\n]}\n", getpid());
+	assert_string_equal(buf, expected);
+}
+
+/*
+ * dump__events -- the posts, the completions, the connection events and the queue depths
+ * are dumped in the order they have been recorded
+ */
+static void
+dump__events(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	rpma_trace_conn_event(tconn, NULL, RPMA_CONN_ESTABLISHED);
+	trace_post(tconn, RPMA_TRACE_WRITE, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ALWAYS, MOCK_OK);
+	trace_post(tconn, RPMA_TRACE_FLUSH, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ON_ERROR, MOCK_OK);
+	trace_post(tconn, RPMA_TRACE_RECV, MOCK_OP_CONTEXT, 0, MOCK_OK);
+	trace_complete(tconn, IBV_WC_RDMA_WRITE, MOCK_OP_CONTEXT);
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	const char *expected[] = {
+		"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+			"\"args\":{\"name\":\"QP 0\"}}",
+		"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":1289,"
+			"\"args\":{\"name\":\"QP 1289\"}}",
+		"{\"name\":\"\",\"cat\":\"cm\",\"ph\":\"i\",\"s\":\"t\",\"ts\":1000000.000,"
+			"\"pid\":%d,\"tid\":0}",
+		"{\"name\":\"write\",\"cat\":\"post\",\"ph\":\"X\",\"ts\":1000000.000,"
+			"\"dur\":0.100,\"pid\":%d,\"tid\":1289,\"args\":{\"wr_id\":\"0xc417\","
+			"\"len\":50197,\"signaled\":true,\"ret\":0}}",
+		"{\"name\":\"QP 1289 depth\",\"ph\":\"C\",\"ts\":1000000.100,\"pid\":%d,"
+			"\"args\":{\"sq\":1,\"rq\":0,\"err\":0}}",
+		"{\"name\":\"flush\",\"cat\":\"post\",\"ph\":\"X\",\"ts\":1000000.100,"
+			"\"dur\":0.100,\"pid\":%d,\"tid\":1289,\"args\":{\"wr_id\":\"0xc417\","
+			"\"len\":50197,\"signaled\":false,\"ret\":0}}",
+		"{\"name\":\"QP 1289 depth\",\"ph\":\"C\",\"ts\":1000000.200,\"pid\":%d,"
+			"\"args\":{\"sq\":1,\"rq\":0,\"err\":0}}",
+		"{\"name\":\"recv\",\"cat\":\"post\",\"ph\":\"X\",\"ts\":1000000.200,"
+			"\"dur\":0.100,\"pid\":%d,\"tid\":1289,\"args\":{\"wr_id\":\"0xc417\","
+			"\"len\":50197,\"signaled\":true,\"ret\":0}}",
+		"{\"name\":\"QP 1289 depth\",\"ph\":\"C\",\"ts\":1000000.300,\"pid\":%d,"
+			"\"args\":{\"sq\":1,\"rq\":1,\"err\":0}}",
+		"{\"name\":\"completion\",\"cat\":\"completion\",\"ph\":\"i\",\"s\":\"t\","
+			"\"ts\":1000001.300,\"pid\":%d,\"tid\":1289,\"args\":{\"wr_id\":\"0xc417\","
+			"\"opcode\":1,\"byte_len\":50197,\"status\":0}}",
+		"{\"name\":\"QP 1289 depth\",\"ph\":\"C\",\"ts\":1000001.300,\"pid\":%d,"
+			"\"args\":{\"sq\":0,\"rq\":1,\"err\":0}}",
+	};
+
+	const char *pos = buf;
+	for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+		char line[512];
+		(void) snprintf(line, sizeof(line), expected[i], getpid());
+		pos = strstr(pos, line);
+		assert_non_null(pos);
+	}
+	assert_string_equal(strchr(pos, '\n'), "\n]}\n");
+}
+
+/*
+ * dump__post_failed -- a post which has failed does not change the queue depths
+ */
+static void
+dump__post_failed(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	trace_post(tconn, RPMA_TRACE_READ, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ALWAYS,
+			RPMA_E_PROVIDER);
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	assert_non_null(strstr(buf, "\"signaled\":true,\"ret\":-100002}}"));
+	assert_null(strstr(buf, "\"ph\":\"C\""));
+	assert_int_equal(atomic_load(&tconn->sq_depth), 0);
+}
+
+/*
+ * dump__depth_not_negative -- the completions of the operations posted before tracing
+ * has been enabled do not make the queue depths negative
+ */
+static void
+dump__depth_not_negative(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	trace_complete(tconn, IBV_WC_RDMA_READ, MOCK_OP_CONTEXT);
+	trace_complete(tconn, IBV_WC_RECV, MOCK_OP_CONTEXT);
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	assert_null(strstr(buf, "-1"));
+	assert_int_equal(atomic_load(&tconn->sq_depth), 0);
+	assert_int_equal(atomic_load(&tconn->rq_depth), 0);
+}
+
+/*
+ * dump__error_completion -- an error completion is counted separately since its opcode
+ * is undefined
+ */
+static void
+dump__error_completion(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	trace_post(tconn, RPMA_TRACE_WRITE, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ALWAYS, MOCK_OK);
+
+	struct ibv_wc wc = {0};
+	wc.wr_id = (uint64_t)(uintptr_t)MOCK_OP_CONTEXT;
+	wc.status = IBV_WC_WR_FLUSH_ERR;
+	wc.opcode = IBV_WC_RECV; /* garbage */
+	wc.qp_num = MOCK_QP_NUM;
+	rpma_trace_complete(tconn, &wc, 1);
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	char expected[512];
+	(void) snprintf(expected, sizeof(expected),
+		"\"pid\":%d,\"tid\":1289,\"args\":{\"wr_id\":\"0xc417\",\"status\":5}}", getpid());
+	assert_non_null(strstr(buf, expected));
+	assert_non_null(strstr(buf, "\"args\":{\"sq\":1,\"rq\":0,\"err\":1}}"));
+	assert_int_equal(atomic_load(&tconn->sq_depth), 1);
+	assert_int_equal(atomic_load(&tconn->rq_depth), 0);
+	assert_int_equal(atomic_load(&tconn->errors), 1);
+}
+
+/*
+ * dump__deleted_conn -- the events of a deleted connection are dumped along with the events
+ * of the other connections until tracing is enabled again
+ */
+static void
+dump__deleted_conn(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	struct rpma_trace_conn deleted;
+	char buf[MOCK_DUMP_SIZE];
+
+	rpma_trace_conn_init(&deleted);
+	trace_post(&deleted, RPMA_TRACE_READ, (void *)0x1, RPMA_F_COMPLETION_ALWAYS, MOCK_OK);
+	rpma_trace_conn_fini(&deleted);
+	trace_post(tconn, RPMA_TRACE_READ, (void *)0x2, RPMA_F_COMPLETION_ALWAYS, MOCK_OK);
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	assert_non_null(strstr(buf, "\"wr_id\":\"0x1\""));
+	assert_non_null(strstr(buf, "\"wr_id\":\"0x2\""));
+
+	assert_int_equal(rpma_trace_enable(MOCK_MAX_EVENTS), MOCK_OK);
+	trace_read_dump(buf);
+	assert_null(strstr(buf, "\"cat\":\"post\""));
+}
+
+/*
+ * dump__overwritten -- the oldest events are overwritten when the ring is full
+ */
+static void
+dump__overwritten(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	for (uintptr_t i = 1; i <= MOCK_MAX_EVENTS + 4; i++)
+		trace_post(tconn, RPMA_TRACE_SEND, (void *)i, RPMA_F_COMPLETION_ON_ERROR, MOCK_OK);
+
+	/* run test */
+	trace_read_dump(buf);
+
+	/* verify the results */
+	assert_null(strstr(buf, "\"wr_id\":\"0x4\""));
+	assert_non_null(strstr(buf, "\"wr_id\":\"0x5\""));
+	assert_non_null(strstr(buf, "\"wr_id\":\"0x14\""));
+	/* the oldest event recorded is the first one */
+	assert_true(strstr(buf, "\"wr_id\":\"0x5\"") < strstr(buf, "\"wr_id\":\"0x6\""));
+}
+
+/*
+ * fini__no_events -- rpma_trace_fini() frees the events and disables tracing
+ */
+static void
+fini__no_events(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	trace_post(tconn, RPMA_TRACE_ATOMIC_WRITE, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ALWAYS,
+			MOCK_OK);
+
+	/* run test */
+	rpma_trace_fini();
+
+	/* verify the results */
+	assert_int_equal(rpma_trace_post_begin(), 0);
+	trace_read_dump(buf);
+	assert_null(strstr(buf, "\"cat\":\"post\""));
+}
+
+int
+main(int argc, char *argv[])
+{
+	int fd = mkstemp(Trace_path);
+	if (fd < 0)
+		return -1;
+	(void) close(fd);
+
+	const struct CMUnitTest tests[] = {
+		/* rpma_trace_dump() unit tests */
+		cmocka_unit_test(dump__path_NULL),
+		cmocka_unit_test(dump__fopen_ERRNO),
+		cmocka_unit_test(dump__no_events),
+		cmocka_unit_test_setup_teardown(dump__events,
+			setup__trace, teardown__trace),
+		cmocka_unit_test_setup_teardown(dump__post_failed,
+			setup__trace, teardown__trace),
+		cmocka_unit_test_setup_teardown(dump__depth_not_negative,
+			setup__trace, teardown__trace),
+		cmocka_unit_test_setup_teardown(dump__error_completion,
+			setup__trace, teardown__trace),
+		cmocka_unit_test_setup_teardown(dump__deleted_conn,
+			setup__trace, teardown__trace),
+		cmocka_unit_test_setup_teardown(dump__overwritten,
+			setup__trace, teardown__trace),
+
+		/* rpma_trace_fini() unit tests */
+		cmocka_unit_test_setup_teardown(fini__no_events,
+			setup__trace, teardown__trace),
+	};
+
+	int ret = cmocka_run_group_tests(tests, NULL, NULL);
+
+	(void) unlink(Trace_path);
+
+	return ret;
+}
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * trace-enable.c -- the rpma_trace_enable/_disable() unit tests
+ *
+ * APIs covered:
+ * - rpma_trace_enable()
+ * - rpma_trace_disable()
+ * - rpma_trace_post_begin()
+ * - rpma_trace_complete()
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "trace-common.h"
+
+/*
+ * enable__max_events_0 -- max_events == 0 is invalid
+ */
+static void
+enable__max_events_0(void **unused)
+{
+	/* run test */
+	int ret = rpma_trace_enable(0);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * enable__max_events_too_big -- max_events not fitting the memory is invalid
+ */
+static void
+enable__max_events_too_big(void **unused)
+{
+	/* run test */
+	int ret = rpma_trace_enable(SIZE_MAX);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+	assert_int_equal(rpma_trace_post_begin(), 0);
+}
+
+/*
+ * enable__drop_events -- enabling tracing again drops the events recorded so far
+ */
+static void
+enable__drop_events(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	trace_post(tconn, RPMA_TRACE_WRITE, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ALWAYS, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_trace_enable(MOCK_MAX_EVENTS);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	trace_read_dump(buf);
+	assert_null(strstr(buf, "\"cat\":\"post\""));
+	assert_non_null(strstr(buf, "\"traceEvents\":["));
+}
+
+/*
+ * disable__nothing_recorded -- nothing is recorded when tracing is disabled
+ * but the events recorded so far are kept
+ */
+static void
+disable__nothing_recorded(void **tconn_ptr)
+{
+	struct rpma_trace_conn *tconn = *tconn_ptr;
+	char buf[MOCK_DUMP_SIZE];
+
+	trace_post(tconn, RPMA_TRACE_SEND, MOCK_OP_CONTEXT, RPMA_F_COMPLETION_ALWAYS, MOCK_OK);
+
+	/* run test */
+	int ret = rpma_trace_disable();
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(rpma_trace_post_begin(), 0);
+	trace_complete(tconn, IBV_WC_SEND, MOCK_OP_CONTEXT);
+	rpma_trace_conn_event(tconn, NULL, RPMA_CONN_CLOSED);
+
+	trace_read_dump(buf);
+	assert_non_null(strstr(buf, "\"name\":\"send\",\"cat\":\"post\""));
+	assert_null(strstr(buf, "\"cat\":\"completion\""));
+	assert_null(strstr(buf, "\"cat\":\"cm\""));
+	/* the completion obtained while disabled has not been counted */
+	assert_int_equal(atomic_load(&tconn->sq_depth), 1);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int fd = mkstemp(Trace_path);
+	if (fd < 0)
+		return -1;
+	(void) close(fd);
+
+	const struct CMUnitTest tests[] = {
+		/* rpma_trace_enable() unit tests */
+		cmocka_unit_test(enable__max_events_0),
+		cmocka_unit_test(enable__max_events_too_big),
+		cmocka_unit_test_setup_teardown(enable__drop_events,
+			setup__trace, teardown__trace),
+
+		/* rpma_trace_disable() unit tests */
+		cmocka_unit_test_setup_teardown(disable__nothing_recorded,
+			setup__trace, teardown__trace),
+	};
+
+	int ret = cmocka_run_group_tests(tests, NULL, NULL);
+
+	(void) unlink(Trace_path);
+
+	return ret;
+}
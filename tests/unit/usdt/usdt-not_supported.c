@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * usdt-not_supported.c -- the RPMA_USDT*() macros unit tests when <sys/sdt.h> is missing
+ */
+
+/* build as if <sys/sdt.h> was not available regardless of the build host */
+#undef USDT_SUPPORTED
+
+#include "cmocka_headers.h"
+#include "usdt.h"
+
+/*
+ * probes__not_evaluated -- the probes compile to nothing and do not evaluate their arguments
+ */
+static void
+probes__not_evaluated(void **unused)
+{
+	int i = 0;
+	int *null = NULL; /* dereferenced only if a probe evaluates its arguments */
+
+	/* the probes have to be usable as a single statement */
+	if (i)
+		RPMA_USDT1(test1, *null);
+	else
+		RPMA_USDT1(test1, i++);
+
+	RPMA_USDT2(test2, *null, i++);
+	RPMA_USDT3(test3, *null, i++, *null);
+	RPMA_USDT4(test4, *null, i++, *null, i++);
+
+	assert_int_equal(i, 0);
+	assert_null(null);
+}
+
+static const struct CMUnitTest tests_usdt[] = {
+	/* the RPMA_USDT*() macros unit tests */
+	cmocka_unit_test(probes__not_evaluated),
+	cmocka_unit_test(NULL)
+};
+
+int
+main(int argc, char *argv[])
+{
+	return cmocka_run_group_tests(tests_usdt, NULL, NULL);
+}
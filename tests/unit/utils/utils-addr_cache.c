@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * utils-addr_cache.c -- a unit test for rpma_utils_addr_cache_set_ttl()
+ * and rpma_utils_addr_cache_invalidate()
+ */
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "librpma.h"
+#include "test-common.h"
+
+#define MOCK_TTL_MS	1000
+
+/*
+ * set_ttl__ttl_negative -- negative ttl_ms is invalid
+ */
+static void
+set_ttl__ttl_negative(void **unused)
+{
+	/* run test */
+	int ret = rpma_utils_addr_cache_set_ttl(-1);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_INVAL);
+}
+
+/*
+ * set_ttl__success -- the TTL is passed to the cache (0 disables it)
+ */
+static void
+set_ttl__success(void **unused)
+{
+	int ttls[] = {MOCK_TTL_MS, 0};
+
+	for (int i = 0; i < 2; i++) {
+		/* configure mocks */
+		expect_value(rpma_addr_cache_set_ttl, ttl_ms, ttls[i]);
+
+		/* run test */
+		int ret = rpma_utils_addr_cache_set_ttl(ttls[i]);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+	}
+}
+
+/*
+ * invalidate__success -- the entries of the device (or all of them) are dropped
+ */
+static void
+invalidate__success(void **unused)
+{
+	struct ibv_context *ibv_ctxs[] = {MOCK_VERBS, NULL};
+
+	for (int i = 0; i < 2; i++) {
+		/* configure mocks */
+		expect_value(rpma_addr_cache_invalidate, ibv_ctx, ibv_ctxs[i]);
+
+		/* run test */
+		int ret = rpma_utils_addr_cache_invalidate(ibv_ctxs[i]);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	const struct CMUnitTest tests[] = {
+		/* rpma_utils_addr_cache_set_ttl() unit tests */
+		cmocka_unit_test(set_ttl__ttl_negative),
+		cmocka_unit_test(set_ttl__success),
+
+		/* rpma_utils_addr_cache_invalidate() unit tests */
+		cmocka_unit_test(invalidate__success),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -12,6 +12,7 @@
 #include "cmocka_headers.h"
 #include "librpma.h"
 #include "mocks-ibverbs.h"
+#include "mocks-rpma-addr_cache.h"
 #include "info.h"
 #include "test-common.h"
 
@@ -352,6 +353,66 @@ get_ibvc__success_active(void **unused)
 	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
 }
 
+/*
+ * get_ibvc__cache_miss - the obtained device is cached
+ */
+static void
+get_ibvc__cache_miss(void **unused)
+{
+	/* configure mocks */
+	Mock_addr_cache_enabled = true;
+	expect_value(rpma_addr_cache_lookup_ibv_context, side, RPMA_INFO_ACTIVE);
+	will_return(rpma_addr_cache_lookup_ibv_context, NULL);
+	will_return(rpma_info_new, MOCK_INFO);
+
+	struct rdma_cm_id id;
+	id.verbs = MOCK_VERBS;
+	will_return(rdma_create_id, &id);
+
+	expect_value(rpma_info_resolve_addr, info, MOCK_INFO);
+	expect_value(rpma_info_resolve_addr, id, &id);
+	will_return(rpma_info_resolve_addr, 0);
+
+	expect_value(rpma_addr_cache_insert_ibv_context, side, RPMA_INFO_ACTIVE);
+	expect_value(rpma_addr_cache_insert_ibv_context, ibv_ctx, MOCK_VERBS);
+
+	will_return(rdma_destroy_id, 0);
+
+	/* run test */
+	struct ibv_context *ibv_ctx = NULL;
+	int ret = rpma_utils_get_ibv_context(MOCK_IP_ADDRESS,
+			RPMA_UTIL_IBV_CONTEXT_REMOTE, &ibv_ctx);
+
+	/* verify the results */
+	assert_int_equal(ret, 0);
+	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
+
+	Mock_addr_cache_enabled = false;
+}
+
+/*
+ * get_ibvc__cache_hit - the cached device is returned without any CM ID
+ */
+static void
+get_ibvc__cache_hit(void **unused)
+{
+	/* configure mocks */
+	Mock_addr_cache_enabled = true;
+	expect_value(rpma_addr_cache_lookup_ibv_context, side, RPMA_INFO_PASSIVE);
+	will_return(rpma_addr_cache_lookup_ibv_context, MOCK_VERBS);
+
+	/* run test */
+	struct ibv_context *ibv_ctx = NULL;
+	int ret = rpma_utils_get_ibv_context(MOCK_IP_ADDRESS,
+			RPMA_UTIL_IBV_CONTEXT_LOCAL, &ibv_ctx);
+
+	/* verify the results */
+	assert_int_equal(ret, 0);
+	assert_ptr_equal(ibv_ctx, MOCK_VERBS);
+
+	Mock_addr_cache_enabled = false;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -372,6 +433,8 @@ main(int argc, char *argv[])
 		cmocka_unit_test(get_ibvc__success_destroy_id_failed_active),
 		cmocka_unit_test(get_ibvc__success_passive),
 		cmocka_unit_test(get_ibvc__success_active),
+		cmocka_unit_test(get_ibvc__cache_miss),
+		cmocka_unit_test(get_ibvc__cache_hit),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
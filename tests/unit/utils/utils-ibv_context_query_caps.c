@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * utils-ibv_context_query_caps.c -- a unit test for rpma_utils_ibv_context_query_caps()
+ */
+
+#include "cmocka_headers.h"
+#include "mocks-ibverbs.h"
+#include "librpma.h"
+#include "test-common.h"
+#include "utils.h"
+
+#define MOCK_MAX_QP_WR	16384
+#define MOCK_MAX_SGE	30
+#define MOCK_MAX_CQE	4194303
+#define MOCK_MAX_SRQ_WR	32767
+
+/*
+ * query_caps__query_fail -- ibv_query_device_ex() failed
+ */
+static void
+query_caps__query_fail(void **unused)
+{
+	/* configure mocks */
+	will_return(ibv_query_device_ex_mock, NULL);
+	will_return(ibv_query_device_ex_mock, MOCK_ERRNO);
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, RPMA_E_PROVIDER);
+}
+
+/*
+ * query_caps__limits -- the device limits are copied and no optional feature is reported
+ * if none of them is set in the device attributes
+ */
+static void
+query_caps__limits(void **unused)
+{
+	/* configure mocks */
+	struct ibv_device_attr_ex attr = {{{0}}};
+	attr.orig_attr.max_qp_wr = MOCK_MAX_QP_WR;
+	attr.orig_attr.max_sge = MOCK_MAX_SGE;
+	attr.orig_attr.max_cqe = MOCK_MAX_CQE;
+	attr.orig_attr.max_srq_wr = MOCK_MAX_SRQ_WR;
+	attr.orig_attr.atomic_cap = IBV_ATOMIC_NONE;
+	will_return(ibv_query_device_ex_mock, &attr);
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(caps.max_qp_wr, MOCK_MAX_QP_WR);
+	assert_int_equal(caps.max_sge, MOCK_MAX_SGE);
+	assert_int_equal(caps.max_cqe, MOCK_MAX_CQE);
+	assert_int_equal(caps.max_srq_wr, MOCK_MAX_SRQ_WR);
+	assert_int_equal(caps.is_atomic_supported, 0);
+	assert_int_equal(caps.is_native_atomic_write_supported, 0);
+	assert_int_equal(caps.is_native_flush_supported, 0);
+	assert_int_equal(caps.is_odp_supported, 0);
+}
+
+/*
+ * query_caps__atomic -- the atomic operations are supported if atomic_cap is not
+ * IBV_ATOMIC_NONE
+ */
+static void
+query_caps__atomic(void **unused)
+{
+	/* configure mocks */
+	struct ibv_device_attr_ex attr = {{{0}}};
+	attr.orig_attr.atomic_cap = IBV_ATOMIC_HCA;
+	will_return(ibv_query_device_ex_mock, &attr);
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(caps.is_atomic_supported, 1);
+}
+
+#ifdef NATIVE_ATOMIC_WRITE_SUPPORTED
+/*
+ * query_caps__atomic_write -- the atomic write attribute is set in attr.device_cap_flags_ex
+ */
+static void
+query_caps__atomic_write(void **unused)
+{
+	/* configure mocks */
+	struct ibv_device_attr_ex attr = {{{0}}};
+	attr.device_cap_flags_ex = IB_UVERBS_DEVICE_ATOMIC_WRITE;
+	will_return(ibv_query_device_ex_mock, &attr);
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(caps.is_native_atomic_write_supported, 1);
+}
+#endif
+
+#ifdef NATIVE_FLUSH_SUPPORTED
+/*
+ * query_caps__flush_one_attribute -- only one flush attribute is set
+ * in attr.device_cap_flags_ex
+ */
+static void
+query_caps__flush_one_attribute(void **unused)
+{
+	struct ibv_device_attr_ex attr = {{{0}}};
+	uint64_t flush_attrs[2] = {IB_UVERBS_DEVICE_FLUSH_GLOBAL,
+			IB_UVERBS_DEVICE_FLUSH_PERSISTENT};
+	int num = sizeof(flush_attrs) / sizeof(flush_attrs[0]);
+
+	for (int i = 0; i < num; i++) {
+		/* configure mocks */
+		attr.device_cap_flags_ex = flush_attrs[i];
+		will_return(ibv_query_device_ex_mock, &attr);
+
+		/* run test */
+		struct rpma_peer_caps caps;
+		int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+		/* verify the results */
+		assert_int_equal(ret, MOCK_OK);
+		assert_int_equal(caps.is_native_flush_supported, 0);
+	}
+}
+
+/*
+ * query_caps__flush_both_attributes -- both of flush attributes are set
+ * in attr.device_cap_flags_ex
+ */
+static void
+query_caps__flush_both_attributes(void **unused)
+{
+	/* configure mocks */
+	struct ibv_device_attr_ex attr = {{{0}}};
+	attr.device_cap_flags_ex = IB_UVERBS_DEVICE_FLUSH_GLOBAL |
+			IB_UVERBS_DEVICE_FLUSH_PERSISTENT;
+	will_return(ibv_query_device_ex_mock, &attr);
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(caps.is_native_flush_supported, 1);
+}
+#endif
+
+#ifdef ON_DEMAND_PAGING_SUPPORTED
+/*
+ * query_caps__odp -- On-Demand Paging is supported for RDMA read and write
+ */
+static void
+query_caps__odp(void **unused)
+{
+	/* configure mocks */
+	struct ibv_device_attr_ex attr = {{{0}}};
+	attr.odp_caps.general_caps = IBV_ODP_SUPPORT;
+	attr.odp_caps.per_transport_caps.rc_odp_caps =
+			IBV_ODP_SUPPORT_WRITE | IBV_ODP_SUPPORT_READ;
+	will_return(ibv_query_device_ex_mock, &attr);
+
+	/* run test */
+	struct rpma_peer_caps caps;
+	int ret = rpma_utils_ibv_context_query_caps(MOCK_VERBS, &caps);
+
+	/* verify the results */
+	assert_int_equal(ret, MOCK_OK);
+	assert_int_equal(caps.is_odp_supported, 1);
+}
+#endif
+
+int
+main(int argc, char *argv[])
+{
+	MOCK_VERBS->abi_compat = __VERBS_ABI_IS_EXTENDED;
+	Verbs_context.query_device_ex = ibv_query_device_ex_mock;
+	Verbs_context.sz = sizeof(struct verbs_context);
+
+	const struct CMUnitTest tests[] = {
+		/* rpma_utils_ibv_context_query_caps() unit tests */
+		cmocka_unit_test(query_caps__query_fail),
+		cmocka_unit_test(query_caps__limits),
+		cmocka_unit_test(query_caps__atomic),
+#ifdef NATIVE_ATOMIC_WRITE_SUPPORTED
+		cmocka_unit_test(query_caps__atomic_write),
+#endif
+#ifdef NATIVE_FLUSH_SUPPORTED
+		cmocka_unit_test(query_caps__flush_one_attribute),
+		cmocka_unit_test(query_caps__flush_both_attributes),
+#endif
+#ifdef ON_DEMAND_PAGING_SUPPORTED
+		cmocka_unit_test(query_caps__odp),
+#endif
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/* Copyright 2026, Intel Corporation */
+
+/*
+ * rpma_log_decode.c -- decode the binary log file written by rpma_log_binary_start(3)
+ *
+ * usage: rpma_log_decode <file>
+ *
+ * The messages are printed in the order they were logged in the format of the default
+ * logging function.
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "librpma.h"
+#include "log_binary_format.h"
+
+static const char *Level_names[] = {
+	[RPMA_LOG_LEVEL_FATAL]	=  "*FATAL* ",
+	[RPMA_LOG_LEVEL_ERROR]	=  "*ERROR* ",
+	[RPMA_LOG_LEVEL_WARNING] = "*WARN*  ",
+	[RPMA_LOG_LEVEL_NOTICE]	=  "*NOTE*  ",
+	[RPMA_LOG_LEVEL_INFO]	=  "*INFO*  ",
+	[RPMA_LOG_LEVEL_DEBUG]	=  "*DEBUG* ",
+};
+
+/*
+ * compare_seq -- compare the records by their sequence numbers
+ */
+static int
+compare_seq(const void *a, const void *b)
+{
+	const struct rpma_log_binary_record *ra = *(const struct rpma_log_binary_record **)a;
+	const struct rpma_log_binary_record *rb = *(const struct rpma_log_binary_record **)b;
+
+	return (ra->seq > rb->seq) - (ra->seq < rb->seq);
+}
+
+/*
+ * print_record -- print the record in the format of the default logging function
+ */
+static void
+print_record(const struct rpma_log_binary_record *rec, const struct rpma_log_binary_site *sites,
+		uint32_t sites_max)
+{
+	char timestamp[48] = "[time error] ";
+	time_t sec = (time_t)(rec->ts_ns / 1000000000ULL);
+	long usec = (long)(rec->ts_ns % 1000000000ULL) / 1000;
+	struct tm info;
+	char date[24];
+	if (localtime_r(&sec, &info) && strftime(date, sizeof(date), "%b %d %H:%M:%S", &info))
+		(void) snprintf(timestamp, sizeof(timestamp), "%s.%06ld ", date, usec);
+
+	const char *level = rec->level < sizeof(Level_names) / sizeof(Level_names[0]) ?
+			Level_names[rec->level] : Level_names[RPMA_LOG_LEVEL_DEBUG];
+
+	if (rec->site >= sites_max ||
+			sites[rec->site].state != RPMA_LOG_BINARY_SITE_READY) {
+		printf("%s[%d] %s[unknown call site %u]\n", timestamp, rec->tid, level,
+				rec->site);
+		return;
+	}
+
+	const struct rpma_log_binary_site *site = &sites[rec->site];
+	char file_name[sizeof(site->file_name)];
+	char function_name[sizeof(site->function_name)];
+	char format[sizeof(site->format)];
+	(void) snprintf(file_name, sizeof(file_name), "%.*s", (int)sizeof(file_name) - 1,
+			site->file_name);
+	(void) snprintf(function_name, sizeof(function_name), "%.*s",
+			(int)sizeof(function_name) - 1, site->function_name);
+	(void) snprintf(format, sizeof(format), "%.*s", (int)sizeof(format) - 1, site->format);
+
+	const char *base_file_name = strrchr(file_name, '/');
+	base_file_name = base_file_name ? base_file_name + 1 : file_name;
+
+	char message[1024];
+	size_t len = rpma_log_binary_decode(rec, format, message, sizeof(message));
+
+	printf("%s[%d] %s%s: %3d: %s: %s%s", timestamp, rec->tid, level, base_file_name,
+			site->line_no, function_name, message,
+			(len == 0 || message[len - 1] != '\n') ? "\n" : "");
+}
+
+int
+main(int argc, char *argv[])
+{
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <file>\n", argv[0]);
+		return 1;
+	}
+
+	int fd = open(argv[1], O_RDONLY);
+	if (fd < 0) {
+		perror(argv[1]);
+		return 1;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st)) {
+		perror(argv[1]);
+		(void) close(fd);
+		return 1;
+	}
+
+	size_t size = (size_t)st.st_size;
+	if (size < RPMA_LOG_BINARY_HEADER_SIZE) {
+		fprintf(stderr, "%s: not a binary log file\n", argv[1]);
+		(void) close(fd);
+		return 1;
+	}
+
+	char *addr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	(void) close(fd);
+	if (addr == MAP_FAILED) {
+		perror(argv[1]);
+		return 1;
+	}
+
+	int ret = 1;
+	const struct rpma_log_binary_header *header = (void *)addr;
+	if (memcmp(header->magic, RPMA_LOG_BINARY_MAGIC, sizeof(RPMA_LOG_BINARY_MAGIC)) != 0) {
+		fprintf(stderr, "%s: not a binary log file\n", argv[1]);
+		goto err_unmap;
+	}
+
+	if (header->version != RPMA_LOG_BINARY_VERSION) {
+		fprintf(stderr, "%s: unsupported version %u\n", argv[1], header->version);
+		goto err_unmap;
+	}
+
+	uint64_t sites_size = (uint64_t)header->sites_max * sizeof(struct rpma_log_binary_site);
+	if (header->records_offset < RPMA_LOG_BINARY_HEADER_SIZE + sites_size ||
+			header->records_offset > size ||
+			header->records_num > (size - header->records_offset) /
+				sizeof(struct rpma_log_binary_record)) {
+		fprintf(stderr, "%s: the file is corrupted\n", argv[1]);
+		goto err_unmap;
+	}
+
+	const struct rpma_log_binary_site *sites =
+			(void *)(addr + RPMA_LOG_BINARY_HEADER_SIZE);
+	const struct rpma_log_binary_record *records =
+			(void *)(addr + header->records_offset);
+
+	const struct rpma_log_binary_record **sorted =
+			calloc(header->records_num ? header->records_num : 1, sizeof(*sorted));
+	if (sorted == NULL) {
+		perror("calloc");
+		goto err_unmap;
+	}
+
+	/* the records being written at the moment of a crash are skipped */
+	size_t num = 0;
+	for (uint64_t i = 0; i < header->records_num; i++) {
+		if (records[i].seq != 0)
+			sorted[num++] = &records[i];
+	}
+	qsort(sorted, num, sizeof(*sorted), compare_seq);
+
+	for (size_t i = 0; i < num; i++)
+		print_record(sorted[i], sites, header->sites_max);
+
+	if (header->next_seq > header->records_num)
+		fprintf(stderr, "%" PRIu64 " oldest message(s) overwritten\n",
+				header->next_seq - header->records_num);
+	if (header->dropped)
+		fprintf(stderr, "%" PRIu64
+				" message(s) dropped, the table of the call sites was full\n",
+				(uint64_t)header->dropped);
+
+	free(sorted);
+	ret = 0;
+
+err_unmap:
+	(void) munmap(addr, size);
+	return ret;
+}